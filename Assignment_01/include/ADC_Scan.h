@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * @file    ADC_Scan.h
+ * @brief   Periodic multi-channel ADC scan with PDB sequencing and eDMA
+ *          double buffer header file.
+ *
+ * ADC0 is sequenced by PDB0, ADC1 by PDB1. One input per ADC slot; every
+ * PDB period the pre-triggers run back to back: slot 0 after the period
+ * starts, each next slot when the previous conversion completes. At the
+ * end of the period the PDB raises one DMA request that copies all
+ * results of the scan into the buffer, so scans need no CPU at all.
+ *
+ * The buffer holds two halves of `frames` scans, samples interleaved
+ * (scan 0 input 0, scan 0 input 1, ...). The callback gets each half when
+ * it is full, from the DMA interrupt, while DMA fills the other half.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef ADC_SCAN_H_
+#define ADC_SCAN_H_
+
+#include <stdint.h>
+#include "Driver_Common.h"
+#include "HAL_ADC.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ADC_SCAN_INPUT_MAX          (8U)                                /**< PDB pre-triggers */
+#define ADC_SCAN_ERROR_RATE         (ARM_DRIVER_ERROR_SPECIFIC - 1)     /**< Scan longer than the period */
+
+/**
+ * @brief Half buffer filled, called from the DMA interrupt.
+ *
+ * @param samples   frames * inputCount samples.
+ * @param frames    Scans in the half buffer.
+ * @param param     User pointer of the configuration.
+ */
+typedef void (*ADC_Scan_Callback_t)(const uint16_t *samples, uint16_t frames, void *param);
+
+/**
+ * @brief Constant configuration.
+ */
+typedef struct
+{
+    HAL_ADC_Instance_t  instance;       /**< ADC, with the PDB of the same number   */
+    const uint8_t       *input;         /**< ADCH input of each slot, scan order    */
+    uint8_t             inputCount;     /**< 1 ... ADC_SCAN_INPUT_MAX               */
+    HAL_ADC_Config_t    adc;            /**< Resolution, clock, sample time, averaging */
+    uint32_t            rate;           /**< Scans per second                       */
+    uint16_t            *buffer;        /**< 2 * frames * inputCount samples        */
+    uint16_t            frames;         /**< Scans per half buffer                  */
+    ADC_Scan_Callback_t callback;
+    void                *param;
+} ADC_ScanConfig_t;
+
+/**
+ * @brief Timing and counters.
+ */
+typedef struct
+{
+    uint32_t    rate;               /**< Achieved scans/s = samples/s per input         */
+    uint32_t    scanTimeNs;         /**< Estimated trigger to last sample               */
+    uint32_t    latencyNs;          /**< Measured trigger to last sample, 0 = not yet   */
+    uint32_t    halves;             /**< Half buffers delivered                         */
+    uint32_t    sequenceErrors;     /**< Pre-trigger errors found by ADC_Scan_GetStats   */
+} ADC_ScanStats_t;
+
+/**
+ * @brief Scan, allocated by the caller.
+ */
+typedef struct
+{
+    const ADC_ScanConfig_t  *config;
+    uint8_t                 channel;        /**< eDMA channel           */
+    uint32_t                tickHz;         /**< PDB counter clock      */
+    volatile uint8_t        running;
+    ADC_ScanStats_t         stats;
+} ADC_Scan_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up ADC, PDB and DMA, calibrate the ADC (blocking).
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, ADC_SCAN_ERROR_RATE,
+ *          ARM_DRIVER_ERROR (no free DMA channel).
+ ******************************************************************************/
+int32_t ADC_Scan_Init(ADC_Scan_t *scan, const ADC_ScanConfig_t *config);
+
+/*******************************************************************************
+ * @brief   Start / stop the periodic scans.
+ *
+ * Start begins at the first half of the buffer.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t ADC_Scan_Start(ADC_Scan_t *scan);
+int32_t ADC_Scan_Stop(ADC_Scan_t *scan);
+
+/*******************************************************************************
+ * @brief   Measure the latency of the next scan.
+ *
+ * The last slot raises one conversion complete interrupt, which reads
+ * the PDB counter: one PDB tick of resolution, plus the interrupt entry.
+ * The result appears in the statistics.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t ADC_Scan_MeasureLatency(ADC_Scan_t *scan);
+
+/*******************************************************************************
+ * @brief   Timing and counters, sequence errors collected from the PDB.
+ ******************************************************************************/
+void ADC_Scan_GetStats(ADC_Scan_t *scan, ADC_ScanStats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* ADC_SCAN_H_ */
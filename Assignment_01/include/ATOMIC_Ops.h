@@ -0,0 +1,270 @@
+/*******************************************************************************
+ * @file    ATOMIC_Ops.h
+ * @brief   Atomic read-modify-write primitives header file.
+ *
+ * On the target every operation is an LDREX / STREX loop: the store only
+ * succeeds if nothing touched the exclusive monitor since the load, and
+ * every exception entry / return clears the monitor, so an interrupt of
+ * any priority that preempts the sequence makes it retry instead of
+ * losing an update. No interrupt is ever masked, nested ISRs and the
+ * main loop may share the same words.
+ *
+ * On a host the same functions map to C11 <stdatomic.h>, so code built
+ * on them can be tested with threads.
+ *
+ * Ordering: the target operations are compiler barriers only, which is
+ * enough between contexts of the one core; ATOMIC_Dmb() orders memory
+ * for other bus masters (DMA). Host operations are sequentially
+ * consistent.
+ *
+ * Uncontended cost on the target, from the Cortex-M4 instruction timings
+ * (zero wait state SRAM): load / store 2 cycles, fetch-add / bit set /
+ * bit clear / exchange about 7 cycles, compare-and-swap about 8; each
+ * retry after a preemption repeats the loop once.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef ATOMIC_OPS_H_
+#define ATOMIC_OPS_H_
+
+#include <stdint.h>
+
+#if defined (__ARM_ARCH_7EM__) || defined (__ARM_ARCH_7M__)
+#define ATOMIC_TARGET       (1)
+#else
+#define ATOMIC_TARGET       (0)
+#include <stdatomic.h>
+#endif
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** Word shared between contexts, accessed through the functions below only. */
+#if ATOMIC_TARGET
+typedef volatile uint32_t   ATOMIC_U32;
+#else
+typedef _Atomic uint32_t    ATOMIC_U32;
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if ATOMIC_TARGET
+
+/*******************************************************************************
+ * @brief   LDREX / STREX, the building blocks of the loops below.
+ *
+ * @return  ATOMIC_Strex(): 0 stored, 1 exclusivity lost (retry).
+ ******************************************************************************/
+static inline uint32_t ATOMIC_Ldrex(ATOMIC_U32 *p)
+{
+    uint32_t value;
+
+    __asm volatile ("ldrex %0, [%1]" : "=r" (value) : "r" (p) : "memory");
+
+    return value;
+}
+
+static inline uint32_t ATOMIC_Strex(ATOMIC_U32 *p, uint32_t value)
+{
+    uint32_t failed;
+
+    __asm volatile ("strex %0, %2, [%1]" : "=&r" (failed) : "r" (p), "r" (value) : "memory");
+
+    return failed;
+}
+
+#endif
+
+/*******************************************************************************
+ * @brief   Data memory barrier.
+ ******************************************************************************/
+static inline void ATOMIC_Dmb(void)
+{
+#if ATOMIC_TARGET
+    __asm volatile ("dmb" : : : "memory");
+#else
+    atomic_thread_fence(memory_order_seq_cst);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   Initialize a word; not atomic, before it is shared.
+ ******************************************************************************/
+static inline void ATOMIC_Init32(ATOMIC_U32 *p, uint32_t value)
+{
+#if ATOMIC_TARGET
+    *p = value;
+#else
+    atomic_init(p, value);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   Load (a single LDR on the target).
+ ******************************************************************************/
+static inline uint32_t ATOMIC_Load32(ATOMIC_U32 *p)
+{
+#if ATOMIC_TARGET
+    uint32_t value;
+
+    __asm volatile ("" : : : "memory");
+    value = *p;
+    __asm volatile ("" : : : "memory");
+
+    return value;
+#else
+    return atomic_load(p);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   Store (a single STR on the target).
+ ******************************************************************************/
+static inline void ATOMIC_Store32(ATOMIC_U32 *p, uint32_t value)
+{
+#if ATOMIC_TARGET
+    __asm volatile ("" : : : "memory");
+    *p = value;
+    __asm volatile ("" : : : "memory");
+#else
+    atomic_store(p, value);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   *p += value.
+ *
+ * @return  Previous value.
+ ******************************************************************************/
+static inline uint32_t ATOMIC_FetchAdd32(ATOMIC_U32 *p, uint32_t value)
+{
+#if ATOMIC_TARGET
+    uint32_t old;
+
+    do
+    {
+        old = ATOMIC_Ldrex(p);
+    } while (0U != ATOMIC_Strex(p, old + value));
+
+    return old;
+#else
+    return atomic_fetch_add(p, value);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   *p = value.
+ *
+ * @return  Previous value.
+ ******************************************************************************/
+static inline uint32_t ATOMIC_Exchange32(ATOMIC_U32 *p, uint32_t value)
+{
+#if ATOMIC_TARGET
+    uint32_t old;
+
+    do
+    {
+        old = ATOMIC_Ldrex(p);
+    } while (0U != ATOMIC_Strex(p, value));
+
+    return old;
+#else
+    return atomic_exchange(p, value);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   *p |= mask.
+ *
+ * @return  Previous value.
+ ******************************************************************************/
+static inline uint32_t ATOMIC_BitSet32(ATOMIC_U32 *p, uint32_t mask)
+{
+#if ATOMIC_TARGET
+    uint32_t old;
+
+    do
+    {
+        old = ATOMIC_Ldrex(p);
+    } while (0U != ATOMIC_Strex(p, old | mask));
+
+    return old;
+#else
+    return atomic_fetch_or(p, mask);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   *p &= ~mask.
+ *
+ * @return  Previous value.
+ ******************************************************************************/
+static inline uint32_t ATOMIC_BitClear32(ATOMIC_U32 *p, uint32_t mask)
+{
+#if ATOMIC_TARGET
+    uint32_t old;
+
+    do
+    {
+        old = ATOMIC_Ldrex(p);
+    } while (0U != ATOMIC_Strex(p, old & ~mask));
+
+    return old;
+#else
+    return atomic_fetch_and(p, ~mask);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   If *p == *expected then *p = desired, else *expected = *p.
+ *
+ * Only fails on a real mismatch, a lost exclusivity is retried inside.
+ *
+ * @return  1 swapped, 0 mismatch.
+ ******************************************************************************/
+static inline uint8_t ATOMIC_Cas32(ATOMIC_U32 *p, uint32_t *expected, uint32_t desired)
+{
+#if ATOMIC_TARGET
+    uint32_t old;
+    uint8_t swapped;
+
+    swapped = 0U;
+
+    do
+    {
+        old = ATOMIC_Ldrex(p);
+
+        if (old != *expected)
+        {
+            /* Mismatch: drop the reservation, report the current value */
+            __asm volatile ("clrex" : : : "memory");
+            *expected = old;
+            break;
+        }
+        else
+        {
+            swapped = (0U == ATOMIC_Strex(p, desired)) ? 1U : 0U;
+        }
+    } while (0U == swapped);
+
+    return swapped;
+#else
+    return atomic_compare_exchange_strong(p, expected, desired) ? 1U : 0U;
+#endif
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* ATOMIC_OPS_H_ */
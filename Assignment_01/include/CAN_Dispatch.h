@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * @file    CAN_Dispatch.h
+ * @brief   CAN receive dispatch table header file.
+ *
+ * Routes received frames to handlers by identifier. The table is compiled
+ * once at start-up: exact identifiers are sorted for a binary search, masked
+ * entries are grouped by mask and each group is sorted on the masked
+ * identifier, so a lookup costs one binary search per distinct mask instead
+ * of a walk over every masked entry. Standard and extended identifiers are
+ * distinct keys (bit 31 of the CMSIS identifier).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef CAN_DISPATCH_H_
+#define CAN_DISPATCH_H_
+
+#include <stdint.h>
+#include "Driver_CAN.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/** Mask of an entry matching a single identifier. */
+#define CAN_DISPATCH_MASK_EXACT     (0xFFFFFFFFUL)
+
+/** Distinct masks of the masked entries in one table. */
+#ifndef CAN_DISPATCH_GROUPS_MAX
+#define CAN_DISPATCH_GROUPS_MAX     (8U)
+#endif
+
+/**
+ * @brief Frame handler.
+ *
+ * @param msgInfo   Identifier, DLC and FD flags of the frame.
+ * @param data      Payload.
+ * @param size      Payload bytes.
+ * @param layout    Signal layout of the matching entry (may be NULL).
+ */
+typedef void (*CAN_DispatchHandler_t)(const ARM_CAN_MSG_INFO *msgInfo, const uint8_t *data, uint8_t size,
+                                      const void *layout);
+
+/**
+ * @brief One routing entry, usually in a const table.
+ */
+typedef struct
+{
+    uint32_t              id;       /**< ARM_CAN_STANDARD_ID(x) / ARM_CAN_EXTENDED_ID(x)     */
+    uint32_t              mask;     /**< 1 = bit compared, CAN_DISPATCH_MASK_EXACT = one ID  */
+    CAN_DispatchHandler_t handler;
+    const void            *layout;  /**< Passed to the handler unchanged                     */
+} CAN_DispatchEntry_t;
+
+/**
+ * @brief Masked entries sharing one mask, sorted on the masked identifier.
+ */
+typedef struct
+{
+    uint32_t                  mask;         /**< Compared bits, frame format included */
+    uint16_t                  first;        /**< First index slot of the group        */
+    uint16_t                  count;
+} CAN_DispatchGroup_t;
+
+/**
+ * @brief Compiled table. Only references the entries and the index storage.
+ */
+typedef struct
+{
+    const CAN_DispatchEntry_t *entries;
+    const uint16_t            *index;       /**< Exact entries by ID, then the mask groups */
+    uint16_t                  exactCount;
+    uint16_t                  maskedCount;
+    uint8_t                   groupCount;
+    CAN_DispatchGroup_t       groups[CAN_DISPATCH_GROUPS_MAX];
+} CAN_Dispatch_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Compile a dispatch table.
+ *
+ * Sorting is done once here, so lookups never walk the whole table. Two
+ * exact entries with the same identifier are rejected, as are masked
+ * entries using more than CAN_DISPATCH_GROUPS_MAX distinct masks.
+ *
+ * @param   table       Table to build.
+ * @param   entries     Routing entries, must stay valid while the table is used.
+ * @param   count       Number of entries.
+ * @param   index       Storage for count indices.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CAN_Dispatch_Build(CAN_Dispatch_t *table, const CAN_DispatchEntry_t *entries, uint16_t count,
+                           uint16_t *index);
+
+/*******************************************************************************
+ * @brief   Find the entry of an identifier.
+ *
+ * An exact entry wins over masked ones; among masked entries the first in
+ * table order wins. Costs one binary search over the exact entries and one
+ * per mask group.
+ *
+ * @param   table       Compiled table.
+ * @param   id          CMSIS identifier (bit 31 = extended).
+ *
+ * @return  Matching entry or NULL.
+ ******************************************************************************/
+const CAN_DispatchEntry_t *CAN_Dispatch_Lookup(const CAN_Dispatch_t *table, uint32_t id);
+
+/*******************************************************************************
+ * @brief   Read every pending frame of a receive object and call its handler.
+ *
+ * Meant for the ARM_CAN_EVENT_RECEIVE path of the object event callback (or
+ * a task it wakes). Frames without a matching entry are dropped.
+ *
+ * @param   table       Compiled table.
+ * @param   driver      CAN driver owning the object.
+ * @param   obj_idx     Receive object.
+ *
+ * @return  Number of frames read, or a negative ARM_DRIVER_xxx error.
+ ******************************************************************************/
+int32_t CAN_Dispatch_Receive(const CAN_Dispatch_t *table, ARM_DRIVER_CAN *driver, uint32_t obj_idx);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CAN_DISPATCH_H_ */
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * @file    CAN_Gateway.h
+ * @brief   CAN gateway between the FlexCAN controllers header file.
+ *
+ * Each port is one CAN driver with a receive object and a group of TX
+ * objects. Frames received on a port are looked up in the port's compiled
+ * route table (CAN_Dispatch, entry layout = CAN_GatewayRoute_t) and sent to
+ * every destination port of the route, optionally under a new identifier.
+ * A frame is read from the receive mailbox once and written into the
+ * destination mailboxes from the same buffer; nothing is queued.
+ *
+ * CAN_Gateway_Forward() runs from the object event callbacks, so the CAN
+ * interrupts of all ports must share one priority.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef CAN_GATEWAY_H_
+#define CAN_GATEWAY_H_
+
+#include <stdint.h>
+#include "Driver_CAN.h"
+#include "CAN_Dispatch.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CAN_GATEWAY_PORT_MAX        (3U)        /**< FlexCAN0 ... 2 */
+
+/** Destination set bit of a port. */
+#define CAN_GATEWAY_PORT(n)         ((uint8_t)(1U << (n)))
+
+/**
+ * @brief Route, referenced by the layout field of a CAN_DispatchEntry_t.
+ *
+ * Forwarded identifier = (id & ~rewriteMask) | (rewriteId & rewriteMask),
+ * so rewriteMask = 0 keeps the identifier. Bit 31 (IDE) may be rewritten
+ * as well to change the frame format.
+ */
+typedef struct
+{
+    uint8_t     destinations;   /**< CAN_GATEWAY_PORT(n) bit set, the source port is skipped */
+    uint32_t    rewriteMask;
+    uint32_t    rewriteId;
+} CAN_GatewayRoute_t;
+
+/**
+ * @brief Constant configuration of one port.
+ */
+typedef struct
+{
+    ARM_DRIVER_CAN              *driver;        /**< NULL = port unused                     */
+    uint32_t                    rxObj;          /**< Receive object (usually the RX FIFO)   */
+    uint32_t                    txObj;          /**< First TX object used for forwarding    */
+    uint8_t                     txCount;        /**< Consecutive TX objects from txObj      */
+    const CAN_DispatchEntry_t   *routes;        /**< Handler unused, layout = route         */
+    uint16_t                    routeCount;
+    uint16_t                    *index;         /**< Storage for routeCount indices         */
+} CAN_GatewayPortConfig_t;
+
+/**
+ * @brief Run-time state of one port.
+ */
+typedef struct
+{
+    const CAN_GatewayPortConfig_t   *config;
+    CAN_Dispatch_t                  table;
+    uint32_t                        received;
+    uint32_t                        forwarded;      /**< Frames written to this port        */
+    uint32_t                        noRoute;        /**< Received frames without a route    */
+    uint32_t                        dropped;        /**< Frames lost: all TX objects busy or
+                                                         frame not sendable on this port     */
+} CAN_GatewayPort_t;
+
+/**
+ * @brief Gateway, allocated by the caller.
+ */
+typedef struct
+{
+    CAN_GatewayPort_t   port[CAN_GATEWAY_PORT_MAX];
+    uint8_t             portCount;
+} CAN_Gateway_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Compile the route tables of all ports.
+ *
+ * The drivers must already be running with the receive objects filtered and
+ * the TX objects configured.
+ *
+ * @param   gateway     Gateway.
+ * @param   config      Port configurations, must stay valid.
+ * @param   portCount   Number of ports (1 ... CAN_GATEWAY_PORT_MAX).
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CAN_Gateway_Init(CAN_Gateway_t *gateway, const CAN_GatewayPortConfig_t *config, uint8_t portCount);
+
+/*******************************************************************************
+ * @brief   Forward every pending frame of a port's receive object.
+ *
+ * Call on ARM_CAN_EVENT_RECEIVE of the port's receive object. A destination
+ * takes the lowest free TX object of its group; with every TX object busy
+ * the frame is dropped for that destination.
+ *
+ * @param   gateway     Gateway.
+ * @param   port        Source port.
+ *
+ * @return  Number of frames read, or a negative ARM_DRIVER_xxx error.
+ ******************************************************************************/
+int32_t CAN_Gateway_Forward(CAN_Gateway_t *gateway, uint8_t port);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CAN_GATEWAY_H_ */
@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * @file    CAN_IsoTp.h
+ * @brief   ISO 15765-2 (ISO-TP) transport over the CMSIS CAN driver header file.
+ *
+ * One channel is one pair of CAN identifiers with a TX and an RX object of
+ * its own. Channels are independent, so any number can run in parallel.
+ * Classic (8 byte) and FD (up to 64 byte) frames are supported, flow control
+ * uses the configured block size and STmin. Received consecutive frames are
+ * read straight into the caller buffer; transmitted frames are built from
+ * the caller buffer one frame at a time.
+ *
+ * Only the CMSIS CAN API is used, so a stand-in ARM_DRIVER_CAN can run a
+ * channel on a host. Send() and Poll() must not be interrupted by the CAN
+ * callbacks of the same channel (same priority or CAN interrupt masked).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef CAN_ISOTP_H_
+#define CAN_ISOTP_H_
+
+#include <stdint.h>
+#include "Driver_CAN.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CAN_ISOTP_FRAME_MAX             (64U)
+
+/****** Channel events *****/
+#define CAN_ISOTP_EVENT_TX_DONE         (1UL << 0)  /**< Message sent */
+#define CAN_ISOTP_EVENT_RX_DONE         (1UL << 1)  /**< Message received, length valid */
+#define CAN_ISOTP_EVENT_TX_ERROR        (1UL << 2)  /**< Transmission aborted */
+#define CAN_ISOTP_EVENT_RX_ERROR        (1UL << 3)  /**< Reception aborted */
+#define CAN_ISOTP_EVENT_TIMEOUT         (1UL << 4)  /**< Reason: N_Bs / N_Cr expired */
+#define CAN_ISOTP_EVENT_OVERFLOW        (1UL << 5)  /**< Reason: receive buffer too small (local or peer) */
+#define CAN_ISOTP_EVENT_SEQUENCE        (1UL << 6)  /**< Reason: wrong sequence number / unexpected frame */
+
+typedef struct CAN_IsoTp_Channel CAN_IsoTp_Channel_t;
+
+/**
+ * @brief Channel event callback.
+ *
+ * @param channel   Channel.
+ * @param event     CAN_ISOTP_EVENT_xxx flags.
+ * @param length    Message length for TX_DONE / RX_DONE.
+ */
+typedef void (*CAN_IsoTp_Callback_t)(CAN_IsoTp_Channel_t *channel, uint32_t event, uint32_t length);
+
+/** @brief Free running microsecond time base (wraps). */
+typedef uint32_t (*CAN_IsoTp_TimeUs_t)(void);
+
+/**
+ * @brief Constant channel configuration.
+ */
+typedef struct
+{
+    ARM_DRIVER_CAN          *driver;
+    uint32_t                txObj;          /**< Object configured ARM_CAN_OBJ_TX                   */
+    uint32_t                rxObj;          /**< Object configured ARM_CAN_OBJ_RX, filtered to rx ID */
+    uint32_t                txId;           /**< CMSIS identifier of transmitted frames             */
+    uint8_t                 frameSize;      /**< TX_DL: 8 = classic, 12 ... 64 = CAN FD             */
+    uint8_t                 brs;            /**< FD bit rate switch                                 */
+    uint8_t                 blockSize;      /**< BS sent in flow control, 0 = no further FC         */
+    uint8_t                 stMin;          /**< STmin sent in flow control (ISO encoding)          */
+    uint8_t                 padding;        /**< Fill byte of unused frame bytes                    */
+    uint32_t                timeoutUs;      /**< N_Bs / N_Cr                                        */
+    CAN_IsoTp_TimeUs_t      timeUs;
+    CAN_IsoTp_Callback_t    callback;
+} CAN_IsoTp_Config_t;
+
+/**
+ * @brief Channel state, allocated by the caller.
+ */
+struct CAN_IsoTp_Channel
+{
+    const CAN_IsoTp_Config_t *config;
+
+    const uint8_t   *txData;
+    uint32_t        txLength;
+    uint32_t        txOffset;
+    uint32_t        txStMinUs;
+    uint32_t        txTimer;
+    uint8_t         txState;
+    uint8_t         txSn;
+    uint8_t         txBlockSize;
+    uint8_t         txBlockLeft;
+
+    uint8_t         *rxData;
+    uint32_t        rxCapacity;
+    uint32_t        rxLength;
+    uint32_t        rxOffset;
+    uint32_t        rxTimer;
+    uint8_t         rxState;
+    uint8_t         rxSn;
+    uint8_t         rxBlockLeft;
+
+    uint8_t         inFlight;       /**< Frame in the TX object: none, data or flow control */
+    uint8_t         fcPending;
+    uint8_t         fcStatus;
+    uint8_t         frame[CAN_ISOTP_FRAME_MAX];
+};
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Initialize a channel. The CAN objects must already be configured.
+ *
+ * @param   channel     Channel.
+ * @param   config      Configuration, must stay valid.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CAN_IsoTp_Init(CAN_IsoTp_Channel_t *channel, const CAN_IsoTp_Config_t *config);
+
+/*******************************************************************************
+ * @brief   Provide the buffer incoming messages are reassembled into.
+ *
+ * The buffer stays armed after RX_DONE and is overwritten by the next
+ * message; call again from the callback to swap buffers.
+ *
+ * @param   channel     Channel.
+ * @param   data        Receive buffer (NULL = refuse incoming messages).
+ * @param   capacity    Buffer size in bytes.
+ ******************************************************************************/
+void CAN_IsoTp_SetRxBuffer(CAN_IsoTp_Channel_t *channel, uint8_t *data, uint32_t capacity);
+
+/*******************************************************************************
+ * @brief   Start sending a message. The buffer must stay valid until TX_DONE
+ *          or TX_ERROR.
+ *
+ * @param   channel     Channel.
+ * @param   data        Message.
+ * @param   length      Message length (1 ... 4 GiB - 1).
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_BUSY, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CAN_IsoTp_Send(CAN_IsoTp_Channel_t *channel, const uint8_t *data, uint32_t length);
+
+/*******************************************************************************
+ * @brief   Feed a CAN object event. Call from the ARM_CAN_SignalObjectEvent_t
+ *          callback for every channel using the object.
+ *
+ * @param   channel     Channel.
+ * @param   obj_idx     Object index of the event.
+ * @param   event       ARM_CAN_EVENT_xxx.
+ ******************************************************************************/
+void CAN_IsoTp_OnObjectEvent(CAN_IsoTp_Channel_t *channel, uint32_t obj_idx, uint32_t event);
+
+/*******************************************************************************
+ * @brief   Run timers: STmin gaps, N_Bs / N_Cr timeouts and deferred frames.
+ *          Call at least every STmin.
+ *
+ * @param   channel     Channel.
+ ******************************************************************************/
+void CAN_IsoTp_Poll(CAN_IsoTp_Channel_t *channel);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CAN_ISOTP_H_ */
@@ -0,0 +1,275 @@
+/*******************************************************************************
+ * @file    CAN_Signal.h
+ * @brief   Compile-time generated CAN signal codecs header file.
+ *
+ * A message is described once as a signal list, in DBC terms:
+ *
+ *   // SIGNAL(msg, name, byte order, start bit, length, sign, factor, offset)
+ *   #define ENGINE_SIGNALS(SIGNAL, msg)                                         \
+ *       SIGNAL(msg, Rpm,     CAN_SIGNAL_INTEL,    0U, 16U, CAN_SIGNAL_UNSIGNED, 0.25f,  0.0f) \
+ *       SIGNAL(msg, Coolant, CAN_SIGNAL_MOTOROLA, 23U, 8U, CAN_SIGNAL_SIGNED,   1.0f, -40.0f)
+ *
+ *   CAN_SIGNAL_MESSAGE(Engine, ARM_CAN_STANDARD_ID(0x100U), 8U, ENGINE_SIGNALS)
+ *
+ * which generates, all static inline:
+ *   - Engine_t                      one float per signal (physical value)
+ *   - Engine_Rpm_UnpackRaw/PackRaw  raw signal value
+ *   - Engine_Rpm_Unpack/Pack        physical value = raw * factor + offset
+ *   - Engine_Unpack/Pack            whole message from / to a payload
+ *   - Engine_Send                   pack and ARM_DRIVER_CAN MessageSend
+ *   - Engine_Decode                 check identifier / size and unpack the
+ *                                   result of MessageRead (or a dispatch
+ *                                   handler's arguments)
+ *
+ * Start bits follow the DBC convention: the least significant bit for
+ * Intel (little endian) signals, the most significant bit in the sawtooth
+ * numbering for Motorola (big endian) signals. Signals are 1 ... 32 bits.
+ *
+ * Every byte index, shift and mask is a constant expression of the signal
+ * description, so a signal compiles to at most five byte loads/stores with
+ * fixed shifts: no bit loops at run time.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef CAN_SIGNAL_H_
+#define CAN_SIGNAL_H_
+
+#include <stdint.h>
+#include "Driver_CAN.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/****** Signal attributes *****/
+#define CAN_SIGNAL_INTEL            (0U)    /**< Little endian */
+#define CAN_SIGNAL_MOTOROLA         (1U)    /**< Big endian */
+
+#define CAN_SIGNAL_UNSIGNED         (0U)
+#define CAN_SIGNAL_SIGNED           (1U)    /**< Two's complement */
+
+/****** Layout of a signal (constant expressions) *****/
+
+/** Value mask of a length bit signal (1 ... 32). */
+#define CAN_SIGNAL_MASK(length)                 (0xFFFFFFFFUL >> (32U - (length)))
+
+/** Motorola start bit in linear big endian numbering (bit 0 = MSB of byte 0). */
+#define CAN_SIGNAL_MSB_LINEAR(start)            (((start) & ~7U) + 7U - ((start) & 7U))
+
+/** Payload byte holding the least significant bit. */
+#define CAN_SIGNAL_LSB_BYTE(order, start, length)                                       \
+    ((CAN_SIGNAL_INTEL == (order)) ? ((start) / 8U)                                     \
+                                   : ((CAN_SIGNAL_MSB_LINEAR(start) + (length) - 1U) / 8U))
+
+/** Position of the least significant bit inside its byte. */
+#define CAN_SIGNAL_LSB_SHIFT(order, start, length)                                      \
+    ((CAN_SIGNAL_INTEL == (order)) ? ((start) & 7U)                                     \
+                                   : (7U - ((CAN_SIGNAL_MSB_LINEAR(start) + (length) - 1U) & 7U)))
+
+/** Number of payload bytes touched (1 ... 5). */
+#define CAN_SIGNAL_BYTES(order, start, length)                                          \
+    ((CAN_SIGNAL_LSB_SHIFT(order, start, length) + (length) + 7U) / 8U)
+
+/** k-th byte touched, counted from the least significant one. */
+#define CAN_SIGNAL_BYTE(order, start, length, k)                                        \
+    ((CAN_SIGNAL_INTEL == (order)) ? (CAN_SIGNAL_LSB_BYTE(order, start, length) + (k))  \
+                                   : (CAN_SIGNAL_LSB_BYTE(order, start, length) - (k)))
+
+/** Bits of value belonging to the k-th byte, aligned to that byte. */
+#define CAN_SIGNAL_PART(value, shift, k)                                                \
+    ((0U == (k)) ? ((uint32_t)(value) << (shift))                                       \
+                 : ((uint32_t)(value) >> ((8U * (k) - (shift)) & 31U)))
+
+/****** Extraction / insertion *****/
+
+#define CAN_SIGNAL_TERM(data, order, start, length, k)                                  \
+    (((k) < CAN_SIGNAL_BYTES(order, start, length))                                     \
+        ? ((0U == (k))                                                                  \
+            ? ((uint32_t)(data)[CAN_SIGNAL_BYTE(order, start, length, k)] >>            \
+                CAN_SIGNAL_LSB_SHIFT(order, start, length))                             \
+            : ((uint32_t)(data)[CAN_SIGNAL_BYTE(order, start, length, k)] <<            \
+                ((8U * (k) - CAN_SIGNAL_LSB_SHIFT(order, start, length)) & 31U)))       \
+        : 0UL)
+
+/** Raw value of a signal. */
+#define CAN_SIGNAL_EXTRACT(data, order, start, length)                                  \
+    ((CAN_SIGNAL_TERM(data, order, start, length, 0U) |                                 \
+      CAN_SIGNAL_TERM(data, order, start, length, 1U) |                                 \
+      CAN_SIGNAL_TERM(data, order, start, length, 2U) |                                 \
+      CAN_SIGNAL_TERM(data, order, start, length, 3U) |                                 \
+      CAN_SIGNAL_TERM(data, order, start, length, 4U)) & CAN_SIGNAL_MASK(length))
+
+#define CAN_SIGNAL_INSERT_BYTE(data, order, start, length, raw, k)                      \
+    if ((k) < CAN_SIGNAL_BYTES(order, start, length))                                   \
+    {                                                                                   \
+        (data)[CAN_SIGNAL_BYTE(order, start, length, k)] = (uint8_t)                    \
+            (((data)[CAN_SIGNAL_BYTE(order, start, length, k)] &                        \
+              ~CAN_SIGNAL_PART(CAN_SIGNAL_MASK(length), CAN_SIGNAL_LSB_SHIFT(order, start, length), k)) | \
+             (CAN_SIGNAL_PART(raw, CAN_SIGNAL_LSB_SHIFT(order, start, length), k) &     \
+              CAN_SIGNAL_PART(CAN_SIGNAL_MASK(length), CAN_SIGNAL_LSB_SHIFT(order, start, length), k))); \
+    }                                                                                   \
+    else                                                                                \
+    {                                                                                   \
+        /* Byte not touched */                                                          \
+    }
+
+/** Write a raw value into a signal, other bits unchanged. */
+#define CAN_SIGNAL_INSERT(data, order, start, length, raw)                              \
+    do                                                                                  \
+    {                                                                                   \
+        CAN_SIGNAL_INSERT_BYTE(data, order, start, length, raw, 0U)                     \
+        CAN_SIGNAL_INSERT_BYTE(data, order, start, length, raw, 1U)                     \
+        CAN_SIGNAL_INSERT_BYTE(data, order, start, length, raw, 2U)                     \
+        CAN_SIGNAL_INSERT_BYTE(data, order, start, length, raw, 3U)                     \
+        CAN_SIGNAL_INSERT_BYTE(data, order, start, length, raw, 4U)                     \
+    } while (0)
+
+/****** Code generation *****/
+
+/* Per-signal functions */
+#define CAN_SIGNAL_FUNCTIONS(msg, name, order, start, length, sign, factor, offset)     \
+static inline uint32_t msg##_##name##_UnpackRaw(const uint8_t *data)                    \
+{                                                                                       \
+    return CAN_SIGNAL_EXTRACT(data, order, start, length);                              \
+}                                                                                       \
+static inline void msg##_##name##_PackRaw(uint8_t *data, uint32_t raw)                  \
+{                                                                                       \
+    CAN_SIGNAL_INSERT(data, order, start, length, raw);                                 \
+}                                                                                       \
+static inline float msg##_##name##_Unpack(const uint8_t *data)                          \
+{                                                                                       \
+    uint32_t raw;                                                                       \
+    float value;                                                                        \
+                                                                                        \
+    raw = CAN_SIGNAL_EXTRACT(data, order, start, length);                               \
+                                                                                        \
+    if (CAN_SIGNAL_SIGNED == (sign))                                                    \
+    {                                                                                   \
+        /* Sign extension: flip and subtract the sign bit */                            \
+        value = (float)(int32_t)((raw ^ (1UL << ((length) - 1U))) - (1UL << ((length) - 1U))); \
+    }                                                                                   \
+    else                                                                                \
+    {                                                                                   \
+        value = (float)raw;                                                             \
+    }                                                                                   \
+                                                                                        \
+    return (value * (factor)) + (offset);                                               \
+}                                                                                       \
+static inline void msg##_##name##_Pack(uint8_t *data, float value)                      \
+{                                                                                       \
+    uint32_t raw;                                                                       \
+    float scaled;                                                                       \
+    float low;                                                                          \
+    float high;                                                                         \
+                                                                                        \
+    scaled = (value - (offset)) * (1.0f / (factor));                                    \
+    scaled = (scaled >= 0.0f) ? (scaled + 0.5f) : (scaled - 0.5f);                      \
+    low    = (CAN_SIGNAL_SIGNED == (sign)) ? -(float)(1UL << ((length) - 1U)) : 0.0f;   \
+    high   = (CAN_SIGNAL_SIGNED == (sign)) ? (float)((1UL << ((length) - 1U)) - 1UL)    \
+                                           : (float)CAN_SIGNAL_MASK(length);            \
+                                                                                        \
+    /* Out of range values saturate */                                                  \
+    if (scaled <= low)                                                                  \
+    {                                                                                   \
+        raw = (CAN_SIGNAL_SIGNED == (sign)) ? (1UL << ((length) - 1U)) : 0U;            \
+    }                                                                                   \
+    else if (scaled >= high)                                                            \
+    {                                                                                   \
+        raw = (CAN_SIGNAL_SIGNED == (sign)) ? ((1UL << ((length) - 1U)) - 1UL)          \
+                                            : CAN_SIGNAL_MASK(length);                  \
+    }                                                                                   \
+    else if (CAN_SIGNAL_SIGNED == (sign))                                               \
+    {                                                                                   \
+        raw = (uint32_t)(int32_t)scaled;                                                \
+    }                                                                                   \
+    else                                                                                \
+    {                                                                                   \
+        raw = (uint32_t)scaled;                                                         \
+    }                                                                                   \
+                                                                                        \
+    CAN_SIGNAL_INSERT(data, order, start, length, raw);                                 \
+}
+
+#define CAN_SIGNAL_FIELD(msg, name, ...)            float name;
+#define CAN_SIGNAL_UNPACK_FIELD(msg, name, ...)     message->name = msg##_##name##_Unpack(data);
+#define CAN_SIGNAL_PACK_FIELD(msg, name, ...)       msg##_##name##_Pack(data, message->name);
+
+/**
+ * Generate the codec of a message.
+ *
+ * @param msg       Name prefix of the generated type and functions.
+ * @param msgId     CMSIS identifier (ARM_CAN_STANDARD_ID / ARM_CAN_EXTENDED_ID).
+ * @param msgSize   Payload bytes (8 = classic, 12 ... 64 = CAN FD with BRS).
+ * @param SIGNALS   Signal list macro, see the file header.
+ */
+#define CAN_SIGNAL_MESSAGE(msg, msgId, msgSize, SIGNALS)                                \
+SIGNALS(CAN_SIGNAL_FUNCTIONS, msg)                                                      \
+typedef struct                                                                          \
+{                                                                                       \
+    SIGNALS(CAN_SIGNAL_FIELD, msg)                                                      \
+} msg##_t;                                                                              \
+static inline void msg##_Unpack(msg##_t *message, const uint8_t *data)                  \
+{                                                                                       \
+    SIGNALS(CAN_SIGNAL_UNPACK_FIELD, msg)                                               \
+}                                                                                       \
+static inline void msg##_Pack(const msg##_t *message, uint8_t *data)                    \
+{                                                                                       \
+    uint8_t i;                                                                          \
+                                                                                        \
+    /* Unused bits are sent as 0 */                                                     \
+    for (i = 0U; i < (msgSize); i++)                                                    \
+    {                                                                                   \
+        data[i] = 0U;                                                                   \
+    }                                                                                   \
+                                                                                        \
+    SIGNALS(CAN_SIGNAL_PACK_FIELD, msg)                                                 \
+}                                                                                       \
+static inline int32_t msg##_Send(ARM_DRIVER_CAN *driver, uint32_t obj_idx, const msg##_t *message) \
+{                                                                                       \
+    ARM_CAN_MSG_INFO msgInfo;                                                           \
+    uint8_t data[msgSize];                                                              \
+                                                                                        \
+    msg##_Pack(message, data);                                                          \
+                                                                                        \
+    msgInfo.id       = (msgId);                                                         \
+    msgInfo.rtr      = 0U;                                                              \
+    msgInfo.edl      = ((msgSize) > 8U) ? 1U : 0U;                                      \
+    msgInfo.brs      = msgInfo.edl;                                                     \
+    msgInfo.esi      = 0U;                                                              \
+    msgInfo.dlc      = 0U;                                                              \
+    msgInfo.reserved = 0U;                                                              \
+                                                                                        \
+    return driver->MessageSend(obj_idx, &msgInfo, data, (msgSize));                     \
+}                                                                                       \
+static inline int32_t msg##_Decode(const ARM_CAN_MSG_INFO *msgInfo, const uint8_t *data, uint8_t length, \
+                                   msg##_t *message)                                    \
+{                                                                                       \
+    int32_t result;                                                                     \
+                                                                                        \
+    result = ARM_DRIVER_OK;                                                             \
+                                                                                        \
+    if ((msgInfo->id != (msgId)) || (0U != msgInfo->rtr) || (length < (msgSize)))       \
+    {                                                                                   \
+        /* Other message, or too short to hold every signal */                          \
+        result = ARM_DRIVER_ERROR_PARAMETER;                                            \
+    }                                                                                   \
+    else                                                                                \
+    {                                                                                   \
+        msg##_Unpack(message, data);                                                    \
+    }                                                                                   \
+                                                                                        \
+    return result;                                                                      \
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CAN_SIGNAL_H_ */
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * @file    CRC_Engine.h
+ * @brief   CRC-16 / CRC-32 on the CRC module header file.
+ *
+ * One computation at a time on the single CRC module: CRC_Engine_Start()
+ * loads the parameters, then data is fed by the CPU (CRC_Engine_Update)
+ * or by an eDMA channel (CRC_Engine_UpdateDma). The DMA feed writes 32-bit
+ * words to the data register in chunks of up to 32767 words and feeds the
+ * unaligned head and tail bytes by the CPU.
+ *
+ * Reflection is done by the transpose stages: input reflected = bits and
+ * bytes transposed, otherwise bytes only (words are read little endian
+ * but processed MSB first); output reflected = bits and bytes transposed.
+ * Parameters are the CRC_Config_t of CRC_Soft.h, so results can be checked
+ * against the software tables.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef CRC_ENGINE_H_
+#define CRC_ENGINE_H_
+
+#include <stdint.h>
+#include "Driver_Common.h"
+#include "CRC_Soft.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CRC_ENGINE_DMA_MAX_WORDS    (32767UL)                           /**< eDMA major count limit */
+#define CRC_ENGINE_ERROR_MISMATCH   (ARM_DRIVER_ERROR_SPECIFIC - 1)     /**< Hardware != software   */
+
+/**
+ * @brief DMA feed completion, called from the DMA interrupt.
+ *
+ * @param status    ARM_DRIVER_OK or ARM_DRIVER_ERROR (DMA error).
+ * @param crc       Result so far, final value of the computation.
+ */
+typedef void (*CRC_Engine_Callback_t)(int32_t status, uint32_t crc);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Enable the CRC module clock.
+ *
+ * The eDMA channel is reserved by the first CRC_Engine_UpdateDma() call,
+ * so CPU-only users (e.g. the boot image check) do not hold one.
+ *
+ * @return  ARM_DRIVER_OK.
+ ******************************************************************************/
+int32_t CRC_Engine_Init(void);
+
+/*******************************************************************************
+ * @brief   Start a computation.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_BUSY (DMA feed running),
+ *          ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CRC_Engine_Start(const CRC_Config_t *config);
+
+/*******************************************************************************
+ * @brief   Feed a buffer by the CPU, blocking.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_BUSY, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CRC_Engine_Update(const void *data, uint32_t size);
+
+/*******************************************************************************
+ * @brief   Feed a buffer by eDMA, returns at once.
+ *
+ * The buffer must stay valid until the callback. No other CRC_Engine call
+ * but CRC_Engine_IsBusy() is accepted before.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_BUSY, ARM_DRIVER_ERROR_PARAMETER,
+ *          ARM_DRIVER_ERROR (no free DMA channel).
+ ******************************************************************************/
+int32_t CRC_Engine_UpdateDma(const void *data, uint32_t size, CRC_Engine_Callback_t callback);
+
+/*******************************************************************************
+ * @brief   Result of the data fed so far.
+ ******************************************************************************/
+uint32_t CRC_Engine_GetResult(void);
+
+/*******************************************************************************
+ * @brief   Check for a running DMA feed.
+ *
+ * @return  1 busy, 0 idle.
+ ******************************************************************************/
+uint8_t CRC_Engine_IsBusy(void);
+
+/*******************************************************************************
+ * @brief   CRC of a buffer by the CPU feed in one call.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_BUSY, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CRC_Engine_Compute(const CRC_Config_t *config, const void *data, uint32_t size, uint32_t *crc);
+
+/*******************************************************************************
+ * @brief   Compute a buffer with the module and with the software tables.
+ *
+ * @return  ARM_DRIVER_OK (same result), CRC_ENGINE_ERROR_MISMATCH,
+ *          ARM_DRIVER_ERROR_BUSY, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t CRC_Engine_Check(const CRC_Table_t *table, const void *data, uint32_t size);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CRC_ENGINE_H_ */
@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * @file    CRC_Soft.h
+ * @brief   Table driven (slicing-by-8) software CRC header file.
+ *
+ * Portable C without device registers: serves host builds and checks the
+ * CRC module results. A table holds the parameters and 8 x 256 words
+ * (8 KB) built once by CRC_Soft_Init(); eight bytes are then folded per
+ * step with eight lookups.
+ *
+ * Parameters follow the usual catalogue: polynomial in normal form,
+ * input / output reflection, final complement. The check value is the CRC
+ * of the ASCII string "123456789".
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef CRC_SOFT_H_
+#define CRC_SOFT_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief CRC parameters, shared with the hardware engine (CRC_Engine).
+ */
+typedef struct
+{
+    uint32_t    polynomial;     /**< Normal form            */
+    uint32_t    seed;           /**< Initial value          */
+    uint8_t     width;          /**< 16 or 32               */
+    uint8_t     reflectIn;      /**< Bytes processed LSB first  */
+    uint8_t     reflectOut;     /**< Result bit reversed        */
+    uint8_t     complement;     /**< Result XOR all ones        */
+} CRC_Config_t;
+
+/* Initializers of common CRCs */
+#define CRC_CONFIG_CCITT    { 0x1021UL, 0xFFFFUL, 16U, 0U, 0U, 0U }             /**< CRC-16/CCITT-FALSE, check 0x29B1 */
+#define CRC_CONFIG_KERMIT   { 0x1021UL, 0x0000UL, 16U, 1U, 1U, 0U }             /**< CRC-16/KERMIT, check 0x2189      */
+#define CRC_CONFIG_CRC32    { 0x04C11DB7UL, 0xFFFFFFFFUL, 32U, 1U, 1U, 1U }     /**< CRC-32 (Ethernet, zlib), check 0xCBF43926 */
+
+/**
+ * @brief Lookup tables of one CRC, allocated by the caller.
+ */
+typedef struct
+{
+    CRC_Config_t    config;
+    uint32_t        table[8][256];
+} CRC_Table_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Build the tables of a CRC.
+ *
+ * @return  0 done, -1 unsupported width.
+ ******************************************************************************/
+int32_t CRC_Soft_Init(CRC_Table_t *table, const CRC_Config_t *config);
+
+/*******************************************************************************
+ * @brief   Incremental computation: Start, any number of Update, Finish.
+ *
+ * The state passed between the calls is internal (reflected or left
+ * aligned), only the value of CRC_Soft_Finish() is the CRC.
+ ******************************************************************************/
+uint32_t CRC_Soft_Start(const CRC_Table_t *table);
+uint32_t CRC_Soft_Update(const CRC_Table_t *table, uint32_t state, const void *data, uint32_t size);
+uint32_t CRC_Soft_Finish(const CRC_Table_t *table, uint32_t state);
+
+/*******************************************************************************
+ * @brief   CRC of a buffer in one call.
+ ******************************************************************************/
+uint32_t CRC_Soft_Compute(const CRC_Table_t *table, const void *data, uint32_t size);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* CRC_SOFT_H_ */
@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * @file    DSP_Filter.h
+ * @brief   Fixed-point (Q15 / Q31) filter kernels header file.
+ *
+ * FIR, decimating FIR, biquad cascade (IIR) and moving average for sample
+ * streams such as ADC_Scan frames. The kernels are written on DSP_Simd.h:
+ * SMLALD / SMLAD / QADD16 / SSAT on the Cortex-M4, the equivalent C on a
+ * host, with the same output bit for bit.
+ *
+ * Arithmetic: products are summed exactly in 64 bits, the sum is shifted
+ * right (truncation, i.e. towards minus infinity) and saturated once per
+ * output sample. The Q15 sums cannot overflow; the Q31 sums (Q2.62 terms)
+ * stay exact while the sum of |coefficient| x |sample| is below 2.0.
+ *
+ * Each filter is a caller-allocated instance with caller-allocated
+ * coefficient and state buffers, the sizes are given by the
+ * DSP_xxx_STATE_LEN() macros.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DSP_FILTER_H_
+#define DSP_FILTER_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* State buffer lengths (elements of the sample type) */
+#define DSP_FIR_STATE_LEN(taps, block)      ((uint32_t)(taps) + (uint32_t)(block) - 1UL)
+#define DSP_BIQUAD_STATE_LEN(stages)        (4UL * (uint32_t)(stages))
+
+#define DSP_BIQUAD_COEFF_COUNT              (5U)    /**< b0, b1, b2, a1, a2 per stage */
+#define DSP_BIQUAD_POST_SHIFT_MAX           (7U)
+
+/**
+ * @brief FIR filter, also used for decimation.
+ *
+ * Coefficients are stored time reversed: coeffs[0] = h[taps - 1] ...
+ * coeffs[taps - 1] = h[0], so that both coefficients and samples are
+ * read in increasing address order.
+ */
+typedef struct
+{
+    const int16_t  *coeffs;
+    int16_t        *state;          /**< DSP_FIR_STATE_LEN(numTaps, blockSize) */
+    uint16_t        numTaps;
+    uint16_t        blockSize;      /**< Input samples per call, at most */
+    uint16_t        factor;         /**< Decimation factor, 1 = plain FIR */
+} DSP_FirQ15_t;
+
+typedef struct
+{
+    const int32_t  *coeffs;
+    int32_t        *state;
+    uint16_t        numTaps;
+    uint16_t        blockSize;
+    uint16_t        factor;
+} DSP_FirQ31_t;
+
+/**
+ * @brief Cascade of direct form I biquads.
+ *
+ * Stage: acc = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2],
+ * y[n] = acc >> (15 - postShift) (Q15) or >> (31 - postShift) (Q31).
+ * Feedback coefficients are added, i.e. a1, a2 are the negated
+ * denominator terms. postShift gives coefficients the range
+ * +-2^postShift (Q1.14 for |coefficient| < 2 with postShift = 1).
+ */
+typedef struct
+{
+    const int16_t  *coeffs;         /**< DSP_BIQUAD_COEFF_COUNT per stage */
+    int16_t        *state;          /**< DSP_BIQUAD_STATE_LEN(stages): x1, x2, y1, y2 per stage */
+    uint8_t         stages;
+    uint8_t         postShift;
+} DSP_BiquadQ15_t;
+
+typedef struct
+{
+    const int32_t  *coeffs;
+    int32_t        *state;
+    uint8_t         stages;
+    uint8_t         postShift;
+} DSP_BiquadQ31_t;
+
+/**
+ * @brief Moving average over a power of two window, running sum.
+ */
+typedef struct
+{
+    int16_t        *history;        /**< length samples */
+    int32_t         sum;
+    uint16_t        index;
+    uint16_t        mask;           /**< length - 1 */
+    uint8_t         shift;          /**< log2(length) */
+} DSP_MovAvgQ15_t;
+
+typedef struct
+{
+    int32_t        *history;
+    int64_t         sum;
+    uint16_t        index;
+    uint16_t        mask;
+    uint8_t         shift;
+} DSP_MovAvgQ31_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up a FIR (factor 1) or decimating FIR, state cleared.
+ *
+ * @param   fir         Instance.
+ * @param   numTaps     Coefficient count, >= 1.
+ * @param   coeffs      Time reversed coefficients.
+ * @param   state       DSP_FIR_STATE_LEN(numTaps, blockSize) samples.
+ * @param   blockSize   Largest input count per call, multiple of factor.
+ * @param   factor      Decimation factor, >= 1.
+ * @return  0 done, -1 invalid parameter.
+ ******************************************************************************/
+int32_t DSP_FirQ15_Init(DSP_FirQ15_t *fir, uint16_t numTaps, const int16_t *coeffs, int16_t *state,
+                        uint16_t blockSize, uint16_t factor);
+int32_t DSP_FirQ31_Init(DSP_FirQ31_t *fir, uint16_t numTaps, const int32_t *coeffs, int32_t *state,
+                        uint16_t blockSize, uint16_t factor);
+
+/*******************************************************************************
+ * @brief   Filter a block: count inputs give count / factor outputs.
+ *
+ * @param   count       At most blockSize, multiple of factor.
+ * @return  Outputs written.
+ ******************************************************************************/
+uint32_t DSP_FirQ15_Process(DSP_FirQ15_t *fir, const int16_t *in, int16_t *out, uint32_t count);
+uint32_t DSP_FirQ31_Process(DSP_FirQ31_t *fir, const int32_t *in, int32_t *out, uint32_t count);
+
+/*******************************************************************************
+ * @brief   Set up a biquad cascade, state cleared.
+ *
+ * @param   postShift   0 ... DSP_BIQUAD_POST_SHIFT_MAX.
+ * @return  0 done, -1 invalid parameter.
+ ******************************************************************************/
+int32_t DSP_BiquadQ15_Init(DSP_BiquadQ15_t *iir, uint8_t stages, const int16_t *coeffs, int16_t *state,
+                           uint8_t postShift);
+int32_t DSP_BiquadQ31_Init(DSP_BiquadQ31_t *iir, uint8_t stages, const int32_t *coeffs, int32_t *state,
+                           uint8_t postShift);
+
+/*******************************************************************************
+ * @brief   Filter count samples through all stages (in and out may alias).
+ ******************************************************************************/
+void DSP_BiquadQ15_Process(DSP_BiquadQ15_t *iir, const int16_t *in, int16_t *out, uint32_t count);
+void DSP_BiquadQ31_Process(DSP_BiquadQ31_t *iir, const int32_t *in, int32_t *out, uint32_t count);
+
+/*******************************************************************************
+ * @brief   Set up a moving average, history cleared.
+ *
+ * @param   length      Window, power of two, 1 ... 32768.
+ * @return  0 done, -1 invalid parameter.
+ ******************************************************************************/
+int32_t DSP_MovAvgQ15_Init(DSP_MovAvgQ15_t *avg, int16_t *history, uint32_t length);
+int32_t DSP_MovAvgQ31_Init(DSP_MovAvgQ31_t *avg, int32_t *history, uint32_t length);
+
+/*******************************************************************************
+ * @brief   Average of the last length inputs for each input (in and out
+ *          may alias).
+ ******************************************************************************/
+void DSP_MovAvgQ15_Process(DSP_MovAvgQ15_t *avg, const int16_t *in, int16_t *out, uint32_t count);
+void DSP_MovAvgQ31_Process(DSP_MovAvgQ31_t *avg, const int32_t *in, int32_t *out, uint32_t count);
+
+/*******************************************************************************
+ * @brief   Saturating element-wise sum out = a + b, two samples per step.
+ ******************************************************************************/
+void DSP_AddQ15(const int16_t *a, const int16_t *b, int16_t *out, uint32_t count);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DSP_FILTER_H_ */
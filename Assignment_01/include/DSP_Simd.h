@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * @file    DSP_Simd.h
+ * @brief   Cortex-M4 DSP extension instructions header file.
+ *
+ * Each function is one DSP instruction when the compiler targets the DSP
+ * extension (__ARM_FEATURE_DSP, e.g. -mcpu=cortex-m4), otherwise a C model
+ * with the same result bit for bit, so filters built on them give
+ * identical output on the target and on a host.
+ *
+ * Halfword pairs: bits 15:0 = lower address (first) sample, bits 31:16 =
+ * second sample, as loaded from memory by DSP_Read_Q15x2() on a little
+ * endian machine.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DSP_SIMD_H_
+#define DSP_SIMD_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+#if defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define DSP_SIMD_TARGET     (1)
+#else
+#define DSP_SIMD_TARGET     (0)
+#endif
+
+/*******************************************************************************
+ * @brief   Load two Q15 samples, any halfword alignment (LDR on target).
+ ******************************************************************************/
+static inline uint32_t DSP_Read_Q15x2(const int16_t *p)
+{
+    uint32_t value;
+
+    __builtin_memcpy(&value, p, sizeof(value));
+
+    return value;
+}
+
+/*******************************************************************************
+ * @brief   Store two Q15 samples, any halfword alignment (STR on target).
+ ******************************************************************************/
+static inline void DSP_Write_Q15x2(int16_t *p, uint32_t value)
+{
+    __builtin_memcpy(p, &value, sizeof(value));
+}
+
+/*******************************************************************************
+ * @brief   PKHBT: pair from two samples.
+ ******************************************************************************/
+static inline uint32_t DSP_Pack(int16_t first, int16_t second)
+{
+    return (uint32_t)(uint16_t)first | ((uint32_t)(uint16_t)second << 16);
+}
+
+/*******************************************************************************
+ * @brief   SMLAD: acc + first * first + second * second, 32-bit wrap.
+ ******************************************************************************/
+static inline int32_t DSP_Smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+#if DSP_SIMD_TARGET
+    int32_t result;
+
+    __asm volatile ("smlad %0, %1, %2, %3" : "=r" (result) : "r" (a), "r" (b), "r" (acc));
+
+    return result;
+#else
+    uint32_t sum;
+
+    sum = (uint32_t)((int32_t)(int16_t)a * (int32_t)(int16_t)b) +
+          (uint32_t)((int32_t)(int16_t)(a >> 16) * (int32_t)(int16_t)(b >> 16)) + (uint32_t)acc;
+
+    return (int32_t)sum;
+#endif
+}
+
+/*******************************************************************************
+ * @brief   SMLALD: 64-bit acc + first * first + second * second.
+ ******************************************************************************/
+static inline int64_t DSP_Smlald(uint32_t a, uint32_t b, int64_t acc)
+{
+#if DSP_SIMD_TARGET
+    uint32_t lo;
+    uint32_t hi;
+
+    lo = (uint32_t)acc;
+    hi = (uint32_t)((uint64_t)acc >> 32);
+    __asm volatile ("smlald %0, %1, %2, %3" : "+r" (lo), "+r" (hi) : "r" (a), "r" (b));
+
+    return (int64_t)(((uint64_t)hi << 32) | lo);
+#else
+    return acc + (int64_t)((int32_t)(int16_t)a * (int32_t)(int16_t)b) +
+           (int64_t)((int32_t)(int16_t)(a >> 16) * (int32_t)(int16_t)(b >> 16));
+#endif
+}
+
+/*******************************************************************************
+ * @brief   QADD16: saturating add of both halfwords.
+ ******************************************************************************/
+static inline uint32_t DSP_Qadd16(uint32_t a, uint32_t b)
+{
+#if DSP_SIMD_TARGET
+    uint32_t result;
+
+    __asm volatile ("qadd16 %0, %1, %2" : "=r" (result) : "r" (a), "r" (b));
+
+    return result;
+#else
+    int32_t lo;
+    int32_t hi;
+
+    lo = (int32_t)(int16_t)a + (int32_t)(int16_t)b;
+    hi = (int32_t)(int16_t)(a >> 16) + (int32_t)(int16_t)(b >> 16);
+    lo = (lo > 32767) ? 32767 : ((lo < -32768) ? -32768 : lo);
+    hi = (hi > 32767) ? 32767 : ((hi < -32768) ? -32768 : hi);
+
+    return DSP_Pack((int16_t)lo, (int16_t)hi);
+#endif
+}
+
+/*******************************************************************************
+ * @brief   SSAT #16: saturate to Q15.
+ ******************************************************************************/
+static inline int16_t DSP_Sat16(int32_t value)
+{
+#if DSP_SIMD_TARGET
+    int32_t result;
+
+    __asm volatile ("ssat %0, #16, %1" : "=r" (result) : "r" (value));
+
+    return (int16_t)result;
+#else
+    return (int16_t)((value > 32767) ? 32767 : ((value < -32768) ? -32768 : value));
+#endif
+}
+
+/*******************************************************************************
+ * @brief   Saturate a 64-bit value to Q31 (no single instruction).
+ ******************************************************************************/
+static inline int32_t DSP_Sat32(int64_t value)
+{
+    return (int32_t)((value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : value));
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DSP_SIMD_H_ */
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * @file    Driver_CAN_S32K144.h
+ * @brief   S32K144 FlexCAN specific extensions of the CMSIS CAN driver.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DRIVER_CAN_S32K144_H_
+#define DRIVER_CAN_S32K144_H_
+
+#include "Driver_CAN.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/****** CAN Objects *****/
+
+/**
+ * Object 0 is the 6-deep RX FIFO with a 16-element ID filter table (exact
+ * and maskable filters, data frames only). Objects 1 ... n are single
+ * message buffers usable for TX or RX with one filter each: 22 on
+ * FlexCAN0, 6 on FlexCAN1/2.
+ *
+ * In FD mode (FlexCAN0 only) the RX FIFO is not available and objects
+ * 1 ... n map to all message buffers: 32 / 21 / 12 / 7 for a payload size
+ * of 8 / 16 / 32 / 64 bytes (see CAN_CONTROL_MB_LAYOUT).
+ */
+#define CAN_OBJ_RX_FIFO             (0U)
+#define CAN_OBJ_MAILBOX(n)          (1U + (uint32_t)(n))
+
+/**
+ * SetBitrate() with bit_segments = 0 computes the segments from the clock:
+ * the largest number of time quanta (8 ... 25) dividing the clock exactly,
+ * sample point near 80 %.
+ */
+#define CAN_BIT_SEGMENTS_AUTO       (0UL)
+
+/****** CAN Control Codes (device specific, outside the CMSIS range) *****/
+
+/**
+ * Plan the FD message buffer layout, arg = CAN_MB_LAYOUT(payload, mailboxes):
+ * the largest frame in bytes and the number of mailbox objects needed. MB
+ * RAM has a single payload size region, so a mix of 8 and 64 byte mailboxes
+ * gets the smallest size holding the largest frame; fails if that leaves
+ * fewer than mailboxes objects. Initialization mode only, resets all
+ * mailbox objects. Default 64 bytes.
+ */
+#define CAN_CONTROL_MB_LAYOUT       (0x80UL)
+#define CAN_MB_LAYOUT(payload, mailboxes)   (((uint32_t)(payload) & 0xFFUL) | (((uint32_t)(mailboxes) & 0xFFUL) << 8))
+
+/**
+ * ARM_CAN_SET_TRANSCEIVER_DELAY arg is the secondary sample point offset
+ * in data phase time quanta; 0 (default) places it at the data sample point.
+ */
+#define CAN_TRANSCEIVER_DELAY_AUTO  (0UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern ARM_DRIVER_CAN Driver_CAN0;
+extern ARM_DRIVER_CAN Driver_CAN1;
+extern ARM_DRIVER_CAN Driver_CAN2;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_CAN_S32K144_H_ */
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * @file    Driver_Flash_S32K144.h
+ * @brief   S32K144 FTFC specific extensions of the CMSIS Flash driver.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DRIVER_FLASH_S32K144_H_
+#define DRIVER_FLASH_S32K144_H_
+
+#include "Driver_Flash.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * Driver_Flash0 is the P-Flash (0x00000000, 512 KB, 4 KB sectors),
+ * Driver_Flash1 the FlexNVM D-Flash (0x10000000, 2 KB sectors): 64 KB, or
+ * 32 KB once NVM_Eeprom_Partition() gave the rest to the EEPROM backup.
+ * Addresses are system addresses, programming is in 8 byte phrases
+ * (8-bit data items, address and count multiples of 8).
+ *
+ * Both share the FTFC command engine with the EEPROM emulation: one
+ * operation at a time, a second one returns ARM_DRIVER_ERROR_BUSY.
+ * Operations complete in the background and end with
+ * ARM_FLASH_EVENT_READY (plus ARM_FLASH_EVENT_ERROR on failure). D-Flash commands run while the application executes from
+ * P-Flash; P-Flash commands stall the CPU in RAM with interrupts disabled
+ * for one phrase / sector each; higher priority interrupts are served in
+ * between, the interrupted code resumes once the operation is done.
+ */
+#define FLASH_PFLASH_BASE           (0x00000000UL)
+#define FLASH_DFLASH_BASE           (0x10000000UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern ARM_DRIVER_FLASH Driver_Flash0;
+extern ARM_DRIVER_FLASH Driver_Flash1;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_FLASH_S32K144_H_ */
@@ -0,0 +1,37 @@
+/*******************************************************************************
+ * @file    Driver_I2C_S32K144.h
+ * @brief   S32K144 LPI2C specific extensions of the CMSIS I2C driver.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DRIVER_I2C_S32K144_H_
+#define DRIVER_I2C_S32K144_H_
+
+#include "Driver_I2C.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/****** I2C Control Codes (device specific, outside the CMSIS range) *****/
+
+/** Master receives of at least arg bytes use eDMA, shorter ones the FIFO interrupt (default 8, 0 = never). */
+#define I2C_CONTROL_DMA_THRESHOLD   (0x80UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern ARM_DRIVER_I2C Driver_I2C0;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_I2C_S32K144_H_ */
@@ -0,0 +1,52 @@
+/*******************************************************************************
+ * @file    Driver_SPI_S32K144.h
+ * @brief   S32K144 LPSPI specific extensions of the CMSIS SPI driver.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DRIVER_SPI_S32K144_H_
+#define DRIVER_SPI_S32K144_H_
+
+#include "Driver_SPI.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/****** SPI Control Codes (device specific, outside the CMSIS range) *****/
+
+/**
+ * Keep PCS asserted after a transfer; arg: 0=release now (default), 1=hold.
+ *
+ * While held, the next Send/Receive/Transfer continues the same chip-select
+ * period (TCR.CONTC), so back-to-back frames such as command + payload are
+ * chained without PCS toggling or inter-transfer delay.
+ */
+#define SPI_CONTROL_CS_HOLD         (0x80UL << ARM_SPI_CONTROL_Pos)
+
+/** Transfers longer than arg frames use eDMA, shorter ones the FIFO interrupt (default 16). */
+#define SPI_CONTROL_DMA_THRESHOLD   (0x81UL << ARM_SPI_CONTROL_Pos)
+
+/** Hardware chip select used for the following transfers; arg = PCS 0 ... 3. */
+#define SPI_CONTROL_PCS             (0x82UL << ARM_SPI_CONTROL_Pos)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern ARM_DRIVER_SPI Driver_SPI0;
+extern ARM_DRIVER_SPI Driver_SPI1;
+extern ARM_DRIVER_SPI Driver_SPI2;
+extern ARM_DRIVER_SPI Driver_SPI3;         /**< FlexIO: 8/16/32 bit frames, GPIO chip select, CS_HOLD only */
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_SPI_S32K144_H_ */
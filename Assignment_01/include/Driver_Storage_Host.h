@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * @file    Driver_Storage_Host.h
+ * @brief   Host (POSIX) file backed CMSIS Storage driver header file.
+ *
+ * Stand-in for the on-chip flash when storage layers are built and tested
+ * on a PC: the storage is a file mapped into memory, so its contents
+ * survive the process like flash survives a reset. It behaves like the
+ * FTFC: erase in erase units, program in program units, each program unit
+ * only once between erases (tracked per unit, so a unit programmed with
+ * 0xFF data is taken too), reads of erased bytes give 0xFF. Units of an
+ * existing file are taken unless they read erased.
+ *
+ * Program and erase times can be injected per unit, and operations can
+ * complete from a worker thread through the callback, as on the target.
+ * Operations are counted with their modeled time for performance studies
+ * (STORAGE_HOST_GetStats), whether or not the delays are really waited.
+ *
+ * Built only for POSIX hosts, the source is empty for the target.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DRIVER_STORAGE_HOST_H_
+#define DRIVER_STORAGE_HOST_H_
+
+#include <stdint.h>
+#include "Driver_Storage.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Storage geometry and timing, given before Initialize().
+ */
+typedef struct
+{
+    const char  *path;              /**< Backing file, created / grown (new bytes erased) */
+    uint32_t    size;               /**< Storage bytes, multiple of eraseUnit   */
+    uint32_t    eraseUnit;          /**< Sector size                            */
+    uint32_t    programUnit;        /**< Phrase size                            */
+    uint32_t    programTimeUs;      /**< Modeled time per program unit          */
+    uint32_t    eraseTimeUs;        /**< Modeled time per erase unit            */
+    uint8_t     delay;              /**< 1 = really wait the modeled time       */
+    uint8_t     asynchronous;       /**< 1 = complete from a worker thread      */
+} STORAGE_HOST_Config_t;
+
+/**
+ * @brief Operation counters since Initialize().
+ */
+typedef struct
+{
+    uint64_t    bytesRead;
+    uint64_t    bytesProgrammed;
+    uint32_t    programUnits;
+    uint32_t    eraseUnits;
+    uint64_t    busyTimeUs;         /**< Modeled program / erase time */
+    uint32_t    rejected;           /**< Operations refused (alignment, not erased, busy) */
+} STORAGE_HOST_Stats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set the geometry and timing, while the driver is uninitialized.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, ARM_DRIVER_ERROR_BUSY.
+ ******************************************************************************/
+int32_t STORAGE_HOST_Configure(const STORAGE_HOST_Config_t *config);
+
+/*******************************************************************************
+ * @brief   Operation counters.
+ ******************************************************************************/
+void STORAGE_HOST_GetStats(STORAGE_HOST_Stats_t *stats);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern ARM_DRIVER_STORAGE Driver_Storage0;
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_STORAGE_HOST_H_ */
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * @file    Driver_USART_S32K144.h
+ * @brief   S32K144 LPUART specific extensions of the CMSIS USART driver.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef DRIVER_USART_S32K144_H_
+#define DRIVER_USART_S32K144_H_
+
+#include "Driver_USART.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/****** USART Control Codes (device specific, outside the CMSIS range) *****/
+
+/**
+ * Circular receive; arg: 0=disabled (default), 1=enabled.
+ *
+ * When enabled, ARM_USART_Receive(data, num) starts a DMA transfer that never
+ * ends: data[0..num-1] is used as a ring buffer. ARM_USART_GetRxCount returns
+ * the free-running number of bytes written since Receive, the application
+ * keeps its own read counter (unread = GetRxCount() - readCount, position
+ * = count % num). Events:
+ *  - ARM_USART_EVENT_RX_TIMEOUT       line idle after a frame
+ *  - ARM_USART_EVENT_RECEIVE_COMPLETE half / end of the buffer reached
+ * num must be 2 ... 32767 bytes.
+ */
+#define USART_CONTROL_RX_CIRCULAR   (0x80UL << ARM_USART_CONTROL_Pos)
+
+/** Idle characters that terminate an RX frame; arg = 1, 2, 4 ... 128 (default 2). */
+#define USART_CONTROL_IDLE_CHARS    (0x81UL << ARM_USART_CONTROL_Pos)
+
+/** Internal loopback TX -> RX; arg: 0=disabled (default), 1=enabled. */
+#define USART_CONTROL_LOOPBACK      (0x82UL << ARM_USART_CONTROL_Pos)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern ARM_DRIVER_USART Driver_USART0;
+extern ARM_DRIVER_USART Driver_USART1;
+extern ARM_DRIVER_USART Driver_USART2;
+extern ARM_DRIVER_USART Driver_USART3;     /**< FlexIO: 8N1, RX_CIRCULAR, no idle / break / loopback */
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* DRIVER_USART_S32K144_H_ */
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * @file    FTM_Capture.h
+ * @brief   FTM input capture: edge timestamps, frequency, period and duty
+ *          header file.
+ *
+ * The free-running 16-bit counter value of each edge (or of each rising /
+ * falling pair in pulse mode, dual edge capture) is copied into a ring:
+ * by eDMA on the channel request, without CPU work per edge, or by the
+ * channel interrupt when no DMA is used. FTM_Capture_Read() extends the
+ * captures to 32-bit timestamps and FTM_Capture_Measure() reduces a batch
+ * to period, frequency and duty.
+ *
+ * Extension: consecutive edges are less than one counter period apart,
+ * so the 16-bit difference is the elapsed time. The prescaler is chosen
+ * from minFrequency for a period of at least two signal periods. The
+ * overflow interrupt marks the signal as lost when a whole counter period
+ * passes without an edge; the next edge then starts a new chain (its
+ * timestamp stays monotonic, within one counter period).
+ *
+ * One capture per FTM instance: it owns the counter and its overflow
+ * interrupt.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef FTM_CAPTURE_H_
+#define FTM_CAPTURE_H_
+
+#include <stdint.h>
+#include "Driver_Common.h"
+#include "HAL_FTM.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTM_CAPTURE_ERROR_RANGE     (ARM_DRIVER_ERROR_SPECIFIC - 1)    /**< minFrequency below the slowest counter */
+
+/* Mode */
+#define FTM_CAPTURE_MODE_RISING     (0U)    /**< One timestamp per rising edge  */
+#define FTM_CAPTURE_MODE_FALLING    (1U)    /**< One timestamp per falling edge */
+#define FTM_CAPTURE_MODE_PULSE      (2U)    /**< Rising then falling edge: period and high time */
+
+#define FTM_CAPTURE_DUTY_FULL       (10000UL)   /**< Duty unit: 0.01 % */
+
+/**
+ * @brief Capture configuration.
+ */
+typedef struct
+{
+    HAL_FTM_Instance_t  instance;
+    uint8_t             channel;        /**< Input channel; pulse mode: even channel, its pair partner is used too */
+    uint8_t             mode;           /**< FTM_CAPTURE_MODE_xxx                          */
+    uint8_t             filter;         /**< Glitch filter, channels 0 ... 3 (HAL_FTM_SetInputFilter) */
+    uint8_t             useDma;         /**< 1 eDMA into the ring, 0 channel interrupt     */
+    uint8_t             port;           /**< Input pin                                     */
+    uint8_t             pin;
+    uint8_t             pinMux;         /**< FTMn_CHx function of the pin                  */
+    uint32_t            minFrequency;   /**< Slowest signal in Hz                          */
+    uint16_t           *ring;           /**< Raw captures, 1 per event (2 in pulse mode)   */
+    uint16_t            ringEvents;     /**< Events in the ring, power of two, at most 16384; more
+                                             than arrive in one counter period */
+} FTM_CaptureConfig_t;
+
+/**
+ * @brief Extended event.
+ */
+typedef struct
+{
+    uint32_t    time;       /**< Rising (or selected) edge, counter ticks, wraps at 2^32 */
+    uint32_t    period;     /**< Ticks since the previous event, 0 after a gap           */
+    uint32_t    width;      /**< High time in ticks (pulse mode)                         */
+} FTM_CaptureEvent_t;
+
+/**
+ * @brief Batch measurement.
+ */
+typedef struct
+{
+    uint32_t    periods;            /**< Periods in the batch                  */
+    uint32_t    periodTicks;        /**< Mean period                           */
+    uint32_t    periodNs;
+    uint32_t    frequencyMilliHz;
+    uint32_t    duty;               /**< Mean high time / period, 0.01 % (pulse mode) */
+    uint8_t     lost;               /**< No edge for a counter period          */
+} FTM_CaptureResult_t;
+
+/**
+ * @brief Capture instance, allocated by the caller.
+ */
+typedef struct
+{
+    const FTM_CaptureConfig_t  *config;
+    uint32_t                    tickHz;
+    volatile uint32_t           produced;       /**< Events written since start       */
+    volatile uint32_t           wraps;          /**< Counter overflows                */
+    volatile uint32_t           gapEvent;       /**< First event after the last gap    */
+    volatile uint16_t           gapWraps;       /**< Overflows without edge in it      */
+    volatile uint8_t            idle;           /**< No edge in the last counter period */
+    uint32_t                    producedAtWrap;
+    uint32_t                    consumed;
+    uint32_t                    lastTime;
+    uint32_t                    overruns;       /**< Events dropped, reader too slow  */
+    uint16_t                    lastRaw;
+    uint16_t                    dmaPos;
+    uint8_t                     chained;        /**< lastTime valid */
+    uint8_t                     dmaChannel;
+} FTM_Capture_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up the counter, channel(s), pin and DMA, stopped.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER,
+ *          FTM_CAPTURE_ERROR_RANGE, ARM_DRIVER_ERROR (no DMA channel).
+ ******************************************************************************/
+int32_t FTM_Capture_Init(FTM_Capture_t *cap, const FTM_CaptureConfig_t *config);
+
+int32_t FTM_Capture_Start(FTM_Capture_t *cap);
+int32_t FTM_Capture_Stop(FTM_Capture_t *cap);
+
+/*******************************************************************************
+ * @brief   Take the new events as extended timestamps.
+ *
+ * @return  Events written to events, at most max.
+ ******************************************************************************/
+uint32_t FTM_Capture_Read(FTM_Capture_t *cap, FTM_CaptureEvent_t *events, uint32_t max);
+
+/*******************************************************************************
+ * @brief   Take all new events and reduce them to a measurement.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t FTM_Capture_Measure(FTM_Capture_t *cap, FTM_CaptureResult_t *result);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* FTM_CAPTURE_H_ */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * @file    FTM_Pwm.h
+ * @brief   FTM PWM: edge / center-aligned outputs, dead time, synchronized
+ *          duty updates and DMA ramps header file.
+ *
+ * Duty writes go to the CnV write buffers and are loaded together at the
+ * next reload point (counter at MOD for edge-aligned, at CNTIN for
+ * center-aligned), so a period never mixes old and new values. Several
+ * channels are updated coherently between FTM_Pwm_BeginUpdate() and
+ * FTM_Pwm_EndUpdate().
+ *
+ * Ramps: an unused channel of the instance (triggerChannel) matches at
+ * the start of every period and requests one eDMA minor loop, which
+ * copies the next frame of a table into the CnV buffers of consecutive
+ * channels. Fades and gamma corrected dimming then run without CPU work
+ * per period. On FTM0 / FTM3 the trigger channel must be the only one
+ * using DMA (one request per instance).
+ *
+ * One PWM per FTM instance: it owns the counter.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef FTM_PWM_H_
+#define FTM_PWM_H_
+
+#include <stdint.h>
+#include "Driver_Common.h"
+#include "HAL_FTM.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTM_PWM_ERROR_RANGE         (ARM_DRIVER_ERROR_SPECIFIC - 1)    /**< Frequency out of the counter range */
+
+/* Alignment */
+#define FTM_PWM_ALIGN_EDGE          (0U)    /**< Up counting, reload at MOD         */
+#define FTM_PWM_ALIGN_CENTER        (1U)    /**< Up-down counting, reload at CNTIN  */
+
+#define FTM_PWM_DUTY_FULL           (10000U)    /**< Duty unit: 0.01 % */
+#define FTM_PWM_NO_TRIGGER          (HAL_FTM_CHANNEL_COUNT)  /**< triggerChannel: no ramps */
+
+/**
+ * @brief Output channel.
+ */
+typedef struct
+{
+    uint8_t     channel;        /**< 0 ... 7                                          */
+    uint8_t     activeLow;      /**< 1 pin low during the duty (LED to VDD)          */
+    uint8_t     complementary;  /**< Odd channel only: inverse of channel - 1, with the dead time;
+                                     its duty is not set */
+    uint8_t     port;           /**< Output pin                                       */
+    uint8_t     pin;
+    uint8_t     pinMux;         /**< FTMn_CHx function of the pin                     */
+} FTM_PwmChannel_t;
+
+/**
+ * @brief PWM configuration.
+ */
+typedef struct
+{
+    HAL_FTM_Instance_t          instance;
+    uint8_t                     align;          /**< FTM_PWM_ALIGN_xxx                      */
+    uint8_t                     channelCount;
+    uint8_t                     triggerChannel; /**< Unused channel requesting the ramp DMA,
+                                                     FTM_PWM_NO_TRIGGER without ramps */
+    uint32_t                    frequency;      /**< PWM frequency in Hz                    */
+    uint32_t                    deadtimeNs;     /**< Complementary pairs, 0 none            */
+    const FTM_PwmChannel_t     *channels;
+} FTM_PwmConfig_t;
+
+/**
+ * @brief End of a one-shot ramp, from the DMA interrupt.
+ */
+typedef void (*FTM_PwmRampCallback_t)(void *param);
+
+/**
+ * @brief PWM instance, allocated by the caller.
+ */
+typedef struct
+{
+    const FTM_PwmConfig_t      *config;
+    uint32_t                    tickHz;         /**< Counter clock                          */
+    uint32_t                    period;         /**< Counter ticks for FTM_PWM_DUTY_FULL    */
+    uint32_t                    deadtimeTicks;  /**< Dead time programmed                   */
+    FTM_PwmRampCallback_t       rampCallback;
+    void                       *rampParam;
+    volatile uint8_t            ramping;
+    uint8_t                     dmaChannel;
+} FTM_Pwm_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up the counter, channels, pins and ramp DMA, stopped, all
+ *          duties 0.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, FTM_PWM_ERROR_RANGE,
+ *          ARM_DRIVER_ERROR (no DMA channel).
+ ******************************************************************************/
+int32_t FTM_Pwm_Init(FTM_Pwm_t *pwm, const FTM_PwmConfig_t *config);
+
+int32_t FTM_Pwm_Start(FTM_Pwm_t *pwm);
+int32_t FTM_Pwm_Stop(FTM_Pwm_t *pwm);
+
+/*******************************************************************************
+ * @brief   Compare value of a duty, for ramp tables.
+ *
+ * @param   duty        0 ... FTM_PWM_DUTY_FULL.
+ ******************************************************************************/
+uint16_t FTM_Pwm_DutyToTicks(const FTM_Pwm_t *pwm, uint32_t duty);
+
+/*******************************************************************************
+ * @brief   New duty of a channel, output from the next reload point.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t FTM_Pwm_SetDuty(FTM_Pwm_t *pwm, uint8_t channel, uint32_t duty);
+
+/*******************************************************************************
+ * @brief   Hold the reload while several duties are written, then load
+ *          them at the same reload point.
+ ******************************************************************************/
+void FTM_Pwm_BeginUpdate(FTM_Pwm_t *pwm);
+void FTM_Pwm_EndUpdate(FTM_Pwm_t *pwm);
+
+/*******************************************************************************
+ * @brief   Fill a ramp table from one duty to another, in compare values.
+ *
+ * @param   table       steps entries; stride entries apart (channels of a
+ *                      multi-channel frame).
+ * @param   gamma       1 perceived brightness is linear (duty ~ level^2.2,
+ *                      0.8 x^2 + 0.2 x^3), 0 duty is linear.
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t FTM_Pwm_FillRamp(const FTM_Pwm_t *pwm, uint16_t *table, uint32_t steps, uint32_t stride,
+                         uint32_t fromDuty, uint32_t toDuty, uint8_t gamma);
+
+/*******************************************************************************
+ * @brief   Stream a table into CnV, one frame per PWM period.
+ *
+ * @param   channel     First channel of the frame.
+ * @param   count       Consecutive channels per frame.
+ * @param   table       steps frames of count compare values; must stay
+ *                      valid while the ramp runs.
+ * @param   steps       Frames, 1 ... 32767.
+ * @param   loop        1 restart at the end (no interrupt), 0 stop on the
+ *                      last frame and call callback.
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER,
+ *          ARM_DRIVER_ERROR_UNSUPPORTED (no trigger channel).
+ ******************************************************************************/
+int32_t FTM_Pwm_StartRamp(FTM_Pwm_t *pwm, uint8_t channel, uint8_t count, const uint16_t *table,
+                          uint16_t steps, uint8_t loop, FTM_PwmRampCallback_t callback, void *param);
+
+/*******************************************************************************
+ * @brief   Stop a ramp, the channels keep the last frame.
+ ******************************************************************************/
+int32_t FTM_Pwm_StopRamp(FTM_Pwm_t *pwm);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* FTM_PWM_H_ */
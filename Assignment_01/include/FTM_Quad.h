@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * @file    FTM_Quad.h
+ * @brief   FTM quadrature decoder: extended position, index and velocity
+ *          header file.
+ *
+ * FTM1 / FTM2 count the encoder edges in hardware (phase A / B on the
+ * channel 0 / 1 pins), free running over 16 bits.
+ *
+ * Extension: the instance keeps the 32-bit position whose low half equals
+ * the counter at the last FTM_Quad_Update(). A position read takes the
+ * counter in a single register access and adds its signed 16-bit
+ * difference to that word; it is exact while the encoder moves less than
+ * 32767 counts between updates, i.e. below 32767 x sampleHz counts/s. No
+ * overflow interrupt and no lock are needed.
+ *
+ * Index: an optional channel captures the counter on the index pulse; the
+ * capture is extended the same way and latched, or becomes the position
+ * zero.
+ *
+ * Velocity, once per FTM_Quad_Update():
+ * - edge counting (M): counts in the sample period x sampleHz, when at
+ *   least switchCounts edges arrived (back below switchCounts / 2);
+ * - period timing (T): below that, from the phase A period measured by an
+ *   optional FTM_Capture instance on another timer, or else from the
+ *   sample periods spanned by the last edges. Without edges the estimate
+ *   decays to the largest speed still consistent with the silence, and
+ *   to 0 after maxWindows samples.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef FTM_QUAD_H_
+#define FTM_QUAD_H_
+
+#include <stdint.h>
+#include "Driver_Common.h"
+#include "HAL_FTM.h"
+#include "FTM_Capture.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Mode */
+#define FTM_QUAD_MODE_PHASE         (0U)    /**< A / B in quadrature, 4 counts per cycle */
+#define FTM_QUAD_MODE_COUNT_DIR     (1U)    /**< A counts, B gives the direction         */
+
+/* Index */
+#define FTM_QUAD_NO_INDEX           (HAL_FTM_CHANNEL_COUNT)     /**< indexChannel: no index input */
+#define FTM_QUAD_INDEX_LATCH        (0U)    /**< Record the position at the index */
+#define FTM_QUAD_INDEX_RESET        (1U)    /**< Position 0 at every index        */
+
+/* Velocity method */
+#define FTM_QUAD_METHOD_PERIOD      (0U)
+#define FTM_QUAD_METHOD_EDGES       (1U)
+
+#define FTM_QUAD_VELOCITY_SHIFT     (4U)    /**< Velocity unit: 1/16 count/s */
+
+/**
+ * @brief Decoder configuration.
+ */
+typedef struct
+{
+    HAL_FTM_Instance_t  instance;       /**< HAL_FTM_1 or HAL_FTM_2                  */
+    uint8_t             mode;           /**< FTM_QUAD_MODE_xxx                       */
+    uint8_t             filter;         /**< Phase input filter, 0 (off) ... 15      */
+    uint8_t             invert;         /**< HAL_FTM_QUAD_INVERT_A / _B              */
+    uint8_t             phaseAPort;
+    uint8_t             phaseAPin;
+    uint8_t             phaseAMux;      /**< FTMn_CH0 function of the pin            */
+    uint8_t             phaseBPort;
+    uint8_t             phaseBPin;
+    uint8_t             phaseBMux;      /**< FTMn_CH1 function of the pin            */
+    uint8_t             indexChannel;   /**< 2 ... 7, FTM_QUAD_NO_INDEX              */
+    uint8_t             indexMode;      /**< FTM_QUAD_INDEX_xxx                      */
+    uint8_t             indexPort;
+    uint8_t             indexPin;
+    uint8_t             indexMux;
+    uint16_t            switchCounts;   /**< Edges per sample for edge counting, >= 2 */
+    uint16_t            maxWindows;     /**< Samples without edge before velocity 0, >= 1 */
+    uint32_t            sampleHz;       /**< FTM_Quad_Update() rate                  */
+    FTM_Capture_t      *period;         /**< Phase A rising edges, started by the caller; NULL none */
+} FTM_QuadConfig_t;
+
+/**
+ * @brief Decoder instance, allocated by the caller.
+ */
+typedef struct
+{
+    const FTM_QuadConfig_t     *config;
+    const volatile uint32_t    *counter;        /**< CNT                                  */
+    volatile uint32_t           position;       /**< Extended counter at the last update  */
+    volatile uint32_t           offset;         /**< Extended counter of position 0       */
+    volatile uint32_t           indexPosition;  /**< Position at the last index           */
+    volatile uint32_t           indexCount;
+    uint32_t                    lastPosition;   /**< Previous sample                      */
+    int32_t                     velocity;       /**< counts/s << FTM_QUAD_VELOCITY_SHIFT  */
+    int32_t                     accCounts;      /**< Counts since the last period estimate */
+    uint16_t                    accWindows;     /**< Samples since the last period estimate */
+    int8_t                      direction;      /**< Sign of the last movement            */
+    uint8_t                     method;         /**< FTM_QUAD_METHOD_xxx of velocity       */
+} FTM_Quad_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up the decoder, pins and index capture, stopped, position 0.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t FTM_Quad_Init(FTM_Quad_t *quad, const FTM_QuadConfig_t *config);
+
+int32_t FTM_Quad_Start(FTM_Quad_t *quad);
+int32_t FTM_Quad_Stop(FTM_Quad_t *quad);
+
+/*******************************************************************************
+ * @brief   Current position, signed counts from position 0 (wraps at 2^32).
+ ******************************************************************************/
+int32_t FTM_Quad_GetPosition(const FTM_Quad_t *quad);
+
+/*******************************************************************************
+ * @brief   Move position 0 to the current position.
+ ******************************************************************************/
+void FTM_Quad_Zero(FTM_Quad_t *quad);
+
+/*******************************************************************************
+ * @brief   Sample the position and update the velocity, at sampleHz (a
+ *          timer interrupt or a periodic task).
+ ******************************************************************************/
+void FTM_Quad_Update(FTM_Quad_t *quad);
+
+/*******************************************************************************
+ * @brief   Last velocity estimate, counts/s << FTM_QUAD_VELOCITY_SHIFT.
+ *
+ * @param   method      FTM_QUAD_METHOD_xxx used, may be NULL.
+ ******************************************************************************/
+int32_t FTM_Quad_GetVelocity(const FTM_Quad_t *quad, uint8_t *method);
+
+/*******************************************************************************
+ * @brief   Position at the last index pulse.
+ *
+ * @return  Index pulses since start, 0 when none was seen.
+ ******************************************************************************/
+uint32_t FTM_Quad_GetIndex(const FTM_Quad_t *quad, int32_t *position);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* FTM_QUAD_H_ */
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * @file    HAL_ADC.h
+ * @brief   Hardware abstraction layer for the ADC header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_ADC_H_
+#define HAL_ADC_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Functional clock: FIRCDIV2 (48 MHz), divided by CFG1.ADIV. */
+#define HAL_ADC_CLOCK_HZ            (HAL_SCG_FIRCDIV2_HZ)
+
+#define HAL_ADC_SLOT_COUNT          (16U)       /**< SC1A ... SC1P / RA ... RP */
+#define HAL_ADC_INPUT_DISABLED      (0x1FU)     /**< SC1.ADCH: module disabled */
+
+/* Resolution (CFG1.MODE) */
+#define HAL_ADC_RESOLUTION_8BIT     (0U)
+#define HAL_ADC_RESOLUTION_12BIT    (1U)
+#define HAL_ADC_RESOLUTION_10BIT    (2U)
+
+/* Hardware averaging */
+#define HAL_ADC_AVERAGE_NONE        (0U)
+#define HAL_ADC_AVERAGE_4           (1U)
+#define HAL_ADC_AVERAGE_8           (2U)
+#define HAL_ADC_AVERAGE_16          (3U)
+#define HAL_ADC_AVERAGE_32          (4U)
+
+typedef enum
+{
+    HAL_ADC_0 = 0U,
+    HAL_ADC_1,
+    HAL_ADC_MAX
+} HAL_ADC_Instance_t;
+
+/**
+ * @brief Converter configuration.
+ */
+typedef struct
+{
+    uint8_t resolution;     /**< HAL_ADC_RESOLUTION_xxx                         */
+    uint8_t divider;        /**< ADCK = HAL_ADC_CLOCK_HZ >> divider (0 ... 3)   */
+    uint8_t sampleCycles;   /**< Sample phase in ADCK cycles, 2 ... 255         */
+    uint8_t average;        /**< HAL_ADC_AVERAGE_xxx                            */
+} HAL_ADC_Config_t;
+
+/**
+ * @brief Conversion complete callback, called from the ADC interrupt for
+ *        each slot with its interrupt enabled.
+ *
+ * The slot interrupt stays requested until the result is read or the slot
+ * is written again.
+ *
+ * @param slot      SC1 / R index.
+ * @param param     User pointer given to HAL_ADC_RegisterCallback().
+ */
+typedef void (*HAL_ADC_Callback_t)(uint8_t slot, void *param);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock an ADC instance from FIRCDIV2, all slots disabled.
+ *
+ * @param   instance    ADC instance.
+ ******************************************************************************/
+void HAL_ADC_Init(HAL_ADC_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Set resolution, clock, sample time and averaging.
+ *
+ * @param   instance    ADC instance.
+ * @param   config      Converter configuration.
+ ******************************************************************************/
+void HAL_ADC_Configure(HAL_ADC_Instance_t instance, const HAL_ADC_Config_t *config);
+
+/*******************************************************************************
+ * @brief   Run the self calibration (32 samples averaged), blocking.
+ *
+ * Averaging and trigger settings are restored afterwards. Call after
+ * HAL_ADC_Configure(), at the clock used for conversions.
+ *
+ * @param   instance    ADC instance.
+ ******************************************************************************/
+void HAL_ADC_Calibrate(HAL_ADC_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program a slot: input channel and conversion complete interrupt.
+ *
+ * With the software trigger, writing slot 0 starts a conversion.
+ *
+ * @param   instance    ADC instance.
+ * @param   slot        SC1 index.
+ * @param   input       ADCH input, HAL_ADC_INPUT_DISABLED to disable.
+ * @param   interrupt   1 = interrupt on conversion complete.
+ ******************************************************************************/
+void HAL_ADC_SetSlot(HAL_ADC_Instance_t instance, uint8_t slot, uint8_t input, uint8_t interrupt);
+
+/*******************************************************************************
+ * @brief   Select the hardware (PDB) trigger and the DMA request.
+ *
+ * @param   instance    ADC instance.
+ * @param   hwTrigger   1 = conversions started by PDB pre-triggers.
+ * @param   dma         1 = DMA request on conversion complete.
+ ******************************************************************************/
+void HAL_ADC_SetTrigger(HAL_ADC_Instance_t instance, uint8_t hwTrigger, uint8_t dma);
+
+/*******************************************************************************
+ * @brief   Result register of a slot / its address for DMA.
+ *
+ * @param   instance    ADC instance.
+ * @param   slot        R index.
+ ******************************************************************************/
+uint16_t HAL_ADC_GetResult(HAL_ADC_Instance_t instance, uint8_t slot);
+uint32_t HAL_ADC_GetResultAddress(HAL_ADC_Instance_t instance, uint8_t slot);
+
+/*******************************************************************************
+ * @brief   Register the conversion complete callback of an instance.
+ *
+ * @param   instance    ADC instance.
+ * @param   callback    Callback, or NULL to disable the interrupt vector.
+ * @param   param       User pointer passed back to the callback.
+ ******************************************************************************/
+void HAL_ADC_RegisterCallback(HAL_ADC_Instance_t instance, HAL_ADC_Callback_t callback, void *param);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_ADC_H_ */
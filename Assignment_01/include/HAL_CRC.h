@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * @file    HAL_CRC.h
+ * @brief   Hardware abstraction layer for the CRC module header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_CRC_H_
+#define HAL_CRC_H_
+
+#include <stdint.h>
+#include "device_registers.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Transpose of written data (CTRL.TOT) / read result (CTRL.TOTR) */
+#define HAL_CRC_TRANSPOSE_NONE          (0U)
+#define HAL_CRC_TRANSPOSE_BITS          (1U)    /**< Bits in bytes          */
+#define HAL_CRC_TRANSPOSE_BITS_BYTES    (2U)    /**< Bits and bytes: 32-bit reverse */
+#define HAL_CRC_TRANSPOSE_BYTES         (3U)    /**< Bytes only             */
+
+/**
+ * @brief Engine configuration.
+ */
+typedef struct
+{
+    uint32_t    polynomial;     /**< Normal form, 16 LSBs used for CRC-16 */
+    uint32_t    seed;
+    uint8_t     width32;        /**< 1 = CRC-32, 0 = CRC-16     */
+    uint8_t     transposeIn;    /**< HAL_CRC_TRANSPOSE_xxx      */
+    uint8_t     transposeOut;   /**< HAL_CRC_TRANSPOSE_xxx      */
+    uint8_t     complement;     /**< 1 = result XOR all ones    */
+} HAL_CRC_Config_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Enable the CRC module clock.
+ ******************************************************************************/
+void HAL_CRC_Init(void);
+
+/*******************************************************************************
+ * @brief   Set width, polynomial and transposes, load the seed.
+ ******************************************************************************/
+void HAL_CRC_Configure(const HAL_CRC_Config_t *config);
+
+/*******************************************************************************
+ * @brief   Feed one byte / one 32-bit word (4 bytes, memory order with the
+ *          bytes transposed on input).
+ ******************************************************************************/
+void HAL_CRC_WriteByte(uint8_t data);
+void HAL_CRC_WriteWord(uint32_t data);
+
+/*******************************************************************************
+ * @brief   Current result, transposed and complemented as configured.
+ ******************************************************************************/
+uint32_t HAL_CRC_GetResult(void);
+
+/*******************************************************************************
+ * @brief   Address of the data register, DMA destination.
+ ******************************************************************************/
+uint32_t HAL_CRC_GetDataAddress(void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_CRC_H_ */
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * @file    HAL_DMA.h
+ * @brief   Hardware abstraction layer for eDMA / DMAMUX header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_DMA_H_
+#define HAL_DMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "device_registers.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HAL_DMA_CHANNEL_COUNT       (16U)
+#define HAL_DMA_CHANNEL_INVALID     (0xFFU)     /**< Returned when no channel is free */
+
+/* Channel events passed to HAL_DMA_Callback_t */
+#define HAL_DMA_EVENT_MAJOR_DONE    (1UL << 0)  /**< Major loop completed      */
+#define HAL_DMA_EVENT_HALF_DONE     (1UL << 1)  /**< Major loop half completed */
+#define HAL_DMA_EVENT_ERROR         (1UL << 2)  /**< Channel reported an error */
+
+/* TCD CSR options for HAL_DMA_Transfer_t::flags */
+#define HAL_DMA_FLAG_INT_MAJOR      (DMA_TCD_CSR_INTMAJOR_MASK)
+#define HAL_DMA_FLAG_INT_HALF       (DMA_TCD_CSR_INTHALF_MASK)
+#define HAL_DMA_FLAG_DISABLE_REQ    (DMA_TCD_CSR_DREQ_MASK)     /**< Clear ERQ when major loop completes */
+
+/* Targets of HAL_DMA_SetMinorLoopOffset() */
+#define HAL_DMA_MLOFF_SRC           (1U << 0)
+#define HAL_DMA_MLOFF_DST           (1U << 1)
+
+typedef enum
+{
+    HAL_DMA_SIZE_8BIT   = 0U,
+    HAL_DMA_SIZE_16BIT  = 1U,
+    HAL_DMA_SIZE_32BIT  = 2U,
+    HAL_DMA_SIZE_16BYTE = 4U,
+    HAL_DMA_SIZE_32BYTE = 5U
+} HAL_DMA_Size_t;
+
+/**
+ * @brief Description of one transfer control descriptor (TCD).
+ */
+typedef struct
+{
+    uint32_t        srcAddr;        /**< Source address                                */
+    uint32_t        dstAddr;        /**< Destination address                           */
+    int16_t         srcOffset;      /**< Source increment after each read              */
+    int16_t         dstOffset;      /**< Destination increment after each write        */
+    HAL_DMA_Size_t  srcSize;        /**< Source read width                             */
+    HAL_DMA_Size_t  dstSize;        /**< Destination write width                       */
+    uint32_t        minorBytes;     /**< Bytes moved per service request               */
+    uint16_t        majorCount;     /**< Number of minor loops (1 ... 32767)           */
+    int32_t         srcLastAdj;     /**< Source adjustment after the major loop        */
+    int32_t         dstLastAdj;     /**< Destination adjustment after the major loop   */
+    uint16_t        flags;          /**< HAL_DMA_FLAG_xxx                              */
+} HAL_DMA_Transfer_t;
+
+/**
+ * @brief Channel event callback, called from the DMA interrupt.
+ *
+ * @param channel   eDMA channel that raised the event.
+ * @param event     HAL_DMA_EVENT_xxx mask.
+ * @param param     User pointer given to HAL_DMA_RegisterCallback().
+ */
+typedef void (*HAL_DMA_Callback_t)(uint8_t channel, uint32_t event, void *param);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Enable the DMAMUX clock and the eDMA error interrupt.
+ *
+ * Safe to call from every driver that uses DMA, only the first call has
+ * an effect.
+ ******************************************************************************/
+void HAL_DMA_Init(void);
+
+/*******************************************************************************
+ * @brief   Reserve a free eDMA channel.
+ *
+ * @return  Channel number, or HAL_DMA_CHANNEL_INVALID when all are in use.
+ ******************************************************************************/
+uint8_t HAL_DMA_AllocChannel(void);
+
+/*******************************************************************************
+ * @brief   Stop and release a channel reserved with HAL_DMA_AllocChannel().
+ *
+ * @param   channel  eDMA channel.
+ ******************************************************************************/
+void HAL_DMA_FreeChannel(uint8_t channel);
+
+/*******************************************************************************
+ * @brief   Route a peripheral request to a channel through the DMAMUX.
+ *
+ * @param   channel  eDMA channel.
+ * @param   source   Request source (dma_request_source_t).
+ ******************************************************************************/
+void HAL_DMA_SetRequestSource(uint8_t channel, dma_request_source_t source);
+
+/*******************************************************************************
+ * @brief   Register the callback for the channel interrupts.
+ *
+ * @param   channel  eDMA channel.
+ * @param   callback Callback, or NULL to disable the channel interrupt.
+ * @param   param    User pointer passed back to the callback.
+ ******************************************************************************/
+void HAL_DMA_RegisterCallback(uint8_t channel, HAL_DMA_Callback_t callback, void *param);
+
+/*******************************************************************************
+ * @brief   Load a transfer descriptor into the channel TCD.
+ *
+ * The channel request must be disabled while the TCD is written.
+ *
+ * @param   channel  eDMA channel.
+ * @param   transfer Transfer description.
+ ******************************************************************************/
+void HAL_DMA_ConfigTransfer(uint8_t channel, const HAL_DMA_Transfer_t *transfer);
+
+/*******************************************************************************
+ * @brief   Add a signed offset to the source and/or destination address
+ *          after each minor loop.
+ *
+ * Call after HAL_DMA_ConfigTransfer(); used e.g. to read the same block
+ * of peripheral registers on every request. The minor loop byte count
+ * is limited to 1023 with an offset.
+ *
+ * @param   channel  eDMA channel.
+ * @param   offset   Offset in bytes (-524288 ... 524287).
+ * @param   target   HAL_DMA_MLOFF_xxx mask, 0 = no offset.
+ ******************************************************************************/
+void HAL_DMA_SetMinorLoopOffset(uint8_t channel, int32_t offset, uint8_t target);
+
+/*******************************************************************************
+ * @brief   Update only the source address / major count of a loaded TCD.
+ *
+ * Used for repeated transfers (e.g. one UART send after another) where the
+ * rest of the descriptor does not change.
+ *
+ * @param   channel     eDMA channel.
+ * @param   srcAddr     New source address.
+ * @param   dstAddr     New destination address.
+ * @param   majorCount  New major loop count.
+ ******************************************************************************/
+void HAL_DMA_Reload(uint8_t channel, uint32_t srcAddr, uint32_t dstAddr, uint16_t majorCount);
+
+/*******************************************************************************
+ * @brief   Enable / disable hardware requests for a channel.
+ *
+ * @param   channel  eDMA channel.
+ ******************************************************************************/
+void HAL_DMA_EnableRequest(uint8_t channel);
+void HAL_DMA_DisableRequest(uint8_t channel);
+
+/*******************************************************************************
+ * @brief   Start one minor loop by software (memory-to-memory transfers).
+ *
+ * @param   channel  eDMA channel.
+ ******************************************************************************/
+void HAL_DMA_SoftwareStart(uint8_t channel);
+
+/*******************************************************************************
+ * @brief   Read the current major loop iteration count (CITER).
+ *
+ * @param   channel  eDMA channel.
+ * @return  Remaining minor loops in the current major loop.
+ ******************************************************************************/
+uint16_t HAL_DMA_GetRemaining(uint8_t channel);
+
+/*******************************************************************************
+ * @brief   Check whether the channel has an unserviced interrupt request.
+ *
+ * @param   channel  eDMA channel.
+ * @return  1 when the INT flag of the channel is set, 0 otherwise.
+ ******************************************************************************/
+uint8_t HAL_DMA_IsIntPending(uint8_t channel);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_DMA_H_ */
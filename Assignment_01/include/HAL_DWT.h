@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * @file    HAL_DWT.h
+ * @brief   Cortex-M4 DWT cycle counter header file.
+ *
+ * CYCCNT counts core clock cycles (HAL_SCG_SYS_CLK_HZ) and wraps every
+ * 2^32 cycles; differences of two reads are valid across one wrap. The
+ * DWT unit is only powered while DEMCR.TRCENA is set: without it,
+ * CYCCNTENA is ignored and the counter reads a constant.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_DWT_H_
+#define HAL_DWT_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HAL_DWT_DEMCR               (*(volatile uint32_t *)0xE000EDFCUL)
+#define HAL_DWT_DEMCR_TRCENA        (1UL << 24)
+#define HAL_DWT_CTRL                (*(volatile uint32_t *)0xE0001000UL)
+#define HAL_DWT_CTRL_CYCCNTENA      (1UL << 0)
+#define HAL_DWT_CYCCNT              (*(volatile uint32_t *)0xE0001004UL)
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Power the DWT unit and start the cycle counter.
+ *
+ * Read-modify-writes of the two enable bits only; a counter already
+ * running (debugger, another module) keeps its value.
+ ******************************************************************************/
+static inline void HAL_DWT_EnableCycleCounter(void)
+{
+    HAL_DWT_DEMCR |= HAL_DWT_DEMCR_TRCENA;
+    HAL_DWT_CTRL  |= HAL_DWT_CTRL_CYCCNTENA;
+}
+
+/*******************************************************************************
+ * @brief   Current cycle count.
+ ******************************************************************************/
+static inline uint32_t HAL_DWT_GetCycles(void)
+{
+    return HAL_DWT_CYCCNT;
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_DWT_H_ */
@@ -0,0 +1,319 @@
+/*******************************************************************************
+ * @file    HAL_FLEXCAN.h
+ * @brief   Hardware abstraction layer for FlexCAN header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_FLEXCAN_H_
+#define HAL_FLEXCAN_H_
+
+#include <stdint.h>
+#include "device_registers.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Protocol engine clock: peripheral clock (CTRL1.CLKSRC = 1), SYS_CLK = FIRC 48 MHz. */
+#define HAL_FLEXCAN_CLOCK_HZ            (HAL_SCG_SYS_CLK_HZ)
+
+/* Message buffer control / status word */
+#define HAL_FLEXCAN_CS_EDL              (1UL << 31)     /**< Extended data length (FD frame) */
+#define HAL_FLEXCAN_CS_BRS              (1UL << 30)     /**< Bit rate switch                 */
+#define HAL_FLEXCAN_CS_ESI              (1UL << 29)     /**< Error state indicator           */
+#define HAL_FLEXCAN_CS_CODE_SHIFT       (24U)
+#define HAL_FLEXCAN_CS_CODE_MASK        (0x0F000000UL)
+#define HAL_FLEXCAN_CS_CODE(x)          (((uint32_t)(x) << HAL_FLEXCAN_CS_CODE_SHIFT) & HAL_FLEXCAN_CS_CODE_MASK)
+#define HAL_FLEXCAN_CS_SRR              (1UL << 22)     /**< Substitute remote request       */
+#define HAL_FLEXCAN_CS_IDE              (1UL << 21)     /**< Extended identifier             */
+#define HAL_FLEXCAN_CS_RTR              (1UL << 20)     /**< Remote frame                    */
+#define HAL_FLEXCAN_CS_DLC_SHIFT        (16U)
+#define HAL_FLEXCAN_CS_DLC_MASK         (0x000F0000UL)
+#define HAL_FLEXCAN_CS_DLC(x)           (((uint32_t)(x) << HAL_FLEXCAN_CS_DLC_SHIFT) & HAL_FLEXCAN_CS_DLC_MASK)
+
+/* Message buffer identifier word */
+#define HAL_FLEXCAN_ID_STD_SHIFT        (18U)
+#define HAL_FLEXCAN_ID_STD(x)           (((uint32_t)(x) & 0x7FFUL) << HAL_FLEXCAN_ID_STD_SHIFT)
+#define HAL_FLEXCAN_ID_EXT(x)           ((uint32_t)(x) & 0x1FFFFFFFUL)
+
+/* Message buffer codes */
+#define HAL_FLEXCAN_CODE_RX_INACTIVE    (0x0U)
+#define HAL_FLEXCAN_CODE_RX_FULL        (0x2U)
+#define HAL_FLEXCAN_CODE_RX_EMPTY       (0x4U)
+#define HAL_FLEXCAN_CODE_RX_OVERRUN     (0x6U)
+#define HAL_FLEXCAN_CODE_TX_INACTIVE    (0x8U)
+#define HAL_FLEXCAN_CODE_TX_ABORT       (0x9U)
+#define HAL_FLEXCAN_CODE_TX_DATA        (0xCU)
+
+/* Legacy RX FIFO: engine in MB0..5, output in MB0, ID filter table from MB6 */
+#define HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE   (1UL << 5)
+#define HAL_FLEXCAN_RXFIFO_FLAG_WARNING     (1UL << 6)
+#define HAL_FLEXCAN_RXFIFO_FLAG_OVERFLOW    (1UL << 7)
+
+/* RX FIFO ID filter element (format A) */
+#define HAL_FLEXCAN_FILTER_RTR          (1UL << 31)
+#define HAL_FLEXCAN_FILTER_IDE          (1UL << 30)
+#define HAL_FLEXCAN_FILTER_STD(x)       (((uint32_t)(x) & 0x7FFUL) << 19)
+#define HAL_FLEXCAN_FILTER_EXT(x)       (((uint32_t)(x) & 0x1FFFFFFFUL) << 1)
+
+/* Error and status (ESR1) */
+#define HAL_FLEXCAN_ESR_BOFF_INT        (FLEXCAN_ESR1_BOFFINT_MASK)
+#define HAL_FLEXCAN_ESR_BOFF_DONE_INT   (FLEXCAN_ESR1_BOFFDONEINT_MASK)
+#define HAL_FLEXCAN_ESR_RX_WARN_INT     (FLEXCAN_ESR1_RWRNINT_MASK)
+#define HAL_FLEXCAN_ESR_TX_WARN_INT     (FLEXCAN_ESR1_TWRNINT_MASK)
+#define HAL_FLEXCAN_ESR_ERR_INT         (FLEXCAN_ESR1_ERRINT_MASK)
+#define HAL_FLEXCAN_ESR_FLTCONF_SHIFT   (FLEXCAN_ESR1_FLTCONF_SHIFT)
+#define HAL_FLEXCAN_ESR_FLTCONF_MASK    (FLEXCAN_ESR1_FLTCONF_MASK)
+#define HAL_FLEXCAN_ESR_BIT_ERR         (FLEXCAN_ESR1_BIT0ERR_MASK | FLEXCAN_ESR1_BIT1ERR_MASK | \
+                                         FLEXCAN_ESR1_BIT0ERR_FAST_MASK | FLEXCAN_ESR1_BIT1ERR_FAST_MASK)
+#define HAL_FLEXCAN_ESR_STUFF_ERR       (FLEXCAN_ESR1_STFERR_MASK | FLEXCAN_ESR1_STFERR_FAST_MASK)
+#define HAL_FLEXCAN_ESR_CRC_ERR         (FLEXCAN_ESR1_CRCERR_MASK | FLEXCAN_ESR1_CRCERR_FAST_MASK)
+#define HAL_FLEXCAN_ESR_FORM_ERR        (FLEXCAN_ESR1_FRMERR_MASK | FLEXCAN_ESR1_FRMERR_FAST_MASK)
+#define HAL_FLEXCAN_ESR_ACK_ERR         (FLEXCAN_ESR1_ACKERR_MASK)
+
+typedef enum
+{
+    HAL_FLEXCAN_0 = 0U,
+    HAL_FLEXCAN_1,
+    HAL_FLEXCAN_2,
+    HAL_FLEXCAN_MAX
+} HAL_FLEXCAN_Instance_t;
+
+typedef enum
+{
+    HAL_FLEXCAN_MODE_NORMAL = 0U,       /**< Own frames are not received           */
+    HAL_FLEXCAN_MODE_SELF_RECEPTION,    /**< Own frames received from the bus      */
+    HAL_FLEXCAN_MODE_LISTEN_ONLY,       /**< No ACK, no error frames, no TX        */
+    HAL_FLEXCAN_MODE_LOOPBACK           /**< TX looped back internally, bus idle   */
+} HAL_FLEXCAN_Mode_t;
+
+/**
+ * @brief Bit timing, all segments in time quanta.
+ *
+ * Ranges are for the nominal (arbitration) phase; the FD data phase allows
+ * propSeg 0 ... 31, phaseSeg1 1 ... 8, phaseSeg2 2 ... 8 and sjw 1 ... 8.
+ */
+typedef struct
+{
+    uint16_t preDivider;    /**< 1 ... 1024                    */
+    uint8_t  propSeg;       /**< 1 ... 64                      */
+    uint8_t  phaseSeg1;     /**< 1 ... 32                      */
+    uint8_t  phaseSeg2;     /**< 2 ... 32                      */
+    uint8_t  sjw;           /**< 1 ... 32, at most phaseSeg2   */
+} HAL_FLEXCAN_Timing_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock, enable and soft-reset a FlexCAN instance.
+ *
+ * All message buffers are cleared, individual masks are set to exact match
+ * and the module is left in freeze mode.
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+void HAL_FLEXCAN_Init(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Disable the module and gate its clock.
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+void HAL_FLEXCAN_Deinit(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Number of message buffers available with the current payload size.
+ *
+ * MB RAM is fixed, so larger FD payloads leave fewer message buffers: 32 /
+ * 21 / 12 / 7 on FlexCAN0 for 8 / 16 / 32 / 64 bytes.
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+uint8_t HAL_FLEXCAN_GetMbCount(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Check whether an instance supports CAN FD (FlexCAN0 only).
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+uint8_t HAL_FLEXCAN_HasFd(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enable ISO CAN FD with a message buffer payload size, or return to
+ *          classic CAN.
+ *
+ * All message buffers share one payload size (MBDSR0). The RX FIFO cannot
+ * be used in FD mode and is disabled; MB RAM is cleared and MAXMB follows
+ * the new message buffer count. Module must be frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   payload     8, 16, 32 or 64 bytes, 0 = classic CAN.
+ ******************************************************************************/
+void HAL_FLEXCAN_ConfigureFd(HAL_FLEXCAN_Instance_t instance, uint8_t payload);
+
+/*******************************************************************************
+ * @brief   Payload size of every message buffer in bytes (8 in classic mode).
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+uint8_t HAL_FLEXCAN_GetPayloadSize(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enter / leave freeze mode. Configuration registers, the RX FIFO
+ *          filter table and the masks are only writable while frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+void HAL_FLEXCAN_EnterFreeze(HAL_FLEXCAN_Instance_t instance);
+void HAL_FLEXCAN_ExitFreeze(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program the nominal bit timing (CBT). Module must be frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   timing      Bit timing.
+ ******************************************************************************/
+void HAL_FLEXCAN_SetTiming(HAL_FLEXCAN_Instance_t instance, const HAL_FLEXCAN_Timing_t *timing);
+
+/*******************************************************************************
+ * @brief   Program the FD data phase bit timing (FDCBT) and enable bit rate
+ *          switching. Module must be frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   timing      Data phase bit timing.
+ ******************************************************************************/
+void HAL_FLEXCAN_SetDataTiming(HAL_FLEXCAN_Instance_t instance, const HAL_FLEXCAN_Timing_t *timing);
+
+/*******************************************************************************
+ * @brief   Transceiver delay compensation: the secondary sample point is the
+ *          measured loop delay plus an offset. Module must be frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   offset      Offset in protocol engine clocks (1 ... 31), 0 = off.
+ ******************************************************************************/
+void HAL_FLEXCAN_SetTdc(HAL_FLEXCAN_Instance_t instance, uint8_t offset);
+
+/*******************************************************************************
+ * @brief   Select the operating mode. Module must be frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   mode        Operating mode.
+ ******************************************************************************/
+void HAL_FLEXCAN_SetMode(HAL_FLEXCAN_Instance_t instance, HAL_FLEXCAN_Mode_t mode);
+
+/*******************************************************************************
+ * @brief   Enable the legacy RX FIFO with a format A filter table.
+ *
+ * The table holds 8 * (rffn + 1) elements; the first 8 + 2 * rffn are
+ * masked by RXIMR, the others by the RX FIFO global mask. Module must be
+ * frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   rffn        CTRL2.RFFN value.
+ ******************************************************************************/
+void HAL_FLEXCAN_EnableRxFifo(HAL_FLEXCAN_Instance_t instance, uint8_t rffn);
+
+/*******************************************************************************
+ * @brief   Write one RX FIFO filter element (HAL_FLEXCAN_FILTER_xxx).
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   index       Filter element index.
+ * @param   element     Filter element.
+ ******************************************************************************/
+void HAL_FLEXCAN_SetRxFifoFilter(HAL_FLEXCAN_Instance_t instance, uint8_t index, uint32_t element);
+
+/*******************************************************************************
+ * @brief   Program an individual mask (RXIMR), the RX FIFO global mask or the
+ *          mailbox global mask. Module must be frozen.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   index       Message buffer / filter element index.
+ * @param   mask        1 = bit must match.
+ ******************************************************************************/
+void HAL_FLEXCAN_SetIndividualMask(HAL_FLEXCAN_Instance_t instance, uint8_t index, uint32_t mask);
+void HAL_FLEXCAN_SetRxFifoGlobalMask(HAL_FLEXCAN_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Address of a message buffer in MB RAM.
+ *
+ * Word 0 is the control / status word, word 1 the identifier, the payload
+ * follows big-endian (byte 0 in bits 31..24 of word 2). The stride follows
+ * the payload size.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   mb          Message buffer index.
+ ******************************************************************************/
+volatile uint32_t *HAL_FLEXCAN_GetMb(HAL_FLEXCAN_Instance_t instance, uint8_t mb);
+
+/*******************************************************************************
+ * @brief   Release the message buffer locked by reading its CS word.
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+void HAL_FLEXCAN_UnlockMb(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enable / disable the interrupt of one message buffer.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   mb          Message buffer index.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_FLEXCAN_EnableMbInterrupt(HAL_FLEXCAN_Instance_t instance, uint8_t mb, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Pending message buffer flags that are also enabled (IFLAG1 & IMASK1).
+ *
+ * @param   instance    FlexCAN instance.
+ ******************************************************************************/
+uint32_t HAL_FLEXCAN_GetMbFlags(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Raw message buffer flags / clear flags (write 1 to clear).
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   mask        Flags to clear.
+ ******************************************************************************/
+uint32_t HAL_FLEXCAN_GetRawMbFlags(HAL_FLEXCAN_Instance_t instance);
+void HAL_FLEXCAN_ClearMbFlags(HAL_FLEXCAN_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Enable / disable bus-off, bus-off done and warning interrupts.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_FLEXCAN_EnableStateInterrupts(HAL_FLEXCAN_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Read ESR1 (error bits clear on read) / clear interrupt flags.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   mask        HAL_FLEXCAN_ESR_xxx_INT flags to clear.
+ ******************************************************************************/
+uint32_t HAL_FLEXCAN_GetErrorStatus(HAL_FLEXCAN_Instance_t instance);
+void HAL_FLEXCAN_ClearErrorStatus(HAL_FLEXCAN_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Transmit / receive error counters.
+ *
+ * @param   instance    FlexCAN instance.
+ * @param   txErrors    Transmit error counter.
+ * @param   rxErrors    Receive error counter.
+ ******************************************************************************/
+void HAL_FLEXCAN_GetErrorCounters(HAL_FLEXCAN_Instance_t instance, uint8_t *txErrors, uint8_t *rxErrors);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_FLEXCAN_H_ */
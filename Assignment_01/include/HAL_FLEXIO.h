@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * @file    HAL_FLEXIO.h
+ * @brief   Hardware abstraction layer for FlexIO header file.
+ *
+ * FlexIO has 4 shifters, 4 timers and 8 pins (FXIO_D0 ... D7) shared by
+ * all the protocols built on it; each driver allocates the shifters and
+ * timers it uses, like the DMA channels.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_FLEXIO_H_
+#define HAL_FLEXIO_H_
+
+#include <stdint.h>
+#include "device_registers.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Functional clock: FIRCDIV2 (48 MHz FIRC divided by 1). */
+#define HAL_FLEXIO_CLOCK_HZ         (HAL_SCG_FIRCDIV2_HZ)
+
+#define HAL_FLEXIO_SHIFTER_COUNT    (4U)
+#define HAL_FLEXIO_TIMER_COUNT      (4U)
+#define HAL_FLEXIO_PIN_COUNT        (8U)
+#define HAL_FLEXIO_INVALID          (0xFFU)     /**< No shifter / timer free */
+
+/* Shifter mode (SMOD) */
+#define HAL_FLEXIO_SHIFTER_DISABLED (0U)
+#define HAL_FLEXIO_SHIFTER_RECEIVE  (1U)
+#define HAL_FLEXIO_SHIFTER_TRANSMIT (2U)
+
+/* Shifter start / stop bit (SSTART, SSTOP) */
+#define HAL_FLEXIO_START_NONE       (0U)        /**< Load on the first shift        */
+#define HAL_FLEXIO_START_NONE_LATE  (1U)        /**< Load on the first shift edge, output on the second (SPI CPHA = 1) */
+#define HAL_FLEXIO_START_LOW        (2U)
+#define HAL_FLEXIO_START_HIGH       (3U)
+#define HAL_FLEXIO_STOP_NONE        (0U)
+#define HAL_FLEXIO_STOP_COMPARE     (1U)        /**< Receive: store on timer compare */
+#define HAL_FLEXIO_STOP_LOW         (2U)
+#define HAL_FLEXIO_STOP_HIGH        (3U)
+
+/* Pin configuration (PINCFG) */
+#define HAL_FLEXIO_PIN_INPUT        (0U)        /**< Output disabled */
+#define HAL_FLEXIO_PIN_OPEN_DRAIN   (1U)
+#define HAL_FLEXIO_PIN_BIDIR        (2U)        /**< Data on this pin, enable on pin - 1 */
+#define HAL_FLEXIO_PIN_OUTPUT       (3U)
+
+/* Timer mode (TIMOD) */
+#define HAL_FLEXIO_TIMER_DISABLED   (0U)
+#define HAL_FLEXIO_TIMER_BAUD       (1U)        /**< Dual 8-bit: low byte divider, high byte bit count */
+#define HAL_FLEXIO_TIMER_PWM        (2U)        /**< Dual 8-bit: low byte high time, high byte low time */
+#define HAL_FLEXIO_TIMER_COUNTER    (3U)        /**< Single 16-bit counter */
+
+/* Timer trigger (TRGSEL, internal source) */
+#define HAL_FLEXIO_TRIGGER_PIN(n)       ((uint8_t)(2U * (n)))
+#define HAL_FLEXIO_TRIGGER_SHIFTER(n)   ((uint8_t)((4U * (n)) + 1U))   /**< Shifter status flag */
+#define HAL_FLEXIO_TRIGGER_TIMER(n)     ((uint8_t)((4U * (n)) + 3U))   /**< Timer trigger output */
+
+/* Timer output (TIMOUT) */
+#define HAL_FLEXIO_TIMOUT_ONE           (0U)    /**< High when enabled, not on reset */
+#define HAL_FLEXIO_TIMOUT_ZERO          (1U)
+#define HAL_FLEXIO_TIMOUT_ONE_RESET     (2U)    /**< High when enabled and on reset  */
+#define HAL_FLEXIO_TIMOUT_ZERO_RESET    (3U)
+
+/* Timer decrement (TIMDEC) */
+#define HAL_FLEXIO_TIMDEC_CLOCK         (0U)    /**< FlexIO clock, shift on timer output  */
+#define HAL_FLEXIO_TIMDEC_TRIGGER       (1U)    /**< Trigger edges, shift on timer output */
+#define HAL_FLEXIO_TIMDEC_PIN           (2U)    /**< Pin edges, shift on pin input        */
+#define HAL_FLEXIO_TIMDEC_TRIGGER_SHIFT (3U)    /**< Trigger edges, shift on trigger      */
+
+/* Timer reset (TIMRST) */
+#define HAL_FLEXIO_TIMRST_NEVER         (0U)
+#define HAL_FLEXIO_TIMRST_PIN_OUTPUT    (2U)    /**< Pin equal to timer output     */
+#define HAL_FLEXIO_TIMRST_TRIGGER_OUTPUT (3U)   /**< Trigger equal to timer output */
+#define HAL_FLEXIO_TIMRST_PIN_RISING    (4U)
+#define HAL_FLEXIO_TIMRST_TRIGGER_RISING (6U)
+#define HAL_FLEXIO_TIMRST_TRIGGER_BOTH  (7U)
+
+/* Timer disable (TIMDIS) */
+#define HAL_FLEXIO_TIMDIS_NEVER         (0U)
+#define HAL_FLEXIO_TIMDIS_PREVIOUS      (1U)    /**< Timer n - 1 disabled            */
+#define HAL_FLEXIO_TIMDIS_COMPARE       (2U)
+#define HAL_FLEXIO_TIMDIS_COMPARE_TRIGGER_LOW (3U)
+#define HAL_FLEXIO_TIMDIS_PIN_BOTH      (4U)
+#define HAL_FLEXIO_TIMDIS_TRIGGER_FALLING (6U)
+
+/* Timer enable (TIMENA) */
+#define HAL_FLEXIO_TIMENA_ALWAYS        (0U)
+#define HAL_FLEXIO_TIMENA_PREVIOUS      (1U)    /**< Timer n - 1 enabled             */
+#define HAL_FLEXIO_TIMENA_TRIGGER_HIGH  (2U)
+#define HAL_FLEXIO_TIMENA_TRIGGER_PIN_HIGH (3U)
+#define HAL_FLEXIO_TIMENA_PIN_RISING    (4U)
+#define HAL_FLEXIO_TIMENA_TRIGGER_RISING (6U)
+
+/* Timer stop bit (TSTOP) */
+#define HAL_FLEXIO_TSTOP_NONE           (0U)
+#define HAL_FLEXIO_TSTOP_COMPARE        (1U)
+#define HAL_FLEXIO_TSTOP_DISABLE        (2U)
+#define HAL_FLEXIO_TSTOP_BOTH           (3U)
+
+/* Shifter buffer views, HAL_FLEXIO_GetBufferAddress() */
+#define HAL_FLEXIO_BUFFER_NORMAL        (0U)    /**< Bit 0 shifted first                 */
+#define HAL_FLEXIO_BUFFER_BIT_SWAP      (1U)    /**< Bit 31 shifted first                */
+#define HAL_FLEXIO_BUFFER_BYTE_SWAP     (2U)
+#define HAL_FLEXIO_BUFFER_BIT_BYTE_SWAP (3U)    /**< Byte 0 first, each byte MSB first   */
+
+/* Callback status */
+#define HAL_FLEXIO_STATUS_SHIFTER       (1UL << 0)  /**< Buffer empty (transmit) / full (receive) */
+#define HAL_FLEXIO_STATUS_ERROR         (1UL << 1)  /**< Underrun / overrun or start-stop bit error */
+
+/**
+ * @brief Shifter setup.
+ */
+typedef struct
+{
+    uint8_t     mode;           /**< HAL_FLEXIO_SHIFTER_xxx                         */
+    uint8_t     timer;          /**< Timer clocking the shifter                     */
+    uint8_t     timerFalling;   /**< 1 shift on the falling edge of the timer output */
+    uint8_t     pin;            /**< FXIO_Dn                                        */
+    uint8_t     pinConfig;      /**< HAL_FLEXIO_PIN_xxx                             */
+    uint8_t     pinInvert;
+    uint8_t     startBit;       /**< HAL_FLEXIO_START_xxx                           */
+    uint8_t     stopBit;        /**< HAL_FLEXIO_STOP_xxx                            */
+} HAL_FLEXIO_Shifter_t;
+
+/**
+ * @brief Timer setup.
+ */
+typedef struct
+{
+    uint8_t     mode;           /**< HAL_FLEXIO_TIMER_xxx                            */
+    uint8_t     trigger;        /**< HAL_FLEXIO_TRIGGER_xxx()                        */
+    uint8_t     triggerLow;     /**< 1 trigger active low                            */
+    uint8_t     pin;            /**< FXIO_Dn                                         */
+    uint8_t     pinConfig;      /**< HAL_FLEXIO_PIN_xxx                              */
+    uint8_t     pinInvert;
+    uint8_t     output;         /**< HAL_FLEXIO_TIMOUT_xxx                           */
+    uint8_t     decrement;      /**< HAL_FLEXIO_TIMDEC_xxx                           */
+    uint8_t     reset;          /**< HAL_FLEXIO_TIMRST_xxx                           */
+    uint8_t     disable;        /**< HAL_FLEXIO_TIMDIS_xxx                           */
+    uint8_t     enable;         /**< HAL_FLEXIO_TIMENA_xxx                           */
+    uint8_t     stopBit;        /**< HAL_FLEXIO_TSTOP_xxx                            */
+    uint8_t     startBit;       /**< 1 start bit when enabled                        */
+    uint16_t    compare;        /**< TIMCMP                                          */
+} HAL_FLEXIO_Timer_t;
+
+/**
+ * @brief Shifter interrupt callback.
+ *
+ * @param shifter   Shifter the callback was registered for.
+ * @param status    HAL_FLEXIO_STATUS_xxx bits, enabled ones only; the
+ *                  error flag is already cleared, the shifter flag is
+ *                  cleared by accessing the buffer.
+ * @param param     User pointer given to HAL_FLEXIO_RegisterCallback().
+ */
+typedef void (*HAL_FLEXIO_Callback_t)(uint8_t shifter, uint32_t status, void *param);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock and enable FlexIO, once; later calls do nothing.
+ ******************************************************************************/
+void HAL_FLEXIO_Init(void);
+
+/*******************************************************************************
+ * @brief   Reserve / release a shifter or a timer.
+ *
+ * @return  Index, HAL_FLEXIO_INVALID when none is free.
+ ******************************************************************************/
+uint8_t HAL_FLEXIO_AllocShifter(void);
+void HAL_FLEXIO_FreeShifter(uint8_t shifter);
+uint8_t HAL_FLEXIO_AllocTimer(void);
+void HAL_FLEXIO_FreeTimer(uint8_t timer);
+
+/*******************************************************************************
+ * @brief   Program a shifter / timer; a disabled mode stops it.
+ ******************************************************************************/
+void HAL_FLEXIO_SetShifter(uint8_t shifter, const HAL_FLEXIO_Shifter_t *config);
+void HAL_FLEXIO_SetTimer(uint8_t timer, const HAL_FLEXIO_Timer_t *config);
+
+/*******************************************************************************
+ * @brief   Shifter buffer access.
+ *
+ * @param   view        HAL_FLEXIO_BUFFER_xxx.
+ ******************************************************************************/
+void HAL_FLEXIO_WriteBuffer(uint8_t shifter, uint8_t view, uint32_t data);
+uint32_t HAL_FLEXIO_ReadBuffer(uint8_t shifter, uint8_t view);
+
+/*******************************************************************************
+ * @brief   Address of a shifter buffer view, for DMA.
+ *
+ * @return  Address, 0 for an invalid parameter.
+ ******************************************************************************/
+uint32_t HAL_FLEXIO_GetBufferAddress(uint8_t shifter, uint8_t view);
+
+/*******************************************************************************
+ * @brief   Shifter status flag: transmit buffer empty / receive buffer full.
+ ******************************************************************************/
+uint8_t HAL_FLEXIO_IsShifterReady(uint8_t shifter);
+
+/*******************************************************************************
+ * @brief   Shifter error flag, cleared by the read.
+ ******************************************************************************/
+uint8_t HAL_FLEXIO_TakeShifterError(uint8_t shifter);
+
+/*******************************************************************************
+ * @brief   Timer status flag (compare), cleared by the read.
+ ******************************************************************************/
+uint8_t HAL_FLEXIO_TakeTimerStatus(uint8_t timer);
+
+/*******************************************************************************
+ * @brief   Shifter status flag raises a DMA request (SHIFTSDEN).
+ ******************************************************************************/
+void HAL_FLEXIO_EnableDma(uint8_t shifter, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   DMA request source of a shifter.
+ ******************************************************************************/
+dma_request_source_t HAL_FLEXIO_GetDmaRequest(uint8_t shifter);
+
+/*******************************************************************************
+ * @brief   Shifter status / error interrupts on / off.
+ *
+ * @param   status      HAL_FLEXIO_STATUS_xxx mask to enable, others off.
+ ******************************************************************************/
+void HAL_FLEXIO_EnableIrq(uint8_t shifter, uint32_t status);
+
+/*******************************************************************************
+ * @brief   Register the interrupt callback of a shifter.
+ *
+ * The FlexIO interrupt line is enabled in the NVIC while one shifter has
+ * a callback.
+ ******************************************************************************/
+void HAL_FLEXIO_RegisterCallback(uint8_t shifter, HAL_FLEXIO_Callback_t callback, void *param);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_FLEXIO_H_ */
@@ -0,0 +1,164 @@
+/*******************************************************************************
+ * @file    HAL_FTFC.h
+ * @brief   Hardware abstraction layer for the FTFC flash controller header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_FTFC_H_
+#define HAL_FTFC_H_
+
+#include <stdint.h>
+#include "device_registers.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Memory map (system addresses) */
+#define HAL_FTFC_PFLASH_BASE        (0x00000000UL)
+#define HAL_FTFC_PFLASH_SIZE        (0x00080000UL)      /**< 512 KB */
+#define HAL_FTFC_PFLASH_SECTOR      (4096UL)
+#define HAL_FTFC_DFLASH_BASE        (0x10000000UL)
+#define HAL_FTFC_DFLASH_SIZE        (0x00010000UL)      /**< 64 KB FlexNVM, unpartitioned */
+#define HAL_FTFC_DFLASH_SECTOR      (2048UL)
+#define HAL_FTFC_FLEXRAM_BASE       (0x14000000UL)
+#define HAL_FTFC_FLEXRAM_SIZE       (0x00001000UL)      /**< 4 KB */
+#define HAL_FTFC_PHRASE_SIZE        (8U)                /**< Program unit */
+
+/* Flash commands (FCCOB0) */
+#define HAL_FTFC_CMD_PROGRAM_PHRASE     (0x07U)
+#define HAL_FTFC_CMD_ERASE_BLOCK        (0x08U)
+#define HAL_FTFC_CMD_ERASE_SECTOR       (0x09U)
+#define HAL_FTFC_CMD_PROGRAM_PARTITION  (0x80U)
+#define HAL_FTFC_CMD_SET_FLEXRAM        (0x81U)
+
+/* Set FlexRAM function (FCCOB1) */
+#define HAL_FTFC_FLEXRAM_EEE            (0x00U)     /**< Emulated EEPROM */
+#define HAL_FTFC_FLEXRAM_RAM            (0xFFU)     /**< Traditional RAM */
+
+/* Command errors (FSTAT) */
+#define HAL_FTFC_ERROR_ACCESS       (FTFC_FSTAT_ACCERR_MASK)    /**< Illegal command or address */
+#define HAL_FTFC_ERROR_PROTECTION   (FTFC_FSTAT_FPVIOL_MASK)    /**< Protected region */
+#define HAL_FTFC_ERROR_VERIFY       (FTFC_FSTAT_MGSTAT0_MASK)   /**< Erase / program verify failed */
+#define HAL_FTFC_ERROR_COLLISION    (FTFC_FSTAT_RDCOLERR_MASK)  /**< Read of a block being modified */
+#define HAL_FTFC_ERROR_MASK         (HAL_FTFC_ERROR_ACCESS | HAL_FTFC_ERROR_PROTECTION | \
+                                     HAL_FTFC_ERROR_VERIFY | HAL_FTFC_ERROR_COLLISION)
+
+/**
+ * @brief Command complete callback, called from the FTFC interrupt.
+ *
+ * @param param     User pointer given to HAL_FTFC_Acquire().
+ */
+typedef void (*HAL_FTFC_Callback_t)(void *param);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Enable the command complete interrupt vector.
+ *
+ * Safe to call from every user of the FTFC, only the first call has
+ * an effect.
+ ******************************************************************************/
+void HAL_FTFC_Init(void);
+
+/*******************************************************************************
+ * @brief   Reserve the command engine for a sequence of commands.
+ *
+ * The P-Flash / D-Flash driver and the EEPROM emulation share one engine:
+ * the owner gets the command complete interrupt until it releases it.
+ *
+ * @param   callback    Called on command completion (CCIE enabled).
+ * @param   param       User pointer passed to the callback.
+ *
+ * @return  1 reserved, 0 engine owned by another user.
+ ******************************************************************************/
+uint8_t HAL_FTFC_Acquire(HAL_FTFC_Callback_t callback, void *param);
+void HAL_FTFC_Release(void);
+
+/*******************************************************************************
+ * @brief   Whether the command engine is idle (FSTAT.CCIF).
+ *
+ * @return  1 idle, 0 command running.
+ ******************************************************************************/
+uint8_t HAL_FTFC_IsReady(void);
+
+/*******************************************************************************
+ * @brief   Errors of the last command / clear them before the next one.
+ *
+ * @return  HAL_FTFC_ERROR_xxx mask.
+ ******************************************************************************/
+uint8_t HAL_FTFC_GetErrors(void);
+void HAL_FTFC_ClearErrors(void);
+
+/*******************************************************************************
+ * @brief   Whether a system address belongs to the FlexNVM (D-Flash) block.
+ ******************************************************************************/
+uint8_t HAL_FTFC_IsDFlash(uint32_t address);
+
+/*******************************************************************************
+ * @brief   FlexNVM partition (SIM_FCFG1): D-Flash bytes and EEPROM bytes.
+ ******************************************************************************/
+uint32_t HAL_FTFC_GetDFlashSize(void);
+uint32_t HAL_FTFC_GetEeeSize(void);
+
+/*******************************************************************************
+ * @brief   Whether FlexRAM is available as emulated EEPROM (FCNFG.EEERDY).
+ ******************************************************************************/
+uint8_t HAL_FTFC_IsEeeReady(void);
+
+/*******************************************************************************
+ * @brief   Load the command code and the flash address (FCCOB0..3).
+ *
+ * @param   command     HAL_FTFC_CMD_xxx.
+ * @param   address     System address, translated to the FTFC address space
+ *                      (FlexNVM at 0x800000).
+ ******************************************************************************/
+void HAL_FTFC_SetCommand(uint8_t command, uint32_t address);
+
+/*******************************************************************************
+ * @brief   Load command parameter FCCOBn (n = 4 ... 11).
+ ******************************************************************************/
+void HAL_FTFC_SetParam(uint8_t index, uint8_t value);
+
+/*******************************************************************************
+ * @brief   Load the 8 bytes of a program phrase command in memory order.
+ ******************************************************************************/
+void HAL_FTFC_SetPhrase(const uint8_t *data);
+
+/*******************************************************************************
+ * @brief   Launch the loaded command.
+ *
+ * Runs from RAM (.code_ram). With wait = 1 it returns once the command is
+ * complete, which is mandatory for P-Flash commands: the P-Flash block
+ * cannot be read while it is erased or programmed, so the caller must also
+ * keep interrupts disabled until this returns.
+ *
+ * @param   wait        1 = busy wait in RAM for completion.
+ ******************************************************************************/
+START_FUNCTION_DECLARATION_RAMSECTION
+void HAL_FTFC_Launch(uint8_t wait)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/*******************************************************************************
+ * @brief   Enable / disable the command complete interrupt (FCNFG.CCIE).
+ ******************************************************************************/
+void HAL_FTFC_EnableCompleteInterrupt(uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Invalidate the code cache after flash contents changed.
+ ******************************************************************************/
+void HAL_FTFC_InvalidateCache(void);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_FTFC_H_ */
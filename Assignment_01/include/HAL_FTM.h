@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * @file    HAL_FTM.h
+ * @brief   Hardware abstraction layer for the FlexTimer module header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_FTM_H_
+#define HAL_FTM_H_
+
+#include <stdint.h>
+#include "device_registers.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Counter clock: FTM input clock = SYS_CLK (48 MHz in FIRC run mode),
+ * divided by 2^prescaler. */
+#define HAL_FTM_CLOCK_HZ            (HAL_SCG_SYS_CLK_HZ)
+
+#define HAL_FTM_CHANNEL_COUNT       (8U)
+#define HAL_FTM_PRESCALER_MAX       (7U)
+#define HAL_FTM_FILTER_CHANNELS     (4U)        /**< Input filter on channels 0 ... 3 */
+
+/* Channel mode (CnSC MSB:MSA:ELSB:ELSA) */
+#define HAL_FTM_CH_DISABLED         (0U)
+#define HAL_FTM_CH_CAPTURE_RISING   (FTM_CnSC_ELSA_MASK)
+#define HAL_FTM_CH_CAPTURE_FALLING  (FTM_CnSC_ELSB_MASK)
+#define HAL_FTM_CH_CAPTURE_BOTH     (FTM_CnSC_ELSA_MASK | FTM_CnSC_ELSB_MASK)
+#define HAL_FTM_CH_DUAL_CONTINUOUS  (FTM_CnSC_MSA_MASK)         /**< With a capture edge, dual edge pairs only */
+#define HAL_FTM_CH_PWM_HIGH         (FTM_CnSC_MSB_MASK | FTM_CnSC_ELSB_MASK)    /**< High during CnV ticks */
+#define HAL_FTM_CH_PWM_LOW          (FTM_CnSC_MSB_MASK | FTM_CnSC_ELSA_MASK)    /**< Low during CnV ticks  */
+
+/* Channel request, or-ed with the mode */
+#define HAL_FTM_CH_IRQ              (FTM_CnSC_CHIE_MASK)
+#define HAL_FTM_CH_DMA              (FTM_CnSC_CHIE_MASK | FTM_CnSC_DMA_MASK)  /**< Flag raises a DMA request instead */
+
+/* Channel pair function (COMBINE), HAL_FTM_SetPair() */
+#define HAL_FTM_PAIR_COMPLEMENTARY  (FTM_COMBINE_COMP0_MASK)    /**< Channel 2 pair + 1 = inverse of 2 pair */
+#define HAL_FTM_PAIR_DEADTIME       (FTM_COMBINE_DTEN0_MASK)
+#define HAL_FTM_PAIR_SYNC           (FTM_COMBINE_SYNCEN0_MASK)  /**< CnV of the pair loaded at reload points */
+
+/* Quadrature decoder (QDCTRL), HAL_FTM_SetQuadrature() */
+#define HAL_FTM_QUAD_ENABLE         (FTM_QDCTRL_QUADEN_MASK)    /**< Phase A / B on the channel 0 / 1 inputs */
+#define HAL_FTM_QUAD_COUNT_DIR      (FTM_QDCTRL_QUADMODE_MASK)  /**< A counts, B direction; default phase mode */
+#define HAL_FTM_QUAD_INVERT_A       (FTM_QDCTRL_PHAPOL_MASK)
+#define HAL_FTM_QUAD_INVERT_B       (FTM_QDCTRL_PHBPOL_MASK)
+#define HAL_FTM_QUAD_FILTER         (FTM_QDCTRL_PHAFLTREN_MASK | FTM_QDCTRL_PHBFLTREN_MASK)  /**< Channel 0 / 1 filter values */
+
+/* Callback status */
+#define HAL_FTM_STATUS_CHANNEL(n)   (1UL << (n))
+#define HAL_FTM_STATUS_OVERFLOW     (1UL << 8)
+#define HAL_FTM_STATUS_RELOAD       (1UL << 9)
+
+typedef enum
+{
+    HAL_FTM_0 = 0U,
+    HAL_FTM_1,
+    HAL_FTM_2,
+    HAL_FTM_3,
+    HAL_FTM_MAX
+} HAL_FTM_Instance_t;
+
+/**
+ * @brief Interrupt callback, one call per interrupt with every pending
+ *        event, so that an overflow and a capture can be ordered.
+ *
+ * @param instance  FTM instance.
+ * @param status    HAL_FTM_STATUS_xxx bits; channels with HAL_FTM_CH_IRQ only.
+ * @param param     User pointer given to HAL_FTM_RegisterCallback().
+ */
+typedef void (*HAL_FTM_Callback_t)(HAL_FTM_Instance_t instance, uint32_t status, void *param);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock an FTM instance and program the counter, stopped.
+ *
+ * Enhanced mode (FTMEN), counter from 0 to modulo, all channels disabled.
+ *
+ * @param   instance    FTM instance.
+ * @param   prescaler   Counter clock = HAL_FTM_CLOCK_HZ >> prescaler, 0 ... 7.
+ * @param   modulo      Last counter value (MOD).
+ ******************************************************************************/
+void HAL_FTM_Init(HAL_FTM_Instance_t instance, uint8_t prescaler, uint16_t modulo);
+
+/*******************************************************************************
+ * @brief   Start / stop the counter clock.
+ ******************************************************************************/
+void HAL_FTM_Start(HAL_FTM_Instance_t instance);
+void HAL_FTM_Stop(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Up-down counting: center-aligned PWM, period = 2 x modulo.
+ *          Counter must be stopped.
+ ******************************************************************************/
+void HAL_FTM_SetCenterAligned(HAL_FTM_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Modulo programmed by HAL_FTM_Init().
+ ******************************************************************************/
+uint16_t HAL_FTM_GetModulo(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Channel mode and request.
+ *
+ * @param   channel     0 ... 7.
+ * @param   mode        HAL_FTM_CH_xxx mode | request bits.
+ ******************************************************************************/
+void HAL_FTM_SetChannel(HAL_FTM_Instance_t instance, uint8_t channel, uint32_t mode);
+
+/*******************************************************************************
+ * @brief   Dual edge capture on channel pair (2 pair, 2 pair + 1).
+ *
+ * Channel 2 pair captures the first edge, channel 2 pair + 1 the second;
+ * the capture starts when enabled (DECAP set).
+ *
+ * @param   pair        0 ... 3.
+ * @param   enable      1 capture, 0 pair back to independent channels.
+ ******************************************************************************/
+void HAL_FTM_SetDualEdge(HAL_FTM_Instance_t instance, uint8_t pair, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   PWM function of channel pair (2 pair, 2 pair + 1).
+ *
+ * @param   pair        0 ... 3.
+ * @param   flags       HAL_FTM_PAIR_xxx, replaces the previous ones.
+ ******************************************************************************/
+void HAL_FTM_SetPair(HAL_FTM_Instance_t instance, uint8_t pair, uint32_t flags);
+
+/*******************************************************************************
+ * @brief   Dead time inserted by pairs with HAL_FTM_PAIR_DEADTIME.
+ *
+ * @param   ticks       FTM input clock ticks (HAL_FTM_CLOCK_HZ), not
+ *                      prescaled; rounded up to the dead time prescaler.
+ * @return  Ticks programmed, at most 16 x 1023.
+ ******************************************************************************/
+uint32_t HAL_FTM_SetDeadtime(HAL_FTM_Instance_t instance, uint32_t ticks);
+
+/*******************************************************************************
+ * @brief   Drive the pins of the channels in mask (SC.PWMENn); the others
+ *          keep their function but leave the pin alone.
+ ******************************************************************************/
+void HAL_FTM_EnableOutputs(HAL_FTM_Instance_t instance, uint8_t mask);
+
+/*******************************************************************************
+ * @brief   Enhanced synchronization with reload points.
+ *
+ * Buffered MOD and CnV are loaded at the selected counter boundaries
+ * while loading is enabled (HAL_FTM_SetLoadEnable()), or on a software
+ * synchronization (HAL_FTM_SoftwareSync()).
+ *
+ * @param   atMax       Reload when the counter reaches MOD.
+ * @param   atMin       Reload when the counter reaches CNTIN.
+ ******************************************************************************/
+void HAL_FTM_SetSync(HAL_FTM_Instance_t instance, uint8_t atMax, uint8_t atMin);
+
+/*******************************************************************************
+ * @brief   PWMLOAD.LDOK: load the buffers at every reload point (1) or
+ *          hold them (0) while several are written.
+ ******************************************************************************/
+void HAL_FTM_SetLoadEnable(HAL_FTM_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Software trigger: load the buffers at the next reload point
+ *          once, even with loading disabled.
+ ******************************************************************************/
+void HAL_FTM_SoftwareSync(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Quadrature decoder mode: the counter follows the phase inputs
+ *          (FTM1 and FTM2 only).
+ *
+ * @param   flags       HAL_FTM_QUAD_xxx, 0 back to counting the clock.
+ ******************************************************************************/
+void HAL_FTM_SetQuadrature(HAL_FTM_Instance_t instance, uint32_t flags);
+
+/*******************************************************************************
+ * @brief   Input glitch filter: pulses shorter than 4 x value counter
+ *          input clocks are ignored.
+ *
+ * @param   channel     0 ... 3.
+ * @param   value       0 (off) ... 15.
+ ******************************************************************************/
+void HAL_FTM_SetInputFilter(HAL_FTM_Instance_t instance, uint8_t channel, uint8_t value);
+
+/*******************************************************************************
+ * @brief   Channel value (captured counter or compare value).
+ ******************************************************************************/
+uint16_t HAL_FTM_GetValue(HAL_FTM_Instance_t instance, uint8_t channel);
+void HAL_FTM_SetValue(HAL_FTM_Instance_t instance, uint8_t channel, uint16_t value);
+
+/*******************************************************************************
+ * @brief   Address of CnV, for DMA. Channel values are 8 bytes apart.
+ *
+ * @return  Address, 0 for an invalid parameter.
+ ******************************************************************************/
+uint32_t HAL_FTM_GetValueAddress(HAL_FTM_Instance_t instance, uint8_t channel);
+
+/*******************************************************************************
+ * @brief   Current counter value.
+ ******************************************************************************/
+uint16_t HAL_FTM_GetCounter(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Address of CNT, for reads in a single access.
+ *
+ * @return  Address, 0 for an invalid instance.
+ ******************************************************************************/
+uint32_t HAL_FTM_GetCounterAddress(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   DMA request source of a channel.
+ *
+ * FTM1 and FTM2 have one request per channel; FTM0 and FTM3 have one
+ * request for all channels, so only one of their channels may use DMA.
+ ******************************************************************************/
+dma_request_source_t HAL_FTM_GetDmaRequest(HAL_FTM_Instance_t instance, uint8_t channel);
+
+/*******************************************************************************
+ * @brief   Counter overflow interrupt (HAL_FTM_STATUS_OVERFLOW) on / off.
+ ******************************************************************************/
+void HAL_FTM_EnableOverflowIrq(HAL_FTM_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Register the interrupt callback.
+ *
+ * Enables the channel and overflow interrupt lines of the instance in the
+ * NVIC, or disables them for a NULL callback.
+ ******************************************************************************/
+void HAL_FTM_RegisterCallback(HAL_FTM_Instance_t instance, HAL_FTM_Callback_t callback, void *param);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_FTM_H_ */
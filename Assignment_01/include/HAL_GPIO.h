@@ -101,6 +101,18 @@ void HAL_GPIO_SetPullResistor(const uint8_t portNumber, const uint8_t pinNumber,
  ******************************************************************************/
 void HAL_GPIO_WritePin(const uint8_t portNumber, const uint8_t pinNumber, const uint32_t mode);
 
+/*******************************************************************************
+ * @brief   Route a pin to one of its alternate (peripheral) functions.
+ *
+ * This function enables the clock for the specified port and replaces the
+ * pin multiplexing field, e.g. ALT2 for the LPUART RX/TX pins.
+ *
+ * @param   portNumber  Port index (HAL_GPIO_PORT_A ... HAL_GPIO_PORT_E).
+ * @param   pinNumber   Pin index within the selected port.
+ * @param   mux         Alternate function number (0 ... 7).
+ ******************************************************************************/
+void HAL_GPIO_SetPinMux(const uint8_t portNumber, const uint8_t pinNumber, const uint8_t mux);
+
 
 #ifdef  __cplusplus
 }
@@ -0,0 +1,178 @@
+/*******************************************************************************
+ * @file    HAL_LPI2C.h
+ * @brief   Hardware abstraction layer for LPI2C (master) header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_LPI2C_H_
+#define HAL_LPI2C_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Functional clock: FIRCDIV2 (48 MHz). */
+#define HAL_LPI2C_CLOCK_HZ          (HAL_SCG_FIRCDIV2_HZ)
+
+/* Master command FIFO commands (MTDR[10:8]) */
+#define HAL_LPI2C_CMD_TRANSMIT      (0U)    /**< Transmit DATA                          */
+#define HAL_LPI2C_CMD_RECEIVE       (1U)    /**< Receive DATA + 1 bytes                 */
+#define HAL_LPI2C_CMD_STOP          (2U)    /**< Generate STOP                          */
+#define HAL_LPI2C_CMD_START         (4U)    /**< (Repeated) START, transmit address     */
+
+#define HAL_LPI2C_RECEIVE_MAX       (256UL) /**< Bytes per receive command              */
+
+/* Status flags / interrupt sources */
+#define HAL_LPI2C_STATUS_TX         (LPI2C_MSR_TDF_MASK)    /**< TX FIFO at or below watermark */
+#define HAL_LPI2C_STATUS_RX         (LPI2C_MSR_RDF_MASK)    /**< RX FIFO above watermark       */
+#define HAL_LPI2C_STATUS_STOP       (LPI2C_MSR_SDF_MASK)    /**< STOP detected                 */
+#define HAL_LPI2C_STATUS_NACK       (LPI2C_MSR_NDF_MASK)    /**< Unexpected NACK               */
+#define HAL_LPI2C_STATUS_ARB_LOST   (LPI2C_MSR_ALF_MASK)    /**< Arbitration lost              */
+#define HAL_LPI2C_STATUS_FIFO_ERR   (LPI2C_MSR_FEF_MASK)    /**< Command sequence error        */
+#define HAL_LPI2C_STATUS_PIN_LOW    (LPI2C_MSR_PLTF_MASK)   /**< Pin low timeout               */
+#define HAL_LPI2C_STATUS_BUSY       (LPI2C_MSR_MBF_MASK)    /**< Master busy                   */
+#define HAL_LPI2C_STATUS_BUS_BUSY   (LPI2C_MSR_BBF_MASK)    /**< Bus busy                      */
+
+#define HAL_LPI2C_STATUS_ERRORS     (HAL_LPI2C_STATUS_NACK | HAL_LPI2C_STATUS_ARB_LOST | \
+                                     HAL_LPI2C_STATUS_FIFO_ERR | HAL_LPI2C_STATUS_PIN_LOW)
+
+typedef enum
+{
+    HAL_LPI2C_0 = 0U,
+    HAL_LPI2C_MAX
+} HAL_LPI2C_Instance_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock and reset an LPI2C instance, master left disabled.
+ *
+ * @param   instance    LPI2C instance.
+ ******************************************************************************/
+void HAL_LPI2C_Init(HAL_LPI2C_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Disable the master and gate the clock.
+ *
+ * @param   instance    LPI2C instance.
+ ******************************************************************************/
+void HAL_LPI2C_Deinit(HAL_LPI2C_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enable / disable the master (MCR.MEN).
+ *
+ * @param   instance    LPI2C instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPI2C_Enable(HAL_LPI2C_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Program the fastest SCL not above the requested rate.
+ *
+ * Master must be disabled.
+ *
+ * @param   instance    LPI2C instance.
+ * @param   busSpeed    Requested SCL frequency in Hz.
+ * @return  Achieved SCL frequency in Hz, 0 if not reachable.
+ ******************************************************************************/
+uint32_t HAL_LPI2C_SetBusSpeed(HAL_LPI2C_Instance_t instance, uint32_t busSpeed);
+
+/*******************************************************************************
+ * @brief   Queue one command word (HAL_LPI2C_CMD_xxx with its data byte).
+ *
+ * @param   instance    LPI2C instance.
+ * @param   command     Command.
+ * @param   data        Data byte, address byte or receive count - 1.
+ ******************************************************************************/
+void HAL_LPI2C_WriteCommand(HAL_LPI2C_Instance_t instance, uint8_t command, uint8_t data);
+
+/*******************************************************************************
+ * @brief   Pop one received byte.
+ *
+ * @param   instance    LPI2C instance.
+ ******************************************************************************/
+uint8_t HAL_LPI2C_ReadData(HAL_LPI2C_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FIFO depth in words.
+ *
+ * @param   instance    LPI2C instance.
+ * @return  Number of words of the command / TX FIFO.
+ ******************************************************************************/
+uint8_t HAL_LPI2C_GetFifoSize(HAL_LPI2C_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program the TX / RX FIFO watermarks.
+ *
+ * TX request when TX count <= txWater, RX request when RX count > rxWater.
+ *
+ * @param   instance    LPI2C instance.
+ * @param   txWater     TX watermark.
+ * @param   rxWater     RX watermark.
+ ******************************************************************************/
+void HAL_LPI2C_SetWatermarks(HAL_LPI2C_Instance_t instance, uint8_t txWater, uint8_t rxWater);
+
+/*******************************************************************************
+ * @brief   Number of words queued in the TX FIFO / held in the RX FIFO.
+ *
+ * @param   instance    LPI2C instance.
+ ******************************************************************************/
+uint8_t HAL_LPI2C_GetTxFifoCount(HAL_LPI2C_Instance_t instance);
+uint8_t HAL_LPI2C_GetRxFifoCount(HAL_LPI2C_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enable interrupt sources (HAL_LPI2C_STATUS_xxx), others disabled.
+ *
+ * @param   instance    LPI2C instance.
+ * @param   mask        Interrupt sources.
+ ******************************************************************************/
+void HAL_LPI2C_SetInterrupts(HAL_LPI2C_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Read / clear status flags (HAL_LPI2C_STATUS_xxx).
+ *
+ * @param   instance    LPI2C instance.
+ * @param   mask        Flags to clear.
+ ******************************************************************************/
+uint32_t HAL_LPI2C_GetStatus(HAL_LPI2C_Instance_t instance);
+void HAL_LPI2C_ClearStatus(HAL_LPI2C_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Enable / disable the RX DMA request.
+ *
+ * @param   instance    LPI2C instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPI2C_EnableRxDma(HAL_LPI2C_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   MRDR address, used as DMA source.
+ *
+ * @param   instance    LPI2C instance.
+ ******************************************************************************/
+uint32_t HAL_LPI2C_GetRxDataAddress(HAL_LPI2C_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Discard the content of both FIFOs.
+ *
+ * @param   instance    LPI2C instance.
+ ******************************************************************************/
+void HAL_LPI2C_FlushFifo(HAL_LPI2C_Instance_t instance);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_LPI2C_H_ */
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * @file    HAL_LPSPI.h
+ * @brief   Hardware abstraction layer for LPSPI header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_LPSPI_H_
+#define HAL_LPSPI_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Functional clock: FIRCDIV2 (48 MHz), maximum SCK is 24 MHz. */
+#define HAL_LPSPI_CLOCK_HZ          (HAL_SCG_FIRCDIV2_HZ)
+
+/* Status flags / interrupt sources */
+#define HAL_LPSPI_STATUS_TX         (LPSPI_SR_TDF_MASK)     /**< TX FIFO at or below watermark */
+#define HAL_LPSPI_STATUS_RX         (LPSPI_SR_RDF_MASK)     /**< RX FIFO above watermark       */
+#define HAL_LPSPI_STATUS_TC         (LPSPI_SR_TCF_MASK)     /**< Transfer complete             */
+#define HAL_LPSPI_STATUS_TX_ERR     (LPSPI_SR_TEF_MASK)     /**< TX FIFO underrun              */
+#define HAL_LPSPI_STATUS_RX_ERR     (LPSPI_SR_REF_MASK)     /**< RX FIFO overflow              */
+#define HAL_LPSPI_STATUS_BUSY       (LPSPI_SR_MBF_MASK)     /**< Module busy                   */
+
+typedef enum
+{
+    HAL_LPSPI_0 = 0U,
+    HAL_LPSPI_1,
+    HAL_LPSPI_2,
+    HAL_LPSPI_MAX
+} HAL_LPSPI_Instance_t;
+
+/**
+ * @brief Transmit command word (written to TCR through the TX FIFO).
+ */
+typedef struct
+{
+    uint8_t frameBits;      /**< 8 ... 32 bits per frame                           */
+    uint8_t cpol;           /**< Clock polarity                                    */
+    uint8_t cpha;           /**< Clock phase                                       */
+    uint8_t lsbFirst;       /**< 1 = LSB first                                     */
+    uint8_t pcs;            /**< Peripheral chip select 0 ... 3                    */
+    uint8_t cont;           /**< 1 = keep PCS asserted between frames              */
+    uint8_t contc;          /**< 1 = continue the previous continuous command      */
+} HAL_LPSPI_Command_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock and reset an LPSPI instance, module left disabled.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+void HAL_LPSPI_Init(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Disable the module and gate its clock.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+void HAL_LPSPI_Deinit(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enable / disable the module (CR.MEN).
+ *
+ * @param   instance    LPSPI instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPSPI_Enable(HAL_LPSPI_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Select master mode (PCS active low). Module must be disabled.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+void HAL_LPSPI_SetMaster(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program the fastest SCK not above the requested rate.
+ *
+ * The prescaler is part of the command word and is applied by the next
+ * HAL_LPSPI_WriteCommand(). Module must be disabled.
+ *
+ * @param   instance    LPSPI instance.
+ * @param   busSpeed    Requested SCK frequency in Hz.
+ * @return  Achieved SCK frequency in Hz, 0 if not reachable.
+ ******************************************************************************/
+uint32_t HAL_LPSPI_SetBaudRate(HAL_LPSPI_Instance_t instance, uint32_t busSpeed);
+
+/*******************************************************************************
+ * @brief   Queue a transmit command word.
+ *
+ * @param   instance    LPSPI instance.
+ * @param   command     Command description.
+ ******************************************************************************/
+void HAL_LPSPI_WriteCommand(HAL_LPSPI_Instance_t instance, const HAL_LPSPI_Command_t *command);
+
+/*******************************************************************************
+ * @brief   FIFO depth in words.
+ *
+ * @param   instance    LPSPI instance.
+ * @return  Number of words of the TX (= RX) FIFO.
+ ******************************************************************************/
+uint8_t HAL_LPSPI_GetFifoSize(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program the TX / RX FIFO watermarks.
+ *
+ * TX request when TX count <= txWater, RX request when RX count > rxWater.
+ *
+ * @param   instance    LPSPI instance.
+ * @param   txWater     TX watermark.
+ * @param   rxWater     RX watermark.
+ ******************************************************************************/
+void HAL_LPSPI_SetWatermarks(HAL_LPSPI_Instance_t instance, uint8_t txWater, uint8_t rxWater);
+
+/*******************************************************************************
+ * @brief   Number of words (data and commands) queued in the TX FIFO.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+uint8_t HAL_LPSPI_GetTxFifoCount(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Check whether the RX FIFO is empty.
+ *
+ * @param   instance    LPSPI instance.
+ * @return  1 when empty, 0 otherwise.
+ ******************************************************************************/
+uint8_t HAL_LPSPI_IsRxEmpty(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Push one frame to the TX FIFO / pop one frame from the RX FIFO.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+void HAL_LPSPI_WriteData(HAL_LPSPI_Instance_t instance, uint32_t data);
+uint32_t HAL_LPSPI_ReadData(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Enable interrupt sources (HAL_LPSPI_STATUS_xxx), others disabled.
+ *
+ * @param   instance    LPSPI instance.
+ * @param   mask        Interrupt sources.
+ ******************************************************************************/
+void HAL_LPSPI_SetInterrupts(HAL_LPSPI_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Read / clear status flags (HAL_LPSPI_STATUS_xxx).
+ *
+ * @param   instance    LPSPI instance.
+ * @param   mask        Flags to clear.
+ ******************************************************************************/
+uint32_t HAL_LPSPI_GetStatus(HAL_LPSPI_Instance_t instance);
+void HAL_LPSPI_ClearStatus(HAL_LPSPI_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Enable / disable TX and RX DMA requests.
+ *
+ * @param   instance    LPSPI instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPSPI_EnableDma(HAL_LPSPI_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   TDR / RDR addresses, used as DMA destination / source.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+uint32_t HAL_LPSPI_GetTxDataAddress(HAL_LPSPI_Instance_t instance);
+uint32_t HAL_LPSPI_GetRxDataAddress(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Discard the content of both FIFOs.
+ *
+ * @param   instance    LPSPI instance.
+ ******************************************************************************/
+void HAL_LPSPI_FlushFifo(HAL_LPSPI_Instance_t instance);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_LPSPI_H_ */
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * @file    HAL_LPUART.h
+ * @brief   Hardware abstraction layer for LPUART header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_LPUART_H_
+#define HAL_LPUART_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Functional clock: FIRCDIV2 (48 MHz FIRC divided by 1). 48 MHz / OSR 12 = 4 Mbaud. */
+#define HAL_LPUART_CLOCK_HZ         (HAL_SCG_FIRCDIV2_HZ)
+
+/* Status flags returned by HAL_LPUART_GetStatus() */
+#define HAL_LPUART_STATUS_IDLE        (LPUART_STAT_IDLE_MASK)      /**< Idle line detected */
+#define HAL_LPUART_STATUS_OVERRUN     (LPUART_STAT_OR_MASK)        /**< Receiver overrun */
+#define HAL_LPUART_STATUS_NOISE       (LPUART_STAT_NF_MASK)        /**< Noise flag */
+#define HAL_LPUART_STATUS_FRAMING     (LPUART_STAT_FE_MASK)        /**< Framing error */
+#define HAL_LPUART_STATUS_PARITY      (LPUART_STAT_PF_MASK)        /**< Parity error */
+#define HAL_LPUART_STATUS_TC          (LPUART_STAT_TC_MASK)        /**< Transmission complete */
+#define HAL_LPUART_STATUS_BREAK       (LPUART_STAT_LBKDIF_MASK)    /**< LIN break detected */
+
+typedef enum
+{
+    HAL_LPUART_0 = 0U,
+    HAL_LPUART_1,
+    HAL_LPUART_2,
+    HAL_LPUART_MAX
+} HAL_LPUART_Instance_t;
+
+typedef enum
+{
+    HAL_LPUART_PARITY_NONE = 0U,
+    HAL_LPUART_PARITY_EVEN,
+    HAL_LPUART_PARITY_ODD
+} HAL_LPUART_Parity_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock and reset an LPUART instance.
+ *
+ * Selects FIRCDIV2 as functional clock, enables the PCC clock gate and
+ * performs a software reset. Transmitter and receiver stay disabled.
+ *
+ * @param   instance    LPUART instance.
+ ******************************************************************************/
+void HAL_LPUART_Init(HAL_LPUART_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Gate the clock of an LPUART instance.
+ *
+ * @param   instance    LPUART instance.
+ ******************************************************************************/
+void HAL_LPUART_Deinit(HAL_LPUART_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program the baud rate.
+ *
+ * Searches all oversampling ratios (4 ... 32) for the smallest error.
+ *
+ * @param   instance    LPUART instance.
+ * @param   baudRate    Requested baud rate in bit/s.
+ * @return  1 when the error is below 3 %, 0 otherwise (nothing written).
+ ******************************************************************************/
+uint8_t HAL_LPUART_SetBaudRate(HAL_LPUART_Instance_t instance, uint32_t baudRate);
+
+/*******************************************************************************
+ * @brief   Program character format.
+ *
+ * @param   instance    LPUART instance.
+ * @param   dataBits    7, 8 or 9 (including the parity bit is handled here).
+ * @param   parity      Parity mode.
+ * @param   stopBits    1 or 2.
+ ******************************************************************************/
+void HAL_LPUART_SetFormat(HAL_LPUART_Instance_t instance, uint8_t dataBits,
+                          HAL_LPUART_Parity_t parity, uint8_t stopBits);
+
+/*******************************************************************************
+ * @brief   Enable / disable transmitter and receiver.
+ *
+ * @param   instance    LPUART instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPUART_EnableTx(HAL_LPUART_Instance_t instance, uint8_t enable);
+void HAL_LPUART_EnableRx(HAL_LPUART_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Enable / disable the TX and RX DMA requests.
+ *
+ * @param   instance    LPUART instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPUART_EnableTxDma(HAL_LPUART_Instance_t instance, uint8_t enable);
+void HAL_LPUART_EnableRxDma(HAL_LPUART_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Configure the idle-line interrupt used to terminate RX frames.
+ *
+ * @param   instance    LPUART instance.
+ * @param   idleChars   Idle characters before IDLE is set: 1, 2, 4 ... 128.
+ *                      0 disables the interrupt.
+ ******************************************************************************/
+void HAL_LPUART_SetIdleInterrupt(HAL_LPUART_Instance_t instance, uint8_t idleChars);
+
+/*******************************************************************************
+ * @brief   Enable / disable the receiver error (overrun, noise, framing,
+ *          parity) interrupts.
+ *
+ * @param   instance    LPUART instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPUART_EnableErrorInterrupts(HAL_LPUART_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Enable / disable the transmission complete interrupt.
+ *
+ * @param   instance    LPUART instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPUART_EnableTcInterrupt(HAL_LPUART_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Internal loopback (TX output internally connected to RX).
+ *
+ * @param   instance    LPUART instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPUART_SetLoopback(HAL_LPUART_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Send a break character continuously while enabled.
+ *
+ * @param   instance    LPUART instance.
+ * @param   enable      0 = disabled, 1 = enabled.
+ ******************************************************************************/
+void HAL_LPUART_SetBreak(HAL_LPUART_Instance_t instance, uint8_t enable);
+
+/*******************************************************************************
+ * @brief   Read / clear status flags (HAL_LPUART_STATUS_xxx).
+ *
+ * @param   instance    LPUART instance.
+ * @param   mask        Flags to clear (write-1-to-clear flags only).
+ ******************************************************************************/
+uint32_t HAL_LPUART_GetStatus(HAL_LPUART_Instance_t instance);
+void HAL_LPUART_ClearStatus(HAL_LPUART_Instance_t instance, uint32_t mask);
+
+/*******************************************************************************
+ * @brief   Address of the DATA register, used as DMA source / destination.
+ *
+ * @param   instance    LPUART instance.
+ * @return  DATA register address, 0 for an invalid instance.
+ ******************************************************************************/
+uint32_t HAL_LPUART_GetDataAddress(HAL_LPUART_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Discard the content of the transmit and receive FIFOs.
+ *
+ * @param   instance    LPUART instance.
+ ******************************************************************************/
+void HAL_LPUART_FlushFifo(HAL_LPUART_Instance_t instance);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_LPUART_H_ */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * @file    HAL_NVIC.h
+ * @brief   Hardware abstraction layer for the Cortex-M4 NVIC header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_NVIC_H_
+#define HAL_NVIC_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* S32K144.h does not provide an NVIC access structure, use the core addresses. */
+#define HAL_NVIC_ISER_BASE      (0xE000E100UL)  /**< Interrupt Set-Enable     */
+#define HAL_NVIC_ICER_BASE      (0xE000E180UL)  /**< Interrupt Clear-Enable   */
+#define HAL_NVIC_ICPR_BASE      (0xE000E280UL)  /**< Interrupt Clear-Pending  */
+#define HAL_NVIC_IPR_BASE       (0xE000E400UL)  /**< Interrupt Priority bytes */
+
+#define HAL_NVIC_PRIO_LOWEST    ((1UL << __NVIC_PRIO_BITS) - 1UL)
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Enable a device interrupt in the NVIC.
+ *
+ * @param   irq     Device interrupt number (>= 0).
+ ******************************************************************************/
+void HAL_NVIC_EnableIRQ(IRQn_Type irq);
+
+/*******************************************************************************
+ * @brief   Disable a device interrupt in the NVIC.
+ *
+ * @param   irq     Device interrupt number (>= 0).
+ ******************************************************************************/
+void HAL_NVIC_DisableIRQ(IRQn_Type irq);
+
+/*******************************************************************************
+ * @brief   Clear a pending device interrupt.
+ *
+ * @param   irq     Device interrupt number (>= 0).
+ ******************************************************************************/
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq);
+
+/*******************************************************************************
+ * @brief   Set the priority of a device interrupt.
+ *
+ * @param   irq       Device interrupt number (>= 0).
+ * @param   priority  0 (highest) ... HAL_NVIC_PRIO_LOWEST.
+ ******************************************************************************/
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint8_t priority);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_NVIC_H_ */
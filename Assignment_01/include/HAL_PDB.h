@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * @file    HAL_PDB.h
+ * @brief   Hardware abstraction layer for the programmable delay block
+ *          header file.
+ *
+ * PDB0 triggers ADC0 and PDB1 triggers ADC1: pre-trigger n of channel 0
+ * starts the conversion of ADC slot n (SIM_ADCOPT default routing).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_PDB_H_
+#define HAL_PDB_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+#include "HAL_SCG.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Counter clock: bus clock (48 MHz in FIRC run mode), divided by
+ * prescaler and multiplier. */
+#define HAL_PDB_CLOCK_HZ            (HAL_SCG_BUS_CLK_HZ)
+
+#define HAL_PDB_PRETRIGGER_COUNT    (8U)
+
+/* Input trigger (SC.TRGSEL) */
+#define HAL_PDB_TRIGGER_TRGMUX      (0U)
+#define HAL_PDB_TRIGGER_SOFTWARE    (15U)
+
+typedef enum
+{
+    HAL_PDB_0 = 0U,
+    HAL_PDB_1,
+    HAL_PDB_MAX
+} HAL_PDB_Instance_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock a PDB instance and route it to its ADC, module disabled.
+ *
+ * @param   instance    PDB instance.
+ ******************************************************************************/
+void HAL_PDB_Init(HAL_PDB_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Program the counter period for a trigger rate, continuous mode.
+ *
+ * The smallest prescaler (then multiplier) that fits the 16-bit modulus
+ * is chosen.
+ *
+ * @param   instance    PDB instance.
+ * @param   rate        Periods per second.
+ * @return  Counter ticks per second, 0 if the rate is not reachable.
+ *          The achieved rate is ticks / (HAL_PDB_GetModulus() + 1).
+ ******************************************************************************/
+uint32_t HAL_PDB_SetRate(HAL_PDB_Instance_t instance, uint32_t rate);
+
+/*******************************************************************************
+ * @brief   Counter modulus (period - 1) programmed by HAL_PDB_SetRate().
+ *
+ * @param   instance    PDB instance.
+ ******************************************************************************/
+uint16_t HAL_PDB_GetModulus(HAL_PDB_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Chain pre-triggers back to back.
+ *
+ * Pre-trigger 0 fires at delay0 counter ticks; pre-trigger n fires when
+ * the conversion started by pre-trigger n - 1 completes.
+ *
+ * @param   instance    PDB instance.
+ * @param   count       Pre-triggers (ADC slots) used, 1 ... 8.
+ * @param   delay0      Delay of the first one in counter ticks.
+ ******************************************************************************/
+void HAL_PDB_SetChain(HAL_PDB_Instance_t instance, uint8_t count, uint16_t delay0);
+
+/*******************************************************************************
+ * @brief   Raise a DMA request at a counter value in every period.
+ *
+ * @param   instance    PDB instance.
+ * @param   delay       Counter value (IDLY).
+ ******************************************************************************/
+void HAL_PDB_SetDmaDelay(HAL_PDB_Instance_t instance, uint16_t delay);
+
+/*******************************************************************************
+ * @brief   Enable, load the buffered values and wait for / give the trigger.
+ *
+ * @param   instance    PDB instance.
+ * @param   trigger     HAL_PDB_TRIGGER_xxx.
+ ******************************************************************************/
+void HAL_PDB_Start(HAL_PDB_Instance_t instance, uint8_t trigger);
+void HAL_PDB_Stop(HAL_PDB_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Current counter value.
+ *
+ * @param   instance    PDB instance.
+ ******************************************************************************/
+uint16_t HAL_PDB_GetCounter(HAL_PDB_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   Read and clear the pre-trigger sequence errors (a pre-trigger
+ *          fired before the previous conversion was acknowledged).
+ *
+ * @param   instance    PDB instance.
+ * @return  Bit n set = error on pre-trigger n.
+ ******************************************************************************/
+uint8_t HAL_PDB_GetSequenceErrors(HAL_PDB_Instance_t instance);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_PDB_H_ */
@@ -0,0 +1,51 @@
+/*******************************************************************************
+ * @file    HAL_SCG.h
+ * @brief   Hardware abstraction layer for SCG clock dividers header file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HAL_SCG_H_
+#define HAL_SCG_H_
+
+#include <stdint.h>
+#include "S32K144.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* FIRC run mode: SYS_CLK and BUS_CLK run from FIRC undivided, FIRCDIV2
+ * is set to FIRC / 1 by HAL_SCG_ClockFromFircDiv2(). The peripheral HALs
+ * derive their functional clocks from these. */
+#define HAL_SCG_FIRC_HZ             (48000000UL)
+#define HAL_SCG_FIRCDIV2_HZ         (HAL_SCG_FIRC_HZ)       /**< Asynchronous peripheral clock  */
+#define HAL_SCG_SYS_CLK_HZ          (HAL_SCG_FIRC_HZ)       /**< Core, FTM and FlexCAN PE clock */
+#define HAL_SCG_BUS_CLK_HZ          (HAL_SCG_FIRC_HZ)       /**< PDB counter clock              */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Clock a peripheral from FIRCDIV2.
+ *
+ * Sets FIRCDIV2 to FIRC / 1 (read-modify-write of that field only, the
+ * other dividers are kept), then selects it as the functional clock of
+ * the peripheral and enables the PCC clock gate. PCS may only change
+ * while the gate is off, so the gate is cleared first.
+ *
+ * @param   pccIndex    PCC_xxx_INDEX of the peripheral.
+ ******************************************************************************/
+void HAL_SCG_ClockFromFircDiv2(uint32_t pccIndex);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* HAL_SCG_H_ */
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * @file    Image_Verify.h
+ * @brief   Flash image integrity check header file.
+ *
+ * The linker script places a descriptor (.image_info, first words of
+ * m_text) listing the flash ranges of the image with their expected
+ * CRC-32 (as zlib crc32()). The CRC fields are left at IMAGE_VERIFY_CRC_UNSET
+ * by the link and written by tools/Image_Seal, run after the link by
+ * makefile.targets. An unset CRC, or a descriptor without ranges, makes
+ * the image corrupt / invalid; only a build with IMAGE_VERIFY_ALLOW_UNSEALED
+ * set (debugging, RAM builds) reports it as unsealed and runs it.
+ *
+ * Image_Verify_Boot() is called by the startup code right after
+ * init_data_bss, with interrupts masked. With IMAGE_VERIFY_DEFER set it
+ * checks only the ranges flagged hot (vectors, flash configuration,
+ * initialized data and RAM code images) and leaves the others to
+ * Image_Verify_Idle(), which checks IMAGE_VERIFY_STEP bytes per call from
+ * the application idle loop. The running CRC between steps is kept as a
+ * checkpoint, so the CRC module may be used by others in between.
+ *
+ * Time is measured with the DWT cycle counter; cycles per KB are
+ * cycles * 1024 / bytes of the statistics.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef IMAGE_VERIFY_H_
+#define IMAGE_VERIFY_H_
+
+#include <stdint.h>
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef IMAGE_VERIFY_DEFER
+#define IMAGE_VERIFY_DEFER          (1U)            /**< 1 = only hot ranges at boot */
+#endif
+
+#ifndef IMAGE_VERIFY_ALLOW_UNSEALED
+#define IMAGE_VERIFY_ALLOW_UNSEALED (0U)            /**< 1 = run images not sealed   */
+#endif
+
+#ifndef IMAGE_VERIFY_STEP
+#define IMAGE_VERIFY_STEP           (1024UL)        /**< Bytes per idle call         */
+#endif
+
+#define IMAGE_VERIFY_MAGIC          (0x31474D49UL)  /**< "IMG1"                     */
+#define IMAGE_VERIFY_RANGE_MAX      (4U)
+#define IMAGE_VERIFY_CRC_UNSET      (0xFFFFFFFFUL)
+#define IMAGE_VERIFY_FLAG_HOT       (1UL << 0)      /**< Checked at boot             */
+
+/* Image status */
+#define IMAGE_VERIFY_STATUS_PENDING     (0U)    /**< Deferred ranges not done yet       */
+#define IMAGE_VERIFY_STATUS_OK          (1U)
+#define IMAGE_VERIFY_STATUS_UNSEALED    (2U)    /**< Matches where sealed, some CRC unset (allowed builds) */
+#define IMAGE_VERIFY_STATUS_CORRUPT     (3U)    /**< A range does not match             */
+#define IMAGE_VERIFY_STATUS_INVALID     (4U)    /**< Bad or empty descriptor            */
+
+/**
+ * @brief One range of the descriptor.
+ */
+typedef struct
+{
+    uint32_t    start;
+    uint32_t    size;
+    uint32_t    crc;            /**< Expected CRC-32, IMAGE_VERIFY_CRC_UNSET before sealing */
+    uint32_t    flags;          /**< IMAGE_VERIFY_FLAG_xxx  */
+} Image_Range_t;
+
+/**
+ * @brief Descriptor layout, as written by the linker script.
+ */
+typedef struct
+{
+    uint32_t        magic;
+    uint32_t        count;
+    Image_Range_t   range[IMAGE_VERIFY_RANGE_MAX];
+} Image_Descriptor_t;
+
+/**
+ * @brief Check statistics.
+ */
+typedef struct
+{
+    uint32_t    bootBytes;
+    uint32_t    bootCycles;
+    uint32_t    idleBytes;
+    uint32_t    idleCycles;
+    uint8_t     failedRange;    /**< First corrupt or unsealed range, IMAGE_VERIFY_RANGE_MAX if none */
+} Image_VerifyStats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Boot stage, called by the startup code after init_data_bss.
+ ******************************************************************************/
+void Image_Verify_Boot(void);
+
+/*******************************************************************************
+ * @brief   Check the next step of the deferred ranges, for the idle loop.
+ *
+ * Does nothing while the CRC module runs a DMA feed.
+ *
+ * @return  1 deferred ranges left, 0 done.
+ ******************************************************************************/
+uint8_t Image_Verify_Idle(void);
+
+/*******************************************************************************
+ * @brief   Current image status.
+ *
+ * @return  IMAGE_VERIFY_STATUS_xxx.
+ ******************************************************************************/
+uint8_t Image_Verify_GetStatus(void);
+
+/*******************************************************************************
+ * @brief   Bytes still to check in the idle loop.
+ ******************************************************************************/
+uint32_t Image_Verify_GetRemaining(void);
+
+/*******************************************************************************
+ * @brief   Check statistics.
+ ******************************************************************************/
+void Image_Verify_GetStats(Image_VerifyStats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* IMAGE_VERIFY_H_ */
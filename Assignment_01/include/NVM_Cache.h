@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * @file    NVM_Cache.h
+ * @brief   Write-back RAM cache in front of a CMSIS Flash driver header file.
+ *
+ * Small scattered writes to a flash region are merged in RAM pages, one
+ * page per flash sector, with a dirty bit per program phrase (only bytes
+ * that really change mark their phrase). Reads see the cached data, so
+ * every write is visible at once.
+ *
+ * A page is written back in address order, with one ProgramData call per
+ * run of dirty phrases when all of them are still erased in flash;
+ * otherwise the sector is erased and the whole page programmed. Pages are
+ * written back by NVM_Cache_Sync(), one per NVM_Cache_Idle() call, when
+ * the dirty phrases reach the watermark, and when a page is evicted.
+ *
+ * All operations are blocking and wait for the flash driver; they must
+ * not be called from interrupts.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef NVM_CACHE_H_
+#define NVM_CACHE_H_
+
+#include <stdint.h>
+#include "Driver_Flash.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define NVM_CACHE_PAGE_MAX          (4U)
+#define NVM_CACHE_SECTOR_MAX        (4096U)     /**< Largest sector (P-Flash) */
+#define NVM_CACHE_PHRASE            (8U)
+#define NVM_CACHE_NO_PAGE           (0xFFFFFFFFUL)
+
+/**
+ * @brief Constant configuration.
+ */
+typedef struct
+{
+    ARM_DRIVER_FLASH    *driver;        /**< Initialized and powered                    */
+    uint32_t            base;           /**< Cached region, sector aligned              */
+    uint32_t            size;           /**< Whole sectors                              */
+    uint8_t             *buffer;        /**< pageCount sectors of RAM                   */
+    uint8_t             pageCount;      /**< 1 ... NVM_CACHE_PAGE_MAX                   */
+    uint16_t            watermark;      /**< Dirty phrases starting a sync, 0 = never   */
+} NVM_CacheConfig_t;
+
+/**
+ * @brief One cached sector.
+ */
+typedef struct
+{
+    uint32_t    address;        /**< Sector address, NVM_CACHE_NO_PAGE = free */
+    uint8_t     *data;
+    uint32_t    dirty[NVM_CACHE_SECTOR_MAX / NVM_CACHE_PHRASE / 32U];
+    uint16_t    dirtyCount;
+    uint32_t    used;           /**< Last access, for eviction */
+} NVM_CachePage_t;
+
+/**
+ * @brief Cache, allocated by the caller.
+ *
+ * Write amplification = programmed / written; erases cost far more time
+ * than phrases, so they are counted apart.
+ */
+typedef struct
+{
+    const NVM_CacheConfig_t *config;
+    uint32_t                sectorSize;
+    NVM_CachePage_t         page[NVM_CACHE_PAGE_MAX];
+    uint32_t                clock;
+    uint32_t                dirtyCount;         /**< All pages                      */
+    uint32_t                written;            /**< Bytes given to NVM_Cache_Write */
+    uint32_t                programmed;         /**< Bytes programmed in flash      */
+    uint32_t                erased;             /**< Sectors erased                 */
+    uint32_t                writeBacks;         /**< Pages written back             */
+} NVM_Cache_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up an empty cache.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t NVM_Cache_Init(NVM_Cache_t *cache, const NVM_CacheConfig_t *config);
+
+/*******************************************************************************
+ * @brief   Read, cached data first.
+ *
+ * @return  Bytes read, ARM_DRIVER_ERROR_PARAMETER, ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Cache_Read(NVM_Cache_t *cache, uint32_t addr, void *data, uint32_t size);
+
+/*******************************************************************************
+ * @brief   Write into the cache, any address and size inside the region.
+ *
+ * Flash is only touched to load a sector, to evict a page or when the
+ * watermark is reached.
+ *
+ * @return  Bytes written, ARM_DRIVER_ERROR_PARAMETER, ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Cache_Write(NVM_Cache_t *cache, uint32_t addr, const void *data, uint32_t size);
+
+/*******************************************************************************
+ * @brief   Write back every dirty page, in address order.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Cache_Sync(NVM_Cache_t *cache);
+
+/*******************************************************************************
+ * @brief   Write back the dirty page with the lowest address, for the
+ *          application idle loop.
+ *
+ * @return  1 page written back, 0 nothing dirty, ARM_DRIVER_ERROR_PARAMETER,
+ *          ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Cache_Idle(NVM_Cache_t *cache);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* NVM_CACHE_H_ */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * @file    NVM_Eeprom.h
+ * @brief   Slot store on the FlexNVM emulated EEPROM (FlexRAM EEE) header file.
+ *
+ * The FlexNVM is partitioned once into 32 KB D-Flash and 32 KB EEPROM
+ * backup, the 4 KB FlexRAM then holds the EEPROM contents. Records are
+ * written to the backup by the flash controller itself, spread over the
+ * whole backup for wear leveling, and survive a reset in the middle.
+ *
+ * Values live in fixed slots, each a word aligned FlexRAM range of a size
+ * given at start-up; the slot index is the key. Reads come straight from
+ * FlexRAM. A write only updates the 32-bit words that changed, one EEPROM
+ * record each, in the background: the command complete interrupt starts
+ * the next word and reports the end of the write.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef NVM_EEPROM_H_
+#define NVM_EEPROM_H_
+
+#include <stdint.h>
+#include "Driver_Common.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define NVM_EEPROM_SLOT_MAX         (64U)
+
+/****** Write events *****/
+#define NVM_EEPROM_EVENT_WRITE_DONE     (1UL << 0)  /**< Slot contents stored */
+#define NVM_EEPROM_EVENT_WRITE_ERROR    (1UL << 1)  /**< EEPROM write failed, slot partly updated */
+
+/**
+ * @brief Write completion callback, called from the FTFC interrupt (or from
+ *        NVM_Eeprom_Write() when nothing changed).
+ *
+ * @param slot      Slot written.
+ * @param event     NVM_EEPROM_EVENT_xxx.
+ */
+typedef void (*NVM_Eeprom_Callback_t)(uint16_t slot, uint32_t event);
+
+/**
+ * @brief Write statistics, bytes requested versus EEPROM words written.
+ */
+typedef struct
+{
+    uint32_t    bytesRequested;
+    uint32_t    wordsWritten;       /**< EEPROM records, 4 bytes each */
+    uint32_t    wordsSkipped;       /**< Words left alone: value unchanged */
+} NVM_EepromStats_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Partition the FlexNVM for the emulated EEPROM (one time).
+ *
+ * Needs an erased FlexNVM (Driver_Flash1 EraseChip, or a mass erase) and
+ * destroys nothing else. A part already partitioned is left alone.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_BUSY, ARM_DRIVER_ERROR (command
+ *          refused, e.g. FlexNVM not erased).
+ ******************************************************************************/
+int32_t NVM_Eeprom_Partition(void);
+
+/*******************************************************************************
+ * @brief   Enable the emulated EEPROM and lay out the slots.
+ *
+ * @param   slotSize    Size in bytes of each slot, must stay valid.
+ * @param   slotCount   Number of slots (1 ... NVM_EEPROM_SLOT_MAX).
+ * @param   callback    Write completion callback (may be NULL).
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER (slots exceed the
+ *          EEPROM), ARM_DRIVER_ERROR (not partitioned).
+ ******************************************************************************/
+int32_t NVM_Eeprom_Init(const uint16_t *slotSize, uint16_t slotCount, NVM_Eeprom_Callback_t callback);
+
+/*******************************************************************************
+ * @brief   Read a slot.
+ *
+ * @param   slot        Slot index.
+ * @param   data        Destination.
+ * @param   size        Bytes to read (at most the slot size).
+ *
+ * @return  Bytes read, ARM_DRIVER_ERROR_PARAMETER, ARM_DRIVER_ERROR_BUSY
+ *          (slot being written).
+ ******************************************************************************/
+int32_t NVM_Eeprom_Read(uint16_t slot, void *data, uint16_t size);
+
+/*******************************************************************************
+ * @brief   Start writing a slot. data must stay valid until the callback.
+ *
+ * @param   slot        Slot index.
+ * @param   data        New contents.
+ * @param   size        Bytes to write from the start of the slot.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, ARM_DRIVER_ERROR_BUSY
+ *          (a write or a flash operation in progress).
+ ******************************************************************************/
+int32_t NVM_Eeprom_Write(uint16_t slot, const void *data, uint16_t size);
+
+/*******************************************************************************
+ * @brief   Whether a write is in progress.
+ ******************************************************************************/
+uint8_t NVM_Eeprom_IsBusy(void);
+
+/*******************************************************************************
+ * @brief   Write statistics since NVM_Eeprom_Init().
+ ******************************************************************************/
+void NVM_Eeprom_GetStats(NVM_EepromStats_t *stats);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* NVM_EEPROM_H_ */
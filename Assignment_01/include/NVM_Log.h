@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * @file    NVM_Log.h
+ * @brief   Log-structured key/value store on a CMSIS Flash driver header file.
+ *
+ * Values are appended to a log of flash sectors as records (8 byte header
+ * with key, size and CRC-32, then the value padded to phrases); a newer
+ * record of a key supersedes the older ones, a record of size 0 deletes the
+ * key. Every sector starts with a header holding a sequence number that
+ * orders the log, and its complement.
+ *
+ * A RAM hash index (open addressing, linear probing) maps each live key to
+ * its record, so a lookup reads nothing from flash but the value itself.
+ * NVM_Log_Init() rebuilds it by scanning the log once, oldest sector first;
+ * records failing their CRC (write interrupted by a reset) are skipped, as
+ * is the phrase of a torn record header.
+ *
+ * One sector is always kept erased. When the log needs its last erased
+ * sector, the live records of the oldest sector are copied into it and
+ * the oldest sector is erased to become the new spare.
+ *
+ * All operations are blocking and wait for the flash driver; they must
+ * not be called from interrupts.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef NVM_LOG_H_
+#define NVM_LOG_H_
+
+#include <stdint.h>
+#include "Driver_Flash.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define NVM_LOG_SECTOR_MAX          (32U)
+#define NVM_LOG_VALUE_MAX           (248U)      /**< Record of at most 256 bytes */
+#define NVM_LOG_KEY_NONE            (0xFFFFU)   /**< Reserved: erased flash / free index entry */
+
+/****** Errors *****/
+#define NVM_LOG_ERROR_NOT_FOUND     (ARM_DRIVER_ERROR_SPECIFIC - 1)     /**< Key not stored */
+#define NVM_LOG_ERROR_FULL          (ARM_DRIVER_ERROR_SPECIFIC - 2)     /**< Log or index full */
+
+/**
+ * @brief Index entry, one per live key.
+ */
+typedef struct
+{
+    uint16_t    key;
+    uint16_t    size;           /**< Value size */
+    uint32_t    address;        /**< Record address */
+} NVM_LogEntry_t;
+
+/**
+ * @brief Constant configuration.
+ */
+typedef struct
+{
+    ARM_DRIVER_FLASH    *driver;        /**< Initialized and powered                */
+    uint32_t            base;           /**< First sector, sector aligned           */
+    uint8_t             sectorCount;    /**< 2 ... NVM_LOG_SECTOR_MAX, one spare    */
+    NVM_LogEntry_t      *index;         /**< Storage for indexSize entries          */
+    uint16_t            indexSize;      /**< Power of two, more than the key count  */
+} NVM_LogConfig_t;
+
+/**
+ * @brief Store, allocated by the caller.
+ */
+typedef struct
+{
+    const NVM_LogConfig_t   *config;
+    uint32_t                sectorSize;
+    uint32_t                sequence[NVM_LOG_SECTOR_MAX];   /**< Per sector, erased = 0xFFFFFFFF */
+    uint32_t                lastSequence;
+    uint32_t                writeOffset;        /**< Next record in the active sector   */
+    uint8_t                 active;
+    uint8_t                 erasedCount;
+    uint16_t                keyCount;
+    uint32_t                scanned;            /**< Records read by NVM_Log_Init()     */
+    uint32_t                compactions;
+    uint32_t                buffer[(8U + NVM_LOG_VALUE_MAX) / 4U];  /**< One record */
+} NVM_Log_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Mount the log and rebuild the index.
+ *
+ * Erased flash is formatted on the fly, sectors with a damaged header or
+ * data behind a blank header are erased, and a compaction interrupted by a
+ * reset is completed (restarted if records torn by resets filled the copy).
+ *
+ * @param   log         Store.
+ * @param   config      Configuration, must stay valid.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, NVM_LOG_ERROR_FULL
+ *          (index too small for the stored keys), ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Log_Init(NVM_Log_t *log, const NVM_LogConfig_t *config);
+
+/*******************************************************************************
+ * @brief   Read the value of a key.
+ *
+ * @param   log         Store.
+ * @param   key         Key.
+ * @param   data        Destination.
+ * @param   size        Destination size, a longer value is truncated.
+ *
+ * @return  Bytes read, NVM_LOG_ERROR_NOT_FOUND, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t NVM_Log_Get(const NVM_Log_t *log, uint16_t key, void *data, uint16_t size);
+
+/*******************************************************************************
+ * @brief   Size of the value of a key.
+ *
+ * @return  Size, NVM_LOG_ERROR_NOT_FOUND, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t NVM_Log_GetSize(const NVM_Log_t *log, uint16_t key);
+
+/*******************************************************************************
+ * @brief   Store a value.
+ *
+ * @param   log         Store.
+ * @param   key         Key (not NVM_LOG_KEY_NONE).
+ * @param   data        Value.
+ * @param   size        Value size (1 ... NVM_LOG_VALUE_MAX).
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, NVM_LOG_ERROR_FULL,
+ *          ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Log_Put(NVM_Log_t *log, uint16_t key, const void *data, uint16_t size);
+
+/*******************************************************************************
+ * @brief   Delete a key (nothing is written for a key not stored).
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER, NVM_LOG_ERROR_FULL,
+ *          ARM_DRIVER_ERROR (flash).
+ ******************************************************************************/
+int32_t NVM_Log_Delete(NVM_Log_t *log, uint16_t key);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* NVM_LOG_H_ */
@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * @file    QUEUE_Mpmc.h
+ * @brief   Bounded multi-producer / multi-consumer queue header file.
+ *
+ * Fixed-size slots, each with a sequence word that says whose turn it is:
+ * slot i of lap n is free for the producer of position p = n * capacity
+ * + i while its sequence is p, and filled for the consumer of p while it
+ * is p + 1. A producer claims a position with one compare-and-swap on
+ * the enqueue counter, copies the data, then publishes the slot by
+ * writing its sequence; consumers mirror this on the dequeue counter.
+ * Everything is built on ATOMIC_Ops.h, so ISRs of any priority and the
+ * main loop may push and pop concurrently without masking interrupts.
+ *
+ * Nothing ever waits for another context: a slot claimed by a context
+ * that was preempted before publishing it simply reads as empty (for a
+ * consumer) or full (for a producer) until that context resumes, and
+ * the call returns at once.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef QUEUE_MPMC_H_
+#define QUEUE_MPMC_H_
+
+#include <stdint.h>
+#include "ATOMIC_Ops.h"
+#include "Driver_Common.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/**
+ * @brief Queue instance, storage allocated by the caller.
+ */
+typedef struct
+{
+    uint8_t        *buffer;         /**< capacity * slotSize bytes        */
+    ATOMIC_U32     *sequence;       /**< capacity words                   */
+    uint32_t        slotSize;       /**< Bytes per slot                   */
+    uint32_t        mask;           /**< capacity - 1                     */
+    ATOMIC_U32      enqueuePos;     /**< Next position to produce         */
+    ATOMIC_U32      dequeuePos;     /**< Next position to consume         */
+} QUEUE_Mpmc_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up an empty queue.
+ *
+ * @param   buffer      capacity * slotSize bytes.
+ * @param   sequence    capacity words.
+ * @param   capacity    Slots, power of two, 2 or more.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+int32_t QUEUE_Mpmc_Init(QUEUE_Mpmc_t *queue, void *buffer, ATOMIC_U32 *sequence, uint32_t slotSize,
+                        uint32_t capacity);
+
+/*******************************************************************************
+ * @brief   Copy one slot in; any context.
+ *
+ * @return  1 pushed, 0 queue full.
+ ******************************************************************************/
+uint8_t QUEUE_Mpmc_Push(QUEUE_Mpmc_t *queue, const void *data);
+
+/*******************************************************************************
+ * @brief   Copy one slot out; any context.
+ *
+ * @return  1 popped, 0 queue empty.
+ ******************************************************************************/
+uint8_t QUEUE_Mpmc_Pop(QUEUE_Mpmc_t *queue, void *data);
+
+/*******************************************************************************
+ * @brief   Claimed slots, a snapshot while others run.
+ ******************************************************************************/
+uint32_t QUEUE_Mpmc_Count(QUEUE_Mpmc_t *queue);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* QUEUE_MPMC_H_ */
@@ -0,0 +1,348 @@
+/*******************************************************************************
+ * @file    RING_Spsc.h
+ * @brief   Lock-free single-producer / single-consumer ring buffer header file.
+ *
+ * One side (typically an ISR) pushes fixed-size slots, the other (the main
+ * loop) pops them; neither disables interrupts. Each index is written by
+ * one side only and read by the other:
+ * - head: slots written so far, advanced by the producer after the data;
+ * - tail: slots read so far, advanced by the consumer after the data.
+ * Both run freely and wrap at 2^32, count = head - tail, and the capacity
+ * is a power of two so that the slot of an index is index & mask.
+ *
+ * Ordering: the producer issues a DMB between writing the slots and
+ * publishing head, the consumer one between reading head and the slots,
+ * and one between reading the slots and releasing them via tail. On a
+ * host the index accesses are C11 acquire loads / release stores instead,
+ * so the code can be stress tested with threads.
+ *
+ * Layout: the instance is aligned to RING_SPSC_LINE_BYTES. The first line
+ * holds the fields fixed at init; head and tail each start their own line,
+ * together with the opposite index as last seen by their writer, so that a
+ * side reads the other side's line only when its cached view runs out.
+ * Slots are RING_SPSC_SLOT_LINES(slotSize) bytes apart in a line aligned
+ * buffer, so the slot being filled and the slot being read never share a
+ * line either.
+ *
+ * Spans: RING_Spsc_WriteSpan() / RING_Spsc_ReadSpan() return the longest
+ * contiguous run of free / filled slots for in-place access (zero copy,
+ * e.g. as a DMA buffer; slots ring->stride bytes apart), published with
+ * RING_Spsc_Commit() / RING_Spsc_Release().
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef RING_SPSC_H_
+#define RING_SPSC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Driver_Common.h"
+
+#ifdef  __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if defined (__ARM_ARCH_7EM__) || defined (__ARM_ARCH_7M__)
+#define RING_SPSC_DMB()         __asm volatile ("dmb" : : : "memory")
+#define RING_SPSC_LOAD(p)       __atomic_load_n((p), __ATOMIC_RELAXED)        /**< Plain LDR */
+#define RING_SPSC_STORE(p, v)   __atomic_store_n((p), (v), __ATOMIC_RELAXED)  /**< Plain STR */
+#ifndef RING_SPSC_LINE_BYTES
+#define RING_SPSC_LINE_BYTES    (16U)       /**< LMEM cache line; SRAM itself is not cached */
+#endif
+#else
+#define RING_SPSC_DMB()         __atomic_signal_fence(__ATOMIC_SEQ_CST)
+#define RING_SPSC_LOAD(p)       __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define RING_SPSC_STORE(p, v)   __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#ifndef RING_SPSC_LINE_BYTES
+#define RING_SPSC_LINE_BYTES    (64U)       /**< Host cache line */
+#endif
+#endif
+
+#define RING_SPSC_ALIGNED      __attribute__((aligned(RING_SPSC_LINE_BYTES)))
+
+/* Slot size rounded up to whole lines: the distance between two slots */
+#define RING_SPSC_SLOT_LINES(bytes) \
+    ((((uint32_t)(bytes) + RING_SPSC_LINE_BYTES - 1U) / RING_SPSC_LINE_BYTES) * RING_SPSC_LINE_BYTES)
+
+/* Buffer bytes for a ring, to be declared RING_SPSC_ALIGNED */
+#define RING_SPSC_BUFFER_SIZE(bytes, capacity)  (RING_SPSC_SLOT_LINES(bytes) * (uint32_t)(capacity))
+
+/**
+ * @brief Ring instance, storage allocated by the caller.
+ */
+typedef struct
+{
+    uint8_t    *buffer;         /**< RING_SPSC_BUFFER_SIZE() bytes, line aligned */
+    uint32_t    slotSize;       /**< Bytes per slot                             */
+    uint32_t    stride;         /**< Bytes between slots, whole lines           */
+    uint32_t    mask;           /**< capacity - 1                               */
+
+    /* Producer line */
+    uint32_t    head RING_SPSC_ALIGNED;     /**< Slots written                  */
+    uint32_t    tailCache;                  /**< tail as last read              */
+
+    /* Consumer line */
+    uint32_t    tail RING_SPSC_ALIGNED;     /**< Slots read                     */
+    uint32_t    headCache;                  /**< head as last read              */
+} RING_SPSC_ALIGNED RING_Spsc_t;
+
+_Static_assert(offsetof(RING_Spsc_t, head) == RING_SPSC_LINE_BYTES, "RING_Spsc_t: fixed fields exceed a line");
+_Static_assert(offsetof(RING_Spsc_t, tailCache) < (2U * RING_SPSC_LINE_BYTES), "RING_Spsc_t: producer group");
+_Static_assert(offsetof(RING_Spsc_t, tail) == (2U * RING_SPSC_LINE_BYTES), "RING_Spsc_t: consumer line");
+_Static_assert(offsetof(RING_Spsc_t, headCache) < (3U * RING_SPSC_LINE_BYTES), "RING_Spsc_t: consumer group");
+_Static_assert(sizeof(RING_Spsc_t) == (3U * RING_SPSC_LINE_BYTES), "RING_Spsc_t: line multiple");
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   Set up an empty ring.
+ *
+ * @param   buffer      RING_SPSC_BUFFER_SIZE(slotSize, capacity) bytes,
+ *                      RING_SPSC_ALIGNED.
+ * @param   capacity    Slots, power of two.
+ *
+ * @return  ARM_DRIVER_OK, ARM_DRIVER_ERROR_PARAMETER.
+ ******************************************************************************/
+static inline int32_t RING_Spsc_Init(RING_Spsc_t *ring, void *buffer, uint32_t slotSize, uint32_t capacity)
+{
+    int32_t result;
+
+    if ((NULL == ring) || (NULL == buffer) || (0U == slotSize) || (0U == capacity) ||
+        (0U != (capacity & (capacity - 1U))) || (0U != ((uintptr_t)buffer & (RING_SPSC_LINE_BYTES - 1U))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        ring->buffer    = (uint8_t *)buffer;
+        ring->slotSize  = slotSize;
+        ring->stride    = RING_SPSC_SLOT_LINES(slotSize);
+        ring->mask      = capacity - 1U;
+        ring->head      = 0U;
+        ring->tailCache = 0U;
+        ring->tail      = 0U;
+        ring->headCache = 0U;
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * @brief   Filled slots, a snapshot while the other side runs.
+ ******************************************************************************/
+static inline uint32_t RING_Spsc_Count(const RING_Spsc_t *ring)
+{
+    return RING_SPSC_LOAD(&ring->head) - RING_SPSC_LOAD(&ring->tail);
+}
+
+/*******************************************************************************
+ * @brief   Producer: longest contiguous run of free slots.
+ *
+ * @param   count       Out: slots in the span, 0 when full.
+ *
+ * @return  First free slot, the next ones ring->stride bytes apart.
+ ******************************************************************************/
+static inline void *RING_Spsc_WriteSpan(RING_Spsc_t *ring, uint32_t *count)
+{
+    uint32_t head;
+    uint32_t free;
+    uint32_t toEnd;
+
+    head = ring->head;
+    free = ring->mask + 1U - (head - ring->tailCache);
+
+    if (0U == free)
+    {
+        /* Cached view full: look at the consumer's line */
+        ring->tailCache = RING_SPSC_LOAD(&ring->tail);
+        free = ring->mask + 1U - (head - ring->tailCache);
+
+        /* The consumer is done with the slots before they are overwritten */
+        RING_SPSC_DMB();
+    }
+    else
+    {
+        /* Room known from an earlier read, already ordered by its DMB */
+    }
+
+    toEnd  = ring->mask + 1U - (head & ring->mask);
+    *count = (free < toEnd) ? free : toEnd;
+
+    return &ring->buffer[(head & ring->mask) * ring->stride];
+}
+
+/*******************************************************************************
+ * @brief   Producer: publish count slots written through the span.
+ ******************************************************************************/
+static inline void RING_Spsc_Commit(RING_Spsc_t *ring, uint32_t count)
+{
+    /* Slot data visible before the index that announces it */
+    RING_SPSC_DMB();
+    RING_SPSC_STORE(&ring->head, ring->head + count);
+}
+
+/*******************************************************************************
+ * @brief   Consumer: longest contiguous run of filled slots.
+ *
+ * @param   count       Out: slots in the span, 0 when empty.
+ *
+ * @return  First filled slot, the next ones ring->stride bytes apart.
+ ******************************************************************************/
+static inline const void *RING_Spsc_ReadSpan(RING_Spsc_t *ring, uint32_t *count)
+{
+    uint32_t tail;
+    uint32_t used;
+    uint32_t toEnd;
+
+    tail = ring->tail;
+    used = ring->headCache - tail;
+
+    if (0U == used)
+    {
+        /* Cached view empty: look at the producer's line */
+        ring->headCache = RING_SPSC_LOAD(&ring->head);
+        used = ring->headCache - tail;
+
+        /* Index read before the slot data it announces */
+        RING_SPSC_DMB();
+    }
+    else
+    {
+        /* Slots known from an earlier read, already ordered by its DMB */
+    }
+
+    toEnd  = ring->mask + 1U - (tail & ring->mask);
+    *count = (used < toEnd) ? used : toEnd;
+
+    return &ring->buffer[(tail & ring->mask) * ring->stride];
+}
+
+/*******************************************************************************
+ * @brief   Consumer: hand count slots read through the span back.
+ ******************************************************************************/
+static inline void RING_Spsc_Release(RING_Spsc_t *ring, uint32_t count)
+{
+    /* Slot data read before the producer may reuse the slots */
+    RING_SPSC_DMB();
+    RING_SPSC_STORE(&ring->tail, ring->tail + count);
+}
+
+/*******************************************************************************
+ * @brief   Producer: copy up to count slots in, in at most two spans.
+ *
+ * @return  Slots pushed, less than count when the ring fills up.
+ ******************************************************************************/
+static inline uint32_t RING_Spsc_PushBatch(RING_Spsc_t *ring, const void *data, uint32_t count)
+{
+    const uint8_t *src;
+    uint32_t done;
+    uint32_t span;
+    uint32_t step;
+    uint32_t i;
+    uint8_t *slot;
+
+    src  = (const uint8_t *)data;
+    done = 0U;
+
+    /* Second pass only after a wrap of the buffer end */
+    do
+    {
+        slot = (uint8_t *)RING_Spsc_WriteSpan(ring, &span);
+        step = ((count - done) < span) ? (count - done) : span;
+
+        if (0U != step)
+        {
+            for (i = 0U; i < step; i++)
+            {
+                __builtin_memcpy(&slot[i * ring->stride], &src[(done + i) * ring->slotSize], ring->slotSize);
+            }
+
+            RING_Spsc_Commit(ring, step);
+            done += step;
+        }
+        else
+        {
+            /* Full */
+        }
+    } while ((0U != step) && (done < count));
+
+    return done;
+}
+
+/*******************************************************************************
+ * @brief   Consumer: copy up to count slots out, in at most two spans.
+ *
+ * @return  Slots popped, less than count when the ring runs empty.
+ ******************************************************************************/
+static inline uint32_t RING_Spsc_PopBatch(RING_Spsc_t *ring, void *data, uint32_t count)
+{
+    uint8_t *dst;
+    uint32_t done;
+    uint32_t span;
+    uint32_t step;
+    uint32_t i;
+    const uint8_t *slot;
+
+    dst  = (uint8_t *)data;
+    done = 0U;
+
+    do
+    {
+        slot = (const uint8_t *)RING_Spsc_ReadSpan(ring, &span);
+        step = ((count - done) < span) ? (count - done) : span;
+
+        if (0U != step)
+        {
+            for (i = 0U; i < step; i++)
+            {
+                __builtin_memcpy(&dst[(done + i) * ring->slotSize], &slot[i * ring->stride], ring->slotSize);
+            }
+
+            RING_Spsc_Release(ring, step);
+            done += step;
+        }
+        else
+        {
+            /* Empty */
+        }
+    } while ((0U != step) && (done < count));
+
+    return done;
+}
+
+/*******************************************************************************
+ * @brief   Producer: copy one slot in.
+ *
+ * @return  1 pushed, 0 ring full.
+ ******************************************************************************/
+static inline uint8_t RING_Spsc_Push(RING_Spsc_t *ring, const void *data)
+{
+    return (uint8_t)RING_Spsc_PushBatch(ring, data, 1U);
+}
+
+/*******************************************************************************
+ * @brief   Consumer: copy one slot out.
+ *
+ * @return  1 popped, 0 ring empty.
+ ******************************************************************************/
+static inline uint8_t RING_Spsc_Pop(RING_Spsc_t *ring, void *data)
+{
+    return (uint8_t)RING_Spsc_PopBatch(ring, data, 1U);
+}
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* RING_SPSC_H_ */
@@ -9,6 +9,7 @@
 #define _APP_H_
 
 #include "Driver_GPIO.h"
+#include "FTM_Pwm.h"
 
 /*******************************************************************************
  * Definitions
@@ -19,12 +20,20 @@
 
 #define GPIO_PIN(port, pin)  (((port) << 8) | (pin))
 
-#define LED_RED              GPIO_PIN(3U, 15U)
-#define LED_BLUE             GPIO_PIN(3U, 0U)
 #define BUTTON_0             GPIO_PIN(2U, 13U)
 #define BUTTON_1             GPIO_PIN(2U, 12U)
 
 #define DEBOUNCE_THRESHOLD   (2U)    /**< Consecutive samples required for state change */
+#define DEBOUNCE_PERIOD_MS   (10U)   /**< Button sampling period */
+
+/* LEDs on FTM0 PWM (PTD15 = FTM0_CH0, PTD0 = FTM0_CH2, ALT2), active low */
+#define LED_PWM_INSTANCE     (HAL_FTM_0)
+#define LED_PWM_FREQUENCY    (250UL)     /**< Hz, one ramp step per period */
+#define LED_PWM_PIN_MUX      (2U)
+#define LED_RED_CHANNEL      (0U)
+#define LED_BLUE_CHANNEL     (2U)
+#define LED_TRIGGER_CHANNEL  (7U)        /**< No pin, requests the ramp DMA */
+#define LED_BREATH_STEPS     (512U)      /**< Fade in then out, about 2 s */
 
 /*******************************************************************************
  * Variables
@@ -54,9 +63,9 @@ typedef struct
  */
 typedef enum
 {
-    LED_STATE_IDLE = 0U,   /**< No LED blinking. */
-    LED_STATE_RED_BLINK,   /**< Red LED is blinking. */
-    LED_STATE_BLUE_BLINK   /**< Blue LED is blinking. */
+    LED_STATE_IDLE = 0U,   /**< Both LEDs off. */
+    LED_STATE_RED_BLINK,   /**< Red LED is breathing. */
+    LED_STATE_BLUE_BLINK   /**< Blue LED is breathing. */
 } LedState_t;
 
 /*******************************************************************************
@@ -72,13 +81,14 @@ typedef enum
 void delay(uint32_t delayMs);
 
 /**
- * @brief Blink an LED pin.
+ * @brief Set up the LED PWM and the breathing ramp, LEDs off.
  *
- * @param[in] pin     GPIO pin encoded with GPIO_PIN().
- * @param[in] time    Blink duration in milliseconds.
- * @return    None
+ * The ramp is streamed into the duty of the active LED by DMA, one step
+ * per PWM period, without CPU work.
+ *
+ * @return    ARM_DRIVER_OK, or the error of the FTM_Pwm step that failed.
  */
-void blink_LED(uint32_t pin, uint32_t time);
+int32_t LED_Init(void);
 
 /**
  * @brief Update LED FSM (Finite State Machine).
@@ -87,7 +97,9 @@ void blink_LED(uint32_t pin, uint32_t time);
  * - Button debounce
  * - Button press event detection
  * - FSM state update
- * - LED output control
+ * - LED output control (on state change only)
+ *
+ * It waits DEBOUNCE_PERIOD_MS per call, the button sampling period.
  *
  * @return None
  */
@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * @file    ADC_Scan.c
+ * @brief   Periodic multi-channel ADC scan with PDB sequencing and eDMA
+ *          double buffer C file.
+ *
+ * DMA minor loop = one scan: inputCount 16-bit reads of R0, R1, ... then
+ * the minor loop offset moves the source back to R0. The major loop
+ * covers both halves; the half and major interrupts hand them out and
+ * the last destination adjustment returns to the start of the buffer.
+ *
+ * The PDB DMA request is set at the end of the period (IDLY = MOD), so
+ * the scan must end before it: the scan time estimate is checked
+ * against the period by ADC_Scan_Init().
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "ADC_Scan.h"
+#include "HAL_PDB.h"
+#include "HAL_DMA.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ADC_SCAN_CONV_OVERHEAD      (8UL)       /**< ADCK cycles per conversion besides sample and compare, rounded up */
+#define ADC_SCAN_DMA_MAX_COUNT      (32767UL)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t ADC_EstimateScanNs(const ADC_ScanConfig_t *config);
+static void ADC_DmaCallback(uint8_t channel, uint32_t event, void *param);
+static void ADC_LatencyCallback(uint8_t slot, void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t ADC_Scan_Init(ADC_Scan_t *scan, const ADC_ScanConfig_t *config)
+{
+    HAL_PDB_Instance_t pdb;
+    uint32_t period;
+    uint16_t modulus;
+    int32_t result;
+    uint8_t i;
+
+    if ((NULL == scan) || (NULL == config) || (NULL == config->input) || (NULL == config->buffer) ||
+        (NULL == config->callback) || ((uint32_t)config->instance >= (uint32_t)HAL_ADC_MAX) ||
+        (0U == config->inputCount) || (config->inputCount > ADC_SCAN_INPUT_MAX) ||
+        (0U == config->frames) || ((2UL * config->frames) > ADC_SCAN_DMA_MAX_COUNT) || (0U == config->rate))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        pdb = (HAL_PDB_Instance_t)config->instance;
+
+        scan->config               = config;
+        scan->running              = 0U;
+        scan->stats.halves         = 0U;
+        scan->stats.latencyNs      = 0U;
+        scan->stats.sequenceErrors = 0U;
+
+        /* Converter: calibrated at the conversion settings, slots in scan order */
+        HAL_ADC_Init(config->instance);
+        HAL_ADC_Configure(config->instance, &config->adc);
+        HAL_ADC_Calibrate(config->instance);
+
+        for (i = 0U; i < config->inputCount; i++)
+        {
+            HAL_ADC_SetSlot(config->instance, i, config->input[i], 0U);
+        }
+
+        HAL_ADC_SetTrigger(config->instance, 1U, 0U);
+
+        /* Sequencer: period, back-to-back chain, DMA request at the end */
+        HAL_PDB_Init(pdb);
+        scan->tickHz = HAL_PDB_SetRate(pdb, config->rate);
+        modulus      = HAL_PDB_GetModulus(pdb);
+        HAL_PDB_SetChain(pdb, config->inputCount, 0U);
+        HAL_PDB_SetDmaDelay(pdb, modulus);
+
+        scan->stats.rate       = (0U != scan->tickHz) ? (scan->tickHz / ((uint32_t)modulus + 1U)) : 0U;
+        scan->stats.scanTimeNs = ADC_EstimateScanNs(config);
+        period                 = (0U != scan->stats.rate) ? (1000000000UL / scan->stats.rate) : 0U;
+
+        if (0U == scan->tickHz)
+        {
+            result = ARM_DRIVER_ERROR_PARAMETER;
+        }
+        else if ((scan->stats.scanTimeNs + (scan->stats.scanTimeNs / 8U)) >= period)
+        {
+            /* 1/8 margin on the estimate */
+            result = ADC_SCAN_ERROR_RATE;
+        }
+        else
+        {
+            HAL_DMA_Init();
+            scan->channel = HAL_DMA_AllocChannel();
+
+            if (HAL_DMA_CHANNEL_INVALID == scan->channel)
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                HAL_DMA_SetRequestSource(scan->channel, (HAL_PDB_0 == pdb) ? EDMA_REQ_PDB0 : EDMA_REQ_PDB1);
+                HAL_DMA_RegisterCallback(scan->channel, ADC_DmaCallback, (void *)scan);
+                result = ARM_DRIVER_OK;
+            }
+        }
+    }
+
+    return result;
+}
+
+int32_t ADC_Scan_Start(ADC_Scan_t *scan)
+{
+    const ADC_ScanConfig_t *config;
+    HAL_DMA_Transfer_t transfer;
+    int32_t result;
+
+    if ((NULL == scan) || (NULL == scan->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        config = scan->config;
+
+        transfer.srcAddr    = HAL_ADC_GetResultAddress(config->instance, 0U);
+        transfer.dstAddr    = (uint32_t)config->buffer;
+        transfer.srcOffset  = 4;
+        transfer.dstOffset  = 2;
+        transfer.srcSize    = HAL_DMA_SIZE_16BIT;
+        transfer.dstSize    = HAL_DMA_SIZE_16BIT;
+        transfer.minorBytes = 2UL * config->inputCount;
+        transfer.majorCount = (uint16_t)(2U * config->frames);
+        transfer.srcLastAdj = 0;
+        transfer.dstLastAdj = -(int32_t)(4UL * config->frames * config->inputCount);
+        transfer.flags      = HAL_DMA_FLAG_INT_HALF | HAL_DMA_FLAG_INT_MAJOR;
+
+        HAL_DMA_DisableRequest(scan->channel);
+        HAL_DMA_ConfigTransfer(scan->channel, &transfer);
+        HAL_DMA_SetMinorLoopOffset(scan->channel, -(int32_t)(4UL * config->inputCount), HAL_DMA_MLOFF_SRC);
+        HAL_DMA_EnableRequest(scan->channel);
+
+        scan->running = 1U;
+        HAL_PDB_Start((HAL_PDB_Instance_t)config->instance, HAL_PDB_TRIGGER_SOFTWARE);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t ADC_Scan_Stop(ADC_Scan_t *scan)
+{
+    int32_t result;
+
+    if ((NULL == scan) || (NULL == scan->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        HAL_PDB_Stop((HAL_PDB_Instance_t)scan->config->instance);
+        HAL_DMA_DisableRequest(scan->channel);
+        scan->running = 0U;
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t ADC_Scan_MeasureLatency(ADC_Scan_t *scan)
+{
+    const ADC_ScanConfig_t *config;
+    int32_t result;
+    uint8_t last;
+
+    if ((NULL == scan) || (NULL == scan->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        config = scan->config;
+        last   = config->inputCount - 1U;
+
+        HAL_ADC_RegisterCallback(config->instance, ADC_LatencyCallback, (void *)scan);
+        HAL_ADC_SetSlot(config->instance, last, config->input[last], 1U);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+void ADC_Scan_GetStats(ADC_Scan_t *scan, ADC_ScanStats_t *stats)
+{
+    if ((NULL != scan) && (NULL != scan->config) && (NULL != stats))
+    {
+        if (0U != HAL_PDB_GetSequenceErrors((HAL_PDB_Instance_t)scan->config->instance))
+        {
+            scan->stats.sequenceErrors++;
+        }
+        else
+        {
+            /* Every pre-trigger acknowledged in time */
+        }
+
+        *stats = scan->stats;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+static uint32_t ADC_EstimateScanNs(const ADC_ScanConfig_t *config)
+{
+    uint32_t bits;
+    uint32_t cycles;
+    uint32_t adckMHz;
+
+    bits = (HAL_ADC_RESOLUTION_8BIT == config->adc.resolution) ? 8UL :
+           ((HAL_ADC_RESOLUTION_10BIT == config->adc.resolution) ? 10UL : 12UL);
+
+    /* Sample + one cycle per bit + overhead, repeated for each averaged sample */
+    cycles  = ((uint32_t)config->adc.sampleCycles + bits + ADC_SCAN_CONV_OVERHEAD);
+    cycles  = (HAL_ADC_AVERAGE_NONE != config->adc.average) ? (cycles << (config->adc.average + 1U)) : cycles;
+    cycles *= config->inputCount;
+    adckMHz = (HAL_ADC_CLOCK_HZ / 1000000UL) >> config->adc.divider;
+
+    return (cycles * 1000UL) / adckMHz;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void ADC_DmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    const ADC_ScanConfig_t *config;
+    ADC_Scan_t *scan;
+
+    (void)channel;
+
+    scan   = (ADC_Scan_t *)param;
+    config = scan->config;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        HAL_PDB_Stop((HAL_PDB_Instance_t)config->instance);
+        scan->running = 0U;
+    }
+    else
+    {
+        scan->stats.halves++;
+        config->callback((0U != (event & HAL_DMA_EVENT_HALF_DONE)) ? config->buffer :
+                         &config->buffer[(uint32_t)config->frames * config->inputCount],
+                         config->frames, config->param);
+    }
+}
+
+static void ADC_LatencyCallback(uint8_t slot, void *param)
+{
+    const ADC_ScanConfig_t *config;
+    ADC_Scan_t *scan;
+    uint16_t ticks;
+
+    scan   = (ADC_Scan_t *)param;
+    config = scan->config;
+    ticks  = HAL_PDB_GetCounter((HAL_PDB_Instance_t)config->instance);
+
+    /* One shot: the result is left for DMA */
+    HAL_ADC_SetSlot(config->instance, slot, config->input[slot], 0U);
+    HAL_ADC_RegisterCallback(config->instance, NULL, NULL);
+
+    scan->stats.latencyNs = (uint32_t)(((uint64_t)ticks * 1000000000ULL) / scan->tickHz);
+}
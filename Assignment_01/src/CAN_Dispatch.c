@@ -0,0 +1,334 @@
+/*******************************************************************************
+ * @file    CAN_Dispatch.c
+ * @brief   CAN receive dispatch table C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "CAN_Dispatch.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CAN_DISPATCH_STD_ID_MASK    (0x000007FFUL)
+#define CAN_DISPATCH_EXT_ID_MASK    (0x1FFFFFFFUL)
+#define CAN_DISPATCH_PAYLOAD_MAX    (64U)
+#define CAN_DISPATCH_NO_ENTRY       (0xFFFFU)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint8_t  Dispatch_IsExact(const CAN_DispatchEntry_t *entry);
+static uint32_t Dispatch_Key(uint32_t id);
+static uint32_t Dispatch_GroupMask(const CAN_DispatchEntry_t *entry);
+static uint8_t  Dispatch_FindGroup(const CAN_DispatchGroup_t *groups, uint8_t groupCount, uint32_t mask);
+static uint16_t Dispatch_LowerBound(const CAN_Dispatch_t *table, uint16_t first, uint16_t count, uint32_t mask,
+                                    uint32_t key);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t CAN_Dispatch_Build(CAN_Dispatch_t *table, const CAN_DispatchEntry_t *entries, uint16_t count,
+                           uint16_t *index)
+{
+    int32_t result;
+    CAN_DispatchGroup_t groups[CAN_DISPATCH_GROUPS_MAX];
+    CAN_DispatchGroup_t *group;
+    uint16_t exactCount;
+    uint16_t maskedCount;
+    uint16_t first;
+    uint8_t groupCount;
+    uint8_t g;
+    uint16_t i;
+    uint16_t j;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == table) || ((0U != count) && ((NULL == entries) || (NULL == index))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        exactCount  = 0U;
+        maskedCount = 0U;
+        groupCount  = 0U;
+
+        /* Exact entries go to the front by insertion sort, masked ones are counted per mask. */
+        for (i = 0U; (i < count) && (ARM_DRIVER_OK == result); i++)
+        {
+            if (0U != Dispatch_IsExact(&entries[i]))
+            {
+                for (j = exactCount;
+                     (j > 0U) && (Dispatch_Key(entries[index[j - 1U]].id) > Dispatch_Key(entries[i].id));
+                     j--)
+                {
+                    index[j] = index[j - 1U];
+                }
+
+                if ((j > 0U) && (Dispatch_Key(entries[index[j - 1U]].id) == Dispatch_Key(entries[i].id)))
+                {
+                    /* Same identifier twice: ambiguous */
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+                else
+                {
+                    index[j] = i;
+                    exactCount++;
+                }
+            }
+            else
+            {
+                g = Dispatch_FindGroup(groups, groupCount, Dispatch_GroupMask(&entries[i]));
+
+                if (g < groupCount)
+                {
+                    groups[g].count++;
+                    maskedCount++;
+                }
+                else if (groupCount < CAN_DISPATCH_GROUPS_MAX)
+                {
+                    groups[groupCount].mask  = Dispatch_GroupMask(&entries[i]);
+                    groups[groupCount].count = 1U;
+                    groupCount++;
+                    maskedCount++;
+                }
+                else
+                {
+                    /* Too many distinct masks */
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+            }
+        }
+
+        if (ARM_DRIVER_OK == result)
+        {
+            /* Groups follow the exact entries, each one filled again below. */
+            first = exactCount;
+
+            for (g = 0U; g < groupCount; g++)
+            {
+                groups[g].first = first;
+                first = (uint16_t)(first + groups[g].count);
+                groups[g].count = 0U;
+            }
+
+            /* Sorted on the masked identifier; equal keys keep table order, so the first one wins. */
+            for (i = 0U; i < count; i++)
+            {
+                if (0U == Dispatch_IsExact(&entries[i]))
+                {
+                    group = &groups[Dispatch_FindGroup(groups, groupCount, Dispatch_GroupMask(&entries[i]))];
+
+                    for (j = group->count;
+                         (j > 0U) && ((Dispatch_Key(entries[index[group->first + j - 1U]].id) & group->mask) >
+                                      (Dispatch_Key(entries[i].id) & group->mask));
+                         j--)
+                    {
+                        index[group->first + j] = index[group->first + j - 1U];
+                    }
+
+                    index[group->first + j] = i;
+                    group->count++;
+                }
+                else
+                {
+                    /* Already sorted in */
+                }
+            }
+
+            table->entries     = entries;
+            table->index       = index;
+            table->exactCount  = exactCount;
+            table->maskedCount = maskedCount;
+            table->groupCount  = groupCount;
+
+            for (g = 0U; g < groupCount; g++)
+            {
+                table->groups[g] = groups[g];
+            }
+        }
+        else
+        {
+            table->exactCount  = 0U;
+            table->maskedCount = 0U;
+            table->groupCount  = 0U;
+        }
+    }
+
+    return result;
+}
+
+const CAN_DispatchEntry_t *CAN_Dispatch_Lookup(const CAN_Dispatch_t *table, uint32_t id)
+{
+    const CAN_DispatchEntry_t *entry;
+    const CAN_DispatchGroup_t *group;
+    uint32_t key;
+    uint16_t position;
+    uint16_t best;
+    uint8_t g;
+
+    entry = NULL;
+    key   = Dispatch_Key(id);
+
+    /* Binary search over the exact identifiers: at most log2(n) + 1 probes. */
+    position = Dispatch_LowerBound(table, 0U, table->exactCount, CAN_DISPATCH_MASK_EXACT, key);
+
+    if ((position < table->exactCount) && (Dispatch_Key(table->entries[table->index[position]].id) == key))
+    {
+        entry = &table->entries[table->index[position]];
+    }
+    else
+    {
+        /* One binary search per mask group; the match earliest in the table wins. */
+        best = CAN_DISPATCH_NO_ENTRY;
+
+        for (g = 0U; g < table->groupCount; g++)
+        {
+            group    = &table->groups[g];
+            position = Dispatch_LowerBound(table, group->first, group->count, group->mask, key);
+
+            if ((position < (group->first + group->count)) &&
+                (0U == ((Dispatch_Key(table->entries[table->index[position]].id) ^ key) & group->mask)) &&
+                (table->index[position] < best))
+            {
+                best = table->index[position];
+            }
+            else
+            {
+                /* No match in this group, or a later entry */
+            }
+        }
+
+        entry = (CAN_DISPATCH_NO_ENTRY != best) ? &table->entries[best] : NULL;
+    }
+
+    return entry;
+}
+
+int32_t CAN_Dispatch_Receive(const CAN_Dispatch_t *table, ARM_DRIVER_CAN *driver, uint32_t obj_idx)
+{
+    int32_t result;
+    int32_t size;
+    int32_t frames;
+    ARM_CAN_MSG_INFO msgInfo;
+    uint8_t data[CAN_DISPATCH_PAYLOAD_MAX];
+    const CAN_DispatchEntry_t *entry;
+
+    frames = 0;
+    size   = 0;
+
+    if ((NULL == table) || (NULL == driver))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        while (size >= 0)
+        {
+            size = driver->MessageRead(obj_idx, &msgInfo, data, (uint8_t)sizeof(data));
+
+            if (size >= 0)
+            {
+                frames++;
+                entry = CAN_Dispatch_Lookup(table, msgInfo.id);
+
+                if ((NULL != entry) && (NULL != entry->handler))
+                {
+                    entry->handler(&msgInfo, data, (uint8_t)size, entry->layout);
+                }
+                else
+                {
+                    /* No route: drop */
+                }
+            }
+            else
+            {
+                /* Object drained or error */
+            }
+        }
+
+        result = ((ARM_CAN_NO_MESSAGE_AVAILABLE == size) || (0 != frames)) ? frames : size;
+    }
+
+    return result;
+}
+
+static uint8_t Dispatch_IsExact(const CAN_DispatchEntry_t *entry)
+{
+    uint32_t idMask;
+
+    idMask = (0U != (entry->id & ARM_CAN_ID_IDE_Msk)) ? CAN_DISPATCH_EXT_ID_MASK : CAN_DISPATCH_STD_ID_MASK;
+
+    return ((entry->mask & idMask) == idMask) ? 1U : 0U;
+}
+
+static uint32_t Dispatch_Key(uint32_t id)
+{
+    uint32_t key;
+
+    /* Drop bits outside the identifier so equal frames always give equal keys. */
+    if (0U != (id & ARM_CAN_ID_IDE_Msk))
+    {
+        key = ARM_CAN_ID_IDE_Msk | (id & CAN_DISPATCH_EXT_ID_MASK);
+    }
+    else
+    {
+        key = id & CAN_DISPATCH_STD_ID_MASK;
+    }
+
+    return key;
+}
+
+static uint32_t Dispatch_GroupMask(const CAN_DispatchEntry_t *entry)
+{
+    uint32_t idMask;
+
+    /* Frame format always compared: a standard filter never matches an extended frame. */
+    idMask = (0U != (entry->id & ARM_CAN_ID_IDE_Msk)) ? CAN_DISPATCH_EXT_ID_MASK : CAN_DISPATCH_STD_ID_MASK;
+
+    return ARM_CAN_ID_IDE_Msk | (entry->mask & idMask);
+}
+
+static uint8_t Dispatch_FindGroup(const CAN_DispatchGroup_t *groups, uint8_t groupCount, uint32_t mask)
+{
+    uint8_t g;
+
+    for (g = 0U; (g < groupCount) && (mask != groups[g].mask); g++)
+    {
+        /* Keep searching */
+    }
+
+    return g;
+}
+
+static uint16_t Dispatch_LowerBound(const CAN_Dispatch_t *table, uint16_t first, uint16_t count, uint32_t mask,
+                                    uint32_t key)
+{
+    uint16_t low;
+    uint16_t high;
+    uint16_t middle;
+
+    low  = first;
+    high = (uint16_t)(first + count);
+
+    /* First slot whose masked key is not below the masked key searched for */
+    while (low < high)
+    {
+        middle = (uint16_t)(low + ((high - low) / 2U));
+
+        if ((Dispatch_Key(table->entries[table->index[middle]].id) & mask) < (key & mask))
+        {
+            low = (uint16_t)(middle + 1U);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * @file    CAN_Gateway.c
+ * @brief   CAN gateway between the FlexCAN controllers C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "CAN_Gateway.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CAN_GATEWAY_PAYLOAD_MAX     (64U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void Gateway_Send(CAN_GatewayPort_t *port, ARM_CAN_MSG_INFO *msgInfo, const uint8_t *data, uint8_t size);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t CAN_Gateway_Init(CAN_Gateway_t *gateway, const CAN_GatewayPortConfig_t *config, uint8_t portCount)
+{
+    int32_t result;
+    CAN_GatewayPort_t *port;
+    uint8_t i;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == gateway) || (NULL == config) || (0U == portCount) || (portCount > CAN_GATEWAY_PORT_MAX))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        gateway->portCount = portCount;
+
+        for (i = 0U; (i < portCount) && (ARM_DRIVER_OK == result); i++)
+        {
+            port = &gateway->port[i];
+
+            port->config    = &config[i];
+            port->received  = 0U;
+            port->forwarded = 0U;
+            port->noRoute   = 0U;
+            port->dropped   = 0U;
+
+            if (NULL == config[i].driver)
+            {
+                /* Unused port: empty table */
+                port->table.exactCount  = 0U;
+                port->table.maskedCount = 0U;
+            }
+            else if (0U == config[i].txCount)
+            {
+                result = ARM_DRIVER_ERROR_PARAMETER;
+            }
+            else
+            {
+                result = CAN_Dispatch_Build(&port->table, config[i].routes, config[i].routeCount, config[i].index);
+            }
+        }
+    }
+
+    return result;
+}
+
+int32_t CAN_Gateway_Forward(CAN_Gateway_t *gateway, uint8_t port)
+{
+    int32_t result;
+    int32_t size;
+    int32_t frames;
+    ARM_CAN_MSG_INFO msgInfo;
+    uint32_t id;
+    uint8_t data[CAN_GATEWAY_PAYLOAD_MAX];
+    uint8_t destinations;
+    uint8_t i;
+    CAN_GatewayPort_t *source;
+    const CAN_GatewayPortConfig_t *config;
+    const CAN_DispatchEntry_t *entry;
+    const CAN_GatewayRoute_t *route;
+
+    frames = 0;
+    size   = 0;
+
+    if ((NULL == gateway) || (port >= gateway->portCount) || (NULL == gateway->port[port].config->driver))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        source = &gateway->port[port];
+        config = source->config;
+
+        while (size >= 0)
+        {
+            /* The only staging of the frame: mailbox -> data -> destination mailboxes. */
+            size = config->driver->MessageRead(config->rxObj, &msgInfo, data, (uint8_t)sizeof(data));
+
+            if (size >= 0)
+            {
+                frames++;
+                source->received++;
+
+                entry = CAN_Dispatch_Lookup(&source->table, msgInfo.id);
+                route = (NULL != entry) ? (const CAN_GatewayRoute_t *)entry->layout : NULL;
+
+                if (NULL != route)
+                {
+                    id           = msgInfo.id;
+                    msgInfo.id   = (id & ~route->rewriteMask) | (route->rewriteId & route->rewriteMask);
+                    destinations = (uint8_t)(route->destinations & (uint8_t)~CAN_GATEWAY_PORT(port));
+
+                    for (i = 0U; (i < gateway->portCount) && (0U != (destinations >> i)); i++)
+                    {
+                        if ((0U != (destinations & CAN_GATEWAY_PORT(i))) && (NULL != gateway->port[i].config->driver))
+                        {
+                            Gateway_Send(&gateway->port[i], &msgInfo, data, (uint8_t)size);
+                        }
+                        else
+                        {
+                            /* Not a destination */
+                        }
+                    }
+                }
+                else
+                {
+                    source->noRoute++;
+                }
+            }
+            else
+            {
+                /* Object drained or error */
+            }
+        }
+
+        result = ((ARM_CAN_NO_MESSAGE_AVAILABLE == size) || (0 != frames)) ? frames : size;
+    }
+
+    return result;
+}
+
+static void Gateway_Send(CAN_GatewayPort_t *port, ARM_CAN_MSG_INFO *msgInfo, const uint8_t *data, uint8_t size)
+{
+    const CAN_GatewayPortConfig_t *config;
+    int32_t status;
+    uint8_t i;
+
+    config = port->config;
+    status = ARM_DRIVER_ERROR_BUSY;
+
+    /*
+     * Lowest free TX object first: pending mailboxes leave lowest identifier
+     * first anyway, so a fixed search order costs nothing in priority.
+     */
+    for (i = 0U; (i < config->txCount) && (ARM_DRIVER_ERROR_BUSY == status); i++)
+    {
+        status = config->driver->MessageSend(config->txObj + i, msgInfo, data, size);
+    }
+
+    if (status >= 0)
+    {
+        port->forwarded++;
+    }
+    else
+    {
+        /* All busy, or an FD frame towards a classic port */
+        port->dropped++;
+    }
+}
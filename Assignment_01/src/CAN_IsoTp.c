@@ -0,0 +1,770 @@
+/*******************************************************************************
+ * @file    CAN_IsoTp.c
+ * @brief   ISO 15765-2 (ISO-TP) transport over the CMSIS CAN driver C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "CAN_IsoTp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Protocol control information, high nibble of byte 0 */
+#define ISOTP_PCI_SF                (0x0U)
+#define ISOTP_PCI_FF                (0x1U)
+#define ISOTP_PCI_CF                (0x2U)
+#define ISOTP_PCI_FC                (0x3U)
+
+/* Flow status */
+#define ISOTP_FS_CTS                (0x0U)
+#define ISOTP_FS_WAIT               (0x1U)
+#define ISOTP_FS_OVFLW              (0x2U)
+
+#define ISOTP_CLASSIC_FRAME         (8U)
+#define ISOTP_SF_CLASSIC_MAX        (7U)
+#define ISOTP_FF_CLASSIC_MAX        (4095UL)
+#define ISOTP_FC_LENGTH             (3U)
+#define ISOTP_STMIN_MAX_US          (127000UL)
+
+/* Channel states */
+#define ISOTP_TX_IDLE               (0U)
+#define ISOTP_TX_READY              (1U)    /**< Next frame may go */
+#define ISOTP_TX_SENDING            (2U)    /**< Data frame in the TX object */
+#define ISOTP_TX_WAIT_FC            (3U)
+#define ISOTP_TX_STMIN              (4U)
+
+#define ISOTP_RX_IDLE               (0U)
+#define ISOTP_RX_CF                 (1U)
+
+/* Content of the TX object */
+#define ISOTP_FLIGHT_NONE           (0U)
+#define ISOTP_FLIGHT_DATA           (1U)
+#define ISOTP_FLIGHT_FC             (2U)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void     IsoTp_Copy(uint8_t *dst, const uint8_t *src, uint32_t length);
+static uint8_t  IsoTp_PaddedLength(const CAN_IsoTp_Channel_t *channel, uint8_t length);
+static uint8_t  IsoTp_FrameMax(const CAN_IsoTp_Channel_t *channel);
+static uint32_t IsoTp_StMinUs(uint8_t stMin);
+static int32_t  IsoTp_Transmit(CAN_IsoTp_Channel_t *channel, uint8_t length);
+static void     IsoTp_SendNext(CAN_IsoTp_Channel_t *channel);
+static void     IsoTp_SendFlowControl(CAN_IsoTp_Channel_t *channel, uint8_t status);
+static void     IsoTp_Kick(CAN_IsoTp_Channel_t *channel);
+static void     IsoTp_DataSent(CAN_IsoTp_Channel_t *channel);
+static void     IsoTp_TxAbort(CAN_IsoTp_Channel_t *channel, uint32_t reason);
+static void     IsoTp_RxAbort(CAN_IsoTp_Channel_t *channel, uint32_t reason);
+static void     IsoTp_Signal(CAN_IsoTp_Channel_t *channel, uint32_t event, uint32_t length);
+static void     IsoTp_ReceiveFrames(CAN_IsoTp_Channel_t *channel);
+static void     IsoTp_HandleFrame(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame, uint8_t size,
+                                  uint8_t inPlace);
+static void     IsoTp_HandleSingle(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame, uint8_t size);
+static void     IsoTp_HandleFirst(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame, uint8_t size);
+static void     IsoTp_HandleConsecutive(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame,
+                                        uint8_t size, uint8_t inPlace);
+static void     IsoTp_HandleFlowControl(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame,
+                                        uint8_t size);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t CAN_IsoTp_Init(CAN_IsoTp_Channel_t *channel, const CAN_IsoTp_Config_t *config)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == channel) || (NULL == config) || (NULL == config->driver) || (NULL == config->timeUs) ||
+        (config->frameSize < ISOTP_CLASSIC_FRAME) || (config->frameSize > CAN_ISOTP_FRAME_MAX))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        channel->config     = config;
+        channel->txState    = ISOTP_TX_IDLE;
+        channel->rxState    = ISOTP_RX_IDLE;
+        channel->rxData     = NULL;
+        channel->rxCapacity = 0U;
+        channel->inFlight   = ISOTP_FLIGHT_NONE;
+        channel->fcPending  = 0U;
+        channel->txStMinUs  = 0U;
+    }
+
+    return result;
+}
+
+void CAN_IsoTp_SetRxBuffer(CAN_IsoTp_Channel_t *channel, uint8_t *data, uint32_t capacity)
+{
+    if (ISOTP_RX_IDLE != channel->rxState)
+    {
+        /* Never swap a buffer under a running reception */
+        IsoTp_RxAbort(channel, CAN_ISOTP_EVENT_SEQUENCE);
+    }
+    else
+    {
+        /* Idle */
+    }
+
+    channel->rxData     = data;
+    channel->rxCapacity = (NULL != data) ? capacity : 0U;
+}
+
+int32_t CAN_IsoTp_Send(CAN_IsoTp_Channel_t *channel, const uint8_t *data, uint32_t length)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == data) || (0U == length))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (ISOTP_TX_IDLE != channel->txState)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        channel->txData   = data;
+        channel->txLength = length;
+        channel->txOffset = 0U;
+        channel->txState  = ISOTP_TX_READY;
+
+        IsoTp_Kick(channel);
+    }
+
+    return result;
+}
+
+void CAN_IsoTp_OnObjectEvent(CAN_IsoTp_Channel_t *channel, uint32_t obj_idx, uint32_t event)
+{
+    uint8_t completed;
+
+    if ((obj_idx == channel->config->rxObj) && (0U != (event & ARM_CAN_EVENT_RECEIVE)))
+    {
+        IsoTp_ReceiveFrames(channel);
+    }
+    else
+    {
+        /* Not a receive event of this channel */
+    }
+
+    if ((obj_idx == channel->config->txObj) && (0U != (event & ARM_CAN_EVENT_SEND_COMPLETE)))
+    {
+        completed         = channel->inFlight;
+        channel->inFlight  = ISOTP_FLIGHT_NONE;
+
+        if (ISOTP_FLIGHT_DATA == completed)
+        {
+            IsoTp_DataSent(channel);
+        }
+        else
+        {
+            /* Flow control sent */
+        }
+
+        IsoTp_Kick(channel);
+    }
+    else
+    {
+        /* Not a send event of this channel */
+    }
+}
+
+void CAN_IsoTp_Poll(CAN_IsoTp_Channel_t *channel)
+{
+    uint32_t now;
+
+    now = channel->config->timeUs();
+
+    if ((ISOTP_TX_WAIT_FC == channel->txState) && ((now - channel->txTimer) >= channel->config->timeoutUs))
+    {
+        IsoTp_TxAbort(channel, CAN_ISOTP_EVENT_TIMEOUT);
+    }
+    else if ((ISOTP_TX_STMIN == channel->txState) && ((now - channel->txTimer) >= channel->txStMinUs))
+    {
+        channel->txState = ISOTP_TX_READY;
+    }
+    else
+    {
+        /* No TX timer expired */
+    }
+
+    if ((ISOTP_RX_CF == channel->rxState) && ((now - channel->rxTimer) >= channel->config->timeoutUs))
+    {
+        IsoTp_RxAbort(channel, CAN_ISOTP_EVENT_TIMEOUT);
+    }
+    else
+    {
+        /* No RX timer expired */
+    }
+
+    /* Frames refused by a busy TX object are retried here. */
+    IsoTp_Kick(channel);
+}
+
+static void IsoTp_Copy(uint8_t *dst, const uint8_t *src, uint32_t length)
+{
+    uint32_t i;
+
+    /* Forward copy: safe for overlapping buffers with dst below src. */
+    for (i = 0U; i < length; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+static uint8_t IsoTp_PaddedLength(const CAN_IsoTp_Channel_t *channel, uint8_t length)
+{
+    static const uint8_t s_fdLength[] = { 12U, 16U, 20U, 24U, 32U, 48U, 64U };
+    uint8_t padded;
+    uint8_t i;
+
+    padded = ISOTP_CLASSIC_FRAME;
+
+    if ((length > ISOTP_CLASSIC_FRAME) && (channel->config->frameSize > ISOTP_CLASSIC_FRAME))
+    {
+        /* Next CAN FD data length */
+        for (i = 0U; (i < sizeof(s_fdLength)) && (padded < length); i++)
+        {
+            padded = s_fdLength[i];
+        }
+    }
+    else
+    {
+        /* Classic frames are always padded to 8 bytes */
+    }
+
+    return padded;
+}
+
+static uint8_t IsoTp_FrameMax(const CAN_IsoTp_Channel_t *channel)
+{
+    /* RX_DL is chosen by the sender: an FD channel accepts any FD length. */
+    return (channel->config->frameSize > ISOTP_CLASSIC_FRAME) ? CAN_ISOTP_FRAME_MAX : ISOTP_CLASSIC_FRAME;
+}
+
+static uint32_t IsoTp_StMinUs(uint8_t stMin)
+{
+    uint32_t us;
+
+    if (stMin <= 0x7FU)
+    {
+        us = (uint32_t)stMin * 1000UL;
+    }
+    else if ((stMin >= 0xF1U) && (stMin <= 0xF9U))
+    {
+        us = ((uint32_t)stMin - 0xF0UL) * 100UL;
+    }
+    else
+    {
+        /* Reserved values: use the longest gap */
+        us = ISOTP_STMIN_MAX_US;
+    }
+
+    return us;
+}
+
+static int32_t IsoTp_Transmit(CAN_IsoTp_Channel_t *channel, uint8_t length)
+{
+    ARM_CAN_MSG_INFO msgInfo;
+    uint8_t padded;
+    uint8_t i;
+
+    padded = IsoTp_PaddedLength(channel, length);
+
+    for (i = length; i < padded; i++)
+    {
+        channel->frame[i] = channel->config->padding;
+    }
+
+    msgInfo.id       = channel->config->txId;
+    msgInfo.rtr      = 0U;
+    msgInfo.edl      = (channel->config->frameSize > ISOTP_CLASSIC_FRAME) ? 1U : 0U;
+    msgInfo.brs      = (0U != msgInfo.edl) ? channel->config->brs : 0U;
+    msgInfo.esi      = 0U;
+    msgInfo.dlc      = 0U;
+    msgInfo.reserved = 0U;
+
+    return channel->config->driver->MessageSend(channel->config->txObj, &msgInfo, channel->frame, padded);
+}
+
+static void IsoTp_SendNext(CAN_IsoTp_Channel_t *channel)
+{
+    uint32_t remaining;
+    uint8_t header;
+    uint8_t payload;
+    uint8_t sn;
+
+    remaining = channel->txLength - channel->txOffset;
+    sn        = channel->txSn;
+
+    if (0U != channel->txOffset)
+    {
+        channel->frame[0] = (uint8_t)((ISOTP_PCI_CF << 4) | sn);
+        header = 1U;
+        sn     = (uint8_t)((sn + 1U) & 0x0FU);
+    }
+    else if (remaining <= ISOTP_SF_CLASSIC_MAX)
+    {
+        channel->frame[0] = (uint8_t)remaining;
+        header = 1U;
+    }
+    else if (remaining <= ((uint32_t)channel->config->frameSize - 2UL))
+    {
+        /* FD single frame: escape byte, length in byte 1 */
+        channel->frame[0] = 0U;
+        channel->frame[1] = (uint8_t)remaining;
+        header = 2U;
+    }
+    else if (remaining <= ISOTP_FF_CLASSIC_MAX)
+    {
+        channel->frame[0] = (uint8_t)((ISOTP_PCI_FF << 4) | (remaining >> 8));
+        channel->frame[1] = (uint8_t)remaining;
+        header = 2U;
+        sn     = 1U;
+    }
+    else
+    {
+        /* Escaped first frame: 32-bit length */
+        channel->frame[0] = (uint8_t)(ISOTP_PCI_FF << 4);
+        channel->frame[1] = 0U;
+        channel->frame[2] = (uint8_t)(remaining >> 24);
+        channel->frame[3] = (uint8_t)(remaining >> 16);
+        channel->frame[4] = (uint8_t)(remaining >> 8);
+        channel->frame[5] = (uint8_t)remaining;
+        header = 6U;
+        sn     = 1U;
+    }
+
+    payload = (uint8_t)(channel->config->frameSize - header);
+    payload = (remaining < payload) ? (uint8_t)remaining : payload;
+
+    IsoTp_Copy(&channel->frame[header], &channel->txData[channel->txOffset], payload);
+
+    if (IsoTp_Transmit(channel, (uint8_t)(header + payload)) >= 0)
+    {
+        if ((0U == channel->txOffset) && (payload < remaining))
+        {
+            /* The first frame is a block of one: wait for flow control. */
+            channel->txBlockSize = 1U;
+            channel->txBlockLeft = 1U;
+        }
+        else if (0U == channel->txOffset)
+        {
+            /* Single frame: no flow control */
+            channel->txBlockSize = 0U;
+        }
+        else
+        {
+            /* Consecutive frame */
+        }
+
+        if (0U != channel->txBlockSize)
+        {
+            channel->txBlockLeft--;
+        }
+        else
+        {
+            /* Unlimited block */
+        }
+
+        channel->txOffset += payload;
+        channel->txSn      = sn;
+        channel->txState   = ISOTP_TX_SENDING;
+        channel->inFlight  = ISOTP_FLIGHT_DATA;
+    }
+    else
+    {
+        /* TX object busy: retried by Poll() */
+    }
+}
+
+static void IsoTp_SendFlowControl(CAN_IsoTp_Channel_t *channel, uint8_t status)
+{
+    channel->fcPending = 1U;
+    channel->fcStatus  = status;
+
+    IsoTp_Kick(channel);
+}
+
+static void IsoTp_Kick(CAN_IsoTp_Channel_t *channel)
+{
+    if (ISOTP_FLIGHT_NONE != channel->inFlight)
+    {
+        /* One frame at a time: wait for its send complete event */
+    }
+    else if (0U != channel->fcPending)
+    {
+        /* Flow control goes first so the peer is never held up by our own transfer. */
+        channel->frame[0] = (uint8_t)((ISOTP_PCI_FC << 4) | channel->fcStatus);
+        channel->frame[1] = channel->config->blockSize;
+        channel->frame[2] = channel->config->stMin;
+
+        if (IsoTp_Transmit(channel, ISOTP_FC_LENGTH) >= 0)
+        {
+            channel->fcPending = 0U;
+            channel->inFlight  = ISOTP_FLIGHT_FC;
+        }
+        else
+        {
+            /* TX object busy: retried by Poll() */
+        }
+    }
+    else if (ISOTP_TX_READY == channel->txState)
+    {
+        IsoTp_SendNext(channel);
+    }
+    else
+    {
+        /* Nothing to send */
+    }
+}
+
+static void IsoTp_DataSent(CAN_IsoTp_Channel_t *channel)
+{
+    if (ISOTP_TX_SENDING != channel->txState)
+    {
+        /* Aborted while in flight */
+    }
+    else if (channel->txOffset >= channel->txLength)
+    {
+        channel->txState = ISOTP_TX_IDLE;
+        IsoTp_Signal(channel, CAN_ISOTP_EVENT_TX_DONE, channel->txLength);
+    }
+    else if ((0U != channel->txBlockSize) && (0U == channel->txBlockLeft))
+    {
+        channel->txState = ISOTP_TX_WAIT_FC;
+        channel->txTimer = channel->config->timeUs();
+    }
+    else if (0U != channel->txStMinUs)
+    {
+        channel->txState = ISOTP_TX_STMIN;
+        channel->txTimer = channel->config->timeUs();
+    }
+    else
+    {
+        channel->txState = ISOTP_TX_READY;
+    }
+}
+
+static void IsoTp_TxAbort(CAN_IsoTp_Channel_t *channel, uint32_t reason)
+{
+    channel->txState = ISOTP_TX_IDLE;
+    IsoTp_Signal(channel, CAN_ISOTP_EVENT_TX_ERROR | reason, channel->txOffset);
+}
+
+static void IsoTp_RxAbort(CAN_IsoTp_Channel_t *channel, uint32_t reason)
+{
+    channel->rxState = ISOTP_RX_IDLE;
+    IsoTp_Signal(channel, CAN_ISOTP_EVENT_RX_ERROR | reason, channel->rxOffset);
+}
+
+static void IsoTp_Signal(CAN_IsoTp_Channel_t *channel, uint32_t event, uint32_t length)
+{
+    if (NULL != channel->config->callback)
+    {
+        channel->config->callback(channel, event, length);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void IsoTp_ReceiveFrames(CAN_IsoTp_Channel_t *channel)
+{
+    ARM_CAN_MSG_INFO msgInfo;
+    uint8_t *frame;
+    uint8_t frameMax;
+    uint8_t inPlace;
+    uint8_t saved;
+    uint8_t pci;
+    int32_t size;
+
+    frameMax = IsoTp_FrameMax(channel);
+    size     = 0;
+    saved    = 0U;
+
+    while (size >= 0)
+    {
+        /*
+         * During a reception a frame is read straight into the caller buffer:
+         * its PCI byte lands on the last byte already received, which is
+         * saved and put back once the PCI has been taken.
+         */
+        inPlace = ((ISOTP_RX_CF == channel->rxState) &&
+                   ((channel->rxCapacity - channel->rxOffset) >= ((uint32_t)frameMax - 1UL))) ? 1U : 0U;
+
+        if (0U != inPlace)
+        {
+            frame = &channel->rxData[channel->rxOffset - 1UL];
+            saved = *frame;
+        }
+        else
+        {
+            frame = channel->frame;
+        }
+
+        size = channel->config->driver->MessageRead(channel->config->rxObj, &msgInfo, frame, frameMax);
+
+        if (size > 0)
+        {
+            pci = frame[0];
+
+            if (0U != inPlace)
+            {
+                frame[0] = saved;
+            }
+            else
+            {
+                /* Scratch frame */
+            }
+
+            IsoTp_HandleFrame(channel, pci, frame, (uint8_t)size, inPlace);
+        }
+        else
+        {
+            /* Empty frame ignored, or object drained */
+        }
+    }
+}
+
+static void IsoTp_HandleFrame(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame, uint8_t size,
+                              uint8_t inPlace)
+{
+    switch (pci >> 4)
+    {
+        case ISOTP_PCI_SF:
+            IsoTp_HandleSingle(channel, pci, frame, size);
+            break;
+
+        case ISOTP_PCI_FF:
+            IsoTp_HandleFirst(channel, pci, frame, size);
+            break;
+
+        case ISOTP_PCI_CF:
+            IsoTp_HandleConsecutive(channel, pci, frame, size, inPlace);
+            break;
+
+        case ISOTP_PCI_FC:
+            IsoTp_HandleFlowControl(channel, pci, frame, size);
+            break;
+
+        default:
+            /* Unknown PCI: ignored */
+            break;
+    }
+}
+
+static void IsoTp_HandleSingle(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame, uint8_t size)
+{
+    uint32_t length;
+    uint8_t header;
+
+    length = pci & 0x0FU;
+    header = 1U;
+
+    if (size > ISOTP_CLASSIC_FRAME)
+    {
+        /* CAN FD single frame: nibble 0, length in byte 1. A nibble length is malformed here. */
+        length = (0U == length) ? frame[1] : 0U;
+        header = 2U;
+    }
+    else if (length > ISOTP_SF_CLASSIC_MAX)
+    {
+        /* Classic SF_DL is 1 ... 7 */
+        length = 0U;
+    }
+    else
+    {
+        /* Classic single frame */
+    }
+
+    if (ISOTP_RX_IDLE != channel->rxState)
+    {
+        /* A new message terminates the current one. */
+        IsoTp_RxAbort(channel, CAN_ISOTP_EVENT_SEQUENCE);
+    }
+    else
+    {
+        /* Idle */
+    }
+
+    if ((0U == length) || ((length + header) > size))
+    {
+        /* Malformed: ignored */
+    }
+    else if (length > channel->rxCapacity)
+    {
+        IsoTp_Signal(channel, CAN_ISOTP_EVENT_RX_ERROR | CAN_ISOTP_EVENT_OVERFLOW, length);
+    }
+    else
+    {
+        IsoTp_Copy(channel->rxData, &frame[header], length);
+        IsoTp_Signal(channel, CAN_ISOTP_EVENT_RX_DONE, length);
+    }
+}
+
+static void IsoTp_HandleFirst(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame, uint8_t size)
+{
+    uint32_t length;
+    uint32_t first;
+    uint8_t header;
+
+    length = ((uint32_t)(pci & 0x0FU) << 8) | frame[1];
+    header = 2U;
+
+    if (0U == length)
+    {
+        length = ((uint32_t)frame[2] << 24) | ((uint32_t)frame[3] << 16) | ((uint32_t)frame[4] << 8) | frame[5];
+        header = 6U;
+    }
+    else
+    {
+        /* 12-bit length */
+    }
+
+    if (ISOTP_RX_IDLE != channel->rxState)
+    {
+        IsoTp_RxAbort(channel, CAN_ISOTP_EVENT_SEQUENCE);
+    }
+    else
+    {
+        /* Idle */
+    }
+
+    if ((size <= header) || (length <= ((uint32_t)size - header)))
+    {
+        /* Malformed: fits a single frame */
+    }
+    else if (length > channel->rxCapacity)
+    {
+        IsoTp_SendFlowControl(channel, ISOTP_FS_OVFLW);
+        IsoTp_Signal(channel, CAN_ISOTP_EVENT_RX_ERROR | CAN_ISOTP_EVENT_OVERFLOW, length);
+    }
+    else
+    {
+        first = (uint32_t)size - header;
+
+        IsoTp_Copy(channel->rxData, &frame[header], first);
+
+        channel->rxLength    = length;
+        channel->rxOffset    = first;
+        channel->rxSn        = 1U;
+        channel->rxBlockLeft = channel->config->blockSize;
+        channel->rxState     = ISOTP_RX_CF;
+        channel->rxTimer     = channel->config->timeUs();
+
+        IsoTp_SendFlowControl(channel, ISOTP_FS_CTS);
+    }
+}
+
+static void IsoTp_HandleConsecutive(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame,
+                                    uint8_t size, uint8_t inPlace)
+{
+    uint32_t payload;
+
+    if (ISOTP_RX_CF != channel->rxState)
+    {
+        /* Not receiving: ignored */
+    }
+    else if ((pci & 0x0FU) != channel->rxSn)
+    {
+        IsoTp_RxAbort(channel, CAN_ISOTP_EVENT_SEQUENCE);
+    }
+    else
+    {
+        payload = (uint32_t)size - 1UL;
+        payload = ((channel->rxLength - channel->rxOffset) < payload) ? (channel->rxLength - channel->rxOffset)
+                                                                         : payload;
+
+        if (0U == inPlace)
+        {
+            IsoTp_Copy(&channel->rxData[channel->rxOffset], &frame[1], payload);
+        }
+        else
+        {
+            /* Payload already in place */
+        }
+
+        channel->rxOffset += payload;
+        channel->rxSn      = (uint8_t)((channel->rxSn + 1U) & 0x0FU);
+        channel->rxTimer   = channel->config->timeUs();
+
+        if (channel->rxOffset >= channel->rxLength)
+        {
+            channel->rxState = ISOTP_RX_IDLE;
+            IsoTp_Signal(channel, CAN_ISOTP_EVENT_RX_DONE, channel->rxLength);
+        }
+        else if (0U != channel->config->blockSize)
+        {
+            channel->rxBlockLeft--;
+
+            if (0U == channel->rxBlockLeft)
+            {
+                channel->rxBlockLeft = channel->config->blockSize;
+                IsoTp_SendFlowControl(channel, ISOTP_FS_CTS);
+            }
+            else
+            {
+                /* Block continues */
+            }
+        }
+        else
+        {
+            /* Unlimited block */
+        }
+    }
+}
+
+static void IsoTp_HandleFlowControl(CAN_IsoTp_Channel_t *channel, uint8_t pci, const uint8_t *frame,
+                                    uint8_t size)
+{
+    uint8_t waiting;
+
+    /* Flow control can overtake the send complete event of the frame it answers. */
+    waiting = ((ISOTP_TX_WAIT_FC == channel->txState) ||
+               ((ISOTP_TX_SENDING == channel->txState) && (0U != channel->txBlockSize) &&
+                (0U == channel->txBlockLeft))) ? 1U : 0U;
+
+    if ((0U == waiting) || (size < ISOTP_FC_LENGTH))
+    {
+        /* Unexpected: ignored */
+    }
+    else
+    {
+        switch (pci & 0x0FU)
+        {
+            case ISOTP_FS_CTS:
+                channel->txBlockSize = frame[1];
+                channel->txBlockLeft = frame[1];
+                channel->txStMinUs   = IsoTp_StMinUs(frame[2]);
+
+                if (ISOTP_TX_WAIT_FC == channel->txState)
+                {
+                    channel->txState = ISOTP_TX_READY;
+                    IsoTp_Kick(channel);
+                }
+                else
+                {
+                    /* Continued by the pending send complete event */
+                }
+                break;
+
+            case ISOTP_FS_WAIT:
+                channel->txTimer = channel->config->timeUs();
+                break;
+
+            default:
+                IsoTp_TxAbort(channel, CAN_ISOTP_EVENT_OVERFLOW);
+                break;
+        }
+    }
+}
@@ -0,0 +1,332 @@
+/*******************************************************************************
+ * @file    CRC_Engine.c
+ * @brief   CRC-16 / CRC-32 on the CRC module C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "CRC_Engine.h"
+#include "HAL_CRC.h"
+#include "HAL_DMA.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef struct
+{
+    uint8_t                 channel;        /**< eDMA channel, reserved by the first DMA feed */
+    volatile uint8_t        busy;           /**< DMA feed running           */
+    const uint8_t           *next;          /**< Next chunk of the DMA feed */
+    uint32_t                words;          /**< Words not yet given to DMA */
+    uint32_t                tail;           /**< Bytes fed by the CPU after */
+    uint32_t                chunk;          /**< Words of the running chunk */
+    CRC_Engine_Callback_t   callback;
+} CRC_Engine_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static CRC_Engine_t s_engine = { HAL_DMA_CHANNEL_INVALID, 0U, NULL, 0U, 0U, 0U, NULL };
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint8_t CRC_AllocDma(void);
+static void CRC_Feed(const uint8_t *data, uint32_t size);
+static void CRC_StartDmaChunk(void);
+static void CRC_DmaCallback(uint8_t channel, uint32_t event, void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t CRC_Engine_Init(void)
+{
+    HAL_CRC_Init();
+
+    return ARM_DRIVER_OK;
+}
+
+int32_t CRC_Engine_Start(const CRC_Config_t *config)
+{
+    HAL_CRC_Config_t hal;
+    int32_t result;
+
+    if (0U != s_engine.busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if ((NULL == config) || ((16U != config->width) && (32U != config->width)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        hal.polynomial   = config->polynomial;
+        hal.seed         = config->seed;
+        hal.width32      = (32U == config->width) ? 1U : 0U;
+        hal.transposeIn  = (0U != config->reflectIn) ? HAL_CRC_TRANSPOSE_BITS_BYTES : HAL_CRC_TRANSPOSE_BYTES;
+        hal.transposeOut = (0U != config->reflectOut) ? HAL_CRC_TRANSPOSE_BITS_BYTES : HAL_CRC_TRANSPOSE_NONE;
+        hal.complement   = config->complement;
+
+        HAL_CRC_Configure(&hal);
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t CRC_Engine_Update(const void *data, uint32_t size)
+{
+    int32_t result;
+
+    if (0U != s_engine.busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if ((NULL == data) && (0U != size))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        CRC_Feed((const uint8_t *)data, size);
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t CRC_Engine_UpdateDma(const void *data, uint32_t size, CRC_Engine_Callback_t callback)
+{
+    const uint8_t *p;
+    uint32_t head;
+    int32_t result;
+
+    p = (const uint8_t *)data;
+
+    if (0U != s_engine.busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if ((NULL == p) || (NULL == callback))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U != CRC_AllocDma())
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        /* Bytes up to the first word boundary by the CPU */
+        head = (4U - ((uint32_t)p & 3U)) & 3U;
+        head = (head > size) ? size : head;
+        CRC_Feed(p, head);
+        p    += head;
+        size -= head;
+
+        s_engine.next     = p;
+        s_engine.words    = size / 4U;
+        s_engine.tail     = size & 3U;
+        s_engine.callback = callback;
+
+        if (0U == s_engine.words)
+        {
+            /* Too short for DMA */
+            CRC_Feed(p, s_engine.tail);
+            callback(ARM_DRIVER_OK, HAL_CRC_GetResult());
+        }
+        else
+        {
+            s_engine.busy = 1U;
+            CRC_StartDmaChunk();
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+uint32_t CRC_Engine_GetResult(void)
+{
+    return HAL_CRC_GetResult();
+}
+
+uint8_t CRC_Engine_IsBusy(void)
+{
+    return s_engine.busy;
+}
+
+int32_t CRC_Engine_Compute(const CRC_Config_t *config, const void *data, uint32_t size, uint32_t *crc)
+{
+    int32_t result;
+
+    if (NULL == crc)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = CRC_Engine_Start(config);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            result = CRC_Engine_Update(data, size);
+        }
+        else
+        {
+            /* Busy or bad parameters */
+        }
+
+        if (ARM_DRIVER_OK == result)
+        {
+            *crc = HAL_CRC_GetResult();
+        }
+        else
+        {
+            /* No result */
+        }
+    }
+
+    return result;
+}
+
+int32_t CRC_Engine_Check(const CRC_Table_t *table, const void *data, uint32_t size)
+{
+    uint32_t crc;
+    int32_t result;
+
+    if (NULL == table)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = CRC_Engine_Compute(&table->config, data, size, &crc);
+
+        if ((ARM_DRIVER_OK == result) && (crc != CRC_Soft_Compute(table, data, size)))
+        {
+            result = CRC_ENGINE_ERROR_MISMATCH;
+        }
+        else
+        {
+            /* Same result, or no hardware result */
+        }
+    }
+
+    return result;
+}
+
+static uint8_t CRC_AllocDma(void)
+{
+    if (HAL_DMA_CHANNEL_INVALID == s_engine.channel)
+    {
+        HAL_DMA_Init();
+        s_engine.channel = HAL_DMA_AllocChannel();
+
+        if (HAL_DMA_CHANNEL_INVALID != s_engine.channel)
+        {
+            /* The data register takes a request at any time. */
+            HAL_DMA_SetRequestSource(s_engine.channel, EDMA_REQ_DMAMUX_ALWAYS_ENABLED0);
+            HAL_DMA_RegisterCallback(s_engine.channel, CRC_DmaCallback, NULL);
+        }
+        else
+        {
+            /* All channels in use */
+        }
+    }
+    else
+    {
+        /* Reserved by an earlier feed */
+    }
+
+    return (HAL_DMA_CHANNEL_INVALID == s_engine.channel) ? 1U : 0U;
+}
+
+static void CRC_Feed(const uint8_t *data, uint32_t size)
+{
+    uint32_t i;
+
+    i = 0U;
+
+    while ((i < size) && (0U != (((uint32_t)&data[i]) & 3U)))
+    {
+        HAL_CRC_WriteByte(data[i]);
+        i++;
+    }
+
+    while ((size - i) >= 4U)
+    {
+        HAL_CRC_WriteWord(*(const uint32_t *)&data[i]);
+        i += 4U;
+    }
+
+    while (i < size)
+    {
+        HAL_CRC_WriteByte(data[i]);
+        i++;
+    }
+}
+
+static void CRC_StartDmaChunk(void)
+{
+    HAL_DMA_Transfer_t transfer;
+
+    s_engine.chunk = (s_engine.words > CRC_ENGINE_DMA_MAX_WORDS) ? CRC_ENGINE_DMA_MAX_WORDS : s_engine.words;
+
+    transfer.srcAddr    = (uint32_t)s_engine.next;
+    transfer.dstAddr    = HAL_CRC_GetDataAddress();
+    transfer.srcOffset  = 4;
+    transfer.dstOffset  = 0;
+    transfer.srcSize    = HAL_DMA_SIZE_32BIT;
+    transfer.dstSize    = HAL_DMA_SIZE_32BIT;
+    transfer.minorBytes = 4U;
+    transfer.majorCount = (uint16_t)s_engine.chunk;
+    transfer.srcLastAdj = 0;
+    transfer.dstLastAdj = 0;
+    transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+
+    HAL_DMA_ConfigTransfer(s_engine.channel, &transfer);
+    HAL_DMA_EnableRequest(s_engine.channel);
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void CRC_DmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    CRC_Engine_Callback_t callback;
+
+    (void)param;
+
+    callback = s_engine.callback;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        HAL_DMA_DisableRequest(channel);
+        s_engine.busy = 0U;
+        callback(ARM_DRIVER_ERROR, HAL_CRC_GetResult());
+    }
+    else
+    {
+        s_engine.next  += s_engine.chunk * 4U;
+        s_engine.words -= s_engine.chunk;
+
+        if (0U != s_engine.words)
+        {
+            CRC_StartDmaChunk();
+        }
+        else
+        {
+            CRC_Feed(s_engine.next, s_engine.tail);
+            s_engine.busy = 0U;
+            callback(ARM_DRIVER_OK, HAL_CRC_GetResult());
+        }
+    }
+}
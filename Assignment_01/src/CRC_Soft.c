@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * @file    CRC_Soft.c
+ * @brief   Table driven (slicing-by-8) software CRC C file.
+ *
+ * Reflected CRCs run LSB first in the low bits of the state; the others
+ * run MSB first with the state left aligned in 32 bits, so CRC-16 and
+ * CRC-32 share one code path per direction.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "CRC_Soft.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t CRC_Reflect(uint32_t value, uint8_t width);
+static uint32_t CRC_Mask(uint8_t width);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t CRC_Soft_Init(CRC_Table_t *table, const CRC_Config_t *config)
+{
+    int32_t result;
+    uint32_t poly;
+    uint32_t crc;
+    uint32_t b;
+    uint8_t bit;
+    uint8_t k;
+
+    if ((NULL == table) || (NULL == config) || ((16U != config->width) && (32U != config->width)))
+    {
+        result = -1;
+    }
+    else
+    {
+        table->config = *config;
+
+        /* Table 0: one byte through the 8 shift steps */
+        if (0U != config->reflectIn)
+        {
+            poly = CRC_Reflect(config->polynomial, config->width);
+
+            for (b = 0U; b < 256U; b++)
+            {
+                crc = b;
+
+                for (bit = 0U; bit < 8U; bit++)
+                {
+                    crc = (0U != (crc & 1U)) ? ((crc >> 1) ^ poly) : (crc >> 1);
+                }
+
+                table->table[0][b] = crc;
+            }
+        }
+        else
+        {
+            poly = config->polynomial << (32U - config->width);
+
+            for (b = 0U; b < 256U; b++)
+            {
+                crc = b << 24;
+
+                for (bit = 0U; bit < 8U; bit++)
+                {
+                    crc = (0U != (crc & 0x80000000UL)) ? ((crc << 1) ^ poly) : (crc << 1);
+                }
+
+                table->table[0][b] = crc;
+            }
+        }
+
+        /* Table k: the same byte followed by k zero bytes */
+        for (k = 1U; k < 8U; k++)
+        {
+            for (b = 0U; b < 256U; b++)
+            {
+                crc = table->table[k - 1U][b];
+                table->table[k][b] = (0U != config->reflectIn) ?
+                                     ((crc >> 8) ^ table->table[0][crc & 0xFFU]) :
+                                     ((crc << 8) ^ table->table[0][crc >> 24]);
+            }
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+uint32_t CRC_Soft_Start(const CRC_Table_t *table)
+{
+    const CRC_Config_t *config;
+
+    config = &table->config;
+
+    return (0U != config->reflectIn) ? CRC_Reflect(config->seed, config->width) :
+                                       ((config->seed & CRC_Mask(config->width)) << (32U - config->width));
+}
+
+uint32_t CRC_Soft_Update(const CRC_Table_t *table, uint32_t state, const void *data, uint32_t size)
+{
+    const uint32_t (*t)[256];
+    const uint8_t *p;
+    uint32_t crc;
+
+    t   = table->table;
+    p   = (const uint8_t *)data;
+    crc = state;
+
+    if (0U != table->config.reflectIn)
+    {
+        while (size >= 8U)
+        {
+            crc ^= (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+            crc  = t[7][crc & 0xFFU] ^ t[6][(crc >> 8) & 0xFFU] ^ t[5][(crc >> 16) & 0xFFU] ^ t[4][crc >> 24] ^
+                   t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+            p    += 8;
+            size -= 8U;
+        }
+
+        while (size > 0U)
+        {
+            crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFU];
+            p++;
+            size--;
+        }
+    }
+    else
+    {
+        while (size >= 8U)
+        {
+            crc ^= ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+            crc  = t[7][crc >> 24] ^ t[6][(crc >> 16) & 0xFFU] ^ t[5][(crc >> 8) & 0xFFU] ^ t[4][crc & 0xFFU] ^
+                   t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+            p    += 8;
+            size -= 8U;
+        }
+
+        while (size > 0U)
+        {
+            crc = (crc << 8) ^ t[0][(crc >> 24) ^ *p];
+            p++;
+            size--;
+        }
+    }
+
+    return crc;
+}
+
+uint32_t CRC_Soft_Finish(const CRC_Table_t *table, uint32_t state)
+{
+    const CRC_Config_t *config;
+    uint32_t crc;
+
+    config = &table->config;
+    crc    = (0U != config->reflectIn) ? state : (state >> (32U - config->width));
+
+    if (config->reflectIn != config->reflectOut)
+    {
+        crc = CRC_Reflect(crc, config->width);
+    }
+    else
+    {
+        /* Already in output order */
+    }
+
+    return (0U != config->complement) ? (crc ^ CRC_Mask(config->width)) : crc;
+}
+
+uint32_t CRC_Soft_Compute(const CRC_Table_t *table, const void *data, uint32_t size)
+{
+    return CRC_Soft_Finish(table, CRC_Soft_Update(table, CRC_Soft_Start(table), data, size));
+}
+
+static uint32_t CRC_Reflect(uint32_t value, uint8_t width)
+{
+    uint32_t result;
+    uint8_t i;
+
+    result = 0U;
+
+    for (i = 0U; i < width; i++)
+    {
+        result = (result << 1) | ((value >> i) & 1U);
+    }
+
+    return result;
+}
+
+static uint32_t CRC_Mask(uint8_t width)
+{
+    return (32U == width) ? 0xFFFFFFFFUL : ((1UL << width) - 1U);
+}
@@ -0,0 +1,566 @@
+/*******************************************************************************
+ * @file    DSP_Filter.c
+ * @brief   Fixed-point (Q15 / Q31) filter kernels C file.
+ *
+ * Q15 FIR: two outputs per pass share each coefficient pair, one SMLALD
+ * per pair of taps and output (three word loads per four MACs). Q31
+ * kernels use the 32 x 32 + 64 multiply-accumulate (SMLAL) the compiler
+ * emits for int64_t sums.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "DSP_Filter.h"
+#include "DSP_Simd.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define DSP_MOVAVG_LENGTH_MAX       (32768UL)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint8_t DSP_Log2(uint32_t length);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t DSP_FirQ15_Init(DSP_FirQ15_t *fir, uint16_t numTaps, const int16_t *coeffs, int16_t *state,
+                        uint16_t blockSize, uint16_t factor)
+{
+    uint32_t i;
+    int32_t result;
+
+    if ((NULL == fir) || (NULL == coeffs) || (NULL == state) || (0U == numTaps) || (0U == blockSize) ||
+        (0U == factor) || (0U != (blockSize % factor)))
+    {
+        result = -1;
+    }
+    else
+    {
+        fir->coeffs    = coeffs;
+        fir->state     = state;
+        fir->numTaps   = numTaps;
+        fir->blockSize = blockSize;
+        fir->factor    = factor;
+
+        for (i = 0U; i < DSP_FIR_STATE_LEN(numTaps, blockSize); i++)
+        {
+            state[i] = 0;
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+uint32_t DSP_FirQ15_Process(DSP_FirQ15_t *fir, const int16_t *in, int16_t *out, uint32_t count)
+{
+    const int16_t *coeffs;
+    const int16_t *px0;
+    const int16_t *px1;
+    int16_t *state;
+    int64_t acc0;
+    int64_t acc1;
+    uint32_t pair;
+    uint32_t outputs;
+    uint32_t taps;
+    uint32_t n;
+    uint32_t k;
+
+    outputs = 0U;
+
+    if ((NULL != fir) && (NULL != in) && (NULL != out) && (count <= fir->blockSize) &&
+        (0U == (count % fir->factor)))
+    {
+        coeffs  = fir->coeffs;
+        state   = fir->state;
+        taps    = fir->numTaps;
+        outputs = count / fir->factor;
+
+        /* New samples after the taps - 1 previous ones */
+        for (n = 0U; n < count; n++)
+        {
+            state[taps - 1U + n] = in[n];
+        }
+
+        /* Output n ends on the last input of its group: sample n * factor + factor - 1 */
+        for (n = 0U; (n + 1U) < outputs; n += 2U)
+        {
+            px0  = &state[((n + 1U) * fir->factor) - 1U];
+            px1  = &px0[fir->factor];
+            acc0 = 0;
+            acc1 = 0;
+
+            for (k = 0U; (k + 1U) < taps; k += 2U)
+            {
+                pair = DSP_Read_Q15x2(&coeffs[k]);
+                acc0 = DSP_Smlald(pair, DSP_Read_Q15x2(&px0[k]), acc0);
+                acc1 = DSP_Smlald(pair, DSP_Read_Q15x2(&px1[k]), acc1);
+            }
+
+            if (k < taps)
+            {
+                acc0 += (int32_t)coeffs[k] * px0[k];
+                acc1 += (int32_t)coeffs[k] * px1[k];
+            }
+            else
+            {
+                /* Even tap count */
+            }
+
+            /* |acc| <= taps * 2^30: the shifted sum fits 32 bits */
+            out[n]      = DSP_Sat16((int32_t)(acc0 >> 15));
+            out[n + 1U] = DSP_Sat16((int32_t)(acc1 >> 15));
+        }
+
+        if (n < outputs)
+        {
+            px0  = &state[((n + 1U) * fir->factor) - 1U];
+            acc0 = 0;
+
+            for (k = 0U; (k + 1U) < taps; k += 2U)
+            {
+                acc0 = DSP_Smlald(DSP_Read_Q15x2(&coeffs[k]), DSP_Read_Q15x2(&px0[k]), acc0);
+            }
+
+            if (k < taps)
+            {
+                acc0 += (int32_t)coeffs[k] * px0[k];
+            }
+            else
+            {
+                /* Even tap count */
+            }
+
+            out[n] = DSP_Sat16((int32_t)(acc0 >> 15));
+        }
+        else
+        {
+            /* Even output count */
+        }
+
+        /* Keep the last taps - 1 samples for the next block */
+        for (k = 0U; k < (taps - 1U); k++)
+        {
+            state[k] = state[count + k];
+        }
+    }
+    else
+    {
+        /* Invalid parameter, keep outputs = 0U */
+    }
+
+    return outputs;
+}
+
+int32_t DSP_FirQ31_Init(DSP_FirQ31_t *fir, uint16_t numTaps, const int32_t *coeffs, int32_t *state,
+                        uint16_t blockSize, uint16_t factor)
+{
+    uint32_t i;
+    int32_t result;
+
+    if ((NULL == fir) || (NULL == coeffs) || (NULL == state) || (0U == numTaps) || (0U == blockSize) ||
+        (0U == factor) || (0U != (blockSize % factor)))
+    {
+        result = -1;
+    }
+    else
+    {
+        fir->coeffs    = coeffs;
+        fir->state     = state;
+        fir->numTaps   = numTaps;
+        fir->blockSize = blockSize;
+        fir->factor    = factor;
+
+        for (i = 0U; i < DSP_FIR_STATE_LEN(numTaps, blockSize); i++)
+        {
+            state[i] = 0;
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+uint32_t DSP_FirQ31_Process(DSP_FirQ31_t *fir, const int32_t *in, int32_t *out, uint32_t count)
+{
+    const int32_t *coeffs;
+    const int32_t *px;
+    int32_t *state;
+    int64_t acc;
+    uint32_t outputs;
+    uint32_t taps;
+    uint32_t n;
+    uint32_t k;
+
+    outputs = 0U;
+
+    if ((NULL != fir) && (NULL != in) && (NULL != out) && (count <= fir->blockSize) &&
+        (0U == (count % fir->factor)))
+    {
+        coeffs  = fir->coeffs;
+        state   = fir->state;
+        taps    = fir->numTaps;
+        outputs = count / fir->factor;
+
+        for (n = 0U; n < count; n++)
+        {
+            state[taps - 1U + n] = in[n];
+        }
+
+        for (n = 0U; n < outputs; n++)
+        {
+            px  = &state[((n + 1U) * fir->factor) - 1U];
+            acc = 0;
+
+            for (k = 0U; k < taps; k++)
+            {
+                acc += (int64_t)coeffs[k] * px[k];
+            }
+
+            out[n] = DSP_Sat32(acc >> 31);
+        }
+
+        for (k = 0U; k < (taps - 1U); k++)
+        {
+            state[k] = state[count + k];
+        }
+    }
+    else
+    {
+        /* Invalid parameter, keep outputs = 0U */
+    }
+
+    return outputs;
+}
+
+int32_t DSP_BiquadQ15_Init(DSP_BiquadQ15_t *iir, uint8_t stages, const int16_t *coeffs, int16_t *state,
+                           uint8_t postShift)
+{
+    uint32_t i;
+    int32_t result;
+
+    if ((NULL == iir) || (NULL == coeffs) || (NULL == state) || (0U == stages) ||
+        (postShift > DSP_BIQUAD_POST_SHIFT_MAX))
+    {
+        result = -1;
+    }
+    else
+    {
+        iir->coeffs    = coeffs;
+        iir->state     = state;
+        iir->stages    = stages;
+        iir->postShift = postShift;
+
+        for (i = 0U; i < DSP_BIQUAD_STATE_LEN(stages); i++)
+        {
+            state[i] = 0;
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+void DSP_BiquadQ15_Process(DSP_BiquadQ15_t *iir, const int16_t *in, int16_t *out, uint32_t count)
+{
+    const int16_t *coeffs;
+    const int16_t *src;
+    int16_t *state;
+    int64_t acc;
+    uint32_t bPair;
+    uint32_t aPair;
+    uint32_t xPair;
+    uint32_t yPair;
+    uint32_t i;
+    int16_t b0;
+    int16_t x0;
+    int16_t y0;
+    uint8_t shift;
+    uint8_t s;
+
+    if ((NULL != iir) && (NULL != in) && (NULL != out))
+    {
+        src   = in;
+        shift = 15U - iir->postShift;
+
+        for (s = 0U; s < iir->stages; s++)
+        {
+            coeffs = &iir->coeffs[(uint32_t)s * DSP_BIQUAD_COEFF_COUNT];
+            state  = &iir->state[4U * (uint32_t)s];
+
+            /* (b1, b2) . (x1, x2) and (a1, a2) . (y1, y2) are one SMLALD each */
+            b0    = coeffs[0];
+            bPair = DSP_Read_Q15x2(&coeffs[1]);
+            aPair = DSP_Read_Q15x2(&coeffs[3]);
+            xPair = DSP_Read_Q15x2(&state[0]);
+            yPair = DSP_Read_Q15x2(&state[2]);
+
+            for (i = 0U; i < count; i++)
+            {
+                x0  = src[i];
+                acc = (int32_t)b0 * x0;
+                acc = DSP_Smlald(bPair, xPair, acc);
+                acc = DSP_Smlald(aPair, yPair, acc);
+
+                /* |acc| <= 5 * 2^30 and shift >= 8 */
+                y0     = DSP_Sat16((int32_t)(acc >> shift));
+                xPair  = DSP_Pack(x0, (int16_t)xPair);
+                yPair  = DSP_Pack(y0, (int16_t)yPair);
+                out[i] = y0;
+            }
+
+            DSP_Write_Q15x2(&state[0], xPair);
+            DSP_Write_Q15x2(&state[2], yPair);
+
+            /* Next stage filters in place */
+            src = out;
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+int32_t DSP_BiquadQ31_Init(DSP_BiquadQ31_t *iir, uint8_t stages, const int32_t *coeffs, int32_t *state,
+                           uint8_t postShift)
+{
+    uint32_t i;
+    int32_t result;
+
+    if ((NULL == iir) || (NULL == coeffs) || (NULL == state) || (0U == stages) ||
+        (postShift > DSP_BIQUAD_POST_SHIFT_MAX))
+    {
+        result = -1;
+    }
+    else
+    {
+        iir->coeffs    = coeffs;
+        iir->state     = state;
+        iir->stages    = stages;
+        iir->postShift = postShift;
+
+        for (i = 0U; i < DSP_BIQUAD_STATE_LEN(stages); i++)
+        {
+            state[i] = 0;
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+void DSP_BiquadQ31_Process(DSP_BiquadQ31_t *iir, const int32_t *in, int32_t *out, uint32_t count)
+{
+    const int32_t *coeffs;
+    const int32_t *src;
+    int32_t *state;
+    int64_t acc;
+    uint32_t i;
+    int32_t x0;
+    int32_t x1;
+    int32_t x2;
+    int32_t y0;
+    int32_t y1;
+    int32_t y2;
+    uint8_t shift;
+    uint8_t s;
+
+    if ((NULL != iir) && (NULL != in) && (NULL != out))
+    {
+        src   = in;
+        shift = 31U - iir->postShift;
+
+        for (s = 0U; s < iir->stages; s++)
+        {
+            coeffs = &iir->coeffs[(uint32_t)s * DSP_BIQUAD_COEFF_COUNT];
+            state  = &iir->state[4U * (uint32_t)s];
+            x1     = state[0];
+            x2     = state[1];
+            y1     = state[2];
+            y2     = state[3];
+
+            for (i = 0U; i < count; i++)
+            {
+                x0   = src[i];
+                acc  = (int64_t)coeffs[0] * x0;
+                acc += (int64_t)coeffs[1] * x1;
+                acc += (int64_t)coeffs[2] * x2;
+                acc += (int64_t)coeffs[3] * y1;
+                acc += (int64_t)coeffs[4] * y2;
+                y0   = DSP_Sat32(acc >> shift);
+
+                x2     = x1;
+                x1     = x0;
+                y2     = y1;
+                y1     = y0;
+                out[i] = y0;
+            }
+
+            state[0] = x1;
+            state[1] = x2;
+            state[2] = y1;
+            state[3] = y2;
+
+            src = out;
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+int32_t DSP_MovAvgQ15_Init(DSP_MovAvgQ15_t *avg, int16_t *history, uint32_t length)
+{
+    uint32_t i;
+    int32_t result;
+
+    if ((NULL == avg) || (NULL == history) || (0U == length) || (length > DSP_MOVAVG_LENGTH_MAX) ||
+        (0U != (length & (length - 1U))))
+    {
+        result = -1;
+    }
+    else
+    {
+        avg->history = history;
+        avg->sum     = 0;
+        avg->index   = 0U;
+        avg->mask    = (uint16_t)(length - 1U);
+        avg->shift   = DSP_Log2(length);
+
+        for (i = 0U; i < length; i++)
+        {
+            history[i] = 0;
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+void DSP_MovAvgQ15_Process(DSP_MovAvgQ15_t *avg, const int16_t *in, int16_t *out, uint32_t count)
+{
+    uint32_t i;
+    int16_t x;
+
+    if ((NULL != avg) && (NULL != in) && (NULL != out))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            /* Sum of at most 2^15 samples: 2^30, no overflow */
+            x         = in[i];
+            avg->sum += (int32_t)x - avg->history[avg->index];
+            avg->history[avg->index] = x;
+            avg->index = (avg->index + 1U) & avg->mask;
+            out[i]     = (int16_t)(avg->sum >> avg->shift);
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+int32_t DSP_MovAvgQ31_Init(DSP_MovAvgQ31_t *avg, int32_t *history, uint32_t length)
+{
+    uint32_t i;
+    int32_t result;
+
+    if ((NULL == avg) || (NULL == history) || (0U == length) || (length > DSP_MOVAVG_LENGTH_MAX) ||
+        (0U != (length & (length - 1U))))
+    {
+        result = -1;
+    }
+    else
+    {
+        avg->history = history;
+        avg->sum     = 0;
+        avg->index   = 0U;
+        avg->mask    = (uint16_t)(length - 1U);
+        avg->shift   = DSP_Log2(length);
+
+        for (i = 0U; i < length; i++)
+        {
+            history[i] = 0;
+        }
+
+        result = 0;
+    }
+
+    return result;
+}
+
+void DSP_MovAvgQ31_Process(DSP_MovAvgQ31_t *avg, const int32_t *in, int32_t *out, uint32_t count)
+{
+    uint32_t i;
+    int32_t x;
+
+    if ((NULL != avg) && (NULL != in) && (NULL != out))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            x         = in[i];
+            avg->sum += (int64_t)x - avg->history[avg->index];
+            avg->history[avg->index] = x;
+            avg->index = (avg->index + 1U) & avg->mask;
+            out[i]     = (int32_t)(avg->sum >> avg->shift);
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void DSP_AddQ15(const int16_t *a, const int16_t *b, int16_t *out, uint32_t count)
+{
+    uint32_t i;
+
+    if ((NULL != a) && (NULL != b) && (NULL != out))
+    {
+        for (i = 0U; (i + 1U) < count; i += 2U)
+        {
+            DSP_Write_Q15x2(&out[i], DSP_Qadd16(DSP_Read_Q15x2(&a[i]), DSP_Read_Q15x2(&b[i])));
+        }
+
+        if (i < count)
+        {
+            out[i] = DSP_Sat16((int32_t)a[i] + b[i]);
+        }
+        else
+        {
+            /* Even count */
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+static uint8_t DSP_Log2(uint32_t length)
+{
+    uint8_t shift;
+
+    shift = 0U;
+
+    while ((1UL << shift) < length)
+    {
+        shift++;
+    }
+
+    return shift;
+}
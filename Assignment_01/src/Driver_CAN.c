@@ -0,0 +1,1849 @@
+/*******************************************************************************
+ * @file    Driver_CAN.c
+ * @brief   CMSIS CAN driver for the S32K144 FlexCAN C file.
+ *
+ * Object 0 is the legacy RX FIFO (6 frames deep, 16-element format A ID
+ * filter table in MB6..9), the remaining message buffers from MB10 are
+ * single-frame TX or RX mailboxes. MessageSend / MessageRead move the
+ * payload directly between the caller buffer and MB RAM, the driver keeps
+ * no frame copies. A received object keeps its interrupt masked until the
+ * frame is read, so the callback may defer the read without re-entering.
+ * Pending TX mailboxes are sent lowest ID first (CTRL1.LBUF = 0).
+ *
+ * FlexCAN0 also runs ISO CAN FD (ARM_CAN_SET_FD_MODE in initialization
+ * mode): up to 64 payload bytes, bit rate switching with a separate data
+ * phase timing and transceiver delay compensation. The RX FIFO is then
+ * unavailable and every message buffer becomes a mailbox object.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "Driver_CAN_S32K144.h"
+#include "HAL_FLEXCAN.h"
+#include "HAL_GPIO.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_CAN_DRV_VERSION         ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define CAN_IRQ_PRIORITY            (4U)
+#define CAN_DEFAULT_BITRATE         (500000UL)
+#define CAN_DEFAULT_DATA_BITRATE    (2000000UL)
+
+/* Driver state flags */
+#define CAN_FLAG_INITIALIZED        (1U << 0)
+#define CAN_FLAG_POWERED            (1U << 1)
+
+/* RX FIFO layout: RFFN = 1 -> 16 filter elements, MB0..9 occupied */
+#define CAN_FIFO_RFFN               (1U)
+#define CAN_FIFO_FILTER_COUNT       (16U)
+#define CAN_FIFO_MASKED_COUNT       (10U)       /**< Elements with an individual mask */
+#define CAN_FIFO_DEPTH              (6U)
+#define CAN_FIRST_MB                (10U)
+#define CAN_MAX_OBJECTS             (1U + 32U)  /**< RX FIFO + FD mode with 8 byte payload */
+
+/* Mailbox objects start at MB10 behind the RX FIFO, at MB0 in FD mode. */
+#define CAN_OBJ_TO_MB(info, obj)    ((uint8_t)((obj) - 1U + (info)->firstMb))
+#define CAN_MB_TO_OBJ(info, mb)     ((uint32_t)(mb) + 1U - (info)->firstMb)
+
+/* Filter element that never matches a data frame: used to fill unused slots. */
+#define CAN_FIFO_REJECT             (HAL_FLEXCAN_FILTER_RTR | HAL_FLEXCAN_FILTER_IDE | \
+                                     HAL_FLEXCAN_FILTER_EXT(0x1FFFFFFFUL))
+#define CAN_MASK_EXACT              (0xFFFFFFFFUL)
+
+#define CAN_CLASSIC_PAYLOAD         (8U)
+#define CAN_FD_PAYLOAD_MAX          (64U)
+
+/* Bit timing limits (CBT) */
+#define CAN_TQ_MIN                  (8UL)
+#define CAN_TQ_MAX                  (25UL)
+#define CAN_PRESDIV_MAX             (1024UL)
+#define CAN_PROP_SEG_MAX            (64UL)
+#define CAN_PHASE_SEG1_MAX          (32UL)
+#define CAN_PHASE_SEG2_MIN          (2UL)
+#define CAN_PHASE_SEG2_MAX          (32UL)
+
+/* FD data phase bit timing limits (FDCBT, FDCTRL.TDCOFF) */
+#define CAN_FD_TQ_MIN               (5UL)
+#define CAN_FD_TQ_MAX               (25UL)
+#define CAN_FD_PROP_SEG_MAX         (31UL)
+#define CAN_FD_PHASE_SEG1_MAX       (8UL)
+#define CAN_FD_PHASE_SEG2_MAX       (8UL)
+#define CAN_TDC_OFFSET_MAX          (31UL)
+#define CAN_FD_MB_RAM_WORDS         (128UL)     /**< FlexCAN0 MB RAM */
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    HAL_FLEXCAN_Instance_t  instance;
+    IRQn_Type               mbIrq[2];       /**< MB0..15, MB16..31 */
+    uint8_t                 mbIrqCount;
+    IRQn_Type               stateIrq;       /**< Bus off / warnings */
+    uint8_t                 port;           /**< Port of RX / TX */
+    uint8_t                 rxPin;
+    uint8_t                 txPin;
+    uint8_t                 pinMux;
+} CAN_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const CAN_Resources_t       *res;
+    ARM_CAN_SignalUnitEvent_t   cbUnitEvent;
+    ARM_CAN_SignalObjectEvent_t cbObjectEvent;
+    uint8_t                     flags;
+    uint8_t                     running;        /**< 0 = initialization (freeze) mode */
+    uint8_t                     unitState;      /**< ARM_CAN_UNIT_STATE_xxx */
+    uint8_t                     lastError;      /**< ARM_CAN_LEC_xxx */
+    uint8_t                     mbCount;
+    uint8_t                     numObjects;
+    uint8_t                     firstMb;        /**< Message buffer of object 1 */
+
+    uint8_t                     fdMode;
+    uint8_t                     payloadSize;    /**< Bytes per message buffer in FD mode */
+    uint8_t                     tdcDelay;       /**< Data phase tq, 0 = data sample point */
+    HAL_FLEXCAN_Timing_t        dataTiming;
+
+    uint16_t                    fifoUsed;       /**< Used filter elements */
+    uint32_t                    fifoFilter[CAN_FIFO_FILTER_COUNT];
+    uint32_t                    fifoMask[CAN_FIFO_FILTER_COUNT];
+
+    uint8_t                     objConfig[CAN_MAX_OBJECTS];     /**< ARM_CAN_OBJ_CONFIG */
+    uint8_t                     objHasFilter[CAN_MAX_OBJECTS];
+    uint32_t                    objId[CAN_MAX_OBJECTS];         /**< CMSIS ID (bit 31 = IDE) */
+    uint32_t                    objMask[CAN_MAX_OBJECTS];
+} CAN_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION CAN_GetVersion(void);
+static ARM_CAN_CAPABILITIES CAN_GetCapabilities(const CAN_Resources_t *res, const CAN_Info_t *info);
+
+static int32_t  CAN_Initialize(ARM_CAN_SignalUnitEvent_t cb_unit_event, ARM_CAN_SignalObjectEvent_t cb_object_event,
+                               const CAN_Resources_t *res, CAN_Info_t *info);
+static int32_t  CAN_Uninitialize(const CAN_Resources_t *res, CAN_Info_t *info);
+static int32_t  CAN_PowerControl(ARM_POWER_STATE state, const CAN_Resources_t *res, CAN_Info_t *info);
+static uint32_t CAN_GetClock(void);
+static int32_t  CAN_SetBitrate(ARM_CAN_BITRATE_SELECT select, uint32_t bitrate, uint32_t bit_segments, CAN_Info_t *info);
+static int32_t  CAN_SetMode(ARM_CAN_MODE mode, CAN_Info_t *info);
+static ARM_CAN_OBJ_CAPABILITIES CAN_ObjectGetCapabilities(uint32_t obj_idx, const CAN_Info_t *info);
+static int32_t  CAN_ObjectSetFilter(uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg,
+                                    CAN_Info_t *info);
+static int32_t  CAN_ObjectConfigure(uint32_t obj_idx, ARM_CAN_OBJ_CONFIG obj_cfg, CAN_Info_t *info);
+static int32_t  CAN_MessageSend(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size,
+                                CAN_Info_t *info);
+static int32_t  CAN_MessageRead(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size,
+                                CAN_Info_t *info);
+static int32_t  CAN_Control(uint32_t control, uint32_t arg, CAN_Info_t *info);
+static ARM_CAN_STATUS CAN_GetStatus(CAN_Info_t *info);
+
+static int32_t CAN_ComputeTiming(uint32_t bitrate, uint32_t segments, HAL_FLEXCAN_Timing_t *timing);
+static int32_t CAN_ComputeDataTiming(uint32_t bitrate, uint32_t segments, HAL_FLEXCAN_Timing_t *timing);
+static int32_t CAN_SetTransceiverDelay(uint32_t delay, CAN_Info_t *info);
+static void    CAN_ApplyLayout(CAN_Info_t *info);
+static void    CAN_ApplyDataPhase(const CAN_Info_t *info);
+static uint8_t CAN_TdcOffset(const CAN_Info_t *info);
+static int32_t CAN_PlanLayout(uint32_t arg, CAN_Info_t *info);
+static uint8_t CAN_LengthToDlc(uint8_t length);
+static void    CAN_EnterConfig(const CAN_Info_t *info);
+static void    CAN_LeaveConfig(const CAN_Info_t *info);
+static void    CAN_WriteFifoTable(const CAN_Info_t *info);
+static int32_t CAN_SetFifoFilter(ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg, CAN_Info_t *info);
+static int32_t CAN_SetMbFilter(uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg,
+                               CAN_Info_t *info);
+static void    CAN_ArmRxMb(uint32_t obj_idx, const CAN_Info_t *info);
+static uint32_t CAN_IdWord(uint32_t id);
+static void    CAN_WritePayload(volatile uint32_t *dst, const uint8_t *src, uint8_t size, uint8_t length);
+static uint8_t CAN_ReadFrame(const volatile uint32_t *mb, ARM_CAN_MSG_INFO *msgInfo, uint8_t *data, uint8_t size,
+                             uint8_t payloadSize);
+static void    CAN_UpdateLastError(CAN_Info_t *info, uint32_t status);
+static void    CAN_SetUnitState(CAN_Info_t *info, uint8_t state);
+static void    CAN_SignalObject(const CAN_Info_t *info, uint32_t obj_idx, uint32_t event);
+static void    CAN_MbIRQHandler(CAN_Info_t *info);
+static void    CAN_StateIRQHandler(CAN_Info_t *info);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_CAN_API_VERSION,
+    ARM_CAN_DRV_VERSION
+};
+
+/* FlexCAN0: PTE4 RX / PTE5 TX (ALT5), FlexCAN1: PTA12 / PTA13 (ALT3), FlexCAN2: PTC16 / PTC17 (ALT3). */
+static const CAN_Resources_t s_can0Res =
+{
+    HAL_FLEXCAN_0, { CAN0_ORed_0_15_MB_IRQn, CAN0_ORed_16_31_MB_IRQn }, 2U, CAN0_ORed_IRQn,
+    HAL_GPIO_PORT_E, 4U, 5U, 5U
+};
+
+static const CAN_Resources_t s_can1Res =
+{
+    HAL_FLEXCAN_1, { CAN1_ORed_0_15_MB_IRQn, NotAvail_IRQn }, 1U, CAN1_ORed_IRQn,
+    HAL_GPIO_PORT_A, 12U, 13U, 3U
+};
+
+static const CAN_Resources_t s_can2Res =
+{
+    HAL_FLEXCAN_2, { CAN2_ORed_0_15_MB_IRQn, NotAvail_IRQn }, 1U, CAN2_ORed_IRQn,
+    HAL_GPIO_PORT_C, 16U, 17U, 3U
+};
+
+/* CAN FD data length code to payload bytes */
+static const uint8_t s_dlcLength[16] =
+{
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U
+};
+
+static CAN_Info_t s_can0Info;
+static CAN_Info_t s_can1Info;
+static CAN_Info_t s_can2Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION CAN_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_CAN_CAPABILITIES CAN_GetCapabilities(const CAN_Resources_t *res, const CAN_Info_t *info)
+{
+    ARM_CAN_CAPABILITIES capabilities;
+
+    if (0U != (info->flags & CAN_FLAG_POWERED))
+    {
+        capabilities.num_objects = info->numObjects;
+    }
+    else
+    {
+        /* Classic layout until powered */
+        capabilities.num_objects = 1U + (uint32_t)HAL_FLEXCAN_GetMbCount(res->instance) - CAN_FIRST_MB;
+    }
+
+    capabilities.reentrant_operation = 0U;
+    capabilities.fd_mode             = HAL_FLEXCAN_HasFd(res->instance);
+    capabilities.restricted_mode     = 0U;
+    capabilities.monitor_mode        = 1U;
+    capabilities.internal_loopback   = 1U;
+    capabilities.external_loopback   = 1U;
+    capabilities.reserved            = 0U;
+
+    return capabilities;
+}
+
+static int32_t CAN_Initialize(ARM_CAN_SignalUnitEvent_t cb_unit_event, ARM_CAN_SignalObjectEvent_t cb_object_event,
+                              const CAN_Resources_t *res, CAN_Info_t *info)
+{
+    if (0U == (info->flags & CAN_FLAG_INITIALIZED))
+    {
+        HAL_GPIO_SetPinMux(res->port, res->rxPin, res->pinMux);
+        HAL_GPIO_SetPinMux(res->port, res->txPin, res->pinMux);
+
+        info->res           = res;
+        info->cbUnitEvent   = cb_unit_event;
+        info->cbObjectEvent = cb_object_event;
+        info->flags         = CAN_FLAG_INITIALIZED;
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t CAN_Uninitialize(const CAN_Resources_t *res, CAN_Info_t *info)
+{
+    (void)CAN_PowerControl(ARM_POWER_OFF, res, info);
+
+    info->flags         = 0U;
+    info->cbUnitEvent   = NULL;
+    info->cbObjectEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t CAN_PowerControl(ARM_POWER_STATE state, const CAN_Resources_t *res, CAN_Info_t *info)
+{
+    int32_t result;
+    uint32_t i;
+    HAL_FLEXCAN_Timing_t timing;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != (info->flags & CAN_FLAG_POWERED))
+            {
+                for (i = 0U; i < res->mbIrqCount; i++)
+                {
+                    HAL_NVIC_DisableIRQ(res->mbIrq[i]);
+                }
+                HAL_NVIC_DisableIRQ(res->stateIrq);
+                HAL_FLEXCAN_Deinit(res->instance);
+            }
+            else
+            {
+                /* Already off */
+            }
+
+            info->running   = 0U;
+            info->unitState = ARM_CAN_UNIT_STATE_INACTIVE;
+            info->flags &= (uint8_t)~CAN_FLAG_POWERED;
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & CAN_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & CAN_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                /* Left in freeze (initialization) mode */
+                HAL_FLEXCAN_Init(res->instance);
+
+                info->running     = 0U;
+                info->unitState   = ARM_CAN_UNIT_STATE_INACTIVE;
+                info->lastError   = ARM_CAN_LEC_NO_ERROR;
+                info->fifoUsed    = 0U;
+                info->fdMode      = 0U;
+                info->payloadSize = CAN_FD_PAYLOAD_MAX;
+                info->tdcDelay    = (uint8_t)CAN_TRANSCEIVER_DELAY_AUTO;
+
+                HAL_FLEXCAN_SetRxFifoGlobalMask(res->instance, CAN_MASK_EXACT);
+                CAN_ApplyLayout(info);
+
+                (void)CAN_ComputeTiming(CAN_DEFAULT_BITRATE, CAN_BIT_SEGMENTS_AUTO, &timing);
+                HAL_FLEXCAN_SetTiming(res->instance, &timing);
+                (void)CAN_ComputeDataTiming(CAN_DEFAULT_DATA_BITRATE, CAN_BIT_SEGMENTS_AUTO, &info->dataTiming);
+
+                HAL_FLEXCAN_EnableStateInterrupts(res->instance, 1U);
+
+                for (i = 0U; i < res->mbIrqCount; i++)
+                {
+                    HAL_NVIC_SetPriority(res->mbIrq[i], CAN_IRQ_PRIORITY);
+                    HAL_NVIC_ClearPendingIRQ(res->mbIrq[i]);
+                    HAL_NVIC_EnableIRQ(res->mbIrq[i]);
+                }
+                HAL_NVIC_SetPriority(res->stateIrq, CAN_IRQ_PRIORITY);
+                HAL_NVIC_ClearPendingIRQ(res->stateIrq);
+                HAL_NVIC_EnableIRQ(res->stateIrq);
+
+                info->flags |= CAN_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+static uint32_t CAN_GetClock(void)
+{
+    return HAL_FLEXCAN_CLOCK_HZ;
+}
+
+static int32_t CAN_ComputeTiming(uint32_t bitrate, uint32_t segments, HAL_FLEXCAN_Timing_t *timing)
+{
+    int32_t result;
+    uint32_t tq;
+    uint32_t preDivider;
+    uint32_t propSeg;
+    uint32_t phaseSeg1;
+    uint32_t phaseSeg2;
+    uint32_t sjw;
+
+    result = ARM_CAN_INVALID_BITRATE;
+
+    if (0U == bitrate)
+    {
+        /* Invalid bitrate */
+    }
+    else if (CAN_BIT_SEGMENTS_AUTO == segments)
+    {
+        /* Most time quanta first: finest resynchronisation, sample point near 80 %. */
+        for (tq = CAN_TQ_MAX; (tq >= CAN_TQ_MIN) && (ARM_DRIVER_OK != result); tq--)
+        {
+            preDivider = HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq);
+
+            if ((0U == (HAL_FLEXCAN_CLOCK_HZ % (bitrate * tq))) && (preDivider <= CAN_PRESDIV_MAX))
+            {
+                phaseSeg2 = tq / 5UL;
+                phaseSeg2 = (phaseSeg2 < CAN_PHASE_SEG2_MIN) ? CAN_PHASE_SEG2_MIN : phaseSeg2;
+                phaseSeg1 = (tq - 1UL - phaseSeg2) / 2UL;
+                propSeg   = tq - 1UL - phaseSeg2 - phaseSeg1;
+
+                timing->preDivider = (uint16_t)preDivider;
+                timing->propSeg    = (uint8_t)propSeg;
+                timing->phaseSeg1  = (uint8_t)phaseSeg1;
+                timing->phaseSeg2  = (uint8_t)phaseSeg2;
+                timing->sjw        = (uint8_t)phaseSeg2;
+                result = ARM_DRIVER_OK;
+            }
+            else
+            {
+                /* Not an exact divider, try fewer time quanta */
+            }
+        }
+    }
+    else
+    {
+        propSeg   = (segments & ARM_CAN_BIT_PROP_SEG_Msk) >> ARM_CAN_BIT_PROP_SEG_Pos;
+        phaseSeg1 = (segments & ARM_CAN_BIT_PHASE_SEG1_Msk) >> ARM_CAN_BIT_PHASE_SEG1_Pos;
+        phaseSeg2 = (segments & ARM_CAN_BIT_PHASE_SEG2_Msk) >> ARM_CAN_BIT_PHASE_SEG2_Pos;
+        sjw       = (segments & ARM_CAN_BIT_SJW_Msk) >> ARM_CAN_BIT_SJW_Pos;
+        tq        = 1UL + propSeg + phaseSeg1 + phaseSeg2;
+
+        if ((0U == propSeg) || (propSeg > CAN_PROP_SEG_MAX))
+        {
+            result = ARM_CAN_INVALID_BIT_PROP_SEG;
+        }
+        else if ((0U == phaseSeg1) || (phaseSeg1 > CAN_PHASE_SEG1_MAX))
+        {
+            result = ARM_CAN_INVALID_BIT_PHASE_SEG1;
+        }
+        else if ((phaseSeg2 < CAN_PHASE_SEG2_MIN) || (phaseSeg2 > CAN_PHASE_SEG2_MAX))
+        {
+            result = ARM_CAN_INVALID_BIT_PHASE_SEG2;
+        }
+        else if ((0U == sjw) || (sjw > phaseSeg2))
+        {
+            result = ARM_CAN_INVALID_BIT_SJW;
+        }
+        else if ((0U != (HAL_FLEXCAN_CLOCK_HZ % (bitrate * tq))) ||
+                 ((HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq)) > CAN_PRESDIV_MAX) ||
+                 ((HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq)) == 0U))
+        {
+            /* Bitrate not reachable with these segments */
+        }
+        else
+        {
+            timing->preDivider = (uint16_t)(HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq));
+            timing->propSeg    = (uint8_t)propSeg;
+            timing->phaseSeg1  = (uint8_t)phaseSeg1;
+            timing->phaseSeg2  = (uint8_t)phaseSeg2;
+            timing->sjw        = (uint8_t)sjw;
+            result = ARM_DRIVER_OK;
+        }
+    }
+
+    return result;
+}
+
+static int32_t CAN_ComputeDataTiming(uint32_t bitrate, uint32_t segments, HAL_FLEXCAN_Timing_t *timing)
+{
+    int32_t result;
+    uint32_t tq;
+    uint32_t preDivider;
+    uint32_t propSeg;
+    uint32_t phaseSeg1;
+    uint32_t phaseSeg2;
+    uint32_t sjw;
+
+    result = ARM_CAN_INVALID_BITRATE;
+
+    if (0U == bitrate)
+    {
+        /* Invalid bitrate */
+    }
+    else if (CAN_BIT_SEGMENTS_AUTO == segments)
+    {
+        /* Smallest prescaler first: keeps the TDC offset (in clocks) short. Sample point near 75 %. */
+        for (preDivider = 1UL; (preDivider <= CAN_PRESDIV_MAX) && (ARM_DRIVER_OK != result); preDivider++)
+        {
+            tq = HAL_FLEXCAN_CLOCK_HZ / (bitrate * preDivider);
+
+            if ((0U == (HAL_FLEXCAN_CLOCK_HZ % (bitrate * preDivider))) && (tq >= CAN_FD_TQ_MIN) &&
+                (tq <= CAN_FD_TQ_MAX))
+            {
+                phaseSeg2 = tq / 4UL;
+                phaseSeg2 = (phaseSeg2 < CAN_PHASE_SEG2_MIN) ? CAN_PHASE_SEG2_MIN : phaseSeg2;
+                phaseSeg2 = (phaseSeg2 > CAN_FD_PHASE_SEG2_MAX) ? CAN_FD_PHASE_SEG2_MAX : phaseSeg2;
+                phaseSeg1 = (tq - 1UL - phaseSeg2) / 2UL;
+                phaseSeg1 = (phaseSeg1 > CAN_FD_PHASE_SEG1_MAX) ? CAN_FD_PHASE_SEG1_MAX : phaseSeg1;
+                propSeg   = tq - 1UL - phaseSeg2 - phaseSeg1;
+
+                timing->preDivider = (uint16_t)preDivider;
+                timing->propSeg    = (uint8_t)propSeg;
+                timing->phaseSeg1  = (uint8_t)phaseSeg1;
+                timing->phaseSeg2  = (uint8_t)phaseSeg2;
+                timing->sjw        = (uint8_t)phaseSeg2;
+                result = ARM_DRIVER_OK;
+            }
+            else
+            {
+                /* Not an exact divider or out of range, try a larger prescaler */
+            }
+        }
+    }
+    else
+    {
+        propSeg   = (segments & ARM_CAN_BIT_PROP_SEG_Msk) >> ARM_CAN_BIT_PROP_SEG_Pos;
+        phaseSeg1 = (segments & ARM_CAN_BIT_PHASE_SEG1_Msk) >> ARM_CAN_BIT_PHASE_SEG1_Pos;
+        phaseSeg2 = (segments & ARM_CAN_BIT_PHASE_SEG2_Msk) >> ARM_CAN_BIT_PHASE_SEG2_Pos;
+        sjw       = (segments & ARM_CAN_BIT_SJW_Msk) >> ARM_CAN_BIT_SJW_Pos;
+        tq        = 1UL + propSeg + phaseSeg1 + phaseSeg2;
+
+        if (propSeg > CAN_FD_PROP_SEG_MAX)
+        {
+            result = ARM_CAN_INVALID_BIT_PROP_SEG;
+        }
+        else if ((0U == phaseSeg1) || (phaseSeg1 > CAN_FD_PHASE_SEG1_MAX))
+        {
+            result = ARM_CAN_INVALID_BIT_PHASE_SEG1;
+        }
+        else if ((phaseSeg2 < CAN_PHASE_SEG2_MIN) || (phaseSeg2 > CAN_FD_PHASE_SEG2_MAX))
+        {
+            result = ARM_CAN_INVALID_BIT_PHASE_SEG2;
+        }
+        else if ((0U == sjw) || (sjw > phaseSeg2))
+        {
+            result = ARM_CAN_INVALID_BIT_SJW;
+        }
+        else if ((0U != (HAL_FLEXCAN_CLOCK_HZ % (bitrate * tq))) ||
+                 ((HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq)) > CAN_PRESDIV_MAX) ||
+                 ((HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq)) == 0U))
+        {
+            /* Bitrate not reachable with these segments */
+        }
+        else
+        {
+            timing->preDivider = (uint16_t)(HAL_FLEXCAN_CLOCK_HZ / (bitrate * tq));
+            timing->propSeg    = (uint8_t)propSeg;
+            timing->phaseSeg1  = (uint8_t)phaseSeg1;
+            timing->phaseSeg2  = (uint8_t)phaseSeg2;
+            timing->sjw        = (uint8_t)sjw;
+            result = ARM_DRIVER_OK;
+        }
+    }
+
+    return result;
+}
+
+static uint8_t CAN_TdcOffset(const CAN_Info_t *info)
+{
+    uint32_t tq;
+    uint32_t offset;
+
+    if (CAN_TRANSCEIVER_DELAY_AUTO != info->tdcDelay)
+    {
+        tq = info->tdcDelay;
+    }
+    else
+    {
+        /* Secondary sample point at the data phase sample point */
+        tq = 1UL + info->dataTiming.propSeg + info->dataTiming.phaseSeg1;
+    }
+
+    offset = tq * info->dataTiming.preDivider;
+
+    /* Beyond 31 clocks the data phase is slow enough to need no compensation. */
+    return (offset <= CAN_TDC_OFFSET_MAX) ? (uint8_t)offset : 0U;
+}
+
+static void CAN_ApplyDataPhase(const CAN_Info_t *info)
+{
+    if (0U != info->fdMode)
+    {
+        HAL_FLEXCAN_SetDataTiming(info->res->instance, &info->dataTiming);
+        HAL_FLEXCAN_SetTdc(info->res->instance, CAN_TdcOffset(info));
+    }
+    else
+    {
+        /* Classic CAN: no data phase */
+    }
+}
+
+static int32_t CAN_SetTransceiverDelay(uint32_t delay, CAN_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == HAL_FLEXCAN_HasFd(info->res->instance))
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if ((delay * info->dataTiming.preDivider) > CAN_TDC_OFFSET_MAX)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        info->tdcDelay = (uint8_t)delay;
+
+        CAN_EnterConfig(info);
+        CAN_ApplyDataPhase(info);
+        CAN_LeaveConfig(info);
+    }
+
+    return result;
+}
+
+static void CAN_ApplyLayout(CAN_Info_t *info)
+{
+    uint32_t i;
+
+    /* Module frozen. Object to message buffer mapping changes: all objects restart inactive. */
+    HAL_FLEXCAN_ConfigureFd(info->res->instance, (0U != info->fdMode) ? info->payloadSize : 0U);
+
+    info->fifoUsed = 0U;
+
+    if (0U != info->fdMode)
+    {
+        info->firstMb = 0U;
+        CAN_ApplyDataPhase(info);
+    }
+    else
+    {
+        info->firstMb = CAN_FIRST_MB;
+        HAL_FLEXCAN_EnableRxFifo(info->res->instance, CAN_FIFO_RFFN);
+        CAN_WriteFifoTable(info);
+    }
+
+    info->mbCount    = HAL_FLEXCAN_GetMbCount(info->res->instance);
+    info->numObjects = (uint8_t)(1U + info->mbCount - info->firstMb);
+
+    for (i = 0U; i < CAN_MAX_OBJECTS; i++)
+    {
+        info->objConfig[i]    = (uint8_t)ARM_CAN_OBJ_INACTIVE;
+        info->objHasFilter[i] = 0U;
+    }
+}
+
+static int32_t CAN_PlanLayout(uint32_t arg, CAN_Info_t *info)
+{
+    int32_t result;
+    uint32_t payload;
+    uint32_t mailboxes;
+    uint32_t size;
+
+    result    = ARM_DRIVER_OK;
+    payload   = arg & 0xFFUL;
+    mailboxes = (arg >> 8) & 0xFFUL;
+
+    /* Smallest message buffer size holding the largest frame leaves the most mailboxes. */
+    for (size = CAN_CLASSIC_PAYLOAD; size < payload; size <<= 1)
+    {
+        /* 8, 16, 32, 64 */
+    }
+
+    if (0U == HAL_FLEXCAN_HasFd(info->res->instance))
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if (0U != info->running)
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((payload > CAN_FD_PAYLOAD_MAX) ||
+             (mailboxes > (CAN_FD_MB_RAM_WORDS / (2UL + (size / 4UL)))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        info->payloadSize = (uint8_t)size;
+
+        if (0U != info->fdMode)
+        {
+            CAN_ApplyLayout(info);
+        }
+        else
+        {
+            /* Applied when FD mode is enabled */
+        }
+    }
+
+    return result;
+}
+
+static void CAN_EnterConfig(const CAN_Info_t *info)
+{
+    if (0U != info->running)
+    {
+        HAL_FLEXCAN_EnterFreeze(info->res->instance);
+    }
+    else
+    {
+        /* Already frozen */
+    }
+}
+
+static void CAN_LeaveConfig(const CAN_Info_t *info)
+{
+    if (0U != info->running)
+    {
+        HAL_FLEXCAN_ExitFreeze(info->res->instance);
+    }
+    else
+    {
+        /* Stay in initialization mode */
+    }
+}
+
+static int32_t CAN_SetBitrate(ARM_CAN_BITRATE_SELECT select, uint32_t bitrate, uint32_t bit_segments, CAN_Info_t *info)
+{
+    int32_t result;
+    HAL_FLEXCAN_Timing_t timing;
+
+    if (0U == (info->flags & CAN_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (ARM_CAN_BITRATE_NOMINAL == select)
+    {
+        result = CAN_ComputeTiming(bitrate, bit_segments, &timing);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            CAN_EnterConfig(info);
+            HAL_FLEXCAN_SetTiming(info->res->instance, &timing);
+            CAN_LeaveConfig(info);
+        }
+        else
+        {
+            /* Error already reported */
+        }
+    }
+    else if ((ARM_CAN_BITRATE_FD_DATA == select) && (0U != HAL_FLEXCAN_HasFd(info->res->instance)))
+    {
+        result = CAN_ComputeDataTiming(bitrate, bit_segments, &timing);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            /* Kept for FD mode, the TDC offset follows the new sample point. */
+            info->dataTiming = timing;
+
+            CAN_EnterConfig(info);
+            CAN_ApplyDataPhase(info);
+            CAN_LeaveConfig(info);
+        }
+        else
+        {
+            /* Error already reported */
+        }
+    }
+    else
+    {
+        result = ARM_CAN_INVALID_BITRATE_SELECT;
+    }
+
+    return result;
+}
+
+static int32_t CAN_SetMode(ARM_CAN_MODE mode, CAN_Info_t *info)
+{
+    int32_t result;
+    HAL_FLEXCAN_Mode_t halMode;
+
+    result  = ARM_DRIVER_OK;
+    halMode = HAL_FLEXCAN_MODE_NORMAL;
+
+    switch (mode)
+    {
+        case ARM_CAN_MODE_INITIALIZATION:
+            break;
+
+        case ARM_CAN_MODE_NORMAL:
+            halMode = HAL_FLEXCAN_MODE_NORMAL;
+            break;
+
+        case ARM_CAN_MODE_MONITOR:
+            halMode = HAL_FLEXCAN_MODE_LISTEN_ONLY;
+            break;
+
+        case ARM_CAN_MODE_LOOPBACK_INTERNAL:
+            halMode = HAL_FLEXCAN_MODE_LOOPBACK;
+            break;
+
+        case ARM_CAN_MODE_LOOPBACK_EXTERNAL:
+            halMode = HAL_FLEXCAN_MODE_SELF_RECEPTION;
+            break;
+
+        case ARM_CAN_MODE_RESTRICTED:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    if (0U == (info->flags & CAN_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (ARM_DRIVER_OK != result)
+    {
+        /* Error already reported */
+    }
+    else
+    {
+        HAL_FLEXCAN_EnterFreeze(info->res->instance);
+
+        if (ARM_CAN_MODE_INITIALIZATION == mode)
+        {
+            info->running = 0U;
+            CAN_SetUnitState(info, ARM_CAN_UNIT_STATE_INACTIVE);
+        }
+        else
+        {
+            HAL_FLEXCAN_SetMode(info->res->instance, halMode);
+            HAL_FLEXCAN_ExitFreeze(info->res->instance);
+            info->running = 1U;
+            CAN_SetUnitState(info, ARM_CAN_UNIT_STATE_ACTIVE);
+        }
+    }
+
+    return result;
+}
+
+static ARM_CAN_OBJ_CAPABILITIES CAN_ObjectGetCapabilities(uint32_t obj_idx, const CAN_Info_t *info)
+{
+    ARM_CAN_OBJ_CAPABILITIES capabilities;
+
+    capabilities.tx               = 0U;
+    capabilities.rx               = 0U;
+    capabilities.rx_rtr_tx_data   = 0U;
+    capabilities.tx_rtr_rx_data   = 0U;
+    capabilities.multiple_filters = 0U;
+    capabilities.exact_filtering  = 0U;
+    capabilities.range_filtering  = 0U;
+    capabilities.mask_filtering   = 0U;
+    capabilities.message_depth    = 0U;
+    capabilities.reserved         = 0U;
+
+    if ((CAN_OBJ_RX_FIFO == obj_idx) && (0U != info->fdMode))
+    {
+        /* No RX FIFO in FD mode */
+    }
+    else if (CAN_OBJ_RX_FIFO == obj_idx)
+    {
+        capabilities.rx               = 1U;
+        capabilities.multiple_filters = 1U;
+        capabilities.exact_filtering  = 1U;
+        capabilities.mask_filtering   = 1U;
+        capabilities.message_depth    = CAN_FIFO_DEPTH;
+    }
+    else if (obj_idx < info->numObjects)
+    {
+        capabilities.tx              = 1U;
+        capabilities.rx              = 1U;
+        capabilities.exact_filtering = 1U;
+        capabilities.mask_filtering  = 1U;
+        capabilities.message_depth   = 1U;
+    }
+    else
+    {
+        /* Invalid object: no capabilities */
+    }
+
+    return capabilities;
+}
+
+static uint32_t CAN_IdWord(uint32_t id)
+{
+    uint32_t word;
+
+    if (0U != (id & ARM_CAN_ID_IDE_Msk))
+    {
+        word = HAL_FLEXCAN_ID_EXT(id);
+    }
+    else
+    {
+        word = HAL_FLEXCAN_ID_STD(id);
+    }
+
+    return word;
+}
+
+static void CAN_WriteFifoTable(const CAN_Info_t *info)
+{
+    uint32_t fill;
+    uint32_t fillMask;
+    uint8_t i;
+
+    /* Unused elements repeat the first used filter, or reject all data frames. */
+    fill     = CAN_FIFO_REJECT;
+    fillMask = CAN_MASK_EXACT;
+
+    for (i = 0U; i < CAN_FIFO_FILTER_COUNT; i++)
+    {
+        if (0U != (info->fifoUsed & (1U << i)))
+        {
+            fill     = info->fifoFilter[i];
+            fillMask = info->fifoMask[i];
+            break;
+        }
+        else
+        {
+            /* Keep searching */
+        }
+    }
+
+    for (i = 0U; i < CAN_FIFO_FILTER_COUNT; i++)
+    {
+        if (0U != (info->fifoUsed & (1U << i)))
+        {
+            HAL_FLEXCAN_SetRxFifoFilter(info->res->instance, i, info->fifoFilter[i]);
+        }
+        else
+        {
+            HAL_FLEXCAN_SetRxFifoFilter(info->res->instance, i, fill);
+        }
+
+        if (i < CAN_FIFO_MASKED_COUNT)
+        {
+            HAL_FLEXCAN_SetIndividualMask(info->res->instance, i,
+                                          (0U != (info->fifoUsed & (1U << i))) ? info->fifoMask[i] : fillMask);
+        }
+        else
+        {
+            /* Covered by the (exact) RX FIFO global mask */
+        }
+    }
+}
+
+static int32_t CAN_SetFifoFilter(ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg, CAN_Info_t *info)
+{
+    int32_t result;
+    uint32_t element;
+    uint32_t mask;
+    uint8_t first;
+    uint8_t slot;
+    uint8_t i;
+
+    result = ARM_DRIVER_OK;
+    slot   = CAN_FIFO_FILTER_COUNT;
+
+    /* Format A: data frames only (RTR compared), IDE always compared. */
+    if (0U != (id & ARM_CAN_ID_IDE_Msk))
+    {
+        element = HAL_FLEXCAN_FILTER_IDE | HAL_FLEXCAN_FILTER_EXT(id);
+        mask    = HAL_FLEXCAN_FILTER_RTR | HAL_FLEXCAN_FILTER_IDE | HAL_FLEXCAN_FILTER_EXT(arg);
+    }
+    else
+    {
+        element = HAL_FLEXCAN_FILTER_STD(id);
+        mask    = HAL_FLEXCAN_FILTER_RTR | HAL_FLEXCAN_FILTER_IDE | HAL_FLEXCAN_FILTER_STD(arg);
+    }
+
+    switch (operation)
+    {
+        case ARM_CAN_FILTER_ID_EXACT_ADD:
+        case ARM_CAN_FILTER_ID_MASKABLE_ADD:
+            if (ARM_CAN_FILTER_ID_EXACT_ADD == operation)
+            {
+                /* Exact filters go to the globally masked elements first. */
+                mask  = CAN_MASK_EXACT;
+                first = CAN_FIFO_MASKED_COUNT;
+            }
+            else
+            {
+                first = 0U;
+            }
+
+            for (i = 0U; (i < CAN_FIFO_FILTER_COUNT) && (CAN_FIFO_FILTER_COUNT == slot); i++)
+            {
+                slot = (uint8_t)((first + i) % CAN_FIFO_FILTER_COUNT);
+
+                if ((0U != (info->fifoUsed & (1U << slot))) ||
+                    ((CAN_MASK_EXACT != mask) && (slot >= CAN_FIFO_MASKED_COUNT)))
+                {
+                    slot = CAN_FIFO_FILTER_COUNT;
+                }
+                else
+                {
+                    /* Free slot found */
+                }
+            }
+
+            if (CAN_FIFO_FILTER_COUNT == slot)
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                info->fifoFilter[slot] = element;
+                info->fifoMask[slot]   = mask;
+                info->fifoUsed |= (uint16_t)(1U << slot);
+            }
+            break;
+
+        case ARM_CAN_FILTER_ID_EXACT_REMOVE:
+        case ARM_CAN_FILTER_ID_MASKABLE_REMOVE:
+            mask = (ARM_CAN_FILTER_ID_EXACT_REMOVE == operation) ? CAN_MASK_EXACT : mask;
+
+            for (i = 0U; (i < CAN_FIFO_FILTER_COUNT) && (CAN_FIFO_FILTER_COUNT == slot); i++)
+            {
+                if ((0U != (info->fifoUsed & (1U << i))) &&
+                    (element == info->fifoFilter[i]) && (mask == info->fifoMask[i]))
+                {
+                    slot = i;
+                }
+                else
+                {
+                    /* Keep searching */
+                }
+            }
+
+            if (CAN_FIFO_FILTER_COUNT == slot)
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                info->fifoUsed &= (uint16_t)~(1U << slot);
+            }
+            break;
+
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        CAN_EnterConfig(info);
+        CAN_WriteFifoTable(info);
+        CAN_LeaveConfig(info);
+    }
+    else
+    {
+        /* Table unchanged */
+    }
+
+    return result;
+}
+
+static void CAN_ArmRxMb(uint32_t obj_idx, const CAN_Info_t *info)
+{
+    volatile uint32_t *mb;
+
+    mb = HAL_FLEXCAN_GetMb(info->res->instance, CAN_OBJ_TO_MB(info, obj_idx));
+
+    mb[0] = HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_RX_INACTIVE);
+
+    if (0U != info->objHasFilter[obj_idx])
+    {
+        mb[1] = CAN_IdWord(info->objId[obj_idx]);
+        mb[0] = HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_RX_EMPTY) |
+                ((0U != (info->objId[obj_idx] & ARM_CAN_ID_IDE_Msk)) ? HAL_FLEXCAN_CS_IDE : 0U);
+    }
+    else
+    {
+        /* No filter: leave the mailbox inactive */
+    }
+}
+
+static int32_t CAN_SetMbFilter(uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg,
+                               CAN_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    switch (operation)
+    {
+        case ARM_CAN_FILTER_ID_EXACT_ADD:
+        case ARM_CAN_FILTER_ID_MASKABLE_ADD:
+            if (0U != info->objHasFilter[obj_idx])
+            {
+                /* One filter per mailbox */
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                info->objId[obj_idx]        = id;
+                info->objMask[obj_idx]      = (ARM_CAN_FILTER_ID_EXACT_ADD == operation) ? CAN_MASK_EXACT : arg;
+                info->objHasFilter[obj_idx] = 1U;
+            }
+            break;
+
+        case ARM_CAN_FILTER_ID_EXACT_REMOVE:
+        case ARM_CAN_FILTER_ID_MASKABLE_REMOVE:
+            if ((0U == info->objHasFilter[obj_idx]) || (id != info->objId[obj_idx]))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                info->objHasFilter[obj_idx] = 0U;
+            }
+            break;
+
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        CAN_EnterConfig(info);
+        HAL_FLEXCAN_SetIndividualMask(info->res->instance, CAN_OBJ_TO_MB(info, obj_idx),
+                                      CAN_IdWord((info->objMask[obj_idx] & ~ARM_CAN_ID_IDE_Msk) |
+                                                 (info->objId[obj_idx] & ARM_CAN_ID_IDE_Msk)));
+        if ((uint8_t)ARM_CAN_OBJ_RX == info->objConfig[obj_idx])
+        {
+            CAN_ArmRxMb(obj_idx, info);
+        }
+        else
+        {
+            /* Applied when the object is configured for RX */
+        }
+        CAN_LeaveConfig(info);
+    }
+    else
+    {
+        /* Filter unchanged */
+    }
+
+    return result;
+}
+
+static int32_t CAN_ObjectSetFilter(uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation, uint32_t id, uint32_t arg,
+                                   CAN_Info_t *info)
+{
+    int32_t result;
+
+    if (0U == (info->flags & CAN_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (obj_idx >= info->numObjects)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((CAN_OBJ_RX_FIFO == obj_idx) && (0U != info->fdMode))
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if (CAN_OBJ_RX_FIFO == obj_idx)
+    {
+        result = CAN_SetFifoFilter(operation, id, arg, info);
+    }
+    else
+    {
+        result = CAN_SetMbFilter(obj_idx, operation, id, arg, info);
+    }
+
+    return result;
+}
+
+static int32_t CAN_ObjectConfigure(uint32_t obj_idx, ARM_CAN_OBJ_CONFIG obj_cfg, CAN_Info_t *info)
+{
+    int32_t result;
+    uint8_t mbIndex;
+    volatile uint32_t *mb;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & CAN_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (obj_idx >= info->numObjects)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((CAN_OBJ_RX_FIFO == obj_idx) && (0U != info->fdMode))
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if (CAN_OBJ_RX_FIFO == obj_idx)
+    {
+        switch (obj_cfg)
+        {
+            case ARM_CAN_OBJ_INACTIVE:
+                HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, 5U, 0U);
+                HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, 7U, 0U);
+                break;
+
+            case ARM_CAN_OBJ_RX:
+                HAL_FLEXCAN_ClearMbFlags(info->res->instance, HAL_FLEXCAN_RXFIFO_FLAG_WARNING |
+                                                              HAL_FLEXCAN_RXFIFO_FLAG_OVERFLOW);
+                HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, 5U, 1U);
+                HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, 7U, 1U);
+                break;
+
+            default:
+                result = ARM_DRIVER_ERROR_PARAMETER;
+                break;
+        }
+    }
+    else
+    {
+        mbIndex = CAN_OBJ_TO_MB(info, obj_idx);
+        mb      = HAL_FLEXCAN_GetMb(info->res->instance, mbIndex);
+
+        HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, mbIndex, 0U);
+
+        switch (obj_cfg)
+        {
+            case ARM_CAN_OBJ_INACTIVE:
+                mb[0] = HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_RX_INACTIVE);
+                break;
+
+            case ARM_CAN_OBJ_TX:
+                mb[0] = HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_TX_INACTIVE);
+                break;
+
+            case ARM_CAN_OBJ_RX:
+                info->objConfig[obj_idx] = (uint8_t)ARM_CAN_OBJ_RX;
+                CAN_ArmRxMb(obj_idx, info);
+                break;
+
+            default:
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+
+        if ((ARM_DRIVER_OK == result) && (ARM_CAN_OBJ_INACTIVE != obj_cfg))
+        {
+            HAL_FLEXCAN_ClearMbFlags(info->res->instance, 1UL << mbIndex);
+            HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, mbIndex, 1U);
+        }
+        else
+        {
+            /* Object stays silent */
+        }
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        info->objConfig[obj_idx] = (uint8_t)obj_cfg;
+    }
+    else
+    {
+        /* Configuration unchanged */
+    }
+
+    return result;
+}
+
+static uint8_t CAN_LengthToDlc(uint8_t length)
+{
+    uint8_t dlc;
+
+    /* Smallest data length code holding length bytes */
+    for (dlc = 0U; (dlc < 15U) && (s_dlcLength[dlc] < length); dlc++)
+    {
+        /* Keep searching */
+    }
+
+    return dlc;
+}
+
+static void CAN_WritePayload(volatile uint32_t *dst, const uint8_t *src, uint8_t size, uint8_t length)
+{
+    uint32_t word;
+    uint8_t i;
+    uint8_t j;
+
+    /* Straight from the caller buffer into MB RAM, big-endian words, zero padded up to the DLC length. */
+    for (i = 0U; i < length; i += 4U)
+    {
+        word = 0U;
+
+        for (j = 0U; j < 4U; j++)
+        {
+            word <<= 8U;
+            if ((uint8_t)(i + j) < size)
+            {
+                word |= src[i + j];
+            }
+            else
+            {
+                /* Padding */
+            }
+        }
+
+        dst[i / 4U] = word;
+    }
+}
+
+static int32_t CAN_MessageSend(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size,
+                               CAN_Info_t *info)
+{
+    int32_t result;
+    uint32_t cs;
+    uint8_t dlc;
+    volatile uint32_t *mb;
+
+    if ((0U == (info->flags & CAN_FLAG_POWERED)) || (0U == info->running))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((CAN_OBJ_RX_FIFO == obj_idx) || (obj_idx >= info->numObjects) || (NULL == msg_info) ||
+             ((NULL == data) && (0U != size) && (0U == msg_info->rtr)) ||
+             ((0U != msg_info->edl) && ((0U == info->fdMode) || (0U != msg_info->rtr))))
+    {
+        /* FD frames need FD mode and have no remote form */
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((uint8_t)ARM_CAN_OBJ_TX != info->objConfig[obj_idx])
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        mb = HAL_FLEXCAN_GetMb(info->res->instance, CAN_OBJ_TO_MB(info, obj_idx));
+
+        if (HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_TX_DATA) == (mb[0] & HAL_FLEXCAN_CS_CODE_MASK))
+        {
+            result = ARM_DRIVER_ERROR_BUSY;
+        }
+        else
+        {
+            cs = HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_TX_DATA);
+
+            if (0U != msg_info->rtr)
+            {
+                cs  |= HAL_FLEXCAN_CS_RTR | HAL_FLEXCAN_CS_DLC(msg_info->dlc);
+                size = 0U;
+            }
+            else if (0U != msg_info->edl)
+            {
+                size = (size > info->payloadSize) ? info->payloadSize : size;
+                dlc  = CAN_LengthToDlc(size);
+                cs  |= HAL_FLEXCAN_CS_EDL | HAL_FLEXCAN_CS_DLC(dlc);
+                cs  |= (0U != msg_info->brs) ? HAL_FLEXCAN_CS_BRS : 0U;
+                CAN_WritePayload(&mb[2], data, size, s_dlcLength[dlc]);
+            }
+            else
+            {
+                size = (size > CAN_CLASSIC_PAYLOAD) ? CAN_CLASSIC_PAYLOAD : size;
+                cs  |= HAL_FLEXCAN_CS_DLC(size);
+                CAN_WritePayload(&mb[2], data, size, size);
+            }
+
+            if (0U != (msg_info->id & ARM_CAN_ID_IDE_Msk))
+            {
+                cs |= HAL_FLEXCAN_CS_IDE | HAL_FLEXCAN_CS_SRR;
+            }
+            else
+            {
+                /* Standard identifier */
+            }
+
+            mb[1] = CAN_IdWord(msg_info->id);
+
+            /* Writing the code last hands the mailbox to the arbitration process. */
+            mb[0] = cs;
+
+            result = (int32_t)size;
+        }
+    }
+
+    return result;
+}
+
+static uint8_t CAN_ReadFrame(const volatile uint32_t *mb, ARM_CAN_MSG_INFO *msgInfo, uint8_t *data, uint8_t size,
+                             uint8_t payloadSize)
+{
+    uint32_t cs;
+    uint32_t id;
+    uint8_t length;
+    uint8_t i;
+
+    cs = mb[0];
+    id = mb[1];
+
+    if (0U != (cs & HAL_FLEXCAN_CS_IDE))
+    {
+        msgInfo->id = HAL_FLEXCAN_ID_EXT(id) | ARM_CAN_ID_IDE_Msk;
+    }
+    else
+    {
+        msgInfo->id = (id >> HAL_FLEXCAN_ID_STD_SHIFT) & 0x7FFUL;
+    }
+
+    msgInfo->rtr      = (0U != (cs & HAL_FLEXCAN_CS_RTR)) ? 1U : 0U;
+    msgInfo->edl      = (0U != (cs & HAL_FLEXCAN_CS_EDL)) ? 1U : 0U;
+    msgInfo->brs      = (0U != (cs & HAL_FLEXCAN_CS_BRS)) ? 1U : 0U;
+    msgInfo->esi      = (0U != (cs & HAL_FLEXCAN_CS_ESI)) ? 1U : 0U;
+    msgInfo->dlc      = (cs & HAL_FLEXCAN_CS_DLC_MASK) >> HAL_FLEXCAN_CS_DLC_SHIFT;
+    msgInfo->reserved = 0U;
+
+    if (0U != msgInfo->rtr)
+    {
+        length = 0U;
+    }
+    else if (0U != msgInfo->edl)
+    {
+        length = s_dlcLength[msgInfo->dlc];
+    }
+    else
+    {
+        /* Classic DLC 9 ... 15 still means 8 bytes */
+        length = (msgInfo->dlc > CAN_CLASSIC_PAYLOAD) ? CAN_CLASSIC_PAYLOAD : (uint8_t)msgInfo->dlc;
+    }
+
+    /* The message buffer truncates frames larger than its payload size. */
+    length = (length > payloadSize) ? payloadSize : length;
+    length = (length > size) ? size : length;
+
+    /* Straight from MB RAM into the caller buffer. */
+    for (i = 0U; i < length; i++)
+    {
+        data[i] = (uint8_t)(mb[2U + (i / 4U)] >> (24U - (8U * (i & 3U))));
+    }
+
+    return length;
+}
+
+static int32_t CAN_MessageRead(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size,
+                               CAN_Info_t *info)
+{
+    int32_t result;
+    uint8_t mbIndex;
+    uint32_t code;
+    volatile uint32_t *mb;
+
+    if (0U == (info->flags & CAN_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((obj_idx >= info->numObjects) || (NULL == msg_info) || ((NULL == data) && (0U != size)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((uint8_t)ARM_CAN_OBJ_RX != info->objConfig[obj_idx])
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (CAN_OBJ_RX_FIFO == obj_idx)
+    {
+        if (0U == (HAL_FLEXCAN_GetRawMbFlags(info->res->instance) & HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE))
+        {
+            result = ARM_CAN_NO_MESSAGE_AVAILABLE;
+        }
+        else
+        {
+            result = (int32_t)CAN_ReadFrame(HAL_FLEXCAN_GetMb(info->res->instance, 0U), msg_info, data, size,
+                                                CAN_CLASSIC_PAYLOAD);
+
+            /* Clearing the flag pops the FIFO, the interrupt re-fires if more frames wait. */
+            HAL_FLEXCAN_ClearMbFlags(info->res->instance, HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE);
+            HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, 5U, 1U);
+        }
+    }
+    else
+    {
+        mbIndex = CAN_OBJ_TO_MB(info, obj_idx);
+        mb      = HAL_FLEXCAN_GetMb(info->res->instance, mbIndex);
+
+        /* Reading CS locks the mailbox until the timer is read. */
+        code = (mb[0] & HAL_FLEXCAN_CS_CODE_MASK) >> HAL_FLEXCAN_CS_CODE_SHIFT;
+
+        if ((HAL_FLEXCAN_CODE_RX_FULL == code) || (HAL_FLEXCAN_CODE_RX_OVERRUN == code))
+        {
+            result = (int32_t)CAN_ReadFrame(mb, msg_info, data, size,
+                                            HAL_FLEXCAN_GetPayloadSize(info->res->instance));
+            CAN_ArmRxMb(obj_idx, info);
+        }
+        else
+        {
+            result = ARM_CAN_NO_MESSAGE_AVAILABLE;
+        }
+
+        HAL_FLEXCAN_ClearMbFlags(info->res->instance, 1UL << mbIndex);
+        HAL_FLEXCAN_UnlockMb(info->res->instance);
+        HAL_FLEXCAN_EnableMbInterrupt(info->res->instance, mbIndex, 1U);
+    }
+
+    return result;
+}
+
+static int32_t CAN_Control(uint32_t control, uint32_t arg, CAN_Info_t *info)
+{
+    int32_t result;
+    volatile uint32_t *mb;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & CAN_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        switch (control & ARM_CAN_CONTROL_Msk)
+        {
+            case ARM_CAN_ABORT_MESSAGE_SEND:
+                if ((CAN_OBJ_RX_FIFO == arg) || (arg >= info->numObjects) ||
+                    ((uint8_t)ARM_CAN_OBJ_TX != info->objConfig[arg]))
+                {
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+                else
+                {
+                    /* A frame already on the bus completes, otherwise the code becomes ABORT. */
+                    mb = HAL_FLEXCAN_GetMb(info->res->instance, CAN_OBJ_TO_MB(info, arg));
+                    mb[0] = (mb[0] & ~HAL_FLEXCAN_CS_CODE_MASK) | HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_TX_ABORT);
+                }
+                break;
+
+            case ARM_CAN_SET_FD_MODE:
+                if ((0U != arg) && (0U == HAL_FLEXCAN_HasFd(info->res->instance)))
+                {
+                    result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                }
+                else if (0U != info->running)
+                {
+                    /* Initialization mode only */
+                    result = ARM_DRIVER_ERROR;
+                }
+                else if (((0U != arg) ? 1U : 0U) != info->fdMode)
+                {
+                    info->fdMode = (0U != arg) ? 1U : 0U;
+                    CAN_ApplyLayout(info);
+                }
+                else
+                {
+                    /* Mode unchanged */
+                }
+                break;
+
+            case CAN_CONTROL_MB_LAYOUT:
+                result = CAN_PlanLayout(arg, info);
+                break;
+
+            case ARM_CAN_CONTROL_RETRANSMISSION:
+                /* FlexCAN always retransmits */
+                result = (0U != arg) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+
+            case ARM_CAN_SET_TRANSCEIVER_DELAY:
+                result = CAN_SetTransceiverDelay(arg, info);
+                break;
+
+            default:
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+    }
+
+    return result;
+}
+
+static void CAN_UpdateLastError(CAN_Info_t *info, uint32_t status)
+{
+    if (0U != (status & HAL_FLEXCAN_ESR_BIT_ERR))
+    {
+        info->lastError = ARM_CAN_LEC_BIT_ERROR;
+    }
+    else if (0U != (status & HAL_FLEXCAN_ESR_STUFF_ERR))
+    {
+        info->lastError = ARM_CAN_LEC_STUFF_ERROR;
+    }
+    else if (0U != (status & HAL_FLEXCAN_ESR_CRC_ERR))
+    {
+        info->lastError = ARM_CAN_LEC_CRC_ERROR;
+    }
+    else if (0U != (status & HAL_FLEXCAN_ESR_FORM_ERR))
+    {
+        info->lastError = ARM_CAN_LEC_FORM_ERROR;
+    }
+    else if (0U != (status & HAL_FLEXCAN_ESR_ACK_ERR))
+    {
+        info->lastError = ARM_CAN_LEC_ACK_ERROR;
+    }
+    else
+    {
+        /* No new error, keep the last one */
+    }
+}
+
+static ARM_CAN_STATUS CAN_GetStatus(CAN_Info_t *info)
+{
+    ARM_CAN_STATUS status;
+    uint8_t txErrors;
+    uint8_t rxErrors;
+
+    txErrors = 0U;
+    rxErrors = 0U;
+
+    if (0U != (info->flags & CAN_FLAG_POWERED))
+    {
+        CAN_UpdateLastError(info, HAL_FLEXCAN_GetErrorStatus(info->res->instance));
+        HAL_FLEXCAN_GetErrorCounters(info->res->instance, &txErrors, &rxErrors);
+    }
+    else
+    {
+        /* Powered off: counters read as zero */
+    }
+
+    status.unit_state      = info->unitState;
+    status.last_error_code = info->lastError;
+    status.tx_error_count  = txErrors;
+    status.rx_error_count  = rxErrors;
+    status.reserved        = 0U;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void CAN_SetUnitState(CAN_Info_t *info, uint8_t state)
+{
+    uint32_t event;
+
+    if (state != info->unitState)
+    {
+        info->unitState = state;
+
+        switch (state)
+        {
+            case ARM_CAN_UNIT_STATE_ACTIVE:
+                event = ARM_CAN_EVENT_UNIT_ACTIVE;
+                break;
+
+            case ARM_CAN_UNIT_STATE_PASSIVE:
+                event = ARM_CAN_EVENT_UNIT_PASSIVE;
+                break;
+
+            case ARM_CAN_UNIT_STATE_BUS_OFF:
+                event = ARM_CAN_EVENT_UNIT_BUS_OFF;
+                break;
+
+            default:
+                event = ARM_CAN_EVENT_UNIT_INACTIVE;
+                break;
+        }
+
+        if (NULL != info->cbUnitEvent)
+        {
+            info->cbUnitEvent(event);
+        }
+        else
+        {
+            /* No callback registered */
+        }
+    }
+    else
+    {
+        /* No state change */
+    }
+}
+
+static void CAN_SignalObject(const CAN_Info_t *info, uint32_t obj_idx, uint32_t event)
+{
+    if (NULL != info->cbObjectEvent)
+    {
+        info->cbObjectEvent(obj_idx, event);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void CAN_MbIRQHandler(CAN_Info_t *info)
+{
+    HAL_FLEXCAN_Instance_t instance;
+    uint32_t flags;
+    uint32_t obj;
+    uint32_t code;
+    uint32_t event;
+    uint8_t mbIndex;
+
+    instance = info->res->instance;
+    flags    = HAL_FLEXCAN_GetMbFlags(instance);
+
+    if (0U == info->fdMode)
+    {
+        if (0U != (flags & HAL_FLEXCAN_RXFIFO_FLAG_OVERFLOW))
+        {
+            HAL_FLEXCAN_ClearMbFlags(instance, HAL_FLEXCAN_RXFIFO_FLAG_OVERFLOW);
+            CAN_SignalObject(info, CAN_OBJ_RX_FIFO, ARM_CAN_EVENT_RECEIVE_OVERRUN);
+        }
+        else
+        {
+            /* No FIFO overflow */
+        }
+
+        if (0U != (flags & HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE))
+        {
+            /* Masked until MessageRead() pops the frame. */
+            HAL_FLEXCAN_EnableMbInterrupt(instance, 5U, 0U);
+            CAN_SignalObject(info, CAN_OBJ_RX_FIFO, ARM_CAN_EVENT_RECEIVE);
+        }
+        else
+        {
+            /* FIFO empty */
+        }
+    }
+    else
+    {
+        /* No RX FIFO in FD mode: IFLAG1[7:5] are message buffer flags */
+    }
+
+    for (mbIndex = info->firstMb; (mbIndex < info->mbCount) && (0U != (flags >> mbIndex)); mbIndex++)
+    {
+        if (0U != (flags & (1UL << mbIndex)))
+        {
+            obj = CAN_MB_TO_OBJ(info, mbIndex);
+
+            if ((uint8_t)ARM_CAN_OBJ_TX == info->objConfig[obj])
+            {
+                code = (HAL_FLEXCAN_GetMb(instance, mbIndex)[0] & HAL_FLEXCAN_CS_CODE_MASK) >> HAL_FLEXCAN_CS_CODE_SHIFT;
+                HAL_FLEXCAN_ClearMbFlags(instance, 1UL << mbIndex);
+
+                if (HAL_FLEXCAN_CODE_TX_ABORT != code)
+                {
+                    CAN_SignalObject(info, obj, ARM_CAN_EVENT_SEND_COMPLETE);
+                }
+                else
+                {
+                    /* Aborted: no event */
+                }
+            }
+            else
+            {
+                code = (HAL_FLEXCAN_GetMb(instance, mbIndex)[0] & HAL_FLEXCAN_CS_CODE_MASK) >> HAL_FLEXCAN_CS_CODE_SHIFT;
+                HAL_FLEXCAN_UnlockMb(instance);
+
+                /* Masked until MessageRead() empties the mailbox. */
+                HAL_FLEXCAN_EnableMbInterrupt(instance, mbIndex, 0U);
+
+                event = ARM_CAN_EVENT_RECEIVE;
+                event |= (HAL_FLEXCAN_CODE_RX_OVERRUN == code) ? ARM_CAN_EVENT_RECEIVE_OVERRUN : 0U;
+                CAN_SignalObject(info, obj, event);
+            }
+        }
+        else
+        {
+            /* Mailbox idle */
+        }
+    }
+}
+
+static void CAN_StateIRQHandler(CAN_Info_t *info)
+{
+    uint32_t status;
+    uint32_t faultConfinement;
+    uint8_t state;
+
+    status = HAL_FLEXCAN_GetErrorStatus(info->res->instance);
+    HAL_FLEXCAN_ClearErrorStatus(info->res->instance, status);
+    CAN_UpdateLastError(info, status);
+
+    faultConfinement = (status & HAL_FLEXCAN_ESR_FLTCONF_MASK) >> HAL_FLEXCAN_ESR_FLTCONF_SHIFT;
+
+    if ((0U != (status & HAL_FLEXCAN_ESR_BOFF_INT)) || (faultConfinement >= 2U))
+    {
+        state = ARM_CAN_UNIT_STATE_BUS_OFF;
+    }
+    else if (1U == faultConfinement)
+    {
+        state = ARM_CAN_UNIT_STATE_PASSIVE;
+    }
+    else
+    {
+        state = ARM_CAN_UNIT_STATE_ACTIVE;
+    }
+
+    if ((state == info->unitState) && (ARM_CAN_UNIT_STATE_ACTIVE == state) &&
+        (0U != (status & (HAL_FLEXCAN_ESR_TX_WARN_INT | HAL_FLEXCAN_ESR_RX_WARN_INT))) &&
+        (NULL != info->cbUnitEvent))
+    {
+        info->cbUnitEvent(ARM_CAN_EVENT_UNIT_WARNING);
+    }
+    else
+    {
+        CAN_SetUnitState(info, state);
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define CAN_INSTANCE(n)                                                                         \
+static ARM_CAN_CAPABILITIES CAN##n##_GetCapabilities(void)                                      \
+{ return CAN_GetCapabilities(&s_can##n##Res, &s_can##n##Info); }                                \
+static int32_t CAN##n##_Initialize(ARM_CAN_SignalUnitEvent_t cb_unit_event,                     \
+                                   ARM_CAN_SignalObjectEvent_t cb_object_event)                 \
+{ return CAN_Initialize(cb_unit_event, cb_object_event, &s_can##n##Res, &s_can##n##Info); }     \
+static int32_t CAN##n##_Uninitialize(void)                                                      \
+{ return CAN_Uninitialize(&s_can##n##Res, &s_can##n##Info); }                                   \
+static int32_t CAN##n##_PowerControl(ARM_POWER_STATE state)                                     \
+{ return CAN_PowerControl(state, &s_can##n##Res, &s_can##n##Info); }                            \
+static int32_t CAN##n##_SetBitrate(ARM_CAN_BITRATE_SELECT select, uint32_t bitrate,             \
+                                   uint32_t bit_segments)                                       \
+{ return CAN_SetBitrate(select, bitrate, bit_segments, &s_can##n##Info); }                      \
+static int32_t CAN##n##_SetMode(ARM_CAN_MODE mode)                                              \
+{ return CAN_SetMode(mode, &s_can##n##Info); }                                                  \
+static ARM_CAN_OBJ_CAPABILITIES CAN##n##_ObjectGetCapabilities(uint32_t obj_idx)                \
+{ return CAN_ObjectGetCapabilities(obj_idx, &s_can##n##Info); }                                 \
+static int32_t CAN##n##_ObjectSetFilter(uint32_t obj_idx, ARM_CAN_FILTER_OPERATION operation,   \
+                                        uint32_t id, uint32_t arg)                              \
+{ return CAN_ObjectSetFilter(obj_idx, operation, id, arg, &s_can##n##Info); }                   \
+static int32_t CAN##n##_ObjectConfigure(uint32_t obj_idx, ARM_CAN_OBJ_CONFIG obj_cfg)           \
+{ return CAN_ObjectConfigure(obj_idx, obj_cfg, &s_can##n##Info); }                              \
+static int32_t CAN##n##_MessageSend(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info,               \
+                                    const uint8_t *data, uint8_t size)                          \
+{ return CAN_MessageSend(obj_idx, msg_info, data, size, &s_can##n##Info); }                     \
+static int32_t CAN##n##_MessageRead(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info,               \
+                                    uint8_t *data, uint8_t size)                                \
+{ return CAN_MessageRead(obj_idx, msg_info, data, size, &s_can##n##Info); }                     \
+static int32_t CAN##n##_Control(uint32_t control, uint32_t arg)                                 \
+{ return CAN_Control(control, arg, &s_can##n##Info); }                                          \
+static ARM_CAN_STATUS CAN##n##_GetStatus(void)                                                  \
+{ return CAN_GetStatus(&s_can##n##Info); }                                                      \
+void CAN##n##_ORed_0_15_MB_IRQHandler(void)                                                     \
+{ CAN_MbIRQHandler(&s_can##n##Info); }                                                          \
+void CAN##n##_ORed_IRQHandler(void)                                                             \
+{ CAN_StateIRQHandler(&s_can##n##Info); }                                                       \
+ARM_DRIVER_CAN Driver_CAN##n =                                                                  \
+{                                                                                               \
+    CAN_GetVersion,                                                                             \
+    CAN##n##_GetCapabilities,                                                                   \
+    CAN##n##_Initialize,                                                                        \
+    CAN##n##_Uninitialize,                                                                      \
+    CAN##n##_PowerControl,                                                                      \
+    CAN_GetClock,                                                                               \
+    CAN##n##_SetBitrate,                                                                        \
+    CAN##n##_SetMode,                                                                           \
+    CAN##n##_ObjectGetCapabilities,                                                             \
+    CAN##n##_ObjectSetFilter,                                                                   \
+    CAN##n##_ObjectConfigure,                                                                   \
+    CAN##n##_MessageSend,                                                                       \
+    CAN##n##_MessageRead,                                                                       \
+    CAN##n##_Control,                                                                           \
+    CAN##n##_GetStatus                                                                          \
+};
+
+CAN_INSTANCE(0)
+CAN_INSTANCE(1)
+CAN_INSTANCE(2)
+
+/* FlexCAN0 has 32 mailboxes, MB16..31 are on a second vector. */
+void CAN0_ORed_16_31_MB_IRQHandler(void)
+{
+    CAN_MbIRQHandler(&s_can0Info);
+}
@@ -0,0 +1,544 @@
+/*******************************************************************************
+ * @file    Driver_Flash.c
+ * @brief   CMSIS Flash driver for the S32K144 FTFC C file.
+ *
+ * ProgramData / EraseSector / EraseChip only start the operation: each
+ * phrase or sector is one FTFC command, the command complete interrupt
+ * (CCIF) launches the next one and signals ARM_FLASH_EVENT_READY after the
+ * last. Commands are launched from RAM. A D-Flash command runs in the
+ * background; a P-Flash command waits for CCIF in RAM with interrupts
+ * disabled, as the P-Flash block cannot be read meanwhile.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "Driver_Flash_S32K144.h"
+#include "HAL_FTFC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_FLASH_DRV_VERSION       ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define FLASH_ERASED_VALUE          (0xFFU)
+
+/* Driver state flags */
+#define FLASH_FLAG_INITIALIZED      (1U << 0)
+#define FLASH_FLAG_POWERED          (1U << 1)
+
+/* Operation in progress */
+#define FLASH_OP_PROGRAM            (0U)
+#define FLASH_OP_ERASE              (1U)
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    uint32_t                base;
+    uint32_t                sectorSize;
+    uint8_t                 flexNvm;        /**< 0 = P-Flash: code runs from it, wait in RAM;
+                                                 1 = FlexNVM: size set by the partition    */
+    struct _ARM_FLASH_INFO  *flashInfo;
+} FLASH_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const FLASH_Resources_t     *res;
+    ARM_Flash_SignalEvent_t     cbEvent;
+    volatile ARM_FLASH_STATUS   status;
+    uint8_t                     flags;
+    uint32_t                    size;           /**< Block size in bytes */
+
+    uint8_t                     operation;      /**< FLASH_OP_xxx */
+    uint8_t                     command;        /**< HAL_FTFC_CMD_xxx of every step */
+    uint32_t                    address;        /**< Address of the next command */
+    const uint8_t               *data;
+    uint32_t                    remaining;      /**< Bytes left to program */
+} FLASH_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION FLASH_GetVersion(void);
+static ARM_FLASH_CAPABILITIES FLASH_GetCapabilities(const FLASH_Resources_t *res);
+
+static int32_t FLASH_Initialize(ARM_Flash_SignalEvent_t cb_event, const FLASH_Resources_t *res, FLASH_Info_t *info);
+static int32_t FLASH_Uninitialize(FLASH_Info_t *info);
+static int32_t FLASH_PowerControl(ARM_POWER_STATE state, FLASH_Info_t *info);
+static int32_t FLASH_ReadData(uint32_t addr, void *data, uint32_t cnt, const FLASH_Info_t *info);
+static int32_t FLASH_ProgramData(uint32_t addr, const void *data, uint32_t cnt, FLASH_Info_t *info);
+static int32_t FLASH_EraseSector(uint32_t addr, FLASH_Info_t *info);
+static int32_t FLASH_EraseChip(const FLASH_Resources_t *res, FLASH_Info_t *info);
+static ARM_FLASH_STATUS FLASH_GetStatus(const FLASH_Info_t *info);
+
+static uint8_t FLASH_InRange(const FLASH_Info_t *info, uint32_t addr, uint32_t cnt);
+static int32_t FLASH_Start(FLASH_Info_t *info);
+static void    FLASH_Launch(FLASH_Info_t *info);
+static void    FLASH_Finish(FLASH_Info_t *info, uint8_t errors);
+static void    FLASH_CommandDone(void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_FLASH_API_VERSION,
+    ARM_FLASH_DRV_VERSION
+};
+
+static struct _ARM_FLASH_INFO s_pflashInfo =
+{
+    NULL,                                                   /* Uniform sectors */
+    HAL_FTFC_PFLASH_SIZE / HAL_FTFC_PFLASH_SECTOR,
+    HAL_FTFC_PFLASH_SECTOR,
+    HAL_FTFC_PHRASE_SIZE,
+    HAL_FTFC_PHRASE_SIZE,
+    FLASH_ERASED_VALUE,
+    { 0U, 0U, 0U }
+};
+
+/* Sector count follows the FlexNVM partition, set by Initialize(). */
+static struct _ARM_FLASH_INFO s_dflashInfo =
+{
+    NULL,
+    0U,
+    HAL_FTFC_DFLASH_SECTOR,
+    HAL_FTFC_PHRASE_SIZE,
+    HAL_FTFC_PHRASE_SIZE,
+    FLASH_ERASED_VALUE,
+    { 0U, 0U, 0U }
+};
+
+/* Flash0: P-Flash, the application runs from it. */
+static const FLASH_Resources_t s_flash0Res =
+{
+    HAL_FTFC_PFLASH_BASE, HAL_FTFC_PFLASH_SECTOR, 0U, &s_pflashInfo
+};
+
+/* Flash1: FlexNVM D-Flash, read-while-write with the P-Flash. */
+static const FLASH_Resources_t s_flash1Res =
+{
+    HAL_FTFC_DFLASH_BASE, HAL_FTFC_DFLASH_SECTOR, 1U, &s_dflashInfo
+};
+
+static FLASH_Info_t s_flash0Info;
+static FLASH_Info_t s_flash1Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION FLASH_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_FLASH_CAPABILITIES FLASH_GetCapabilities(const FLASH_Resources_t *res)
+{
+    ARM_FLASH_CAPABILITIES capabilities;
+
+    capabilities.event_ready = 1U;
+    capabilities.data_width  = 0U;      /* 8-bit */
+    capabilities.erase_chip  = res->flexNvm;
+    capabilities.reserved    = 0U;
+
+    return capabilities;
+}
+
+static int32_t FLASH_Initialize(ARM_Flash_SignalEvent_t cb_event, const FLASH_Resources_t *res, FLASH_Info_t *info)
+{
+    if (0U == (info->flags & FLASH_FLAG_INITIALIZED))
+    {
+        HAL_FTFC_Init();
+
+        /* Part of the FlexNVM may back the emulated EEPROM instead. */
+        info->size = (0U != res->flexNvm) ? HAL_FTFC_GetDFlashSize() : HAL_FTFC_PFLASH_SIZE;
+        res->flashInfo->sector_count = info->size / res->sectorSize;
+
+        info->res     = res;
+        info->cbEvent = cb_event;
+        info->flags   = FLASH_FLAG_INITIALIZED;
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t FLASH_Uninitialize(FLASH_Info_t *info)
+{
+    (void)FLASH_PowerControl(ARM_POWER_OFF, info);
+
+    info->flags   = 0U;
+    info->cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t FLASH_PowerControl(ARM_POWER_STATE state, FLASH_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != info->status.busy)
+            {
+                /* A flash command cannot be aborted */
+                result = ARM_DRIVER_ERROR_BUSY;
+            }
+            else
+            {
+                info->flags &= (uint8_t)~FLASH_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & FLASH_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & FLASH_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                info->status.busy  = 0U;
+                info->status.error = 0U;
+                info->flags       |= FLASH_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+static uint8_t FLASH_InRange(const FLASH_Info_t *info, uint32_t addr, uint32_t cnt)
+{
+    return ((addr >= info->res->base) && ((addr - info->res->base) <= info->size) &&
+            (cnt <= (info->size - (addr - info->res->base)))) ? 1U : 0U;
+}
+
+static int32_t FLASH_ReadData(uint32_t addr, void *data, uint32_t cnt, const FLASH_Info_t *info)
+{
+    int32_t result;
+    const volatile uint8_t *src;
+    uint8_t *dst;
+    uint32_t i;
+
+    if (0U == (info->flags & FLASH_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((NULL == data) || (0U == FLASH_InRange(info, addr, cnt)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U != info->status.busy)
+    {
+        /* Reading a block under modification is a read collision */
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        /* Memory mapped */
+        src = (const volatile uint8_t *)addr;
+        dst = (uint8_t *)data;
+
+        for (i = 0U; i < cnt; i++)
+        {
+            dst[i] = src[i];
+        }
+
+        result = (int32_t)cnt;
+    }
+
+    return result;
+}
+
+static int32_t FLASH_Start(FLASH_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == HAL_FTFC_Acquire(FLASH_CommandDone, (void *)info))
+    {
+        /* Other block or the EEPROM emulation busy */
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.busy  = 1U;
+        info->status.error = 0U;
+
+        FLASH_Launch(info);
+    }
+
+    return result;
+}
+
+static int32_t FLASH_ProgramData(uint32_t addr, const void *data, uint32_t cnt, FLASH_Info_t *info)
+{
+    int32_t result;
+
+    if (0U == (info->flags & FLASH_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((NULL == data) || (0U == FLASH_InRange(info, addr, cnt)) ||
+             (0U != (addr % HAL_FTFC_PHRASE_SIZE)) || (0U != (cnt % HAL_FTFC_PHRASE_SIZE)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U != info->status.busy)
+    {
+        /* The running operation keeps its state */
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if (0U == cnt)
+    {
+        result = 0;
+    }
+    else
+    {
+        info->operation = FLASH_OP_PROGRAM;
+        info->command   = HAL_FTFC_CMD_PROGRAM_PHRASE;
+        info->address   = addr;
+        info->data      = (const uint8_t *)data;
+        info->remaining = cnt;
+
+        result = FLASH_Start(info);
+    }
+
+    return result;
+}
+
+static int32_t FLASH_EraseSector(uint32_t addr, FLASH_Info_t *info)
+{
+    int32_t result;
+
+    if (0U == (info->flags & FLASH_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((0U == FLASH_InRange(info, addr, 1U)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U != info->status.busy)
+    {
+        /* The running operation keeps its state */
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->operation = FLASH_OP_ERASE;
+        info->command   = HAL_FTFC_CMD_ERASE_SECTOR;
+        info->address   = addr - ((addr - info->res->base) % info->res->sectorSize);
+        info->remaining = 0U;
+
+        result = FLASH_Start(info);
+    }
+
+    return result;
+}
+
+static int32_t FLASH_EraseChip(const FLASH_Resources_t *res, FLASH_Info_t *info)
+{
+    int32_t result;
+
+    if (0U == res->flexNvm)
+    {
+        /* Would erase the running application */
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if (0U == (info->flags & FLASH_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.busy)
+    {
+        /* The running operation keeps its state */
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->operation = FLASH_OP_ERASE;
+        info->command   = HAL_FTFC_CMD_ERASE_BLOCK;
+        info->address   = res->base;
+        info->remaining = 0U;
+
+        result = FLASH_Start(info);
+    }
+
+    return result;
+}
+
+static ARM_FLASH_STATUS FLASH_GetStatus(const FLASH_Info_t *info)
+{
+    ARM_FLASH_STATUS status;
+
+    status.busy     = info->status.busy;
+    status.error    = info->status.error;
+    status.reserved = 0U;
+
+    return status;
+}
+
+static void FLASH_Launch(FLASH_Info_t *info)
+{
+    HAL_FTFC_ClearErrors();
+    HAL_FTFC_SetCommand(info->command, info->address);
+
+    if (FLASH_OP_PROGRAM == info->operation)
+    {
+        HAL_FTFC_SetPhrase(info->data);
+    }
+    else
+    {
+        /* Erase: address only */
+    }
+
+    if (0U == info->res->flexNvm)
+    {
+        /* Nothing may be fetched from P-Flash until CCIF is set again. */
+        DISABLE_INTERRUPTS();
+        HAL_FTFC_Launch(1U);
+        ENABLE_INTERRUPTS();
+    }
+    else
+    {
+        HAL_FTFC_Launch(0U);
+    }
+
+    /* Completion, or the next step, is handled by the interrupt. */
+    HAL_FTFC_EnableCompleteInterrupt(1U);
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FLASH_Finish(FLASH_Info_t *info, uint8_t errors)
+{
+    uint32_t event;
+
+    HAL_FTFC_Release();
+    HAL_FTFC_InvalidateCache();
+
+    info->status.error = (0U != errors) ? 1U : 0U;
+    info->status.busy  = 0U;
+
+    event  = ARM_FLASH_EVENT_READY;
+    event |= (0U != errors) ? ARM_FLASH_EVENT_ERROR : 0U;
+
+    if (NULL != info->cbEvent)
+    {
+        info->cbEvent(event);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void FLASH_CommandDone(void *param)
+{
+    FLASH_Info_t *info;
+    uint8_t errors;
+
+    info = (FLASH_Info_t *)param;
+
+    if (0U == HAL_FTFC_IsReady())
+    {
+        /* Command still running */
+    }
+    else
+    {
+        errors = HAL_FTFC_GetErrors();
+
+        if ((FLASH_OP_PROGRAM == info->operation) && (0U == errors))
+        {
+            info->address   += HAL_FTFC_PHRASE_SIZE;
+            info->data      += HAL_FTFC_PHRASE_SIZE;
+            info->remaining -= HAL_FTFC_PHRASE_SIZE;
+        }
+        else
+        {
+            /* Erase is a single command, errors end the operation */
+            info->remaining = 0U;
+        }
+
+        if (0U != info->remaining)
+        {
+            FLASH_Launch(info);
+        }
+        else
+        {
+            FLASH_Finish(info, errors);
+        }
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define FLASH_INSTANCE(n)                                                                       \
+static ARM_FLASH_CAPABILITIES FLASH##n##_GetCapabilities(void)                                  \
+{ return FLASH_GetCapabilities(&s_flash##n##Res); }                                             \
+static int32_t FLASH##n##_Initialize(ARM_Flash_SignalEvent_t cb_event)                          \
+{ return FLASH_Initialize(cb_event, &s_flash##n##Res, &s_flash##n##Info); }                     \
+static int32_t FLASH##n##_Uninitialize(void)                                                    \
+{ return FLASH_Uninitialize(&s_flash##n##Info); }                                               \
+static int32_t FLASH##n##_PowerControl(ARM_POWER_STATE state)                                   \
+{ return FLASH_PowerControl(state, &s_flash##n##Info); }                                        \
+static int32_t FLASH##n##_ReadData(uint32_t addr, void *data, uint32_t cnt)                     \
+{ return FLASH_ReadData(addr, data, cnt, &s_flash##n##Info); }                                  \
+static int32_t FLASH##n##_ProgramData(uint32_t addr, const void *data, uint32_t cnt)            \
+{ return FLASH_ProgramData(addr, data, cnt, &s_flash##n##Info); }                               \
+static int32_t FLASH##n##_EraseSector(uint32_t addr)                                            \
+{ return FLASH_EraseSector(addr, &s_flash##n##Info); }                                          \
+static int32_t FLASH##n##_EraseChip(void)                                                       \
+{ return FLASH_EraseChip(&s_flash##n##Res, &s_flash##n##Info); }                                \
+static ARM_FLASH_STATUS FLASH##n##_GetStatus(void)                                              \
+{ return FLASH_GetStatus(&s_flash##n##Info); }                                                  \
+static ARM_FLASH_INFO *FLASH##n##_GetInfo(void)                                                 \
+{ return (ARM_FLASH_INFO *)s_flash##n##Res.flashInfo; }                                                           \
+ARM_DRIVER_FLASH Driver_Flash##n =                                                              \
+{                                                                                               \
+    FLASH_GetVersion,                                                                           \
+    FLASH##n##_GetCapabilities,                                                                 \
+    FLASH##n##_Initialize,                                                                      \
+    FLASH##n##_Uninitialize,                                                                    \
+    FLASH##n##_PowerControl,                                                                    \
+    FLASH##n##_ReadData,                                                                        \
+    FLASH##n##_ProgramData,                                                                     \
+    FLASH##n##_EraseSector,                                                                     \
+    FLASH##n##_EraseChip,                                                                       \
+    FLASH##n##_GetStatus,                                                                       \
+    FLASH##n##_GetInfo                                                                          \
+};
+
+FLASH_INSTANCE(0)
+FLASH_INSTANCE(1)
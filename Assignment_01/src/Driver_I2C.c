@@ -0,0 +1,818 @@
+/*******************************************************************************
+ * @file    Driver_I2C.c
+ * @brief   CMSIS I2C driver (master) for the S32K144 LPI2C C file.
+ *
+ * A transaction is turned into LPI2C master commands (START + address,
+ * transmit / receive-N, STOP) which are pushed into the MTDR command FIFO
+ * ahead of the bus. A receive of up to 256 bytes is only three command
+ * words, so a complete register read is queued up front; the interrupt
+ * runs at the FIFO watermarks only, and long reads drain MRDR by eDMA.
+ * xfer_pending leaves the bus owned: the next transfer starts with a
+ * repeated START.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "Driver_I2C_S32K144.h"
+#include "HAL_LPI2C.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_I2C_DRV_VERSION         ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define I2C_DMA_MAX_COUNT           (32767UL)   /**< CITER is 15 bits wide */
+#define I2C_DEFAULT_DMA_THRESHOLD   (8UL)
+#define I2C_DEFAULT_BUS_SPEED       (100000UL)
+#define I2C_IRQ_PRIORITY            (4U)
+
+/* Driver state flags */
+#define I2C_FLAG_INITIALIZED        (1U << 0)
+#define I2C_FLAG_POWERED            (1U << 1)
+
+/* Command generator phases */
+#define I2C_PHASE_START             (0U)
+#define I2C_PHASE_DATA              (1U)
+#define I2C_PHASE_STOP              (2U)
+#define I2C_PHASE_DONE              (3U)
+
+#define I2C_EVENT_FAILED            (ARM_I2C_EVENT_TRANSFER_DONE | ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    HAL_LPI2C_Instance_t    instance;
+    IRQn_Type               irq;
+    dma_request_source_t    rxRequest;
+    uint8_t                 port;           /**< Port of SDA / SCL */
+    uint8_t                 sdaPin;
+    uint8_t                 sclPin;
+    uint8_t                 pinMux;
+} I2C_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const I2C_Resources_t   *res;
+    ARM_I2C_SignalEvent_t   cbEvent;
+    volatile ARM_I2C_STATUS status;
+    uint8_t                 flags;
+    uint8_t                 rxChannel;
+    uint8_t                 fifoSize;
+    uint32_t                dmaThreshold;
+
+    uint8_t                 phase;          /**< I2C_PHASE_xxx of the command generator */
+    uint8_t                 addrByte;       /**< Address byte incl. R/W bit */
+    uint8_t                 pending;        /**< xfer_pending: no STOP at the end */
+    uint8_t                 stopSeen;       /**< STOP detected since the STOP command */
+    uint8_t                 useDma;
+    const uint8_t           *txData;
+    uint8_t                 *rxData;
+    uint32_t                num;
+    uint32_t                cmdCount;       /**< Data bytes queued (TX) or requested (RX) */
+    volatile uint32_t       rxCount;
+    uint32_t                count;          /**< Result of the last transfer */
+    uint16_t                chunk;
+} I2C_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION I2C_GetVersion(void);
+static ARM_I2C_CAPABILITIES I2C_GetCapabilities(void);
+
+static int32_t I2C_Initialize(ARM_I2C_SignalEvent_t cb_event, const I2C_Resources_t *res, I2C_Info_t *info);
+static int32_t I2C_Uninitialize(const I2C_Resources_t *res, I2C_Info_t *info);
+static int32_t I2C_PowerControl(ARM_POWER_STATE state, const I2C_Resources_t *res, I2C_Info_t *info);
+static int32_t I2C_MasterStart(uint32_t addr, const uint8_t *txData, uint8_t *rxData, uint32_t num,
+                               bool xfer_pending, I2C_Info_t *info);
+static int32_t I2C_GetDataCount(const I2C_Info_t *info);
+static int32_t I2C_Control(uint32_t control, uint32_t arg, const I2C_Resources_t *res, I2C_Info_t *info);
+static ARM_I2C_STATUS I2C_GetStatus(const I2C_Info_t *info);
+
+static void I2C_FillCommands(I2C_Info_t *info);
+static void I2C_DrainRx(I2C_Info_t *info);
+static void I2C_StartDmaChunk(I2C_Info_t *info);
+static void I2C_UpdateInterrupts(I2C_Info_t *info);
+static void I2C_CheckDone(I2C_Info_t *info);
+static void I2C_Stop(I2C_Info_t *info);
+static void I2C_Signal(I2C_Info_t *info, uint32_t event);
+static void I2C_RxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void I2C_IRQHandler(I2C_Info_t *info);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_I2C_API_VERSION,
+    ARM_I2C_DRV_VERSION
+};
+
+static const ARM_I2C_CAPABILITIES s_driverCapabilities =
+{
+    0, /* Supports 10-bit addressing */
+    0  /* Reserved (must be zero) */
+};
+
+/* LPI2C0: SDA PTA2, SCL PTA3 (ALT3). */
+static const I2C_Resources_t s_i2c0Res =
+{
+    HAL_LPI2C_0, LPI2C0_Master_IRQn, EDMA_REQ_LPI2C0_RX,
+    HAL_GPIO_PORT_A, 2U, 3U, 3U
+};
+
+static I2C_Info_t s_i2c0Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION I2C_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_I2C_CAPABILITIES I2C_GetCapabilities(void)
+{
+    return s_driverCapabilities;
+}
+
+static int32_t I2C_Initialize(ARM_I2C_SignalEvent_t cb_event, const I2C_Resources_t *res, I2C_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & I2C_FLAG_INITIALIZED))
+    {
+        HAL_DMA_Init();
+
+        info->rxChannel = HAL_DMA_AllocChannel();
+
+        if (HAL_DMA_CHANNEL_INVALID == info->rxChannel)
+        {
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            HAL_GPIO_SetPinMux(res->port, res->sdaPin, res->pinMux);
+            HAL_GPIO_SetPinMux(res->port, res->sclPin, res->pinMux);
+
+            info->res          = res;
+            info->cbEvent      = cb_event;
+            info->dmaThreshold = I2C_DEFAULT_DMA_THRESHOLD;
+            info->flags        = I2C_FLAG_INITIALIZED;
+        }
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return result;
+}
+
+static int32_t I2C_Uninitialize(const I2C_Resources_t *res, I2C_Info_t *info)
+{
+    (void)I2C_PowerControl(ARM_POWER_OFF, res, info);
+
+    if (0U != (info->flags & I2C_FLAG_INITIALIZED))
+    {
+        HAL_DMA_FreeChannel(info->rxChannel);
+    }
+    else
+    {
+        /* Not initialized, do nothing */
+    }
+
+    info->flags   = 0U;
+    info->cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t I2C_PowerControl(ARM_POWER_STATE state, const I2C_Resources_t *res, I2C_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != (info->flags & I2C_FLAG_POWERED))
+            {
+                HAL_NVIC_DisableIRQ(res->irq);
+                HAL_DMA_DisableRequest(info->rxChannel);
+                HAL_LPI2C_Deinit(res->instance);
+            }
+            else
+            {
+                /* Already off */
+            }
+
+            info->status.busy = 0U;
+            info->flags &= (uint8_t)~I2C_FLAG_POWERED;
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & I2C_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & I2C_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                HAL_LPI2C_Init(res->instance);
+                info->fifoSize = HAL_LPI2C_GetFifoSize(res->instance);
+                (void)HAL_LPI2C_SetBusSpeed(res->instance, I2C_DEFAULT_BUS_SPEED);
+                HAL_LPI2C_Enable(res->instance, 1U);
+
+                HAL_DMA_SetRequestSource(info->rxChannel, res->rxRequest);
+                HAL_DMA_RegisterCallback(info->rxChannel, I2C_RxDmaCallback, (void *)info);
+
+                info->status.busy             = 0U;
+                info->status.mode             = 1U;
+                info->status.arbitration_lost = 0U;
+                info->status.bus_error        = 0U;
+
+                HAL_NVIC_SetPriority(res->irq, I2C_IRQ_PRIORITY);
+                HAL_NVIC_ClearPendingIRQ(res->irq);
+                HAL_NVIC_EnableIRQ(res->irq);
+
+                info->flags |= I2C_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+static void I2C_FillCommands(I2C_Info_t *info)
+{
+    HAL_LPI2C_Instance_t instance;
+    uint32_t length;
+
+    instance = info->res->instance;
+
+    while ((I2C_PHASE_DONE != info->phase) && (HAL_LPI2C_GetTxFifoCount(instance) < info->fifoSize))
+    {
+        switch (info->phase)
+        {
+            case I2C_PHASE_START:
+                HAL_LPI2C_WriteCommand(instance, HAL_LPI2C_CMD_START, info->addrByte);
+                info->phase = I2C_PHASE_DATA;
+                break;
+
+            case I2C_PHASE_DATA:
+                if (NULL != info->rxData)
+                {
+                    /* One command word receives up to 256 bytes. */
+                    length = info->num - info->cmdCount;
+                    length = (length > HAL_LPI2C_RECEIVE_MAX) ? HAL_LPI2C_RECEIVE_MAX : length;
+                    HAL_LPI2C_WriteCommand(instance, HAL_LPI2C_CMD_RECEIVE, (uint8_t)(length - 1UL));
+                    info->cmdCount += length;
+                }
+                else
+                {
+                    HAL_LPI2C_WriteCommand(instance, HAL_LPI2C_CMD_TRANSMIT, info->txData[info->cmdCount]);
+                    info->cmdCount++;
+                }
+
+                if (info->cmdCount >= info->num)
+                {
+                    info->phase = I2C_PHASE_STOP;
+                }
+                else
+                {
+                    /* More data to queue */
+                }
+                break;
+
+            default:
+                if (0U == info->pending)
+                {
+                    HAL_LPI2C_WriteCommand(instance, HAL_LPI2C_CMD_STOP, 0U);
+                }
+                else
+                {
+                    /* Keep the bus, next transfer starts with a repeated START */
+                }
+                info->phase = I2C_PHASE_DONE;
+                break;
+        }
+    }
+}
+
+static void I2C_DrainRx(I2C_Info_t *info)
+{
+    while ((info->rxCount < info->num) && (0U != HAL_LPI2C_GetRxFifoCount(info->res->instance)))
+    {
+        info->rxData[info->rxCount] = HAL_LPI2C_ReadData(info->res->instance);
+        info->rxCount++;
+    }
+}
+
+static void I2C_StartDmaChunk(I2C_Info_t *info)
+{
+    HAL_DMA_Transfer_t transfer;
+    uint32_t remaining;
+
+    remaining   = info->num - info->rxCount;
+    info->chunk = (uint16_t)((remaining > I2C_DMA_MAX_COUNT) ? I2C_DMA_MAX_COUNT : remaining);
+
+    transfer.srcAddr    = HAL_LPI2C_GetRxDataAddress(info->res->instance);
+    transfer.dstAddr    = (uint32_t)&info->rxData[info->rxCount];
+    transfer.srcOffset  = 0;
+    transfer.dstOffset  = 1;
+    transfer.srcSize    = HAL_DMA_SIZE_8BIT;
+    transfer.dstSize    = HAL_DMA_SIZE_8BIT;
+    transfer.minorBytes = 1U;
+    transfer.majorCount = info->chunk;
+    transfer.srcLastAdj = 0;
+    transfer.dstLastAdj = 0;
+    transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+
+    HAL_DMA_ConfigTransfer(info->rxChannel, &transfer);
+    HAL_DMA_EnableRequest(info->rxChannel);
+}
+
+static void I2C_UpdateInterrupts(I2C_Info_t *info)
+{
+    HAL_LPI2C_Instance_t instance;
+    uint32_t mask;
+    uint32_t remaining;
+    uint8_t txWater;
+    uint8_t rxWater;
+
+    instance = info->res->instance;
+    mask     = HAL_LPI2C_STATUS_STOP | HAL_LPI2C_STATUS_ERRORS;
+    txWater  = (uint8_t)(info->fifoSize / 2U);
+    rxWater  = 0U;
+
+    if (I2C_PHASE_DONE != info->phase)
+    {
+        /* Refill the command FIFO once it is half empty. */
+        mask |= HAL_LPI2C_STATUS_TX;
+    }
+    else if ((NULL != info->txData) && (0U != info->pending))
+    {
+        /* No STOP to wait for: done when the last byte left the FIFO. */
+        mask   |= HAL_LPI2C_STATUS_TX;
+        txWater = 0U;
+    }
+    else
+    {
+        /* Wait for STOP or received data only */
+    }
+
+    if ((NULL != info->rxData) && (0U == info->useDma) && (info->rxCount < info->num))
+    {
+        mask     |= HAL_LPI2C_STATUS_RX;
+        remaining = info->num - info->rxCount;
+        rxWater   = (uint8_t)(((remaining < (info->fifoSize / 2U)) ? remaining : (info->fifoSize / 2U)) - 1UL);
+    }
+    else
+    {
+        /* DMA or transmit: no RX interrupt */
+    }
+
+    HAL_LPI2C_SetWatermarks(instance, txWater, rxWater);
+    HAL_LPI2C_SetInterrupts(instance, mask);
+}
+
+static void I2C_CheckDone(I2C_Info_t *info)
+{
+    uint8_t done;
+
+    done = (I2C_PHASE_DONE == info->phase) ? 1U : 0U;
+
+    if ((NULL != info->rxData) && (info->rxCount < info->num))
+    {
+        done = 0U;
+    }
+    else if (0U == info->pending)
+    {
+        done &= info->stopSeen;
+    }
+    else if (NULL != info->txData)
+    {
+        done &= (0U == HAL_LPI2C_GetTxFifoCount(info->res->instance)) ? 1U : 0U;
+    }
+    else
+    {
+        /* Pending receive: done once all bytes arrived */
+    }
+
+    if ((0U != done) && (0U != info->status.busy))
+    {
+        HAL_LPI2C_SetInterrupts(info->res->instance, 0U);
+        HAL_LPI2C_EnableRxDma(info->res->instance, 0U);
+        info->count       = info->num;
+        info->status.busy = 0U;
+        I2C_Signal(info, ARM_I2C_EVENT_TRANSFER_DONE);
+    }
+    else
+    {
+        I2C_UpdateInterrupts(info);
+    }
+}
+
+static int32_t I2C_MasterStart(uint32_t addr, const uint8_t *txData, uint8_t *rxData, uint32_t num,
+                               bool xfer_pending, I2C_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((0U == num) || ((NULL == txData) && (NULL == rxData)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U != (addr & ARM_I2C_ADDRESS_10BIT))
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if (0U == (info->flags & I2C_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.busy             = 1U;
+        info->status.direction        = (NULL != rxData) ? 1U : 0U;
+        info->status.arbitration_lost = 0U;
+        info->status.bus_error        = 0U;
+
+        info->addrByte = (uint8_t)(((addr & 0x7FUL) << 1U) | ((NULL != rxData) ? 1UL : 0UL));
+        info->pending  = xfer_pending ? 1U : 0U;
+        info->phase    = I2C_PHASE_START;
+        info->stopSeen = 0U;
+        info->txData   = txData;
+        info->rxData   = rxData;
+        info->num      = num;
+        info->cmdCount = 0U;
+        info->rxCount  = 0U;
+        info->count    = 0U;
+        info->useDma   = ((NULL != rxData) && (0U != info->dmaThreshold) && (num >= info->dmaThreshold)) ? 1U : 0U;
+
+        HAL_LPI2C_ClearStatus(info->res->instance, HAL_LPI2C_STATUS_STOP | HAL_LPI2C_STATUS_ERRORS);
+
+        if (0U != info->useDma)
+        {
+            I2C_StartDmaChunk(info);
+            HAL_LPI2C_EnableRxDma(info->res->instance, 1U);
+        }
+        else
+        {
+            /* Received bytes are drained by the RX watermark interrupt */
+        }
+
+        /* Queue the whole transaction the FIFO can hold, the interrupt refills the rest. */
+        DISABLE_INTERRUPTS();
+        I2C_FillCommands(info);
+        I2C_UpdateInterrupts(info);
+        ENABLE_INTERRUPTS();
+    }
+
+    return result;
+}
+
+static void I2C_Stop(I2C_Info_t *info)
+{
+    HAL_LPI2C_Instance_t instance;
+
+    instance = info->res->instance;
+
+    HAL_LPI2C_SetInterrupts(instance, 0U);
+    HAL_LPI2C_EnableRxDma(instance, 0U);
+    HAL_DMA_DisableRequest(info->rxChannel);
+
+    info->count = (uint32_t)I2C_GetDataCount(info);
+
+    HAL_LPI2C_FlushFifo(instance);
+    HAL_LPI2C_ClearStatus(instance, HAL_LPI2C_STATUS_STOP | HAL_LPI2C_STATUS_ERRORS);
+
+    if (0U != (HAL_LPI2C_GetStatus(instance) & HAL_LPI2C_STATUS_BUSY))
+    {
+        /* Release the bus */
+        HAL_LPI2C_WriteCommand(instance, HAL_LPI2C_CMD_STOP, 0U);
+    }
+    else
+    {
+        /* Bus already released */
+    }
+
+    info->status.busy = 0U;
+}
+
+static int32_t I2C_GetDataCount(const I2C_Info_t *info)
+{
+    uint32_t count;
+    uint32_t queued;
+
+    count = info->count;
+
+    if (0U != info->status.busy)
+    {
+        if (NULL != info->rxData)
+        {
+            count = info->rxCount;
+
+            if (0U != info->useDma)
+            {
+                count += (uint32_t)info->chunk - HAL_DMA_GetRemaining(info->rxChannel);
+            }
+            else
+            {
+                /* rxCount is exact in interrupt mode */
+            }
+        }
+        else
+        {
+            /* Bytes queued minus those still waiting in the FIFO. */
+            queued = HAL_LPI2C_GetTxFifoCount(info->res->instance);
+            count  = (info->cmdCount > queued) ? (info->cmdCount - queued) : 0U;
+        }
+    }
+    else
+    {
+        /* Idle: result of the last transfer */
+    }
+
+    return (int32_t)count;
+}
+
+static int32_t I2C_Control(uint32_t control, uint32_t arg, const I2C_Resources_t *res, I2C_Info_t *info)
+{
+    int32_t result;
+    uint32_t speed;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & I2C_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((0U != info->status.busy) && (ARM_I2C_ABORT_TRANSFER != control))
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        switch (control)
+        {
+            case ARM_I2C_BUS_SPEED:
+                switch (arg)
+                {
+                    case ARM_I2C_BUS_SPEED_STANDARD:
+                        speed = 100000UL;
+                        break;
+
+                    case ARM_I2C_BUS_SPEED_FAST:
+                        speed = 400000UL;
+                        break;
+
+                    case ARM_I2C_BUS_SPEED_FAST_PLUS:
+                        speed = 1000000UL;
+                        break;
+
+                    default:
+                        speed  = 0U;
+                        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                        break;
+                }
+
+                if (0U != speed)
+                {
+                    HAL_LPI2C_Enable(res->instance, 0U);
+                    (void)HAL_LPI2C_SetBusSpeed(res->instance, speed);
+                    HAL_LPI2C_Enable(res->instance, 1U);
+                }
+                else
+                {
+                    /* Error already reported */
+                }
+                break;
+
+            case ARM_I2C_ABORT_TRANSFER:
+                if (0U != info->status.busy)
+                {
+                    I2C_Stop(info);
+                }
+                else
+                {
+                    /* Nothing to abort */
+                }
+                break;
+
+            case I2C_CONTROL_DMA_THRESHOLD:
+                info->dmaThreshold = arg;
+                break;
+
+            case ARM_I2C_OWN_ADDRESS:
+            case ARM_I2C_BUS_CLEAR:
+            default:
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+    }
+
+    return result;
+}
+
+static ARM_I2C_STATUS I2C_GetStatus(const I2C_Info_t *info)
+{
+    ARM_I2C_STATUS status;
+
+    status.busy             = info->status.busy;
+    status.mode             = 1U;
+    status.direction        = info->status.direction;
+    status.general_call     = 0U;
+    status.arbitration_lost = info->status.arbitration_lost;
+    status.bus_error        = info->status.bus_error;
+    status.reserved         = 0U;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void I2C_Signal(I2C_Info_t *info, uint32_t event)
+{
+    if (NULL != info->cbEvent)
+    {
+        info->cbEvent(event);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void I2C_RxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    I2C_Info_t *info;
+
+    (void)channel;
+
+    info = (I2C_Info_t *)param;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        I2C_Stop(info);
+        I2C_Signal(info, I2C_EVENT_FAILED);
+    }
+    else
+    {
+        info->rxCount += info->chunk;
+
+        if (info->rxCount < info->num)
+        {
+            I2C_StartDmaChunk(info);
+        }
+        else
+        {
+            I2C_CheckDone(info);
+        }
+    }
+}
+
+static void I2C_IRQHandler(I2C_Info_t *info)
+{
+    HAL_LPI2C_Instance_t instance;
+    uint32_t status;
+    uint32_t event;
+
+    instance = info->res->instance;
+    status   = HAL_LPI2C_GetStatus(instance);
+    event    = 0U;
+
+    if (0U != (status & HAL_LPI2C_STATUS_ERRORS))
+    {
+        event = I2C_EVENT_FAILED;
+
+        if (0U != (status & HAL_LPI2C_STATUS_ARB_LOST))
+        {
+            info->status.arbitration_lost = 1U;
+            event |= ARM_I2C_EVENT_ARBITRATION_LOST;
+        }
+        else if (0U != (status & HAL_LPI2C_STATUS_NACK))
+        {
+            event |= (0 == I2C_GetDataCount(info)) ? ARM_I2C_EVENT_ADDRESS_NACK : 0U;
+        }
+        else
+        {
+            info->status.bus_error = 1U;
+            event |= ARM_I2C_EVENT_BUS_ERROR;
+        }
+
+        I2C_Stop(info);
+        I2C_Signal(info, event);
+    }
+    else if (0U != info->status.busy)
+    {
+        if (0U != (status & HAL_LPI2C_STATUS_STOP))
+        {
+            HAL_LPI2C_ClearStatus(instance, HAL_LPI2C_STATUS_STOP);
+            info->stopSeen = 1U;
+        }
+        else
+        {
+            /* No STOP yet */
+        }
+
+        if ((NULL != info->rxData) && (0U == info->useDma))
+        {
+            I2C_DrainRx(info);
+        }
+        else
+        {
+            /* Transmit or DMA receive */
+        }
+
+        I2C_FillCommands(info);
+        I2C_CheckDone(info);
+    }
+    else
+    {
+        /* Spurious, silence the source */
+        HAL_LPI2C_ClearStatus(instance, HAL_LPI2C_STATUS_STOP);
+        HAL_LPI2C_SetInterrupts(instance, 0U);
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define I2C_INSTANCE(n)                                                                         \
+static int32_t I2C##n##_Initialize(ARM_I2C_SignalEvent_t cb_event)                              \
+{ return I2C_Initialize(cb_event, &s_i2c##n##Res, &s_i2c##n##Info); }                           \
+static int32_t I2C##n##_Uninitialize(void)                                                      \
+{ return I2C_Uninitialize(&s_i2c##n##Res, &s_i2c##n##Info); }                                   \
+static int32_t I2C##n##_PowerControl(ARM_POWER_STATE state)                                     \
+{ return I2C_PowerControl(state, &s_i2c##n##Res, &s_i2c##n##Info); }                            \
+static int32_t I2C##n##_MasterTransmit(uint32_t addr, const uint8_t *data, uint32_t num,        \
+                                       bool xfer_pending)                                       \
+{ return (NULL == data) ? ARM_DRIVER_ERROR_PARAMETER :                                          \
+         I2C_MasterStart(addr, data, NULL, num, xfer_pending, &s_i2c##n##Info); }               \
+static int32_t I2C##n##_MasterReceive(uint32_t addr, uint8_t *data, uint32_t num,               \
+                                      bool xfer_pending)                                        \
+{ return (NULL == data) ? ARM_DRIVER_ERROR_PARAMETER :                                          \
+         I2C_MasterStart(addr, NULL, data, num, xfer_pending, &s_i2c##n##Info); }               \
+static int32_t I2C##n##_SlaveTransmit(const uint8_t *data, uint32_t num)                        \
+{ (void)data; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }                                 \
+static int32_t I2C##n##_SlaveReceive(uint8_t *data, uint32_t num)                               \
+{ (void)data; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }                                 \
+static int32_t I2C##n##_GetDataCount(void)                                                      \
+{ return I2C_GetDataCount(&s_i2c##n##Info); }                                                   \
+static int32_t I2C##n##_Control(uint32_t control, uint32_t arg)                                 \
+{ return I2C_Control(control, arg, &s_i2c##n##Res, &s_i2c##n##Info); }                          \
+static ARM_I2C_STATUS I2C##n##_GetStatus(void)                                                  \
+{ return I2C_GetStatus(&s_i2c##n##Info); }                                                      \
+void LPI2C##n##_Master_IRQHandler(void)                                                         \
+{ I2C_IRQHandler(&s_i2c##n##Info); }                                                            \
+ARM_DRIVER_I2C Driver_I2C##n =                                                                  \
+{                                                                                               \
+    I2C_GetVersion,                                                                             \
+    I2C_GetCapabilities,                                                                        \
+    I2C##n##_Initialize,                                                                        \
+    I2C##n##_Uninitialize,                                                                      \
+    I2C##n##_PowerControl,                                                                      \
+    I2C##n##_MasterTransmit,                                                                    \
+    I2C##n##_MasterReceive,                                                                     \
+    I2C##n##_SlaveTransmit,                                                                     \
+    I2C##n##_SlaveReceive,                                                                      \
+    I2C##n##_GetDataCount,                                                                      \
+    I2C##n##_Control,                                                                           \
+    I2C##n##_GetStatus,                                                                         \
+};
+
+I2C_INSTANCE(0)
@@ -0,0 +1,909 @@
+/*******************************************************************************
+ * @file    Driver_SPI.c
+ * @brief   CMSIS SPI driver (master) for the S32K144 LPSPI C file.
+ *
+ * The transfer mode is chosen by length:
+ * - up to the DMA threshold the FIFO is served from the LPSPI interrupt,
+ *   which fires at the RX watermark (every few frames, never per frame);
+ * - longer transfers are moved by two eDMA channels with no CPU work until
+ *   the final RX major loop interrupt.
+ * PCS stays asserted for the whole transfer (TCR.CONT) and may be held
+ * across transfers with SPI_CONTROL_CS_HOLD.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "Driver_SPI_S32K144.h"
+#include "HAL_LPSPI.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_SPI_DRV_VERSION         ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define SPI_DMA_MAX_COUNT           (32767UL)   /**< CITER is 15 bits wide */
+#define SPI_DEFAULT_DMA_THRESHOLD   (16UL)
+#define SPI_DMA_TX_WATERMARK        (2U)
+#define SPI_IRQ_PRIORITY            (4U)
+#define SPI_PIN_NONE                (0xFFU)     /**< Pin routed by the board code */
+
+#define SPI_DATA_BITS_MIN           (8U)
+#define SPI_DATA_BITS_MAX           (32U)
+
+/* Driver state flags */
+#define SPI_FLAG_INITIALIZED        (1U << 0)
+#define SPI_FLAG_POWERED            (1U << 1)
+#define SPI_FLAG_CONFIGURED         (1U << 2)
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    HAL_LPSPI_Instance_t    instance;
+    IRQn_Type               irq;
+    dma_request_source_t    txRequest;
+    dma_request_source_t    rxRequest;
+    uint8_t                 port;           /**< Port of SCK / SIN / SOUT / PCS */
+    uint8_t                 sckPin;
+    uint8_t                 sinPin;
+    uint8_t                 soutPin;
+    uint8_t                 pcsPin;
+    uint8_t                 pcs;            /**< PCS index of pcsPin */
+    uint8_t                 pinMux;
+} SPI_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const SPI_Resources_t   *res;
+    ARM_SPI_SignalEvent_t   cbEvent;
+    volatile ARM_SPI_STATUS status;
+    uint8_t                 flags;
+    uint8_t                 txChannel;
+    uint8_t                 rxChannel;
+    uint8_t                 fifoSize;
+
+    HAL_LPSPI_Command_t     command;        /**< Frame format, PCS and CONT state */
+    uint8_t                 frameBytes;     /**< 1, 2 or 4 bytes per frame in memory */
+    uint8_t                 csHold;         /**< Keep PCS asserted after transfers */
+    uint8_t                 csActive;       /**< PCS currently asserted */
+    uint8_t                 useDma;         /**< Current transfer runs on eDMA */
+    uint32_t                busSpeed;
+    uint32_t                dmaThreshold;
+    uint32_t                defaultTx;
+    uint32_t                dummyRx;
+
+    const uint8_t           *txData;        /**< NULL: send defaultTx */
+    uint8_t                 *rxData;        /**< NULL: discard */
+    uint32_t                num;
+    uint32_t                txCount;
+    volatile uint32_t       rxCount;
+    uint16_t                chunk;
+} SPI_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION SPI_GetVersion(void);
+static ARM_SPI_CAPABILITIES SPI_GetCapabilities(void);
+
+static int32_t  SPI_Initialize(ARM_SPI_SignalEvent_t cb_event, const SPI_Resources_t *res, SPI_Info_t *info);
+static int32_t  SPI_Uninitialize(const SPI_Resources_t *res, SPI_Info_t *info);
+static int32_t  SPI_PowerControl(ARM_POWER_STATE state, const SPI_Resources_t *res, SPI_Info_t *info);
+static int32_t  SPI_StartTransfer(const void *dataOut, void *dataIn, uint32_t num, SPI_Info_t *info);
+static uint32_t SPI_GetDataCount(const SPI_Info_t *info);
+static int32_t  SPI_Control(uint32_t control, uint32_t arg, const SPI_Resources_t *res, SPI_Info_t *info);
+static ARM_SPI_STATUS SPI_GetStatus(const SPI_Info_t *info);
+
+static void SPI_StartDmaChunk(SPI_Info_t *info);
+static void SPI_FifoService(SPI_Info_t *info);
+static void SPI_Finish(SPI_Info_t *info, uint32_t event);
+static void SPI_ReleaseCs(SPI_Info_t *info);
+static void SPI_Abort(SPI_Info_t *info);
+static void SPI_RxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void SPI_IRQHandler(SPI_Info_t *info);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_SPI_API_VERSION,
+    ARM_SPI_DRV_VERSION
+};
+
+static const ARM_SPI_CAPABILITIES s_driverCapabilities =
+{
+    0, /* Reserved (must be zero) */
+    0, /* TI Synchronous Serial Interface */
+    0, /* Microwire Interface */
+    0, /* Signal Mode Fault event: ARM_SPI_EVENT_MODE_FAULT */
+    0  /* Reserved (must be zero) */
+};
+
+/* LPSPI0: PTB2..PTB5 (PCS0), LPSPI1: PTB14..PTB17 (PCS3), LPSPI2: pins muxed by the board code. */
+static const SPI_Resources_t s_spi0Res =
+{
+    HAL_LPSPI_0, LPSPI0_IRQn, EDMA_REQ_LPSPI0_TX, EDMA_REQ_LPSPI0_RX,
+    HAL_GPIO_PORT_B, 2U, 3U, 4U, 5U, 0U, 3U
+};
+
+static const SPI_Resources_t s_spi1Res =
+{
+    HAL_LPSPI_1, LPSPI1_IRQn, EDMA_REQ_LPSPI1_TX, EDMA_REQ_LPSPI1_RX,
+    HAL_GPIO_PORT_B, 14U, 15U, 16U, 17U, 3U, 3U
+};
+
+static const SPI_Resources_t s_spi2Res =
+{
+    HAL_LPSPI_2, LPSPI2_IRQn, EDMA_REQ_LPSPI2_TX, EDMA_REQ_LPSPI2_RX,
+    HAL_GPIO_PORT_MAX, SPI_PIN_NONE, SPI_PIN_NONE, SPI_PIN_NONE, SPI_PIN_NONE, 0U, 0U
+};
+
+static SPI_Info_t s_spi0Info;
+static SPI_Info_t s_spi1Info;
+static SPI_Info_t s_spi2Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION SPI_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_SPI_CAPABILITIES SPI_GetCapabilities(void)
+{
+    return s_driverCapabilities;
+}
+
+static int32_t SPI_Initialize(ARM_SPI_SignalEvent_t cb_event, const SPI_Resources_t *res, SPI_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & SPI_FLAG_INITIALIZED))
+    {
+        HAL_DMA_Init();
+
+        info->txChannel = HAL_DMA_AllocChannel();
+        info->rxChannel = HAL_DMA_AllocChannel();
+
+        if ((HAL_DMA_CHANNEL_INVALID == info->txChannel) || (HAL_DMA_CHANNEL_INVALID == info->rxChannel))
+        {
+            HAL_DMA_FreeChannel(info->txChannel);
+            HAL_DMA_FreeChannel(info->rxChannel);
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            if (SPI_PIN_NONE != res->sckPin)
+            {
+                HAL_GPIO_SetPinMux(res->port, res->sckPin, res->pinMux);
+                HAL_GPIO_SetPinMux(res->port, res->sinPin, res->pinMux);
+                HAL_GPIO_SetPinMux(res->port, res->soutPin, res->pinMux);
+            }
+            else
+            {
+                /* Pins are routed by the board code */
+            }
+
+            info->res          = res;
+            info->cbEvent      = cb_event;
+            info->dmaThreshold = SPI_DEFAULT_DMA_THRESHOLD;
+            info->command.pcs  = res->pcs;
+            info->flags        = SPI_FLAG_INITIALIZED;
+        }
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return result;
+}
+
+static int32_t SPI_Uninitialize(const SPI_Resources_t *res, SPI_Info_t *info)
+{
+    (void)SPI_PowerControl(ARM_POWER_OFF, res, info);
+
+    if (0U != (info->flags & SPI_FLAG_INITIALIZED))
+    {
+        HAL_DMA_FreeChannel(info->txChannel);
+        HAL_DMA_FreeChannel(info->rxChannel);
+    }
+    else
+    {
+        /* Not initialized, do nothing */
+    }
+
+    info->flags   = 0U;
+    info->cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t SPI_PowerControl(ARM_POWER_STATE state, const SPI_Resources_t *res, SPI_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != (info->flags & SPI_FLAG_POWERED))
+            {
+                HAL_NVIC_DisableIRQ(res->irq);
+                HAL_DMA_DisableRequest(info->txChannel);
+                HAL_DMA_DisableRequest(info->rxChannel);
+                HAL_LPSPI_Deinit(res->instance);
+            }
+            else
+            {
+                /* Already off */
+            }
+
+            info->status.busy = 0U;
+            info->csActive    = 0U;
+            info->flags &= (uint8_t)~(SPI_FLAG_POWERED | SPI_FLAG_CONFIGURED);
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & SPI_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & SPI_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                HAL_LPSPI_Init(res->instance);
+                info->fifoSize = HAL_LPSPI_GetFifoSize(res->instance);
+
+                HAL_DMA_SetRequestSource(info->txChannel, res->txRequest);
+                HAL_DMA_SetRequestSource(info->rxChannel, res->rxRequest);
+                HAL_DMA_RegisterCallback(info->rxChannel, SPI_RxDmaCallback, (void *)info);
+
+                info->status.busy      = 0U;
+                info->status.data_lost = 0U;
+                info->csActive         = 0U;
+
+                HAL_NVIC_SetPriority(res->irq, SPI_IRQ_PRIORITY);
+                HAL_NVIC_ClearPendingIRQ(res->irq);
+                HAL_NVIC_EnableIRQ(res->irq);
+
+                info->flags |= SPI_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+static void SPI_StartDmaChunk(SPI_Info_t *info)
+{
+    HAL_DMA_Transfer_t transfer;
+    HAL_DMA_Size_t size;
+    uint32_t remaining;
+    uint32_t offset;
+
+    remaining   = info->num - info->rxCount;
+    info->chunk = (uint16_t)((remaining > SPI_DMA_MAX_COUNT) ? SPI_DMA_MAX_COUNT : remaining);
+    offset      = info->rxCount * info->frameBytes;
+    size        = (4U == info->frameBytes) ? HAL_DMA_SIZE_32BIT :
+                  ((2U == info->frameBytes) ? HAL_DMA_SIZE_16BIT : HAL_DMA_SIZE_8BIT);
+
+    transfer.srcSize    = size;
+    transfer.dstSize    = size;
+    transfer.minorBytes = info->frameBytes;
+    transfer.majorCount = info->chunk;
+    transfer.srcLastAdj = 0;
+    transfer.dstLastAdj = 0;
+
+    /* RX first so that no received frame can be missed. */
+    transfer.srcAddr   = HAL_LPSPI_GetRxDataAddress(info->res->instance);
+    transfer.srcOffset = 0;
+    if (NULL != info->rxData)
+    {
+        transfer.dstAddr   = (uint32_t)&info->rxData[offset];
+        transfer.dstOffset = (int16_t)info->frameBytes;
+    }
+    else
+    {
+        transfer.dstAddr   = (uint32_t)&info->dummyRx;
+        transfer.dstOffset = 0;
+    }
+    transfer.flags = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+    HAL_DMA_ConfigTransfer(info->rxChannel, &transfer);
+
+    transfer.dstAddr   = HAL_LPSPI_GetTxDataAddress(info->res->instance);
+    transfer.dstOffset = 0;
+    if (NULL != info->txData)
+    {
+        transfer.srcAddr   = (uint32_t)&info->txData[offset];
+        transfer.srcOffset = (int16_t)info->frameBytes;
+    }
+    else
+    {
+        transfer.srcAddr   = (uint32_t)&info->defaultTx;
+        transfer.srcOffset = 0;
+    }
+    transfer.flags = HAL_DMA_FLAG_DISABLE_REQ;
+    HAL_DMA_ConfigTransfer(info->txChannel, &transfer);
+
+    HAL_DMA_EnableRequest(info->rxChannel);
+    HAL_DMA_EnableRequest(info->txChannel);
+}
+
+static void SPI_FifoService(SPI_Info_t *info)
+{
+    HAL_LPSPI_Instance_t instance;
+    uint32_t data;
+    uint32_t inFlight;
+
+    instance = info->res->instance;
+
+    /* Drain everything received so far. */
+    while ((0U == HAL_LPSPI_IsRxEmpty(instance)) && (info->rxCount < info->num))
+    {
+        data = HAL_LPSPI_ReadData(instance);
+
+        if (NULL != info->rxData)
+        {
+            switch (info->frameBytes)
+            {
+                case 1U:
+                    info->rxData[info->rxCount] = (uint8_t)data;
+                    break;
+
+                case 2U:
+                    ((uint16_t *)info->rxData)[info->rxCount] = (uint16_t)data;
+                    break;
+
+                default:
+                    ((uint32_t *)info->rxData)[info->rxCount] = data;
+                    break;
+            }
+        }
+        else
+        {
+            /* Send only: discard */
+        }
+
+        info->rxCount++;
+    }
+
+    /* Refill while both FIFOs have room for the frames in flight. */
+    while ((info->txCount < info->num) &&
+           ((info->txCount - info->rxCount) < info->fifoSize) &&
+           (HAL_LPSPI_GetTxFifoCount(instance) < info->fifoSize))
+    {
+        if (NULL != info->txData)
+        {
+            switch (info->frameBytes)
+            {
+                case 1U:
+                    data = info->txData[info->txCount];
+                    break;
+
+                case 2U:
+                    data = ((const uint16_t *)info->txData)[info->txCount];
+                    break;
+
+                default:
+                    data = ((const uint32_t *)info->txData)[info->txCount];
+                    break;
+            }
+        }
+        else
+        {
+            data = info->defaultTx;
+        }
+
+        HAL_LPSPI_WriteData(instance, data);
+        info->txCount++;
+    }
+
+    if (info->rxCount >= info->num)
+    {
+        HAL_LPSPI_SetInterrupts(instance, 0U);
+        SPI_Finish(info, ARM_SPI_EVENT_TRANSFER_COMPLETE);
+    }
+    else
+    {
+        /* Next interrupt once half of the frames in flight are back. */
+        inFlight = info->txCount - info->rxCount;
+        HAL_LPSPI_SetWatermarks(instance, 0U, (uint8_t)(((inFlight + 1UL) / 2UL) - 1UL));
+    }
+}
+
+static int32_t SPI_StartTransfer(const void *dataOut, void *dataIn, uint32_t num, SPI_Info_t *info)
+{
+    int32_t result;
+    HAL_LPSPI_Instance_t instance;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == num)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == (info->flags & SPI_FLAG_CONFIGURED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        instance = info->res->instance;
+
+        info->status.busy      = 1U;
+        info->status.data_lost = 0U;
+        info->txData  = (const uint8_t *)dataOut;
+        info->rxData  = (uint8_t *)dataIn;
+        info->num     = num;
+        info->txCount = 0U;
+        info->rxCount = 0U;
+        info->useDma  = (num > info->dmaThreshold) ? 1U : 0U;
+
+        /* One command for the whole transfer, continuing a held PCS if any. */
+        info->command.cont  = 1U;
+        info->command.contc = info->csActive;
+        HAL_LPSPI_WriteCommand(instance, &info->command);
+        info->csActive = 1U;
+
+        HAL_LPSPI_ClearStatus(instance, HAL_LPSPI_STATUS_RX_ERR | HAL_LPSPI_STATUS_TX_ERR);
+
+        if (0U != info->useDma)
+        {
+            HAL_LPSPI_SetWatermarks(instance, SPI_DMA_TX_WATERMARK, 0U);
+            HAL_LPSPI_SetInterrupts(instance, HAL_LPSPI_STATUS_RX_ERR);
+            HAL_LPSPI_EnableDma(instance, 1U);
+            SPI_StartDmaChunk(info);
+        }
+        else
+        {
+            HAL_LPSPI_EnableDma(instance, 0U);
+
+            /* Prime the FIFO from thread context, the interrupt takes over at the watermark. */
+            DISABLE_INTERRUPTS();
+            SPI_FifoService(info);
+            if (0U != info->status.busy)
+            {
+                HAL_LPSPI_SetInterrupts(instance, HAL_LPSPI_STATUS_RX | HAL_LPSPI_STATUS_RX_ERR);
+            }
+            else
+            {
+                /* Already finished */
+            }
+            ENABLE_INTERRUPTS();
+        }
+    }
+
+    return result;
+}
+
+static void SPI_ReleaseCs(SPI_Info_t *info)
+{
+    if (0U != info->csActive)
+    {
+        /* A command with CONT cleared ends the continuous transfer: PCS negates. */
+        info->command.cont  = 0U;
+        info->command.contc = 0U;
+        HAL_LPSPI_WriteCommand(info->res->instance, &info->command);
+        info->csActive = 0U;
+    }
+    else
+    {
+        /* PCS already released */
+    }
+}
+
+static void SPI_Finish(SPI_Info_t *info, uint32_t event)
+{
+    if (0U == info->csHold)
+    {
+        SPI_ReleaseCs(info);
+    }
+    else
+    {
+        /* Keep PCS asserted for the next chained transfer */
+    }
+
+    info->status.busy = 0U;
+
+    if (NULL != info->cbEvent)
+    {
+        info->cbEvent(event);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void SPI_Abort(SPI_Info_t *info)
+{
+    HAL_LPSPI_Instance_t instance;
+
+    instance = info->res->instance;
+
+    HAL_LPSPI_SetInterrupts(instance, 0U);
+    HAL_LPSPI_EnableDma(instance, 0U);
+    HAL_DMA_DisableRequest(info->txChannel);
+    HAL_DMA_DisableRequest(info->rxChannel);
+
+    if (0U != info->useDma)
+    {
+        info->rxCount = SPI_GetDataCount(info);
+    }
+    else
+    {
+        /* rxCount is exact in interrupt mode */
+    }
+
+    HAL_LPSPI_FlushFifo(instance);
+    SPI_ReleaseCs(info);
+    info->status.busy = 0U;
+}
+
+static uint32_t SPI_GetDataCount(const SPI_Info_t *info)
+{
+    uint32_t count;
+
+    count = info->rxCount;
+
+    if ((0U != info->status.busy) && (0U != info->useDma))
+    {
+        count += (uint32_t)info->chunk - HAL_DMA_GetRemaining(info->rxChannel);
+    }
+    else
+    {
+        /* Interrupt mode or idle: rxCount is exact */
+    }
+
+    return count;
+}
+
+static int32_t SPI_Control(uint32_t control, uint32_t arg, const SPI_Resources_t *res, SPI_Info_t *info)
+{
+    int32_t result;
+    uint32_t dataBits;
+    uint32_t speed;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & SPI_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((0U != info->status.busy) &&
+             ((control & ARM_SPI_CONTROL_Msk) != ARM_SPI_ABORT_TRANSFER) &&
+             ((control & ARM_SPI_CONTROL_Msk) != ARM_SPI_GET_BUS_SPEED))
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        switch (control & ARM_SPI_CONTROL_Msk)
+        {
+            case ARM_SPI_MODE_INACTIVE:
+                HAL_LPSPI_Enable(res->instance, 0U);
+                info->flags &= (uint8_t)~SPI_FLAG_CONFIGURED;
+                break;
+
+            case ARM_SPI_MODE_MASTER:
+                switch (control & ARM_SPI_FRAME_FORMAT_Msk)
+                {
+                    case ARM_SPI_CPOL0_CPHA0:
+                        info->command.cpol = 0U;
+                        info->command.cpha = 0U;
+                        break;
+
+                    case ARM_SPI_CPOL0_CPHA1:
+                        info->command.cpol = 0U;
+                        info->command.cpha = 1U;
+                        break;
+
+                    case ARM_SPI_CPOL1_CPHA0:
+                        info->command.cpol = 1U;
+                        info->command.cpha = 0U;
+                        break;
+
+                    case ARM_SPI_CPOL1_CPHA1:
+                        info->command.cpol = 1U;
+                        info->command.cpha = 1U;
+                        break;
+
+                    default:
+                        result = ARM_SPI_ERROR_FRAME_FORMAT;
+                        break;
+                }
+
+                dataBits = (control & ARM_SPI_DATA_BITS_Msk) >> ARM_SPI_DATA_BITS_Pos;
+                dataBits = (0U == dataBits) ? 8U : dataBits;
+                if ((dataBits < SPI_DATA_BITS_MIN) || (dataBits > SPI_DATA_BITS_MAX))
+                {
+                    result = ARM_SPI_ERROR_DATA_BITS;
+                }
+                else
+                {
+                    /* Stage the format, committed only if everything is valid. */
+                }
+
+                switch (control & ARM_SPI_SS_MASTER_MODE_Msk)
+                {
+                    case ARM_SPI_SS_MASTER_UNUSED:
+                        break;
+
+                    case ARM_SPI_SS_MASTER_HW_OUTPUT:
+                        if (SPI_PIN_NONE != res->pcsPin)
+                        {
+                            HAL_GPIO_SetPinMux(res->port, res->pcsPin, res->pinMux);
+                        }
+                        else
+                        {
+                            /* PCS pin is routed by the board code */
+                        }
+                        break;
+
+                    default:
+                        result = ARM_SPI_ERROR_SS_MODE;
+                        break;
+                }
+
+                if (ARM_DRIVER_OK == result)
+                {
+                    HAL_LPSPI_Enable(res->instance, 0U);
+                    HAL_LPSPI_SetMaster(res->instance);
+                    speed = HAL_LPSPI_SetBaudRate(res->instance, arg);
+
+                    if (0U != speed)
+                    {
+                        info->busSpeed          = speed;
+                        info->command.frameBits = (uint8_t)dataBits;
+                        info->command.lsbFirst  = ((control & ARM_SPI_BIT_ORDER_Msk) == ARM_SPI_LSB_MSB) ? 1U : 0U;
+                        info->frameBytes        = (dataBits <= 8U) ? 1U : ((dataBits <= 16U) ? 2U : 4U);
+                        info->csActive          = 0U;
+                        HAL_LPSPI_Enable(res->instance, 1U);
+                        info->flags |= SPI_FLAG_CONFIGURED;
+                    }
+                    else
+                    {
+                        result = ARM_DRIVER_ERROR_PARAMETER;
+                    }
+                }
+                else
+                {
+                    /* Error already reported */
+                }
+                break;
+
+            case ARM_SPI_MODE_SLAVE:
+            case ARM_SPI_MODE_MASTER_SIMPLEX:
+            case ARM_SPI_MODE_SLAVE_SIMPLEX:
+                result = ARM_SPI_ERROR_MODE;
+                break;
+
+            case ARM_SPI_SET_BUS_SPEED:
+                HAL_LPSPI_Enable(res->instance, 0U);
+                speed = HAL_LPSPI_SetBaudRate(res->instance, arg);
+                HAL_LPSPI_Enable(res->instance, 1U);
+
+                if (0U != speed)
+                {
+                    info->busSpeed = speed;
+                }
+                else
+                {
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+                break;
+
+            case ARM_SPI_GET_BUS_SPEED:
+                result = (int32_t)info->busSpeed;
+                break;
+
+            case ARM_SPI_SET_DEFAULT_TX_VALUE:
+                info->defaultTx = arg;
+                break;
+
+            case ARM_SPI_ABORT_TRANSFER:
+                SPI_Abort(info);
+                break;
+
+            case SPI_CONTROL_CS_HOLD:
+                info->csHold = (0U != arg) ? 1U : 0U;
+                if (0U == info->csHold)
+                {
+                    SPI_ReleaseCs(info);
+                }
+                else
+                {
+                    /* Released by the first transfer after hold is cleared */
+                }
+                break;
+
+            case SPI_CONTROL_DMA_THRESHOLD:
+                info->dmaThreshold = arg;
+                break;
+
+            case SPI_CONTROL_PCS:
+                if (arg > 3U)
+                {
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+                else
+                {
+                    info->command.pcs = (uint8_t)arg;
+                }
+                break;
+
+            default:
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+    }
+
+    return result;
+}
+
+static ARM_SPI_STATUS SPI_GetStatus(const SPI_Info_t *info)
+{
+    ARM_SPI_STATUS status;
+
+    status.busy       = info->status.busy;
+    status.data_lost  = info->status.data_lost;
+    status.mode_fault = 0U;
+    status.reserved   = 0U;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void SPI_RxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    SPI_Info_t *info;
+
+    (void)channel;
+
+    info = (SPI_Info_t *)param;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        SPI_Abort(info);
+        info->status.data_lost = 1U;
+
+        if (NULL != info->cbEvent)
+        {
+            info->cbEvent(ARM_SPI_EVENT_DATA_LOST);
+        }
+        else
+        {
+            /* No callback registered */
+        }
+    }
+    else
+    {
+        info->rxCount += info->chunk;
+
+        if (info->rxCount < info->num)
+        {
+            SPI_StartDmaChunk(info);
+        }
+        else
+        {
+            HAL_LPSPI_SetInterrupts(info->res->instance, 0U);
+            HAL_LPSPI_EnableDma(info->res->instance, 0U);
+            SPI_Finish(info, ARM_SPI_EVENT_TRANSFER_COMPLETE);
+        }
+    }
+}
+
+static void SPI_IRQHandler(SPI_Info_t *info)
+{
+    uint32_t status;
+
+    status = HAL_LPSPI_GetStatus(info->res->instance);
+
+    if (0U != (status & HAL_LPSPI_STATUS_RX_ERR))
+    {
+        HAL_LPSPI_ClearStatus(info->res->instance, HAL_LPSPI_STATUS_RX_ERR);
+        info->status.data_lost = 1U;
+
+        if (NULL != info->cbEvent)
+        {
+            info->cbEvent(ARM_SPI_EVENT_DATA_LOST);
+        }
+        else
+        {
+            /* No callback registered */
+        }
+    }
+    else
+    {
+        /* No overflow */
+    }
+
+    if ((0U != info->status.busy) && (0U == info->useDma))
+    {
+        SPI_FifoService(info);
+    }
+    else
+    {
+        /* DMA mode: only errors are signaled here */
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define SPI_INSTANCE(n)                                                                         \
+static int32_t SPI##n##_Initialize(ARM_SPI_SignalEvent_t cb_event)                              \
+{ return SPI_Initialize(cb_event, &s_spi##n##Res, &s_spi##n##Info); }                           \
+static int32_t SPI##n##_Uninitialize(void)                                                      \
+{ return SPI_Uninitialize(&s_spi##n##Res, &s_spi##n##Info); }                                   \
+static int32_t SPI##n##_PowerControl(ARM_POWER_STATE state)                                     \
+{ return SPI_PowerControl(state, &s_spi##n##Res, &s_spi##n##Info); }                            \
+static int32_t SPI##n##_Send(const void *data, uint32_t num)                                    \
+{ return (NULL == data) ? ARM_DRIVER_ERROR_PARAMETER :                                          \
+         SPI_StartTransfer(data, NULL, num, &s_spi##n##Info); }                                 \
+static int32_t SPI##n##_Receive(void *data, uint32_t num)                                       \
+{ return (NULL == data) ? ARM_DRIVER_ERROR_PARAMETER :                                          \
+         SPI_StartTransfer(NULL, data, num, &s_spi##n##Info); }                                 \
+static int32_t SPI##n##_Transfer(const void *data_out, void *data_in, uint32_t num)             \
+{ return ((NULL == data_out) || (NULL == data_in)) ? ARM_DRIVER_ERROR_PARAMETER :               \
+         SPI_StartTransfer(data_out, data_in, num, &s_spi##n##Info); }                          \
+static uint32_t SPI##n##_GetDataCount(void)                                                     \
+{ return SPI_GetDataCount(&s_spi##n##Info); }                                                   \
+static int32_t SPI##n##_Control(uint32_t control, uint32_t arg)                                 \
+{ return SPI_Control(control, arg, &s_spi##n##Res, &s_spi##n##Info); }                          \
+static ARM_SPI_STATUS SPI##n##_GetStatus(void)                                                  \
+{ return SPI_GetStatus(&s_spi##n##Info); }                                                      \
+void LPSPI##n##_IRQHandler(void)                                                                \
+{ SPI_IRQHandler(&s_spi##n##Info); }                                                            \
+ARM_DRIVER_SPI Driver_SPI##n =                                                                  \
+{                                                                                               \
+    SPI_GetVersion,                                                                             \
+    SPI_GetCapabilities,                                                                        \
+    SPI##n##_Initialize,                                                                        \
+    SPI##n##_Uninitialize,                                                                      \
+    SPI##n##_PowerControl,                                                                      \
+    SPI##n##_Send,                                                                              \
+    SPI##n##_Receive,                                                                           \
+    SPI##n##_Transfer,                                                                          \
+    SPI##n##_GetDataCount,                                                                      \
+    SPI##n##_Control,                                                                           \
+    SPI##n##_GetStatus,                                                                         \
+};
+
+SPI_INSTANCE(0)
+SPI_INSTANCE(1)
+SPI_INSTANCE(2)
@@ -0,0 +1,889 @@
+/*******************************************************************************
+ * @file    Driver_SPI_FLEXIO.c
+ * @brief   CMSIS SPI driver (master) on FlexIO (SPI emulation) C file.
+ *
+ * A transmit shifter drives SOUT, a receive shifter samples SIN and one
+ * timer in baud mode generates SCK: it is enabled while the transmit
+ * buffer holds a frame and stops after it, so the bus runs as fast as
+ * eDMA refills the transmit buffer and empties the receive one. Every
+ * transfer is served by two eDMA channels, the CPU only takes the final
+ * RX major loop interrupt.
+ *
+ * Frames are 8, 16 or 32 bits, MSB or LSB first, any CPOL / CPHA; the
+ * bit order is handled by the buffer view the DMA accesses. SCK is the
+ * FlexIO clock / (2 * n), n = 2 ... 256 (12 MHz ... 93.75 kHz). The chip
+ * select is a GPIO, asserted for the whole transfer (or longer with
+ * SPI_CONTROL_CS_HOLD).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "Driver_SPI_S32K144.h"
+#include "HAL_FLEXIO.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_SPI_DRV_VERSION         ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define FXSPI_DMA_MAX_COUNT         (32767UL)   /**< CITER is 15 bits wide */
+#define FXSPI_DIVIDER_MIN           (2UL)       /**< Half SCK period in FlexIO clocks */
+#define FXSPI_DIVIDER_MAX           (256UL)
+#define FXSPI_WORD_BYTES            (4U)        /**< Shifter buffer width */
+
+/* Driver state flags */
+#define FXSPI_FLAG_INITIALIZED      (1U << 0)
+#define FXSPI_FLAG_POWERED          (1U << 1)
+#define FXSPI_FLAG_CONFIGURED       (1U << 2)
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    uint8_t                 sckPin;         /**< FXIO_Dn of SCK  */
+    uint8_t                 soutPin;        /**< FXIO_Dn of SOUT */
+    uint8_t                 sinPin;         /**< FXIO_Dn of SIN  */
+    uint8_t                 sckPort;
+    uint8_t                 sckPortPin;
+    uint8_t                 soutPort;
+    uint8_t                 soutPortPin;
+    uint8_t                 sinPort;
+    uint8_t                 sinPortPin;
+    uint8_t                 pinMux;
+    uint8_t                 csPort;         /**< GPIO chip select, active low */
+    uint8_t                 csPortPin;
+} FXSPI_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const FXSPI_Resources_t *res;
+    ARM_SPI_SignalEvent_t   cbEvent;
+    volatile ARM_SPI_STATUS status;
+    uint8_t                 flags;
+    uint8_t                 txChannel;
+    uint8_t                 rxChannel;
+    uint8_t                 txShifter;
+    uint8_t                 rxShifter;
+    uint8_t                 timer;
+
+    uint8_t                 cpol;
+    uint8_t                 cpha;
+    uint8_t                 lsbFirst;
+    uint8_t                 frameBytes;     /**< 1, 2 or 4 bytes per frame in memory */
+    uint8_t                 csUsed;         /**< Chip select driven by the driver */
+    uint8_t                 csHold;         /**< Keep CS asserted after transfers */
+    uint8_t                 csActive;       /**< CS currently asserted */
+    uint16_t                divider;        /**< Half SCK period in FlexIO clocks */
+    uint32_t                busSpeed;
+    uint32_t                defaultTx;
+    uint32_t                dummyRx;
+
+    const uint8_t           *txData;        /**< NULL: send defaultTx */
+    uint8_t                 *rxData;        /**< NULL: discard */
+    uint32_t                num;
+    volatile uint32_t       rxCount;        /**< Frames of finished DMA chunks */
+    uint16_t                chunk;
+} FXSPI_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION FXSPI_GetVersion(void);
+static ARM_SPI_CAPABILITIES FXSPI_GetCapabilities(void);
+
+static int32_t  FXSPI_Initialize(ARM_SPI_SignalEvent_t cb_event, const FXSPI_Resources_t *res, FXSPI_Info_t *info);
+static int32_t  FXSPI_Uninitialize(FXSPI_Info_t *info);
+static int32_t  FXSPI_PowerControl(ARM_POWER_STATE state, FXSPI_Info_t *info);
+static int32_t  FXSPI_StartTransfer(const void *dataOut, void *dataIn, uint32_t num, FXSPI_Info_t *info);
+static uint32_t FXSPI_GetDataCount(const FXSPI_Info_t *info);
+static int32_t  FXSPI_Control(uint32_t control, uint32_t arg, FXSPI_Info_t *info);
+static ARM_SPI_STATUS FXSPI_GetStatus(const FXSPI_Info_t *info);
+
+static void FXSPI_Setup(FXSPI_Info_t *info, uint8_t enable);
+static uint32_t FXSPI_SetSpeed(FXSPI_Info_t *info, uint32_t speed);
+static void FXSPI_StartDmaChunk(FXSPI_Info_t *info);
+static void FXSPI_Finish(FXSPI_Info_t *info, uint32_t event);
+static void FXSPI_ReleaseCs(FXSPI_Info_t *info);
+static void FXSPI_Abort(FXSPI_Info_t *info);
+static void FXSPI_RxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void FXSPI_RxCallback(uint8_t shifter, uint32_t status, void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_SPI_API_VERSION,
+    ARM_SPI_DRV_VERSION
+};
+
+static const ARM_SPI_CAPABILITIES s_driverCapabilities =
+{
+    0, /* Reserved (must be zero) */
+    0, /* TI Synchronous Serial Interface */
+    0, /* Microwire Interface */
+    0, /* Signal Mode Fault event: ARM_SPI_EVENT_MODE_FAULT */
+    0  /* Reserved (must be zero) */
+};
+
+/* SPI3: FXIO_D4 SCK on PTD2, FXIO_D5 SOUT on PTD3, FXIO_D6 SIN on PTA8 (ALT4), CS on PTA9 (GPIO). */
+static const FXSPI_Resources_t s_spi3Res =
+{
+    4U, 5U, 6U,
+    HAL_GPIO_PORT_D, 2U, HAL_GPIO_PORT_D, 3U, HAL_GPIO_PORT_A, 8U, 4U,
+    HAL_GPIO_PORT_A, 9U
+};
+
+static FXSPI_Info_t s_spi3Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION FXSPI_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_SPI_CAPABILITIES FXSPI_GetCapabilities(void)
+{
+    return s_driverCapabilities;
+}
+
+static int32_t FXSPI_Initialize(ARM_SPI_SignalEvent_t cb_event, const FXSPI_Resources_t *res, FXSPI_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & FXSPI_FLAG_INITIALIZED))
+    {
+        HAL_FLEXIO_Init();
+        HAL_DMA_Init();
+
+        info->txChannel = HAL_DMA_AllocChannel();
+        info->rxChannel = HAL_DMA_AllocChannel();
+        info->txShifter = HAL_FLEXIO_AllocShifter();
+        info->rxShifter = HAL_FLEXIO_AllocShifter();
+        info->timer     = HAL_FLEXIO_AllocTimer();
+
+        if ((HAL_DMA_CHANNEL_INVALID == info->txChannel) || (HAL_DMA_CHANNEL_INVALID == info->rxChannel) ||
+            (HAL_FLEXIO_INVALID == info->txShifter) || (HAL_FLEXIO_INVALID == info->rxShifter) ||
+            (HAL_FLEXIO_INVALID == info->timer))
+        {
+            HAL_DMA_FreeChannel(info->txChannel);
+            HAL_DMA_FreeChannel(info->rxChannel);
+            HAL_FLEXIO_FreeShifter(info->txShifter);
+            HAL_FLEXIO_FreeShifter(info->rxShifter);
+            HAL_FLEXIO_FreeTimer(info->timer);
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            HAL_GPIO_SetPinMux(res->sckPort, res->sckPortPin, res->pinMux);
+            HAL_GPIO_SetPinMux(res->soutPort, res->soutPortPin, res->pinMux);
+            HAL_GPIO_SetPinMux(res->sinPort, res->sinPortPin, res->pinMux);
+
+            info->res     = res;
+            info->cbEvent = cb_event;
+            info->flags   = FXSPI_FLAG_INITIALIZED;
+        }
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return result;
+}
+
+static int32_t FXSPI_Uninitialize(FXSPI_Info_t *info)
+{
+    (void)FXSPI_PowerControl(ARM_POWER_OFF, info);
+
+    if (0U != (info->flags & FXSPI_FLAG_INITIALIZED))
+    {
+        HAL_DMA_FreeChannel(info->txChannel);
+        HAL_DMA_FreeChannel(info->rxChannel);
+        HAL_FLEXIO_FreeShifter(info->txShifter);
+        HAL_FLEXIO_FreeShifter(info->rxShifter);
+        HAL_FLEXIO_FreeTimer(info->timer);
+    }
+    else
+    {
+        /* Not initialized, do nothing */
+    }
+
+    info->flags   = 0U;
+    info->cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t FXSPI_PowerControl(ARM_POWER_STATE state, FXSPI_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != (info->flags & FXSPI_FLAG_POWERED))
+            {
+                HAL_DMA_DisableRequest(info->txChannel);
+                HAL_DMA_DisableRequest(info->rxChannel);
+                FXSPI_ReleaseCs(info);
+                FXSPI_Setup(info, 0U);
+                HAL_FLEXIO_EnableDma(info->txShifter, 0U);
+                HAL_FLEXIO_EnableDma(info->rxShifter, 0U);
+                HAL_FLEXIO_EnableIrq(info->rxShifter, 0U);
+                HAL_FLEXIO_RegisterCallback(info->rxShifter, NULL, NULL);
+            }
+            else
+            {
+                /* Already off */
+            }
+
+            info->status.busy = 0U;
+            info->csActive    = 0U;
+            info->flags &= (uint8_t)~(FXSPI_FLAG_POWERED | FXSPI_FLAG_CONFIGURED);
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & FXSPI_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & FXSPI_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                HAL_DMA_SetRequestSource(info->txChannel, HAL_FLEXIO_GetDmaRequest(info->txShifter));
+                HAL_DMA_SetRequestSource(info->rxChannel, HAL_FLEXIO_GetDmaRequest(info->rxShifter));
+                HAL_DMA_RegisterCallback(info->rxChannel, FXSPI_RxDmaCallback, (void *)info);
+
+                HAL_FLEXIO_EnableDma(info->txShifter, 1U);
+                HAL_FLEXIO_EnableDma(info->rxShifter, 1U);
+
+                /* Receive overrun is the only interrupt outside DMA. */
+                HAL_FLEXIO_RegisterCallback(info->rxShifter, FXSPI_RxCallback, (void *)info);
+                HAL_FLEXIO_EnableIrq(info->rxShifter, HAL_FLEXIO_STATUS_ERROR);
+
+                info->status.busy      = 0U;
+                info->status.data_lost = 0U;
+                info->csActive         = 0U;
+
+                info->flags |= FXSPI_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Program the shifters and the SCK timer for the current format,
+ *        or stop them. Reprogramming also drops any stale buffer content.
+ */
+static void FXSPI_Setup(FXSPI_Info_t *info, uint8_t enable)
+{
+    HAL_FLEXIO_Shifter_t shifter;
+    HAL_FLEXIO_Timer_t timer;
+    uint32_t bits;
+
+    bits = (uint32_t)info->frameBytes * 8U;
+
+    /* SCK: enabled while the transmit buffer holds a frame, 2 edges per bit */
+    timer.mode       = (0U != enable) ? HAL_FLEXIO_TIMER_BAUD : HAL_FLEXIO_TIMER_DISABLED;
+    timer.trigger    = HAL_FLEXIO_TRIGGER_SHIFTER(info->txShifter);
+    timer.triggerLow = 1U;
+    timer.pin        = info->res->sckPin;
+    timer.pinConfig  = (0U != enable) ? HAL_FLEXIO_PIN_OUTPUT : HAL_FLEXIO_PIN_INPUT;
+    timer.pinInvert  = info->cpol;
+    timer.output     = HAL_FLEXIO_TIMOUT_ZERO;
+    timer.decrement  = HAL_FLEXIO_TIMDEC_CLOCK;
+    timer.reset      = HAL_FLEXIO_TIMRST_NEVER;
+    timer.disable    = HAL_FLEXIO_TIMDIS_COMPARE;
+    timer.enable     = HAL_FLEXIO_TIMENA_TRIGGER_HIGH;
+    timer.stopBit    = HAL_FLEXIO_TSTOP_DISABLE;
+    timer.startBit   = 1U;
+    timer.compare    = (uint16_t)((((2UL * bits) - 1UL) << 8) | ((uint32_t)info->divider - 1UL));
+    HAL_FLEXIO_SetTimer(info->timer, &timer);
+
+    /* CPHA = 0: output on the trailing edge, data valid before the first one. */
+    shifter.mode         = (0U != enable) ? HAL_FLEXIO_SHIFTER_TRANSMIT : HAL_FLEXIO_SHIFTER_DISABLED;
+    shifter.timer        = info->timer;
+    shifter.timerFalling = (0U == info->cpha) ? 1U : 0U;
+    shifter.pin          = info->res->soutPin;
+    shifter.pinConfig    = (0U != enable) ? HAL_FLEXIO_PIN_OUTPUT : HAL_FLEXIO_PIN_INPUT;
+    shifter.pinInvert    = 0U;
+    shifter.startBit     = (0U == info->cpha) ? HAL_FLEXIO_START_NONE : HAL_FLEXIO_START_NONE_LATE;
+    shifter.stopBit      = HAL_FLEXIO_STOP_NONE;
+    HAL_FLEXIO_SetShifter(info->txShifter, &shifter);
+
+    shifter.mode         = (0U != enable) ? HAL_FLEXIO_SHIFTER_RECEIVE : HAL_FLEXIO_SHIFTER_DISABLED;
+    shifter.timerFalling = (0U == info->cpha) ? 0U : 1U;
+    shifter.pin          = info->res->sinPin;
+    shifter.pinConfig    = HAL_FLEXIO_PIN_INPUT;
+    shifter.startBit     = HAL_FLEXIO_START_NONE;
+    HAL_FLEXIO_SetShifter(info->rxShifter, &shifter);
+}
+
+/**
+ * @brief Nearest SCK rate not above the requested one.
+ *
+ * @return  Actual rate, 0 when out of range (divider unchanged).
+ */
+static uint32_t FXSPI_SetSpeed(FXSPI_Info_t *info, uint32_t speed)
+{
+    uint32_t divider;
+    uint32_t actual;
+
+    actual = 0U;
+
+    if (0U != speed)
+    {
+        divider = (HAL_FLEXIO_CLOCK_HZ + (2UL * speed) - 1UL) / (2UL * speed);
+        divider = (divider < FXSPI_DIVIDER_MIN) ? FXSPI_DIVIDER_MIN : divider;
+
+        if (divider <= FXSPI_DIVIDER_MAX)
+        {
+            info->divider = (uint16_t)divider;
+            actual = HAL_FLEXIO_CLOCK_HZ / (2UL * divider);
+        }
+        else
+        {
+            /* Below the slowest rate */
+        }
+    }
+    else
+    {
+        /* Invalid rate */
+    }
+
+    return actual;
+}
+
+static void FXSPI_StartDmaChunk(FXSPI_Info_t *info)
+{
+    HAL_DMA_Transfer_t transfer;
+    HAL_DMA_Size_t size;
+    uint32_t remaining;
+    uint32_t offset;
+    uint32_t shift;
+
+    remaining   = info->num - info->rxCount;
+    info->chunk = (uint16_t)((remaining > FXSPI_DMA_MAX_COUNT) ? FXSPI_DMA_MAX_COUNT : remaining);
+    offset      = info->rxCount * info->frameBytes;
+    shift       = (uint32_t)FXSPI_WORD_BYTES - info->frameBytes;
+    size        = (4U == info->frameBytes) ? HAL_DMA_SIZE_32BIT :
+                  ((2U == info->frameBytes) ? HAL_DMA_SIZE_16BIT : HAL_DMA_SIZE_8BIT);
+
+    transfer.srcSize    = size;
+    transfer.dstSize    = size;
+    transfer.minorBytes = info->frameBytes;
+    transfer.majorCount = info->chunk;
+    transfer.srcLastAdj = 0;
+    transfer.dstLastAdj = 0;
+
+    /*
+     * The transmit shifter sends bit 0 first, the receive shifter fills
+     * from bit 31 down: LSB first uses the plain buffer (RX in its top
+     * bytes), MSB first the bit swapped one (TX in its top bytes).
+     */
+    if (0U != info->lsbFirst)
+    {
+        transfer.srcAddr = HAL_FLEXIO_GetBufferAddress(info->rxShifter, HAL_FLEXIO_BUFFER_NORMAL) + shift;
+    }
+    else
+    {
+        transfer.srcAddr = HAL_FLEXIO_GetBufferAddress(info->rxShifter, HAL_FLEXIO_BUFFER_BIT_SWAP);
+    }
+    transfer.srcOffset = 0;
+
+    /* RX first so that no received frame can be missed. */
+    if (NULL != info->rxData)
+    {
+        transfer.dstAddr   = (uint32_t)&info->rxData[offset];
+        transfer.dstOffset = (int16_t)info->frameBytes;
+    }
+    else
+    {
+        transfer.dstAddr   = (uint32_t)&info->dummyRx;
+        transfer.dstOffset = 0;
+    }
+    transfer.flags = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+    HAL_DMA_ConfigTransfer(info->rxChannel, &transfer);
+
+    if (0U != info->lsbFirst)
+    {
+        transfer.dstAddr = HAL_FLEXIO_GetBufferAddress(info->txShifter, HAL_FLEXIO_BUFFER_NORMAL);
+    }
+    else
+    {
+        transfer.dstAddr = HAL_FLEXIO_GetBufferAddress(info->txShifter, HAL_FLEXIO_BUFFER_BIT_SWAP) + shift;
+    }
+    transfer.dstOffset = 0;
+
+    if (NULL != info->txData)
+    {
+        transfer.srcAddr   = (uint32_t)&info->txData[offset];
+        transfer.srcOffset = (int16_t)info->frameBytes;
+    }
+    else
+    {
+        transfer.srcAddr   = (uint32_t)&info->defaultTx;
+        transfer.srcOffset = 0;
+    }
+    transfer.flags = HAL_DMA_FLAG_DISABLE_REQ;
+    HAL_DMA_ConfigTransfer(info->txChannel, &transfer);
+
+    HAL_DMA_EnableRequest(info->rxChannel);
+    HAL_DMA_EnableRequest(info->txChannel);
+}
+
+static int32_t FXSPI_StartTransfer(const void *dataOut, void *dataIn, uint32_t num, FXSPI_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == num)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == (info->flags & FXSPI_FLAG_CONFIGURED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.busy      = 1U;
+        info->status.data_lost = 0U;
+        info->txData  = (const uint8_t *)dataOut;
+        info->rxData  = (uint8_t *)dataIn;
+        info->num     = num;
+        info->rxCount = 0U;
+
+        if ((0U != info->csUsed) && (0U == info->csActive))
+        {
+            HAL_GPIO_WritePin(info->res->csPort, info->res->csPortPin, 0U);
+            info->csActive = 1U;
+        }
+        else
+        {
+            /* No chip select, or still held from the previous transfer */
+        }
+
+        (void)HAL_FLEXIO_TakeShifterError(info->rxShifter);
+        FXSPI_StartDmaChunk(info);
+    }
+
+    return result;
+}
+
+static void FXSPI_ReleaseCs(FXSPI_Info_t *info)
+{
+    if (0U != info->csActive)
+    {
+        HAL_GPIO_WritePin(info->res->csPort, info->res->csPortPin, 1U);
+        info->csActive = 0U;
+    }
+    else
+    {
+        /* CS already released */
+    }
+}
+
+static void FXSPI_Finish(FXSPI_Info_t *info, uint32_t event)
+{
+    if (0U == info->csHold)
+    {
+        FXSPI_ReleaseCs(info);
+    }
+    else
+    {
+        /* Keep CS asserted for the next chained transfer */
+    }
+
+    info->status.busy = 0U;
+
+    if (NULL != info->cbEvent)
+    {
+        info->cbEvent(event);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void FXSPI_Abort(FXSPI_Info_t *info)
+{
+    HAL_DMA_DisableRequest(info->txChannel);
+    HAL_DMA_DisableRequest(info->rxChannel);
+
+    info->rxCount = FXSPI_GetDataCount(info);
+
+    /* Stop the frame in progress and drop what is left in the buffers. */
+    FXSPI_Setup(info, 0U);
+    FXSPI_Setup(info, 1U);
+    FXSPI_ReleaseCs(info);
+    info->status.busy = 0U;
+}
+
+static uint32_t FXSPI_GetDataCount(const FXSPI_Info_t *info)
+{
+    uint32_t count;
+
+    count = info->rxCount;
+
+    if (0U != info->status.busy)
+    {
+        count += (uint32_t)info->chunk - HAL_DMA_GetRemaining(info->rxChannel);
+    }
+    else
+    {
+        /* Idle: rxCount is exact */
+    }
+
+    return count;
+}
+
+static int32_t FXSPI_Control(uint32_t control, uint32_t arg, FXSPI_Info_t *info)
+{
+    int32_t result;
+    uint32_t dataBits;
+    uint32_t speed;
+    uint8_t cpol;
+    uint8_t cpha;
+    uint8_t csUsed;
+
+    result = ARM_DRIVER_OK;
+    cpol   = 0U;
+    cpha   = 0U;
+    csUsed = 0U;
+
+    if (0U == (info->flags & FXSPI_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((0U != info->status.busy) &&
+             ((control & ARM_SPI_CONTROL_Msk) != ARM_SPI_ABORT_TRANSFER) &&
+             ((control & ARM_SPI_CONTROL_Msk) != ARM_SPI_GET_BUS_SPEED))
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        switch (control & ARM_SPI_CONTROL_Msk)
+        {
+            case ARM_SPI_MODE_INACTIVE:
+                FXSPI_ReleaseCs(info);
+                FXSPI_Setup(info, 0U);
+                info->flags &= (uint8_t)~FXSPI_FLAG_CONFIGURED;
+                break;
+
+            case ARM_SPI_MODE_MASTER:
+                switch (control & ARM_SPI_FRAME_FORMAT_Msk)
+                {
+                    case ARM_SPI_CPOL0_CPHA0:
+                        break;
+
+                    case ARM_SPI_CPOL0_CPHA1:
+                        cpha = 1U;
+                        break;
+
+                    case ARM_SPI_CPOL1_CPHA0:
+                        cpol = 1U;
+                        break;
+
+                    case ARM_SPI_CPOL1_CPHA1:
+                        cpol = 1U;
+                        cpha = 1U;
+                        break;
+
+                    default:
+                        result = ARM_SPI_ERROR_FRAME_FORMAT;
+                        break;
+                }
+
+                /* DMA moves whole buffer bytes: 8, 16 and 32 bit frames only. */
+                dataBits = (control & ARM_SPI_DATA_BITS_Msk) >> ARM_SPI_DATA_BITS_Pos;
+                dataBits = (0U == dataBits) ? 8U : dataBits;
+                if ((8U != dataBits) && (16U != dataBits) && (32U != dataBits))
+                {
+                    result = ARM_SPI_ERROR_DATA_BITS;
+                }
+                else
+                {
+                    /* Stage the format, committed only if everything is valid. */
+                }
+
+                switch (control & ARM_SPI_SS_MASTER_MODE_Msk)
+                {
+                    case ARM_SPI_SS_MASTER_UNUSED:
+                        break;
+
+                    case ARM_SPI_SS_MASTER_HW_OUTPUT:
+                        csUsed = 1U;
+                        break;
+
+                    default:
+                        result = ARM_SPI_ERROR_SS_MODE;
+                        break;
+                }
+
+                if (ARM_DRIVER_OK == result)
+                {
+                    speed = FXSPI_SetSpeed(info, arg);
+
+                    if (0U != speed)
+                    {
+                        FXSPI_ReleaseCs(info);
+
+                        info->busSpeed   = speed;
+                        info->cpol       = cpol;
+                        info->cpha       = cpha;
+                        info->lsbFirst   = ((control & ARM_SPI_BIT_ORDER_Msk) == ARM_SPI_LSB_MSB) ? 1U : 0U;
+                        info->frameBytes = (uint8_t)(dataBits / 8U);
+                        info->csUsed     = csUsed;
+
+                        if (0U != csUsed)
+                        {
+                            HAL_GPIO_SetPinMux(info->res->csPort, info->res->csPortPin, 1U);
+                            HAL_GPIO_WritePin(info->res->csPort, info->res->csPortPin, 1U);
+                            HAL_GPIO_SetDirection(info->res->csPort, info->res->csPortPin, HAL_GPIO_DIR_OUTPUT);
+                        }
+                        else
+                        {
+                            /* Chip select handled by the application */
+                        }
+
+                        FXSPI_Setup(info, 1U);
+                        info->flags |= FXSPI_FLAG_CONFIGURED;
+                    }
+                    else
+                    {
+                        result = ARM_DRIVER_ERROR_PARAMETER;
+                    }
+                }
+                else
+                {
+                    /* Error already reported */
+                }
+                break;
+
+            case ARM_SPI_MODE_SLAVE:
+            case ARM_SPI_MODE_MASTER_SIMPLEX:
+            case ARM_SPI_MODE_SLAVE_SIMPLEX:
+                result = ARM_SPI_ERROR_MODE;
+                break;
+
+            case ARM_SPI_SET_BUS_SPEED:
+                speed = FXSPI_SetSpeed(info, arg);
+
+                if (0U != speed)
+                {
+                    info->busSpeed = speed;
+
+                    if (0U != (info->flags & FXSPI_FLAG_CONFIGURED))
+                    {
+                        FXSPI_Setup(info, 1U);
+                    }
+                    else
+                    {
+                        /* Applied by the next ARM_SPI_MODE_MASTER */
+                    }
+                }
+                else
+                {
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+                break;
+
+            case ARM_SPI_GET_BUS_SPEED:
+                result = (int32_t)info->busSpeed;
+                break;
+
+            case ARM_SPI_SET_DEFAULT_TX_VALUE:
+                info->defaultTx = arg;
+                break;
+
+            case ARM_SPI_ABORT_TRANSFER:
+                if (0U != info->status.busy)
+                {
+                    FXSPI_Abort(info);
+                }
+                else
+                {
+                    /* Nothing to abort */
+                }
+                break;
+
+            case SPI_CONTROL_CS_HOLD:
+                info->csHold = (0U != arg) ? 1U : 0U;
+                if (0U == info->csHold)
+                {
+                    FXSPI_ReleaseCs(info);
+                }
+                else
+                {
+                    /* Released by the first transfer after hold is cleared */
+                }
+                break;
+
+            default:
+                /* One chip select and DMA only: PCS and DMA threshold do not apply */
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+    }
+
+    return result;
+}
+
+static ARM_SPI_STATUS FXSPI_GetStatus(const FXSPI_Info_t *info)
+{
+    ARM_SPI_STATUS status;
+
+    status.busy       = info->status.busy;
+    status.data_lost  = info->status.data_lost;
+    status.mode_fault = 0U;
+    status.reserved   = 0U;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FXSPI_RxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    FXSPI_Info_t *info;
+
+    (void)channel;
+
+    info = (FXSPI_Info_t *)param;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        FXSPI_Abort(info);
+        info->status.data_lost = 1U;
+
+        if (NULL != info->cbEvent)
+        {
+            info->cbEvent(ARM_SPI_EVENT_DATA_LOST);
+        }
+        else
+        {
+            /* No callback registered */
+        }
+    }
+    else
+    {
+        info->rxCount += info->chunk;
+
+        if (info->rxCount < info->num)
+        {
+            FXSPI_StartDmaChunk(info);
+        }
+        else
+        {
+            FXSPI_Finish(info, ARM_SPI_EVENT_TRANSFER_COMPLETE);
+        }
+    }
+}
+
+static void FXSPI_RxCallback(uint8_t shifter, uint32_t status, void *param)
+{
+    FXSPI_Info_t *info;
+
+    (void)shifter;
+
+    info = (FXSPI_Info_t *)param;
+
+    if ((0U != (status & HAL_FLEXIO_STATUS_ERROR)) && (0U != info->status.busy))
+    {
+        info->status.data_lost = 1U;
+
+        if (NULL != info->cbEvent)
+        {
+            info->cbEvent(ARM_SPI_EVENT_DATA_LOST);
+        }
+        else
+        {
+            /* No callback registered */
+        }
+    }
+    else
+    {
+        /* Error outside a transfer is ignored */
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define FXSPI_INSTANCE(n)                                                                       \
+static int32_t SPI##n##_Initialize(ARM_SPI_SignalEvent_t cb_event)                              \
+{ return FXSPI_Initialize(cb_event, &s_spi##n##Res, &s_spi##n##Info); }                         \
+static int32_t SPI##n##_Uninitialize(void)                                                      \
+{ return FXSPI_Uninitialize(&s_spi##n##Info); }                                                 \
+static int32_t SPI##n##_PowerControl(ARM_POWER_STATE state)                                     \
+{ return FXSPI_PowerControl(state, &s_spi##n##Info); }                                          \
+static int32_t SPI##n##_Send(const void *data, uint32_t num)                                    \
+{ return (NULL == data) ? ARM_DRIVER_ERROR_PARAMETER :                                          \
+         FXSPI_StartTransfer(data, NULL, num, &s_spi##n##Info); }                               \
+static int32_t SPI##n##_Receive(void *data, uint32_t num)                                       \
+{ return (NULL == data) ? ARM_DRIVER_ERROR_PARAMETER :                                          \
+         FXSPI_StartTransfer(NULL, data, num, &s_spi##n##Info); }                               \
+static int32_t SPI##n##_Transfer(const void *data_out, void *data_in, uint32_t num)             \
+{ return ((NULL == data_out) || (NULL == data_in)) ? ARM_DRIVER_ERROR_PARAMETER :               \
+         FXSPI_StartTransfer(data_out, data_in, num, &s_spi##n##Info); }                        \
+static uint32_t SPI##n##_GetDataCount(void)                                                     \
+{ return FXSPI_GetDataCount(&s_spi##n##Info); }                                                 \
+static int32_t SPI##n##_Control(uint32_t control, uint32_t arg)                                 \
+{ return FXSPI_Control(control, arg, &s_spi##n##Info); }                                        \
+static ARM_SPI_STATUS SPI##n##_GetStatus(void)                                                  \
+{ return FXSPI_GetStatus(&s_spi##n##Info); }                                                    \
+ARM_DRIVER_SPI Driver_SPI##n =                                                                  \
+{                                                                                               \
+    FXSPI_GetVersion,                                                                           \
+    FXSPI_GetCapabilities,                                                                      \
+    SPI##n##_Initialize,                                                                        \
+    SPI##n##_Uninitialize,                                                                      \
+    SPI##n##_PowerControl,                                                                      \
+    SPI##n##_Send,                                                                              \
+    SPI##n##_Receive,                                                                           \
+    SPI##n##_Transfer,                                                                          \
+    SPI##n##_GetDataCount,                                                                      \
+    SPI##n##_Control,                                                                           \
+    SPI##n##_GetStatus,                                                                         \
+};
+
+FXSPI_INSTANCE(3)
@@ -0,0 +1,844 @@
+/*******************************************************************************
+ * @file    Driver_Storage_Host.c
+ * @brief   Host (POSIX) file backed CMSIS Storage driver C file.
+ *
+ * Synchronous operations return their result directly (positive on
+ * success, as the Storage API requires). Asynchronous ones are handed to
+ * a worker thread which waits the modeled time, applies the operation to
+ * the mapped file and calls the callback; one operation at a time.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#define _POSIX_C_SOURCE             200809L
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Driver_Storage_Host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_STORAGE_DRV_VERSION     ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define STORAGE_ERASED_VALUE        (0xFFU)
+
+/* Driver state flags */
+#define STORAGE_FLAG_CONFIGURED     (1U << 0)
+#define STORAGE_FLAG_INITIALIZED    (1U << 1)
+#define STORAGE_FLAG_POWERED        (1U << 2)
+
+/**
+ * @brief Run-time state.
+ */
+typedef struct
+{
+    STORAGE_HOST_Config_t       config;
+    ARM_Storage_Callback_t      callback;
+    ARM_STORAGE_STATUS          status;
+    uint8_t                     flags;
+    int                         fd;
+    uint8_t                     *memory;        /**< Mapped file */
+    uint32_t                    *programmed;    /**< One bit per program unit, cleared by erase */
+    STORAGE_HOST_Stats_t        stats;
+
+    /* Operation in progress, guarded by lock */
+    pthread_mutex_t             lock;
+    pthread_cond_t              wake;
+    pthread_t                   worker;
+    uint8_t                     pending;
+    uint8_t                     stop;
+    ARM_STORAGE_OPERATION       operation;
+    uint64_t                    addr;
+    const uint8_t               *data;
+    uint32_t                    size;
+} STORAGE_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION STORAGE_GetVersion(void);
+static ARM_STORAGE_CAPABILITIES STORAGE_GetCapabilities(void);
+
+static int32_t STORAGE_Initialize(ARM_Storage_Callback_t callback);
+static int32_t STORAGE_Uninitialize(void);
+static int32_t STORAGE_PowerControl(ARM_POWER_STATE state);
+static int32_t STORAGE_ReadData(uint64_t addr, void *data, uint32_t size);
+static int32_t STORAGE_ProgramData(uint64_t addr, const void *data, uint32_t size);
+static int32_t STORAGE_Erase(uint64_t addr, uint32_t size);
+static int32_t STORAGE_EraseAll(void);
+static ARM_STORAGE_STATUS STORAGE_GetStatus(void);
+static int32_t STORAGE_GetInfo(ARM_STORAGE_INFO *info);
+static uint32_t STORAGE_ResolveAddress(uint64_t addr);
+static int32_t STORAGE_GetNextBlock(const ARM_STORAGE_BLOCK *prev, ARM_STORAGE_BLOCK *next);
+static int32_t STORAGE_GetBlock(uint64_t addr, ARM_STORAGE_BLOCK *block);
+
+static uint8_t STORAGE_InRange(uint64_t addr, uint32_t size);
+static uint8_t STORAGE_IsErased(const uint8_t *memory, uint32_t size);
+static uint8_t STORAGE_IsProgrammed(uint64_t addr, uint32_t size);
+static void    STORAGE_MarkProgrammed(uint64_t addr, uint32_t size, uint8_t programmed);
+static int32_t STORAGE_Start(ARM_STORAGE_OPERATION operation, uint64_t addr, const uint8_t *data, uint32_t size);
+static int32_t STORAGE_Execute(void);
+static void    STORAGE_Delay(uint64_t us);
+static void   *STORAGE_Worker(void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_STORAGE_API_VERSION,
+    ARM_STORAGE_DRV_VERSION
+};
+
+static STORAGE_Info_t s_storageInfo =
+{
+    .fd   = -1,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wake = PTHREAD_COND_INITIALIZER
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t STORAGE_HOST_Configure(const STORAGE_HOST_Config_t *config)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U != (s_storageInfo.flags & STORAGE_FLAG_INITIALIZED))
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if ((NULL == config) || (NULL == config->path) || (0U == config->eraseUnit) ||
+             (0U == config->programUnit) || (0U != (config->eraseUnit % config->programUnit)) ||
+             (0U == config->size) || (0U != (config->size % config->eraseUnit)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        s_storageInfo.config = *config;
+        s_storageInfo.flags  = STORAGE_FLAG_CONFIGURED;
+    }
+
+    return result;
+}
+
+void STORAGE_HOST_GetStats(STORAGE_HOST_Stats_t *stats)
+{
+    if (NULL != stats)
+    {
+        (void)pthread_mutex_lock(&s_storageInfo.lock);
+        *stats = s_storageInfo.stats;
+        (void)pthread_mutex_unlock(&s_storageInfo.lock);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+static ARM_DRIVER_VERSION STORAGE_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_STORAGE_CAPABILITIES STORAGE_GetCapabilities(void)
+{
+    ARM_STORAGE_CAPABILITIES capabilities;
+
+    capabilities.asynchronous_ops = s_storageInfo.config.asynchronous;
+    capabilities.erase_all        = 1U;
+    capabilities.reserved         = 0U;
+
+    return capabilities;
+}
+
+static int32_t STORAGE_Initialize(ARM_Storage_Callback_t callback)
+{
+    int32_t result;
+    STORAGE_Info_t *info;
+    struct stat st;
+    uint64_t used;
+    uint32_t units;
+    uint32_t i;
+
+    result = 1;
+    info   = &s_storageInfo;
+
+    if (0U != (info->flags & STORAGE_FLAG_INITIALIZED))
+    {
+        /* Already initialized, do nothing */
+    }
+    else if (0U == (info->flags & STORAGE_FLAG_CONFIGURED))
+    {
+        /* STORAGE_HOST_Configure() first */
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        info->fd = open(info->config.path, O_RDWR | O_CREAT, 0644);
+        used     = ((info->fd >= 0) && (0 == fstat(info->fd, &st))) ? (uint64_t)st.st_size : 0U;
+
+        if ((info->fd < 0) || ((used < info->config.size) && (0 != ftruncate(info->fd, (off_t)info->config.size))))
+        {
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            units            = info->config.size / info->config.programUnit;
+            info->programmed = (uint32_t *)calloc((units + 31U) / 32U, sizeof(uint32_t));
+            info->memory     = (uint8_t *)mmap(NULL, info->config.size, PROT_READ | PROT_WRITE, MAP_SHARED, info->fd, 0);
+            result           = ((MAP_FAILED == (void *)info->memory) || (NULL == info->programmed)) ? ARM_DRIVER_ERROR : 1;
+
+            if ((1 != result) && (MAP_FAILED != (void *)info->memory))
+            {
+                (void)munmap(info->memory, info->config.size);
+            }
+            else
+            {
+                /* Mapped, or nothing to undo */
+            }
+        }
+
+        if (1 == result)
+        {
+            /* A new or grown file reads as erased flash. */
+            if (used < info->config.size)
+            {
+                (void)memset(&info->memory[used], STORAGE_ERASED_VALUE, (size_t)(info->config.size - used));
+            }
+            else
+            {
+                /* Contents kept */
+            }
+
+            /* Units kept from an earlier run count as programmed unless they read erased. */
+            for (i = 0U; i < units; i++)
+            {
+                if (0U == STORAGE_IsErased(&info->memory[(uint64_t)i * info->config.programUnit],
+                                           info->config.programUnit))
+                {
+                    info->programmed[i / 32U] |= 1UL << (i % 32U);
+                }
+                else
+                {
+                    /* Erased */
+                }
+            }
+
+            (void)memset(&info->stats, 0, sizeof(info->stats));
+            info->callback = callback;
+            info->pending  = 0U;
+            info->stop     = 0U;
+
+            if ((0U != info->config.asynchronous) && (0 != pthread_create(&info->worker, NULL, STORAGE_Worker, info)))
+            {
+                (void)munmap(info->memory, info->config.size);
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                info->flags |= STORAGE_FLAG_INITIALIZED;
+            }
+        }
+        else
+        {
+            /* File not usable */
+        }
+
+        if ((1 != result) && (info->fd >= 0))
+        {
+            (void)close(info->fd);
+            free(info->programmed);
+            info->programmed = NULL;
+            info->fd         = -1;
+        }
+        else
+        {
+            /* Kept open */
+        }
+    }
+
+    return result;
+}
+
+static int32_t STORAGE_Uninitialize(void)
+{
+    STORAGE_Info_t *info;
+
+    info = &s_storageInfo;
+
+    if (0U != (info->flags & STORAGE_FLAG_INITIALIZED))
+    {
+        /* Let a running operation finish, then end the worker. */
+        if (0U != info->config.asynchronous)
+        {
+            (void)pthread_mutex_lock(&info->lock);
+            info->stop = 1U;
+            (void)pthread_cond_broadcast(&info->wake);
+            (void)pthread_mutex_unlock(&info->lock);
+            (void)pthread_join(info->worker, NULL);
+        }
+        else
+        {
+            /* No worker */
+        }
+
+        (void)msync(info->memory, info->config.size, MS_SYNC);
+        (void)munmap(info->memory, info->config.size);
+        (void)close(info->fd);
+        free(info->programmed);
+
+        info->memory     = NULL;
+        info->programmed = NULL;
+        info->fd         = -1;
+        info->callback = NULL;
+        info->flags    = STORAGE_FLAG_CONFIGURED;
+    }
+    else
+    {
+        /* Not initialized, do nothing */
+    }
+
+    return 1;
+}
+
+static int32_t STORAGE_PowerControl(ARM_POWER_STATE state)
+{
+    int32_t result;
+    STORAGE_Info_t *info;
+
+    result = 1;
+    info   = &s_storageInfo;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            (void)pthread_mutex_lock(&info->lock);
+
+            if (0U != info->status.busy)
+            {
+                result = ARM_DRIVER_ERROR_BUSY;
+            }
+            else
+            {
+                info->flags &= (uint8_t)~STORAGE_FLAG_POWERED;
+            }
+
+            (void)pthread_mutex_unlock(&info->lock);
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & STORAGE_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                info->status.busy  = 0U;
+                info->status.error = 0U;
+                info->flags       |= STORAGE_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+static uint8_t STORAGE_InRange(uint64_t addr, uint32_t size)
+{
+    return ((addr <= s_storageInfo.config.size) && (size <= (s_storageInfo.config.size - addr))) ? 1U : 0U;
+}
+
+static uint8_t STORAGE_IsErased(const uint8_t *memory, uint32_t size)
+{
+    uint32_t i;
+    uint8_t erased;
+
+    erased = 1U;
+
+    for (i = 0U; i < size; i++)
+    {
+        erased = (STORAGE_ERASED_VALUE == memory[i]) ? erased : 0U;
+    }
+
+    return erased;
+}
+
+static uint8_t STORAGE_IsProgrammed(uint64_t addr, uint32_t size)
+{
+    uint32_t unit;
+    uint32_t last;
+    uint8_t programmed;
+
+    programmed = 0U;
+    last       = (uint32_t)((addr + size) / s_storageInfo.config.programUnit);
+
+    for (unit = (uint32_t)(addr / s_storageInfo.config.programUnit); unit < last; unit++)
+    {
+        programmed |= (0U != (s_storageInfo.programmed[unit / 32U] & (1UL << (unit % 32U)))) ? 1U : 0U;
+    }
+
+    return programmed;
+}
+
+static void STORAGE_MarkProgrammed(uint64_t addr, uint32_t size, uint8_t programmed)
+{
+    uint32_t unit;
+    uint32_t last;
+
+    last = (uint32_t)((addr + size) / s_storageInfo.config.programUnit);
+
+    for (unit = (uint32_t)(addr / s_storageInfo.config.programUnit); unit < last; unit++)
+    {
+        if (0U != programmed)
+        {
+            s_storageInfo.programmed[unit / 32U] |= 1UL << (unit % 32U);
+        }
+        else
+        {
+            s_storageInfo.programmed[unit / 32U] &= ~(1UL << (unit % 32U));
+        }
+    }
+}
+
+static int32_t STORAGE_ReadData(uint64_t addr, void *data, uint32_t size)
+{
+    int32_t result;
+
+    if (0U == (s_storageInfo.flags & STORAGE_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((NULL == data) || (0U == STORAGE_InRange(addr, size)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        /* The worker applies an operation under the lock, never during the copy */
+        (void)pthread_mutex_lock(&s_storageInfo.lock);
+
+        if (0U != s_storageInfo.status.busy)
+        {
+            /* Read collision on the target */
+            s_storageInfo.stats.rejected++;
+            result = ARM_DRIVER_ERROR_BUSY;
+        }
+        else
+        {
+            /* Reads complete at once */
+            (void)memcpy(data, &s_storageInfo.memory[addr], size);
+            s_storageInfo.stats.bytesRead += size;
+            result = (int32_t)size;
+        }
+
+        (void)pthread_mutex_unlock(&s_storageInfo.lock);
+    }
+
+    return result;
+}
+
+static int32_t STORAGE_ProgramData(uint64_t addr, const void *data, uint32_t size)
+{
+    int32_t result;
+    uint32_t unit;
+
+    unit = s_storageInfo.config.programUnit;
+
+    if (0U == (s_storageInfo.flags & STORAGE_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((NULL == data) || (0U == size) || (0U == STORAGE_InRange(addr, size)) ||
+             (0U != (addr % unit)) || (0U != (size % unit)))
+    {
+        s_storageInfo.stats.rejected++;
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        /* Busy and programmed units are checked by STORAGE_Start(), under the lock */
+        result = STORAGE_Start(ARM_STORAGE_OPERATION_PROGRAM_DATA, addr, (const uint8_t *)data, size);
+    }
+
+    return result;
+}
+
+static int32_t STORAGE_Erase(uint64_t addr, uint32_t size)
+{
+    int32_t result;
+    uint32_t unit;
+
+    unit = s_storageInfo.config.eraseUnit;
+
+    if (0U == (s_storageInfo.flags & STORAGE_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((0U == size) || (0U == STORAGE_InRange(addr, size)) || (0U != (addr % unit)) || (0U != (size % unit)))
+    {
+        s_storageInfo.stats.rejected++;
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = STORAGE_Start(ARM_STORAGE_OPERATION_ERASE, addr, NULL, size);
+    }
+
+    return result;
+}
+
+static int32_t STORAGE_EraseAll(void)
+{
+    int32_t result;
+
+    if (0U == (s_storageInfo.flags & STORAGE_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        result = STORAGE_Start(ARM_STORAGE_OPERATION_ERASE_ALL, 0U, NULL, s_storageInfo.config.size);
+
+        /* Synchronous completion of EraseAll is reported as 1 */
+        result = ((0U == s_storageInfo.config.asynchronous) && (result >= 0)) ? 1 : result;
+    }
+
+    return result;
+}
+
+static ARM_STORAGE_STATUS STORAGE_GetStatus(void)
+{
+    ARM_STORAGE_STATUS status;
+
+    (void)pthread_mutex_lock(&s_storageInfo.lock);
+    status.busy     = s_storageInfo.status.busy;
+    status.error    = s_storageInfo.status.error;
+    status.reserved = 0U;
+    (void)pthread_mutex_unlock(&s_storageInfo.lock);
+
+    return status;
+}
+
+static int32_t STORAGE_GetInfo(ARM_STORAGE_INFO *info)
+{
+    int32_t result;
+
+    if (NULL == info)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        (void)memset(info, 0, sizeof(*info));
+
+        info->total_storage        = s_storageInfo.config.size;
+        info->program_unit         = s_storageInfo.config.programUnit;
+        info->optimal_program_unit = s_storageInfo.config.programUnit;
+        info->program_cycles       = ARM_STORAGE_PROGRAM_CYCLES_INFINITE;
+        info->erased_value         = 1U;
+        info->memory_mapped        = 0U;    /* Host pointers do not fit ResolveAddress() */
+        info->programmability      = ARM_STORAGE_PROGRAMMABILITY_ERASABLE;
+        info->retention_level      = ARM_RETENTION_NVM;
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+static uint32_t STORAGE_ResolveAddress(uint64_t addr)
+{
+    (void)addr;
+
+    return ARM_STORAGE_INVALID_ADDRESS;
+}
+
+static int32_t STORAGE_GetBlock(uint64_t addr, ARM_STORAGE_BLOCK *block)
+{
+    int32_t result;
+
+    if (NULL == block)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (addr >= s_storageInfo.config.size)
+    {
+        block->addr = ARM_STORAGE_INVALID_OFFSET;
+        block->size = 0U;
+        result      = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        /* A single uniform block */
+        (void)memset(block, 0, sizeof(*block));
+
+        block->addr                       = 0U;
+        block->size                       = s_storageInfo.config.size;
+        block->attributes.erasable        = 1U;
+        block->attributes.programmable    = 1U;
+        block->attributes.erase_unit      = s_storageInfo.config.eraseUnit;
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+static int32_t STORAGE_GetNextBlock(const ARM_STORAGE_BLOCK *prev, ARM_STORAGE_BLOCK *next)
+{
+    int32_t result;
+
+    if (NULL == next)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (NULL == prev)
+    {
+        result = STORAGE_GetBlock(0U, next);
+    }
+    else
+    {
+        /* No block after the only one */
+        next->addr = ARM_STORAGE_INVALID_OFFSET;
+        next->size = 0U;
+        result     = ARM_DRIVER_ERROR;
+    }
+
+    return result;
+}
+
+static int32_t STORAGE_Start(ARM_STORAGE_OPERATION operation, uint64_t addr, const uint8_t *data, uint32_t size)
+{
+    int32_t result;
+    STORAGE_Info_t *info;
+
+    info = &s_storageInfo;
+
+    /* Checked and taken in one step: of two callers, only one sees the driver idle. */
+    (void)pthread_mutex_lock(&info->lock);
+
+    if (0U != info->status.busy)
+    {
+        info->stats.rejected++;
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else if ((ARM_STORAGE_OPERATION_PROGRAM_DATA == operation) && (0U != STORAGE_IsProgrammed(addr, size)))
+    {
+        /* Like the FTFC: a program unit is programmed once between erases, even with 0xFF data. */
+        info->stats.rejected++;
+        result = ARM_STORAGE_ERROR_NOT_PROGRAMMABLE;
+    }
+    else
+    {
+        info->operation    = operation;
+        info->addr         = addr;
+        info->data         = data;
+        info->size         = size;
+        info->status.busy  = 1U;
+        info->status.error = 0U;
+
+        if (0U != info->config.asynchronous)
+        {
+            info->pending = 1U;
+            (void)pthread_cond_signal(&info->wake);
+        }
+        else
+        {
+            /* Executed below, by the caller */
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    (void)pthread_mutex_unlock(&info->lock);
+
+    if ((ARM_DRIVER_OK == result) && (0U == info->config.asynchronous))
+    {
+        result = STORAGE_Execute();
+
+        (void)pthread_mutex_lock(&info->lock);
+        info->status.busy  = 0U;
+        info->status.error = (result < 0) ? 1U : 0U;
+        (void)pthread_mutex_unlock(&info->lock);
+    }
+    else
+    {
+        /* Refused, or completes in the worker */
+    }
+
+    return result;
+}
+
+static void STORAGE_Delay(uint64_t us)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = (time_t)(us / 1000000U);
+    ts.tv_nsec = (long)((us % 1000000U) * 1000U);
+
+    while (0 != nanosleep(&ts, &ts))
+    {
+        /* Interrupted by a signal: sleep the rest */
+    }
+}
+
+static int32_t STORAGE_Execute(void)
+{
+    STORAGE_Info_t *info;
+    ARM_STORAGE_OPERATION operation;
+    uint64_t addr;
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t units;
+    uint64_t us;
+
+    info = &s_storageInfo;
+
+    /* The operation as started, nothing of it is read outside the lock */
+    (void)pthread_mutex_lock(&info->lock);
+    operation = info->operation;
+    addr      = info->addr;
+    data      = info->data;
+    size      = info->size;
+    (void)pthread_mutex_unlock(&info->lock);
+
+    if (ARM_STORAGE_OPERATION_PROGRAM_DATA == operation)
+    {
+        units = size / info->config.programUnit;
+        us    = (uint64_t)units * info->config.programTimeUs;
+    }
+    else
+    {
+        units = size / info->config.eraseUnit;
+        us    = (uint64_t)units * info->config.eraseTimeUs;
+    }
+
+    if (0U != info->config.delay)
+    {
+        STORAGE_Delay(us);
+    }
+    else
+    {
+        /* Modeled only */
+    }
+
+    (void)pthread_mutex_lock(&info->lock);
+
+    if (ARM_STORAGE_OPERATION_PROGRAM_DATA == operation)
+    {
+        (void)memcpy(&info->memory[addr], data, size);
+        STORAGE_MarkProgrammed(addr, size, 1U);
+        info->stats.bytesProgrammed += size;
+        info->stats.programUnits    += units;
+    }
+    else
+    {
+        (void)memset(&info->memory[addr], STORAGE_ERASED_VALUE, size);
+        STORAGE_MarkProgrammed(addr, size, 0U);
+        info->stats.eraseUnits += units;
+    }
+
+    info->stats.busyTimeUs += us;
+
+    (void)pthread_mutex_unlock(&info->lock);
+
+    return (ARM_STORAGE_OPERATION_ERASE_ALL == operation) ? ARM_DRIVER_OK : (int32_t)size;
+}
+
+/*******************************************************************************
+ * Worker thread
+ ******************************************************************************/
+
+static void *STORAGE_Worker(void *param)
+{
+    STORAGE_Info_t *info;
+    ARM_STORAGE_OPERATION operation;
+    int32_t status;
+
+    info = (STORAGE_Info_t *)param;
+
+    (void)pthread_mutex_lock(&info->lock);
+
+    while (0U == info->stop)
+    {
+        if (0U == info->pending)
+        {
+            (void)pthread_cond_wait(&info->wake, &info->lock);
+        }
+        else
+        {
+            (void)pthread_mutex_unlock(&info->lock);
+            status = STORAGE_Execute();
+            (void)pthread_mutex_lock(&info->lock);
+
+            operation          = info->operation;
+            info->pending      = 0U;
+            info->status.busy  = 0U;
+            info->status.error = (status < 0) ? 1U : 0U;
+
+            /* Callback outside the lock: it may start the next operation. */
+            if (NULL != info->callback)
+            {
+                (void)pthread_mutex_unlock(&info->lock);
+                info->callback(status, operation);
+                (void)pthread_mutex_lock(&info->lock);
+            }
+            else
+            {
+                /* Polled with GetStatus() */
+            }
+        }
+    }
+
+    (void)pthread_mutex_unlock(&info->lock);
+
+    return NULL;
+}
+
+/*******************************************************************************
+ * Driver table
+ ******************************************************************************/
+
+ARM_DRIVER_STORAGE Driver_Storage0 =
+{
+    STORAGE_GetVersion,
+    STORAGE_GetCapabilities,
+    STORAGE_Initialize,
+    STORAGE_Uninitialize,
+    STORAGE_PowerControl,
+    STORAGE_ReadData,
+    STORAGE_ProgramData,
+    STORAGE_Erase,
+    STORAGE_EraseAll,
+    STORAGE_GetStatus,
+    STORAGE_GetInfo,
+    STORAGE_ResolveAddress,
+    STORAGE_GetNextBlock,
+    STORAGE_GetBlock
+};
+
+#endif /* __unix__ || __APPLE__ */
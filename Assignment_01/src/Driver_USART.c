@@ -0,0 +1,910 @@
+/*******************************************************************************
+ * @file    Driver_USART.c
+ * @brief   CMSIS USART driver for the S32K144 LPUART C file.
+ *
+ * Send and Receive are served by eDMA, the CPU only takes one interrupt per
+ * transfer (or per buffer half in circular mode) and one per idle line, so
+ * the interrupt load does not depend on the byte rate.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "Driver_USART_S32K144.h"
+#include "HAL_LPUART.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_USART_DRV_VERSION       ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define USART_DMA_MAX_COUNT         (32767UL)   /**< CITER is 15 bits wide */
+#define USART_DEFAULT_IDLE_CHARS    (2U)
+#define USART_IRQ_PRIORITY          (4U)
+
+/* Driver state flags */
+#define USART_FLAG_INITIALIZED      (1U << 0)
+#define USART_FLAG_POWERED          (1U << 1)
+#define USART_FLAG_CONFIGURED       (1U << 2)
+#define USART_FLAG_RX_CIRCULAR      (1U << 3)
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    HAL_LPUART_Instance_t   instance;
+    IRQn_Type               irq;
+    dma_request_source_t    txRequest;
+    dma_request_source_t    rxRequest;
+    uint8_t                 rxPort;
+    uint8_t                 rxPin;
+    uint8_t                 txPort;
+    uint8_t                 txPin;
+    uint8_t                 pinMux;
+} USART_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const USART_Resources_t *res;
+    ARM_USART_SignalEvent_t cbEvent;
+    volatile ARM_USART_STATUS status;
+    uint8_t                 flags;
+    uint8_t                 txChannel;
+    uint8_t                 rxChannel;
+    uint8_t                 idleChars;
+
+    const uint8_t           *txData;
+    uint32_t                txNum;
+    uint32_t                txDone;         /**< Bytes of finished DMA chunks */
+    uint16_t                txChunk;
+
+    uint8_t                 *rxData;
+    uint32_t                rxNum;
+    uint32_t                rxDone;         /**< Bytes of finished DMA chunks */
+    uint16_t                rxChunk;
+    volatile uint32_t       rxHalves;       /**< Circular mode: serviced half-buffer events */
+} USART_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION USART_GetVersion(void);
+static ARM_USART_CAPABILITIES USART_GetCapabilities(void);
+
+static int32_t  USART_Initialize(ARM_USART_SignalEvent_t cb_event, const USART_Resources_t *res, USART_Info_t *info);
+static int32_t  USART_Uninitialize(const USART_Resources_t *res, USART_Info_t *info);
+static int32_t  USART_PowerControl(ARM_POWER_STATE state, const USART_Resources_t *res, USART_Info_t *info);
+static int32_t  USART_Send(const void *data, uint32_t num, const USART_Resources_t *res, USART_Info_t *info);
+static int32_t  USART_Receive(void *data, uint32_t num, const USART_Resources_t *res, USART_Info_t *info);
+static uint32_t USART_GetTxCount(const USART_Info_t *info);
+static uint32_t USART_GetRxCount(const USART_Info_t *info);
+static int32_t  USART_Control(uint32_t control, uint32_t arg, const USART_Resources_t *res, USART_Info_t *info);
+static ARM_USART_STATUS USART_GetStatus(const USART_Info_t *info);
+
+static void USART_StartTxChunk(const USART_Resources_t *res, USART_Info_t *info);
+static void USART_StartRxChunk(const USART_Resources_t *res, USART_Info_t *info);
+static void USART_TxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void USART_RxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void USART_IRQHandler(const USART_Resources_t *res, USART_Info_t *info);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_USART_API_VERSION,
+    ARM_USART_DRV_VERSION
+};
+
+static const ARM_USART_CAPABILITIES s_driverCapabilities =
+{
+    1, /* supports UART (Asynchronous) mode */
+    0, /* supports Synchronous Master mode */
+    0, /* supports Synchronous Slave mode */
+    0, /* supports UART Single-wire mode */
+    0, /* supports UART IrDA mode */
+    0, /* supports UART Smart Card mode */
+    0, /* Smart Card Clock generator available */
+    0, /* RTS Flow Control available */
+    0, /* CTS Flow Control available */
+    1, /* Transmit completed event: ARM_USART_EVENT_TX_COMPLETE */
+    1, /* Signal receive character timeout event: ARM_USART_EVENT_RX_TIMEOUT */
+    0, /* RTS Line: 0=not available, 1=available */
+    0, /* CTS Line: 0=not available, 1=available */
+    0, /* DTR Line: 0=not available, 1=available */
+    0, /* DSR Line: 0=not available, 1=available */
+    0, /* DCD Line: 0=not available, 1=available */
+    0, /* RI Line: 0=not available, 1=available */
+    0, /* Signal CTS change event: ARM_USART_EVENT_CTS */
+    0, /* Signal DSR change event: ARM_USART_EVENT_DSR */
+    0, /* Signal DCD change event: ARM_USART_EVENT_DCD */
+    0, /* Signal RI change event: ARM_USART_EVENT_RI */
+    0  /* Reserved (must be zero) */
+};
+
+/* LPUART0: PTB0 RX / PTB1 TX, LPUART1: PTC6 RX / PTC7 TX (OpenSDA), LPUART2: PTD6 RX / PTD7 TX. */
+static const USART_Resources_t s_usart0Res =
+{
+    HAL_LPUART_0, LPUART0_RxTx_IRQn, EDMA_REQ_LPUART0_TX, EDMA_REQ_LPUART0_RX,
+    HAL_GPIO_PORT_B, 0U, HAL_GPIO_PORT_B, 1U, 2U
+};
+
+static const USART_Resources_t s_usart1Res =
+{
+    HAL_LPUART_1, LPUART1_RxTx_IRQn, EDMA_REQ_LPUART1_TX, EDMA_REQ_LPUART1_RX,
+    HAL_GPIO_PORT_C, 6U, HAL_GPIO_PORT_C, 7U, 2U
+};
+
+static const USART_Resources_t s_usart2Res =
+{
+    HAL_LPUART_2, LPUART2_RxTx_IRQn, EDMA_REQ_LPUART2_TX, EDMA_REQ_LPUART2_RX,
+    HAL_GPIO_PORT_D, 6U, HAL_GPIO_PORT_D, 7U, 2U
+};
+
+static USART_Info_t s_usart0Info;
+static USART_Info_t s_usart1Info;
+static USART_Info_t s_usart2Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION USART_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_USART_CAPABILITIES USART_GetCapabilities(void)
+{
+    return s_driverCapabilities;
+}
+
+static int32_t USART_Initialize(ARM_USART_SignalEvent_t cb_event, const USART_Resources_t *res, USART_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & USART_FLAG_INITIALIZED))
+    {
+        HAL_DMA_Init();
+
+        info->txChannel = HAL_DMA_AllocChannel();
+        info->rxChannel = HAL_DMA_AllocChannel();
+
+        if ((HAL_DMA_CHANNEL_INVALID == info->txChannel) || (HAL_DMA_CHANNEL_INVALID == info->rxChannel))
+        {
+            HAL_DMA_FreeChannel(info->txChannel);
+            HAL_DMA_FreeChannel(info->rxChannel);
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            HAL_GPIO_SetPinMux(res->rxPort, res->rxPin, res->pinMux);
+            HAL_GPIO_SetPinMux(res->txPort, res->txPin, res->pinMux);
+
+            info->res       = res;
+            info->cbEvent   = cb_event;
+            info->idleChars = USART_DEFAULT_IDLE_CHARS;
+            info->flags     = USART_FLAG_INITIALIZED;
+        }
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return result;
+}
+
+static int32_t USART_Uninitialize(const USART_Resources_t *res, USART_Info_t *info)
+{
+    (void)USART_PowerControl(ARM_POWER_OFF, res, info);
+
+    if (0U != (info->flags & USART_FLAG_INITIALIZED))
+    {
+        HAL_DMA_FreeChannel(info->txChannel);
+        HAL_DMA_FreeChannel(info->rxChannel);
+    }
+    else
+    {
+        /* Not initialized, do nothing */
+    }
+
+    info->flags   = 0U;
+    info->cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t USART_PowerControl(ARM_POWER_STATE state, const USART_Resources_t *res, USART_Info_t *info)
+{
+    int32_t result;
+    HAL_DMA_Transfer_t transfer;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != (info->flags & USART_FLAG_POWERED))
+            {
+                HAL_NVIC_DisableIRQ(res->irq);
+                HAL_DMA_DisableRequest(info->txChannel);
+                HAL_DMA_DisableRequest(info->rxChannel);
+                HAL_LPUART_Deinit(res->instance);
+            }
+            else
+            {
+                /* Already off */
+            }
+
+            info->status.tx_busy = 0U;
+            info->status.rx_busy = 0U;
+            info->flags &= (uint8_t)~(USART_FLAG_POWERED | USART_FLAG_CONFIGURED | USART_FLAG_RX_CIRCULAR);
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & USART_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & USART_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                HAL_LPUART_Init(res->instance);
+                HAL_LPUART_EnableErrorInterrupts(res->instance, 1U);
+                HAL_LPUART_SetIdleInterrupt(res->instance, info->idleChars);
+
+                /* TX: memory (byte, incrementing) -> DATA. Address / count set per Send. */
+                transfer.srcAddr    = 0U;
+                transfer.dstAddr    = HAL_LPUART_GetDataAddress(res->instance);
+                transfer.srcOffset  = 1;
+                transfer.dstOffset  = 0;
+                transfer.srcSize    = HAL_DMA_SIZE_8BIT;
+                transfer.dstSize    = HAL_DMA_SIZE_8BIT;
+                transfer.minorBytes = 1U;
+                transfer.majorCount = 1U;
+                transfer.srcLastAdj = 0;
+                transfer.dstLastAdj = 0;
+                transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+                HAL_DMA_ConfigTransfer(info->txChannel, &transfer);
+                HAL_DMA_SetRequestSource(info->txChannel, res->txRequest);
+                HAL_DMA_RegisterCallback(info->txChannel, USART_TxDmaCallback, (void *)info);
+
+                HAL_DMA_SetRequestSource(info->rxChannel, res->rxRequest);
+                HAL_DMA_RegisterCallback(info->rxChannel, USART_RxDmaCallback, (void *)info);
+
+                HAL_LPUART_EnableTxDma(res->instance, 1U);
+                HAL_LPUART_EnableRxDma(res->instance, 1U);
+
+                info->status.tx_busy          = 0U;
+                info->status.rx_busy          = 0U;
+                info->status.rx_overflow      = 0U;
+                info->status.rx_framing_error = 0U;
+                info->status.rx_parity_error  = 0U;
+
+                HAL_NVIC_SetPriority(res->irq, USART_IRQ_PRIORITY);
+                HAL_NVIC_ClearPendingIRQ(res->irq);
+                HAL_NVIC_EnableIRQ(res->irq);
+
+                info->flags |= USART_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+static void USART_StartTxChunk(const USART_Resources_t *res, USART_Info_t *info)
+{
+    uint32_t remaining;
+
+    remaining     = info->txNum - info->txDone;
+    info->txChunk = (uint16_t)((remaining > USART_DMA_MAX_COUNT) ? USART_DMA_MAX_COUNT : remaining);
+
+    HAL_DMA_Reload(info->txChannel, (uint32_t)&info->txData[info->txDone],
+                   HAL_LPUART_GetDataAddress(res->instance), info->txChunk);
+    HAL_DMA_EnableRequest(info->txChannel);
+}
+
+static int32_t USART_Send(const void *data, uint32_t num, const USART_Resources_t *res, USART_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == data) || (0U == num))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == (info->flags & USART_FLAG_CONFIGURED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.tx_busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.tx_busy = 1U;
+        info->txData = (const uint8_t *)data;
+        info->txNum  = num;
+        info->txDone = 0U;
+
+        USART_StartTxChunk(res, info);
+    }
+
+    return result;
+}
+
+static void USART_StartRxChunk(const USART_Resources_t *res, USART_Info_t *info)
+{
+    HAL_DMA_Transfer_t transfer;
+    uint32_t remaining;
+
+    remaining     = info->rxNum - info->rxDone;
+    info->rxChunk = (uint16_t)((remaining > USART_DMA_MAX_COUNT) ? USART_DMA_MAX_COUNT : remaining);
+
+    transfer.srcAddr    = HAL_LPUART_GetDataAddress(res->instance);
+    transfer.dstAddr    = (uint32_t)&info->rxData[info->rxDone];
+    transfer.srcOffset  = 0;
+    transfer.dstOffset  = 1;
+    transfer.srcSize    = HAL_DMA_SIZE_8BIT;
+    transfer.dstSize    = HAL_DMA_SIZE_8BIT;
+    transfer.minorBytes = 1U;
+    transfer.majorCount = info->rxChunk;
+    transfer.srcLastAdj = 0;
+
+    if (0U != (info->flags & USART_FLAG_RX_CIRCULAR))
+    {
+        /* Wrap back to the buffer start forever, notify at half and end. */
+        transfer.dstLastAdj = -(int32_t)info->rxChunk;
+        transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_INT_HALF;
+    }
+    else
+    {
+        transfer.dstLastAdj = 0;
+        transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+    }
+
+    HAL_DMA_ConfigTransfer(info->rxChannel, &transfer);
+    HAL_DMA_EnableRequest(info->rxChannel);
+}
+
+static int32_t USART_Receive(void *data, uint32_t num, const USART_Resources_t *res, USART_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == data) || (0U == num))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U != (info->flags & USART_FLAG_RX_CIRCULAR)) && ((num < 2U) || (num > USART_DMA_MAX_COUNT)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == (info->flags & USART_FLAG_CONFIGURED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.rx_busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.rx_busy          = 1U;
+        info->status.rx_overflow      = 0U;
+        info->status.rx_framing_error = 0U;
+        info->status.rx_parity_error  = 0U;
+
+        info->rxData   = (uint8_t *)data;
+        info->rxNum    = num;
+        info->rxDone   = 0U;
+        info->rxHalves = 0U;
+
+        USART_StartRxChunk(res, info);
+    }
+
+    return result;
+}
+
+static uint32_t USART_GetTxCount(const USART_Info_t *info)
+{
+    uint32_t count;
+
+    count = info->txDone;
+
+    if (0U != info->status.tx_busy)
+    {
+        count += (uint32_t)info->txChunk - HAL_DMA_GetRemaining(info->txChannel);
+    }
+    else
+    {
+        /* Transfer finished, txDone is final */
+    }
+
+    return count;
+}
+
+static uint32_t USART_GetRxCount(const USART_Info_t *info)
+{
+    uint32_t count;
+    uint32_t halves;
+    uint16_t remaining;
+    uint8_t  pendingBefore;
+    uint8_t  pendingAfter;
+
+    if (0U != (info->flags & USART_FLAG_RX_CIRCULAR))
+    {
+        /*
+         * Free-running count = completed laps * size + position in the lap.
+         * A wrap that the ISR has not serviced yet is visible as a pending
+         * channel interrupt; retry if the snapshot was torn by the ISR or DMA.
+         */
+        do
+        {
+            halves        = info->rxHalves;
+            pendingBefore = HAL_DMA_IsIntPending(info->rxChannel);
+            remaining     = HAL_DMA_GetRemaining(info->rxChannel);
+            pendingAfter  = HAL_DMA_IsIntPending(info->rxChannel);
+        } while ((halves != info->rxHalves) || (pendingBefore != pendingAfter));
+
+        halves += pendingAfter;
+        count = ((halves / 2U) * info->rxNum) + (info->rxNum - remaining);
+    }
+    else
+    {
+        count = info->rxDone;
+
+        if (0U != info->status.rx_busy)
+        {
+            count += (uint32_t)info->rxChunk - HAL_DMA_GetRemaining(info->rxChannel);
+        }
+        else
+        {
+            /* Transfer finished, rxDone is final */
+        }
+    }
+
+    return count;
+}
+
+static int32_t USART_Control(uint32_t control, uint32_t arg, const USART_Resources_t *res, USART_Info_t *info)
+{
+    int32_t result;
+    uint8_t dataBits;
+    uint8_t stopBits;
+    HAL_LPUART_Parity_t parity;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & USART_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        switch (control & ARM_USART_CONTROL_Msk)
+        {
+            case ARM_USART_MODE_ASYNCHRONOUS:
+                /* DMA moves bytes, so only 7 and 8 data bits are served. */
+                switch (control & ARM_USART_DATA_BITS_Msk)
+                {
+                    case ARM_USART_DATA_BITS_7:
+                        dataBits = 7U;
+                        break;
+
+                    case ARM_USART_DATA_BITS_8:
+                        dataBits = 8U;
+                        break;
+
+                    default:
+                        dataBits = 0U;
+                        result = ARM_USART_ERROR_DATA_BITS;
+                        break;
+                }
+
+                switch (control & ARM_USART_PARITY_Msk)
+                {
+                    case ARM_USART_PARITY_NONE:
+                        parity = HAL_LPUART_PARITY_NONE;
+                        break;
+
+                    case ARM_USART_PARITY_EVEN:
+                        parity = HAL_LPUART_PARITY_EVEN;
+                        break;
+
+                    case ARM_USART_PARITY_ODD:
+                        parity = HAL_LPUART_PARITY_ODD;
+                        break;
+
+                    default:
+                        parity = HAL_LPUART_PARITY_NONE;
+                        result = ARM_USART_ERROR_PARITY;
+                        break;
+                }
+
+                switch (control & ARM_USART_STOP_BITS_Msk)
+                {
+                    case ARM_USART_STOP_BITS_1:
+                        stopBits = 1U;
+                        break;
+
+                    case ARM_USART_STOP_BITS_2:
+                        stopBits = 2U;
+                        break;
+
+                    default:
+                        stopBits = 0U;
+                        result = ARM_USART_ERROR_STOP_BITS;
+                        break;
+                }
+
+                if (ARM_USART_FLOW_CONTROL_NONE != (control & ARM_USART_FLOW_CONTROL_Msk))
+                {
+                    result = ARM_USART_ERROR_FLOW_CONTROL;
+                }
+                else if ((0U != info->status.tx_busy) || (0U != info->status.rx_busy))
+                {
+                    result = ARM_DRIVER_ERROR_BUSY;
+                }
+                else if (ARM_DRIVER_OK == result)
+                {
+                    if (0U != HAL_LPUART_SetBaudRate(res->instance, arg))
+                    {
+                        HAL_LPUART_SetFormat(res->instance, dataBits, parity, stopBits);
+                        info->flags |= USART_FLAG_CONFIGURED;
+                    }
+                    else
+                    {
+                        result = ARM_USART_ERROR_BAUDRATE;
+                    }
+                }
+                else
+                {
+                    /* Format error already reported */
+                }
+                break;
+
+            case ARM_USART_CONTROL_TX:
+                HAL_LPUART_EnableTx(res->instance, (0U != arg) ? 1U : 0U);
+                break;
+
+            case ARM_USART_CONTROL_RX:
+                HAL_LPUART_EnableRx(res->instance, (0U != arg) ? 1U : 0U);
+                break;
+
+            case ARM_USART_CONTROL_BREAK:
+                HAL_LPUART_SetBreak(res->instance, (0U != arg) ? 1U : 0U);
+                break;
+
+            case ARM_USART_ABORT_SEND:
+                HAL_DMA_DisableRequest(info->txChannel);
+                HAL_LPUART_EnableTcInterrupt(res->instance, 0U);
+                info->txDone = USART_GetTxCount(info);
+                info->txNum  = info->txDone;
+                info->status.tx_busy = 0U;
+                break;
+
+            case ARM_USART_ABORT_RECEIVE:
+                HAL_DMA_DisableRequest(info->rxChannel);
+                if (0U == (info->flags & USART_FLAG_RX_CIRCULAR))
+                {
+                    info->rxDone = USART_GetRxCount(info);
+                }
+                else
+                {
+                    /* Circular buffer keeps its free-running count */
+                }
+                info->status.rx_busy = 0U;
+                break;
+
+            case USART_CONTROL_RX_CIRCULAR:
+                if (0U != info->status.rx_busy)
+                {
+                    result = ARM_DRIVER_ERROR_BUSY;
+                }
+                else if (0U != arg)
+                {
+                    info->flags |= USART_FLAG_RX_CIRCULAR;
+                }
+                else
+                {
+                    info->flags &= (uint8_t)~USART_FLAG_RX_CIRCULAR;
+                }
+                break;
+
+            case USART_CONTROL_IDLE_CHARS:
+                if ((0U == arg) || (arg > 128U))
+                {
+                    result = ARM_DRIVER_ERROR_PARAMETER;
+                }
+                else
+                {
+                    info->idleChars = (uint8_t)arg;
+                    HAL_LPUART_SetIdleInterrupt(res->instance, info->idleChars);
+                }
+                break;
+
+            case USART_CONTROL_LOOPBACK:
+                HAL_LPUART_SetLoopback(res->instance, (0U != arg) ? 1U : 0U);
+                break;
+
+            case ARM_USART_MODE_SYNCHRONOUS_MASTER:
+            case ARM_USART_MODE_SYNCHRONOUS_SLAVE:
+            case ARM_USART_MODE_SINGLE_WIRE:
+            case ARM_USART_MODE_IRDA:
+            case ARM_USART_MODE_SMART_CARD:
+                result = ARM_USART_ERROR_MODE;
+                break;
+
+            default:
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+    }
+
+    return result;
+}
+
+static ARM_USART_STATUS USART_GetStatus(const USART_Info_t *info)
+{
+    ARM_USART_STATUS status;
+
+    status.tx_busy          = info->status.tx_busy;
+    status.rx_busy          = info->status.rx_busy;
+    status.tx_underflow     = 0U;
+    status.rx_overflow      = info->status.rx_overflow;
+    status.rx_break         = info->status.rx_break;
+    status.rx_framing_error = info->status.rx_framing_error;
+    status.rx_parity_error  = info->status.rx_parity_error;
+    status.reserved         = 0U;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void USART_TxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    USART_Info_t *info;
+    const USART_Resources_t *res;
+
+    (void)channel;
+
+    info = (USART_Info_t *)param;
+    res  = info->res;
+
+    if (0U != (event & HAL_DMA_EVENT_MAJOR_DONE))
+    {
+        info->txDone += info->txChunk;
+
+        if (info->txDone < info->txNum)
+        {
+            USART_StartTxChunk(res, info);
+        }
+        else
+        {
+            /* Last byte is in the FIFO: report it, then wait for the shifter. */
+            HAL_LPUART_EnableTcInterrupt(res->instance, 1U);
+
+            if (NULL != info->cbEvent)
+            {
+                info->cbEvent(ARM_USART_EVENT_SEND_COMPLETE);
+            }
+            else
+            {
+                /* No callback registered */
+            }
+        }
+    }
+    else if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        info->status.tx_busy = 0U;
+    }
+    else
+    {
+        /* TX does not use half-done notification */
+    }
+}
+
+static void USART_RxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    USART_Info_t *info;
+    const USART_Resources_t *res;
+    uint32_t signal;
+
+    (void)channel;
+
+    signal = 0U;
+    info   = (USART_Info_t *)param;
+    res    = info->res;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        info->status.rx_busy = 0U;
+    }
+    else if (0U != (info->flags & USART_FLAG_RX_CIRCULAR))
+    {
+        /* Half and end alternate, counting them tracks the lap. */
+        info->rxHalves++;
+        signal = ARM_USART_EVENT_RECEIVE_COMPLETE;
+    }
+    else if (0U != (event & HAL_DMA_EVENT_MAJOR_DONE))
+    {
+        info->rxDone += info->rxChunk;
+
+        if (info->rxDone < info->rxNum)
+        {
+            USART_StartRxChunk(res, info);
+        }
+        else
+        {
+            info->status.rx_busy = 0U;
+            signal = ARM_USART_EVENT_RECEIVE_COMPLETE;
+        }
+    }
+    else
+    {
+        /* Half-done is not enabled in single-shot mode */
+    }
+
+    if ((0U != signal) && (NULL != info->cbEvent))
+    {
+        info->cbEvent(signal);
+    }
+    else
+    {
+        /* Nothing to report */
+    }
+}
+
+static void USART_IRQHandler(const USART_Resources_t *res, USART_Info_t *info)
+{
+    uint32_t status;
+    uint32_t signal;
+
+    signal = 0U;
+    status = HAL_LPUART_GetStatus(res->instance);
+
+    HAL_LPUART_ClearStatus(res->instance, status);
+
+    if (0U != (status & HAL_LPUART_STATUS_OVERRUN))
+    {
+        info->status.rx_overflow = 1U;
+        signal |= ARM_USART_EVENT_RX_OVERFLOW;
+    }
+    else
+    {
+        /* No overrun */
+    }
+
+    if (0U != (status & HAL_LPUART_STATUS_FRAMING))
+    {
+        info->status.rx_framing_error = 1U;
+        signal |= ARM_USART_EVENT_RX_FRAMING_ERROR;
+    }
+    else
+    {
+        /* No framing error */
+    }
+
+    if (0U != (status & HAL_LPUART_STATUS_PARITY))
+    {
+        info->status.rx_parity_error = 1U;
+        signal |= ARM_USART_EVENT_RX_PARITY_ERROR;
+    }
+    else
+    {
+        /* No parity error */
+    }
+
+    /* Idle line ends a variable-length frame: one interrupt per frame, not per byte. */
+    if ((0U != (status & HAL_LPUART_STATUS_IDLE)) && (0U != info->status.rx_busy))
+    {
+        signal |= ARM_USART_EVENT_RX_TIMEOUT;
+    }
+    else
+    {
+        /* Idle outside a receive operation is ignored */
+    }
+
+    if ((0U != (status & HAL_LPUART_STATUS_TC)) && (0U != info->status.tx_busy) &&
+        (info->txDone >= info->txNum))
+    {
+        HAL_LPUART_EnableTcInterrupt(res->instance, 0U);
+        info->status.tx_busy = 0U;
+        signal |= ARM_USART_EVENT_TX_COMPLETE;
+    }
+    else
+    {
+        /* Transmitter still shifting or idle */
+    }
+
+    if ((0U != signal) && (NULL != info->cbEvent))
+    {
+        info->cbEvent(signal);
+    }
+    else
+    {
+        /* Nothing to report */
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define USART_INSTANCE(n)                                                                       \
+static int32_t USART##n##_Initialize(ARM_USART_SignalEvent_t cb_event)                          \
+{ return USART_Initialize(cb_event, &s_usart##n##Res, &s_usart##n##Info); }                     \
+static int32_t USART##n##_Uninitialize(void)                                                    \
+{ return USART_Uninitialize(&s_usart##n##Res, &s_usart##n##Info); }                             \
+static int32_t USART##n##_PowerControl(ARM_POWER_STATE state)                                   \
+{ return USART_PowerControl(state, &s_usart##n##Res, &s_usart##n##Info); }                      \
+static int32_t USART##n##_Send(const void *data, uint32_t num)                                  \
+{ return USART_Send(data, num, &s_usart##n##Res, &s_usart##n##Info); }                          \
+static int32_t USART##n##_Receive(void *data, uint32_t num)                                     \
+{ return USART_Receive(data, num, &s_usart##n##Res, &s_usart##n##Info); }                       \
+static int32_t USART##n##_Transfer(const void *data_out, void *data_in, uint32_t num)           \
+{ (void)data_out; (void)data_in; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }              \
+static uint32_t USART##n##_GetTxCount(void)                                                     \
+{ return USART_GetTxCount(&s_usart##n##Info); }                                                 \
+static uint32_t USART##n##_GetRxCount(void)                                                     \
+{ return USART_GetRxCount(&s_usart##n##Info); }                                                 \
+static int32_t USART##n##_Control(uint32_t control, uint32_t arg)                               \
+{ return USART_Control(control, arg, &s_usart##n##Res, &s_usart##n##Info); }                    \
+static ARM_USART_STATUS USART##n##_GetStatus(void)                                              \
+{ return USART_GetStatus(&s_usart##n##Info); }                                                  \
+static int32_t USART##n##_SetModemControl(ARM_USART_MODEM_CONTROL control)                      \
+{ (void)control; return ARM_DRIVER_ERROR_UNSUPPORTED; }                                         \
+static ARM_USART_MODEM_STATUS USART##n##_GetModemStatus(void)                                   \
+{ ARM_USART_MODEM_STATUS modem = {0U}; return modem; }                                          \
+void LPUART##n##_RxTx_IRQHandler(void)                                                          \
+{ USART_IRQHandler(&s_usart##n##Res, &s_usart##n##Info); }                                      \
+ARM_DRIVER_USART Driver_USART##n =                                                              \
+{                                                                                               \
+    USART_GetVersion,                                                                           \
+    USART_GetCapabilities,                                                                      \
+    USART##n##_Initialize,                                                                      \
+    USART##n##_Uninitialize,                                                                    \
+    USART##n##_PowerControl,                                                                    \
+    USART##n##_Send,                                                                            \
+    USART##n##_Receive,                                                                         \
+    USART##n##_Transfer,                                                                        \
+    USART##n##_GetTxCount,                                                                      \
+    USART##n##_GetRxCount,                                                                      \
+    USART##n##_Control,                                                                         \
+    USART##n##_GetStatus,                                                                       \
+    USART##n##_SetModemControl,                                                                 \
+    USART##n##_GetModemStatus,                                                                  \
+};
+
+USART_INSTANCE(0)
+USART_INSTANCE(1)
+USART_INSTANCE(2)
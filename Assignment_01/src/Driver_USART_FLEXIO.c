@@ -0,0 +1,948 @@
+/*******************************************************************************
+ * @file    Driver_USART_FLEXIO.c
+ * @brief   CMSIS USART driver on FlexIO (UART emulation) C file.
+ *
+ * One transmit shifter and one receive shifter, each clocked by its own
+ * timer in baud mode, form an 8N1 UART with no CPU work per bit or byte:
+ * - TX: the timer is enabled while the shifter buffer holds data and adds
+ *   the start and stop bits, so eDMA writing the buffer paces the line;
+ * - RX: the timer is enabled by the start bit edge and samples mid-bit,
+ *   eDMA reads each byte from the buffer.
+ * The bit rate is the FlexIO clock / (2 * n), n = 1 ... 256, i.e.
+ * 93750 bit/s up to several Mbit/s. FlexIO has no parity, idle line or
+ * break detection: those controls are not supported.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "Driver_USART_S32K144.h"
+#include "HAL_FLEXIO.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ARM_USART_DRV_VERSION       ARM_DRIVER_VERSION_MAJOR_MINOR(1, 0)
+
+#define FXUART_DMA_MAX_COUNT        (32767UL)   /**< CITER is 15 bits wide */
+#define FXUART_DATA_BITS            (8U)
+#define FXUART_DIVIDER_MAX          (256UL)     /**< Timer half bit period, low byte of TIMCMP */
+#define FXUART_BAUD_TOLERANCE       (33UL)      /**< Accepted rate error, 1 / 33 = 3 % */
+#define FXUART_RX_BYTE_OFFSET       (3U)        /**< Received bits are left aligned in the buffer */
+
+/* Driver state flags */
+#define FXUART_FLAG_INITIALIZED     (1U << 0)
+#define FXUART_FLAG_POWERED         (1U << 1)
+#define FXUART_FLAG_CONFIGURED      (1U << 2)
+#define FXUART_FLAG_RX_CIRCULAR     (1U << 3)
+#define FXUART_FLAG_TX_ENABLED      (1U << 4)
+#define FXUART_FLAG_RX_ENABLED      (1U << 5)
+
+/**
+ * @brief Constant per-instance resources.
+ */
+typedef struct
+{
+    uint8_t                 txPin;          /**< FXIO_Dn of TX */
+    uint8_t                 rxPin;          /**< FXIO_Dn of RX */
+    uint8_t                 txPort;
+    uint8_t                 txPortPin;
+    uint8_t                 rxPort;
+    uint8_t                 rxPortPin;
+    uint8_t                 pinMux;
+} FXUART_Resources_t;
+
+/**
+ * @brief Run-time state of one instance.
+ */
+typedef struct
+{
+    const FXUART_Resources_t *res;
+    ARM_USART_SignalEvent_t cbEvent;
+    volatile ARM_USART_STATUS status;
+    uint8_t                 flags;
+    uint8_t                 txChannel;
+    uint8_t                 rxChannel;
+    uint8_t                 txShifter;
+    uint8_t                 rxShifter;
+    uint8_t                 txTimer;
+    uint8_t                 rxTimer;
+    uint16_t                compare;        /**< Timer compare for the configured baud rate */
+
+    const uint8_t           *txData;
+    uint32_t                txNum;
+    uint32_t                txDone;         /**< Bytes of finished DMA chunks */
+    uint16_t                txChunk;
+
+    uint8_t                 *rxData;
+    uint32_t                rxNum;
+    uint32_t                rxDone;         /**< Bytes of finished DMA chunks */
+    uint16_t                rxChunk;
+    volatile uint32_t       rxHalves;       /**< Circular mode: serviced half-buffer events */
+} FXUART_Info_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION FXUART_GetVersion(void);
+static ARM_USART_CAPABILITIES FXUART_GetCapabilities(void);
+
+static int32_t  FXUART_Initialize(ARM_USART_SignalEvent_t cb_event, const FXUART_Resources_t *res, FXUART_Info_t *info);
+static int32_t  FXUART_Uninitialize(FXUART_Info_t *info);
+static int32_t  FXUART_PowerControl(ARM_POWER_STATE state, FXUART_Info_t *info);
+static int32_t  FXUART_Send(const void *data, uint32_t num, FXUART_Info_t *info);
+static int32_t  FXUART_Receive(void *data, uint32_t num, FXUART_Info_t *info);
+static uint32_t FXUART_GetTxCount(const FXUART_Info_t *info);
+static uint32_t FXUART_GetRxCount(const FXUART_Info_t *info);
+static int32_t  FXUART_Control(uint32_t control, uint32_t arg, FXUART_Info_t *info);
+static ARM_USART_STATUS FXUART_GetStatus(const FXUART_Info_t *info);
+
+static void FXUART_SetTx(FXUART_Info_t *info, uint8_t enable);
+static void FXUART_SetRx(FXUART_Info_t *info, uint8_t enable);
+static void FXUART_StartTxChunk(FXUART_Info_t *info);
+static void FXUART_StartRxChunk(FXUART_Info_t *info);
+static void FXUART_TxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void FXUART_RxDmaCallback(uint8_t channel, uint32_t event, void *param);
+static void FXUART_TxCallback(uint8_t shifter, uint32_t status, void *param);
+static void FXUART_RxCallback(uint8_t shifter, uint32_t status, void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const ARM_DRIVER_VERSION s_driverVersion =
+{
+    ARM_USART_API_VERSION,
+    ARM_USART_DRV_VERSION
+};
+
+static const ARM_USART_CAPABILITIES s_driverCapabilities =
+{
+    1, /* supports UART (Asynchronous) mode */
+    0, /* supports Synchronous Master mode */
+    0, /* supports Synchronous Slave mode */
+    0, /* supports UART Single-wire mode */
+    0, /* supports UART IrDA mode */
+    0, /* supports UART Smart Card mode */
+    0, /* Smart Card Clock generator available */
+    0, /* RTS Flow Control available */
+    0, /* CTS Flow Control available */
+    0, /* Transmit completed event: ARM_USART_EVENT_TX_COMPLETE */
+    0, /* Signal receive character timeout event: ARM_USART_EVENT_RX_TIMEOUT */
+    0, /* RTS Line: 0=not available, 1=available */
+    0, /* CTS Line: 0=not available, 1=available */
+    0, /* DTR Line: 0=not available, 1=available */
+    0, /* DSR Line: 0=not available, 1=available */
+    0, /* DCD Line: 0=not available, 1=available */
+    0, /* RI Line: 0=not available, 1=available */
+    0, /* Signal CTS change event: ARM_USART_EVENT_CTS */
+    0, /* Signal DSR change event: ARM_USART_EVENT_DSR */
+    0, /* Signal DCD change event: ARM_USART_EVENT_DCD */
+    0, /* Signal RI change event: ARM_USART_EVENT_RI */
+    0  /* Reserved (must be zero) */
+};
+
+/* USART3: FXIO_D2 TX on PTA0, FXIO_D3 RX on PTA1 (ALT4). */
+static const FXUART_Resources_t s_usart3Res =
+{
+    2U, 3U, HAL_GPIO_PORT_A, 0U, HAL_GPIO_PORT_A, 1U, 4U
+};
+
+static FXUART_Info_t s_usart3Info;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static ARM_DRIVER_VERSION FXUART_GetVersion(void)
+{
+    return s_driverVersion;
+}
+
+static ARM_USART_CAPABILITIES FXUART_GetCapabilities(void)
+{
+    return s_driverCapabilities;
+}
+
+static int32_t FXUART_Initialize(ARM_USART_SignalEvent_t cb_event, const FXUART_Resources_t *res, FXUART_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & FXUART_FLAG_INITIALIZED))
+    {
+        HAL_FLEXIO_Init();
+        HAL_DMA_Init();
+
+        info->txChannel = HAL_DMA_AllocChannel();
+        info->rxChannel = HAL_DMA_AllocChannel();
+        info->txShifter = HAL_FLEXIO_AllocShifter();
+        info->rxShifter = HAL_FLEXIO_AllocShifter();
+        info->txTimer   = HAL_FLEXIO_AllocTimer();
+        info->rxTimer   = HAL_FLEXIO_AllocTimer();
+
+        if ((HAL_DMA_CHANNEL_INVALID == info->txChannel) || (HAL_DMA_CHANNEL_INVALID == info->rxChannel) ||
+            (HAL_FLEXIO_INVALID == info->txShifter) || (HAL_FLEXIO_INVALID == info->rxShifter) ||
+            (HAL_FLEXIO_INVALID == info->txTimer) || (HAL_FLEXIO_INVALID == info->rxTimer))
+        {
+            HAL_DMA_FreeChannel(info->txChannel);
+            HAL_DMA_FreeChannel(info->rxChannel);
+            HAL_FLEXIO_FreeShifter(info->txShifter);
+            HAL_FLEXIO_FreeShifter(info->rxShifter);
+            HAL_FLEXIO_FreeTimer(info->txTimer);
+            HAL_FLEXIO_FreeTimer(info->rxTimer);
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            HAL_GPIO_SetPinMux(res->rxPort, res->rxPortPin, res->pinMux);
+            HAL_GPIO_SetPinMux(res->txPort, res->txPortPin, res->pinMux);
+
+            info->res     = res;
+            info->cbEvent = cb_event;
+            info->flags   = FXUART_FLAG_INITIALIZED;
+        }
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+
+    return result;
+}
+
+static int32_t FXUART_Uninitialize(FXUART_Info_t *info)
+{
+    (void)FXUART_PowerControl(ARM_POWER_OFF, info);
+
+    if (0U != (info->flags & FXUART_FLAG_INITIALIZED))
+    {
+        HAL_DMA_FreeChannel(info->txChannel);
+        HAL_DMA_FreeChannel(info->rxChannel);
+        HAL_FLEXIO_FreeShifter(info->txShifter);
+        HAL_FLEXIO_FreeShifter(info->rxShifter);
+        HAL_FLEXIO_FreeTimer(info->txTimer);
+        HAL_FLEXIO_FreeTimer(info->rxTimer);
+    }
+    else
+    {
+        /* Not initialized, do nothing */
+    }
+
+    info->flags   = 0U;
+    info->cbEvent = NULL;
+
+    return ARM_DRIVER_OK;
+}
+
+static int32_t FXUART_PowerControl(ARM_POWER_STATE state, FXUART_Info_t *info)
+{
+    int32_t result;
+    HAL_DMA_Transfer_t transfer;
+
+    result = ARM_DRIVER_OK;
+
+    switch (state)
+    {
+        case ARM_POWER_OFF:
+            if (0U != (info->flags & FXUART_FLAG_POWERED))
+            {
+                HAL_DMA_DisableRequest(info->txChannel);
+                HAL_DMA_DisableRequest(info->rxChannel);
+                FXUART_SetTx(info, 0U);
+                FXUART_SetRx(info, 0U);
+                HAL_FLEXIO_EnableDma(info->txShifter, 0U);
+                HAL_FLEXIO_EnableDma(info->rxShifter, 0U);
+                HAL_FLEXIO_EnableIrq(info->txShifter, 0U);
+                HAL_FLEXIO_EnableIrq(info->rxShifter, 0U);
+                HAL_FLEXIO_RegisterCallback(info->txShifter, NULL, NULL);
+                HAL_FLEXIO_RegisterCallback(info->rxShifter, NULL, NULL);
+            }
+            else
+            {
+                /* Already off */
+            }
+
+            info->status.tx_busy = 0U;
+            info->status.rx_busy = 0U;
+            info->flags &= (uint8_t)~(FXUART_FLAG_POWERED | FXUART_FLAG_CONFIGURED | FXUART_FLAG_RX_CIRCULAR |
+                                      FXUART_FLAG_TX_ENABLED | FXUART_FLAG_RX_ENABLED);
+            break;
+
+        case ARM_POWER_FULL:
+            if (0U == (info->flags & FXUART_FLAG_INITIALIZED))
+            {
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (0U != (info->flags & FXUART_FLAG_POWERED))
+            {
+                /* Already powered */
+            }
+            else
+            {
+                /* TX: memory (byte, incrementing) -> shifter buffer, bit 0 first. Address / count set per Send. */
+                transfer.srcAddr    = 0U;
+                transfer.dstAddr    = HAL_FLEXIO_GetBufferAddress(info->txShifter, HAL_FLEXIO_BUFFER_NORMAL);
+                transfer.srcOffset  = 1;
+                transfer.dstOffset  = 0;
+                transfer.srcSize    = HAL_DMA_SIZE_8BIT;
+                transfer.dstSize    = HAL_DMA_SIZE_8BIT;
+                transfer.minorBytes = 1U;
+                transfer.majorCount = 1U;
+                transfer.srcLastAdj = 0;
+                transfer.dstLastAdj = 0;
+                transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+                HAL_DMA_ConfigTransfer(info->txChannel, &transfer);
+                HAL_DMA_SetRequestSource(info->txChannel, HAL_FLEXIO_GetDmaRequest(info->txShifter));
+                HAL_DMA_RegisterCallback(info->txChannel, FXUART_TxDmaCallback, (void *)info);
+
+                HAL_DMA_SetRequestSource(info->rxChannel, HAL_FLEXIO_GetDmaRequest(info->rxShifter));
+                HAL_DMA_RegisterCallback(info->rxChannel, FXUART_RxDmaCallback, (void *)info);
+
+                HAL_FLEXIO_EnableDma(info->txShifter, 1U);
+                HAL_FLEXIO_EnableDma(info->rxShifter, 1U);
+
+                /* Start / stop bit errors of the receiver are the only interrupt outside DMA. */
+                HAL_FLEXIO_RegisterCallback(info->txShifter, FXUART_TxCallback, (void *)info);
+                HAL_FLEXIO_RegisterCallback(info->rxShifter, FXUART_RxCallback, (void *)info);
+                (void)HAL_FLEXIO_TakeShifterError(info->rxShifter);
+                HAL_FLEXIO_EnableIrq(info->rxShifter, HAL_FLEXIO_STATUS_ERROR);
+
+                info->status.tx_busy          = 0U;
+                info->status.rx_busy          = 0U;
+                info->status.rx_overflow      = 0U;
+                info->status.rx_framing_error = 0U;
+                info->status.rx_parity_error  = 0U;
+
+                info->flags |= FXUART_FLAG_POWERED;
+            }
+            break;
+
+        case ARM_POWER_LOW:
+        default:
+            result = ARM_DRIVER_ERROR_UNSUPPORTED;
+            break;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Program (enable) or stop the transmitter.
+ */
+static void FXUART_SetTx(FXUART_Info_t *info, uint8_t enable)
+{
+    HAL_FLEXIO_Shifter_t shifter;
+    HAL_FLEXIO_Timer_t timer;
+
+    /* Bit clock: enabled while the buffer holds data, start + 8 data + stop bits per enable */
+    timer.mode       = (0U != enable) ? HAL_FLEXIO_TIMER_BAUD : HAL_FLEXIO_TIMER_DISABLED;
+    timer.trigger    = HAL_FLEXIO_TRIGGER_SHIFTER(info->txShifter);
+    timer.triggerLow = 1U;
+    timer.pin        = info->res->txPin;
+    timer.pinConfig  = HAL_FLEXIO_PIN_INPUT;
+    timer.pinInvert  = 0U;
+    timer.output     = HAL_FLEXIO_TIMOUT_ONE;
+    timer.decrement  = HAL_FLEXIO_TIMDEC_CLOCK;
+    timer.reset      = HAL_FLEXIO_TIMRST_NEVER;
+    timer.disable    = HAL_FLEXIO_TIMDIS_COMPARE;
+    timer.enable     = HAL_FLEXIO_TIMENA_TRIGGER_HIGH;
+    timer.stopBit    = HAL_FLEXIO_TSTOP_DISABLE;
+    timer.startBit   = 1U;
+    timer.compare    = info->compare;
+
+    shifter.mode         = (0U != enable) ? HAL_FLEXIO_SHIFTER_TRANSMIT : HAL_FLEXIO_SHIFTER_DISABLED;
+    shifter.timer        = info->txTimer;
+    shifter.timerFalling = 0U;
+    shifter.pin          = info->res->txPin;
+    shifter.pinConfig    = (0U != enable) ? HAL_FLEXIO_PIN_OUTPUT : HAL_FLEXIO_PIN_INPUT;
+    shifter.pinInvert    = 0U;
+    shifter.startBit     = HAL_FLEXIO_START_LOW;
+    shifter.stopBit      = HAL_FLEXIO_STOP_HIGH;
+
+    HAL_FLEXIO_SetTimer(info->txTimer, &timer);
+    HAL_FLEXIO_SetShifter(info->txShifter, &shifter);
+}
+
+/**
+ * @brief Program (enable) or stop the receiver.
+ */
+static void FXUART_SetRx(FXUART_Info_t *info, uint8_t enable)
+{
+    HAL_FLEXIO_Shifter_t shifter;
+    HAL_FLEXIO_Timer_t timer;
+
+    /*
+     * The inverted pin turns the falling start bit edge into the enable
+     * condition; the timer resets on it so that it samples mid-bit, and
+     * stops after the stop bit.
+     */
+    timer.mode       = (0U != enable) ? HAL_FLEXIO_TIMER_BAUD : HAL_FLEXIO_TIMER_DISABLED;
+    timer.trigger    = HAL_FLEXIO_TRIGGER_PIN(info->res->rxPin);
+    timer.triggerLow = 0U;
+    timer.pin        = info->res->rxPin;
+    timer.pinConfig  = HAL_FLEXIO_PIN_INPUT;
+    timer.pinInvert  = 1U;
+    timer.output     = HAL_FLEXIO_TIMOUT_ONE_RESET;
+    timer.decrement  = HAL_FLEXIO_TIMDEC_CLOCK;
+    timer.reset      = HAL_FLEXIO_TIMRST_PIN_RISING;
+    timer.disable    = HAL_FLEXIO_TIMDIS_COMPARE;
+    timer.enable     = HAL_FLEXIO_TIMENA_PIN_RISING;
+    timer.stopBit    = HAL_FLEXIO_TSTOP_DISABLE;
+    timer.startBit   = 1U;
+    timer.compare    = info->compare;
+
+    shifter.mode         = (0U != enable) ? HAL_FLEXIO_SHIFTER_RECEIVE : HAL_FLEXIO_SHIFTER_DISABLED;
+    shifter.timer        = info->rxTimer;
+    shifter.timerFalling = 1U;
+    shifter.pin          = info->res->rxPin;
+    shifter.pinConfig    = HAL_FLEXIO_PIN_INPUT;
+    shifter.pinInvert    = 0U;
+    shifter.startBit     = HAL_FLEXIO_START_LOW;
+    shifter.stopBit      = HAL_FLEXIO_STOP_HIGH;
+
+    HAL_FLEXIO_SetTimer(info->rxTimer, &timer);
+    HAL_FLEXIO_SetShifter(info->rxShifter, &shifter);
+}
+
+static void FXUART_StartTxChunk(FXUART_Info_t *info)
+{
+    uint32_t remaining;
+
+    remaining     = info->txNum - info->txDone;
+    info->txChunk = (uint16_t)((remaining > FXUART_DMA_MAX_COUNT) ? FXUART_DMA_MAX_COUNT : remaining);
+
+    HAL_DMA_Reload(info->txChannel, (uint32_t)&info->txData[info->txDone],
+                   HAL_FLEXIO_GetBufferAddress(info->txShifter, HAL_FLEXIO_BUFFER_NORMAL), info->txChunk);
+    HAL_DMA_EnableRequest(info->txChannel);
+}
+
+static int32_t FXUART_Send(const void *data, uint32_t num, FXUART_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == data) || (0U == num))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U == (info->flags & FXUART_FLAG_CONFIGURED)) || (0U == (info->flags & FXUART_FLAG_TX_ENABLED)))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.tx_busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.tx_busy = 1U;
+        info->txData = (const uint8_t *)data;
+        info->txNum  = num;
+        info->txDone = 0U;
+
+        FXUART_StartTxChunk(info);
+    }
+
+    return result;
+}
+
+static void FXUART_StartRxChunk(FXUART_Info_t *info)
+{
+    HAL_DMA_Transfer_t transfer;
+    uint32_t remaining;
+
+    remaining     = info->rxNum - info->rxDone;
+    info->rxChunk = (uint16_t)((remaining > FXUART_DMA_MAX_COUNT) ? FXUART_DMA_MAX_COUNT : remaining);
+
+    transfer.srcAddr    = HAL_FLEXIO_GetBufferAddress(info->rxShifter, HAL_FLEXIO_BUFFER_NORMAL) + FXUART_RX_BYTE_OFFSET;
+    transfer.dstAddr    = (uint32_t)&info->rxData[info->rxDone];
+    transfer.srcOffset  = 0;
+    transfer.dstOffset  = 1;
+    transfer.srcSize    = HAL_DMA_SIZE_8BIT;
+    transfer.dstSize    = HAL_DMA_SIZE_8BIT;
+    transfer.minorBytes = 1U;
+    transfer.majorCount = info->rxChunk;
+    transfer.srcLastAdj = 0;
+
+    if (0U != (info->flags & FXUART_FLAG_RX_CIRCULAR))
+    {
+        /* Wrap back to the buffer start forever, notify at half and end. */
+        transfer.dstLastAdj = -(int32_t)info->rxChunk;
+        transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_INT_HALF;
+    }
+    else
+    {
+        transfer.dstLastAdj = 0;
+        transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+    }
+
+    HAL_DMA_ConfigTransfer(info->rxChannel, &transfer);
+    HAL_DMA_EnableRequest(info->rxChannel);
+}
+
+static int32_t FXUART_Receive(void *data, uint32_t num, FXUART_Info_t *info)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == data) || (0U == num))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U != (info->flags & FXUART_FLAG_RX_CIRCULAR)) && ((num < 2U) || (num > FXUART_DMA_MAX_COUNT)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U == (info->flags & FXUART_FLAG_CONFIGURED)) || (0U == (info->flags & FXUART_FLAG_RX_ENABLED)))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if (0U != info->status.rx_busy)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        info->status.rx_busy          = 1U;
+        info->status.rx_overflow      = 0U;
+        info->status.rx_framing_error = 0U;
+        info->status.rx_parity_error  = 0U;
+
+        info->rxData   = (uint8_t *)data;
+        info->rxNum    = num;
+        info->rxDone   = 0U;
+        info->rxHalves = 0U;
+
+        /* A frame that came in while idle must not open the new receive */
+        (void)HAL_FLEXIO_ReadBuffer(info->rxShifter, HAL_FLEXIO_BUFFER_NORMAL);
+        (void)HAL_FLEXIO_TakeShifterError(info->rxShifter);
+
+        FXUART_StartRxChunk(info);
+    }
+
+    return result;
+}
+
+static uint32_t FXUART_GetTxCount(const FXUART_Info_t *info)
+{
+    uint32_t count;
+
+    count = info->txDone;
+
+    if ((0U != info->status.tx_busy) && (info->txDone < info->txNum))
+    {
+        count += (uint32_t)info->txChunk - HAL_DMA_GetRemaining(info->txChannel);
+    }
+    else
+    {
+        /* Idle, or last chunk done and only the shifter is busy: txDone is final */
+    }
+
+    return count;
+}
+
+static uint32_t FXUART_GetRxCount(const FXUART_Info_t *info)
+{
+    uint32_t count;
+    uint32_t halves;
+    uint16_t remaining;
+    uint8_t  pendingBefore;
+    uint8_t  pendingAfter;
+
+    if (0U != (info->flags & FXUART_FLAG_RX_CIRCULAR))
+    {
+        /* Same lap arithmetic as the LPUART driver. */
+        do
+        {
+            halves        = info->rxHalves;
+            pendingBefore = HAL_DMA_IsIntPending(info->rxChannel);
+            remaining     = HAL_DMA_GetRemaining(info->rxChannel);
+            pendingAfter  = HAL_DMA_IsIntPending(info->rxChannel);
+        } while ((halves != info->rxHalves) || (pendingBefore != pendingAfter));
+
+        halves += pendingAfter;
+        count = ((halves / 2U) * info->rxNum) + (info->rxNum - remaining);
+    }
+    else
+    {
+        count = info->rxDone;
+
+        if (0U != info->status.rx_busy)
+        {
+            count += (uint32_t)info->rxChunk - HAL_DMA_GetRemaining(info->rxChannel);
+        }
+        else
+        {
+            /* Transfer finished, rxDone is final */
+        }
+    }
+
+    return count;
+}
+
+static int32_t FXUART_Control(uint32_t control, uint32_t arg, FXUART_Info_t *info)
+{
+    int32_t result;
+    uint32_t divider;
+    uint32_t actual;
+
+    result = ARM_DRIVER_OK;
+
+    if (0U == (info->flags & FXUART_FLAG_POWERED))
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        switch (control & ARM_USART_CONTROL_Msk)
+        {
+            case ARM_USART_MODE_ASYNCHRONOUS:
+                /* The shifters move whole bytes with start and stop bit only: 8N1. */
+                if (ARM_USART_DATA_BITS_8 != (control & ARM_USART_DATA_BITS_Msk))
+                {
+                    result = ARM_USART_ERROR_DATA_BITS;
+                }
+                else if (ARM_USART_PARITY_NONE != (control & ARM_USART_PARITY_Msk))
+                {
+                    result = ARM_USART_ERROR_PARITY;
+                }
+                else if (ARM_USART_STOP_BITS_1 != (control & ARM_USART_STOP_BITS_Msk))
+                {
+                    result = ARM_USART_ERROR_STOP_BITS;
+                }
+                else if (ARM_USART_FLOW_CONTROL_NONE != (control & ARM_USART_FLOW_CONTROL_Msk))
+                {
+                    result = ARM_USART_ERROR_FLOW_CONTROL;
+                }
+                else if ((0U != info->status.tx_busy) || (0U != info->status.rx_busy))
+                {
+                    result = ARM_DRIVER_ERROR_BUSY;
+                }
+                else if (0U == arg)
+                {
+                    result = ARM_USART_ERROR_BAUDRATE;
+                }
+                else
+                {
+                    /* Half bit period in FlexIO clocks, rounded to the nearest */
+                    divider = (HAL_FLEXIO_CLOCK_HZ + arg) / (2UL * arg);
+                    actual  = (0U != divider) ? (HAL_FLEXIO_CLOCK_HZ / (2UL * divider)) : 0U;
+
+                    if ((0U == divider) || (divider > FXUART_DIVIDER_MAX) ||
+                        ((((actual > arg) ? (actual - arg) : (arg - actual)) * FXUART_BAUD_TOLERANCE) > arg))
+                    {
+                        result = ARM_USART_ERROR_BAUDRATE;
+                    }
+                    else
+                    {
+                        info->compare = (uint16_t)((((2U * FXUART_DATA_BITS) - 1U) << 8) | (divider - 1UL));
+                        info->flags  |= FXUART_FLAG_CONFIGURED;
+
+                        FXUART_SetTx(info, (0U != (info->flags & FXUART_FLAG_TX_ENABLED)) ? 1U : 0U);
+                        FXUART_SetRx(info, (0U != (info->flags & FXUART_FLAG_RX_ENABLED)) ? 1U : 0U);
+                    }
+                }
+                break;
+
+            case ARM_USART_CONTROL_TX:
+                if (0U == (info->flags & FXUART_FLAG_CONFIGURED))
+                {
+                    result = ARM_DRIVER_ERROR;
+                }
+                else if (0U != arg)
+                {
+                    info->flags |= FXUART_FLAG_TX_ENABLED;
+                    FXUART_SetTx(info, 1U);
+                }
+                else
+                {
+                    info->flags &= (uint8_t)~FXUART_FLAG_TX_ENABLED;
+                    FXUART_SetTx(info, 0U);
+                }
+                break;
+
+            case ARM_USART_CONTROL_RX:
+                if (0U == (info->flags & FXUART_FLAG_CONFIGURED))
+                {
+                    result = ARM_DRIVER_ERROR;
+                }
+                else if (0U != arg)
+                {
+                    info->flags |= FXUART_FLAG_RX_ENABLED;
+                    FXUART_SetRx(info, 1U);
+                }
+                else
+                {
+                    info->flags &= (uint8_t)~FXUART_FLAG_RX_ENABLED;
+                    FXUART_SetRx(info, 0U);
+                }
+                break;
+
+            case ARM_USART_ABORT_SEND:
+                HAL_DMA_DisableRequest(info->txChannel);
+                HAL_FLEXIO_EnableIrq(info->txShifter, 0U);
+                info->txDone = FXUART_GetTxCount(info);
+                info->txNum  = info->txDone;
+                info->status.tx_busy = 0U;
+                break;
+
+            case ARM_USART_ABORT_RECEIVE:
+                HAL_DMA_DisableRequest(info->rxChannel);
+                if (0U == (info->flags & FXUART_FLAG_RX_CIRCULAR))
+                {
+                    info->rxDone = FXUART_GetRxCount(info);
+                }
+                else
+                {
+                    /* Circular buffer keeps its free-running count */
+                }
+                info->status.rx_busy = 0U;
+                break;
+
+            case USART_CONTROL_RX_CIRCULAR:
+                if (0U != info->status.rx_busy)
+                {
+                    result = ARM_DRIVER_ERROR_BUSY;
+                }
+                else if (0U != arg)
+                {
+                    info->flags |= FXUART_FLAG_RX_CIRCULAR;
+                }
+                else
+                {
+                    info->flags &= (uint8_t)~FXUART_FLAG_RX_CIRCULAR;
+                }
+                break;
+
+            case ARM_USART_MODE_SYNCHRONOUS_MASTER:
+            case ARM_USART_MODE_SYNCHRONOUS_SLAVE:
+            case ARM_USART_MODE_SINGLE_WIRE:
+            case ARM_USART_MODE_IRDA:
+            case ARM_USART_MODE_SMART_CARD:
+                result = ARM_USART_ERROR_MODE;
+                break;
+
+            default:
+                /* Break, idle line and loopback have no FlexIO equivalent */
+                result = ARM_DRIVER_ERROR_UNSUPPORTED;
+                break;
+        }
+    }
+
+    return result;
+}
+
+static ARM_USART_STATUS FXUART_GetStatus(const FXUART_Info_t *info)
+{
+    ARM_USART_STATUS status;
+
+    status.tx_busy          = info->status.tx_busy;
+    status.rx_busy          = info->status.rx_busy;
+    status.tx_underflow     = 0U;
+    status.rx_overflow      = info->status.rx_overflow;
+    status.rx_break         = 0U;
+    status.rx_framing_error = info->status.rx_framing_error;
+    status.rx_parity_error  = 0U;
+    status.reserved         = 0U;
+
+    return status;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FXUART_TxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    FXUART_Info_t *info;
+
+    (void)channel;
+
+    info = (FXUART_Info_t *)param;
+
+    if (0U != (event & HAL_DMA_EVENT_MAJOR_DONE))
+    {
+        info->txDone += info->txChunk;
+
+        if (info->txDone < info->txNum)
+        {
+            FXUART_StartTxChunk(info);
+        }
+        else
+        {
+            /* Last byte is in the buffer: report it, busy until the shifter takes it. */
+            HAL_FLEXIO_EnableIrq(info->txShifter, HAL_FLEXIO_STATUS_SHIFTER);
+
+            if (NULL != info->cbEvent)
+            {
+                info->cbEvent(ARM_USART_EVENT_SEND_COMPLETE);
+            }
+            else
+            {
+                /* No callback registered */
+            }
+        }
+    }
+    else if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        info->status.tx_busy = 0U;
+    }
+    else
+    {
+        /* TX does not use half-done notification */
+    }
+}
+
+static void FXUART_RxDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    FXUART_Info_t *info;
+    uint32_t signal;
+
+    (void)channel;
+
+    signal = 0U;
+    info   = (FXUART_Info_t *)param;
+
+    if (0U != (event & HAL_DMA_EVENT_ERROR))
+    {
+        info->status.rx_busy = 0U;
+    }
+    else if (0U != (info->flags & FXUART_FLAG_RX_CIRCULAR))
+    {
+        /* Half and end alternate, counting them tracks the lap. */
+        info->rxHalves++;
+        signal = ARM_USART_EVENT_RECEIVE_COMPLETE;
+    }
+    else if (0U != (event & HAL_DMA_EVENT_MAJOR_DONE))
+    {
+        info->rxDone += info->rxChunk;
+
+        if (info->rxDone < info->rxNum)
+        {
+            FXUART_StartRxChunk(info);
+        }
+        else
+        {
+            info->status.rx_busy = 0U;
+            signal = ARM_USART_EVENT_RECEIVE_COMPLETE;
+        }
+    }
+    else
+    {
+        /* Half-done is not enabled in single-shot mode */
+    }
+
+    if ((0U != signal) && (NULL != info->cbEvent))
+    {
+        info->cbEvent(signal);
+    }
+    else
+    {
+        /* Nothing to report */
+    }
+}
+
+static void FXUART_TxCallback(uint8_t shifter, uint32_t status, void *param)
+{
+    FXUART_Info_t *info;
+
+    (void)shifter;
+
+    info = (FXUART_Info_t *)param;
+
+    if (0U != (status & HAL_FLEXIO_STATUS_SHIFTER))
+    {
+        /* Last byte moved into the shifter, the next Send may start. */
+        HAL_FLEXIO_EnableIrq(info->txShifter, 0U);
+        info->status.tx_busy = 0U;
+    }
+    else
+    {
+        /* Transmit errors are not enabled */
+    }
+}
+
+static void FXUART_RxCallback(uint8_t shifter, uint32_t status, void *param)
+{
+    FXUART_Info_t *info;
+
+    (void)shifter;
+
+    info = (FXUART_Info_t *)param;
+
+    /* The receive error flag covers both a wrong start / stop bit and an overrun. */
+    if ((0U != (status & HAL_FLEXIO_STATUS_ERROR)) && (0U != info->status.rx_busy))
+    {
+        info->status.rx_framing_error = 1U;
+
+        if (NULL != info->cbEvent)
+        {
+            info->cbEvent(ARM_USART_EVENT_RX_FRAMING_ERROR);
+        }
+        else
+        {
+            /* No callback registered */
+        }
+    }
+    else
+    {
+        /* Error outside a receive operation is ignored */
+    }
+}
+
+/*******************************************************************************
+ * Instance wrappers
+ ******************************************************************************/
+
+#define FXUART_INSTANCE(n)                                                                      \
+static int32_t USART##n##_Initialize(ARM_USART_SignalEvent_t cb_event)                          \
+{ return FXUART_Initialize(cb_event, &s_usart##n##Res, &s_usart##n##Info); }                    \
+static int32_t USART##n##_Uninitialize(void)                                                    \
+{ return FXUART_Uninitialize(&s_usart##n##Info); }                                              \
+static int32_t USART##n##_PowerControl(ARM_POWER_STATE state)                                   \
+{ return FXUART_PowerControl(state, &s_usart##n##Info); }                                       \
+static int32_t USART##n##_Send(const void *data, uint32_t num)                                  \
+{ return FXUART_Send(data, num, &s_usart##n##Info); }                                           \
+static int32_t USART##n##_Receive(void *data, uint32_t num)                                     \
+{ return FXUART_Receive(data, num, &s_usart##n##Info); }                                        \
+static int32_t USART##n##_Transfer(const void *data_out, void *data_in, uint32_t num)           \
+{ (void)data_out; (void)data_in; (void)num; return ARM_DRIVER_ERROR_UNSUPPORTED; }              \
+static uint32_t USART##n##_GetTxCount(void)                                                     \
+{ return FXUART_GetTxCount(&s_usart##n##Info); }                                                \
+static uint32_t USART##n##_GetRxCount(void)                                                     \
+{ return FXUART_GetRxCount(&s_usart##n##Info); }                                                \
+static int32_t USART##n##_Control(uint32_t control, uint32_t arg)                               \
+{ return FXUART_Control(control, arg, &s_usart##n##Info); }                                     \
+static ARM_USART_STATUS USART##n##_GetStatus(void)                                              \
+{ return FXUART_GetStatus(&s_usart##n##Info); }                                                 \
+static int32_t USART##n##_SetModemControl(ARM_USART_MODEM_CONTROL control)                      \
+{ (void)control; return ARM_DRIVER_ERROR_UNSUPPORTED; }                                         \
+static ARM_USART_MODEM_STATUS USART##n##_GetModemStatus(void)                                   \
+{ ARM_USART_MODEM_STATUS modem = {0U}; return modem; }                                          \
+ARM_DRIVER_USART Driver_USART##n =                                                              \
+{                                                                                               \
+    FXUART_GetVersion,                                                                          \
+    FXUART_GetCapabilities,                                                                     \
+    USART##n##_Initialize,                                                                      \
+    USART##n##_Uninitialize,                                                                    \
+    USART##n##_PowerControl,                                                                    \
+    USART##n##_Send,                                                                            \
+    USART##n##_Receive,                                                                         \
+    USART##n##_Transfer,                                                                        \
+    USART##n##_GetTxCount,                                                                      \
+    USART##n##_GetRxCount,                                                                      \
+    USART##n##_Control,                                                                         \
+    USART##n##_GetStatus,                                                                       \
+    USART##n##_SetModemControl,                                                                 \
+    USART##n##_GetModemStatus,                                                                  \
+};
+
+FXUART_INSTANCE(3)
@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * @file    FLEXIO_Ws2812.c
+ * @brief   WS2812 addressable LED strip on FlexIO and eDMA C file.
+ *
+ * The timer runs in baud mode for 32 bits (one shifter buffer) at
+ * FLEXIO_WS2812_BIT_RATE; it is enabled while the shifter holds data
+ * (status flag low) and stops at the end of the word, so the stream is
+ * paced by the DMA refilling the buffer. The bit-byte swapped buffer view
+ * sends byte 0 first, MSB first: the frame is a plain byte stream in
+ * wire order.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "FLEXIO_Ws2812.h"
+#include "HAL_FLEXIO.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+#include "HAL_SCG.h"
+#include "HAL_DWT.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define WS2812_CORE_HZ              (HAL_SCG_SYS_CLK_HZ)    /**< Cycle counter rate */
+
+#define WS2812_WORD_BITS            (32U)
+#define WS2812_TIMER_COMPARE        ((uint16_t)((((2U * WS2812_WORD_BITS) - 1U) << 8) | \
+                                     ((HAL_FLEXIO_CLOCK_HZ / (2UL * FLEXIO_WS2812_BIT_RATE)) - 1UL)))
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/** Wire code of a nibble: 3 bits per bit, 1 = 110, 0 = 100, MSB first. */
+static const uint16_t s_ws2812Code[16] =
+{
+    0x924U, 0x926U, 0x934U, 0x936U, 0x9A4U, 0x9A6U, 0x9B4U, 0x9B6U,
+    0xD24U, 0xD26U, 0xD34U, 0xD36U, 0xDA4U, 0xDA6U, 0xDB4U, 0xDB6U
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void FLEXIO_Ws2812Encode(uint8_t *out, uint8_t value);
+static void FLEXIO_Ws2812Put(uint8_t *out, uint8_t red, uint8_t green, uint8_t blue);
+static int32_t FLEXIO_Ws2812Prepare(FLEXIO_Ws2812_t *strip);
+static void FLEXIO_Ws2812Send(FLEXIO_Ws2812_t *strip, uint8_t frame);
+static void FLEXIO_Ws2812DmaCallback(uint8_t channel, uint32_t event, void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t FLEXIO_Ws2812_Init(FLEXIO_Ws2812_t *strip, const FLEXIO_Ws2812Config_t *config)
+{
+    HAL_FLEXIO_Shifter_t shifter;
+    HAL_FLEXIO_Timer_t timer;
+    uint32_t index;
+    int32_t result;
+    uint8_t frame;
+
+    if ((NULL == strip) || (NULL == config) || (NULL == config->frame[0]) || (NULL == config->frame[1]) ||
+        (config->pin >= HAL_FLEXIO_PIN_COUNT) || (0U == config->ledCount) ||
+        (config->ledCount > FLEXIO_WS2812_LED_MAX))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        strip->config      = config;
+        strip->words       = FLEXIO_WS2812_FRAME_WORDS(config->ledCount);
+        strip->lastStart   = 0U;
+        strip->frameCycles = 0U;
+        strip->frames      = 0U;
+        strip->queued      = 0U;
+        strip->busy        = 0U;
+        strip->pending     = 0U;
+        strip->copy        = 0U;
+        strip->back        = 0U;
+
+        /* All LEDs off, then the low latch time */
+        for (frame = 0U; frame < 2U; frame++)
+        {
+            (void)memset(config->frame[frame], 0, strip->words * sizeof(uint32_t));
+
+            for (index = 0U; index < config->ledCount; index++)
+            {
+                FLEXIO_Ws2812Put((uint8_t *)config->frame[frame] + (index * FLEXIO_WS2812_LED_BYTES), 0U, 0U, 0U);
+            }
+        }
+
+        HAL_FLEXIO_Init();
+        HAL_DMA_Init();
+
+        strip->shifter    = HAL_FLEXIO_AllocShifter();
+        strip->timer      = HAL_FLEXIO_AllocTimer();
+        strip->dmaChannel = HAL_DMA_AllocChannel();
+
+        if ((HAL_FLEXIO_INVALID == strip->shifter) || (HAL_FLEXIO_INVALID == strip->timer) ||
+            (HAL_DMA_CHANNEL_INVALID == strip->dmaChannel))
+        {
+            HAL_FLEXIO_FreeShifter(strip->shifter);
+            HAL_FLEXIO_FreeTimer(strip->timer);
+            HAL_DMA_FreeChannel(strip->dmaChannel);
+
+            result = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            HAL_GPIO_SetPinMux(config->port, config->portPin, config->pinMux);
+
+            /* Bit clock: enabled while the buffer holds data, 32 bits per enable */
+            timer.mode       = HAL_FLEXIO_TIMER_BAUD;
+            timer.trigger    = HAL_FLEXIO_TRIGGER_SHIFTER(strip->shifter);
+            timer.triggerLow = 1U;
+            timer.pin        = 0U;
+            timer.pinConfig  = HAL_FLEXIO_PIN_INPUT;
+            timer.pinInvert  = 0U;
+            timer.output     = HAL_FLEXIO_TIMOUT_ONE;
+            timer.decrement  = HAL_FLEXIO_TIMDEC_CLOCK;
+            timer.reset      = HAL_FLEXIO_TIMRST_NEVER;
+            timer.disable    = HAL_FLEXIO_TIMDIS_COMPARE;
+            timer.enable     = HAL_FLEXIO_TIMENA_TRIGGER_HIGH;
+            timer.stopBit    = HAL_FLEXIO_TSTOP_NONE;
+            timer.startBit   = 0U;
+            timer.compare    = WS2812_TIMER_COMPARE;
+
+            shifter.mode         = HAL_FLEXIO_SHIFTER_TRANSMIT;
+            shifter.timer        = strip->timer;
+            shifter.timerFalling = 0U;
+            shifter.pin          = config->pin;
+            shifter.pinConfig    = HAL_FLEXIO_PIN_OUTPUT;
+            shifter.pinInvert    = 0U;
+            shifter.startBit     = HAL_FLEXIO_START_NONE;
+            shifter.stopBit      = HAL_FLEXIO_STOP_NONE;
+
+            HAL_FLEXIO_SetTimer(strip->timer, &timer);
+            HAL_FLEXIO_SetShifter(strip->shifter, &shifter);
+            HAL_FLEXIO_EnableDma(strip->shifter, 1U);
+
+            HAL_DMA_SetRequestSource(strip->dmaChannel, HAL_FLEXIO_GetDmaRequest(strip->shifter));
+            HAL_DMA_RegisterCallback(strip->dmaChannel, FLEXIO_Ws2812DmaCallback, (void *)strip);
+
+            HAL_DWT_EnableCycleCounter();
+
+            result = ARM_DRIVER_OK;
+        }
+    }
+
+    return result;
+}
+
+int32_t FLEXIO_Ws2812_SetPixel(FLEXIO_Ws2812_t *strip, uint16_t index, uint8_t red, uint8_t green, uint8_t blue)
+{
+    int32_t result;
+
+    if ((NULL == strip) || (NULL == strip->config) || (index >= strip->config->ledCount))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = FLEXIO_Ws2812Prepare(strip);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            FLEXIO_Ws2812Put((uint8_t *)strip->config->frame[strip->back] + ((uint32_t)index * FLEXIO_WS2812_LED_BYTES),
+                             red, green, blue);
+        }
+        else
+        {
+            /* Back frame queued */
+        }
+    }
+
+    return result;
+}
+
+int32_t FLEXIO_Ws2812_Fill(FLEXIO_Ws2812_t *strip, uint8_t red, uint8_t green, uint8_t blue)
+{
+    uint8_t *out;
+    uint32_t index;
+    int32_t result;
+
+    if ((NULL == strip) || (NULL == strip->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = FLEXIO_Ws2812Prepare(strip);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            /* Encode once, copy to the other LEDs */
+            out = (uint8_t *)strip->config->frame[strip->back];
+            FLEXIO_Ws2812Put(out, red, green, blue);
+
+            for (index = 1U; index < strip->config->ledCount; index++)
+            {
+                (void)memcpy(&out[index * FLEXIO_WS2812_LED_BYTES], out, FLEXIO_WS2812_LED_BYTES);
+            }
+        }
+        else
+        {
+            /* Back frame queued */
+        }
+    }
+
+    return result;
+}
+
+int32_t FLEXIO_Ws2812_Show(FLEXIO_Ws2812_t *strip)
+{
+    int32_t result;
+
+    if ((NULL == strip) || (NULL == strip->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = ARM_DRIVER_OK;
+
+        DISABLE_INTERRUPTS();
+
+        if (0U != strip->pending)
+        {
+            result = ARM_DRIVER_ERROR_BUSY;
+        }
+        else if (0U != strip->busy)
+        {
+            /* Sent by the DMA interrupt at the end of the current frame */
+            strip->pending = 1U;
+            strip->queued++;
+        }
+        else
+        {
+            FLEXIO_Ws2812Send(strip, strip->back);
+            strip->back ^= 1U;
+            strip->copy  = 1U;
+        }
+
+        ENABLE_INTERRUPTS();
+    }
+
+    return result;
+}
+
+uint8_t FLEXIO_Ws2812_IsReady(const FLEXIO_Ws2812_t *strip)
+{
+    return ((NULL != strip) && (0U == strip->pending)) ? 1U : 0U;
+}
+
+void FLEXIO_Ws2812_GetStats(const FLEXIO_Ws2812_t *strip, FLEXIO_Ws2812Stats_t *stats)
+{
+    if ((NULL != strip) && (NULL != strip->config) && (NULL != stats))
+    {
+        DISABLE_INTERRUPTS();
+        stats->frames = strip->frames;
+        stats->queued = strip->queued;
+        stats->frameRateMilliHz = (0U != strip->frameCycles) ?
+                                  (uint32_t)(((uint64_t)WS2812_CORE_HZ * 1000U) / strip->frameCycles) : 0U;
+        ENABLE_INTERRUPTS();
+
+        stats->maxRateMilliHz = (uint32_t)(((uint64_t)FLEXIO_WS2812_BIT_RATE * 1000U) /
+                                           (strip->words * WS2812_WORD_BITS));
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+/**
+ * @brief Wire code of one byte: 24 bits in 3 bytes.
+ */
+static void FLEXIO_Ws2812Encode(uint8_t *out, uint8_t value)
+{
+    uint32_t code;
+
+    code = ((uint32_t)s_ws2812Code[value >> 4] << 12) | s_ws2812Code[value & 0x0FU];
+
+    out[0] = (uint8_t)(code >> 16);
+    out[1] = (uint8_t)(code >> 8);
+    out[2] = (uint8_t)code;
+}
+
+/**
+ * @brief One LED, in the WS2812 order green, red, blue.
+ */
+static void FLEXIO_Ws2812Put(uint8_t *out, uint8_t red, uint8_t green, uint8_t blue)
+{
+    FLEXIO_Ws2812Encode(&out[0], green);
+    FLEXIO_Ws2812Encode(&out[3], red);
+    FLEXIO_Ws2812Encode(&out[6], blue);
+}
+
+/**
+ * @brief Make the back frame drawable: not queued, up to date with the
+ *        last frame shown. The front frame may be read while it is sent.
+ */
+static int32_t FLEXIO_Ws2812Prepare(FLEXIO_Ws2812_t *strip)
+{
+    int32_t result;
+
+    if (0U != strip->pending)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        if (0U != strip->copy)
+        {
+            (void)memcpy(strip->config->frame[strip->back], strip->config->frame[strip->back ^ 1U],
+                         strip->config->ledCount * FLEXIO_WS2812_LED_BYTES);
+            strip->copy = 0U;
+        }
+        else
+        {
+            /* Back frame up to date */
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Start the DMA of a frame, interrupts masked or from the DMA
+ *        interrupt.
+ */
+static void FLEXIO_Ws2812Send(FLEXIO_Ws2812_t *strip, uint8_t frame)
+{
+    HAL_DMA_Transfer_t transfer;
+    uint32_t now;
+
+    now = HAL_DWT_GetCycles();
+
+    if (0U != strip->frames)
+    {
+        strip->frameCycles = now - strip->lastStart;
+    }
+    else
+    {
+        /* First frame, no interval yet */
+    }
+
+    strip->lastStart = now;
+    strip->frames++;
+    strip->busy = 1U;
+
+    transfer.srcAddr    = (uint32_t)strip->config->frame[frame];
+    transfer.dstAddr    = HAL_FLEXIO_GetBufferAddress(strip->shifter, HAL_FLEXIO_BUFFER_BIT_BYTE_SWAP);
+    transfer.srcOffset  = 4;
+    transfer.dstOffset  = 0;
+    transfer.srcSize    = HAL_DMA_SIZE_32BIT;
+    transfer.dstSize    = HAL_DMA_SIZE_32BIT;
+    transfer.minorBytes = 4U;
+    transfer.majorCount = (uint16_t)strip->words;
+    transfer.srcLastAdj = 0;
+    transfer.dstLastAdj = 0;
+    transfer.flags      = HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ;
+
+    HAL_DMA_ConfigTransfer(strip->dmaChannel, &transfer);
+    HAL_DMA_EnableRequest(strip->dmaChannel);
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FLEXIO_Ws2812DmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    FLEXIO_Ws2812_t *strip = (FLEXIO_Ws2812_t *)param;
+
+    (void)channel;
+    (void)event;
+
+    /* The last words are the latch time: the LED data is out */
+    if (0U != strip->pending)
+    {
+        FLEXIO_Ws2812Send(strip, strip->back);
+        strip->back   ^= 1U;
+        strip->copy    = 1U;
+        strip->pending = 0U;
+    }
+    else
+    {
+        strip->busy = 0U;
+    }
+}
@@ -0,0 +1,507 @@
+/*******************************************************************************
+ * @file    FTM_Capture.c
+ * @brief   FTM input capture: edge timestamps, frequency, period and duty
+ *          C file.
+ *
+ * DMA: the request of the event channel (the second edge channel in
+ * pulse mode) copies CnV, or C(n)V and C(n+1)V with a source offset of 8
+ * and a minor loop offset back, into the ring. The major loop is the
+ * whole ring and restarts by itself, no DMA interrupt is used; the write
+ * position is the remaining major count, sampled on every counter
+ * overflow and on every read.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "FTM_Capture.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTM_CAPTURE_MODULO          (0xFFFFU)
+#define FTM_CAPTURE_PERIOD_TICKS    (0x10000UL)
+#define FTM_CAPTURE_EVENTS_MAX      (16384U)
+#define FTM_CAPTURE_BATCH           (16U)
+#define FTM_CAPTURE_CNV_STEP        (8)             /**< C(n+1)V - C(n)V */
+
+#define FTM_CAPTURE_IS_PULSE(c)     (FTM_CAPTURE_MODE_PULSE == (c)->mode)
+#define FTM_CAPTURE_WORDS(c)        (FTM_CAPTURE_IS_PULSE(c) ? 2U : 1U)     /**< Ring entries per event */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void FTM_CaptureSync(FTM_Capture_t *cap);
+static void FTM_CapturePush(FTM_Capture_t *cap);
+static void FTM_CaptureCallback(HAL_FTM_Instance_t instance, uint32_t status, void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t FTM_Capture_Init(FTM_Capture_t *cap, const FTM_CaptureConfig_t *config)
+{
+    uint32_t request;
+    uint32_t edge;
+    int32_t result;
+    uint8_t prescaler;
+
+    if ((NULL == cap) || (NULL == config) || (NULL == config->ring) ||
+        ((uint32_t)config->instance >= (uint32_t)HAL_FTM_MAX) || (config->channel >= HAL_FTM_CHANNEL_COUNT) ||
+        (config->mode > FTM_CAPTURE_MODE_PULSE) || (FTM_CAPTURE_IS_PULSE(config) && (0U != (config->channel & 1U))) ||
+        (0U == config->minFrequency) || (config->ringEvents < 2U) || (config->ringEvents > FTM_CAPTURE_EVENTS_MAX) ||
+        (0U != (config->ringEvents & (config->ringEvents - 1U))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        /* Fastest counter whose period covers two periods of the slowest signal */
+        for (prescaler = 0U; (prescaler < HAL_FTM_PRESCALER_MAX) &&
+             (((HAL_FTM_CLOCK_HZ >> prescaler) / config->minFrequency) > (FTM_CAPTURE_PERIOD_TICKS / 2U));
+             prescaler++)
+        {
+            /* Try a larger prescaler */
+        }
+
+        if (((HAL_FTM_CLOCK_HZ >> prescaler) / config->minFrequency) > (FTM_CAPTURE_PERIOD_TICKS / 2U))
+        {
+            result = FTM_CAPTURE_ERROR_RANGE;
+        }
+        else
+        {
+            cap->config     = config;
+            cap->tickHz     = HAL_FTM_CLOCK_HZ >> prescaler;
+            cap->dmaChannel = HAL_DMA_CHANNEL_INVALID;
+            result          = ARM_DRIVER_OK;
+
+            if (0U != config->useDma)
+            {
+                HAL_DMA_Init();
+                cap->dmaChannel = HAL_DMA_AllocChannel();
+
+                if (HAL_DMA_CHANNEL_INVALID == cap->dmaChannel)
+                {
+                    result = ARM_DRIVER_ERROR;
+                }
+                else
+                {
+                    HAL_DMA_SetRequestSource(cap->dmaChannel,
+                                             HAL_FTM_GetDmaRequest(config->instance,
+                                                                   config->channel + (FTM_CAPTURE_WORDS(config) - 1U)));
+                }
+            }
+            else
+            {
+                /* Channel interrupt fills the ring */
+            }
+        }
+
+        if (ARM_DRIVER_OK == result)
+        {
+            HAL_FTM_Init(config->instance, prescaler, FTM_CAPTURE_MODULO);
+            HAL_GPIO_SetPinMux(config->port, config->pin, config->pinMux);
+            HAL_FTM_SetInputFilter(config->instance, config->channel, config->filter);
+
+            request = (0U != config->useDma) ? HAL_FTM_CH_DMA : HAL_FTM_CH_IRQ;
+
+            if (FTM_CAPTURE_IS_PULSE(config))
+            {
+                /* Both edges from the even channel input; the odd channel flags the pair */
+                HAL_FTM_SetChannel(config->instance, config->channel,
+                                   HAL_FTM_CH_DUAL_CONTINUOUS | HAL_FTM_CH_CAPTURE_RISING);
+                HAL_FTM_SetChannel(config->instance, config->channel + 1U,
+                                   HAL_FTM_CH_DUAL_CONTINUOUS | HAL_FTM_CH_CAPTURE_FALLING | request);
+            }
+            else
+            {
+                edge = (FTM_CAPTURE_MODE_RISING == config->mode) ? HAL_FTM_CH_CAPTURE_RISING :
+                                                                   HAL_FTM_CH_CAPTURE_FALLING;
+                HAL_FTM_SetChannel(config->instance, config->channel, edge | request);
+            }
+
+            HAL_FTM_RegisterCallback(config->instance, FTM_CaptureCallback, (void *)cap);
+        }
+        else
+        {
+            /* Keep the timer untouched */
+        }
+    }
+
+    return result;
+}
+
+int32_t FTM_Capture_Start(FTM_Capture_t *cap)
+{
+    const FTM_CaptureConfig_t *config;
+    HAL_DMA_Transfer_t transfer;
+    uint32_t words;
+    int32_t result;
+
+    if ((NULL == cap) || (NULL == cap->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        config = cap->config;
+        words  = FTM_CAPTURE_WORDS(config);
+
+        cap->produced       = 0U;
+        cap->producedAtWrap = 0U;
+        cap->consumed       = 0U;
+        cap->wraps          = 0U;
+        cap->gapEvent       = 0U;
+        cap->gapWraps       = 0U;
+        cap->idle           = 0U;
+        cap->overruns       = 0U;
+        cap->chained        = 0U;
+        cap->dmaPos         = 0U;
+
+        if (HAL_DMA_CHANNEL_INVALID != cap->dmaChannel)
+        {
+            transfer.srcAddr    = HAL_FTM_GetValueAddress(config->instance, config->channel);
+            transfer.dstAddr    = (uint32_t)config->ring;
+            transfer.srcOffset  = (int16_t)((words - 1U) * FTM_CAPTURE_CNV_STEP);
+            transfer.dstOffset  = 2;
+            transfer.srcSize    = HAL_DMA_SIZE_16BIT;
+            transfer.dstSize    = HAL_DMA_SIZE_16BIT;
+            transfer.minorBytes = 2UL * words;
+            transfer.majorCount = config->ringEvents;
+            transfer.srcLastAdj = 0;
+            transfer.dstLastAdj = -(int32_t)(2UL * words * config->ringEvents);
+            transfer.flags      = 0U;
+
+            HAL_DMA_DisableRequest(cap->dmaChannel);
+            HAL_DMA_ConfigTransfer(cap->dmaChannel, &transfer);
+
+            if (FTM_CAPTURE_IS_PULSE(config))
+            {
+                HAL_DMA_SetMinorLoopOffset(cap->dmaChannel, -(int32_t)(2 * FTM_CAPTURE_CNV_STEP), HAL_DMA_MLOFF_SRC);
+            }
+            else
+            {
+                /* Single CnV, source does not move */
+            }
+
+            HAL_DMA_EnableRequest(cap->dmaChannel);
+        }
+        else
+        {
+            /* Interrupt driven */
+        }
+
+        if (FTM_CAPTURE_IS_PULSE(config))
+        {
+            HAL_FTM_SetDualEdge(config->instance, config->channel / 2U, 1U);
+        }
+        else
+        {
+            /* Single edge channel is armed by its mode */
+        }
+
+        HAL_FTM_EnableOverflowIrq(config->instance, 1U);
+        HAL_FTM_Start(config->instance);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Capture_Stop(FTM_Capture_t *cap)
+{
+    int32_t result;
+
+    if ((NULL == cap) || (NULL == cap->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        HAL_FTM_Stop(cap->config->instance);
+        HAL_FTM_EnableOverflowIrq(cap->config->instance, 0U);
+
+        if (FTM_CAPTURE_IS_PULSE(cap->config))
+        {
+            HAL_FTM_SetDualEdge(cap->config->instance, cap->config->channel / 2U, 0U);
+        }
+        else
+        {
+            /* Nothing to disarm */
+        }
+
+        if (HAL_DMA_CHANNEL_INVALID != cap->dmaChannel)
+        {
+            HAL_DMA_DisableRequest(cap->dmaChannel);
+        }
+        else
+        {
+            /* Interrupt driven */
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+uint32_t FTM_Capture_Read(FTM_Capture_t *cap, FTM_CaptureEvent_t *events, uint32_t max)
+{
+    const FTM_CaptureConfig_t *config;
+    uint32_t produced;
+    uint32_t index;
+    uint32_t count;
+    uint16_t raw;
+    uint16_t delta;
+
+    count = 0U;
+
+    if ((NULL != cap) && (NULL != cap->config) && (NULL != events))
+    {
+        config = cap->config;
+
+        if (HAL_DMA_CHANNEL_INVALID != cap->dmaChannel)
+        {
+            /* Same bookkeeping as the overflow interrupt */
+            DISABLE_INTERRUPTS();
+            FTM_CaptureSync(cap);
+            ENABLE_INTERRUPTS();
+        }
+        else
+        {
+            /* produced is kept by the channel interrupt */
+        }
+
+        produced = cap->produced;
+
+        if ((produced - cap->consumed) >= config->ringEvents)
+        {
+            /* The oldest entries are being overwritten: drop the backlog */
+            cap->overruns += produced - cap->consumed;
+            cap->consumed  = produced;
+            cap->chained   = 0U;
+        }
+        else
+        {
+            /* Backlog fits the ring */
+        }
+
+        while ((count < max) && (cap->consumed != produced))
+        {
+            index = (cap->consumed & ((uint32_t)config->ringEvents - 1U)) * FTM_CAPTURE_WORDS(config);
+            raw   = config->ring[index];
+            delta = (uint16_t)(raw - cap->lastRaw);
+
+            if (0U == cap->chained)
+            {
+                /* First edge: overflow count as the upper half */
+                events[count].time   = (cap->wraps << 16) | raw;
+                events[count].period = 0U;
+            }
+            else if ((cap->consumed == cap->gapEvent) && (0U != cap->gapWraps))
+            {
+                events[count].time   = cap->lastTime + ((uint32_t)cap->gapWraps << 16) + delta;
+                events[count].period = 0U;
+            }
+            else
+            {
+                events[count].time   = cap->lastTime + delta;
+                events[count].period = delta;
+            }
+
+            events[count].width = FTM_CAPTURE_IS_PULSE(config) ? (uint16_t)(config->ring[index + 1U] - raw) : 0U;
+
+            cap->lastTime = events[count].time;
+            cap->lastRaw  = raw;
+            cap->chained  = 1U;
+            cap->consumed++;
+            count++;
+        }
+    }
+    else
+    {
+        /* Invalid parameter, keep count = 0U */
+    }
+
+    return count;
+}
+
+int32_t FTM_Capture_Measure(FTM_Capture_t *cap, FTM_CaptureResult_t *result)
+{
+    FTM_CaptureEvent_t batch[FTM_CAPTURE_BATCH];
+    uint64_t sumPeriod;
+    uint64_t sumWidth;
+    uint32_t periods;
+    uint32_t total;
+    uint32_t count;
+    uint32_t i;
+    int32_t status;
+
+    if ((NULL == cap) || (NULL == cap->config) || (NULL == result))
+    {
+        status = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        sumPeriod = 0U;
+        sumWidth  = 0U;
+        periods   = 0U;
+        total     = 0U;
+
+        /* At most one ring per call, the producer may be faster than this loop */
+        do
+        {
+            count  = FTM_Capture_Read(cap, batch, FTM_CAPTURE_BATCH);
+            total += count;
+
+            for (i = 0U; i < count; i++)
+            {
+                if (0U != batch[i].period)
+                {
+                    sumPeriod += batch[i].period;
+                    sumWidth  += batch[i].width;
+                    periods++;
+                }
+                else
+                {
+                    /* First edge or after a gap: no period */
+                }
+            }
+        } while ((FTM_CAPTURE_BATCH == count) && (total < cap->config->ringEvents));
+
+        result->periods = periods;
+        result->lost    = cap->idle;
+
+        if (0U != periods)
+        {
+            result->periodTicks      = (uint32_t)(sumPeriod / periods);
+            result->periodNs         = (uint32_t)((sumPeriod * 1000000000ULL) / ((uint64_t)cap->tickHz * periods));
+            result->frequencyMilliHz = (uint32_t)(((uint64_t)periods * cap->tickHz * 1000ULL) / sumPeriod);
+            result->duty             = (uint32_t)((sumWidth * FTM_CAPTURE_DUTY_FULL) / sumPeriod);
+        }
+        else
+        {
+            result->periodTicks      = 0U;
+            result->periodNs         = 0U;
+            result->frequencyMilliHz = 0U;
+            result->duty             = 0U;
+        }
+
+        status = ARM_DRIVER_OK;
+    }
+
+    return status;
+}
+
+static void FTM_CaptureSync(FTM_Capture_t *cap)
+{
+    uint16_t mask;
+    uint16_t pos;
+
+    /* Remaining major count: ringEvents at the ring start */
+    mask = cap->config->ringEvents - 1U;
+    pos  = (uint16_t)(cap->config->ringEvents - HAL_DMA_GetRemaining(cap->dmaChannel)) & mask;
+
+    cap->produced += (uint16_t)(pos - cap->dmaPos) & mask;
+    cap->dmaPos    = pos;
+}
+
+static void FTM_CapturePush(FTM_Capture_t *cap)
+{
+    const FTM_CaptureConfig_t *config;
+    uint32_t index;
+
+    config = cap->config;
+    index  = (cap->produced & ((uint32_t)config->ringEvents - 1U)) * FTM_CAPTURE_WORDS(config);
+
+    /* Pulse mode: C(n)V before C(n+1)V, the pair is read coherently in this order */
+    config->ring[index] = HAL_FTM_GetValue(config->instance, config->channel);
+
+    if (FTM_CAPTURE_IS_PULSE(config))
+    {
+        config->ring[index + 1U] = HAL_FTM_GetValue(config->instance, config->channel + 1U);
+    }
+    else
+    {
+        /* One value per event */
+    }
+
+    cap->produced++;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FTM_CaptureCallback(HAL_FTM_Instance_t instance, uint32_t status, void *param)
+{
+    FTM_Capture_t *cap;
+    uint8_t channel;
+
+    (void)instance;
+
+    cap     = (FTM_Capture_t *)param;
+    channel = cap->config->channel + (FTM_CAPTURE_WORDS(cap->config) - 1U);
+
+    if (0U != (status & HAL_FTM_STATUS_CHANNEL(channel)))
+    {
+        FTM_CapturePush(cap);
+    }
+    else
+    {
+        /* Overflow only, or DMA mode */
+    }
+
+    if (0U != (status & HAL_FTM_STATUS_OVERFLOW))
+    {
+        cap->wraps++;
+
+        if (HAL_DMA_CHANNEL_INVALID != cap->dmaChannel)
+        {
+            FTM_CaptureSync(cap);
+        }
+        else
+        {
+            /* Pushed above */
+        }
+
+        if (cap->produced == cap->producedAtWrap)
+        {
+            /* A counter period without an edge: the next edge starts a new chain */
+            if (0U == cap->idle)
+            {
+                cap->gapEvent = cap->produced;
+                cap->gapWraps = 0U;
+                cap->idle     = 1U;
+            }
+            else
+            {
+                /* Gap continues */
+            }
+
+            if (cap->gapWraps < 0xFFFFU)
+            {
+                cap->gapWraps++;
+            }
+            else
+            {
+                /* Saturated */
+            }
+        }
+        else
+        {
+            cap->idle = 0U;
+        }
+
+        cap->producedAtWrap = cap->produced;
+    }
+    else
+    {
+        /* No overflow */
+    }
+}
@@ -0,0 +1,462 @@
+/*******************************************************************************
+ * @file    FTM_Pwm.c
+ * @brief   FTM PWM: edge / center-aligned outputs, dead time, synchronized
+ *          duty updates and DMA ramps C file.
+ *
+ * Every used pair has SYNCEN set and PWMLOAD.LDOK stays set, so any CnV
+ * write (CPU or DMA) is loaded at the next reload point; BeginUpdate
+ * clears LDOK to hold the loads.
+ *
+ * Ramp DMA: the trigger channel runs in PWM mode with CnV = CNTIN and no
+ * output, its flag is set once per period right after the reload point.
+ * A minor loop writes count halfwords with a destination offset of 8
+ * (CnV to C(n+1)V) and the minor loop offset moves the destination back;
+ * the source walks the table, the last source adjustment rewinds it for
+ * a looping ramp.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "FTM_Pwm.h"
+#include "HAL_DMA.h"
+#include "HAL_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTM_PWM_TICKS_MIN           (2UL)
+#define FTM_PWM_TICKS_MAX           (0xFFFFUL)
+#define FTM_PWM_STEPS_MAX           (32767U)
+#define FTM_PWM_CNV_STEP            (8)             /**< C(n+1)V - C(n)V */
+#define FTM_PWM_PAIRS               (HAL_FTM_CHANNEL_COUNT / 2U)
+#define FTM_PWM_Q15_ONE             (32768UL)
+
+#define FTM_PWM_IS_CENTER(c)        (FTM_PWM_ALIGN_CENTER == (c)->align)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t FTM_PwmGamma(uint32_t level);
+static void FTM_PwmDmaCallback(uint8_t channel, uint32_t event, void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t FTM_Pwm_Init(FTM_Pwm_t *pwm, const FTM_PwmConfig_t *config)
+{
+    const FTM_PwmChannel_t *output;
+    uint32_t pairFlags[FTM_PWM_PAIRS];
+    uint32_t ticks;
+    uint32_t index;
+    uint32_t deadtime;
+    int32_t result;
+    uint8_t prescaler;
+    uint8_t mask;
+
+    result = ARM_DRIVER_OK;
+
+    if ((NULL == pwm) || (NULL == config) || (NULL == config->channels) ||
+        ((uint32_t)config->instance >= (uint32_t)HAL_FTM_MAX) || (config->align > FTM_PWM_ALIGN_CENTER) ||
+        (0U == config->channelCount) || (config->channelCount > HAL_FTM_CHANNEL_COUNT) ||
+        (config->triggerChannel > FTM_PWM_NO_TRIGGER) || (0U == config->frequency))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        for (index = 0U; (index < config->channelCount) && (ARM_DRIVER_OK == result); index++)
+        {
+            output = &config->channels[index];
+
+            if ((output->channel >= HAL_FTM_CHANNEL_COUNT) || (output->channel == config->triggerChannel) ||
+                ((0U != output->complementary) && (0U == (output->channel & 1U))))
+            {
+                result = ARM_DRIVER_ERROR_PARAMETER;
+            }
+            else
+            {
+                /* Valid output */
+            }
+        }
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        /* Fastest counter whose period fits 16 bits (center: MOD = half period) */
+        for (prescaler = 0U; (prescaler < HAL_FTM_PRESCALER_MAX) &&
+             (((HAL_FTM_CLOCK_HZ >> prescaler) / config->frequency) > FTM_PWM_TICKS_MAX);
+             prescaler++)
+        {
+            /* Try a larger prescaler */
+        }
+
+        ticks = (HAL_FTM_CLOCK_HZ >> prescaler) / config->frequency;
+
+        if ((ticks > FTM_PWM_TICKS_MAX) || (ticks < FTM_PWM_TICKS_MIN))
+        {
+            result = FTM_PWM_ERROR_RANGE;
+        }
+        else
+        {
+            pwm->config       = config;
+            pwm->tickHz       = HAL_FTM_CLOCK_HZ >> prescaler;
+            pwm->period       = FTM_PWM_IS_CENTER(config) ? (ticks / 2U) : ticks;
+            pwm->rampCallback = NULL;
+            pwm->rampParam    = NULL;
+            pwm->ramping      = 0U;
+            pwm->dmaChannel   = HAL_DMA_CHANNEL_INVALID;
+
+            if (config->triggerChannel < HAL_FTM_CHANNEL_COUNT)
+            {
+                HAL_DMA_Init();
+                pwm->dmaChannel = HAL_DMA_AllocChannel();
+
+                if (HAL_DMA_CHANNEL_INVALID == pwm->dmaChannel)
+                {
+                    result = ARM_DRIVER_ERROR;
+                }
+                else
+                {
+                    HAL_DMA_SetRequestSource(pwm->dmaChannel,
+                                             HAL_FTM_GetDmaRequest(config->instance, config->triggerChannel));
+                    HAL_DMA_RegisterCallback(pwm->dmaChannel, FTM_PwmDmaCallback, (void *)pwm);
+                }
+            }
+            else
+            {
+                /* No ramps */
+            }
+        }
+    }
+    else
+    {
+        /* Invalid configuration */
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        /* Edge: MOD = period - 1, CnV = period is 100 %; center: MOD = period, CnV = MOD is 100 % */
+        HAL_FTM_Init(config->instance, prescaler,
+                     (uint16_t)(FTM_PWM_IS_CENTER(config) ? pwm->period : (pwm->period - 1U)));
+        HAL_FTM_SetCenterAligned(config->instance, config->align);
+
+        deadtime = ((config->deadtimeNs / 1000U) * (HAL_FTM_CLOCK_HZ / 1000000U)) +
+                   ((((config->deadtimeNs % 1000U) * (HAL_FTM_CLOCK_HZ / 1000000U)) + 999U) / 1000U);
+        pwm->deadtimeTicks = HAL_FTM_SetDeadtime(config->instance, deadtime);
+
+        for (index = 0U; index < FTM_PWM_PAIRS; index++)
+        {
+            pairFlags[index] = 0U;
+        }
+
+        mask = 0U;
+
+        for (index = 0U; index < config->channelCount; index++)
+        {
+            output = &config->channels[index];
+
+            HAL_GPIO_SetPinMux(output->port, output->pin, output->pinMux);
+            HAL_FTM_SetChannel(config->instance, output->channel,
+                               (0U != output->activeLow) ? HAL_FTM_CH_PWM_LOW : HAL_FTM_CH_PWM_HIGH);
+            HAL_FTM_SetValue(config->instance, output->channel, 0U);
+
+            pairFlags[output->channel / 2U] |= HAL_FTM_PAIR_SYNC;
+
+            if (0U != output->complementary)
+            {
+                pairFlags[output->channel / 2U] |= HAL_FTM_PAIR_COMPLEMENTARY;
+                pairFlags[output->channel / 2U] |= (0U != config->deadtimeNs) ? HAL_FTM_PAIR_DEADTIME : 0U;
+            }
+            else
+            {
+                /* Independent channel */
+            }
+
+            mask |= (uint8_t)(1U << output->channel);
+        }
+
+        for (index = 0U; index < FTM_PWM_PAIRS; index++)
+        {
+            HAL_FTM_SetPair(config->instance, (uint8_t)index, pairFlags[index]);
+        }
+
+        if (HAL_DMA_CHANNEL_INVALID != pwm->dmaChannel)
+        {
+            /* Flag at CNTIN every period, pin left alone (no PWMEN) */
+            HAL_FTM_SetChannel(config->instance, config->triggerChannel, HAL_FTM_CH_PWM_HIGH | HAL_FTM_CH_DMA);
+            HAL_FTM_SetValue(config->instance, config->triggerChannel, 0U);
+        }
+        else
+        {
+            /* No ramps */
+        }
+
+        HAL_FTM_SetSync(config->instance, (uint8_t)!FTM_PWM_IS_CENTER(config), config->align);
+        HAL_FTM_SetLoadEnable(config->instance, 1U);
+        HAL_FTM_EnableOutputs(config->instance, mask);
+    }
+    else
+    {
+        /* Keep the timer untouched */
+    }
+
+    return result;
+}
+
+int32_t FTM_Pwm_Start(FTM_Pwm_t *pwm)
+{
+    int32_t result;
+
+    if ((NULL == pwm) || (NULL == pwm->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        /* CnV written while stopped are already loaded */
+        HAL_FTM_Start(pwm->config->instance);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Pwm_Stop(FTM_Pwm_t *pwm)
+{
+    int32_t result;
+
+    if ((NULL == pwm) || (NULL == pwm->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        (void)FTM_Pwm_StopRamp(pwm);
+        HAL_FTM_Stop(pwm->config->instance);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+uint16_t FTM_Pwm_DutyToTicks(const FTM_Pwm_t *pwm, uint32_t duty)
+{
+    uint16_t ticks;
+
+    ticks = 0U;
+
+    if (NULL != pwm)
+    {
+        duty  = (duty > FTM_PWM_DUTY_FULL) ? FTM_PWM_DUTY_FULL : duty;
+        ticks = (uint16_t)((duty * pwm->period) / FTM_PWM_DUTY_FULL);
+    }
+    else
+    {
+        /* Invalid instance, keep ticks = 0U */
+    }
+
+    return ticks;
+}
+
+int32_t FTM_Pwm_SetDuty(FTM_Pwm_t *pwm, uint8_t channel, uint32_t duty)
+{
+    int32_t result;
+
+    if ((NULL == pwm) || (NULL == pwm->config) || (channel >= HAL_FTM_CHANNEL_COUNT) ||
+        (channel == pwm->config->triggerChannel) || (duty > FTM_PWM_DUTY_FULL))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        HAL_FTM_SetValue(pwm->config->instance, channel, FTM_Pwm_DutyToTicks(pwm, duty));
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+void FTM_Pwm_BeginUpdate(FTM_Pwm_t *pwm)
+{
+    if ((NULL != pwm) && (NULL != pwm->config))
+    {
+        HAL_FTM_SetLoadEnable(pwm->config->instance, 0U);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void FTM_Pwm_EndUpdate(FTM_Pwm_t *pwm)
+{
+    if ((NULL != pwm) && (NULL != pwm->config))
+    {
+        HAL_FTM_SetLoadEnable(pwm->config->instance, 1U);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+int32_t FTM_Pwm_FillRamp(const FTM_Pwm_t *pwm, uint16_t *table, uint32_t steps, uint32_t stride,
+                         uint32_t fromDuty, uint32_t toDuty, uint8_t gamma)
+{
+    uint32_t index;
+    uint32_t level;
+    int32_t span;
+    int32_t result;
+
+    if ((NULL == pwm) || (NULL == table) || (0U == steps) || (0U == stride) ||
+        (fromDuty > FTM_PWM_DUTY_FULL) || (toDuty > FTM_PWM_DUTY_FULL))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        span = (int32_t)toDuty - (int32_t)fromDuty;
+
+        for (index = 0U; index < steps; index++)
+        {
+            if (1U == steps)
+            {
+                level = toDuty;
+            }
+            else
+            {
+                level = (uint32_t)((int32_t)fromDuty + ((span * (int32_t)index) / (int32_t)(steps - 1U)));
+            }
+
+            table[index * stride] = FTM_Pwm_DutyToTicks(pwm, (0U != gamma) ? FTM_PwmGamma(level) : level);
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Pwm_StartRamp(FTM_Pwm_t *pwm, uint8_t channel, uint8_t count, const uint16_t *table,
+                          uint16_t steps, uint8_t loop, FTM_PwmRampCallback_t callback, void *param)
+{
+    HAL_DMA_Transfer_t transfer;
+    int32_t result;
+
+    if ((NULL == pwm) || (NULL == pwm->config) || (NULL == table) || (0U == count) ||
+        (((uint32_t)channel + count) > HAL_FTM_CHANNEL_COUNT) || (0U == steps) || (steps > FTM_PWM_STEPS_MAX) ||
+        ((pwm->config->triggerChannel >= channel) && (pwm->config->triggerChannel < (channel + count))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (HAL_DMA_CHANNEL_INVALID == pwm->dmaChannel)
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else
+    {
+        HAL_DMA_DisableRequest(pwm->dmaChannel);
+
+        pwm->rampCallback = callback;
+        pwm->rampParam    = param;
+
+        transfer.srcAddr    = (uint32_t)table;
+        transfer.dstAddr    = HAL_FTM_GetValueAddress(pwm->config->instance, channel);
+        transfer.srcOffset  = 2;
+        transfer.dstOffset  = FTM_PWM_CNV_STEP;
+        transfer.srcSize    = HAL_DMA_SIZE_16BIT;
+        transfer.dstSize    = HAL_DMA_SIZE_16BIT;
+        transfer.minorBytes = 2UL * count;
+        transfer.majorCount = steps;
+        transfer.srcLastAdj = (0U != loop) ? -(int32_t)(2UL * count * steps) : 0;
+        transfer.dstLastAdj = 0;
+        transfer.flags      = (0U != loop) ? 0U : (HAL_DMA_FLAG_INT_MAJOR | HAL_DMA_FLAG_DISABLE_REQ);
+
+        HAL_DMA_ConfigTransfer(pwm->dmaChannel, &transfer);
+        HAL_DMA_SetMinorLoopOffset(pwm->dmaChannel, -(int32_t)(FTM_PWM_CNV_STEP * (int32_t)count),
+                                   HAL_DMA_MLOFF_DST);
+
+        pwm->ramping = 1U;
+        HAL_DMA_EnableRequest(pwm->dmaChannel);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Pwm_StopRamp(FTM_Pwm_t *pwm)
+{
+    int32_t result;
+
+    if (NULL == pwm)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (HAL_DMA_CHANNEL_INVALID == pwm->dmaChannel)
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else
+    {
+        HAL_DMA_DisableRequest(pwm->dmaChannel);
+        pwm->ramping = 0U;
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Gamma 2.2 approximation, duty for a linear brightness level.
+ */
+static uint32_t FTM_PwmGamma(uint32_t level)
+{
+    uint32_t x;
+    uint32_t x2;
+    uint32_t x3;
+
+    /* Q15: 0.8 x^2 + 0.2 x^3 */
+    x  = (level * FTM_PWM_Q15_ONE) / FTM_PWM_DUTY_FULL;
+    x2 = (x * x) >> 15;
+    x3 = (x2 * x) >> 15;
+
+    return ((((4U * x2) + x3) / 5U) * FTM_PWM_DUTY_FULL) >> 15;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FTM_PwmDmaCallback(uint8_t channel, uint32_t event, void *param)
+{
+    FTM_Pwm_t *pwm = (FTM_Pwm_t *)param;
+
+    (void)channel;
+
+    if (0U != pwm->ramping)
+    {
+        pwm->ramping = 0U;
+
+        if ((0U != (event & HAL_DMA_EVENT_MAJOR_DONE)) && (NULL != pwm->rampCallback))
+        {
+            pwm->rampCallback(pwm->rampParam);
+        }
+        else
+        {
+            /* Error or no callback */
+        }
+    }
+    else
+    {
+        /* Ramp stopped meanwhile */
+    }
+}
@@ -0,0 +1,413 @@
+/*******************************************************************************
+ * @file    FTM_Quad.c
+ * @brief   FTM quadrature decoder: extended position, index and velocity
+ *          C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "FTM_Quad.h"
+#include "HAL_GPIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTM_QUAD_MODULO             (0xFFFFU)
+#define FTM_QUAD_FILTER_MAX         (15U)
+#define FTM_QUAD_INDEX_FIRST        (2U)            /**< Channels 0 / 1 are the phase inputs */
+#define FTM_QUAD_WINDOWS_MAX        (0xFFFFU)
+
+#define FTM_QUAD_CYCLE_COUNTS(c)    ((FTM_QUAD_MODE_PHASE == (c)->mode) ? 4U : 1U)  /**< Counts per phase A cycle */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t FTM_QuadExtend(uint32_t position, uint16_t raw);
+static int32_t FTM_QuadScale(const FTM_Quad_t *quad, int64_t counts, uint32_t windows);
+static void FTM_QuadCallback(HAL_FTM_Instance_t instance, uint32_t status, void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t FTM_Quad_Init(FTM_Quad_t *quad, const FTM_QuadConfig_t *config)
+{
+    uint32_t flags;
+    int32_t result;
+
+    if ((NULL == quad) || (NULL == config) ||
+        ((HAL_FTM_1 != config->instance) && (HAL_FTM_2 != config->instance)) ||
+        (config->mode > FTM_QUAD_MODE_COUNT_DIR) || (config->filter > FTM_QUAD_FILTER_MAX) ||
+        ((FTM_QUAD_NO_INDEX != config->indexChannel) && (config->indexChannel < FTM_QUAD_INDEX_FIRST)) ||
+        (config->indexChannel > FTM_QUAD_NO_INDEX) || (config->indexMode > FTM_QUAD_INDEX_RESET) ||
+        (config->switchCounts < 2U) || (0U == config->maxWindows) || (0U == config->sampleHz))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        quad->config        = config;
+        quad->counter       = (const volatile uint32_t *)HAL_FTM_GetCounterAddress(config->instance);
+        quad->position      = 0U;
+        quad->offset        = 0U;
+        quad->indexPosition = 0U;
+        quad->indexCount    = 0U;
+        quad->lastPosition  = 0U;
+        quad->velocity      = 0;
+        quad->accCounts     = 0;
+        quad->accWindows    = 0U;
+        quad->direction     = 0;
+        quad->method        = FTM_QUAD_METHOD_PERIOD;
+
+        /* Counter clock only runs the filters, counts come from the phases */
+        HAL_FTM_Init(config->instance, 0U, FTM_QUAD_MODULO);
+
+        HAL_GPIO_SetPinMux(config->phaseAPort, config->phaseAPin, config->phaseAMux);
+        HAL_GPIO_SetPinMux(config->phaseBPort, config->phaseBPin, config->phaseBMux);
+        HAL_FTM_SetInputFilter(config->instance, 0U, config->filter);
+        HAL_FTM_SetInputFilter(config->instance, 1U, config->filter);
+
+        flags  = HAL_FTM_QUAD_ENABLE;
+        flags |= (FTM_QUAD_MODE_COUNT_DIR == config->mode) ? HAL_FTM_QUAD_COUNT_DIR : 0U;
+        flags |= (uint32_t)config->invert & (HAL_FTM_QUAD_INVERT_A | HAL_FTM_QUAD_INVERT_B);
+        flags |= (0U != config->filter) ? HAL_FTM_QUAD_FILTER : 0U;
+        HAL_FTM_SetQuadrature(config->instance, flags);
+
+        if (FTM_QUAD_NO_INDEX != config->indexChannel)
+        {
+            /* Capture of the decoder counter on the index edge */
+            HAL_GPIO_SetPinMux(config->indexPort, config->indexPin, config->indexMux);
+            HAL_FTM_SetChannel(config->instance, config->indexChannel, HAL_FTM_CH_CAPTURE_RISING | HAL_FTM_CH_IRQ);
+            HAL_FTM_RegisterCallback(config->instance, FTM_QuadCallback, (void *)quad);
+        }
+        else
+        {
+            /* No index */
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Quad_Start(FTM_Quad_t *quad)
+{
+    uint32_t position;
+    int32_t result;
+
+    if ((NULL == quad) || (NULL == quad->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        position = (uint16_t)*quad->counter;
+
+        quad->position     = position;
+        quad->lastPosition = position;
+        quad->offset       = position;
+        quad->indexCount   = 0U;
+        quad->velocity     = 0;
+        quad->accCounts    = 0;
+        quad->accWindows   = 0U;
+        quad->method       = FTM_QUAD_METHOD_PERIOD;
+
+        HAL_FTM_Start(quad->config->instance);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Quad_Stop(FTM_Quad_t *quad)
+{
+    int32_t result;
+
+    if ((NULL == quad) || (NULL == quad->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        HAL_FTM_Stop(quad->config->instance);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t FTM_Quad_GetPosition(const FTM_Quad_t *quad)
+{
+    int32_t position;
+
+    position = 0;
+
+    if ((NULL != quad) && (NULL != quad->config))
+    {
+        position = (int32_t)(FTM_QuadExtend(quad->position, (uint16_t)*quad->counter) - quad->offset);
+    }
+    else
+    {
+        /* Invalid instance, keep position = 0 */
+    }
+
+    return position;
+}
+
+void FTM_Quad_Zero(FTM_Quad_t *quad)
+{
+    if ((NULL != quad) && (NULL != quad->config))
+    {
+        quad->offset = FTM_QuadExtend(quad->position, (uint16_t)*quad->counter);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void FTM_Quad_Update(FTM_Quad_t *quad)
+{
+    const FTM_QuadConfig_t *config;
+    FTM_CaptureResult_t measure;
+    uint32_t position;
+    uint32_t magnitude;
+    uint32_t threshold;
+    int32_t delta;
+    int32_t bound;
+    uint8_t measured;
+
+    if ((NULL != quad) && (NULL != quad->config))
+    {
+        config = quad->config;
+
+        position           = FTM_QuadExtend(quad->position, (uint16_t)*quad->counter);
+        quad->position     = position;
+        delta              = (int32_t)(position - quad->lastPosition);
+        quad->lastPosition = position;
+
+        if (0 != delta)
+        {
+            quad->direction = (delta > 0) ? 1 : -1;
+        }
+        else
+        {
+            /* Keep the last direction */
+        }
+
+        quad->accCounts += delta;
+        quad->accWindows = (quad->accWindows < FTM_QUAD_WINDOWS_MAX) ? (quad->accWindows + 1U) : FTM_QUAD_WINDOWS_MAX;
+
+        /* Hysteresis: edge counting down to half the switch count */
+        magnitude = (delta < 0) ? (uint32_t)(-delta) : (uint32_t)delta;
+        threshold = (FTM_QUAD_METHOD_EDGES == quad->method) ? (config->switchCounts / 2U) : config->switchCounts;
+
+        if (magnitude >= threshold)
+        {
+            quad->method     = FTM_QUAD_METHOD_EDGES;
+            quad->velocity   = FTM_QuadScale(quad, delta, 1U);
+            quad->accCounts  = 0;
+            quad->accWindows = 0U;
+
+            if (NULL != config->period)
+            {
+                /* Periods of this sample are not used */
+                (void)FTM_Capture_Measure(config->period, &measure);
+            }
+            else
+            {
+                /* No period capture */
+            }
+        }
+        else
+        {
+            quad->method = FTM_QUAD_METHOD_PERIOD;
+            measured     = 0U;
+
+            if ((NULL != config->period) && (ARM_DRIVER_OK == FTM_Capture_Measure(config->period, &measure)) &&
+                (0U != measure.periods) && (0U == measure.lost))
+            {
+                /* Edges per second from the mean phase A period */
+                quad->velocity = FTM_QuadScale(quad, (int64_t)quad->direction * (int64_t)measure.frequencyMilliHz *
+                                               (int64_t)FTM_QUAD_CYCLE_COUNTS(config),
+                                               1000U * config->sampleHz);
+                measured = 1U;
+            }
+            else if (0 != quad->accCounts)
+            {
+                /* Counts over the samples since the previous estimate */
+                quad->velocity = FTM_QuadScale(quad, quad->accCounts, quad->accWindows);
+                measured       = 1U;
+            }
+            else
+            {
+                /* No edge since the previous estimate */
+            }
+
+            if (0U != measured)
+            {
+                quad->accCounts  = 0;
+                quad->accWindows = 0U;
+            }
+            else if (quad->accWindows >= config->maxWindows)
+            {
+                quad->velocity   = 0;
+                quad->accCounts  = 0;
+                quad->accWindows = 0U;
+            }
+            else
+            {
+                /* Still silent: not faster than one edge (one cycle) per elapsed samples */
+                bound = FTM_QuadScale(quad, (NULL != config->period) ? FTM_QUAD_CYCLE_COUNTS(config) : 1U,
+                                      quad->accWindows);
+
+                if (quad->velocity > bound)
+                {
+                    quad->velocity = bound;
+                }
+                else if (quad->velocity < -bound)
+                {
+                    quad->velocity = -bound;
+                }
+                else
+                {
+                    /* Estimate consistent with the silence */
+                }
+            }
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+int32_t FTM_Quad_GetVelocity(const FTM_Quad_t *quad, uint8_t *method)
+{
+    int32_t velocity;
+
+    velocity = 0;
+
+    if (NULL != quad)
+    {
+        velocity = quad->velocity;
+
+        if (NULL != method)
+        {
+            *method = quad->method;
+        }
+        else
+        {
+            /* Method not requested */
+        }
+    }
+    else
+    {
+        /* Invalid instance, keep velocity = 0 */
+    }
+
+    return velocity;
+}
+
+uint32_t FTM_Quad_GetIndex(const FTM_Quad_t *quad, int32_t *position)
+{
+    uint32_t count;
+
+    count = 0U;
+
+    if (NULL != quad)
+    {
+        DISABLE_INTERRUPTS();
+        count = quad->indexCount;
+
+        if (NULL != position)
+        {
+            *position = (int32_t)quad->indexPosition;
+        }
+        else
+        {
+            /* Position not requested */
+        }
+
+        ENABLE_INTERRUPTS();
+    }
+    else
+    {
+        /* Invalid instance, keep count = 0U */
+    }
+
+    return count;
+}
+
+/**
+ * @brief Extended counter for a raw counter value, nearest to position.
+ */
+static uint32_t FTM_QuadExtend(uint32_t position, uint16_t raw)
+{
+    return position + (uint32_t)(int32_t)(int16_t)(uint16_t)(raw - (uint16_t)position);
+}
+
+/**
+ * @brief Velocity of counts over windows sample periods, saturated.
+ */
+static int32_t FTM_QuadScale(const FTM_Quad_t *quad, int64_t counts, uint32_t windows)
+{
+    int64_t velocity;
+
+    velocity = (counts * (int64_t)quad->config->sampleHz * (int64_t)(1L << FTM_QUAD_VELOCITY_SHIFT)) /
+               (int64_t)windows;
+
+    if (velocity > (int64_t)INT32_MAX)
+    {
+        velocity = (int64_t)INT32_MAX;
+    }
+    else if (velocity < (int64_t)INT32_MIN)
+    {
+        velocity = (int64_t)INT32_MIN;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (int32_t)velocity;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void FTM_QuadCallback(HAL_FTM_Instance_t instance, uint32_t status, void *param)
+{
+    FTM_Quad_t *quad = (FTM_Quad_t *)param;
+    uint32_t extended;
+    uint8_t channel;
+
+    channel = quad->config->indexChannel;
+
+    if (0U != (status & HAL_FTM_STATUS_CHANNEL(channel)))
+    {
+        extended = FTM_QuadExtend(quad->position, HAL_FTM_GetValue(instance, channel));
+
+        if (FTM_QUAD_INDEX_RESET == quad->config->indexMode)
+        {
+            quad->offset = extended;
+        }
+        else
+        {
+            /* Latch only */
+        }
+
+        quad->indexPosition = extended - quad->offset;
+        quad->indexCount++;
+    }
+    else
+    {
+        /* Not the index */
+    }
+}
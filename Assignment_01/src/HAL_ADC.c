@@ -0,0 +1,263 @@
+/*******************************************************************************
+ * @file    HAL_ADC.c
+ * @brief   Hardware abstraction layer for the ADC C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "HAL_ADC.h"
+#include "HAL_SCG.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define ADC_IS_AVAILABLE(n)     ((uint32_t)(n) < (uint32_t)HAL_ADC_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ADC_Type * const s_adcBase[HAL_ADC_MAX] = IP_ADC_BASE_PTRS;
+
+static const uint8_t s_adcPccIndex[HAL_ADC_MAX] =
+{
+    PCC_ADC0_INDEX,
+    PCC_ADC1_INDEX
+};
+
+static const IRQn_Type s_adcIrq[HAL_ADC_MAX] =
+{
+    ADC0_IRQn,
+    ADC1_IRQn
+};
+
+static HAL_ADC_Callback_t s_callback[HAL_ADC_MAX];
+static void *s_callbackParam[HAL_ADC_MAX];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void ADC_IRQHandler(HAL_ADC_Instance_t instance);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_ADC_Init(HAL_ADC_Instance_t instance)
+{
+    ADC_Type *base;
+    uint8_t slot;
+
+    if (ADC_IS_AVAILABLE(instance))
+    {
+        base = s_adcBase[instance];
+
+        HAL_SCG_ClockFromFircDiv2(s_adcPccIndex[instance]);
+
+        for (slot = 0U; slot < HAL_ADC_SLOT_COUNT; slot++)
+        {
+            base->SC1[slot] = ADC_SC1_ADCH(HAL_ADC_INPUT_DISABLED);
+        }
+
+        base->SC2 = 0U;
+        base->SC3 = 0U;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_ADC_Configure(HAL_ADC_Instance_t instance, const HAL_ADC_Config_t *config)
+{
+    ADC_Type *base;
+    uint8_t sample;
+
+    if (ADC_IS_AVAILABLE(instance) && (NULL != config))
+    {
+        base   = s_adcBase[instance];
+        sample = (config->sampleCycles < 2U) ? 2U : config->sampleCycles;
+
+        /* ADICLK = 0: functional clock from the PCC. */
+        base->CFG1 = ADC_CFG1_ADICLK(0U) | ADC_CFG1_MODE(config->resolution) | ADC_CFG1_ADIV(config->divider);
+        base->CFG2 = ADC_CFG2_SMPLTS(sample - 1U);
+
+        if (HAL_ADC_AVERAGE_NONE != config->average)
+        {
+            base->SC3 = ADC_SC3_AVGE_MASK | ADC_SC3_AVGS(config->average - 1U);
+        }
+        else
+        {
+            base->SC3 = 0U;
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_ADC_Calibrate(HAL_ADC_Instance_t instance)
+{
+    ADC_Type *base;
+    uint32_t sc2;
+    uint32_t sc3;
+
+    if (ADC_IS_AVAILABLE(instance))
+    {
+        base = s_adcBase[instance];
+        sc2  = base->SC2;
+        sc3  = base->SC3;
+
+        /* Software trigger, 32 samples averaged, calibration values cleared. */
+        base->SC2  = sc2 & ~(ADC_SC2_ADTRG_MASK | ADC_SC2_DMAEN_MASK);
+        base->SC3  = ADC_SC3_AVGE_MASK | ADC_SC3_AVGS(3U);
+        base->CLPS = 0U;
+        base->CLP3 = 0U;
+        base->CLP2 = 0U;
+        base->CLP1 = 0U;
+        base->CLP0 = 0U;
+        base->CLPX = 0U;
+        base->CLP9 = 0U;
+
+        base->SC3 |= ADC_SC3_CAL_MASK;
+
+        while (0U != (base->SC3 & ADC_SC3_CAL_MASK))
+        {
+            /* Calibration running */
+        }
+
+        base->SC3 = sc3;
+        base->SC2 = sc2;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_ADC_SetSlot(HAL_ADC_Instance_t instance, uint8_t slot, uint8_t input, uint8_t interrupt)
+{
+    if (ADC_IS_AVAILABLE(instance) && (slot < HAL_ADC_SLOT_COUNT))
+    {
+        s_adcBase[instance]->SC1[slot] = ADC_SC1_ADCH(input) | ADC_SC1_AIEN(interrupt);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_ADC_SetTrigger(HAL_ADC_Instance_t instance, uint8_t hwTrigger, uint8_t dma)
+{
+    ADC_Type *base;
+
+    if (ADC_IS_AVAILABLE(instance))
+    {
+        base      = s_adcBase[instance];
+        base->SC2 = (base->SC2 & ~(ADC_SC2_ADTRG_MASK | ADC_SC2_DMAEN_MASK)) |
+                    ADC_SC2_ADTRG(hwTrigger) | ADC_SC2_DMAEN(dma);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint16_t HAL_ADC_GetResult(HAL_ADC_Instance_t instance, uint8_t slot)
+{
+    uint16_t result;
+
+    result = 0U;
+
+    if (ADC_IS_AVAILABLE(instance) && (slot < HAL_ADC_SLOT_COUNT))
+    {
+        result = (uint16_t)s_adcBase[instance]->R[slot];
+    }
+    else
+    {
+        /* Invalid parameter, keep result = 0U */
+    }
+
+    return result;
+}
+
+uint32_t HAL_ADC_GetResultAddress(HAL_ADC_Instance_t instance, uint8_t slot)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (ADC_IS_AVAILABLE(instance) && (slot < HAL_ADC_SLOT_COUNT))
+    {
+        address = (uint32_t)&s_adcBase[instance]->R[slot];
+    }
+    else
+    {
+        /* Invalid parameter, keep address = 0U */
+    }
+
+    return address;
+}
+
+void HAL_ADC_RegisterCallback(HAL_ADC_Instance_t instance, HAL_ADC_Callback_t callback, void *param)
+{
+    if (ADC_IS_AVAILABLE(instance))
+    {
+        s_callback[instance]      = callback;
+        s_callbackParam[instance] = param;
+
+        if (NULL != callback)
+        {
+            HAL_NVIC_EnableIRQ(s_adcIrq[instance]);
+        }
+        else
+        {
+            HAL_NVIC_DisableIRQ(s_adcIrq[instance]);
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Interrupt handlers
+ ******************************************************************************/
+
+static void ADC_IRQHandler(HAL_ADC_Instance_t instance)
+{
+    ADC_Type *base;
+    uint32_t sc1;
+    uint8_t slot;
+
+    base = s_adcBase[instance];
+
+    for (slot = 0U; slot < HAL_ADC_SLOT_COUNT; slot++)
+    {
+        sc1 = base->SC1[slot];
+
+        if ((ADC_SC1_COCO_MASK | ADC_SC1_AIEN_MASK) == (sc1 & (ADC_SC1_COCO_MASK | ADC_SC1_AIEN_MASK)))
+        {
+            if (NULL != s_callback[instance])
+            {
+                s_callback[instance](slot, s_callbackParam[instance]);
+            }
+            else
+            {
+                /* No user: stop the request */
+                base->SC1[slot] = sc1 & ~(ADC_SC1_AIEN_MASK | ADC_SC1_COCO_MASK);
+            }
+        }
+        else
+        {
+            /* No interrupt from this slot */
+        }
+    }
+}
+
+void ADC0_IRQHandler(void) { ADC_IRQHandler(HAL_ADC_0); }
+void ADC1_IRQHandler(void) { ADC_IRQHandler(HAL_ADC_1); }
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * @file    HAL_CRC.c
+ * @brief   Hardware abstraction layer for the CRC module C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_CRC.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HAL_CRC_Init(void)
+{
+    IP_PCC->PCCn[PCC_CRC_INDEX] |= PCC_PCCn_CGC_MASK;
+}
+
+void HAL_CRC_Configure(const HAL_CRC_Config_t *config)
+{
+    uint32_t ctrl;
+
+    ctrl = CRC_CTRL_TCRC(config->width32) | CRC_CTRL_FXOR(config->complement) |
+           CRC_CTRL_TOT(config->transposeIn) | CRC_CTRL_TOTR(config->transposeOut);
+
+    IP_CRC->GPOLY = (0U != config->width32) ? config->polynomial : CRC_GPOLY_LOW(config->polynomial);
+
+    /* Seed written untransposed, then the data transposes take effect. */
+    IP_CRC->CTRL       = CRC_CTRL_TCRC(config->width32) | CRC_CTRL_WAS_MASK;
+    IP_CRC->DATAu.DATA = config->seed;
+    IP_CRC->CTRL       = ctrl;
+}
+
+void HAL_CRC_WriteByte(uint8_t data)
+{
+    IP_CRC->DATAu.DATA_8.LL = data;
+}
+
+void HAL_CRC_WriteWord(uint32_t data)
+{
+    IP_CRC->DATAu.DATA = data;
+}
+
+uint32_t HAL_CRC_GetResult(void)
+{
+    uint32_t ctrl;
+    uint32_t transpose;
+    uint32_t result;
+
+    ctrl = IP_CRC->CTRL;
+
+    if (0U != (ctrl & CRC_CTRL_TCRC_MASK))
+    {
+        result = IP_CRC->DATAu.DATA;
+    }
+    else
+    {
+        /* A CRC-16 read with bytes transposed ends in the upper half. */
+        transpose = (ctrl & CRC_CTRL_TOTR_MASK) >> CRC_CTRL_TOTR_SHIFT;
+        result    = ((HAL_CRC_TRANSPOSE_BITS_BYTES == transpose) || (HAL_CRC_TRANSPOSE_BYTES == transpose)) ?
+                    IP_CRC->DATAu.DATA_16.H : IP_CRC->DATAu.DATA_16.L;
+    }
+
+    return result;
+}
+
+uint32_t HAL_CRC_GetDataAddress(void)
+{
+    return (uint32_t)&IP_CRC->DATAu.DATA;
+}
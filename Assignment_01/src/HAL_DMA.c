@@ -0,0 +1,331 @@
+/*******************************************************************************
+ * @file    HAL_DMA.c
+ * @brief   Hardware abstraction layer for eDMA / DMAMUX C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_DMA.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/** Bit n set = channel n reserved. */
+static uint32_t s_channelUsed = 0U;
+
+/** Initialization done flag. */
+static uint8_t s_dmaInitialized = 0U;
+
+static HAL_DMA_Callback_t s_callback[HAL_DMA_CHANNEL_COUNT];
+static void *s_callbackParam[HAL_DMA_CHANNEL_COUNT];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void DMA_ChannelIRQ(uint8_t channel);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_DMA_Init(void)
+{
+    if (0U == s_dmaInitialized)
+    {
+        IP_PCC->PCCn[PCC_DMAMUX_INDEX] |= PCC_PCCn_CGC_MASK;
+
+        /* Round robin arbitration is not used: channel number is the priority.
+         * Minor loop mapping: NBYTES keeps its meaning while no offset is enabled. */
+        IP_DMA->CR = DMA_CR_EDBG_MASK | DMA_CR_EMLM_MASK;
+        IP_DMA->EEI = 0xFFFFU;
+
+        HAL_NVIC_EnableIRQ(DMA_Error_IRQn);
+
+        s_dmaInitialized = 1U;
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+}
+
+uint8_t HAL_DMA_AllocChannel(void)
+{
+    uint8_t channel;
+    uint8_t index;
+
+    channel = HAL_DMA_CHANNEL_INVALID;
+
+    for (index = 0U; index < HAL_DMA_CHANNEL_COUNT; index++)
+    {
+        if (0U == (s_channelUsed & (1UL << index)))
+        {
+            s_channelUsed |= (1UL << index);
+            channel = index;
+            break;
+        }
+    }
+
+    return channel;
+}
+
+void HAL_DMA_FreeChannel(uint8_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        HAL_DMA_DisableRequest(channel);
+        HAL_DMA_RegisterCallback(channel, NULL, NULL);
+        IP_DMAMUX->CHCFG[channel] = 0U;
+        s_channelUsed &= ~(1UL << channel);
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_SetRequestSource(uint8_t channel, dma_request_source_t source)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        /* Source may only be changed while the mux channel is disabled. */
+        IP_DMAMUX->CHCFG[channel] = 0U;
+        IP_DMAMUX->CHCFG[channel] = (uint8_t)(DMAMUX_CHCFG_SOURCE(source) | DMAMUX_CHCFG_ENBL_MASK);
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_RegisterCallback(uint8_t channel, HAL_DMA_Callback_t callback, void *param)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        s_callback[channel]      = callback;
+        s_callbackParam[channel] = param;
+
+        if (NULL != callback)
+        {
+            HAL_NVIC_EnableIRQ((IRQn_Type)((uint32_t)DMA0_IRQn + channel));
+        }
+        else
+        {
+            HAL_NVIC_DisableIRQ((IRQn_Type)((uint32_t)DMA0_IRQn + channel));
+        }
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_ConfigTransfer(uint8_t channel, const HAL_DMA_Transfer_t *transfer)
+{
+    if ((channel < HAL_DMA_CHANNEL_COUNT) && (NULL != transfer))
+    {
+        IP_DMA->TCD[channel].CSR          = 0U;
+        IP_DMA->TCD[channel].SADDR        = transfer->srcAddr;
+        IP_DMA->TCD[channel].SOFF         = (uint16_t)transfer->srcOffset;
+        IP_DMA->TCD[channel].ATTR         = (uint16_t)(DMA_TCD_ATTR_SSIZE(transfer->srcSize) |
+                                                       DMA_TCD_ATTR_DSIZE(transfer->dstSize));
+        IP_DMA->TCD[channel].NBYTES.MLNO  = transfer->minorBytes;
+        IP_DMA->TCD[channel].SLAST        = (uint32_t)transfer->srcLastAdj;
+        IP_DMA->TCD[channel].DADDR        = transfer->dstAddr;
+        IP_DMA->TCD[channel].DOFF         = (uint16_t)transfer->dstOffset;
+        IP_DMA->TCD[channel].CITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(transfer->majorCount);
+        IP_DMA->TCD[channel].BITER.ELINKNO = DMA_TCD_BITER_ELINKNO_BITER(transfer->majorCount);
+        IP_DMA->TCD[channel].DLASTSGA     = (uint32_t)transfer->dstLastAdj;
+        IP_DMA->TCD[channel].CSR          = transfer->flags;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_DMA_SetMinorLoopOffset(uint8_t channel, int32_t offset, uint8_t target)
+{
+    uint32_t nbytes;
+
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        nbytes = IP_DMA->TCD[channel].NBYTES.MLOFFYES & DMA_TCD_NBYTES_MLOFFYES_NBYTES_MASK;
+
+        IP_DMA->TCD[channel].NBYTES.MLOFFYES = DMA_TCD_NBYTES_MLOFFYES_SMLOE((target & HAL_DMA_MLOFF_SRC) != 0U) |
+                                               DMA_TCD_NBYTES_MLOFFYES_DMLOE((target & HAL_DMA_MLOFF_DST) != 0U) |
+                                               DMA_TCD_NBYTES_MLOFFYES_MLOFF((uint32_t)offset) |
+                                               DMA_TCD_NBYTES_MLOFFYES_NBYTES(nbytes);
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_Reload(uint8_t channel, uint32_t srcAddr, uint32_t dstAddr, uint16_t majorCount)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        /* Clearing DONE also allows the next request to be accepted. */
+        IP_DMA->CDNE = channel;
+        IP_DMA->TCD[channel].SADDR         = srcAddr;
+        IP_DMA->TCD[channel].DADDR         = dstAddr;
+        IP_DMA->TCD[channel].CITER.ELINKNO = DMA_TCD_CITER_ELINKNO_CITER(majorCount);
+        IP_DMA->TCD[channel].BITER.ELINKNO = DMA_TCD_BITER_ELINKNO_BITER(majorCount);
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_EnableRequest(uint8_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        IP_DMA->SERQ = channel;
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_DisableRequest(uint8_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        IP_DMA->CERQ = channel;
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_SoftwareStart(uint8_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        IP_DMA->SSRT = channel;
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+uint16_t HAL_DMA_GetRemaining(uint8_t channel)
+{
+    uint16_t remaining;
+
+    remaining = 0U;
+
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        remaining = (uint16_t)(IP_DMA->TCD[channel].CITER.ELINKNO & DMA_TCD_CITER_ELINKNO_CITER_MASK);
+    }
+    else
+    {
+        /* Invalid channel, keep remaining = 0U */
+    }
+
+    return remaining;
+}
+
+uint8_t HAL_DMA_IsIntPending(uint8_t channel)
+{
+    uint8_t pending;
+
+    pending = 0U;
+
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        pending = ((IP_DMA->INT & (1UL << channel)) != 0U) ? 1U : 0U;
+    }
+    else
+    {
+        /* Invalid channel, keep pending = 0U */
+    }
+
+    return pending;
+}
+
+/*******************************************************************************
+ * Interrupt handlers
+ ******************************************************************************/
+
+static void DMA_ChannelIRQ(uint8_t channel)
+{
+    uint32_t event;
+
+    IP_DMA->CINT = channel;
+
+    /* DONE is only set at the end of the major loop, otherwise it was INTHALF. */
+    if ((IP_DMA->TCD[channel].CSR & DMA_TCD_CSR_DONE_MASK) != 0U)
+    {
+        event = HAL_DMA_EVENT_MAJOR_DONE;
+    }
+    else
+    {
+        event = HAL_DMA_EVENT_HALF_DONE;
+    }
+
+    if (NULL != s_callback[channel])
+    {
+        s_callback[channel](channel, event, s_callbackParam[channel]);
+    }
+    else
+    {
+        /* No user, do nothing */
+    }
+}
+
+void DMA0_IRQHandler(void)  { DMA_ChannelIRQ(0U);  }
+void DMA1_IRQHandler(void)  { DMA_ChannelIRQ(1U);  }
+void DMA2_IRQHandler(void)  { DMA_ChannelIRQ(2U);  }
+void DMA3_IRQHandler(void)  { DMA_ChannelIRQ(3U);  }
+void DMA4_IRQHandler(void)  { DMA_ChannelIRQ(4U);  }
+void DMA5_IRQHandler(void)  { DMA_ChannelIRQ(5U);  }
+void DMA6_IRQHandler(void)  { DMA_ChannelIRQ(6U);  }
+void DMA7_IRQHandler(void)  { DMA_ChannelIRQ(7U);  }
+void DMA8_IRQHandler(void)  { DMA_ChannelIRQ(8U);  }
+void DMA9_IRQHandler(void)  { DMA_ChannelIRQ(9U);  }
+void DMA10_IRQHandler(void) { DMA_ChannelIRQ(10U); }
+void DMA11_IRQHandler(void) { DMA_ChannelIRQ(11U); }
+void DMA12_IRQHandler(void) { DMA_ChannelIRQ(12U); }
+void DMA13_IRQHandler(void) { DMA_ChannelIRQ(13U); }
+void DMA14_IRQHandler(void) { DMA_ChannelIRQ(14U); }
+void DMA15_IRQHandler(void) { DMA_ChannelIRQ(15U); }
+
+void DMA_Error_IRQHandler(void)
+{
+    uint32_t errors;
+    uint8_t channel;
+
+    errors = IP_DMA->ERR;
+
+    for (channel = 0U; channel < HAL_DMA_CHANNEL_COUNT; channel++)
+    {
+        if ((errors & (1UL << channel)) != 0U)
+        {
+            IP_DMA->CERQ = channel;
+            IP_DMA->CERR = channel;
+
+            if (NULL != s_callback[channel])
+            {
+                s_callback[channel](channel, HAL_DMA_EVENT_ERROR, s_callbackParam[channel]);
+            }
+            else
+            {
+                /* No user, do nothing */
+            }
+        }
+        else
+        {
+            /* No error on this channel */
+        }
+    }
+}
@@ -0,0 +1,615 @@
+/*******************************************************************************
+ * @file    HAL_FLEXCAN.c
+ * @brief   Hardware abstraction layer for FlexCAN C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "HAL_FLEXCAN.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FLEXCAN_MB_WORDS            (4U)        /**< CS + ID + 8 payload bytes */
+#define FLEXCAN_MB_HEADER_WORDS     (2U)        /**< CS + ID */
+#define FLEXCAN_RXFIFO_FILTER_WORD  (6U * FLEXCAN_MB_WORDS)
+#define FLEXCAN_TDC_OFFSET_MAX      (31U)
+
+#define FLEXCAN_ESR1_W1C_MASK       (FLEXCAN_ESR1_ERRINT_MASK | FLEXCAN_ESR1_BOFFINT_MASK | \
+                                     FLEXCAN_ESR1_RWRNINT_MASK | FLEXCAN_ESR1_TWRNINT_MASK | \
+                                     FLEXCAN_ESR1_BOFFDONEINT_MASK | FLEXCAN_ESR1_ERRINT_FAST_MASK | \
+                                     FLEXCAN_ESR1_ERROVR_MASK)
+
+#define FLEXCAN_IS_AVAILABLE(n)     ((uint32_t)(n) < (uint32_t)HAL_FLEXCAN_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static FLEXCAN_Type * const s_flexcanBase[HAL_FLEXCAN_MAX] = IP_FLEXCAN_BASE_PTRS;
+
+static const uint8_t s_flexcanPccIndex[HAL_FLEXCAN_MAX] =
+{
+    PCC_FlexCAN0_INDEX,
+    PCC_FlexCAN1_INDEX,
+    PCC_FlexCAN2_INDEX
+};
+
+static const uint8_t s_flexcanMbCount[HAL_FLEXCAN_MAX] = FEATURE_CAN_MAX_MB_NUM_ARRAY;
+
+static const uint8_t s_flexcanHasFd[HAL_FLEXCAN_MAX] =
+{
+    FEATURE_CAN0_HAS_FD,
+    FEATURE_CAN1_HAS_FD,
+    FEATURE_CAN2_HAS_FD
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t FLEXCAN_GetMbWords(const FLEXCAN_Type *base);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_FLEXCAN_Init(HAL_FLEXCAN_Instance_t instance)
+{
+    FLEXCAN_Type *base;
+    uint32_t i;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        base = s_flexcanBase[instance];
+
+        IP_PCC->PCCn[s_flexcanPccIndex[instance]] |= PCC_PCCn_CGC_MASK;
+
+        /* The clock source may only be selected while the module is disabled. */
+        base->MCR |= FLEXCAN_MCR_MDIS_MASK;
+        while (0U == (base->MCR & FLEXCAN_MCR_LPMACK_MASK))
+        {
+            /* Wait for low-power acknowledge */
+        }
+        base->CTRL1 |= FLEXCAN_CTRL1_CLKSRC_MASK;
+
+        base->MCR &= ~FLEXCAN_MCR_MDIS_MASK;
+        while (0U != (base->MCR & FLEXCAN_MCR_LPMACK_MASK))
+        {
+            /* Wait for the module to leave low-power mode */
+        }
+
+        base->MCR |= FLEXCAN_MCR_SOFTRST_MASK;
+        while (0U != (base->MCR & FLEXCAN_MCR_SOFTRST_MASK))
+        {
+            /* Wait for the soft reset to complete */
+        }
+
+        HAL_FLEXCAN_EnterFreeze(instance);
+
+        /* MB RAM and masks are not reset: start from a known state. */
+        for (i = 0U; i < ((uint32_t)s_flexcanMbCount[instance] * FLEXCAN_MB_WORDS); i++)
+        {
+            base->RAMn[i] = 0U;
+        }
+        for (i = 0U; i < FLEXCAN_RXIMR_COUNT; i++)
+        {
+            base->RXIMR[i] = 0xFFFFFFFFUL;
+        }
+        base->RXMGMASK = 0xFFFFFFFFUL;
+        base->RXFGMASK = 0xFFFFFFFFUL;
+
+        /* Individual masks, abort support, warning interrupts, own frames not received. */
+        base->MCR = (base->MCR & ~FLEXCAN_MCR_MAXMB_MASK) |
+                    FLEXCAN_MCR_MAXMB((uint32_t)s_flexcanMbCount[instance] - 1UL) |
+                    FLEXCAN_MCR_IRMQ_MASK | FLEXCAN_MCR_AEN_MASK |
+                    FLEXCAN_MCR_WRNEN_MASK | FLEXCAN_MCR_SRXDIS_MASK;
+
+        base->IMASK1 = 0U;
+        base->IFLAG1 = 0xFFFFFFFFUL;
+        base->ESR1   = FLEXCAN_ESR1_W1C_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_Deinit(HAL_FLEXCAN_Instance_t instance)
+{
+    FLEXCAN_Type *base;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        base = s_flexcanBase[instance];
+
+        HAL_FLEXCAN_EnterFreeze(instance);
+        base->IMASK1 = 0U;
+        base->CTRL1 &= ~(FLEXCAN_CTRL1_BOFFMSK_MASK | FLEXCAN_CTRL1_ERRMSK_MASK |
+                         FLEXCAN_CTRL1_TWRNMSK_MASK | FLEXCAN_CTRL1_RWRNMSK_MASK);
+
+        base->MCR |= FLEXCAN_MCR_MDIS_MASK;
+        while (0U == (base->MCR & FLEXCAN_MCR_LPMACK_MASK))
+        {
+            /* Wait for low-power acknowledge */
+        }
+
+        IP_PCC->PCCn[s_flexcanPccIndex[instance]] &= ~PCC_PCCn_CGC_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint8_t HAL_FLEXCAN_GetMbCount(HAL_FLEXCAN_Instance_t instance)
+{
+    uint8_t count;
+
+    count = 0U;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        count = (uint8_t)(((uint32_t)s_flexcanMbCount[instance] * FLEXCAN_MB_WORDS) /
+                          FLEXCAN_GetMbWords(s_flexcanBase[instance]));
+    }
+    else
+    {
+        /* Invalid instance, keep count = 0U */
+    }
+
+    return count;
+}
+
+uint8_t HAL_FLEXCAN_HasFd(HAL_FLEXCAN_Instance_t instance)
+{
+    uint8_t hasFd;
+
+    hasFd = 0U;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        hasFd = s_flexcanHasFd[instance];
+    }
+    else
+    {
+        /* Invalid instance, keep hasFd = 0U */
+    }
+
+    return hasFd;
+}
+
+void HAL_FLEXCAN_ConfigureFd(HAL_FLEXCAN_Instance_t instance, uint8_t payload)
+{
+    FLEXCAN_Type *base;
+    uint32_t sizeCode;
+    uint32_t i;
+
+    if (FLEXCAN_IS_AVAILABLE(instance) && (0U != s_flexcanHasFd[instance]) &&
+        ((0U == payload) || (8U == payload) || (16U == payload) || (32U == payload) || (64U == payload)))
+    {
+        base = s_flexcanBase[instance];
+
+        if (0U != payload)
+        {
+            for (sizeCode = 0U; (8UL << sizeCode) < payload; sizeCode++)
+            {
+                /* MBDSR0 = log2(payload / 8) */
+            }
+
+            base->MCR    = (base->MCR & ~FLEXCAN_MCR_RFEN_MASK) | FLEXCAN_MCR_FDEN_MASK;
+            base->CTRL2 |= FLEXCAN_CTRL2_ISOCANFDEN_MASK;
+            base->FDCTRL = (base->FDCTRL & ~FLEXCAN_FDCTRL_MBDSR0_MASK) | FLEXCAN_FDCTRL_MBDSR0(sizeCode);
+        }
+        else
+        {
+            base->MCR    &= ~(FLEXCAN_MCR_FDEN_MASK | FLEXCAN_MCR_RFEN_MASK);
+            base->FDCTRL &= ~(FLEXCAN_FDCTRL_MBDSR0_MASK | FLEXCAN_FDCTRL_FDRATE_MASK | FLEXCAN_FDCTRL_TDCEN_MASK);
+        }
+
+        /* Old message buffer boundaries are meaningless with the new stride. */
+        for (i = 0U; i < ((uint32_t)s_flexcanMbCount[instance] * FLEXCAN_MB_WORDS); i++)
+        {
+            base->RAMn[i] = 0U;
+        }
+
+        base->MCR    = (base->MCR & ~FLEXCAN_MCR_MAXMB_MASK) |
+                       FLEXCAN_MCR_MAXMB((uint32_t)HAL_FLEXCAN_GetMbCount(instance) - 1UL);
+        base->IMASK1 = 0U;
+        base->IFLAG1 = 0xFFFFFFFFUL;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint8_t HAL_FLEXCAN_GetPayloadSize(HAL_FLEXCAN_Instance_t instance)
+{
+    uint8_t size;
+
+    size = 0U;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        size = (uint8_t)((FLEXCAN_GetMbWords(s_flexcanBase[instance]) - FLEXCAN_MB_HEADER_WORDS) * 4UL);
+    }
+    else
+    {
+        /* Invalid instance, keep size = 0U */
+    }
+
+    return size;
+}
+
+void HAL_FLEXCAN_EnterFreeze(HAL_FLEXCAN_Instance_t instance)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        s_flexcanBase[instance]->MCR |= FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK;
+        while (0U == (s_flexcanBase[instance]->MCR & FLEXCAN_MCR_FRZACK_MASK))
+        {
+            /* Wait for the end of the current frame */
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_ExitFreeze(HAL_FLEXCAN_Instance_t instance)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        s_flexcanBase[instance]->MCR &= ~(FLEXCAN_MCR_FRZ_MASK | FLEXCAN_MCR_HALT_MASK);
+        while (0U != (s_flexcanBase[instance]->MCR & FLEXCAN_MCR_FRZACK_MASK))
+        {
+            /* Wait for the module to synchronise to the bus */
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetTiming(HAL_FLEXCAN_Instance_t instance, const HAL_FLEXCAN_Timing_t *timing)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance) && (NULL != timing))
+    {
+        /* Extended bit timing: wider fields than CTRL1, all values minus one. */
+        s_flexcanBase[instance]->CBT = FLEXCAN_CBT_BTF_MASK |
+                                       FLEXCAN_CBT_EPRESDIV((uint32_t)timing->preDivider - 1UL) |
+                                       FLEXCAN_CBT_EPROPSEG((uint32_t)timing->propSeg - 1UL) |
+                                       FLEXCAN_CBT_EPSEG1((uint32_t)timing->phaseSeg1 - 1UL) |
+                                       FLEXCAN_CBT_EPSEG2((uint32_t)timing->phaseSeg2 - 1UL) |
+                                       FLEXCAN_CBT_ERJW((uint32_t)timing->sjw - 1UL);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetDataTiming(HAL_FLEXCAN_Instance_t instance, const HAL_FLEXCAN_Timing_t *timing)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance) && (0U != s_flexcanHasFd[instance]) && (NULL != timing))
+    {
+        /* FPROPSEG is in time quanta as is, the other fields minus one. */
+        s_flexcanBase[instance]->FDCBT = FLEXCAN_FDCBT_FPRESDIV((uint32_t)timing->preDivider - 1UL) |
+                                         FLEXCAN_FDCBT_FPROPSEG(timing->propSeg) |
+                                         FLEXCAN_FDCBT_FPSEG1((uint32_t)timing->phaseSeg1 - 1UL) |
+                                         FLEXCAN_FDCBT_FPSEG2((uint32_t)timing->phaseSeg2 - 1UL) |
+                                         FLEXCAN_FDCBT_FRJW((uint32_t)timing->sjw - 1UL);
+        s_flexcanBase[instance]->FDCTRL |= FLEXCAN_FDCTRL_FDRATE_MASK;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetTdc(HAL_FLEXCAN_Instance_t instance, uint8_t offset)
+{
+    FLEXCAN_Type *base;
+
+    if (FLEXCAN_IS_AVAILABLE(instance) && (0U != s_flexcanHasFd[instance]) && (offset <= FLEXCAN_TDC_OFFSET_MAX))
+    {
+        base = s_flexcanBase[instance];
+
+        base->FDCTRL &= ~(FLEXCAN_FDCTRL_TDCEN_MASK | FLEXCAN_FDCTRL_TDCOFF_MASK);
+
+        if (0U != offset)
+        {
+            base->FDCTRL |= FLEXCAN_FDCTRL_TDCEN_MASK | FLEXCAN_FDCTRL_TDCOFF(offset);
+        }
+        else
+        {
+            /* Compensation off */
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetMode(HAL_FLEXCAN_Instance_t instance, HAL_FLEXCAN_Mode_t mode)
+{
+    FLEXCAN_Type *base;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        base = s_flexcanBase[instance];
+
+        base->CTRL1 &= ~(FLEXCAN_CTRL1_LPB_MASK | FLEXCAN_CTRL1_LOM_MASK);
+        base->MCR   |= FLEXCAN_MCR_SRXDIS_MASK;
+
+        switch (mode)
+        {
+            case HAL_FLEXCAN_MODE_SELF_RECEPTION:
+                base->MCR &= ~FLEXCAN_MCR_SRXDIS_MASK;
+                break;
+
+            case HAL_FLEXCAN_MODE_LISTEN_ONLY:
+                base->CTRL1 |= FLEXCAN_CTRL1_LOM_MASK;
+                break;
+
+            case HAL_FLEXCAN_MODE_LOOPBACK:
+                /* Looped back frames are received like any other: self reception on. */
+                base->MCR   &= ~FLEXCAN_MCR_SRXDIS_MASK;
+                base->CTRL1 |= FLEXCAN_CTRL1_LPB_MASK;
+                break;
+
+            default:
+                /* Normal mode */
+                break;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_EnableRxFifo(HAL_FLEXCAN_Instance_t instance, uint8_t rffn)
+{
+    FLEXCAN_Type *base;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        base = s_flexcanBase[instance];
+
+        base->MCR   = (base->MCR & ~FLEXCAN_MCR_IDAM_MASK) | FLEXCAN_MCR_RFEN_MASK | FLEXCAN_MCR_IDAM(0U);
+        base->CTRL2 = (base->CTRL2 & ~FLEXCAN_CTRL2_RFFN_MASK) | FLEXCAN_CTRL2_RFFN(rffn);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetRxFifoFilter(HAL_FLEXCAN_Instance_t instance, uint8_t index, uint32_t element)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance) && ((FLEXCAN_RXFIFO_FILTER_WORD + index) < FLEXCAN_RAMn_COUNT))
+    {
+        s_flexcanBase[instance]->RAMn[FLEXCAN_RXFIFO_FILTER_WORD + index] = element;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetIndividualMask(HAL_FLEXCAN_Instance_t instance, uint8_t index, uint32_t mask)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance) && (index < FLEXCAN_RXIMR_COUNT))
+    {
+        s_flexcanBase[instance]->RXIMR[index] = mask;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_SetRxFifoGlobalMask(HAL_FLEXCAN_Instance_t instance, uint32_t mask)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        s_flexcanBase[instance]->RXFGMASK = mask;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+volatile uint32_t *HAL_FLEXCAN_GetMb(HAL_FLEXCAN_Instance_t instance, uint8_t mb)
+{
+    volatile uint32_t *address;
+
+    address = NULL;
+
+    if (FLEXCAN_IS_AVAILABLE(instance) && (mb < HAL_FLEXCAN_GetMbCount(instance)))
+    {
+        address = &s_flexcanBase[instance]->RAMn[(uint32_t)mb * FLEXCAN_GetMbWords(s_flexcanBase[instance])];
+    }
+    else
+    {
+        /* Invalid parameter, keep address = NULL */
+    }
+
+    return address;
+}
+
+void HAL_FLEXCAN_UnlockMb(HAL_FLEXCAN_Instance_t instance)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        (void)s_flexcanBase[instance]->TIMER;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_EnableMbInterrupt(HAL_FLEXCAN_Instance_t instance, uint8_t mb, uint8_t enable)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance) && (mb < 32U))
+    {
+        if (0U != enable)
+        {
+            s_flexcanBase[instance]->IMASK1 |= (1UL << mb);
+        }
+        else
+        {
+            s_flexcanBase[instance]->IMASK1 &= ~(1UL << mb);
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint32_t HAL_FLEXCAN_GetMbFlags(HAL_FLEXCAN_Instance_t instance)
+{
+    uint32_t flags;
+
+    flags = 0U;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        flags = s_flexcanBase[instance]->IFLAG1 & s_flexcanBase[instance]->IMASK1;
+    }
+    else
+    {
+        /* Invalid instance, keep flags = 0U */
+    }
+
+    return flags;
+}
+
+uint32_t HAL_FLEXCAN_GetRawMbFlags(HAL_FLEXCAN_Instance_t instance)
+{
+    uint32_t flags;
+
+    flags = 0U;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        flags = s_flexcanBase[instance]->IFLAG1;
+    }
+    else
+    {
+        /* Invalid instance, keep flags = 0U */
+    }
+
+    return flags;
+}
+
+void HAL_FLEXCAN_ClearMbFlags(HAL_FLEXCAN_Instance_t instance, uint32_t mask)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        s_flexcanBase[instance]->IFLAG1 = mask;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_EnableStateInterrupts(HAL_FLEXCAN_Instance_t instance, uint8_t enable)
+{
+    FLEXCAN_Type *base;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        base = s_flexcanBase[instance];
+
+        if (0U != enable)
+        {
+            base->CTRL1 |= FLEXCAN_CTRL1_BOFFMSK_MASK | FLEXCAN_CTRL1_TWRNMSK_MASK | FLEXCAN_CTRL1_RWRNMSK_MASK;
+            base->CTRL2 |= FLEXCAN_CTRL2_BOFFDONEMSK_MASK;
+        }
+        else
+        {
+            base->CTRL1 &= ~(FLEXCAN_CTRL1_BOFFMSK_MASK | FLEXCAN_CTRL1_TWRNMSK_MASK | FLEXCAN_CTRL1_RWRNMSK_MASK);
+            base->CTRL2 &= ~FLEXCAN_CTRL2_BOFFDONEMSK_MASK;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_FLEXCAN_GetErrorStatus(HAL_FLEXCAN_Instance_t instance)
+{
+    uint32_t status;
+
+    status = 0U;
+
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        status = s_flexcanBase[instance]->ESR1;
+    }
+    else
+    {
+        /* Invalid instance, keep status = 0U */
+    }
+
+    return status;
+}
+
+void HAL_FLEXCAN_ClearErrorStatus(HAL_FLEXCAN_Instance_t instance, uint32_t mask)
+{
+    if (FLEXCAN_IS_AVAILABLE(instance))
+    {
+        s_flexcanBase[instance]->ESR1 = mask & FLEXCAN_ESR1_W1C_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FLEXCAN_GetErrorCounters(HAL_FLEXCAN_Instance_t instance, uint8_t *txErrors, uint8_t *rxErrors)
+{
+    uint32_t ecr;
+
+    if (FLEXCAN_IS_AVAILABLE(instance) && (NULL != txErrors) && (NULL != rxErrors))
+    {
+        ecr = s_flexcanBase[instance]->ECR;
+        *txErrors = (uint8_t)((ecr & FLEXCAN_ECR_TXERRCNT_MASK) >> FLEXCAN_ECR_TXERRCNT_SHIFT);
+        *rxErrors = (uint8_t)((ecr & FLEXCAN_ECR_RXERRCNT_MASK) >> FLEXCAN_ECR_RXERRCNT_SHIFT);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+static uint32_t FLEXCAN_GetMbWords(const FLEXCAN_Type *base)
+{
+    uint32_t words;
+
+    words = FLEXCAN_MB_WORDS;
+
+    if (0U != (base->MCR & FLEXCAN_MCR_FDEN_MASK))
+    {
+        /* MBDSR0: 8 << n payload bytes */
+        words = FLEXCAN_MB_HEADER_WORDS +
+                (2UL << ((base->FDCTRL & FLEXCAN_FDCTRL_MBDSR0_MASK) >> FLEXCAN_FDCTRL_MBDSR0_SHIFT));
+    }
+    else
+    {
+        /* Classic CAN: 8 payload bytes */
+    }
+
+    return words;
+}
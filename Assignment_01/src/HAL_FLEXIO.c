@@ -0,0 +1,453 @@
+/*******************************************************************************
+ * @file    HAL_FLEXIO.c
+ * @brief   Hardware abstraction layer for FlexIO C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "HAL_FLEXIO.h"
+#include "HAL_SCG.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FLEXIO_SHIFTER_IS_VALID(n)  ((n) < HAL_FLEXIO_SHIFTER_COUNT)
+#define FLEXIO_TIMER_IS_VALID(n)    ((n) < HAL_FLEXIO_TIMER_COUNT)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/** Bit n set = shifter / timer n reserved. */
+static uint8_t s_shifterUsed = 0U;
+static uint8_t s_timerUsed = 0U;
+
+/** Initialization done flag. */
+static uint8_t s_flexioInitialized = 0U;
+
+static HAL_FLEXIO_Callback_t s_callback[HAL_FLEXIO_SHIFTER_COUNT];
+static void *s_callbackParam[HAL_FLEXIO_SHIFTER_COUNT];
+
+static const dma_request_source_t s_flexioDmaRequest[HAL_FLEXIO_SHIFTER_COUNT] =
+{
+    EDMA_REQ_FLEXIO_SHIFTER0,
+    EDMA_REQ_FLEXIO_SHIFTER1,
+    EDMA_REQ_FLEXIO_SHIFTER2,
+    EDMA_REQ_FLEXIO_SHIFTER3
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_FLEXIO_Init(void)
+{
+    if (0U == s_flexioInitialized)
+    {
+        HAL_SCG_ClockFromFircDiv2(PCC_FlexIO_INDEX);
+
+        IP_FLEXIO->CTRL = FLEXIO_CTRL_SWRST_MASK;
+        IP_FLEXIO->CTRL = 0U;
+
+        /* Run in debug mode too, a stopped shifter would corrupt the frames. */
+        IP_FLEXIO->CTRL = FLEXIO_CTRL_FLEXEN_MASK | FLEXIO_CTRL_DBGE_MASK;
+
+        s_flexioInitialized = 1U;
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+}
+
+uint8_t HAL_FLEXIO_AllocShifter(void)
+{
+    uint8_t shifter;
+    uint8_t index;
+
+    shifter = HAL_FLEXIO_INVALID;
+
+    for (index = 0U; index < HAL_FLEXIO_SHIFTER_COUNT; index++)
+    {
+        if (0U == (s_shifterUsed & (1U << index)))
+        {
+            s_shifterUsed |= (uint8_t)(1U << index);
+            shifter = index;
+            break;
+        }
+    }
+
+    return shifter;
+}
+
+void HAL_FLEXIO_FreeShifter(uint8_t shifter)
+{
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        HAL_FLEXIO_RegisterCallback(shifter, NULL, NULL);
+        HAL_FLEXIO_EnableIrq(shifter, 0U);
+        HAL_FLEXIO_EnableDma(shifter, 0U);
+        IP_FLEXIO->SHIFTCTL[shifter] = 0U;
+        s_shifterUsed &= (uint8_t)~(1U << shifter);
+    }
+    else
+    {
+        /* Invalid shifter, do nothing */
+    }
+}
+
+uint8_t HAL_FLEXIO_AllocTimer(void)
+{
+    uint8_t timer;
+    uint8_t index;
+
+    timer = HAL_FLEXIO_INVALID;
+
+    for (index = 0U; index < HAL_FLEXIO_TIMER_COUNT; index++)
+    {
+        if (0U == (s_timerUsed & (1U << index)))
+        {
+            s_timerUsed |= (uint8_t)(1U << index);
+            timer = index;
+            break;
+        }
+    }
+
+    return timer;
+}
+
+void HAL_FLEXIO_FreeTimer(uint8_t timer)
+{
+    if (FLEXIO_TIMER_IS_VALID(timer))
+    {
+        IP_FLEXIO->TIMCTL[timer] = 0U;
+        s_timerUsed &= (uint8_t)~(1U << timer);
+    }
+    else
+    {
+        /* Invalid timer, do nothing */
+    }
+}
+
+void HAL_FLEXIO_SetShifter(uint8_t shifter, const HAL_FLEXIO_Shifter_t *config)
+{
+    if (FLEXIO_SHIFTER_IS_VALID(shifter) && (NULL != config))
+    {
+        /* Configuration first: a transmit shifter drives its pin as soon as SMOD is set. */
+        IP_FLEXIO->SHIFTCTL[shifter] = 0U;
+        IP_FLEXIO->SHIFTCFG[shifter] = FLEXIO_SHIFTCFG_SSTART(config->startBit) |
+                                       FLEXIO_SHIFTCFG_SSTOP(config->stopBit);
+        IP_FLEXIO->SHIFTCTL[shifter] = FLEXIO_SHIFTCTL_TIMSEL(config->timer) |
+                                       FLEXIO_SHIFTCTL_TIMPOL(config->timerFalling) |
+                                       FLEXIO_SHIFTCTL_PINCFG(config->pinConfig) |
+                                       FLEXIO_SHIFTCTL_PINSEL(config->pin) |
+                                       FLEXIO_SHIFTCTL_PINPOL(config->pinInvert) |
+                                       FLEXIO_SHIFTCTL_SMOD(config->mode);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXIO_SetTimer(uint8_t timer, const HAL_FLEXIO_Timer_t *config)
+{
+    if (FLEXIO_TIMER_IS_VALID(timer) && (NULL != config))
+    {
+        IP_FLEXIO->TIMCTL[timer] = 0U;
+        IP_FLEXIO->TIMCMP[timer] = config->compare;
+        IP_FLEXIO->TIMCFG[timer] = FLEXIO_TIMCFG_TIMOUT(config->output) |
+                                   FLEXIO_TIMCFG_TIMDEC(config->decrement) |
+                                   FLEXIO_TIMCFG_TIMRST(config->reset) |
+                                   FLEXIO_TIMCFG_TIMDIS(config->disable) |
+                                   FLEXIO_TIMCFG_TIMENA(config->enable) |
+                                   FLEXIO_TIMCFG_TSTOP(config->stopBit) |
+                                   FLEXIO_TIMCFG_TSTART(config->startBit);
+        IP_FLEXIO->TIMCTL[timer] = FLEXIO_TIMCTL_TRGSEL(config->trigger) |
+                                   FLEXIO_TIMCTL_TRGPOL(config->triggerLow) |
+                                   FLEXIO_TIMCTL_TRGSRC(1U) |
+                                   FLEXIO_TIMCTL_PINCFG(config->pinConfig) |
+                                   FLEXIO_TIMCTL_PINSEL(config->pin) |
+                                   FLEXIO_TIMCTL_PINPOL(config->pinInvert) |
+                                   FLEXIO_TIMCTL_TIMOD(config->mode);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FLEXIO_WriteBuffer(uint8_t shifter, uint8_t view, uint32_t data)
+{
+    uint32_t address;
+
+    address = HAL_FLEXIO_GetBufferAddress(shifter, view);
+
+    if (0U != address)
+    {
+        *(volatile uint32_t *)address = data;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint32_t HAL_FLEXIO_ReadBuffer(uint8_t shifter, uint8_t view)
+{
+    uint32_t address;
+    uint32_t data;
+
+    data    = 0U;
+    address = HAL_FLEXIO_GetBufferAddress(shifter, view);
+
+    if (0U != address)
+    {
+        data = *(volatile uint32_t *)address;
+    }
+    else
+    {
+        /* Invalid parameter, keep data = 0U */
+    }
+
+    return data;
+}
+
+uint32_t HAL_FLEXIO_GetBufferAddress(uint8_t shifter, uint8_t view)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        switch (view)
+        {
+            case HAL_FLEXIO_BUFFER_NORMAL:
+            {
+                address = (uint32_t)&IP_FLEXIO->SHIFTBUF[shifter];
+                break;
+            }
+
+            case HAL_FLEXIO_BUFFER_BIT_SWAP:
+            {
+                address = (uint32_t)&IP_FLEXIO->SHIFTBUFBIS[shifter];
+                break;
+            }
+
+            case HAL_FLEXIO_BUFFER_BYTE_SWAP:
+            {
+                address = (uint32_t)&IP_FLEXIO->SHIFTBUFBYS[shifter];
+                break;
+            }
+
+            case HAL_FLEXIO_BUFFER_BIT_BYTE_SWAP:
+            {
+                address = (uint32_t)&IP_FLEXIO->SHIFTBUFBBS[shifter];
+                break;
+            }
+
+            default:
+            {
+                /* Invalid view, keep address = 0U */
+                break;
+            }
+        }
+    }
+    else
+    {
+        /* Invalid shifter, keep address = 0U */
+    }
+
+    return address;
+}
+
+uint8_t HAL_FLEXIO_IsShifterReady(uint8_t shifter)
+{
+    uint8_t ready;
+
+    ready = 0U;
+
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        ready = (uint8_t)((IP_FLEXIO->SHIFTSTAT >> shifter) & 1U);
+    }
+    else
+    {
+        /* Invalid shifter, keep ready = 0U */
+    }
+
+    return ready;
+}
+
+uint8_t HAL_FLEXIO_TakeShifterError(uint8_t shifter)
+{
+    uint8_t error;
+
+    error = 0U;
+
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        error = (uint8_t)((IP_FLEXIO->SHIFTERR >> shifter) & 1U);
+
+        if (0U != error)
+        {
+            IP_FLEXIO->SHIFTERR = 1UL << shifter;
+        }
+        else
+        {
+            /* Nothing to clear */
+        }
+    }
+    else
+    {
+        /* Invalid shifter, keep error = 0U */
+    }
+
+    return error;
+}
+
+uint8_t HAL_FLEXIO_TakeTimerStatus(uint8_t timer)
+{
+    uint8_t status;
+
+    status = 0U;
+
+    if (FLEXIO_TIMER_IS_VALID(timer))
+    {
+        status = (uint8_t)((IP_FLEXIO->TIMSTAT >> timer) & 1U);
+
+        if (0U != status)
+        {
+            IP_FLEXIO->TIMSTAT = 1UL << timer;
+        }
+        else
+        {
+            /* Nothing to clear */
+        }
+    }
+    else
+    {
+        /* Invalid timer, keep status = 0U */
+    }
+
+    return status;
+}
+
+void HAL_FLEXIO_EnableDma(uint8_t shifter, uint8_t enable)
+{
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        if (0U != enable)
+        {
+            IP_FLEXIO->SHIFTSDEN |= 1UL << shifter;
+        }
+        else
+        {
+            IP_FLEXIO->SHIFTSDEN &= ~(1UL << shifter);
+        }
+    }
+    else
+    {
+        /* Invalid shifter, do nothing */
+    }
+}
+
+dma_request_source_t HAL_FLEXIO_GetDmaRequest(uint8_t shifter)
+{
+    return FLEXIO_SHIFTER_IS_VALID(shifter) ? s_flexioDmaRequest[shifter] : EDMA_REQ_DISABLED;
+}
+
+void HAL_FLEXIO_EnableIrq(uint8_t shifter, uint32_t status)
+{
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        if (0U != (status & HAL_FLEXIO_STATUS_SHIFTER))
+        {
+            IP_FLEXIO->SHIFTSIEN |= 1UL << shifter;
+        }
+        else
+        {
+            IP_FLEXIO->SHIFTSIEN &= ~(1UL << shifter);
+        }
+
+        if (0U != (status & HAL_FLEXIO_STATUS_ERROR))
+        {
+            IP_FLEXIO->SHIFTEIEN |= 1UL << shifter;
+        }
+        else
+        {
+            IP_FLEXIO->SHIFTEIEN &= ~(1UL << shifter);
+        }
+    }
+    else
+    {
+        /* Invalid shifter, do nothing */
+    }
+}
+
+void HAL_FLEXIO_RegisterCallback(uint8_t shifter, HAL_FLEXIO_Callback_t callback, void *param)
+{
+    uint8_t index;
+    uint8_t used;
+
+    if (FLEXIO_SHIFTER_IS_VALID(shifter))
+    {
+        s_callback[shifter]      = callback;
+        s_callbackParam[shifter] = param;
+
+        used = 0U;
+
+        for (index = 0U; index < HAL_FLEXIO_SHIFTER_COUNT; index++)
+        {
+            used |= (NULL != s_callback[index]) ? 1U : 0U;
+        }
+
+        if (0U != used)
+        {
+            HAL_NVIC_EnableIRQ(FLEXIO_IRQn);
+        }
+        else
+        {
+            HAL_NVIC_DisableIRQ(FLEXIO_IRQn);
+        }
+    }
+    else
+    {
+        /* Invalid shifter, do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Interrupt handlers
+ ******************************************************************************/
+
+void FLEXIO_IRQHandler(void)
+{
+    uint32_t flags;
+    uint32_t errors;
+    uint32_t status;
+    uint8_t shifter;
+
+    flags  = IP_FLEXIO->SHIFTSTAT & IP_FLEXIO->SHIFTSIEN;
+    errors = IP_FLEXIO->SHIFTERR & IP_FLEXIO->SHIFTEIEN;
+
+    /* Error flags are write 1 to clear; status flags follow the buffer. */
+    IP_FLEXIO->SHIFTERR = errors;
+
+    for (shifter = 0U; shifter < HAL_FLEXIO_SHIFTER_COUNT; shifter++)
+    {
+        status  = (0U != (flags & (1UL << shifter))) ? HAL_FLEXIO_STATUS_SHIFTER : 0U;
+        status |= (0U != (errors & (1UL << shifter))) ? HAL_FLEXIO_STATUS_ERROR : 0U;
+
+        if ((0U != status) && (NULL != s_callback[shifter]))
+        {
+            s_callback[shifter](shifter, status, s_callbackParam[shifter]);
+        }
+        else
+        {
+            /* Nothing pending for this shifter */
+        }
+    }
+}
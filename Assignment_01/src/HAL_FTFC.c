@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * @file    HAL_FTFC.c
+ * @brief   Hardware abstraction layer for the FTFC flash controller C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "HAL_FTFC.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTFC_DFLASH_ADDRESS         (0x00800000UL)  /**< FlexNVM in the FTFC address space */
+
+/*
+ * FCCOB registers are grouped big endian in 32-bit words: FCCOB0 is at
+ * offset 3 of the array, FCCOB3 at offset 0, FCCOB4 at offset 7 ...
+ */
+#define FTFC_FCCOB_INDEX(n)         ((uint8_t)(((n) & ~3U) + 3U - ((n) & 3U)))
+#define FTFC_FCCOB_DATA             (4U)            /**< Array offset of the phrase data */
+
+#define FTFC_IRQ_PRIORITY           (4U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* FlexNVM partition codes (SIM_FCFG1.DEPART): D-Flash size in KB */
+static const uint8_t s_dflashKb[16] =
+{
+    64U, 0U, 0U, 32U, 0U, 0U, 0U, 0U, 0U, 0U, 16U, 32U, 64U, 0U, 0U, 64U
+};
+
+/* EEPROM size codes (SIM_FCFG1.EEERAMSIZE): EEPROM bytes, 0xF = none, others reserved */
+static const uint16_t s_eeeBytes[16] =
+{
+    0U, 0U, 4096U, 2048U, 1024U, 512U, 256U, 128U, 64U, 32U, 0U, 0U, 0U, 0U, 0U, 0U
+};
+
+/** Initialization done flag. */
+static uint8_t s_ftfcInitialized = 0U;
+
+static HAL_FTFC_Callback_t s_callback = NULL;
+static void *s_callbackParam = NULL;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HAL_FTFC_Init(void)
+{
+    if (0U == s_ftfcInitialized)
+    {
+        /* CCIF is a level: the interrupt is only enabled while a command runs. */
+        HAL_FTFC_EnableCompleteInterrupt(0U);
+        HAL_NVIC_SetPriority(FTFC_CMD_IRQn, FTFC_IRQ_PRIORITY);
+        HAL_NVIC_ClearPendingIRQ(FTFC_CMD_IRQn);
+        HAL_NVIC_EnableIRQ(FTFC_CMD_IRQn);
+
+        s_ftfcInitialized = 1U;
+    }
+    else
+    {
+        /* Already initialized, do nothing */
+    }
+}
+
+uint8_t HAL_FTFC_Acquire(HAL_FTFC_Callback_t callback, void *param)
+{
+    uint8_t acquired;
+
+    DISABLE_INTERRUPTS();
+
+    if (NULL == s_callback)
+    {
+        s_callback      = callback;
+        s_callbackParam = param;
+        acquired        = 1U;
+    }
+    else
+    {
+        acquired = 0U;
+    }
+
+    ENABLE_INTERRUPTS();
+
+    return acquired;
+}
+
+void HAL_FTFC_Release(void)
+{
+    HAL_FTFC_EnableCompleteInterrupt(0U);
+
+    s_callbackParam = NULL;
+    s_callback      = NULL;
+}
+
+uint8_t HAL_FTFC_IsReady(void)
+{
+    return (0U != (IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK)) ? 1U : 0U;
+}
+
+uint8_t HAL_FTFC_GetErrors(void)
+{
+    return (uint8_t)(IP_FTFC->FSTAT & HAL_FTFC_ERROR_MASK);
+}
+
+void HAL_FTFC_ClearErrors(void)
+{
+    /* ACCERR / FPVIOL / RDCOLERR are write 1 to clear, MGSTAT0 clears on launch. */
+    IP_FTFC->FSTAT = (uint8_t)(FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_RDCOLERR_MASK);
+}
+
+uint8_t HAL_FTFC_IsDFlash(uint32_t address)
+{
+    return ((address >= HAL_FTFC_DFLASH_BASE) && ((address - HAL_FTFC_DFLASH_BASE) < HAL_FTFC_DFLASH_SIZE)) ? 1U : 0U;
+}
+
+uint32_t HAL_FTFC_GetDFlashSize(void)
+{
+    uint32_t depart;
+
+    depart = (IP_SIM->FCFG1 & SIM_FCFG1_DEPART_MASK) >> SIM_FCFG1_DEPART_SHIFT;
+
+    return (uint32_t)s_dflashKb[depart] * 1024UL;
+}
+
+uint32_t HAL_FTFC_GetEeeSize(void)
+{
+    uint32_t code;
+
+    code = (IP_SIM->FCFG1 & SIM_FCFG1_EEERAMSIZE_MASK) >> SIM_FCFG1_EEERAMSIZE_SHIFT;
+
+    return s_eeeBytes[code];
+}
+
+uint8_t HAL_FTFC_IsEeeReady(void)
+{
+    return (0U != (IP_FTFC->FCNFG & FTFC_FCNFG_EEERDY_MASK)) ? 1U : 0U;
+}
+
+void HAL_FTFC_SetCommand(uint8_t command, uint32_t address)
+{
+    if (0U != HAL_FTFC_IsDFlash(address))
+    {
+        address = FTFC_DFLASH_ADDRESS + (address - HAL_FTFC_DFLASH_BASE);
+    }
+    else
+    {
+        /* P-Flash: system and FTFC addresses are equal */
+    }
+
+    IP_FTFC->FCCOB[FTFC_FCCOB_INDEX(0U)] = command;
+    IP_FTFC->FCCOB[FTFC_FCCOB_INDEX(1U)] = (uint8_t)(address >> 16);
+    IP_FTFC->FCCOB[FTFC_FCCOB_INDEX(2U)] = (uint8_t)(address >> 8);
+    IP_FTFC->FCCOB[FTFC_FCCOB_INDEX(3U)] = (uint8_t)address;
+}
+
+void HAL_FTFC_SetParam(uint8_t index, uint8_t value)
+{
+    if ((index >= 4U) && (index < FTFC_FCCOB_COUNT))
+    {
+        IP_FTFC->FCCOB[FTFC_FCCOB_INDEX(index)] = value;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FTFC_SetPhrase(const uint8_t *data)
+{
+    uint8_t i;
+
+    /* Array order is memory order for the data bytes. */
+    for (i = 0U; i < HAL_FTFC_PHRASE_SIZE; i++)
+    {
+        IP_FTFC->FCCOB[FTFC_FCCOB_DATA + i] = data[i];
+    }
+}
+
+void HAL_FTFC_Launch(uint8_t wait)
+{
+    /* Writing CCIF starts the command, only register accesses until it completes. */
+    IP_FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+
+    if (0U != wait)
+    {
+        while (0U == (IP_FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK))
+        {
+            /* Wait in RAM */
+        }
+    }
+    else
+    {
+        /* Completion by interrupt */
+    }
+}
+
+void HAL_FTFC_EnableCompleteInterrupt(uint8_t enable)
+{
+    if (0U != enable)
+    {
+        IP_FTFC->FCNFG |= FTFC_FCNFG_CCIE_MASK;
+    }
+    else
+    {
+        IP_FTFC->FCNFG &= (uint8_t)~FTFC_FCNFG_CCIE_MASK;
+    }
+}
+
+void HAL_FTFC_InvalidateCache(void)
+{
+    IP_LMEM->PCCCR |= LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK | LMEM_PCCCR_GO_MASK;
+
+    while (0U != (IP_LMEM->PCCCR & LMEM_PCCCR_GO_MASK))
+    {
+        /* Wait for the cache command */
+    }
+}
+
+/*******************************************************************************
+ * Interrupt handlers
+ ******************************************************************************/
+
+void FTFC_IRQHandler(void)
+{
+    if (NULL != s_callback)
+    {
+        s_callback(s_callbackParam);
+    }
+    else
+    {
+        /* No owner, silence the source */
+        HAL_FTFC_EnableCompleteInterrupt(0U);
+    }
+}
@@ -0,0 +1,613 @@
+/*******************************************************************************
+ * @file    HAL_FTM.c
+ * @brief   Hardware abstraction layer for the FlexTimer module C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "HAL_FTM.h"
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FTM_IS_AVAILABLE(n)     ((uint32_t)(n) < (uint32_t)HAL_FTM_MAX)
+
+#define FTM_IRQ_CHANNEL_LINES   (4U)        /**< Ch0_Ch1 ... Ch6_Ch7 */
+#define FTM_IRQ_OVF_OFFSET      (5U)        /**< Ovf_Reload after the Fault line */
+#define FTM_COMBINE_PAIR_WIDTH  (8U)        /**< COMBINE bits per channel pair */
+#define FTM_FILTER_WIDTH        (4U)
+#define FTM_STATUS_CH_MASK      (0xFFUL)
+#define FTM_PAIR_FLAGS_MASK     (FTM_COMBINE_COMBINE0_MASK | FTM_COMBINE_COMP0_MASK | FTM_COMBINE_DTEN0_MASK | \
+                                 FTM_COMBINE_SYNCEN0_MASK)
+#define FTM_DEADTIME_VAL_MAX    (1023UL)    /**< DTVALEX:DTVAL */
+#define FTM_DEADTIME_VAL_LOW    (6U)        /**< DTVAL width */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static FTM_Type * const s_ftmBase[HAL_FTM_MAX] = IP_FTM_BASE_PTRS;
+
+static const uint8_t s_ftmPccIndex[HAL_FTM_MAX] =
+{
+    PCC_FTM0_INDEX,
+    PCC_FTM1_INDEX,
+    PCC_FTM2_INDEX,
+    PCC_FTM3_INDEX
+};
+
+/** First interrupt line (Ch0_Ch1) of each instance */
+static const IRQn_Type s_ftmIrq[HAL_FTM_MAX] =
+{
+    FTM0_Ch0_Ch1_IRQn,
+    FTM1_Ch0_Ch1_IRQn,
+    FTM2_Ch0_Ch1_IRQn,
+    FTM3_Ch0_Ch1_IRQn
+};
+
+static HAL_FTM_Callback_t s_callback[HAL_FTM_MAX];
+static void *s_callbackParam[HAL_FTM_MAX];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void FTM_IRQHandler(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_FTM_Init(HAL_FTM_Instance_t instance, uint8_t prescaler, uint16_t modulo)
+{
+    FTM_Type *base;
+    uint8_t channel;
+
+    if (FTM_IS_AVAILABLE(instance) && (prescaler <= HAL_FTM_PRESCALER_MAX))
+    {
+        base = s_ftmBase[instance];
+
+        IP_PCC->PCCn[s_ftmPccIndex[instance]] |= PCC_PCCn_CGC_MASK;
+
+        /* Counter stopped: MOD, CNTIN and CnV writes take effect at once. */
+        base->SC      = 0U;
+        base->MODE    = FTM_MODE_WPDIS_MASK | FTM_MODE_FTMEN_MASK;
+        base->COMBINE  = 0U;
+        base->FILTER   = 0U;
+        base->POL      = 0U;
+        base->OUTMASK  = 0U;
+        base->DEADTIME = 0U;
+        base->SYNC     = 0U;
+        base->SYNCONF  = 0U;
+        base->PWMLOAD  = 0U;
+        base->QDCTRL   = 0U;
+
+        for (channel = 0U; channel < HAL_FTM_CHANNEL_COUNT; channel++)
+        {
+            base->CONTROLS[channel].CnSC = 0U;
+            base->CONTROLS[channel].CnV  = 0U;
+        }
+
+        base->CNTIN = 0U;
+        base->MOD   = modulo;
+        base->CNT   = 0U;               /* Any write loads CNTIN */
+        base->SC    = FTM_SC_PS(prescaler);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FTM_Start(HAL_FTM_Instance_t instance)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        s_ftmBase[instance]->SC = (s_ftmBase[instance]->SC & ~FTM_SC_CLKS_MASK) | FTM_SC_CLKS(1U);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_Stop(HAL_FTM_Instance_t instance)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        s_ftmBase[instance]->SC &= ~FTM_SC_CLKS_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_SetCenterAligned(HAL_FTM_Instance_t instance, uint8_t enable)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        s_ftmBase[instance]->SC = (s_ftmBase[instance]->SC & ~FTM_SC_CPWMS_MASK) | FTM_SC_CPWMS(enable);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint16_t HAL_FTM_GetModulo(HAL_FTM_Instance_t instance)
+{
+    uint16_t modulo;
+
+    modulo = 0U;
+
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        modulo = (uint16_t)s_ftmBase[instance]->MOD;
+    }
+    else
+    {
+        /* Invalid instance, keep modulo = 0U */
+    }
+
+    return modulo;
+}
+
+void HAL_FTM_SetChannel(HAL_FTM_Instance_t instance, uint8_t channel, uint32_t mode)
+{
+    if (FTM_IS_AVAILABLE(instance) && (channel < HAL_FTM_CHANNEL_COUNT))
+    {
+        s_ftmBase[instance]->CONTROLS[channel].CnSC = mode;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FTM_SetDualEdge(HAL_FTM_Instance_t instance, uint8_t pair, uint8_t enable)
+{
+    uint32_t shift;
+
+    if (FTM_IS_AVAILABLE(instance) && (pair < (HAL_FTM_CHANNEL_COUNT / 2U)))
+    {
+        shift = (uint32_t)pair * FTM_COMBINE_PAIR_WIDTH;
+
+        if (0U != enable)
+        {
+            /* DECAPEN first, DECAP arms the capture once the channel modes are set. */
+            s_ftmBase[instance]->COMBINE |= (FTM_COMBINE_DECAPEN0_MASK << shift);
+            s_ftmBase[instance]->COMBINE |= (FTM_COMBINE_DECAP0_MASK << shift);
+        }
+        else
+        {
+            s_ftmBase[instance]->COMBINE &= ~((FTM_COMBINE_DECAPEN0_MASK | FTM_COMBINE_DECAP0_MASK) << shift);
+        }
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_FTM_SetPair(HAL_FTM_Instance_t instance, uint8_t pair, uint32_t flags)
+{
+    uint32_t shift;
+
+    if (FTM_IS_AVAILABLE(instance) && (pair < (HAL_FTM_CHANNEL_COUNT / 2U)))
+    {
+        shift = (uint32_t)pair * FTM_COMBINE_PAIR_WIDTH;
+
+        s_ftmBase[instance]->COMBINE = (s_ftmBase[instance]->COMBINE & ~(FTM_PAIR_FLAGS_MASK << shift)) |
+                                       ((flags & FTM_PAIR_FLAGS_MASK) << shift);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint32_t HAL_FTM_SetDeadtime(HAL_FTM_Instance_t instance, uint32_t ticks)
+{
+    uint32_t value;
+    uint32_t result;
+    uint8_t dtps;
+
+    result = 0U;
+
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        /* DTPS: 0x = 1, 2 = 4, 3 = 16 */
+        if (ticks <= FTM_DEADTIME_VAL_MAX)
+        {
+            dtps   = 0U;
+            value  = ticks;
+            result = ticks;
+        }
+        else if (ticks <= (4UL * FTM_DEADTIME_VAL_MAX))
+        {
+            dtps   = 2U;
+            value  = (ticks + 3U) / 4U;
+            result = 4U * value;
+        }
+        else
+        {
+            dtps   = 3U;
+            value  = (ticks + 15U) / 16U;
+            value  = (value > FTM_DEADTIME_VAL_MAX) ? FTM_DEADTIME_VAL_MAX : value;
+            result = 16U * value;
+        }
+
+        s_ftmBase[instance]->DEADTIME = FTM_DEADTIME_DTPS(dtps) | FTM_DEADTIME_DTVAL(value) |
+                                        FTM_DEADTIME_DTVALEX(value >> FTM_DEADTIME_VAL_LOW);
+    }
+    else
+    {
+        /* Invalid instance, keep result = 0U */
+    }
+
+    return result;
+}
+
+void HAL_FTM_EnableOutputs(HAL_FTM_Instance_t instance, uint8_t mask)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        s_ftmBase[instance]->SC = (s_ftmBase[instance]->SC & ~(FTM_STATUS_CH_MASK << FTM_SC_PWMEN0_SHIFT)) |
+                                  ((uint32_t)mask << FTM_SC_PWMEN0_SHIFT);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_SetSync(HAL_FTM_Instance_t instance, uint8_t atMax, uint8_t atMin)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        /* Enhanced mode, software trigger updates the write buffers */
+        s_ftmBase[instance]->SYNCONF = FTM_SYNCONF_SYNCMODE_MASK | FTM_SYNCONF_SWWRBUF_MASK;
+        s_ftmBase[instance]->SYNC    = FTM_SYNC_CNTMAX(atMax) | FTM_SYNC_CNTMIN(atMin);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_SetLoadEnable(HAL_FTM_Instance_t instance, uint8_t enable)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        s_ftmBase[instance]->PWMLOAD = (s_ftmBase[instance]->PWMLOAD & ~FTM_PWMLOAD_LDOK_MASK) |
+                                       FTM_PWMLOAD_LDOK(enable);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_SoftwareSync(HAL_FTM_Instance_t instance)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        /* Cleared by the hardware when the synchronization is done */
+        s_ftmBase[instance]->SYNC |= FTM_SYNC_SWSYNC_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_SetQuadrature(HAL_FTM_Instance_t instance, uint32_t flags)
+{
+    if (FTM_IS_AVAILABLE(instance) && ((HAL_FTM_1 == instance) || (HAL_FTM_2 == instance)))
+    {
+        s_ftmBase[instance]->QDCTRL = flags & (HAL_FTM_QUAD_ENABLE | HAL_FTM_QUAD_COUNT_DIR | HAL_FTM_QUAD_INVERT_A |
+                                               HAL_FTM_QUAD_INVERT_B | HAL_FTM_QUAD_FILTER);
+    }
+    else
+    {
+        /* No quadrature decoder on this instance, do nothing */
+    }
+}
+
+void HAL_FTM_SetInputFilter(HAL_FTM_Instance_t instance, uint8_t channel, uint8_t value)
+{
+    uint32_t shift;
+
+    if (FTM_IS_AVAILABLE(instance) && (channel < HAL_FTM_FILTER_CHANNELS))
+    {
+        shift = (uint32_t)channel * FTM_FILTER_WIDTH;
+
+        s_ftmBase[instance]->FILTER = (s_ftmBase[instance]->FILTER & ~(FTM_FILTER_CH0FVAL_MASK << shift)) |
+                                      (FTM_FILTER_CH0FVAL(value) << shift);
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint16_t HAL_FTM_GetValue(HAL_FTM_Instance_t instance, uint8_t channel)
+{
+    uint16_t value;
+
+    value = 0U;
+
+    if (FTM_IS_AVAILABLE(instance) && (channel < HAL_FTM_CHANNEL_COUNT))
+    {
+        value = (uint16_t)s_ftmBase[instance]->CONTROLS[channel].CnV;
+    }
+    else
+    {
+        /* Invalid parameter, keep value = 0U */
+    }
+
+    return value;
+}
+
+void HAL_FTM_SetValue(HAL_FTM_Instance_t instance, uint8_t channel, uint16_t value)
+{
+    if (FTM_IS_AVAILABLE(instance) && (channel < HAL_FTM_CHANNEL_COUNT))
+    {
+        s_ftmBase[instance]->CONTROLS[channel].CnV = value;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint32_t HAL_FTM_GetValueAddress(HAL_FTM_Instance_t instance, uint8_t channel)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (FTM_IS_AVAILABLE(instance) && (channel < HAL_FTM_CHANNEL_COUNT))
+    {
+        address = (uint32_t)&s_ftmBase[instance]->CONTROLS[channel].CnV;
+    }
+    else
+    {
+        /* Invalid parameter, keep address = 0U */
+    }
+
+    return address;
+}
+
+uint16_t HAL_FTM_GetCounter(HAL_FTM_Instance_t instance)
+{
+    uint16_t counter;
+
+    counter = 0U;
+
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        counter = (uint16_t)s_ftmBase[instance]->CNT;
+    }
+    else
+    {
+        /* Invalid instance, keep counter = 0U */
+    }
+
+    return counter;
+}
+
+uint32_t HAL_FTM_GetCounterAddress(HAL_FTM_Instance_t instance)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        address = (uint32_t)&s_ftmBase[instance]->CNT;
+    }
+    else
+    {
+        /* Invalid instance, keep address = 0U */
+    }
+
+    return address;
+}
+
+dma_request_source_t HAL_FTM_GetDmaRequest(HAL_FTM_Instance_t instance, uint8_t channel)
+{
+    dma_request_source_t source;
+
+    switch (instance)
+    {
+        case HAL_FTM_1:
+        {
+            source = (dma_request_source_t)((uint32_t)EDMA_REQ_FTM1_CHANNEL_0 + (channel & 7U));
+            break;
+        }
+
+        case HAL_FTM_2:
+        {
+            source = (dma_request_source_t)((uint32_t)EDMA_REQ_FTM2_CHANNEL_0 + (channel & 7U));
+            break;
+        }
+
+        case HAL_FTM_3:
+        {
+            source = EDMA_REQ_FTM3_OR_CH0_CH7;
+            break;
+        }
+
+        default:
+        {
+            source = EDMA_REQ_FTM0_OR_CH0_CH7;
+            break;
+        }
+    }
+
+    return source;
+}
+
+void HAL_FTM_EnableOverflowIrq(HAL_FTM_Instance_t instance, uint8_t enable)
+{
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        if (0U != enable)
+        {
+            /* Stale flag from before: read then write 0 */
+            if (0U != (s_ftmBase[instance]->SC & FTM_SC_TOF_MASK))
+            {
+                s_ftmBase[instance]->SC &= ~FTM_SC_TOF_MASK;
+            }
+            else
+            {
+                /* No overflow pending */
+            }
+
+            s_ftmBase[instance]->SC |= FTM_SC_TOIE_MASK;
+        }
+        else
+        {
+            s_ftmBase[instance]->SC &= ~FTM_SC_TOIE_MASK;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_FTM_RegisterCallback(HAL_FTM_Instance_t instance, HAL_FTM_Callback_t callback, void *param)
+{
+    IRQn_Type irq;
+    uint8_t line;
+
+    if (FTM_IS_AVAILABLE(instance))
+    {
+        s_callback[instance]      = callback;
+        s_callbackParam[instance] = param;
+
+        for (line = 0U; line <= FTM_IRQ_OVF_OFFSET; line++)
+        {
+            /* The fault line stays off */
+            if ((line < FTM_IRQ_CHANNEL_LINES) || (FTM_IRQ_OVF_OFFSET == line))
+            {
+                irq = (IRQn_Type)((int32_t)s_ftmIrq[instance] + (int32_t)line);
+
+                if (NULL != callback)
+                {
+                    HAL_NVIC_EnableIRQ(irq);
+                }
+                else
+                {
+                    HAL_NVIC_DisableIRQ(irq);
+                }
+            }
+            else
+            {
+                /* Fault interrupt line, not used */
+            }
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+/*******************************************************************************
+ * Interrupt handlers
+ ******************************************************************************/
+
+static void FTM_IRQHandler(HAL_FTM_Instance_t instance)
+{
+    FTM_Type *base;
+    uint32_t status;
+    uint32_t flags;
+    uint32_t sc;
+    uint8_t channel;
+
+    base   = s_ftmBase[instance];
+    status = 0U;
+    flags  = base->STATUS & FTM_STATUS_CH_MASK;
+
+    /* Channels serviced by the CPU: interrupt enabled, no DMA */
+    for (channel = 0U; channel < HAL_FTM_CHANNEL_COUNT; channel++)
+    {
+        if ((FTM_CnSC_CHIE_MASK == (base->CONTROLS[channel].CnSC & (FTM_CnSC_CHIE_MASK | FTM_CnSC_DMA_MASK))) &&
+            (0U != (flags & HAL_FTM_STATUS_CHANNEL(channel))))
+        {
+            status |= HAL_FTM_STATUS_CHANNEL(channel);
+        }
+        else
+        {
+            /* Not pending or not ours */
+        }
+    }
+
+    /* Flags are cleared by writing 0 after reading 1; ones keep the others. */
+    if (0U != status)
+    {
+        base->STATUS = ~status & FTM_STATUS_CH_MASK;
+    }
+    else
+    {
+        /* No channel event */
+    }
+
+    sc = base->SC;
+
+    if ((FTM_SC_TOIE_MASK | FTM_SC_TOF_MASK) == (sc & (FTM_SC_TOIE_MASK | FTM_SC_TOF_MASK)))
+    {
+        status  |= HAL_FTM_STATUS_OVERFLOW;
+        base->SC = sc & ~FTM_SC_TOF_MASK;
+        sc       = base->SC;
+    }
+    else
+    {
+        /* No overflow event */
+    }
+
+    if ((FTM_SC_RIE_MASK | FTM_SC_RF_MASK) == (sc & (FTM_SC_RIE_MASK | FTM_SC_RF_MASK)))
+    {
+        status  |= HAL_FTM_STATUS_RELOAD;
+        base->SC = sc & ~FTM_SC_RF_MASK;
+    }
+    else
+    {
+        /* No reload event */
+    }
+
+    if ((0U != status) && (NULL != s_callback[instance]))
+    {
+        s_callback[instance](instance, status, s_callbackParam[instance]);
+    }
+    else
+    {
+        /* Nothing to report */
+    }
+}
+
+void FTM0_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_0); }
+void FTM0_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_0); }
+void FTM0_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_0); }
+void FTM0_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_0); }
+void FTM0_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_0); }
+void FTM1_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_1); }
+void FTM1_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_1); }
+void FTM1_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_1); }
+void FTM1_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_1); }
+void FTM1_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_1); }
+void FTM2_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_2); }
+void FTM2_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_2); }
+void FTM2_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_2); }
+void FTM2_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_2); }
+void FTM2_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_2); }
+void FTM3_Ch0_Ch1_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_3); }
+void FTM3_Ch2_Ch3_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_3); }
+void FTM3_Ch4_Ch5_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_3); }
+void FTM3_Ch6_Ch7_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_3); }
+void FTM3_Ovf_Reload_IRQHandler(void) { FTM_IRQHandler(HAL_FTM_3); }
@@ -182,3 +182,45 @@ uint32_t HAL_GPIO_ReadPin(const uint8_t portNumber, const uint8_t pinNumber)
 
     return (pinState != 0U) ? 1U : 0U;
 }
+
+void HAL_GPIO_SetPinMux(const uint8_t portNumber, const uint8_t pinNumber, const uint8_t mux)
+{
+    uint32_t pcr;
+
+    switch (portNumber)
+    {
+        case HAL_GPIO_PORT_A:
+            IP_PCC->PCCn[PCC_PORTA_INDEX] |= PCC_PCCn_CGC_MASK;
+            pcr = IP_PORTA->PCR[pinNumber] & ~PORT_PCR_MUX_MASK;
+            IP_PORTA->PCR[pinNumber] = pcr | PORT_PCR_MUX(mux);
+            break;
+
+        case HAL_GPIO_PORT_B:
+            IP_PCC->PCCn[PCC_PORTB_INDEX] |= PCC_PCCn_CGC_MASK;
+            pcr = IP_PORTB->PCR[pinNumber] & ~PORT_PCR_MUX_MASK;
+            IP_PORTB->PCR[pinNumber] = pcr | PORT_PCR_MUX(mux);
+            break;
+
+        case HAL_GPIO_PORT_C:
+            IP_PCC->PCCn[PCC_PORTC_INDEX] |= PCC_PCCn_CGC_MASK;
+            pcr = IP_PORTC->PCR[pinNumber] & ~PORT_PCR_MUX_MASK;
+            IP_PORTC->PCR[pinNumber] = pcr | PORT_PCR_MUX(mux);
+            break;
+
+        case HAL_GPIO_PORT_D:
+            IP_PCC->PCCn[PCC_PORTD_INDEX] |= PCC_PCCn_CGC_MASK;
+            pcr = IP_PORTD->PCR[pinNumber] & ~PORT_PCR_MUX_MASK;
+            IP_PORTD->PCR[pinNumber] = pcr | PORT_PCR_MUX(mux);
+            break;
+
+        case HAL_GPIO_PORT_E:
+            IP_PCC->PCCn[PCC_PORTE_INDEX] |= PCC_PCCn_CGC_MASK;
+            pcr = IP_PORTE->PCR[pinNumber] & ~PORT_PCR_MUX_MASK;
+            IP_PORTE->PCR[pinNumber] = pcr | PORT_PCR_MUX(mux);
+            break;
+
+        default:
+            /* Invalid port number, do nothing */
+            break;
+    }
+}
@@ -0,0 +1,323 @@
+/*******************************************************************************
+ * @file    HAL_LPI2C.c
+ * @brief   Hardware abstraction layer for LPI2C (master) C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_LPI2C.h"
+#include "HAL_SCG.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define LPI2C_PRESCALE_MAX      (7UL)
+#define LPI2C_CLKLO_MAX         (63UL)
+#define LPI2C_CLKLO_MIN         (3UL)
+#define LPI2C_CLKHI_MIN         (1UL)
+
+#define LPI2C_STATUS_W1C_MASK   (LPI2C_MSR_EPF_MASK | LPI2C_MSR_SDF_MASK | LPI2C_MSR_NDF_MASK | \
+                                 LPI2C_MSR_ALF_MASK | LPI2C_MSR_FEF_MASK | LPI2C_MSR_PLTF_MASK | \
+                                 LPI2C_MSR_DMF_MASK)
+
+#define LPI2C_IS_AVAILABLE(n)   ((uint32_t)(n) < (uint32_t)HAL_LPI2C_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static LPI2C_Type * const s_lpi2cBase[HAL_LPI2C_MAX] = IP_LPI2C_BASE_PTRS;
+
+static const uint8_t s_lpi2cPccIndex[HAL_LPI2C_MAX] =
+{
+    PCC_LPI2C0_INDEX
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_LPI2C_Init(HAL_LPI2C_Instance_t instance)
+{
+    LPI2C_Type *base;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        base = s_lpi2cBase[instance];
+
+        HAL_SCG_ClockFromFircDiv2(s_lpi2cPccIndex[instance]);
+
+        base->MCR = LPI2C_MCR_RST_MASK;
+        base->MCR = 0U;
+        base->MCR = LPI2C_MCR_RTF_MASK | LPI2C_MCR_RRF_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPI2C_Deinit(HAL_LPI2C_Instance_t instance)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        s_lpi2cBase[instance]->MIER = 0U;
+        s_lpi2cBase[instance]->MDER = 0U;
+        s_lpi2cBase[instance]->MCR  = 0U;
+        IP_PCC->PCCn[s_lpi2cPccIndex[instance]] &= ~PCC_PCCn_CGC_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPI2C_Enable(HAL_LPI2C_Instance_t instance, uint8_t enable)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        if (0U != enable)
+        {
+            /* Run in debug mode too, a halted master would otherwise hold the bus. */
+            s_lpi2cBase[instance]->MCR |= LPI2C_MCR_MEN_MASK | LPI2C_MCR_DBGEN_MASK;
+        }
+        else
+        {
+            s_lpi2cBase[instance]->MCR &= ~LPI2C_MCR_MEN_MASK;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPI2C_SetBusSpeed(HAL_LPI2C_Instance_t instance, uint32_t busSpeed)
+{
+    uint32_t actual;
+    uint32_t prescale;
+    uint32_t latency;
+    uint32_t cycles;
+    uint32_t clkHi;
+    uint32_t clkLo;
+
+    actual = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance) && (0U != busSpeed))
+    {
+        for (prescale = 0U; prescale <= LPI2C_PRESCALE_MAX; prescale++)
+        {
+            /* SCL = fclk / (2^PRESCALE * (CLKLO + CLKHI + 2 + latency)), rounded up to never exceed busSpeed. */
+            latency = 2UL >> prescale;
+            cycles  = ((HAL_LPI2C_CLOCK_HZ >> prescale) + busSpeed - 1UL) / busSpeed;
+            cycles  = (cycles > (2UL + latency)) ? (cycles - 2UL - latency) : 0UL;
+
+            /* Roughly 40 % high / 60 % low, satisfies tLOW and tHIGH up to Fast-mode Plus. */
+            clkHi = (cycles * 2UL) / 5UL;
+            clkHi = (clkHi < LPI2C_CLKHI_MIN) ? LPI2C_CLKHI_MIN : clkHi;
+            clkLo = (cycles > clkHi) ? (cycles - clkHi) : 0UL;
+
+            if ((clkLo >= LPI2C_CLKLO_MIN) && (clkLo <= LPI2C_CLKLO_MAX))
+            {
+                s_lpi2cBase[instance]->MCFGR1 = LPI2C_MCFGR1_PRESCALE(prescale);
+                s_lpi2cBase[instance]->MCCR0  = LPI2C_MCCR0_CLKLO(clkLo) | LPI2C_MCCR0_CLKHI(clkHi) |
+                                                LPI2C_MCCR0_SETHOLD(clkHi) | LPI2C_MCCR0_DATAVD(clkHi / 2UL);
+                /* Bus idle after one SCL period with both lines high. */
+                s_lpi2cBase[instance]->MCFGR2 = LPI2C_MCFGR2_BUSIDLE(clkLo + clkHi + 2UL);
+
+                actual = (HAL_LPI2C_CLOCK_HZ >> prescale) / (clkLo + clkHi + 2UL + latency);
+                break;
+            }
+            else
+            {
+                /* Need a larger prescaler */
+            }
+        }
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return actual;
+}
+
+void HAL_LPI2C_WriteCommand(HAL_LPI2C_Instance_t instance, uint8_t command, uint8_t data)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        s_lpi2cBase[instance]->MTDR = LPI2C_MTDR_CMD(command) | LPI2C_MTDR_DATA(data);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint8_t HAL_LPI2C_ReadData(HAL_LPI2C_Instance_t instance)
+{
+    uint8_t data;
+
+    data = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        data = (uint8_t)(s_lpi2cBase[instance]->MRDR & LPI2C_MRDR_DATA_MASK);
+    }
+    else
+    {
+        /* Invalid instance, keep data = 0U */
+    }
+
+    return data;
+}
+
+uint8_t HAL_LPI2C_GetFifoSize(HAL_LPI2C_Instance_t instance)
+{
+    uint8_t size;
+
+    size = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        size = (uint8_t)(1UL << ((s_lpi2cBase[instance]->PARAM & LPI2C_PARAM_MTXFIFO_MASK) >> LPI2C_PARAM_MTXFIFO_SHIFT));
+    }
+    else
+    {
+        /* Invalid instance, keep size = 0U */
+    }
+
+    return size;
+}
+
+void HAL_LPI2C_SetWatermarks(HAL_LPI2C_Instance_t instance, uint8_t txWater, uint8_t rxWater)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        s_lpi2cBase[instance]->MFCR = LPI2C_MFCR_TXWATER(txWater) | LPI2C_MFCR_RXWATER(rxWater);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint8_t HAL_LPI2C_GetTxFifoCount(HAL_LPI2C_Instance_t instance)
+{
+    uint8_t count;
+
+    count = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        count = (uint8_t)((s_lpi2cBase[instance]->MFSR & LPI2C_MFSR_TXCOUNT_MASK) >> LPI2C_MFSR_TXCOUNT_SHIFT);
+    }
+    else
+    {
+        /* Invalid instance, keep count = 0U */
+    }
+
+    return count;
+}
+
+uint8_t HAL_LPI2C_GetRxFifoCount(HAL_LPI2C_Instance_t instance)
+{
+    uint8_t count;
+
+    count = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        count = (uint8_t)((s_lpi2cBase[instance]->MFSR & LPI2C_MFSR_RXCOUNT_MASK) >> LPI2C_MFSR_RXCOUNT_SHIFT);
+    }
+    else
+    {
+        /* Invalid instance, keep count = 0U */
+    }
+
+    return count;
+}
+
+void HAL_LPI2C_SetInterrupts(HAL_LPI2C_Instance_t instance, uint32_t mask)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        /* MIER bits share the MSR bit positions. */
+        s_lpi2cBase[instance]->MIER = mask;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPI2C_GetStatus(HAL_LPI2C_Instance_t instance)
+{
+    uint32_t status;
+
+    status = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        status = s_lpi2cBase[instance]->MSR;
+    }
+    else
+    {
+        /* Invalid instance, keep status = 0U */
+    }
+
+    return status;
+}
+
+void HAL_LPI2C_ClearStatus(HAL_LPI2C_Instance_t instance, uint32_t mask)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        s_lpi2cBase[instance]->MSR = mask & LPI2C_STATUS_W1C_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPI2C_EnableRxDma(HAL_LPI2C_Instance_t instance, uint8_t enable)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        s_lpi2cBase[instance]->MDER = (0U != enable) ? LPI2C_MDER_RDDE_MASK : 0U;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPI2C_GetRxDataAddress(HAL_LPI2C_Instance_t instance)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        address = (uint32_t)&s_lpi2cBase[instance]->MRDR;
+    }
+    else
+    {
+        /* Invalid instance, keep address = 0U */
+    }
+
+    return address;
+}
+
+void HAL_LPI2C_FlushFifo(HAL_LPI2C_Instance_t instance)
+{
+    if (LPI2C_IS_AVAILABLE(instance))
+    {
+        s_lpi2cBase[instance]->MCR |= LPI2C_MCR_RTF_MASK | LPI2C_MCR_RRF_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
@@ -0,0 +1,375 @@
+/*******************************************************************************
+ * @file    HAL_LPSPI.c
+ * @brief   Hardware abstraction layer for LPSPI C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "HAL_LPSPI.h"
+#include "HAL_SCG.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define LPSPI_PRESCALE_MAX      (7UL)
+#define LPSPI_SCKDIV_MAX        (255UL)
+
+#define LPSPI_STATUS_W1C_MASK   (LPSPI_SR_WCF_MASK | LPSPI_SR_FCF_MASK | LPSPI_SR_TCF_MASK | \
+                                 LPSPI_SR_TEF_MASK | LPSPI_SR_REF_MASK | LPSPI_SR_DMF_MASK)
+
+#define LPSPI_IS_AVAILABLE(n)   ((uint32_t)(n) < (uint32_t)HAL_LPSPI_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static LPSPI_Type * const s_lpspiBase[HAL_LPSPI_MAX] = IP_LPSPI_BASE_PTRS;
+
+static const uint8_t s_lpspiPccIndex[HAL_LPSPI_MAX] =
+{
+    PCC_LPSPI0_INDEX,
+    PCC_LPSPI1_INDEX,
+    PCC_LPSPI2_INDEX
+};
+
+/** Prescaler selected by HAL_LPSPI_SetBaudRate(), applied through TCR. */
+static uint8_t s_lpspiPrescale[HAL_LPSPI_MAX];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_LPSPI_Init(HAL_LPSPI_Instance_t instance)
+{
+    LPSPI_Type *base;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        base = s_lpspiBase[instance];
+
+        HAL_SCG_ClockFromFircDiv2(s_lpspiPccIndex[instance]);
+
+        base->CR = LPSPI_CR_RST_MASK;
+        base->CR = 0U;
+        base->CR = LPSPI_CR_RTF_MASK | LPSPI_CR_RRF_MASK;
+
+        s_lpspiPrescale[instance] = 0U;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPSPI_Deinit(HAL_LPSPI_Instance_t instance)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        s_lpspiBase[instance]->IER = 0U;
+        s_lpspiBase[instance]->DER = 0U;
+        s_lpspiBase[instance]->CR  = 0U;
+        IP_PCC->PCCn[s_lpspiPccIndex[instance]] &= ~PCC_PCCn_CGC_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPSPI_Enable(HAL_LPSPI_Instance_t instance, uint8_t enable)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        if (0U != enable)
+        {
+            /* Run in debug mode too, the bus would otherwise stall under a debugger. */
+            s_lpspiBase[instance]->CR |= LPSPI_CR_MEN_MASK | LPSPI_CR_DBGEN_MASK;
+        }
+        else
+        {
+            s_lpspiBase[instance]->CR &= ~LPSPI_CR_MEN_MASK;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPSPI_SetMaster(HAL_LPSPI_Instance_t instance)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        /* NOSTALL = 0: an empty TX FIFO stalls the bus instead of underrunning. */
+        s_lpspiBase[instance]->CFGR1 = LPSPI_CFGR1_MASTER_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPSPI_SetBaudRate(HAL_LPSPI_Instance_t instance, uint32_t busSpeed)
+{
+    uint32_t actual;
+    uint32_t prescale;
+    uint32_t divider;
+    uint32_t sckDiv;
+    uint32_t delay;
+
+    actual = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance) && (0U != busSpeed))
+    {
+        for (prescale = 0U; prescale <= LPSPI_PRESCALE_MAX; prescale++)
+        {
+            /* SCK = fclk / (2^PRESCALE * (SCKDIV + 2)), rounded up to never exceed busSpeed. */
+            divider = ((HAL_LPSPI_CLOCK_HZ >> prescale) + busSpeed - 1UL) / busSpeed;
+            divider = (divider < 2UL) ? 2UL : divider;
+            sckDiv  = divider - 2UL;
+
+            if (sckDiv <= LPSPI_SCKDIV_MAX)
+            {
+                /* Half an SCK period for PCS-to-SCK, SCK-to-PCS and between transfers. */
+                delay = sckDiv / 2UL;
+                s_lpspiBase[instance]->CCR = LPSPI_CCR_SCKDIV(sckDiv) | LPSPI_CCR_DBT(delay) |
+                                             LPSPI_CCR_PCSSCK(delay) | LPSPI_CCR_SCKPCS(delay);
+                s_lpspiPrescale[instance] = (uint8_t)prescale;
+                actual = (HAL_LPSPI_CLOCK_HZ >> prescale) / divider;
+                break;
+            }
+            else
+            {
+                /* Need a larger prescaler */
+            }
+        }
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return actual;
+}
+
+void HAL_LPSPI_WriteCommand(HAL_LPSPI_Instance_t instance, const HAL_LPSPI_Command_t *command)
+{
+    uint32_t tcr;
+
+    if (LPSPI_IS_AVAILABLE(instance) && (NULL != command))
+    {
+        tcr = LPSPI_TCR_FRAMESZ((uint32_t)command->frameBits - 1UL) |
+              LPSPI_TCR_CPOL(command->cpol) |
+              LPSPI_TCR_CPHA(command->cpha) |
+              LPSPI_TCR_LSBF(command->lsbFirst) |
+              LPSPI_TCR_PCS(command->pcs) |
+              LPSPI_TCR_CONT(command->cont) |
+              LPSPI_TCR_CONTC(command->contc) |
+              LPSPI_TCR_PRESCALE(s_lpspiPrescale[instance]);
+
+        s_lpspiBase[instance]->TCR = tcr;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+uint8_t HAL_LPSPI_GetFifoSize(HAL_LPSPI_Instance_t instance)
+{
+    uint8_t size;
+
+    size = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        size = (uint8_t)(1UL << ((s_lpspiBase[instance]->PARAM & LPSPI_PARAM_TXFIFO_MASK) >> LPSPI_PARAM_TXFIFO_SHIFT));
+    }
+    else
+    {
+        /* Invalid instance, keep size = 0U */
+    }
+
+    return size;
+}
+
+void HAL_LPSPI_SetWatermarks(HAL_LPSPI_Instance_t instance, uint8_t txWater, uint8_t rxWater)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        s_lpspiBase[instance]->FCR = LPSPI_FCR_TXWATER(txWater) | LPSPI_FCR_RXWATER(rxWater);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint8_t HAL_LPSPI_GetTxFifoCount(HAL_LPSPI_Instance_t instance)
+{
+    uint8_t count;
+
+    count = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        count = (uint8_t)((s_lpspiBase[instance]->FSR & LPSPI_FSR_TXCOUNT_MASK) >> LPSPI_FSR_TXCOUNT_SHIFT);
+    }
+    else
+    {
+        /* Invalid instance, keep count = 0U */
+    }
+
+    return count;
+}
+
+uint8_t HAL_LPSPI_IsRxEmpty(HAL_LPSPI_Instance_t instance)
+{
+    uint8_t empty;
+
+    empty = 1U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        empty = ((s_lpspiBase[instance]->RSR & LPSPI_RSR_RXEMPTY_MASK) != 0U) ? 1U : 0U;
+    }
+    else
+    {
+        /* Invalid instance, report empty */
+    }
+
+    return empty;
+}
+
+void HAL_LPSPI_WriteData(HAL_LPSPI_Instance_t instance, uint32_t data)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        s_lpspiBase[instance]->TDR = data;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPSPI_ReadData(HAL_LPSPI_Instance_t instance)
+{
+    uint32_t data;
+
+    data = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        data = s_lpspiBase[instance]->RDR;
+    }
+    else
+    {
+        /* Invalid instance, keep data = 0U */
+    }
+
+    return data;
+}
+
+void HAL_LPSPI_SetInterrupts(HAL_LPSPI_Instance_t instance, uint32_t mask)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        /* IER bits share the SR bit positions. */
+        s_lpspiBase[instance]->IER = mask;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPSPI_GetStatus(HAL_LPSPI_Instance_t instance)
+{
+    uint32_t status;
+
+    status = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        status = s_lpspiBase[instance]->SR;
+    }
+    else
+    {
+        /* Invalid instance, keep status = 0U */
+    }
+
+    return status;
+}
+
+void HAL_LPSPI_ClearStatus(HAL_LPSPI_Instance_t instance, uint32_t mask)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        s_lpspiBase[instance]->SR = mask & LPSPI_STATUS_W1C_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPSPI_EnableDma(HAL_LPSPI_Instance_t instance, uint8_t enable)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        s_lpspiBase[instance]->DER = (0U != enable) ? (LPSPI_DER_TDDE_MASK | LPSPI_DER_RDDE_MASK) : 0U;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPSPI_GetTxDataAddress(HAL_LPSPI_Instance_t instance)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        address = (uint32_t)&s_lpspiBase[instance]->TDR;
+    }
+    else
+    {
+        /* Invalid instance, keep address = 0U */
+    }
+
+    return address;
+}
+
+uint32_t HAL_LPSPI_GetRxDataAddress(HAL_LPSPI_Instance_t instance)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        address = (uint32_t)&s_lpspiBase[instance]->RDR;
+    }
+    else
+    {
+        /* Invalid instance, keep address = 0U */
+    }
+
+    return address;
+}
+
+void HAL_LPSPI_FlushFifo(HAL_LPSPI_Instance_t instance)
+{
+    if (LPSPI_IS_AVAILABLE(instance))
+    {
+        s_lpspiBase[instance]->CR |= LPSPI_CR_RTF_MASK | LPSPI_CR_RRF_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
@@ -0,0 +1,395 @@
+/*******************************************************************************
+ * @file    HAL_LPUART.c
+ * @brief   Hardware abstraction layer for LPUART C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_LPUART.h"
+#include "HAL_SCG.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define LPUART_OSR_MIN          (4UL)
+#define LPUART_OSR_MAX          (32UL)
+#define LPUART_SBR_MAX          (0x1FFFUL)
+#define LPUART_BOTHEDGE_OSR     (8UL)       /**< OSR below this needs BOTHEDGE */
+#define LPUART_MAX_ERROR_PCT    (3UL)
+
+#define LPUART_TX_WATERMARK     (2UL)       /**< DMA refills while <= 2 words queued */
+
+#define LPUART_ERROR_IRQ_MASK   (LPUART_CTRL_ORIE_MASK | LPUART_CTRL_NEIE_MASK | \
+                                 LPUART_CTRL_FEIE_MASK | LPUART_CTRL_PEIE_MASK)
+
+#define LPUART_STAT_W1C_MASK    (LPUART_STAT_LBKDIF_MASK | LPUART_STAT_RXEDGIF_MASK | \
+                                 LPUART_STAT_IDLE_MASK | LPUART_STAT_OR_MASK | \
+                                 LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | LPUART_STAT_PF_MASK)
+
+#define LPUART_IS_AVAILABLE(n)  ((uint32_t)(n) < (uint32_t)HAL_LPUART_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static LPUART_Type * const s_lpuartBase[HAL_LPUART_MAX] = IP_LPUART_BASE_PTRS;
+
+static const uint8_t s_lpuartPccIndex[HAL_LPUART_MAX] =
+{
+    PCC_LPUART0_INDEX,
+    PCC_LPUART1_INDEX,
+    PCC_LPUART2_INDEX
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void LPUART_SetCtrlBits(HAL_LPUART_Instance_t instance, uint32_t mask, uint8_t enable);
+static void LPUART_SetBaudBits(HAL_LPUART_Instance_t instance, uint32_t mask, uint8_t enable);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void LPUART_SetCtrlBits(HAL_LPUART_Instance_t instance, uint32_t mask, uint8_t enable)
+{
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        if (0U != enable)
+        {
+            s_lpuartBase[instance]->CTRL |= mask;
+        }
+        else
+        {
+            s_lpuartBase[instance]->CTRL &= ~mask;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+static void LPUART_SetBaudBits(HAL_LPUART_Instance_t instance, uint32_t mask, uint8_t enable)
+{
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        if (0U != enable)
+        {
+            s_lpuartBase[instance]->BAUD |= mask;
+        }
+        else
+        {
+            s_lpuartBase[instance]->BAUD &= ~mask;
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPUART_Init(HAL_LPUART_Instance_t instance)
+{
+    LPUART_Type *base;
+
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        base = s_lpuartBase[instance];
+
+        HAL_SCG_ClockFromFircDiv2(s_lpuartPccIndex[instance]);
+
+        base->GLOBAL = LPUART_GLOBAL_RST_MASK;
+        base->GLOBAL = 0U;
+
+        /* FIFOs absorb DMA arbitration latency at multi-Mbaud rates. */
+        base->FIFO  = LPUART_FIFO_TXFE_MASK | LPUART_FIFO_RXFE_MASK |
+                      LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK;
+        base->WATER = LPUART_WATER_TXWATER(LPUART_TX_WATERMARK) | LPUART_WATER_RXWATER(0U);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPUART_Deinit(HAL_LPUART_Instance_t instance)
+{
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        s_lpuartBase[instance]->CTRL = 0U;
+        s_lpuartBase[instance]->BAUD &= ~(LPUART_BAUD_TDMAE_MASK | LPUART_BAUD_RDMAE_MASK);
+        IP_PCC->PCCn[s_lpuartPccIndex[instance]] &= ~PCC_PCCn_CGC_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint8_t HAL_LPUART_SetBaudRate(HAL_LPUART_Instance_t instance, uint32_t baudRate)
+{
+    uint8_t  result;
+    uint32_t osr;
+    uint32_t sbr;
+    uint32_t actual;
+    uint32_t error;
+    uint32_t bestOsr;
+    uint32_t bestSbr;
+    uint32_t bestError;
+    uint32_t baud;
+
+    result    = 0U;
+    bestOsr   = 0U;
+    bestSbr   = 0U;
+    bestError = 0xFFFFFFFFUL;
+
+    if (LPUART_IS_AVAILABLE(instance) && (0U != baudRate))
+    {
+        for (osr = LPUART_OSR_MIN; osr <= LPUART_OSR_MAX; osr++)
+        {
+            /* Rounded divider. */
+            sbr = (HAL_LPUART_CLOCK_HZ + ((baudRate * osr) / 2UL)) / (baudRate * osr);
+
+            if ((sbr >= 1UL) && (sbr <= LPUART_SBR_MAX))
+            {
+                actual = HAL_LPUART_CLOCK_HZ / (sbr * osr);
+                error  = (actual > baudRate) ? (actual - baudRate) : (baudRate - actual);
+
+                if (error < bestError)
+                {
+                    bestError = error;
+                    bestOsr   = osr;
+                    bestSbr   = sbr;
+                }
+                else
+                {
+                    /* Keep the previous candidate */
+                }
+            }
+            else
+            {
+                /* Divider out of range for this OSR */
+            }
+        }
+
+        if ((0U != bestOsr) && ((bestError * 100UL) < (baudRate * LPUART_MAX_ERROR_PCT)))
+        {
+            baud  = s_lpuartBase[instance]->BAUD;
+            baud &= ~(LPUART_BAUD_OSR_MASK | LPUART_BAUD_SBR_MASK | LPUART_BAUD_BOTHEDGE_MASK);
+            baud |= LPUART_BAUD_OSR(bestOsr - 1UL) | LPUART_BAUD_SBR(bestSbr);
+
+            if (bestOsr < LPUART_BOTHEDGE_OSR)
+            {
+                baud |= LPUART_BAUD_BOTHEDGE_MASK;
+            }
+            else
+            {
+                /* Single edge sampling is sufficient */
+            }
+
+            s_lpuartBase[instance]->BAUD = baud;
+            result = 1U;
+        }
+        else
+        {
+            /* Baud rate not reachable with this clock */
+        }
+    }
+    else
+    {
+        /* Invalid parameter */
+    }
+
+    return result;
+}
+
+void HAL_LPUART_SetFormat(HAL_LPUART_Instance_t instance, uint8_t dataBits,
+                          HAL_LPUART_Parity_t parity, uint8_t stopBits)
+{
+    uint32_t ctrl;
+    uint32_t baud;
+
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        ctrl = s_lpuartBase[instance]->CTRL;
+        ctrl &= ~(LPUART_CTRL_M7_MASK | LPUART_CTRL_M_MASK | LPUART_CTRL_PE_MASK | LPUART_CTRL_PT_MASK);
+
+        /* The parity bit is counted as a data bit by the hardware. */
+        if (HAL_LPUART_PARITY_NONE != parity)
+        {
+            dataBits++;
+            ctrl |= LPUART_CTRL_PE_MASK;
+            ctrl |= (HAL_LPUART_PARITY_ODD == parity) ? LPUART_CTRL_PT_MASK : 0U;
+        }
+        else
+        {
+            /* No parity */
+        }
+
+        if (dataBits <= 7U)
+        {
+            ctrl |= LPUART_CTRL_M7_MASK;
+        }
+        else if (dataBits >= 9U)
+        {
+            ctrl |= LPUART_CTRL_M_MASK;
+        }
+        else
+        {
+            /* 8-bit characters are the default */
+        }
+
+        baud = s_lpuartBase[instance]->BAUD & ~LPUART_BAUD_SBNS_MASK;
+        baud |= (stopBits >= 2U) ? LPUART_BAUD_SBNS_MASK : 0U;
+
+        s_lpuartBase[instance]->BAUD = baud;
+        s_lpuartBase[instance]->CTRL = ctrl;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPUART_EnableTx(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetCtrlBits(instance, LPUART_CTRL_TE_MASK, enable);
+}
+
+void HAL_LPUART_EnableRx(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetCtrlBits(instance, LPUART_CTRL_RE_MASK, enable);
+}
+
+void HAL_LPUART_EnableTxDma(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetBaudBits(instance, LPUART_BAUD_TDMAE_MASK, enable);
+}
+
+void HAL_LPUART_EnableRxDma(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetBaudBits(instance, LPUART_BAUD_RDMAE_MASK, enable);
+}
+
+void HAL_LPUART_SetIdleInterrupt(HAL_LPUART_Instance_t instance, uint8_t idleChars)
+{
+    uint32_t ctrl;
+    uint32_t idleCfg;
+
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        ctrl = s_lpuartBase[instance]->CTRL;
+        ctrl &= ~(LPUART_CTRL_ILIE_MASK | LPUART_CTRL_IDLECFG_MASK | LPUART_CTRL_ILT_MASK);
+
+        if (0U != idleChars)
+        {
+            /* IDLECFG encodes log2 of the idle character count. */
+            idleCfg = 0U;
+            while (((1UL << idleCfg) < idleChars) && (idleCfg < 7UL))
+            {
+                idleCfg++;
+            }
+
+            /* ILT: start counting after the stop bit so data bits never count as idle. */
+            ctrl |= LPUART_CTRL_ILIE_MASK | LPUART_CTRL_ILT_MASK | LPUART_CTRL_IDLECFG(idleCfg);
+        }
+        else
+        {
+            /* Idle interrupt disabled */
+        }
+
+        s_lpuartBase[instance]->CTRL = ctrl;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_LPUART_EnableErrorInterrupts(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetCtrlBits(instance, LPUART_ERROR_IRQ_MASK, enable);
+}
+
+void HAL_LPUART_EnableTcInterrupt(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetCtrlBits(instance, LPUART_CTRL_TCIE_MASK, enable);
+}
+
+void HAL_LPUART_SetLoopback(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    /* LOOPS with RSRC = 0: receiver input is internally tied to the transmitter. */
+    LPUART_SetCtrlBits(instance, LPUART_CTRL_RSRC_MASK, 0U);
+    LPUART_SetCtrlBits(instance, LPUART_CTRL_LOOPS_MASK, enable);
+}
+
+void HAL_LPUART_SetBreak(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    LPUART_SetCtrlBits(instance, LPUART_CTRL_SBK_MASK, enable);
+}
+
+uint32_t HAL_LPUART_GetStatus(HAL_LPUART_Instance_t instance)
+{
+    uint32_t status;
+
+    status = 0U;
+
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        status = s_lpuartBase[instance]->STAT;
+    }
+    else
+    {
+        /* Invalid instance, keep status = 0U */
+    }
+
+    return status;
+}
+
+void HAL_LPUART_ClearStatus(HAL_LPUART_Instance_t instance, uint32_t mask)
+{
+    uint32_t stat;
+
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        /* Preserve the configuration bits, write 1 only to the requested flags. */
+        stat = s_lpuartBase[instance]->STAT & ~LPUART_STAT_W1C_MASK;
+        s_lpuartBase[instance]->STAT = stat | (mask & LPUART_STAT_W1C_MASK);
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_LPUART_GetDataAddress(HAL_LPUART_Instance_t instance)
+{
+    uint32_t address;
+
+    address = 0U;
+
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        address = (uint32_t)&s_lpuartBase[instance]->DATA;
+    }
+    else
+    {
+        /* Invalid instance, keep address = 0U */
+    }
+
+    return address;
+}
+
+void HAL_LPUART_FlushFifo(HAL_LPUART_Instance_t instance)
+{
+    if (LPUART_IS_AVAILABLE(instance))
+    {
+        s_lpuartBase[instance]->FIFO |= LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * @file    HAL_NVIC.c
+ * @brief   Hardware abstraction layer for the Cortex-M4 NVIC C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_NVIC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define NVIC_REG32(base, irq)   (((volatile uint32_t *)(base))[((uint32_t)(irq)) >> 5U])
+#define NVIC_BIT(irq)           (1UL << (((uint32_t)(irq)) & 0x1FU))
+#define NVIC_IPR(irq)           (((volatile uint8_t *)HAL_NVIC_IPR_BASE)[(uint32_t)(irq)])
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_NVIC_EnableIRQ(IRQn_Type irq)
+{
+    if ((int32_t)irq >= 0)
+    {
+        NVIC_REG32(HAL_NVIC_ISER_BASE, irq) = NVIC_BIT(irq);
+    }
+    else
+    {
+        /* Core exceptions are not handled by the NVIC, do nothing */
+    }
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type irq)
+{
+    if ((int32_t)irq >= 0)
+    {
+        NVIC_REG32(HAL_NVIC_ICER_BASE, irq) = NVIC_BIT(irq);
+    }
+    else
+    {
+        /* Core exceptions are not handled by the NVIC, do nothing */
+    }
+}
+
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    if ((int32_t)irq >= 0)
+    {
+        NVIC_REG32(HAL_NVIC_ICPR_BASE, irq) = NVIC_BIT(irq);
+    }
+    else
+    {
+        /* Core exceptions are not handled by the NVIC, do nothing */
+    }
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint8_t priority)
+{
+    if ((int32_t)irq >= 0)
+    {
+        /* Only the upper __NVIC_PRIO_BITS of each priority byte are implemented. */
+        NVIC_IPR(irq) = (uint8_t)((priority & HAL_NVIC_PRIO_LOWEST) << (8U - __NVIC_PRIO_BITS));
+    }
+    else
+    {
+        /* Core exceptions are not handled by the NVIC, do nothing */
+    }
+}
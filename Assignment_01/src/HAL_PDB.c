@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * @file    HAL_PDB.c
+ * @brief   Hardware abstraction layer for the programmable delay block C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_PDB.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PDB_PRESCALER_MAX       (7U)
+#define PDB_MULT_COUNT          (4U)
+#define PDB_MOD_MAX             (0x10000UL)     /**< Ticks per period */
+
+#define PDB_IS_AVAILABLE(n)     ((uint32_t)(n) < (uint32_t)HAL_PDB_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static PDB_Type * const s_pdbBase[HAL_PDB_MAX] = IP_PDB_BASE_PTRS;
+
+static const uint8_t s_pdbPccIndex[HAL_PDB_MAX] =
+{
+    PCC_PDB0_INDEX,
+    PCC_PDB1_INDEX
+};
+
+/** SC.MULT encoding: 1, 10, 20, 40 */
+static const uint8_t s_pdbMult[PDB_MULT_COUNT] = { 1U, 10U, 20U, 40U };
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+void HAL_PDB_Init(HAL_PDB_Instance_t instance)
+{
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        IP_PCC->PCCn[s_pdbPccIndex[instance]] |= PCC_PCCn_CGC_MASK;
+
+        s_pdbBase[instance]->SC       = 0U;
+        s_pdbBase[instance]->CH[0].C1 = 0U;
+        s_pdbBase[instance]->CH[1].C1 = 0U;
+
+        /* Hardware trigger and pre-triggers of the ADC come from the PDB. */
+        if (HAL_PDB_0 == instance)
+        {
+            IP_SIM->ADCOPT &= ~(SIM_ADCOPT_ADC0TRGSEL_MASK | SIM_ADCOPT_ADC0SWPRETRG_MASK |
+                                SIM_ADCOPT_ADC0PRETRGSEL_MASK);
+        }
+        else
+        {
+            IP_SIM->ADCOPT &= ~(SIM_ADCOPT_ADC1TRGSEL_MASK | SIM_ADCOPT_ADC1SWPRETRG_MASK |
+                                SIM_ADCOPT_ADC1PRETRGSEL_MASK);
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint32_t HAL_PDB_SetRate(HAL_PDB_Instance_t instance, uint32_t rate)
+{
+    uint32_t ticks;
+    uint32_t divider;
+    uint32_t period;
+    uint32_t result;
+    uint8_t mult;
+    uint8_t prescale;
+
+    result = 0U;
+
+    if (PDB_IS_AVAILABLE(instance) && (0U != rate))
+    {
+        ticks = HAL_PDB_CLOCK_HZ / rate;
+
+        for (mult = 0U; (mult < PDB_MULT_COUNT) && (0U == result); mult++)
+        {
+            for (prescale = 0U; (prescale <= PDB_PRESCALER_MAX) && (0U == result); prescale++)
+            {
+                divider = (uint32_t)s_pdbMult[mult] << prescale;
+                period  = (ticks + (divider / 2U)) / divider;
+
+                if ((period >= 1U) && (period <= PDB_MOD_MAX))
+                {
+                    s_pdbBase[instance]->SC  = PDB_SC_PRESCALER(prescale) | PDB_SC_MULT(mult) | PDB_SC_CONT_MASK;
+                    s_pdbBase[instance]->MOD = period - 1U;
+                    result = HAL_PDB_CLOCK_HZ / divider;
+                }
+                else
+                {
+                    /* Try a larger divider */
+                }
+            }
+        }
+    }
+    else
+    {
+        /* Invalid parameter, keep result = 0U */
+    }
+
+    return result;
+}
+
+uint16_t HAL_PDB_GetModulus(HAL_PDB_Instance_t instance)
+{
+    uint16_t modulus;
+
+    modulus = 0U;
+
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        modulus = (uint16_t)s_pdbBase[instance]->MOD;
+    }
+    else
+    {
+        /* Invalid instance, keep modulus = 0U */
+    }
+
+    return modulus;
+}
+
+void HAL_PDB_SetChain(HAL_PDB_Instance_t instance, uint8_t count, uint16_t delay0)
+{
+    uint32_t enable;
+
+    if (PDB_IS_AVAILABLE(instance) && (count >= 1U) && (count <= HAL_PDB_PRETRIGGER_COUNT))
+    {
+        enable = (1UL << count) - 1U;
+
+        /* All delayed (TOS), all but the first started by the previous ack (BB). */
+        s_pdbBase[instance]->CH[0].C1     = PDB_C1_EN(enable) | PDB_C1_TOS(enable) | PDB_C1_BB(enable & ~1UL);
+        s_pdbBase[instance]->CH[0].DLY[0] = delay0;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+void HAL_PDB_SetDmaDelay(HAL_PDB_Instance_t instance, uint16_t delay)
+{
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        s_pdbBase[instance]->IDLY = delay;
+        s_pdbBase[instance]->SC  |= PDB_SC_PDBIE_MASK | PDB_SC_DMAEN_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_PDB_Start(HAL_PDB_Instance_t instance, uint8_t trigger)
+{
+    PDB_Type *base;
+
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        base = s_pdbBase[instance];
+
+        /* LDOK is only accepted once the module is enabled. */
+        base->SC = (base->SC & ~PDB_SC_TRGSEL_MASK) | PDB_SC_TRGSEL(trigger) | PDB_SC_PDBEN_MASK;
+        base->SC |= PDB_SC_LDOK_MASK;
+
+        if (HAL_PDB_TRIGGER_SOFTWARE == trigger)
+        {
+            base->SC |= PDB_SC_SWTRIG_MASK;
+        }
+        else
+        {
+            /* Waits for the TRGMUX input */
+        }
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+void HAL_PDB_Stop(HAL_PDB_Instance_t instance)
+{
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        s_pdbBase[instance]->SC &= ~PDB_SC_PDBEN_MASK;
+    }
+    else
+    {
+        /* Invalid instance, do nothing */
+    }
+}
+
+uint16_t HAL_PDB_GetCounter(HAL_PDB_Instance_t instance)
+{
+    uint16_t counter;
+
+    counter = 0U;
+
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        counter = (uint16_t)s_pdbBase[instance]->CNT;
+    }
+    else
+    {
+        /* Invalid instance, keep counter = 0U */
+    }
+
+    return counter;
+}
+
+uint8_t HAL_PDB_GetSequenceErrors(HAL_PDB_Instance_t instance)
+{
+    uint32_t errors;
+
+    errors = 0U;
+
+    if (PDB_IS_AVAILABLE(instance))
+    {
+        errors = (s_pdbBase[instance]->CH[0].S & PDB_S_ERR_MASK) >> PDB_S_ERR_SHIFT;
+
+        /* ERR bits are cleared by writing 0, CF bits are kept. */
+        s_pdbBase[instance]->CH[0].S &= ~PDB_S_ERR_MASK;
+    }
+    else
+    {
+        /* Invalid instance, keep errors = 0U */
+    }
+
+    return (uint8_t)errors;
+}
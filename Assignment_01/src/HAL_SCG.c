@@ -0,0 +1,32 @@
+/*******************************************************************************
+ * @file    HAL_SCG.c
+ * @brief   Hardware abstraction layer for SCG clock dividers C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "HAL_SCG.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SCG_FIRCDIV2_DIV1       (1UL)       /**< FIRCDIV2 field code for / 1 */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HAL_SCG_ClockFromFircDiv2(uint32_t pccIndex)
+{
+    uint32_t fircdiv;
+
+    /* A 3-bit divide code: OR-ing into a non-zero field gives another divider */
+    fircdiv  = IP_SCG->FIRCDIV;
+    fircdiv &= ~SCG_FIRCDIV_FIRCDIV2_MASK;
+    fircdiv |= SCG_FIRCDIV_FIRCDIV2(SCG_FIRCDIV2_DIV1);
+    IP_SCG->FIRCDIV = fircdiv;
+
+    IP_PCC->PCCn[pccIndex] &= ~PCC_PCCn_CGC_MASK;
+    IP_PCC->PCCn[pccIndex] = PCC_PCCn_PCS(3U);
+    IP_PCC->PCCn[pccIndex] |= PCC_PCCn_CGC_MASK;
+}
@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * @file    Image_Verify.c
+ * @brief   Flash image integrity check C file.
+ *
+ * The CRC module runs CRC-32 without output reflection and complement, so
+ * its result is the raw CRC register: it is the checkpoint kept between
+ * steps and the seed of the next one. Reflection and complement are done
+ * once per range.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "Image_Verify.h"
+#include "CRC_Engine.h"
+#include "HAL_DWT.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define IMAGE_CRC_POLYNOMIAL    (0x04C11DB7UL)
+#define IMAGE_CRC_SEED          (0xFFFFFFFFUL)
+
+typedef struct
+{
+    uint8_t             status;
+    uint8_t             unsealed;       /**< A checked range has no CRC   */
+    uint8_t             range;          /**< Checkpoint: deferred range   */
+    uint32_t            offset;         /**< Checkpoint: bytes done in it */
+    uint32_t            state;          /**< Checkpoint: CRC register     */
+    uint32_t            remaining;
+    Image_VerifyStats_t stats;
+} Image_Verify_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern const Image_Descriptor_t __image_info__;     /**< Linker script */
+
+/* Nothing to check in the idle loop before Image_Verify_Boot() ran */
+static Image_Verify_t s_verify = { IMAGE_VERIFY_STATUS_PENDING, 0U, IMAGE_VERIFY_RANGE_MAX, 0U, 0U, 0U, { 0U } };
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint8_t Image_IsDeferred(const Image_Range_t *range);
+static uint8_t Image_NextDeferred(uint8_t range);
+static int32_t Image_Step(uint32_t addr, uint32_t size, uint32_t *state);
+static void Image_Finish(uint8_t range, uint32_t state);
+static void Image_UpdateStatus(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void Image_Verify_Boot(void)
+{
+    const Image_Descriptor_t *desc;
+    const Image_Range_t *range;
+    uint32_t start;
+    uint32_t state;
+    uint8_t i;
+
+    desc = &__image_info__;
+
+    s_verify.unsealed          = 0U;
+    s_verify.remaining         = 0U;
+    s_verify.stats.bootBytes   = 0U;
+    s_verify.stats.idleBytes   = 0U;
+    s_verify.stats.idleCycles  = 0U;
+    s_verify.stats.failedRange = IMAGE_VERIFY_RANGE_MAX;
+
+    HAL_DWT_EnableCycleCounter();
+    start = HAL_DWT_GetCycles();
+
+    (void)CRC_Engine_Init();
+
+    if ((IMAGE_VERIFY_MAGIC != desc->magic) || (desc->count > IMAGE_VERIFY_RANGE_MAX) ||
+        ((0U == desc->count) && (0U == IMAGE_VERIFY_ALLOW_UNSEALED)))
+    {
+        s_verify.status = IMAGE_VERIFY_STATUS_INVALID;
+        s_verify.range  = IMAGE_VERIFY_RANGE_MAX;
+    }
+    else
+    {
+        for (i = 0U; i < desc->count; i++)
+        {
+            range = &desc->range[i];
+
+            if (0U != Image_IsDeferred(range))
+            {
+                s_verify.remaining += range->size;
+            }
+            else
+            {
+                state = IMAGE_CRC_SEED;
+                (void)Image_Step(range->start, range->size, &state);
+                Image_Finish(i, state);
+                s_verify.stats.bootBytes += range->size;
+            }
+        }
+
+        /* An empty descriptor (RAM builds, allowed unsealed) has nothing sealed. */
+        s_verify.unsealed = (0U == desc->count) ? 1U : s_verify.unsealed;
+        s_verify.range    = Image_NextDeferred(0U);
+        s_verify.offset   = 0U;
+        s_verify.state    = IMAGE_CRC_SEED;
+        Image_UpdateStatus();
+    }
+
+    s_verify.stats.bootCycles = HAL_DWT_GetCycles() - start;
+}
+
+uint8_t Image_Verify_Idle(void)
+{
+    const Image_Range_t *range;
+    uint32_t start;
+    uint32_t size;
+    uint32_t state;
+
+    if ((s_verify.range < IMAGE_VERIFY_RANGE_MAX) && (0U == CRC_Engine_IsBusy()))
+    {
+        start = HAL_DWT_GetCycles();
+        range = &__image_info__.range[s_verify.range];
+        size  = range->size - s_verify.offset;
+        size  = (size > IMAGE_VERIFY_STEP) ? IMAGE_VERIFY_STEP : size;
+        state = s_verify.state;
+
+        if (ARM_DRIVER_OK == Image_Step(range->start + s_verify.offset, size, &state))
+        {
+            s_verify.state            = state;
+            s_verify.offset          += size;
+            s_verify.remaining       -= size;
+            s_verify.stats.idleBytes += size;
+
+            if (s_verify.offset == range->size)
+            {
+                Image_Finish(s_verify.range, state);
+
+                s_verify.range  = Image_NextDeferred(s_verify.range + 1U);
+                s_verify.offset = 0U;
+                s_verify.state  = IMAGE_CRC_SEED;
+                Image_UpdateStatus();
+            }
+            else
+            {
+                /* Range continues at the next call */
+            }
+        }
+        else
+        {
+            /* CRC module taken in between, retry at the next call */
+        }
+
+        s_verify.stats.idleCycles += HAL_DWT_GetCycles() - start;
+    }
+    else
+    {
+        /* Done, or the CRC module is feeding by DMA */
+    }
+
+    return (s_verify.range < IMAGE_VERIFY_RANGE_MAX) ? 1U : 0U;
+}
+
+uint8_t Image_Verify_GetStatus(void)
+{
+    return s_verify.status;
+}
+
+uint32_t Image_Verify_GetRemaining(void)
+{
+    return s_verify.remaining;
+}
+
+void Image_Verify_GetStats(Image_VerifyStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = s_verify.stats;
+    }
+    else
+    {
+        /* Nothing to fill */
+    }
+}
+
+static uint8_t Image_IsDeferred(const Image_Range_t *range)
+{
+    return ((0U != IMAGE_VERIFY_DEFER) && (0U == (range->flags & IMAGE_VERIFY_FLAG_HOT))) ? 1U : 0U;
+}
+
+static uint8_t Image_NextDeferred(uint8_t range)
+{
+    uint8_t i;
+
+    i = range;
+
+    while ((i < __image_info__.count) && (0U == Image_IsDeferred(&__image_info__.range[i])))
+    {
+        i++;
+    }
+
+    return (i < __image_info__.count) ? i : IMAGE_VERIFY_RANGE_MAX;
+}
+
+static int32_t Image_Step(uint32_t addr, uint32_t size, uint32_t *state)
+{
+    const CRC_Config_t config = { IMAGE_CRC_POLYNOMIAL, *state, 32U, 1U, 0U, 0U };
+    int32_t result;
+
+    result = CRC_Engine_Start(&config);
+
+    if (ARM_DRIVER_OK == result)
+    {
+        result = CRC_Engine_Update((const void *)addr, size);
+    }
+    else
+    {
+        /* DMA feed running */
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        *state = CRC_Engine_GetResult();
+    }
+    else
+    {
+        /* State unchanged */
+    }
+
+    return result;
+}
+
+static void Image_Finish(uint8_t range, uint32_t state)
+{
+    uint32_t expected;
+    uint32_t crc;
+    uint8_t i;
+
+    /* Raw register to CRC-32: reflect and complement */
+    crc = 0U;
+
+    for (i = 0U; i < 32U; i++)
+    {
+        crc = (crc << 1) | ((state >> i) & 1U);
+    }
+
+    crc     ^= 0xFFFFFFFFUL;
+    expected = __image_info__.range[range].crc;
+
+    if ((IMAGE_VERIFY_CRC_UNSET == expected) && (0U != IMAGE_VERIFY_ALLOW_UNSEALED))
+    {
+        s_verify.unsealed = 1U;
+    }
+    else if (((IMAGE_VERIFY_CRC_UNSET == expected) || (crc != expected)) &&
+             (IMAGE_VERIFY_RANGE_MAX == s_verify.stats.failedRange))
+    {
+        s_verify.stats.failedRange = range;
+    }
+    else
+    {
+        /* Match, or an earlier range failed already */
+    }
+}
+
+static void Image_UpdateStatus(void)
+{
+    if (IMAGE_VERIFY_RANGE_MAX != s_verify.stats.failedRange)
+    {
+        s_verify.status = IMAGE_VERIFY_STATUS_CORRUPT;
+    }
+    else if (IMAGE_VERIFY_RANGE_MAX != s_verify.range)
+    {
+        s_verify.status = IMAGE_VERIFY_STATUS_PENDING;
+    }
+    else if (0U != s_verify.unsealed)
+    {
+        s_verify.status = IMAGE_VERIFY_STATUS_UNSEALED;
+    }
+    else
+    {
+        s_verify.status = IMAGE_VERIFY_STATUS_OK;
+    }
+}
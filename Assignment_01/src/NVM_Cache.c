@@ -0,0 +1,537 @@
+/*******************************************************************************
+ * @file    NVM_Cache.c
+ * @brief   Write-back RAM cache in front of a CMSIS Flash driver C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "NVM_Cache.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CACHE_ERASED_VALUE          (0xFFU)
+
+/* Phrase selection of a write back */
+#define CACHE_SELECT_DIRTY          (0U)        /**< Dirty phrases, in place */
+#define CACHE_SELECT_PROGRAMMED     (1U)        /**< Every non-erased phrase, after a sector erase */
+
+#define CACHE_IS_DIRTY(page, p)     (0U != ((page)->dirty[(p) / 32U] & (1UL << ((p) % 32U))))
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static int32_t  Cache_Wait(const NVM_Cache_t *cache, int32_t result);
+static int32_t  Cache_FlashRead(const NVM_Cache_t *cache, uint32_t addr, void *data, uint32_t size);
+static int32_t  Cache_Program(const NVM_Cache_t *cache, uint32_t addr, const uint8_t *data, uint32_t size);
+static int32_t  Cache_Erase(const NVM_Cache_t *cache, uint32_t addr);
+
+static uint8_t  Cache_IsErased(const uint8_t *data, uint32_t size);
+static uint8_t  Cache_Selected(const NVM_CachePage_t *page, uint32_t phrase, uint8_t select);
+static int32_t  Cache_ProgramRuns(NVM_Cache_t *cache, const NVM_CachePage_t *page, uint8_t select);
+static int32_t  Cache_WriteBack(NVM_Cache_t *cache, NVM_CachePage_t *page);
+static NVM_CachePage_t *Cache_Find(NVM_Cache_t *cache, uint32_t sector);
+static NVM_CachePage_t *Cache_Lowest(NVM_Cache_t *cache);
+static int32_t  Cache_Load(NVM_Cache_t *cache, uint32_t sector, NVM_CachePage_t **page);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t NVM_Cache_Init(NVM_Cache_t *cache, const NVM_CacheConfig_t *config)
+{
+    int32_t result;
+    ARM_FLASH_INFO *info;
+    uint8_t i;
+    uint8_t j;
+
+    info = ((NULL != config) && (NULL != config->driver)) ? config->driver->GetInfo() : NULL;
+
+    if ((NULL == cache) || (NULL == info) || (NULL == config->buffer) ||
+        (0U == config->pageCount) || (config->pageCount > NVM_CACHE_PAGE_MAX) ||
+        (info->sector_size > NVM_CACHE_SECTOR_MAX) || (info->program_unit > NVM_CACHE_PHRASE) ||
+        (0U == config->size) || (0U != (config->base % info->sector_size)) || (0U != (config->size % info->sector_size)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        cache->config     = config;
+        cache->sectorSize = info->sector_size;
+        cache->clock      = 0U;
+        cache->dirtyCount = 0U;
+        cache->written    = 0U;
+        cache->programmed = 0U;
+        cache->erased     = 0U;
+        cache->writeBacks = 0U;
+
+        for (i = 0U; i < config->pageCount; i++)
+        {
+            cache->page[i].address    = NVM_CACHE_NO_PAGE;
+            cache->page[i].data       = &config->buffer[(uint32_t)i * info->sector_size];
+            cache->page[i].dirtyCount = 0U;
+            cache->page[i].used       = 0U;
+
+            for (j = 0U; j < (NVM_CACHE_SECTOR_MAX / NVM_CACHE_PHRASE / 32U); j++)
+            {
+                cache->page[i].dirty[j] = 0U;
+            }
+        }
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+int32_t NVM_Cache_Read(NVM_Cache_t *cache, uint32_t addr, void *data, uint32_t size)
+{
+    int32_t result;
+    const NVM_CachePage_t *page;
+    uint8_t *dst;
+    uint32_t sector;
+    uint32_t offset;
+    uint32_t count;
+    uint32_t i;
+    uint32_t j;
+
+    if ((NULL == cache) || (NULL == cache->config) || (NULL == data) || (addr < cache->config->base) ||
+        ((addr - cache->config->base) > cache->config->size) || (size > (cache->config->size - (addr - cache->config->base))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = ARM_DRIVER_OK;
+        dst    = (uint8_t *)data;
+
+        /* Sector by sector: from the page if cached, else from flash */
+        for (i = 0U; (ARM_DRIVER_OK == result) && (i < size); i += count)
+        {
+            offset = (addr + i - cache->config->base) % cache->sectorSize;
+            sector = (addr + i) - offset;
+            count  = ((cache->sectorSize - offset) < (size - i)) ? (cache->sectorSize - offset) : (size - i);
+            page   = Cache_Find(cache, sector);
+
+            if (NULL != page)
+            {
+                for (j = 0U; j < count; j++)
+                {
+                    dst[i + j] = page->data[offset + j];
+                }
+            }
+            else
+            {
+                result = Cache_FlashRead(cache, addr + i, &dst[i], count);
+            }
+        }
+
+        result = (ARM_DRIVER_OK == result) ? (int32_t)size : result;
+    }
+
+    return result;
+}
+
+int32_t NVM_Cache_Write(NVM_Cache_t *cache, uint32_t addr, const void *data, uint32_t size)
+{
+    int32_t result;
+    NVM_CachePage_t *page;
+    const uint8_t *src;
+    uint32_t sector;
+    uint32_t offset;
+    uint32_t count;
+    uint32_t phrase;
+    uint32_t i;
+    uint32_t j;
+
+    if ((NULL == cache) || (NULL == cache->config) || (NULL == data) || (addr < cache->config->base) ||
+        ((addr - cache->config->base) > cache->config->size) || (size > (cache->config->size - (addr - cache->config->base))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        result = ARM_DRIVER_OK;
+        src    = (const uint8_t *)data;
+
+        for (i = 0U; (ARM_DRIVER_OK == result) && (i < size); i += count)
+        {
+            offset = (addr + i - cache->config->base) % cache->sectorSize;
+            sector = (addr + i) - offset;
+            count  = ((cache->sectorSize - offset) < (size - i)) ? (cache->sectorSize - offset) : (size - i);
+            result = Cache_Load(cache, sector, &page);
+
+            for (j = 0U; (ARM_DRIVER_OK == result) && (j < count); j++)
+            {
+                /* Unchanged bytes leave their phrase clean. */
+                if (page->data[offset + j] != src[i + j])
+                {
+                    page->data[offset + j] = src[i + j];
+                    phrase = (offset + j) / NVM_CACHE_PHRASE;
+
+                    if (!CACHE_IS_DIRTY(page, phrase))
+                    {
+                        page->dirty[phrase / 32U] |= 1UL << (phrase % 32U);
+                        page->dirtyCount++;
+                        cache->dirtyCount++;
+                    }
+                    else
+                    {
+                        /* Merged into a dirty phrase */
+                    }
+                }
+                else
+                {
+                    /* Same value */
+                }
+            }
+        }
+
+        cache->written += size;
+
+        if ((ARM_DRIVER_OK == result) && (0U != cache->config->watermark) && (cache->dirtyCount >= cache->config->watermark))
+        {
+            result = NVM_Cache_Sync(cache);
+        }
+        else
+        {
+            /* Kept in RAM */
+        }
+
+        result = (ARM_DRIVER_OK == result) ? (int32_t)size : result;
+    }
+
+    return result;
+}
+
+int32_t NVM_Cache_Sync(NVM_Cache_t *cache)
+{
+    int32_t result;
+
+    result = NVM_Cache_Idle(cache);
+
+    while (result > 0)
+    {
+        result = NVM_Cache_Idle(cache);
+    }
+
+    return result;
+}
+
+int32_t NVM_Cache_Idle(NVM_Cache_t *cache)
+{
+    int32_t result;
+    NVM_CachePage_t *page;
+
+    if ((NULL == cache) || (NULL == cache->config))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        page = Cache_Lowest(cache);
+
+        if (NULL == page)
+        {
+            result = 0;
+        }
+        else
+        {
+            result = Cache_WriteBack(cache, page);
+            result = (ARM_DRIVER_OK == result) ? 1 : result;
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * Flash access
+ ******************************************************************************/
+
+static int32_t Cache_Wait(const NVM_Cache_t *cache, int32_t result)
+{
+    ARM_FLASH_STATUS status;
+
+    /* ProgramData may return the count of data items it took */
+    if (result >= 0)
+    {
+        do
+        {
+            status = cache->config->driver->GetStatus();
+        } while (0U != status.busy);
+
+        result = (0U != status.error) ? ARM_DRIVER_ERROR : ARM_DRIVER_OK;
+    }
+    else
+    {
+        /* Not started */
+    }
+
+    return result;
+}
+
+static int32_t Cache_FlashRead(const NVM_Cache_t *cache, uint32_t addr, void *data, uint32_t size)
+{
+    int32_t result;
+
+    result = cache->config->driver->ReadData(addr, data, size);
+
+    return (result == (int32_t)size) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR;
+}
+
+static int32_t Cache_Program(const NVM_Cache_t *cache, uint32_t addr, const uint8_t *data, uint32_t size)
+{
+    int32_t result;
+
+    /* The engine may be held by the EEPROM emulation for a few words. */
+    do
+    {
+        result = cache->config->driver->ProgramData(addr, data, size);
+    } while (ARM_DRIVER_ERROR_BUSY == result);
+
+    return Cache_Wait(cache, result);
+}
+
+static int32_t Cache_Erase(const NVM_Cache_t *cache, uint32_t addr)
+{
+    int32_t result;
+
+    do
+    {
+        result = cache->config->driver->EraseSector(addr);
+    } while (ARM_DRIVER_ERROR_BUSY == result);
+
+    return Cache_Wait(cache, result);
+}
+
+/*******************************************************************************
+ * Pages
+ ******************************************************************************/
+
+static uint8_t Cache_IsErased(const uint8_t *data, uint32_t size)
+{
+    uint8_t erased;
+    uint32_t i;
+
+    erased = 1U;
+
+    for (i = 0U; (0U != erased) && (i < size); i++)
+    {
+        erased = (CACHE_ERASED_VALUE == data[i]) ? 1U : 0U;
+    }
+
+    return erased;
+}
+
+static uint8_t Cache_Selected(const NVM_CachePage_t *page, uint32_t phrase, uint8_t select)
+{
+    uint8_t selected;
+
+    if (CACHE_SELECT_DIRTY == select)
+    {
+        selected = CACHE_IS_DIRTY(page, phrase) ? 1U : 0U;
+    }
+    else
+    {
+        selected = (0U == Cache_IsErased(&page->data[phrase * NVM_CACHE_PHRASE], NVM_CACHE_PHRASE)) ? 1U : 0U;
+    }
+
+    return selected;
+}
+
+static int32_t Cache_ProgramRuns(NVM_Cache_t *cache, const NVM_CachePage_t *page, uint8_t select)
+{
+    int32_t result;
+    uint32_t phrases;
+    uint32_t first;
+    uint32_t p;
+
+    result  = ARM_DRIVER_OK;
+    phrases = cache->sectorSize / NVM_CACHE_PHRASE;
+    first   = phrases;
+
+    /* One ProgramData per run of consecutive selected phrases, in address order */
+    for (p = 0U; (ARM_DRIVER_OK == result) && (p <= phrases); p++)
+    {
+        if ((p < phrases) && (0U != Cache_Selected(page, p, select)))
+        {
+            first = (first < phrases) ? first : p;
+        }
+        else if (first < phrases)
+        {
+            result = Cache_Program(cache, page->address + (first * NVM_CACHE_PHRASE),
+                                   &page->data[first * NVM_CACHE_PHRASE], (p - first) * NVM_CACHE_PHRASE);
+            cache->programmed += (p - first) * NVM_CACHE_PHRASE;
+            first = phrases;
+        }
+        else
+        {
+            /* Outside a run */
+        }
+    }
+
+    return result;
+}
+
+static int32_t Cache_WriteBack(NVM_Cache_t *cache, NVM_CachePage_t *page)
+{
+    int32_t result;
+    uint8_t flash[NVM_CACHE_PHRASE];
+    uint8_t select;
+    uint32_t phrases;
+    uint32_t p;
+
+    result  = ARM_DRIVER_OK;
+    select  = CACHE_SELECT_DIRTY;
+    phrases = cache->sectorSize / NVM_CACHE_PHRASE;
+
+    /* In place only if every dirty phrase is still erased in flash */
+    for (p = 0U; (ARM_DRIVER_OK == result) && (CACHE_SELECT_DIRTY == select) && (p < phrases); p++)
+    {
+        if (CACHE_IS_DIRTY(page, p))
+        {
+            result = Cache_FlashRead(cache, page->address + (p * NVM_CACHE_PHRASE), flash, NVM_CACHE_PHRASE);
+            select = (0U != Cache_IsErased(flash, NVM_CACHE_PHRASE)) ? CACHE_SELECT_DIRTY : CACHE_SELECT_PROGRAMMED;
+        }
+        else
+        {
+            /* Clean */
+        }
+    }
+
+    if ((ARM_DRIVER_OK == result) && (CACHE_SELECT_PROGRAMMED == select))
+    {
+        result = Cache_Erase(cache, page->address);
+        cache->erased++;
+    }
+    else
+    {
+        /* Programmed in place */
+    }
+
+    result = (ARM_DRIVER_OK == result) ? Cache_ProgramRuns(cache, page, select) : result;
+
+    if (ARM_DRIVER_OK == result)
+    {
+        for (p = 0U; p < (NVM_CACHE_SECTOR_MAX / NVM_CACHE_PHRASE / 32U); p++)
+        {
+            page->dirty[p] = 0U;
+        }
+
+        cache->dirtyCount -= page->dirtyCount;
+        page->dirtyCount   = 0U;
+        cache->writeBacks++;
+    }
+    else
+    {
+        /* Page kept dirty, retried by the next write back */
+    }
+
+    return result;
+}
+
+static NVM_CachePage_t *Cache_Find(NVM_Cache_t *cache, uint32_t sector)
+{
+    NVM_CachePage_t *page;
+    uint8_t i;
+
+    page = NULL;
+
+    for (i = 0U; (NULL == page) && (i < cache->config->pageCount); i++)
+    {
+        if (sector == cache->page[i].address)
+        {
+            page = &cache->page[i];
+            page->used = ++cache->clock;
+        }
+        else
+        {
+            /* Other sector */
+        }
+    }
+
+    return page;
+}
+
+static NVM_CachePage_t *Cache_Lowest(NVM_Cache_t *cache)
+{
+    NVM_CachePage_t *page;
+    uint8_t i;
+
+    page = NULL;
+
+    for (i = 0U; i < cache->config->pageCount; i++)
+    {
+        if ((0U != cache->page[i].dirtyCount) && ((NULL == page) || (cache->page[i].address < page->address)))
+        {
+            page = &cache->page[i];
+        }
+        else
+        {
+            /* Clean or higher */
+        }
+    }
+
+    return page;
+}
+
+static int32_t Cache_Load(NVM_Cache_t *cache, uint32_t sector, NVM_CachePage_t **page)
+{
+    int32_t result;
+    NVM_CachePage_t *victim;
+    uint8_t i;
+
+    result = ARM_DRIVER_OK;
+    *page  = Cache_Find(cache, sector);
+
+    if (NULL == *page)
+    {
+        /* Free page, else the least recently used one */
+        victim = &cache->page[0];
+
+        for (i = 1U; (NVM_CACHE_NO_PAGE != victim->address) && (i < cache->config->pageCount); i++)
+        {
+            victim = ((NVM_CACHE_NO_PAGE == cache->page[i].address) || (cache->page[i].used < victim->used)) ?
+                     &cache->page[i] : victim;
+        }
+
+        if (0U != victim->dirtyCount)
+        {
+            result = Cache_WriteBack(cache, victim);
+        }
+        else
+        {
+            /* Clean: dropped */
+        }
+
+        if (ARM_DRIVER_OK == result)
+        {
+            victim->address = NVM_CACHE_NO_PAGE;
+            result = Cache_FlashRead(cache, sector, victim->data, cache->sectorSize);
+        }
+        else
+        {
+            /* Victim kept */
+        }
+
+        if (ARM_DRIVER_OK == result)
+        {
+            victim->address = sector;
+            victim->used    = ++cache->clock;
+            *page           = victim;
+        }
+        else
+        {
+            /* Flash error */
+        }
+    }
+    else
+    {
+        /* Hit */
+    }
+
+    return result;
+}
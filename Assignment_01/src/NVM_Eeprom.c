@@ -0,0 +1,352 @@
+/*******************************************************************************
+ * @file    NVM_Eeprom.c
+ * @brief   Slot store on the FlexNVM emulated EEPROM (FlexRAM EEE) C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "NVM_Eeprom.h"
+#include "HAL_FTFC.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Program Partition parameters (FCCOB4 ... 8) */
+#define EEPROM_CSEC_KEYS            (0x00U)     /**< No CSEc key storage */
+#define EEPROM_SFE                  (0x00U)     /**< Verify only disabled */
+#define EEPROM_LOAD_AT_RESET        (0x00U)     /**< FlexRAM loaded with EEPROM data at reset */
+#define EEPROM_SIZE_CODE            (0x02U)     /**< 4 KB EEPROM */
+#define EEPROM_DEPART_CODE          (0x03U)     /**< 32 KB D-Flash, 32 KB EEPROM backup */
+
+#define EEPROM_WORD                 (4U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static volatile uint32_t *const s_flexRam = (volatile uint32_t *)HAL_FTFC_FLEXRAM_BASE;
+
+static NVM_Eeprom_Callback_t s_callback = NULL;
+static uint16_t s_slotCount = 0U;
+static uint16_t s_slotOffset[NVM_EEPROM_SLOT_MAX + 1U];     /**< Byte offset, last entry = end */
+
+static NVM_EepromStats_t s_stats;
+
+/* Write in progress */
+static volatile uint8_t s_busy = 0U;
+static uint16_t s_writeSlot;
+static const uint8_t *s_writeData;
+static uint16_t s_writeSize;
+static uint16_t s_writeOffset;      /**< Offset in the slot of the word being written */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static int32_t  Eeprom_RunCommand(uint8_t command, uint32_t address, const uint8_t *param, uint8_t paramCount);
+static uint8_t  Eeprom_WriteNext(void);
+static void     Eeprom_Finish(uint32_t event);
+static void     Eeprom_CommandDone(void *param);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t NVM_Eeprom_Partition(void)
+{
+    static const uint8_t s_partition[] =
+    {
+        EEPROM_CSEC_KEYS, EEPROM_SFE, EEPROM_LOAD_AT_RESET, EEPROM_SIZE_CODE, EEPROM_DEPART_CODE
+    };
+    int32_t result;
+
+    HAL_FTFC_Init();
+
+    if (0U != HAL_FTFC_GetEeeSize())
+    {
+        /* Already partitioned */
+        result = ARM_DRIVER_OK;
+    }
+    else
+    {
+        result = Eeprom_RunCommand(HAL_FTFC_CMD_PROGRAM_PARTITION, 0U, s_partition, (uint8_t)sizeof(s_partition));
+    }
+
+    return result;
+}
+
+int32_t NVM_Eeprom_Init(const uint16_t *slotSize, uint16_t slotCount, NVM_Eeprom_Callback_t callback)
+{
+    int32_t result;
+    uint32_t offset;
+    uint16_t i;
+
+    result = ARM_DRIVER_OK;
+    offset = 0U;
+
+    HAL_FTFC_Init();
+
+    if ((NULL == slotSize) || (0U == slotCount) || (slotCount > NVM_EEPROM_SLOT_MAX))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == HAL_FTFC_GetEeeSize())
+    {
+        /* No EEPROM backup: NVM_Eeprom_Partition() first */
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        /* Slots start on a word so each EEPROM record covers a single slot. */
+        for (i = 0U; i < slotCount; i++)
+        {
+            s_slotOffset[i] = (uint16_t)offset;
+            offset += ((uint32_t)slotSize[i] + (EEPROM_WORD - 1U)) & ~(EEPROM_WORD - 1UL);
+        }
+
+        s_slotOffset[slotCount] = (uint16_t)offset;
+
+        if (offset > HAL_FTFC_GetEeeSize())
+        {
+            result = ARM_DRIVER_ERROR_PARAMETER;
+        }
+        else if (0U == HAL_FTFC_IsEeeReady())
+        {
+            /* The function code is FCCOB1, the address field is not used. */
+            result = Eeprom_RunCommand(HAL_FTFC_CMD_SET_FLEXRAM, (uint32_t)HAL_FTFC_FLEXRAM_EEE << 16, NULL, 0U);
+            result = ((ARM_DRIVER_OK == result) && (0U == HAL_FTFC_IsEeeReady())) ? ARM_DRIVER_ERROR : result;
+        }
+        else
+        {
+            /* Loaded at reset */
+        }
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        s_callback  = callback;
+        s_slotCount = slotCount;
+
+        s_stats.bytesRequested = 0U;
+        s_stats.wordsWritten   = 0U;
+        s_stats.wordsSkipped   = 0U;
+    }
+    else
+    {
+        s_slotCount = 0U;
+    }
+
+    return result;
+}
+
+int32_t NVM_Eeprom_Read(uint16_t slot, void *data, uint16_t size)
+{
+    int32_t result;
+    const volatile uint8_t *src;
+    uint8_t *dst;
+    uint16_t i;
+
+    if ((slot >= s_slotCount) || (NULL == data) || (size > (s_slotOffset[slot + 1U] - s_slotOffset[slot])))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U != s_busy) && (slot == s_writeSlot))
+    {
+        /* Old and new words mixed */
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        src = (const volatile uint8_t *)s_flexRam + s_slotOffset[slot];
+        dst = (uint8_t *)data;
+
+        for (i = 0U; i < size; i++)
+        {
+            dst[i] = src[i];
+        }
+
+        result = (int32_t)size;
+    }
+
+    return result;
+}
+
+int32_t NVM_Eeprom_Write(uint16_t slot, const void *data, uint16_t size)
+{
+    int32_t result;
+
+    result = ARM_DRIVER_OK;
+
+    if ((slot >= s_slotCount) || (NULL == data) || (size > (s_slotOffset[slot + 1U] - s_slotOffset[slot])))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U != s_busy) || (0U == HAL_FTFC_Acquire(Eeprom_CommandDone, NULL)))
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        s_busy        = 1U;
+        s_writeSlot   = slot;
+        s_writeData   = (const uint8_t *)data;
+        s_writeSize   = size;
+        s_writeOffset = 0U;
+
+        s_stats.bytesRequested += size;
+
+        if (0U == Eeprom_WriteNext())
+        {
+            /* Nothing changed: no EEPROM record at all */
+            Eeprom_Finish(NVM_EEPROM_EVENT_WRITE_DONE);
+        }
+        else
+        {
+            /* Continued by the command complete interrupt */
+        }
+    }
+
+    return result;
+}
+
+uint8_t NVM_Eeprom_IsBusy(void)
+{
+    return s_busy;
+}
+
+void NVM_Eeprom_GetStats(NVM_EepromStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = s_stats;
+    }
+    else
+    {
+        /* Invalid parameter, do nothing */
+    }
+}
+
+static int32_t Eeprom_RunCommand(uint8_t command, uint32_t address, const uint8_t *param, uint8_t paramCount)
+{
+    int32_t result;
+    uint8_t i;
+
+    /*
+     * FCCOB belongs to the owner of the engine: it is only loaded once the
+     * engine is ours, never under a command of the flash driver.
+     */
+    if (0U == HAL_FTFC_Acquire(Eeprom_CommandDone, NULL))
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        HAL_FTFC_SetCommand(command, address);
+
+        for (i = 0U; i < paramCount; i++)
+        {
+            HAL_FTFC_SetParam((uint8_t)(4U + i), param[i]);
+        }
+
+        /* FlexNVM commands: code keeps running from P-Flash while waiting. */
+        HAL_FTFC_ClearErrors();
+        HAL_FTFC_Launch(1U);
+
+        result = (0U != HAL_FTFC_GetErrors()) ? ARM_DRIVER_ERROR : ARM_DRIVER_OK;
+
+        HAL_FTFC_Release();
+    }
+
+    return result;
+}
+
+static uint8_t Eeprom_WriteNext(void)
+{
+    uint8_t started;
+    uint32_t index;
+    uint32_t word;
+    uint32_t old;
+    uint16_t i;
+    uint16_t byte;
+
+    started = 0U;
+
+    while ((0U == started) && (s_writeOffset < s_writeSize))
+    {
+        index = ((uint32_t)s_slotOffset[s_writeSlot] + s_writeOffset) / EEPROM_WORD;
+        old   = s_flexRam[index];
+        word  = old;
+
+        /* Little endian word from the caller bytes, bytes past size keep their value. */
+        for (i = 0U; (i < EEPROM_WORD) && ((s_writeOffset + i) < s_writeSize); i++)
+        {
+            byte = (uint16_t)(8U * i);
+            word = (word & ~(0xFFUL << byte)) | ((uint32_t)s_writeData[s_writeOffset + i] << byte);
+        }
+
+        if (word != old)
+        {
+            /* The store itself starts the EEPROM record write, CCIF clears until it is done. */
+            HAL_FTFC_ClearErrors();
+            s_flexRam[index] = word;
+            HAL_FTFC_EnableCompleteInterrupt(1U);
+
+            s_stats.wordsWritten++;
+            started = 1U;
+        }
+        else
+        {
+            s_stats.wordsSkipped++;
+            s_writeOffset += EEPROM_WORD;
+        }
+    }
+
+    return started;
+}
+
+/*******************************************************************************
+ * Interrupt handling
+ ******************************************************************************/
+
+static void Eeprom_Finish(uint32_t event)
+{
+    HAL_FTFC_Release();
+    s_busy = 0U;
+
+    if (NULL != s_callback)
+    {
+        s_callback(s_writeSlot, event);
+    }
+    else
+    {
+        /* No callback registered */
+    }
+}
+
+static void Eeprom_CommandDone(void *param)
+{
+    (void)param;
+
+    if (0U == HAL_FTFC_IsReady())
+    {
+        /* Record still being written */
+    }
+    else if (0U != HAL_FTFC_GetErrors())
+    {
+        Eeprom_Finish(NVM_EEPROM_EVENT_WRITE_ERROR);
+    }
+    else
+    {
+        s_writeOffset += EEPROM_WORD;
+
+        if (0U == Eeprom_WriteNext())
+        {
+            Eeprom_Finish(NVM_EEPROM_EVENT_WRITE_DONE);
+        }
+        else
+        {
+            /* Next word started */
+        }
+    }
+}
@@ -0,0 +1,828 @@
+/*******************************************************************************
+ * @file    NVM_Log.c
+ * @brief   Log-structured key/value store on a CMSIS Flash driver C file.
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "NVM_Log.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define LOG_MAGIC                   (0x4C4D564EUL)  /**< "NVML" */
+#define LOG_ERASED_SEQUENCE         (0xFFFFFFFFUL)
+#define LOG_ERASED_CRC              (0xFFFFFFFFUL)
+#define LOG_PHRASE                  (8U)
+#define LOG_HEADER_SIZE             (8U)
+
+/** Log_Mount(): partial compaction copy dropped, mount again */
+#define LOG_REMOUNT                 (1)
+
+/** Flash bytes taken by a record with a value of size bytes. */
+#define LOG_RECORD_SIZE(size)       (LOG_HEADER_SIZE + (((uint32_t)(size) + (LOG_PHRASE - 1U)) & ~(LOG_PHRASE - 1UL)))
+
+/**
+ * @brief Sector header, first two phrases of every sector in use.
+ */
+typedef struct
+{
+    uint32_t    magic;
+    uint32_t    sequence;
+    uint32_t    inverse;        /**< ~sequence */
+    uint32_t    reserved;       /**< Left erased */
+} Log_SectorHeader_t;
+
+/**
+ * @brief Record header, the CRC covers key, size and value.
+ */
+typedef struct
+{
+    uint16_t    key;
+    uint16_t    size;           /**< 0 = key deleted */
+    uint32_t    crc;
+} Log_RecordHeader_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* CRC-32 (reflected 0xEDB88320), one nibble per step */
+static const uint32_t s_crcTable[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t Log_Crc(const Log_RecordHeader_t *header, const uint8_t *value);
+static uint32_t Log_SectorBase(const NVM_Log_t *log, uint8_t sector);
+static int32_t  Log_Wait(const NVM_Log_t *log, int32_t result);
+static int32_t  Log_Read(const NVM_Log_t *log, uint32_t address, void *data, uint32_t size);
+static int32_t  Log_Program(const NVM_Log_t *log, uint32_t address, const void *data, uint32_t size);
+static int32_t  Log_Erase(NVM_Log_t *log, uint8_t sector);
+static int32_t  Log_IsBlank(NVM_Log_t *log, uint8_t sector, uint8_t *blank);
+static int32_t  Log_Open(NVM_Log_t *log, uint8_t sector);
+static uint8_t  Log_Oldest(const NVM_Log_t *log);
+static uint8_t  Log_NextErased(const NVM_Log_t *log);
+static int32_t  Log_Compact(NVM_Log_t *log, uint8_t victim);
+static int32_t  Log_Reserve(NVM_Log_t *log, uint32_t size);
+static int32_t  Log_Append(NVM_Log_t *log, uint16_t key, const void *data, uint16_t size, uint32_t *address);
+static int32_t  Log_Scan(NVM_Log_t *log, uint8_t sector);
+static int32_t  Log_Mount(NVM_Log_t *log);
+
+static uint16_t Log_Hash(const NVM_Log_t *log, uint16_t key);
+static uint16_t Log_Find(const NVM_Log_t *log, uint16_t key);
+static int32_t  Log_Insert(NVM_Log_t *log, uint16_t key, uint16_t size, uint32_t address);
+static void     Log_Remove(NVM_Log_t *log, uint16_t key);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t NVM_Log_Init(NVM_Log_t *log, const NVM_LogConfig_t *config)
+{
+    int32_t result;
+    ARM_FLASH_INFO *info;
+
+    info = ((NULL != config) && (NULL != config->driver)) ? config->driver->GetInfo() : NULL;
+
+    if ((NULL == log) || (NULL == info) || (NULL == config->index) ||
+        (config->sectorCount < 2U) || (config->sectorCount > NVM_LOG_SECTOR_MAX) ||
+        (config->indexSize < 2U) || (0U != (config->indexSize & (config->indexSize - 1U))) ||
+        (0U != (config->base % info->sector_size)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        log->config     = config;
+        log->sectorSize = info->sector_size;
+
+        /* At most once more: the dropped copy leaves an erased sector */
+        do
+        {
+            result = Log_Mount(log);
+        } while (LOG_REMOUNT == result);
+    }
+
+    return result;
+}
+
+int32_t NVM_Log_Get(const NVM_Log_t *log, uint16_t key, void *data, uint16_t size)
+{
+    int32_t result;
+    const NVM_LogEntry_t *entry;
+    uint16_t count;
+
+    if ((NULL == log) || (NULL == log->config) || (NULL == data) || (NVM_LOG_KEY_NONE == key))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        entry = &log->config->index[Log_Find(log, key)];
+
+        if (NVM_LOG_KEY_NONE == entry->key)
+        {
+            result = NVM_LOG_ERROR_NOT_FOUND;
+        }
+        else
+        {
+            /* The only flash access: the value itself */
+            count  = (size < entry->size) ? size : entry->size;
+            result = Log_Read(log, entry->address + LOG_HEADER_SIZE, data, count);
+            result = (ARM_DRIVER_OK == result) ? (int32_t)count : result;
+        }
+    }
+
+    return result;
+}
+
+int32_t NVM_Log_GetSize(const NVM_Log_t *log, uint16_t key)
+{
+    int32_t result;
+    const NVM_LogEntry_t *entry;
+
+    if ((NULL == log) || (NULL == log->config) || (NVM_LOG_KEY_NONE == key))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        entry  = &log->config->index[Log_Find(log, key)];
+        result = (NVM_LOG_KEY_NONE == entry->key) ? NVM_LOG_ERROR_NOT_FOUND : (int32_t)entry->size;
+    }
+
+    return result;
+}
+
+int32_t NVM_Log_Put(NVM_Log_t *log, uint16_t key, const void *data, uint16_t size)
+{
+    int32_t result;
+    uint32_t address;
+
+    if ((NULL == log) || (NULL == log->config) || (NULL == data) || (NVM_LOG_KEY_NONE == key) ||
+        (0U == size) || (size > NVM_LOG_VALUE_MAX))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((NVM_LOG_KEY_NONE == log->config->index[Log_Find(log, key)].key) &&
+             ((log->keyCount + 1U) >= log->config->indexSize))
+    {
+        /* New key, keep one free index entry to end the probing */
+        result = NVM_LOG_ERROR_FULL;
+    }
+    else
+    {
+        result = Log_Append(log, key, data, size, &address);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            result = Log_Insert(log, key, size, address);
+        }
+        else
+        {
+            /* Index unchanged: the previous value stays */
+        }
+    }
+
+    return result;
+}
+
+int32_t NVM_Log_Delete(NVM_Log_t *log, uint16_t key)
+{
+    int32_t result;
+    uint32_t address;
+
+    if ((NULL == log) || (NULL == log->config) || (NVM_LOG_KEY_NONE == key))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (NVM_LOG_KEY_NONE == log->config->index[Log_Find(log, key)].key)
+    {
+        result = ARM_DRIVER_OK;
+    }
+    else
+    {
+        result = Log_Append(log, key, NULL, 0U, &address);
+
+        if (ARM_DRIVER_OK == result)
+        {
+            Log_Remove(log, key);
+        }
+        else
+        {
+            /* Key kept */
+        }
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * Flash access
+ ******************************************************************************/
+
+static uint32_t Log_Crc(const Log_RecordHeader_t *header, const uint8_t *value)
+{
+    uint8_t bytes[4];
+    uint32_t crc;
+    uint16_t i;
+
+    bytes[0] = (uint8_t)header->key;
+    bytes[1] = (uint8_t)(header->key >> 8);
+    bytes[2] = (uint8_t)header->size;
+    bytes[3] = (uint8_t)(header->size >> 8);
+
+    crc = 0xFFFFFFFFUL;
+
+    for (i = 0U; i < (4U + header->size); i++)
+    {
+        crc ^= (i < 4U) ? bytes[i] : value[i - 4U];
+        crc  = (crc >> 4) ^ s_crcTable[crc & 0x0FU];
+        crc  = (crc >> 4) ^ s_crcTable[crc & 0x0FU];
+    }
+
+    return ~crc;
+}
+
+static uint32_t Log_SectorBase(const NVM_Log_t *log, uint8_t sector)
+{
+    return log->config->base + ((uint32_t)sector * log->sectorSize);
+}
+
+static int32_t Log_Wait(const NVM_Log_t *log, int32_t result)
+{
+    ARM_FLASH_STATUS status;
+
+    /* ProgramData may return the count of data items it took */
+    if (result >= 0)
+    {
+        do
+        {
+            status = log->config->driver->GetStatus();
+        } while (0U != status.busy);
+
+        result = (0U != status.error) ? ARM_DRIVER_ERROR : ARM_DRIVER_OK;
+    }
+    else
+    {
+        /* Not started */
+    }
+
+    return result;
+}
+
+static int32_t Log_Read(const NVM_Log_t *log, uint32_t address, void *data, uint32_t size)
+{
+    int32_t result;
+
+    result = log->config->driver->ReadData(address, data, size);
+
+    return (result == (int32_t)size) ? ARM_DRIVER_OK : ARM_DRIVER_ERROR;
+}
+
+static int32_t Log_Program(const NVM_Log_t *log, uint32_t address, const void *data, uint32_t size)
+{
+    int32_t result;
+
+    /* The engine may be held by the EEPROM emulation for a few words. */
+    do
+    {
+        result = log->config->driver->ProgramData(address, data, size);
+    } while (ARM_DRIVER_ERROR_BUSY == result);
+
+    return Log_Wait(log, result);
+}
+
+static int32_t Log_Erase(NVM_Log_t *log, uint8_t sector)
+{
+    int32_t result;
+
+    do
+    {
+        result = log->config->driver->EraseSector(Log_SectorBase(log, sector));
+    } while (ARM_DRIVER_ERROR_BUSY == result);
+
+    log->sequence[sector] = LOG_ERASED_SEQUENCE;
+
+    return Log_Wait(log, result);
+}
+
+static int32_t Log_IsBlank(NVM_Log_t *log, uint8_t sector, uint8_t *blank)
+{
+    int32_t result;
+    uint32_t base;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t i;
+
+    result = ARM_DRIVER_OK;
+    base   = Log_SectorBase(log, sector);
+    *blank = 1U;
+
+    for (offset = 0U; (ARM_DRIVER_OK == result) && (0U != *blank) && (offset < log->sectorSize); offset += size)
+    {
+        size   = ((log->sectorSize - offset) < sizeof(log->buffer)) ? (log->sectorSize - offset) : sizeof(log->buffer);
+        result = Log_Read(log, base + offset, log->buffer, size);
+
+        for (i = 0U; (ARM_DRIVER_OK == result) && (i < (size / 4U)); i++)
+        {
+            *blank = (LOG_ERASED_SEQUENCE == log->buffer[i]) ? *blank : 0U;
+        }
+    }
+
+    return result;
+}
+
+static int32_t Log_Open(NVM_Log_t *log, uint8_t sector)
+{
+    int32_t result;
+    Log_SectorHeader_t header;
+
+    header.magic    = LOG_MAGIC;
+    header.sequence = log->lastSequence + 1U;
+    header.inverse  = ~header.sequence;
+    header.reserved = LOG_ERASED_SEQUENCE;
+
+    result = Log_Program(log, Log_SectorBase(log, sector), &header, sizeof(header));
+
+    /* Taken even on failure: a partly programmed sector is not erased. */
+    log->lastSequence     = header.sequence;
+    log->sequence[sector] = header.sequence;
+    log->active           = sector;
+    log->writeOffset      = sizeof(header);
+    log->erasedCount--;
+
+    return result;
+}
+
+static uint8_t Log_Oldest(const NVM_Log_t *log)
+{
+    uint8_t oldest;
+    uint8_t i;
+
+    oldest = log->active;
+
+    for (i = 0U; i < log->config->sectorCount; i++)
+    {
+        if ((LOG_ERASED_SEQUENCE != log->sequence[i]) && (log->sequence[i] < log->sequence[oldest]))
+        {
+            oldest = i;
+        }
+        else
+        {
+            /* Erased or newer */
+        }
+    }
+
+    return oldest;
+}
+
+static uint8_t Log_NextErased(const NVM_Log_t *log)
+{
+    uint8_t sector;
+    uint8_t i;
+
+    /* Following the active sector round the area, for even wear */
+    sector = log->active;
+
+    for (i = 0U; i < log->config->sectorCount; i++)
+    {
+        sector = (uint8_t)((sector + 1U) % log->config->sectorCount);
+
+        if (LOG_ERASED_SEQUENCE == log->sequence[sector])
+        {
+            break;
+        }
+        else
+        {
+            /* In use */
+        }
+    }
+
+    return sector;
+}
+
+static int32_t Log_Compact(NVM_Log_t *log, uint8_t victim)
+{
+    int32_t result;
+    NVM_LogEntry_t *entry;
+    uint32_t base;
+    uint32_t size;
+    uint16_t i;
+
+    result = ARM_DRIVER_OK;
+    base   = Log_SectorBase(log, victim);
+
+    /* Live records are the ones the index still points to. */
+    for (i = 0U; (ARM_DRIVER_OK == result) && (i < log->config->indexSize); i++)
+    {
+        entry = &log->config->index[i];
+        size  = LOG_RECORD_SIZE(entry->size);
+
+        if ((NVM_LOG_KEY_NONE == entry->key) || (entry->address < base) || ((entry->address - base) >= log->sectorSize))
+        {
+            /* Free or elsewhere */
+        }
+        else if ((log->writeOffset + size) > log->sectorSize)
+        {
+            /* Only after copies torn by resets, see Log_Mount() */
+            result = NVM_LOG_ERROR_FULL;
+        }
+        else
+        {
+            result = Log_Read(log, entry->address, log->buffer, size);
+
+            if (ARM_DRIVER_OK == result)
+            {
+                entry->address = Log_SectorBase(log, log->active) + log->writeOffset;
+                result = Log_Program(log, entry->address, log->buffer, size);
+                log->writeOffset += size;
+            }
+            else
+            {
+                /* Flash error */
+            }
+        }
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        result = Log_Erase(log, victim);
+        log->erasedCount++;
+        log->compactions++;
+    }
+    else
+    {
+        /* Victim kept */
+    }
+
+    return result;
+}
+
+static int32_t Log_Reserve(NVM_Log_t *log, uint32_t size)
+{
+    int32_t result;
+    uint8_t victim;
+    uint8_t attempts;
+
+    result   = ARM_DRIVER_OK;
+    attempts = 0U;
+
+    while ((ARM_DRIVER_OK == result) && ((log->writeOffset + size) > log->sectorSize))
+    {
+        if (attempts >= log->config->sectorCount)
+        {
+            /* Every sector compacted once without room */
+            result = NVM_LOG_ERROR_FULL;
+        }
+        else if (log->erasedCount > 1U)
+        {
+            result = Log_Open(log, Log_NextErased(log));
+        }
+        else
+        {
+            /* Only the spare left: move the oldest sector into it. */
+            victim = Log_Oldest(log);
+            result = Log_Open(log, Log_NextErased(log));
+            result = (ARM_DRIVER_OK == result) ? Log_Compact(log, victim) : result;
+        }
+
+        attempts++;
+    }
+
+    return result;
+}
+
+static int32_t Log_Append(NVM_Log_t *log, uint16_t key, const void *data, uint16_t size, uint32_t *address)
+{
+    int32_t result;
+    Log_RecordHeader_t *header;
+    uint8_t *value;
+    uint32_t total;
+    uint32_t i;
+
+    total  = LOG_RECORD_SIZE(size);
+    result = Log_Reserve(log, total);
+
+    if (ARM_DRIVER_OK == result)
+    {
+        header = (Log_RecordHeader_t *)log->buffer;
+        value  = (uint8_t *)log->buffer + LOG_HEADER_SIZE;
+
+        for (i = 0U; i < (total - LOG_HEADER_SIZE); i++)
+        {
+            value[i] = (i < size) ? ((const uint8_t *)data)[i] : 0xFFU;
+        }
+
+        header->key  = key;
+        header->size = size;
+        header->crc  = Log_Crc(header, value);
+
+        *address = Log_SectorBase(log, log->active) + log->writeOffset;
+        result   = Log_Program(log, *address, log->buffer, total);
+
+        /* Space consumed even on failure */
+        log->writeOffset += total;
+    }
+    else
+    {
+        /* Full or flash error */
+    }
+
+    return result;
+}
+
+static int32_t Log_Scan(NVM_Log_t *log, uint8_t sector)
+{
+    int32_t result;
+    Log_RecordHeader_t *header;
+    uint32_t base;
+    uint32_t offset;
+    uint32_t total;
+    uint8_t done;
+
+    result = ARM_DRIVER_OK;
+    header = (Log_RecordHeader_t *)log->buffer;
+    base   = Log_SectorBase(log, sector);
+    offset = sizeof(Log_SectorHeader_t);
+    done   = 0U;
+
+    while ((ARM_DRIVER_OK == result) && (0U == done) && ((offset + LOG_HEADER_SIZE) <= log->sectorSize))
+    {
+        result = Log_Read(log, base + offset, header, LOG_HEADER_SIZE);
+        total  = LOG_RECORD_SIZE(header->size);
+
+        if (ARM_DRIVER_OK != result)
+        {
+            /* Flash error */
+        }
+        else if ((NVM_LOG_KEY_NONE == header->key) && (0xFFFFU == header->size) && (LOG_ERASED_CRC == header->crc))
+        {
+            /* End of the log in this sector */
+            done = 1U;
+        }
+        else if ((NVM_LOG_KEY_NONE == header->key) || (header->size > NVM_LOG_VALUE_MAX) ||
+                 ((offset + total) > log->sectorSize))
+        {
+            /*
+             * Header torn by a reset. Phrases are programmed in order, so the rest of that
+             * record was never written: the appends made after the reset follow this phrase.
+             */
+            offset += LOG_PHRASE;
+        }
+        else
+        {
+            result = Log_Read(log, base + offset + LOG_HEADER_SIZE, (uint8_t *)log->buffer + LOG_HEADER_SIZE,
+                              total - LOG_HEADER_SIZE);
+            log->scanned++;
+
+            if ((ARM_DRIVER_OK != result) || (header->crc != Log_Crc(header, (uint8_t *)log->buffer + LOG_HEADER_SIZE)))
+            {
+                /* Flash error, or value torn by a reset: skipped */
+            }
+            else if (0U == header->size)
+            {
+                Log_Remove(log, header->key);
+            }
+            else
+            {
+                result = Log_Insert(log, header->key, header->size, base + offset);
+            }
+
+            offset += total;
+        }
+    }
+
+    log->writeOffset = offset;
+
+    return result;
+}
+
+static int32_t Log_Mount(NVM_Log_t *log)
+{
+    int32_t result;
+    Log_SectorHeader_t header;
+    uint8_t order[NVM_LOG_SECTOR_MAX];
+    uint8_t blank;
+    uint8_t count;
+    uint8_t sector;
+    uint8_t i;
+    uint8_t j;
+    uint16_t k;
+
+    result = ARM_DRIVER_OK;
+
+    log->lastSequence = 0U;
+    log->writeOffset  = 0U;
+    log->active       = 0U;
+    log->erasedCount  = 0U;
+    log->keyCount     = 0U;
+    log->scanned      = 0U;
+    log->compactions  = 0U;
+
+    for (k = 0U; k < log->config->indexSize; k++)
+    {
+        log->config->index[k].key = NVM_LOG_KEY_NONE;
+    }
+
+    /* Sector headers, insertion sorted by sequence into order[] */
+    count = 0U;
+
+    for (sector = 0U; (ARM_DRIVER_OK == result) && (sector < log->config->sectorCount); sector++)
+    {
+        result = Log_Read(log, Log_SectorBase(log, sector), &header, sizeof(header));
+        log->sequence[sector] = LOG_ERASED_SEQUENCE;
+
+        if (ARM_DRIVER_OK != result)
+        {
+            /* Flash error */
+        }
+        else if ((LOG_MAGIC == header.magic) && (LOG_ERASED_SEQUENCE != header.sequence) &&
+                 (header.inverse == ~header.sequence))
+        {
+            log->sequence[sector] = header.sequence;
+            log->lastSequence     = (header.sequence > log->lastSequence) ? header.sequence : log->lastSequence;
+
+            for (i = count; (i > 0U) && (log->sequence[order[i - 1U]] > header.sequence); i--)
+            {
+                order[i] = order[i - 1U];
+            }
+
+            order[i] = sector;
+            count++;
+        }
+        else if ((LOG_ERASED_SEQUENCE == header.magic) && (LOG_ERASED_SEQUENCE == header.sequence) &&
+                 (LOG_ERASED_SEQUENCE == header.inverse) && (LOG_ERASED_SEQUENCE == header.reserved))
+        {
+            /* Spare only if the whole sector is: an erase cut short can leave the header blank first. */
+            log->erasedCount++;
+            result = Log_IsBlank(log, sector, &blank);
+
+            if ((ARM_DRIVER_OK == result) && (0U == blank))
+            {
+                result = Log_Erase(log, sector);
+            }
+            else
+            {
+                /* Blank, or flash error */
+            }
+        }
+        else
+        {
+            /* Erase or header program interrupted by a reset */
+            log->erasedCount++;
+            result = Log_Erase(log, sector);
+        }
+    }
+
+    /* Replay oldest first, the newest sector is the active one. */
+    for (j = 0U; (ARM_DRIVER_OK == result) && (j < count); j++)
+    {
+        log->active = order[j];
+        result = Log_Scan(log, order[j]);
+    }
+
+    if (ARM_DRIVER_OK != result)
+    {
+        /* Flash error or index full */
+    }
+    else if (0U == count)
+    {
+        result = Log_Open(log, 0U);
+    }
+    else if (0U == log->erasedCount)
+    {
+        /* Reset during a compaction: the active sector holds part of the oldest one. */
+        result = Log_Compact(log, order[0]);
+
+        if (NVM_LOG_ERROR_FULL == result)
+        {
+            /*
+             * Copies torn by resets took the room of the rest. The oldest sector is only
+             * erased after its last copy, so it is whole: drop the partial copy.
+             */
+            result = Log_Erase(log, log->active);
+            result = (ARM_DRIVER_OK == result) ? LOG_REMOUNT : result;
+        }
+        else
+        {
+            /* Compaction completed */
+        }
+    }
+    else
+    {
+        /* Mounted */
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+ * Index
+ ******************************************************************************/
+
+static uint16_t Log_Hash(const NVM_Log_t *log, uint16_t key)
+{
+    /* Fibonacci hashing, the middle bits mix every key bit */
+    return (uint16_t)((((uint32_t)key * 2654435761UL) >> 16) & (log->config->indexSize - 1U));
+}
+
+static uint16_t Log_Find(const NVM_Log_t *log, uint16_t key)
+{
+    const NVM_LogEntry_t *index;
+    uint16_t i;
+
+    index = log->config->index;
+    i     = Log_Hash(log, key);
+
+    /* Ends on the key or on the free entry where it would go */
+    while ((NVM_LOG_KEY_NONE != index[i].key) && (key != index[i].key))
+    {
+        i = (uint16_t)((i + 1U) & (log->config->indexSize - 1U));
+    }
+
+    return i;
+}
+
+static int32_t Log_Insert(NVM_Log_t *log, uint16_t key, uint16_t size, uint32_t address)
+{
+    int32_t result;
+    NVM_LogEntry_t *entry;
+
+    result = ARM_DRIVER_OK;
+    entry  = &log->config->index[Log_Find(log, key)];
+
+    if (NVM_LOG_KEY_NONE != entry->key)
+    {
+        /* Newer value */
+    }
+    else if ((log->keyCount + 1U) >= log->config->indexSize)
+    {
+        result = NVM_LOG_ERROR_FULL;
+    }
+    else
+    {
+        entry->key = key;
+        log->keyCount++;
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        entry->size    = size;
+        entry->address = address;
+    }
+    else
+    {
+        /* Index full */
+    }
+
+    return result;
+}
+
+static void Log_Remove(NVM_Log_t *log, uint16_t key)
+{
+    NVM_LogEntry_t *index;
+    uint16_t mask;
+    uint16_t hole;
+    uint16_t i;
+    uint16_t home;
+
+    index = log->config->index;
+    mask  = (uint16_t)(log->config->indexSize - 1U);
+    hole  = Log_Find(log, key);
+
+    if (NVM_LOG_KEY_NONE != index[hole].key)
+    {
+        /* Backward shift: move up every entry of the cluster that may fill the hole. */
+        for (i = (uint16_t)((hole + 1U) & mask); NVM_LOG_KEY_NONE != index[i].key; i = (uint16_t)((i + 1U) & mask))
+        {
+            home = Log_Hash(log, index[i].key);
+
+            if (((uint16_t)((i - home) & mask)) >= ((uint16_t)((i - hole) & mask)))
+            {
+                index[hole] = index[i];
+                hole = i;
+            }
+            else
+            {
+                /* Home between the hole and i: stays */
+            }
+        }
+
+        index[hole].key = NVM_LOG_KEY_NONE;
+        log->keyCount--;
+    }
+    else
+    {
+        /* Not stored */
+    }
+}
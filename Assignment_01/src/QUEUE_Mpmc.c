@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * @file    QUEUE_Mpmc.c
+ * @brief   Bounded multi-producer / multi-consumer queue C file.
+ *
+ * Positions and sequences run freely and wrap at 2^32; they are compared
+ * through their signed difference, which stays valid as long as no
+ * context is preempted for 2^31 queue operations.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "QUEUE_Mpmc.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int32_t QUEUE_Mpmc_Init(QUEUE_Mpmc_t *queue, void *buffer, ATOMIC_U32 *sequence, uint32_t slotSize,
+                        uint32_t capacity)
+{
+    int32_t result;
+    uint32_t index;
+
+    if ((NULL == queue) || (NULL == buffer) || (NULL == sequence) || (0U == slotSize) ||
+        (capacity < 2U) || (0U != (capacity & (capacity - 1U))))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        queue->buffer   = (uint8_t *)buffer;
+        queue->sequence = sequence;
+        queue->slotSize = slotSize;
+        queue->mask     = capacity - 1U;
+
+        /* Lap 0: slot i free for position i */
+        for (index = 0U; index < capacity; index++)
+        {
+            ATOMIC_Init32(&sequence[index], index);
+        }
+
+        ATOMIC_Init32(&queue->enqueuePos, 0U);
+        ATOMIC_Init32(&queue->dequeuePos, 0U);
+
+        result = ARM_DRIVER_OK;
+    }
+
+    return result;
+}
+
+uint8_t QUEUE_Mpmc_Push(QUEUE_Mpmc_t *queue, const void *data)
+{
+    uint32_t position;
+    uint32_t slot;
+    int32_t  diff;
+    uint8_t  state;     /* 0 retry, 1 claimed, 2 full */
+
+    state    = 0U;
+    position = ATOMIC_Load32(&queue->enqueuePos);
+
+    do
+    {
+        slot = position & queue->mask;
+        diff = (int32_t)(ATOMIC_Load32(&queue->sequence[slot]) - position);
+
+        if (0 == diff)
+        {
+            /* Slot free for this position: claim it, or learn the newer position */
+            state = ATOMIC_Cas32(&queue->enqueuePos, &position, position + 1U);
+        }
+        else if (diff < 0)
+        {
+            /* Slot still holds the previous lap: full */
+            state = 2U;
+        }
+        else
+        {
+            /* Another producer got here first */
+            position = ATOMIC_Load32(&queue->enqueuePos);
+        }
+    } while (0U == state);
+
+    if (1U == state)
+    {
+        (void)memcpy(&queue->buffer[slot * queue->slotSize], data, queue->slotSize);
+
+        /* Data in place before the slot is handed to the consumers */
+        ATOMIC_Dmb();
+        ATOMIC_Store32(&queue->sequence[slot], position + 1U);
+    }
+    else
+    {
+        /* Full, nothing claimed */
+    }
+
+    return (1U == state) ? 1U : 0U;
+}
+
+uint8_t QUEUE_Mpmc_Pop(QUEUE_Mpmc_t *queue, void *data)
+{
+    uint32_t position;
+    uint32_t slot;
+    int32_t  diff;
+    uint8_t  state;     /* 0 retry, 1 claimed, 2 empty */
+
+    state    = 0U;
+    position = ATOMIC_Load32(&queue->dequeuePos);
+
+    do
+    {
+        slot = position & queue->mask;
+        diff = (int32_t)(ATOMIC_Load32(&queue->sequence[slot]) - (position + 1U));
+
+        if (0 == diff)
+        {
+            state = ATOMIC_Cas32(&queue->dequeuePos, &position, position + 1U);
+        }
+        else if (diff < 0)
+        {
+            /* Slot not published yet for this lap: empty */
+            state = 2U;
+        }
+        else
+        {
+            /* Another consumer got here first */
+            position = ATOMIC_Load32(&queue->dequeuePos);
+        }
+    } while (0U == state);
+
+    if (1U == state)
+    {
+        /* Sequence read before the data it publishes */
+        ATOMIC_Dmb();
+        (void)memcpy(data, &queue->buffer[slot * queue->slotSize], queue->slotSize);
+
+        /* Data copied out before the slot is free for the next lap */
+        ATOMIC_Dmb();
+        ATOMIC_Store32(&queue->sequence[slot], position + queue->mask + 1U);
+    }
+    else
+    {
+        /* Empty, nothing claimed */
+    }
+
+    return (1U == state) ? 1U : 0U;
+}
+
+uint32_t QUEUE_Mpmc_Count(QUEUE_Mpmc_t *queue)
+{
+    uint32_t dequeued;
+    uint32_t enqueued;
+
+    dequeued = ATOMIC_Load32(&queue->dequeuePos);
+    enqueued = ATOMIC_Load32(&queue->enqueuePos);
+
+    /* Read in this order the difference can not go negative */
+    return enqueued - dequeued;
+}
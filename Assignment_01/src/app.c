@@ -15,6 +15,30 @@
 /** GPIO driver instance (static: no external linkage). */
 static ARM_DRIVER_GPIO *s_gpioDriver = &Driver_GPIO0;
 
+/** LED PWM outputs: pins driven low while lit. */
+static const FTM_PwmChannel_t s_ledChannels[] =
+{
+    {LED_RED_CHANNEL,  1U, 0U, 3U, 15U, LED_PWM_PIN_MUX},
+    {LED_BLUE_CHANNEL, 1U, 0U, 3U, 0U,  LED_PWM_PIN_MUX}
+};
+
+static const FTM_PwmConfig_t s_ledPwmConfig =
+{
+    LED_PWM_INSTANCE,
+    FTM_PWM_ALIGN_EDGE,
+    (uint8_t)(sizeof(s_ledChannels) / sizeof(s_ledChannels[0])),
+    LED_TRIGGER_CHANNEL,
+    LED_PWM_FREQUENCY,
+    0U,
+    s_ledChannels
+};
+
+/** LED PWM instance. */
+static FTM_Pwm_t s_ledPwm;
+
+/** Breathing ramp in compare values, gamma corrected. */
+static uint16_t s_ledBreath[LED_BREATH_STEPS];
+
 /** FSM state. */
 static LedState_t s_ledState = LED_STATE_IDLE;
 
@@ -34,6 +58,13 @@ static ButtonDebounce_t s_btn1 = {1U, 1U, 0U};
  */
 static void Debounce_Update(ButtonDebounce_t *btn, uint8_t rawInput);
 
+/**
+ * @brief Drive the LEDs for a new FSM state.
+ *
+ * @param[in] state   New state.
+ */
+static void LED_Apply(LedState_t state);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -71,6 +102,7 @@ void LED_FSM_Update(void)
 {
     uint8_t rawBtn0;
     uint8_t rawBtn1;
+    LedState_t newState;
 
     /* Read inputs. */
     rawBtn0 = s_gpioDriver->GetInput(BUTTON_0); /* 0 = pressed. */
@@ -83,47 +115,122 @@ void LED_FSM_Update(void)
     /* Detect falling edge (released -> pressed). */
     if ((s_btn0.prevStable == 1U) && (s_btn0.stableState == 0U))
     {
-        s_ledState = LED_STATE_BLUE_BLINK;
+        newState = LED_STATE_BLUE_BLINK;
     }
     else if ((s_btn1.prevStable == 1U) && (s_btn1.stableState == 0U))
     {
-        s_ledState = LED_STATE_RED_BLINK;
+        newState = LED_STATE_RED_BLINK;
     }
     else
     {
         /* No state change. */
+        newState = s_ledState;
     }
 
-    /* Execute action based on FSM state. */
-    switch (s_ledState)
+    /* The PWM keeps the LEDs going, only a change touches them. */
+    if (newState != s_ledState)
     {
-        case LED_STATE_IDLE:
-        {
-            s_gpioDriver->SetOutput(LED_RED, 1U);
-            s_gpioDriver->SetOutput(LED_BLUE, 1U);
-            break;
-        }
+        s_ledState = newState;
+        LED_Apply(s_ledState);
+    }
+    else
+    {
+        /* Nothing to do. */
+    }
+
+    delay(DEBOUNCE_PERIOD_MS);
+}
 
+int32_t LED_Init(void)
+{
+    int32_t result;
+
+    result = FTM_Pwm_Init(&s_ledPwm, &s_ledPwmConfig);
+
+    /* Fade in then out over the two halves of the table. */
+    if (ARM_DRIVER_OK == result)
+    {
+        result = FTM_Pwm_FillRamp(&s_ledPwm, &s_ledBreath[0], LED_BREATH_STEPS / 2U, 1U,
+                                  0U, FTM_PWM_DUTY_FULL, 1U);
+    }
+    else
+    {
+        /* PWM not available, keep the error. */
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        result = FTM_Pwm_FillRamp(&s_ledPwm, &s_ledBreath[LED_BREATH_STEPS / 2U], LED_BREATH_STEPS / 2U, 1U,
+                                  FTM_PWM_DUTY_FULL, 0U, 1U);
+    }
+    else
+    {
+        /* Keep the first error. */
+    }
+
+    if (ARM_DRIVER_OK == result)
+    {
+        s_ledState = LED_STATE_IDLE;
+        LED_Apply(s_ledState);
+
+        result = FTM_Pwm_Start(&s_ledPwm);
+    }
+    else
+    {
+        /* Keep the first error. */
+    }
+
+    return result;
+}
+
+static void LED_Apply(LedState_t state)
+{
+    uint8_t channel;
+
+    (void)FTM_Pwm_StopRamp(&s_ledPwm);
+
+    /* Both LEDs off at the same reload point. */
+    FTM_Pwm_BeginUpdate(&s_ledPwm);
+    (void)FTM_Pwm_SetDuty(&s_ledPwm, LED_RED_CHANNEL, 0U);
+    (void)FTM_Pwm_SetDuty(&s_ledPwm, LED_BLUE_CHANNEL, 0U);
+    FTM_Pwm_EndUpdate(&s_ledPwm);
+
+    switch (state)
+    {
         case LED_STATE_RED_BLINK:
         {
-            blink_LED(LED_RED, 10000U);
-            s_gpioDriver->SetOutput(LED_BLUE, 1U);
+            channel = LED_RED_CHANNEL;
             break;
         }
 
         case LED_STATE_BLUE_BLINK:
         {
-            blink_LED(LED_BLUE, 10000U);
-            s_gpioDriver->SetOutput(LED_RED, 1U);
+            channel = LED_BLUE_CHANNEL;
             break;
         }
 
         default:
         {
-            s_ledState = LED_STATE_IDLE;
+            /* LED_STATE_IDLE: both off. */
+            channel = HAL_FTM_CHANNEL_COUNT;
             break;
         }
     }
+
+    if (channel >= HAL_FTM_CHANNEL_COUNT)
+    {
+        /* Nothing lit. */
+    }
+    else if (ARM_DRIVER_OK != FTM_Pwm_StartRamp(&s_ledPwm, channel, 1U, s_ledBreath, LED_BREATH_STEPS,
+                                                1U, NULL, NULL))
+    {
+        /* No ramp DMA: show the state with the LED steadily on. */
+        (void)FTM_Pwm_SetDuty(&s_ledPwm, channel, FTM_PWM_DUTY_FULL);
+    }
+    else
+    {
+        /* Breathing. */
+    }
 }
 
 void delay(const uint32_t delayMs)
@@ -139,12 +246,3 @@ void delay(const uint32_t delayMs)
         }
     }
 }
-
-void blink_LED(uint32_t pin, uint32_t time)
-{
-    /* Toggle the pin with delay. */
-    s_gpioDriver->SetOutput(pin, 1U);
-    delay(time);
-    s_gpioDriver->SetOutput(pin, 0U);
-    delay(time);
-}
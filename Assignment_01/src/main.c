@@ -1,45 +1,89 @@
-/*******************************************************************************
- * @file    main.c
- * @brief   Application entry point.
- * @date    Sep 25, 2025
- * @author  Chu Nhat Minh Quan
- ******************************************************************************/
-
-#include "S32K144.h"
-#include "Driver_GPIO.h"
-#include "app.h"
-
-/*******************************************************************************
- * Code
- ******************************************************************************/
-
-int main(void)
-{
-    /* Configure BUTTON_0 as input with pull-up. */
-    s_gpioDriver->Setup(BUTTON_0, NULL);
-    s_gpioDriver->SetDirection(BUTTON_0, ARM_GPIO_INPUT);
-    s_gpioDriver->SetPullResistor(BUTTON_0, ARM_GPIO_PULL_UP);
-
-    /* Configure BUTTON_1 as input with pull-up. */
-    s_gpioDriver->Setup(BUTTON_1, NULL);
-    s_gpioDriver->SetDirection(BUTTON_1, ARM_GPIO_INPUT);
-    s_gpioDriver->SetPullResistor(BUTTON_1, ARM_GPIO_PULL_UP);
-
-    /* Configure LED_RED as output and turn it off (logic high). */
-    s_gpioDriver->Setup(LED_RED, NULL);
-    s_gpioDriver->SetDirection(LED_RED, ARM_GPIO_OUTPUT);
-    s_gpioDriver->SetOutput(LED_RED, 1U);
-
-    /* Configure LED_BLUE as output and turn it off (logic high). */
-    s_gpioDriver->Setup(LED_BLUE, NULL);
-    s_gpioDriver->SetDirection(LED_BLUE, ARM_GPIO_OUTPUT);
-    s_gpioDriver->SetOutput(LED_BLUE, 1U);
-
-    while (1)
-    {
-        /* Update LED FSM periodically. */
-        LED_FSM_Update();
-    }
-
-    return 0;
-}
+/*******************************************************************************
+ * @file    main.c
+ * @brief   Application entry point.
+ * @date    Sep 25, 2025
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#include "S32K144.h"
+#include "Driver_GPIO.h"
+#include "app.h"
+#include "Image_Verify.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/**
+ * @brief Stop on a corrupt or invalid flash image.
+ *
+ * Nothing of the image can be trusted any more: interrupts are masked and
+ * the CPU waits for the watchdog or the debugger. The failed range is in
+ * Image_Verify_GetStats().
+ */
+static void Image_CheckStatus(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Image_CheckStatus(void)
+{
+    uint8_t status;
+
+    status = Image_Verify_GetStatus();
+
+    if ((IMAGE_VERIFY_STATUS_CORRUPT == status) || (IMAGE_VERIFY_STATUS_INVALID == status))
+    {
+        DISABLE_INTERRUPTS();
+
+        while (1)
+        {
+            /* Halted */
+        }
+    }
+    else
+    {
+        /* OK, pending, or unsealed in a build that allows it */
+    }
+}
+
+int main(void)
+{
+    int32_t ledResult;
+
+    /* Hot ranges were checked by the startup code. */
+    Image_CheckStatus();
+
+    /* Configure BUTTON_0 as input with pull-up. */
+    s_gpioDriver->Setup(BUTTON_0, NULL);
+    s_gpioDriver->SetDirection(BUTTON_0, ARM_GPIO_INPUT);
+    s_gpioDriver->SetPullResistor(BUTTON_0, ARM_GPIO_PULL_UP);
+
+    /* Configure BUTTON_1 as input with pull-up. */
+    s_gpioDriver->Setup(BUTTON_1, NULL);
+    s_gpioDriver->SetDirection(BUTTON_1, ARM_GPIO_INPUT);
+    s_gpioDriver->SetPullResistor(BUTTON_1, ARM_GPIO_PULL_UP);
+
+    /* LEDs on PWM, both off. */
+    ledResult = LED_Init();
+
+    while (1)
+    {
+        /* Update LED FSM periodically. */
+        if (ARM_DRIVER_OK == ledResult)
+        {
+            LED_FSM_Update();
+        }
+        else
+        {
+            /* No LED PWM: nothing for the buttons to drive. */
+        }
+
+        /* Check the deferred image ranges step by step. */
+        (void)Image_Verify_Idle();
+        Image_CheckStatus();
+    }
+
+    return 0;
+}
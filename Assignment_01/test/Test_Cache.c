@@ -0,0 +1,346 @@
+/*******************************************************************************
+ * @file    Test_Cache.c
+ * @brief   Write-back RAM cache on a D-Flash model C file.
+ *
+ * The flash stand-in refuses a second program of a phrase between erases,
+ * as the FTFC does, and returns the count of bytes taken from ProgramData.
+ * The report replays a parameter-update trace (a hot set of parameters
+ * updated often, the rest now and then, some writes unchanged) with the
+ * cache synced after every write, from the idle loop, on a watermark and
+ * with fewer pages than sectors, and gives the write amplification and
+ * the modelled programming time of each.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "NVM_Cache.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FLASH_BASE              (HAL_FTFC_DFLASH_BASE)
+#define FLASH_SECTOR            (HAL_FTFC_DFLASH_SECTOR)
+#define FLASH_SECTORS           (4U)
+#define FLASH_SIZE              (FLASH_SECTOR * FLASH_SECTORS)
+#define FLASH_PHRASES           (FLASH_SIZE / NVM_CACHE_PHRASE)
+
+#define PARAM_SIZE              (16U)
+#define PARAM_COUNT             (FLASH_SIZE / PARAM_SIZE)
+#define PARAM_HOT               (32U)
+
+#define TRACE_UPDATES           (4000U)
+
+/* How the trace is written back */
+#define POLICY_EVERY_WRITE      (0U)
+#define POLICY_IDLE             (1U)
+#define POLICY_WATERMARK        (2U)
+
+typedef struct
+{
+    const char  *name;
+    uint8_t     pageCount;
+    uint16_t    watermark;
+    uint8_t     policy;
+    uint32_t    idleEvery;          /**< Updates between idle calls */
+} Cache_Scenario_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint8_t s_flash[FLASH_SIZE];
+static uint32_t s_programmed[FLASH_PHRASES / 32U];  /**< Phrases programmed since their erase */
+static uint32_t s_phrases;
+static uint32_t s_erases;
+static uint32_t s_reprograms;                       /**< Refused second programs */
+static uint32_t s_seed;
+
+static uint8_t s_model[FLASH_SIZE];
+static uint8_t s_pages[NVM_CACHE_PAGE_MAX * FLASH_SECTOR];
+
+static const Cache_Scenario_t s_scenarios[] =
+{
+    { "sync every write   ", 1U,  0U, POLICY_EVERY_WRITE,    1U },
+    { "idle every 50      ", 4U,  0U, POLICY_IDLE,          50U },
+    { "idle every 500     ", 4U,  0U, POLICY_IDLE,         500U },
+    { "watermark 128      ", 4U, 128U, POLICY_WATERMARK,      0U },
+    { "2 pages, idle 500  ", 2U,  0U, POLICY_IDLE,         500U },
+};
+
+/*******************************************************************************
+ * Flash stand-in
+ ******************************************************************************/
+
+static int32_t Flash_ReadData(uint32_t addr, void *data, uint32_t cnt)
+{
+    (void)memcpy(data, &s_flash[addr - FLASH_BASE], cnt);
+
+    return (int32_t)cnt;
+}
+
+static int32_t Flash_ProgramData(uint32_t addr, const void *data, uint32_t cnt)
+{
+    int32_t result;
+    uint32_t first;
+    uint32_t p;
+
+    result = (int32_t)cnt;
+    first  = (addr - FLASH_BASE) / NVM_CACHE_PHRASE;
+
+    if ((0U != (addr % NVM_CACHE_PHRASE)) || (0U != (cnt % NVM_CACHE_PHRASE)) || (0U == cnt))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        for (p = first; p < (first + (cnt / NVM_CACHE_PHRASE)); p++)
+        {
+            if (0U != (s_programmed[p / 32U] & (1UL << (p % 32U))))
+            {
+                s_reprograms++;
+                result = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                s_programmed[p / 32U] |= 1UL << (p % 32U);
+            }
+        }
+
+        (void)memcpy(&s_flash[addr - FLASH_BASE], data, cnt);
+        s_phrases += cnt / NVM_CACHE_PHRASE;
+    }
+
+    return result;
+}
+
+static int32_t Flash_EraseSector(uint32_t addr)
+{
+    uint32_t p;
+
+    (void)memset(&s_flash[addr - FLASH_BASE], 0xFF, FLASH_SECTOR);
+
+    for (p = (addr - FLASH_BASE) / NVM_CACHE_PHRASE; p < (((addr - FLASH_BASE) + FLASH_SECTOR) / NVM_CACHE_PHRASE); p++)
+    {
+        s_programmed[p / 32U] &= ~(1UL << (p % 32U));
+    }
+
+    s_erases++;
+
+    return ARM_DRIVER_OK;
+}
+
+static ARM_FLASH_STATUS Flash_GetStatus(void)
+{
+    ARM_FLASH_STATUS status;
+
+    (void)memset(&status, 0, sizeof(status));
+
+    return status;
+}
+
+static ARM_FLASH_INFO s_flashInfo =
+{
+    NULL, FLASH_SECTORS, FLASH_SECTOR, NVM_CACHE_PHRASE, NVM_CACHE_PHRASE, 0xFFU, { 0U, 0U, 0U }
+};
+
+static ARM_FLASH_INFO *Flash_GetInfo(void)
+{
+    return &s_flashInfo;
+}
+
+static ARM_DRIVER_FLASH s_driver =
+{
+    .ReadData    = Flash_ReadData,
+    .ProgramData = Flash_ProgramData,
+    .EraseSector = Flash_EraseSector,
+    .GetStatus   = Flash_GetStatus,
+    .GetInfo     = Flash_GetInfo,
+};
+
+/* Every parameter programmed once, as left by the production image. */
+static void Flash_Format(void)
+{
+    uint32_t i;
+
+    (void)memset(s_programmed, 0xFF, sizeof(s_programmed));
+
+    for (i = 0U; i < FLASH_SIZE; i++)
+    {
+        s_flash[i] = (uint8_t)(i / PARAM_SIZE);
+    }
+
+    (void)memcpy(s_model, s_flash, sizeof(s_model));
+
+    s_phrases    = 0U;
+    s_erases     = 0U;
+    s_reprograms = 0U;
+}
+
+static uint32_t Random(void)
+{
+    s_seed = (s_seed * 1103515245UL) + 12345UL;
+
+    return s_seed >> 16;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Test_Cache(void)
+{
+    static const uint8_t update[4] = { 0xA1U, 0xA2U, 0xA3U, 0xA4U };
+    NVM_CacheConfig_t config;
+    NVM_Cache_t cache;
+    uint8_t readBack[PARAM_SIZE];
+
+    config.driver    = &s_driver;
+    config.base      = FLASH_BASE;
+    config.size      = FLASH_SIZE;
+    config.buffer    = s_pages;
+    config.pageCount = 2U;
+    config.watermark = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Cache_Init(&cache, &config));
+
+    /* Erased flash: dirty phrases programmed in place, no erase */
+    (void)memset(s_flash, 0xFF, sizeof(s_flash));
+    (void)memset(s_programmed, 0, sizeof(s_programmed));
+    s_phrases = 0U;
+    s_erases  = 0U;
+
+    TEST_CHECK(4 == NVM_Cache_Write(&cache, FLASH_BASE + 3U, update, 4U));
+    TEST_CHECK(4 == NVM_Cache_Write(&cache, FLASH_BASE + 13U, update, 4U));
+    TEST_CHECK(4 == NVM_Cache_Read(&cache, FLASH_BASE + 13U, readBack, 4U));
+    TEST_CHECK(0 == memcmp(update, readBack, 4U));
+    TEST_CHECK(0xFFU == s_flash[3]);
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Cache_Sync(&cache));
+    TEST_CHECK((0U == s_erases) && (3U == s_phrases) && (1U == cache.writeBacks));
+    TEST_CHECK((0xA1U == s_flash[3]) && (0xA4U == s_flash[16]));
+    TEST_CHECK(0 == NVM_Cache_Idle(&cache));
+
+    /* The same bytes again: nothing dirty */
+    TEST_CHECK(4 == NVM_Cache_Write(&cache, FLASH_BASE + 3U, update, 4U));
+    TEST_CHECK(0U == cache.dirtyCount);
+
+    /* A programmed phrase changes: the sector is erased and programmed back */
+    TEST_CHECK(1 == NVM_Cache_Write(&cache, FLASH_BASE + 4U, &update[3], 1U));
+    TEST_CHECK(1 == NVM_Cache_Idle(&cache));
+    TEST_CHECK((1U == s_erases) && (6U == s_phrases) && (0xA4U == s_flash[4]) && (0xA4U == s_flash[16]));
+
+    /* Writes across a sector boundary, with eviction from two pages */
+    TEST_CHECK(4 == NVM_Cache_Write(&cache, FLASH_BASE + FLASH_SECTOR - 2U, update, 4U));
+    TEST_CHECK(4 == NVM_Cache_Write(&cache, FLASH_BASE + (3U * FLASH_SECTOR), update, 4U));
+    TEST_CHECK(4 == NVM_Cache_Read(&cache, FLASH_BASE + FLASH_SECTOR - 2U, readBack, 4U));
+    TEST_CHECK(0 == memcmp(update, readBack, 4U));
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Cache_Sync(&cache));
+    TEST_CHECK((0xA1U == s_flash[FLASH_SECTOR - 2U]) && (0xA4U == s_flash[FLASH_SECTOR + 1U]) &&
+               (0xA1U == s_flash[3U * FLASH_SECTOR]));
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Cache_Write(&cache, FLASH_BASE + FLASH_SIZE - 2U, update, 4U));
+    TEST_CHECK(0U == s_reprograms);
+}
+
+static void Test_Trace(const Cache_Scenario_t *scenario)
+{
+    NVM_CacheConfig_t config;
+    NVM_Cache_t cache;
+    uint8_t value[PARAM_SIZE];
+    uint8_t readBack[PARAM_SIZE];
+    uint64_t programUs;
+    uint32_t parameter;
+    uint32_t size;
+    uint32_t errors;
+    uint32_t update;
+    uint32_t i;
+
+    config.driver    = &s_driver;
+    config.base      = FLASH_BASE;
+    config.size      = FLASH_SIZE;
+    config.buffer    = s_pages;
+    config.pageCount = scenario->pageCount;
+    config.watermark = scenario->watermark;
+
+    Flash_Format();
+    s_seed = 2026U;
+    errors = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Cache_Init(&cache, &config));
+
+    for (update = 0U; update < TRACE_UPDATES; update++)
+    {
+        /* 80 % of the updates go to the hot set, spread over the region */
+        parameter = ((Random() % 10U) < 8U) ? ((Random() % PARAM_HOT) * (PARAM_COUNT / PARAM_HOT)) :
+                                              (Random() % PARAM_COUNT);
+        size      = 4U << (Random() % 3U);
+        (void)memcpy(value, &s_model[parameter * PARAM_SIZE], size);
+
+        /* One in eight writes stores the value the parameter already has */
+        if (0U != (Random() % 8U))
+        {
+            for (i = 0U; i < size; i++)
+            {
+                value[i] = (uint8_t)(value[i] + 1U + (Random() % 3U));
+            }
+        }
+        else
+        {
+            /* Unchanged */
+        }
+
+        (void)memcpy(&s_model[parameter * PARAM_SIZE], value, size);
+
+        errors += ((int32_t)size == NVM_Cache_Write(&cache, FLASH_BASE + (parameter * PARAM_SIZE), value, size)) ? 0U : 1U;
+        errors += ((int32_t)PARAM_SIZE == NVM_Cache_Read(&cache, FLASH_BASE + (parameter * PARAM_SIZE), readBack,
+                                                         PARAM_SIZE)) ? 0U : 1U;
+        errors += (0 == memcmp(&s_model[parameter * PARAM_SIZE], readBack, PARAM_SIZE)) ? 0U : 1U;
+
+        if ((POLICY_EVERY_WRITE == scenario->policy) || ((POLICY_IDLE == scenario->policy) &&
+                                                          (0U == ((update + 1U) % scenario->idleEvery))))
+        {
+            errors += (NVM_Cache_Sync(&cache) >= 0) ? 0U : 1U;
+        }
+        else
+        {
+            /* Written back by the watermark or by eviction */
+        }
+    }
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Cache_Sync(&cache));
+    TEST_CHECK(0U == errors);
+    TEST_CHECK(0U == s_reprograms);
+    TEST_CHECK(0 == memcmp(s_model, s_flash, FLASH_SIZE));
+    TEST_CHECK((s_phrases * NVM_CACHE_PHRASE) == cache.programmed);
+    TEST_CHECK(s_erases == cache.erased);
+
+    programUs = ((uint64_t)s_erases * FAKE_FTFC_ERASE_SECTOR_US) + ((uint64_t)s_phrases * FAKE_FTFC_PROGRAM_PHRASE_US);
+
+    (void)printf("%s %5u  %6u  %8u  %7.1f  %6u  %10.1f ms  %8.1f us\n", scenario->name,
+                 (unsigned)scenario->pageCount, (unsigned)cache.written, (unsigned)cache.programmed,
+                 (double)cache.programmed / cache.written, (unsigned)s_erases, (double)programUs / 1000.0,
+                 (double)programUs / TRACE_UPDATES);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    Test_Cache();
+
+    (void)printf("%u parameter updates over %u KB of D-Flash (%u parameters, %u hot)\n", (unsigned)TRACE_UPDATES,
+                 (unsigned)(FLASH_SIZE / 1024U), (unsigned)PARAM_COUNT, (unsigned)PARAM_HOT);
+    (void)printf("write back          pages  written  programmed  ampl.  erases  programming time  per update\n");
+
+    for (i = 0U; i < (sizeof(s_scenarios) / sizeof(s_scenarios[0])); i++)
+    {
+        Test_Trace(&s_scenarios[i]);
+    }
+
+    return Test_Report("Test_Cache");
+}
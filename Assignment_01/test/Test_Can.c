@@ -0,0 +1,758 @@
+/*******************************************************************************
+ * @file    Test_Can.c
+ * @brief   Filtering, arbitration order, bus load and CAN FD of the FlexCAN
+ *          CMSIS driver C file.
+ *
+ * Driver_CAN0 runs against the bit-time model of the FlexCAN, the model's
+ * other node standing in for the rest of the bus. Checks which frames the
+ * RX FIFO filter table and the mailbox filters accept, that pending
+ * mailboxes and the other node reach the bus in arbitration order, and
+ * that a saturated 1 Mbit/s bus is received without a lost frame.
+ *
+ * CAN FD: the data phase timing and TDC offset the driver programs, 64
+ * byte frames and DLC padding in internal loopback, the bus time saved by
+ * bit rate switching, the message buffer payload size planner and the
+ * rejection of FD requests on a classic controller (FlexCAN1).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "Driver_CAN_S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CAN_BITRATE         (1000000UL)
+#define CAN_FRAME_BITS      (111U)          /**< Standard frame, 8 bytes, unstuffed */
+#define CAN_LOG_SIZE        (64U)
+#define CAN_LOAD_FRAMES     (20000U)
+
+#define OBJ_RX_EXACT        CAN_OBJ_MAILBOX(0U)     /**< 0x300            */
+#define OBJ_RX_MASKED       CAN_OBJ_MAILBOX(1U)     /**< 0x310 ... 0x317  */
+#define OBJ_TX_FIRST        CAN_OBJ_MAILBOX(2U)
+#define OBJ_TX_COUNT        (6U)
+
+#define FD_BITRATE          (500000UL)
+#define FD_DATA_BITRATE     (2000000UL)
+#define FD_BIT_CLOCKS       (96U)           /**< 48 MHz / 500 kbit/s */
+#define FD_DATA_BIT_CLOCKS  (24U)           /**< 48 MHz / 2 Mbit/s   */
+#define FD_TDC_OFFSET       (18U)           /**< Data sample point: 1 + 9 + 8 tq of 1 clock */
+
+/* 64 byte frame, standard ID: 17 arbitration + 543 data phase + 12 trailer
+ * bits; with BRS the data phase runs 4 times faster (543 / 4 rounded up). */
+#define FD_FRAME_BITS       (572U)
+#define FD_FRAME_BITS_BRS   (165U)
+
+#define FD_OBJ_RX           CAN_OBJ_MAILBOX(0U)     /**< 0x123 */
+#define FD_OBJ_TX           CAN_OBJ_MAILBOX(1U)
+#define FD_ID               ARM_CAN_STANDARD_ID(0x123UL)
+
+typedef struct
+{
+    uint32_t    obj;
+    uint32_t    id;
+    uint8_t     dlc;
+    uint8_t     data[8];
+} Can_Received_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_CAN * const s_can = &Driver_CAN0;
+
+static uint8_t s_readInCallback;
+static Can_Received_t s_rx[CAN_LOG_SIZE];
+static uint32_t s_rxCount;
+static uint32_t s_sent[CAN_LOG_SIZE];
+static uint32_t s_sentCount;
+static uint32_t s_overruns;
+
+/* Full load: next expected sequence number, sequence errors */
+static uint32_t s_loadNext;
+static uint32_t s_loadErrors;
+static uint8_t s_loadMode;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Can_Read(uint32_t obj)
+{
+    ARM_CAN_MSG_INFO info;
+    uint8_t data[8];
+    uint32_t sequence;
+    int32_t length;
+
+    while ((length = s_can->MessageRead(obj, &info, data, sizeof(data))) >= 0)
+    {
+        if (0U != s_loadMode)
+        {
+            (void)memcpy(&sequence, data, sizeof(sequence));
+            s_loadErrors += (sequence != s_loadNext) ? 1U : 0U;
+            s_loadNext    = sequence + 1U;
+        }
+        else if (s_rxCount < CAN_LOG_SIZE)
+        {
+            s_rx[s_rxCount].obj = obj;
+            s_rx[s_rxCount].id  = info.id;
+            s_rx[s_rxCount].dlc = (uint8_t)length;
+            (void)memcpy(s_rx[s_rxCount].data, data, (size_t)length);
+            s_rxCount++;
+        }
+        else
+        {
+            /* Log full */
+        }
+    }
+}
+
+static void Can_ObjectEvent(uint32_t obj_idx, uint32_t event)
+{
+    if (0U != (event & ARM_CAN_EVENT_SEND_COMPLETE))
+    {
+        if (s_sentCount < CAN_LOG_SIZE)
+        {
+            s_sent[s_sentCount] = obj_idx;
+        }
+        else
+        {
+            /* Log full */
+        }
+        s_sentCount++;
+    }
+    else
+    {
+        /* Not a TX event */
+    }
+
+    if (0U != (event & ARM_CAN_EVENT_RECEIVE_OVERRUN))
+    {
+        s_overruns++;
+    }
+    else
+    {
+        /* No overrun */
+    }
+
+    if ((0U != (event & ARM_CAN_EVENT_RECEIVE)) && (0U != s_readInCallback))
+    {
+        Can_Read(obj_idx);
+    }
+    else
+    {
+        /* Read deferred to the main loop */
+    }
+}
+
+static void Can_Idle(void)
+{
+    uint32_t guard;
+
+    /* Until the other node has sent everything and the last frame ended */
+    for (guard = 0U; (guard < 1000U) && (0U != Fake_FLEXCAN_GetRemotePending(HAL_FLEXCAN_0)); guard++)
+    {
+        Fake_FLEXCAN_Run(HAL_FLEXCAN_0, CAN_FRAME_BITS);
+    }
+    Fake_FLEXCAN_Run(HAL_FLEXCAN_0, 2U * CAN_FRAME_BITS);
+}
+
+static void Can_Send(uint32_t obj, uint32_t id, uint8_t tag)
+{
+    ARM_CAN_MSG_INFO info;
+    uint8_t data[2];
+
+    (void)memset(&info, 0, sizeof(info));
+    info.id = id;
+    data[0] = tag;
+    data[1] = (uint8_t)~tag;
+
+    TEST_CHECK(2 == s_can->MessageSend(obj, &info, data, sizeof(data)));
+}
+
+static void Can_Setup(void)
+{
+    uint32_t obj;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->Initialize(NULL, Can_ObjectEvent));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetBitrate(ARM_CAN_BITRATE_NOMINAL, CAN_BITRATE, CAN_BIT_SEGMENTS_AUTO));
+
+    /* RX FIFO: exact and masked, standard and extended */
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(CAN_OBJ_RX_FIFO, ARM_CAN_FILTER_ID_EXACT_ADD,
+                                                       ARM_CAN_STANDARD_ID(0x100UL), 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(CAN_OBJ_RX_FIFO, ARM_CAN_FILTER_ID_MASKABLE_ADD,
+                                                       ARM_CAN_STANDARD_ID(0x200UL), 0x7F0UL));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(CAN_OBJ_RX_FIFO, ARM_CAN_FILTER_ID_EXACT_ADD,
+                                                       ARM_CAN_EXTENDED_ID(0x18DAF110UL), 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(CAN_OBJ_RX_FIFO, ARM_CAN_FILTER_ID_MASKABLE_ADD,
+                                                       ARM_CAN_EXTENDED_ID(0x18FF0000UL), 0x1FFF0000UL));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(CAN_OBJ_RX_FIFO, ARM_CAN_OBJ_RX));
+
+    /* Mailboxes: one exact, one masked, the rest TX */
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(OBJ_RX_EXACT, ARM_CAN_FILTER_ID_EXACT_ADD,
+                                                       ARM_CAN_STANDARD_ID(0x300UL), 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(OBJ_RX_EXACT, ARM_CAN_OBJ_RX));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(OBJ_RX_MASKED, ARM_CAN_FILTER_ID_MASKABLE_ADD,
+                                                       ARM_CAN_STANDARD_ID(0x310UL), 0x7F8UL));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(OBJ_RX_MASKED, ARM_CAN_OBJ_RX));
+
+    for (obj = OBJ_TX_FIRST; obj < (OBJ_TX_FIRST + OBJ_TX_COUNT); obj++)
+    {
+        TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(obj, ARM_CAN_OBJ_TX));
+    }
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_LOOPBACK_EXTERNAL));
+}
+
+/* Which object, if any, takes each identifier */
+static void Test_Filtering(void)
+{
+    static const struct
+    {
+        uint32_t id;
+        uint32_t obj;   /**< 0xFF = rejected */
+    } cases[] =
+    {
+        { ARM_CAN_STANDARD_ID(0x100UL),      CAN_OBJ_RX_FIFO },
+        { ARM_CAN_STANDARD_ID(0x101UL),      0xFFU },
+        { ARM_CAN_STANDARD_ID(0x200UL),      CAN_OBJ_RX_FIFO },
+        { ARM_CAN_STANDARD_ID(0x20FUL),      CAN_OBJ_RX_FIFO },
+        { ARM_CAN_STANDARD_ID(0x210UL),      0xFFU },
+        { ARM_CAN_STANDARD_ID(0x300UL),      OBJ_RX_EXACT },
+        { ARM_CAN_STANDARD_ID(0x301UL),      0xFFU },
+        { ARM_CAN_STANDARD_ID(0x314UL),      OBJ_RX_MASKED },
+        { ARM_CAN_STANDARD_ID(0x318UL),      0xFFU },
+        { ARM_CAN_EXTENDED_ID(0x18DAF110UL), CAN_OBJ_RX_FIFO },
+        { ARM_CAN_EXTENDED_ID(0x18DAF111UL), 0xFFU },
+        { ARM_CAN_EXTENDED_ID(0x18FF1234UL), CAN_OBJ_RX_FIFO },
+        { ARM_CAN_EXTENDED_ID(0x18FE1234UL), 0xFFU },
+        { ARM_CAN_EXTENDED_ID(0x100UL),      0xFFU },     /* IDE is always compared */
+        { ARM_CAN_EXTENDED_ID(0x300UL),      0xFFU },
+    };
+    uint8_t data[8];
+    uint32_t accepted;
+    uint32_t i;
+    uint32_t j;
+
+    s_readInCallback = 1U;
+    s_rxCount        = 0U;
+
+    for (i = 0U; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        for (j = 0U; j < sizeof(data); j++)
+        {
+            data[j] = (uint8_t)((i * 8U) + j);
+        }
+        TEST_CHECK(1U == Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, cases[i].id, data, (uint8_t)(i % 9U)));
+    }
+
+    Can_Idle();
+
+    accepted = 0U;
+
+    for (i = 0U; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        if (0xFFU != cases[i].obj)
+        {
+            /* Accepted frames arrive in bus order with their payload intact */
+            TEST_CHECK(accepted < s_rxCount);
+            TEST_CHECK(cases[i].obj == s_rx[accepted].obj);
+            TEST_CHECK(cases[i].id == s_rx[accepted].id);
+            TEST_CHECK((i % 9U) == s_rx[accepted].dlc);
+            TEST_CHECK((0U == s_rx[accepted].dlc) || ((uint8_t)(i * 8U) == s_rx[accepted].data[0]));
+            accepted++;
+        }
+        else
+        {
+            /* Rejected */
+        }
+    }
+
+    TEST_CHECK(accepted == s_rxCount);
+    TEST_CHECK(0U == Fake_FLEXCAN_GetLostCount(HAL_FLEXCAN_0));
+}
+
+/* Own frames: received in self reception and internal loopback only */
+static void Test_Modes(void)
+{
+    s_readInCallback = 1U;
+    s_rxCount        = 0U;
+
+    Can_Send(OBJ_TX_FIRST, ARM_CAN_STANDARD_ID(0x205UL), 1U);
+    Can_Idle();
+    TEST_CHECK(1U == s_rxCount);
+    TEST_CHECK(ARM_CAN_STANDARD_ID(0x205UL) == s_rx[0].id);
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_NORMAL));
+    Can_Send(OBJ_TX_FIRST, ARM_CAN_STANDARD_ID(0x205UL), 2U);
+    Can_Idle();
+    TEST_CHECK(1U == s_rxCount);
+
+    /* Internal loopback: own frames come back, the bus is disconnected. */
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_LOOPBACK_INTERNAL));
+    TEST_CHECK(1U == Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, ARM_CAN_STANDARD_ID(0x100UL), NULL, 0U));
+    Can_Send(OBJ_TX_FIRST, ARM_CAN_STANDARD_ID(0x300UL), 3U);
+    Fake_FLEXCAN_Run(HAL_FLEXCAN_0, 4U * CAN_FRAME_BITS);
+    TEST_CHECK(2U == s_rxCount);
+    TEST_CHECK(OBJ_RX_EXACT == s_rx[1].obj);
+    TEST_CHECK(3U == s_rx[1].data[0]);
+    TEST_CHECK(1U == Fake_FLEXCAN_GetRemotePending(HAL_FLEXCAN_0));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_LOOPBACK_EXTERNAL));
+    Can_Idle();
+    TEST_CHECK(3U == s_rxCount);
+    TEST_CHECK(ARM_CAN_STANDARD_ID(0x100UL) == s_rx[2].id);
+}
+
+/* Pending mailboxes and the other node reach the bus in arbitration order */
+static void Test_Arbitration(void)
+{
+    static const uint32_t expected[] =
+    {
+        ARM_CAN_STANDARD_ID(0x050UL),       /* On the bus before the mailboxes were loaded */
+        ARM_CAN_EXTENDED_ID(0x00000010UL),  /* Base ID 0 */
+        ARM_CAN_STANDARD_ID(0x001UL),
+        ARM_CAN_STANDARD_ID(0x003UL),       /* IDE dominant: beats extended base ID 3 */
+        ARM_CAN_STANDARD_ID(0x120UL),
+        ARM_CAN_STANDARD_ID(0x200UL),       /* Other node */
+        ARM_CAN_EXTENDED_ID(0x000C0000UL),  /* Other node, base ID 3 */
+        ARM_CAN_STANDARD_ID(0x400UL),
+        ARM_CAN_STANDARD_ID(0x7FFUL),
+    };
+    static const uint32_t sentOrder[] =
+    {
+        OBJ_TX_FIRST + 3U, OBJ_TX_FIRST + 4U, OBJ_TX_FIRST + 5U, OBJ_TX_FIRST + 1U, OBJ_TX_FIRST + 0U,
+        OBJ_TX_FIRST + 2U
+    };
+    ARM_CAN_MSG_INFO info;
+    uint32_t first;
+    uint32_t i;
+
+    s_readInCallback = 1U;
+    s_sentCount      = 0U;
+    first            = Fake_FLEXCAN_GetLogCount(HAL_FLEXCAN_0);
+
+    TEST_CHECK(1U == Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, ARM_CAN_STANDARD_ID(0x050UL), NULL, 8U));
+    Fake_FLEXCAN_Run(HAL_FLEXCAN_0, 1U);
+
+    /* Loaded in reverse priority order while the bus is busy */
+    Can_Send(OBJ_TX_FIRST + 0U, ARM_CAN_STANDARD_ID(0x400UL), 0U);
+    Can_Send(OBJ_TX_FIRST + 1U, ARM_CAN_STANDARD_ID(0x120UL), 1U);
+    Can_Send(OBJ_TX_FIRST + 2U, ARM_CAN_STANDARD_ID(0x7FFUL), 2U);
+    Can_Send(OBJ_TX_FIRST + 3U, ARM_CAN_EXTENDED_ID(0x00000010UL), 3U);
+    Can_Send(OBJ_TX_FIRST + 4U, ARM_CAN_STANDARD_ID(0x001UL), 4U);
+    Can_Send(OBJ_TX_FIRST + 5U, ARM_CAN_STANDARD_ID(0x003UL), 5U);
+    TEST_CHECK(1U == Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, ARM_CAN_STANDARD_ID(0x200UL), NULL, 8U));
+    TEST_CHECK(1U == Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, ARM_CAN_EXTENDED_ID(0x000C0000UL), NULL, 8U));
+
+    /* A mailbox on its way to the bus cannot be reloaded */
+    (void)memset(&info, 0, sizeof(info));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_can->MessageSend(OBJ_TX_FIRST, &info, NULL, 0U));
+
+    Can_Idle();
+
+    TEST_CHECK((first + (sizeof(expected) / sizeof(expected[0]))) == Fake_FLEXCAN_GetLogCount(HAL_FLEXCAN_0));
+    for (i = 0U; i < (sizeof(expected) / sizeof(expected[0])); i++)
+    {
+        TEST_CHECK(expected[i] == Fake_FLEXCAN_GetLogId(HAL_FLEXCAN_0, first + i));
+    }
+
+    TEST_CHECK((sizeof(sentOrder) / sizeof(sentOrder[0])) == s_sentCount);
+    for (i = 0U; i < (sizeof(sentOrder) / sizeof(sentOrder[0])); i++)
+    {
+        TEST_CHECK(sentOrder[i] == s_sent[i]);
+    }
+}
+
+/*
+ * Back-to-back 8-byte frames from the other node at 1 Mbit/s, spread over
+ * the FIFO and both RX mailboxes. readEvery = 0 reads in the callback,
+ * otherwise the main loop drains the FIFO every readEvery frame times.
+ */
+static uint32_t Can_FullLoad(uint32_t readEvery, uint32_t *busPercent)
+{
+    static const uint32_t ids[3] =
+    {
+        ARM_CAN_STANDARD_ID(0x100UL), ARM_CAN_STANDARD_ID(0x300UL), ARM_CAN_STANDARD_ID(0x313UL)
+    };
+    uint8_t data[8];
+    uint32_t busBefore;
+    uint32_t busyBefore;
+    uint32_t busBits;
+    uint32_t busyBits;
+    uint32_t lostBefore;
+    uint32_t injected;
+    uint32_t frame;
+
+    s_readInCallback = (0U == readEvery) ? 1U : 0U;
+    s_loadMode       = 1U;
+    s_loadNext       = 0U;
+    s_loadErrors     = 0U;
+    s_overruns       = 0U;
+    lostBefore       = Fake_FLEXCAN_GetLostCount(HAL_FLEXCAN_0);
+    injected         = 0U;
+
+    (void)memset(data, 0, sizeof(data));
+
+    /* Keep the other node's queue full: the bus never idles between frames. */
+    while (injected < 8U)
+    {
+        (void)memcpy(data, &injected, sizeof(injected));
+        (void)Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, (0U == readEvery) ? ids[injected % 3U] : ids[0], data, 8U);
+        injected++;
+    }
+
+    Fake_FLEXCAN_GetBusLoad(HAL_FLEXCAN_0, &busBefore, &busyBefore);
+
+    for (frame = 0U; frame < CAN_LOAD_FRAMES; frame++)
+    {
+        Fake_FLEXCAN_Run(HAL_FLEXCAN_0, CAN_FRAME_BITS);
+
+        if (injected < (CAN_LOAD_FRAMES + 8U))
+        {
+            (void)memcpy(data, &injected, sizeof(injected));
+            (void)Fake_FLEXCAN_Inject(HAL_FLEXCAN_0, (0U == readEvery) ? ids[injected % 3U] : ids[0], data, 8U);
+            injected++;
+        }
+        else
+        {
+            /* Enough queued */
+        }
+
+        if ((0U != readEvery) && (0U == ((frame + 1U) % readEvery)))
+        {
+            Can_Read(CAN_OBJ_RX_FIFO);
+        }
+        else
+        {
+            /* Read in the callback, or not yet */
+        }
+    }
+
+    Fake_FLEXCAN_GetBusLoad(HAL_FLEXCAN_0, &busBits, &busyBits);
+    *busPercent = (uint32_t)((100ULL * (busyBits - busyBefore)) / (busBits - busBefore));
+
+    /* The rest of the queue is read as it arrives */
+    s_readInCallback = 1U;
+    Can_Read(CAN_OBJ_RX_FIFO);
+    Can_Idle();
+
+    s_loadMode = 0U;
+
+    return Fake_FLEXCAN_GetLostCount(HAL_FLEXCAN_0) - lostBefore;
+}
+
+static void Test_FullLoad(void)
+{
+    uint32_t lost;
+    uint32_t percent;
+    uint32_t irqBefore;
+    uint32_t irqs;
+
+    (void)printf("\nreader             frames  bus load  lost  overrun events  interrupts\n");
+
+    /* Read in the callback: every frame of a saturated bus arrives. */
+    irqBefore = Fake_FLEXCAN_GetInterruptCount(HAL_FLEXCAN_0);
+    lost      = Can_FullLoad(0U, &percent);
+    irqs      = Fake_FLEXCAN_GetInterruptCount(HAL_FLEXCAN_0) - irqBefore;
+    (void)printf("callback           %6u  %6u %%  %4u  %14u  %10u\n", (unsigned)CAN_LOAD_FRAMES, (unsigned)percent,
+                 (unsigned)lost, (unsigned)s_overruns, (unsigned)irqs);
+
+    TEST_CHECK(100U == percent);
+    TEST_CHECK(0U == lost);
+    TEST_CHECK(0U == s_overruns);
+    TEST_CHECK(0U == s_loadErrors);
+    TEST_CHECK((CAN_LOAD_FRAMES + 8U) == s_loadNext);
+
+    /* Main loop reading the FIFO every 4 frame times: the 6-deep FIFO absorbs the latency. */
+    lost = Can_FullLoad(4U, &percent);
+    (void)printf("main loop, 4 frames%6u  %6u %%  %4u  %14u\n", (unsigned)CAN_LOAD_FRAMES, (unsigned)percent,
+                 (unsigned)lost, (unsigned)s_overruns);
+
+    TEST_CHECK(100U == percent);
+    TEST_CHECK(0U == lost);
+    TEST_CHECK(0U == s_loadErrors);
+    TEST_CHECK((CAN_LOAD_FRAMES + 8U) == s_loadNext);
+
+    /* Every 8 frame times is beyond the FIFO depth: the overflow is reported, not silent. */
+    lost = Can_FullLoad(8U, &percent);
+    (void)printf("main loop, 8 frames%6u  %6u %%  %4u  %14u\n\n", (unsigned)CAN_LOAD_FRAMES, (unsigned)percent,
+                 (unsigned)lost, (unsigned)s_overruns);
+
+    TEST_CHECK(0U != lost);
+    TEST_CHECK(0U != s_overruns);
+}
+
+static void Fd_Setup(void)
+{
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_INITIALIZATION));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->Control(ARM_CAN_SET_FD_MODE, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetBitrate(ARM_CAN_BITRATE_NOMINAL, FD_BITRATE, CAN_BIT_SEGMENTS_AUTO));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetBitrate(ARM_CAN_BITRATE_FD_DATA, FD_DATA_BITRATE, CAN_BIT_SEGMENTS_AUTO));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(FD_OBJ_RX, ARM_CAN_FILTER_ID_EXACT_ADD, FD_ID, 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(FD_OBJ_RX, ARM_CAN_OBJ_RX));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(FD_OBJ_TX, ARM_CAN_OBJ_TX));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_LOOPBACK_INTERNAL));
+}
+
+/* Send one frame through internal loopback, returns the bit times it took on the bus */
+static uint32_t Fd_Loop(uint8_t size, uint8_t edl, uint8_t brs, int32_t sent)
+{
+    ARM_CAN_MSG_INFO info;
+    uint8_t data[64];
+    uint32_t busBefore;
+    uint32_t busyBefore;
+    uint32_t busBits;
+    uint32_t busyBits;
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(0xA5U ^ (i * 7U));
+    }
+
+    (void)memset(&info, 0, sizeof(info));
+    info.id  = FD_ID;
+    info.edl = edl;
+    info.brs = brs;
+
+    Fake_FLEXCAN_GetBusLoad(HAL_FLEXCAN_0, &busBefore, &busyBefore);
+    TEST_CHECK(sent == s_can->MessageSend(FD_OBJ_TX, &info, data, size));
+    Fake_FLEXCAN_Run(HAL_FLEXCAN_0, 2U * FD_FRAME_BITS);
+    Fake_FLEXCAN_GetBusLoad(HAL_FLEXCAN_0, &busBits, &busyBits);
+
+    return busyBits - busyBefore;
+}
+
+/* Read the looped-back frame, check its flags and payload, returns the length */
+static int32_t Fd_Receive(uint8_t edl, uint8_t brs, uint32_t dlc, uint8_t sent)
+{
+    ARM_CAN_MSG_INFO info;
+    uint8_t data[64];
+    int32_t length;
+    uint32_t i;
+
+    (void)memset(data, 0xEE, sizeof(data));
+    length = s_can->MessageRead(FD_OBJ_RX, &info, data, sizeof(data));
+
+    TEST_CHECK(FD_ID == info.id);
+    TEST_CHECK((edl == info.edl) && (brs == info.brs) && (0U == info.rtr));
+    TEST_CHECK(dlc == info.dlc);
+
+    for (i = 0U; (length > 0) && (i < (uint32_t)length); i++)
+    {
+        /* Payload, then zero padding up to the DLC length */
+        TEST_CHECK(((i < sent) ? (uint8_t)(0xA5U ^ (i * 7U)) : 0U) == data[i]);
+    }
+
+    return length;
+}
+
+/* FD requests on a classic controller and outside initialization mode */
+static void Test_FdRejected(void)
+{
+    ARM_DRIVER_CAN * const classic = &Driver_CAN1;
+    ARM_CAN_MSG_INFO info;
+    uint8_t data[12];
+
+    (void)memset(&info, 0, sizeof(info));
+    (void)memset(data, 0, sizeof(data));
+    info.id  = ARM_CAN_STANDARD_ID(0x205UL);
+    info.edl = 1U;
+
+    /* FlexCAN0 in classic mode: no FD frames, no switching while running */
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_can->MessageSend(OBJ_TX_FIRST, &info, data, sizeof(data)));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_can->Control(ARM_CAN_SET_FD_MODE, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_can->Control(CAN_CONTROL_MB_LAYOUT, CAN_MB_LAYOUT(64U, 4U)));
+
+    /* FlexCAN1 has no FD support at all */
+    TEST_CHECK(ARM_DRIVER_OK == classic->Initialize(NULL, NULL));
+    TEST_CHECK(ARM_DRIVER_OK == classic->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(0U == classic->GetCapabilities().fd_mode);
+    TEST_CHECK(1U == s_can->GetCapabilities().fd_mode);
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == classic->Control(ARM_CAN_SET_FD_MODE, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == classic->Control(CAN_CONTROL_MB_LAYOUT, CAN_MB_LAYOUT(64U, 4U)));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == classic->Control(ARM_CAN_SET_TRANSCEIVER_DELAY, 4U));
+    TEST_CHECK(ARM_CAN_INVALID_BITRATE_SELECT == classic->SetBitrate(ARM_CAN_BITRATE_FD_DATA, FD_DATA_BITRATE,
+                                                                     CAN_BIT_SEGMENTS_AUTO));
+    TEST_CHECK(ARM_DRIVER_OK == classic->Control(ARM_CAN_SET_FD_MODE, 0U));
+
+    TEST_CHECK(ARM_DRIVER_OK == classic->ObjectConfigure(CAN_OBJ_MAILBOX(0U), ARM_CAN_OBJ_TX));
+    TEST_CHECK(ARM_DRIVER_OK == classic->SetMode(ARM_CAN_MODE_NORMAL));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == classic->MessageSend(CAN_OBJ_MAILBOX(0U), &info, data, sizeof(data)));
+    info.edl = 0U;
+    TEST_CHECK(8 == classic->MessageSend(CAN_OBJ_MAILBOX(0U), &info, data, sizeof(data)));
+
+    TEST_CHECK(ARM_DRIVER_OK == classic->Uninitialize());
+}
+
+/* Nominal and data phase timing, transceiver delay compensation offset */
+static void Test_FdTiming(void)
+{
+    HAL_FLEXCAN_Timing_t nominal;
+    HAL_FLEXCAN_Timing_t data;
+    uint32_t segments;
+
+    Fake_FLEXCAN_GetTiming(HAL_FLEXCAN_0, &nominal, &data);
+
+    TEST_CHECK(FD_BIT_CLOCKS == ((uint32_t)nominal.preDivider *
+                                 (1U + nominal.propSeg + nominal.phaseSeg1 + nominal.phaseSeg2)));
+    TEST_CHECK(FD_DATA_BIT_CLOCKS == ((uint32_t)data.preDivider * (1U + data.propSeg + data.phaseSeg1 + data.phaseSeg2)));
+
+    /* One clock per tq keeps the offset short; sample point at 75 %, FDCBT field limits */
+    TEST_CHECK((1U == data.preDivider) && (9U == data.propSeg) && (8U == data.phaseSeg1) && (6U == data.phaseSeg2));
+    TEST_CHECK((data.sjw >= 1U) && (data.sjw <= data.phaseSeg2));
+    TEST_CHECK(1U == Fake_FLEXCAN_GetBrs(HAL_FLEXCAN_0));
+
+    /* TDC: secondary sample point at the data sample point by default */
+    TEST_CHECK(FD_TDC_OFFSET == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->Control(ARM_CAN_SET_TRANSCEIVER_DELAY, 12U));
+    TEST_CHECK(12U == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_can->Control(ARM_CAN_SET_TRANSCEIVER_DELAY, 32U));
+    TEST_CHECK(12U == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->Control(ARM_CAN_SET_TRANSCEIVER_DELAY, CAN_TRANSCEIVER_DELAY_AUTO));
+    TEST_CHECK(FD_TDC_OFFSET == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+
+    /* 1 Mbit/s needs 2 clocks per tq: the offset of 36 clocks is beyond TDCOFF, TDC off */
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetBitrate(ARM_CAN_BITRATE_FD_DATA, 1000000UL, CAN_BIT_SEGMENTS_AUTO));
+    Fake_FLEXCAN_GetTiming(HAL_FLEXCAN_0, &nominal, &data);
+    TEST_CHECK(2U == data.preDivider);
+    TEST_CHECK(0U == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+
+    /* Explicit segments: 4 Mbit/s with 12 tq, and a phase segment 1 beyond the FDCBT field */
+    segments = (3UL << ARM_CAN_BIT_PROP_SEG_Pos) | (5UL << ARM_CAN_BIT_PHASE_SEG1_Pos) |
+               (3UL << ARM_CAN_BIT_PHASE_SEG2_Pos) | (2UL << ARM_CAN_BIT_SJW_Pos);
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetBitrate(ARM_CAN_BITRATE_FD_DATA, 4000000UL, segments));
+    Fake_FLEXCAN_GetTiming(HAL_FLEXCAN_0, &nominal, &data);
+    TEST_CHECK((1U == data.preDivider) && (3U == data.propSeg) && (5U == data.phaseSeg1) &&
+               (3U == data.phaseSeg2) && (2U == data.sjw));
+    TEST_CHECK(9U == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+
+    segments = (3UL << ARM_CAN_BIT_PROP_SEG_Pos) | (9UL << ARM_CAN_BIT_PHASE_SEG1_Pos) |
+               (3UL << ARM_CAN_BIT_PHASE_SEG2_Pos) | (2UL << ARM_CAN_BIT_SJW_Pos);
+    TEST_CHECK(ARM_CAN_INVALID_BIT_PHASE_SEG1 == s_can->SetBitrate(ARM_CAN_BITRATE_FD_DATA, 3000000UL, segments));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetBitrate(ARM_CAN_BITRATE_FD_DATA, FD_DATA_BITRATE, CAN_BIT_SEGMENTS_AUTO));
+    TEST_CHECK(FD_TDC_OFFSET == Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_0));
+}
+
+/* 64 byte frames, DLC padding, and the bus time saved by bit rate switching */
+static void Test_FdPayload(void)
+{
+    ARM_CAN_MSG_INFO info;
+    uint32_t plain;
+    uint32_t fast;
+
+    s_readInCallback = 0U;
+
+    plain = Fd_Loop(64U, 1U, 0U, 64);
+    TEST_CHECK(64 == Fd_Receive(1U, 0U, 15U, 64U));
+
+    fast = Fd_Loop(64U, 1U, 1U, 64);
+    TEST_CHECK(64 == Fd_Receive(1U, 1U, 15U, 64U));
+
+    (void)printf("\nCAN FD 64 bytes at %u / %u kbit/s: %u bit times, %u with BRS\n", (unsigned)(FD_BITRATE / 1000U),
+                 (unsigned)(FD_DATA_BITRATE / 1000U), (unsigned)plain, (unsigned)fast);
+
+    TEST_CHECK(FD_FRAME_BITS == plain);
+    TEST_CHECK(FD_FRAME_BITS_BRS == fast);
+
+    /* 13 bytes go out with DLC 10 (16 bytes), the rest zero padded */
+    (void)Fd_Loop(13U, 1U, 1U, 13);
+    TEST_CHECK(16 == Fd_Receive(1U, 1U, 10U, 13U));
+
+    (void)Fd_Loop(0U, 1U, 1U, 0);
+    TEST_CHECK(0 == Fd_Receive(1U, 1U, 0U, 0U));
+
+    /* Classic frames still run in FD mode, 8 bytes at most */
+    (void)Fd_Loop(12U, 0U, 0U, 8);
+    TEST_CHECK(8 == Fd_Receive(0U, 0U, 8U, 8U));
+
+    /* FD remote frames do not exist; no RX FIFO in FD mode */
+    (void)memset(&info, 0, sizeof(info));
+    info.id  = FD_ID;
+    info.edl = 1U;
+    info.rtr = 1U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_can->MessageSend(FD_OBJ_TX, &info, NULL, 0U));
+    TEST_CHECK(0U == s_can->ObjectGetCapabilities(CAN_OBJ_RX_FIFO).rx);
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_can->ObjectConfigure(CAN_OBJ_RX_FIFO, ARM_CAN_OBJ_RX));
+}
+
+/* Message buffer payload size (MBDSR0) from the largest frame and the mailboxes needed */
+static void Test_FdLayout(void)
+{
+    static const struct
+    {
+        uint8_t  payload;
+        uint8_t  mailboxes;
+        int32_t  result;
+        uint8_t  size;          /**< Payload size afterwards */
+        uint8_t  objects;       /**< Mailbox objects afterwards */
+    } cases[] =
+    {
+        { 64U,  7U, ARM_DRIVER_OK,              64U,  7U },
+        { 64U,  8U, ARM_DRIVER_ERROR_PARAMETER, 64U,  7U },    /* Only 7 buffers of 64 bytes */
+        {  8U, 32U, ARM_DRIVER_OK,               8U, 32U },
+        { 12U, 21U, ARM_DRIVER_OK,              16U, 21U },
+        { 16U, 22U, ARM_DRIVER_ERROR_PARAMETER, 16U, 21U },
+        { 20U, 10U, ARM_DRIVER_OK,              32U, 12U },
+        { 65U,  1U, ARM_DRIVER_ERROR_PARAMETER, 32U, 12U },
+    };
+    uint32_t i;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_INITIALIZATION));
+
+    for (i = 0U; i < (sizeof(cases) / sizeof(cases[0])); i++)
+    {
+        TEST_CHECK(cases[i].result == s_can->Control(CAN_CONTROL_MB_LAYOUT,
+                                                     CAN_MB_LAYOUT(cases[i].payload, cases[i].mailboxes)));
+        TEST_CHECK(cases[i].size == HAL_FLEXCAN_GetPayloadSize(HAL_FLEXCAN_0));
+        TEST_CHECK((1U + cases[i].objects) == s_can->GetCapabilities().num_objects);
+    }
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_can->ObjectConfigure(CAN_OBJ_MAILBOX(12U), ARM_CAN_OBJ_TX));
+
+    /* 32 byte buffers: a 64 byte frame is cut to 32, DLC 13 */
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectSetFilter(FD_OBJ_RX, ARM_CAN_FILTER_ID_EXACT_ADD, FD_ID, 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(FD_OBJ_RX, ARM_CAN_OBJ_RX));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->ObjectConfigure(FD_OBJ_TX, ARM_CAN_OBJ_TX));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_LOOPBACK_INTERNAL));
+
+    (void)Fd_Loop(64U, 1U, 1U, 32);
+    TEST_CHECK(32 == Fd_Receive(1U, 1U, 13U, 32U));
+
+    /* Back to classic CAN: RX FIFO and mailboxes from MB10 */
+    TEST_CHECK(ARM_DRIVER_OK == s_can->SetMode(ARM_CAN_MODE_INITIALIZATION));
+    TEST_CHECK(ARM_DRIVER_OK == s_can->Control(ARM_CAN_SET_FD_MODE, 0U));
+    TEST_CHECK(8U == HAL_FLEXCAN_GetPayloadSize(HAL_FLEXCAN_0));
+    TEST_CHECK((1U + 32U - 10U) == s_can->GetCapabilities().num_objects);
+    TEST_CHECK(1U == s_can->ObjectGetCapabilities(CAN_OBJ_RX_FIFO).rx);
+}
+
+int main(void)
+{
+    Can_Setup();
+
+    Test_Filtering();
+    Test_Modes();
+    Test_Arbitration();
+    Test_FullLoad();
+
+    Test_FdRejected();
+    Fd_Setup();
+    Test_FdTiming();
+    Test_FdPayload();
+    Test_FdLayout();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_can->Uninitialize());
+
+    return Test_Report("Test_Can");
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * @file    Test_Common.h
+ * @brief   Minimal check / report helpers for the host tests header file.
+ *
+ * Every test is one executable: TEST_CHECK() counts and prints failures,
+ * Test_Report() prints the summary and gives the process exit code.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef TEST_COMMON_H_
+#define TEST_COMMON_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_CHECK(cond)    Test_Check((cond) ? 1U : 0U, #cond, __FILE__, __LINE__)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_testChecks;
+static uint32_t s_testFailures;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+static inline uint8_t Test_Check(uint8_t passed, const char *expression, const char *file, int line)
+{
+    s_testChecks++;
+
+    if (0U == passed)
+    {
+        s_testFailures++;
+        (void)printf("%s:%d: check failed: %s\n", file, line, expression);
+    }
+    else
+    {
+        /* Passed */
+    }
+
+    return passed;
+}
+
+static inline int Test_Report(const char *name)
+{
+    (void)printf("%s: %u checks, %u failed\n", name, (unsigned)s_testChecks, (unsigned)s_testFailures);
+
+    return (0U == s_testFailures) ? 0 : 1;
+}
+
+/*******************************************************************************
+ * @brief   Monotonic time in nanoseconds, for the benchmark reports.
+ ******************************************************************************/
+static inline uint64_t Test_Nanoseconds(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+#endif /* TEST_COMMON_H_ */
@@ -0,0 +1,300 @@
+/*******************************************************************************
+ * @file    Test_Crc.c
+ * @brief   CRC module driver and slicing-by-8 tables on the CRC model C file.
+ *
+ * Results of the tables, of the module fed by the CPU and of the module
+ * fed by eDMA are checked against the catalogue check values and a bit by
+ * bit reference, for aligned and unaligned buffers and a DMA feed longer
+ * than one major loop. The report gives bytes per cycle of each path:
+ * the table and bitwise loops timed on the host, the module feeds from
+ * the register writes, DMA minor loops and interrupts of the cycle model
+ * in Fake_HAL.h (48 MHz core).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "CRC_Engine.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define CRC_CONFIGS             (3U)
+#define DMA_BUFFER_SIZE         (200000U)       /**< More than one 32767-word major loop */
+#define BENCH_REPEAT_BYTES      (16UL << 20)    /**< Bytes timed per host measurement */
+#define CORE_MHZ                (48U)
+#define DMA_TCD_LOAD_CYCLES     (8U * FAKE_FIFO_ACCESS_CYCLES)  /**< Eight TCD registers per chunk */
+
+typedef struct
+{
+    const char      *name;
+    CRC_Config_t    config;
+    uint32_t        check;
+} Crc_Case_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const Crc_Case_t s_cases[CRC_CONFIGS] =
+{
+    { "CRC-16/CCITT-FALSE", CRC_CONFIG_CCITT,  0x29B1UL     },
+    { "CRC-16/KERMIT     ", CRC_CONFIG_KERMIT, 0x2189UL     },
+    { "CRC-32            ", CRC_CONFIG_CRC32,  0xCBF43926UL },
+};
+
+static const uint32_t s_benchSizes[] = { 64U, 1024U, 65536U };
+
+static CRC_Table_t s_tables[CRC_CONFIGS];
+static uint8_t s_buffer[DMA_BUFFER_SIZE + 8U] __attribute__((aligned(8)));
+
+static volatile uint32_t s_callbacks;
+static volatile int32_t s_dmaStatus;
+static volatile uint32_t s_dmaCrc;
+static volatile uint32_t s_sink;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* One bit at a time, from the catalogue definition. */
+static uint32_t Crc_Bitwise(const CRC_Config_t *config, const uint8_t *data, uint32_t size)
+{
+    uint32_t top;
+    uint32_t mask;
+    uint32_t crc;
+    uint32_t out;
+    uint32_t i;
+    uint32_t bit;
+    uint8_t byte;
+
+    top  = 1UL << (config->width - 1U);
+    mask = (32U == config->width) ? 0xFFFFFFFFUL : ((1UL << config->width) - 1U);
+    crc  = config->seed & mask;
+
+    for (i = 0U; i < size; i++)
+    {
+        byte = data[i];
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc ^= (0U != (byte & ((0U != config->reflectIn) ? (1U << bit) : (0x80U >> bit)))) ? top : 0U;
+            crc  = ((0U != (crc & top)) ? ((crc << 1) ^ config->polynomial) : (crc << 1)) & mask;
+        }
+    }
+
+    if (0U != config->reflectOut)
+    {
+        out = 0U;
+
+        for (bit = 0U; bit < config->width; bit++)
+        {
+            out |= ((crc >> bit) & 1UL) << (config->width - 1U - bit);
+        }
+
+        crc = out;
+    }
+    else
+    {
+        /* MSB first */
+    }
+
+    return (0U != config->complement) ? (~crc & mask) : crc;
+}
+
+static void Random_Fill(uint8_t *data, uint32_t size)
+{
+    static uint32_t seed = 0x2026U;
+    uint32_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        seed    = (seed * 1103515245UL) + 12345UL;
+        data[i] = (uint8_t)(seed >> 16);
+    }
+}
+
+static void Dma_Callback(int32_t status, uint32_t crc)
+{
+    s_callbacks++;
+    s_dmaStatus = status;
+    s_dmaCrc    = crc;
+}
+
+static void Test_Results(void)
+{
+    static const uint8_t check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    uint32_t crc;
+    uint32_t state;
+    uint32_t offset;
+    uint32_t size;
+    uint32_t errors;
+    uint32_t i;
+
+    Random_Fill(s_buffer, 256U);
+
+    for (i = 0U; i < CRC_CONFIGS; i++)
+    {
+        TEST_CHECK(0 == CRC_Soft_Init(&s_tables[i], &s_cases[i].config));
+        TEST_CHECK(s_cases[i].check == CRC_Soft_Compute(&s_tables[i], check, sizeof(check)));
+        TEST_CHECK(s_cases[i].check == Crc_Bitwise(&s_cases[i].config, check, sizeof(check)));
+        TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Compute(&s_cases[i].config, check, sizeof(check), &crc));
+        TEST_CHECK(s_cases[i].check == crc);
+
+        /* Every alignment of head and tail, by the CPU feed and by the tables */
+        errors = 0U;
+
+        for (offset = 0U; offset < 4U; offset++)
+        {
+            for (size = 0U; size < 68U; size++)
+            {
+                crc     = Crc_Bitwise(&s_cases[i].config, &s_buffer[offset], size);
+                errors += (crc == CRC_Soft_Compute(&s_tables[i], &s_buffer[offset], size)) ? 0U : 1U;
+                errors += (ARM_DRIVER_OK == CRC_Engine_Check(&s_tables[i], &s_buffer[offset], size)) ? 0U : 1U;
+
+                /* Split in two updates */
+                state   = CRC_Soft_Start(&s_tables[i]);
+                state   = CRC_Soft_Update(&s_tables[i], state, &s_buffer[offset], size / 3U);
+                state   = CRC_Soft_Update(&s_tables[i], state, &s_buffer[offset + (size / 3U)], size - (size / 3U));
+                errors += (crc == CRC_Soft_Finish(&s_tables[i], state)) ? 0U : 1U;
+            }
+        }
+
+        TEST_CHECK(0U == errors);
+    }
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == CRC_Engine_Compute(&s_cases[0].config, check, sizeof(check), NULL));
+}
+
+static void Test_Dma(void)
+{
+    uint32_t interrupts;
+    uint32_t expected;
+    uint32_t crc;
+    uint32_t i;
+
+    Random_Fill(s_buffer, sizeof(s_buffer));
+
+    for (i = 0U; i < CRC_CONFIGS; i++)
+    {
+        /* Unaligned start and odd length: CPU head, two DMA chunks, CPU tail */
+        expected   = CRC_Soft_Compute(&s_tables[i], &s_buffer[1], DMA_BUFFER_SIZE + 2U);
+        interrupts = Fake_DMA_GetInterruptCount();
+        s_callbacks = 0U;
+
+        TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Start(&s_cases[i].config));
+        TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_UpdateDma(&s_buffer[1], DMA_BUFFER_SIZE + 2U, Dma_Callback));
+        TEST_CHECK(0U != CRC_Engine_IsBusy());
+        TEST_CHECK(ARM_DRIVER_ERROR_BUSY == CRC_Engine_Update(s_buffer, 4U));
+        TEST_CHECK(ARM_DRIVER_ERROR_BUSY == CRC_Engine_Start(&s_cases[i].config));
+
+        TEST_CHECK(((DMA_BUFFER_SIZE + 2U - 3U) / 4U) == Fake_CRC_RunDma());
+        TEST_CHECK(0U == CRC_Engine_IsBusy());
+        TEST_CHECK((1U == s_callbacks) && (ARM_DRIVER_OK == s_dmaStatus) && (expected == s_dmaCrc));
+        TEST_CHECK(2U == (Fake_DMA_GetInterruptCount() - interrupts));
+
+        /* Shorter than a word: no DMA, the callback runs at once */
+        TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Start(&s_cases[i].config));
+        TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_UpdateDma(&s_buffer[1], 3U, Dma_Callback));
+        TEST_CHECK((2U == s_callbacks) && (CRC_Soft_Compute(&s_tables[i], &s_buffer[1], 3U) == s_dmaCrc));
+
+        /* Engine result after the DMA feed, then more by the CPU */
+        TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Update(&s_buffer[4], 5U));
+        crc = Crc_Bitwise(&s_cases[i].config, &s_buffer[1], 8U);
+        TEST_CHECK(crc == CRC_Engine_GetResult());
+    }
+}
+
+/* Host time of one software path over size bytes, in ns per call. */
+static double Bench_Software(uint32_t configIndex, uint32_t size, uint8_t tables)
+{
+    uint64_t start;
+    uint32_t calls;
+    uint32_t i;
+
+    calls = (uint32_t)(BENCH_REPEAT_BYTES / size);
+    calls = (0U != tables) ? calls : ((calls / 16U) + 1U);
+    start = Test_Nanoseconds();
+
+    for (i = 0U; i < calls; i++)
+    {
+        s_sink += (0U != tables) ? CRC_Soft_Compute(&s_tables[configIndex], s_buffer, size) :
+                                   Crc_Bitwise(&s_cases[configIndex].config, s_buffer, size);
+    }
+
+    return (double)(Test_Nanoseconds() - start) / calls;
+}
+
+static void Bench_Report(uint32_t configIndex, uint32_t size)
+{
+    uint32_t cpuBefore;
+    uint32_t dmaBefore;
+    uint32_t cpuWrites;
+    uint32_t dmaWrites;
+    uint32_t interrupts;
+    uint32_t feedCycles;
+    uint32_t dmaCpuCycles;
+    uint32_t dmaBusCycles;
+    uint32_t crc;
+    double bitwiseNs;
+    double tablesNs;
+
+    bitwiseNs = Bench_Software(configIndex, size, 0U);
+    tablesNs  = Bench_Software(configIndex, size, 1U);
+
+    /* CPU feed: one register write per word, per head / tail byte */
+    Fake_CRC_GetWrites(&cpuBefore, &dmaBefore);
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Compute(&s_cases[configIndex].config, s_buffer, size, &crc));
+    TEST_CHECK(CRC_Soft_Compute(&s_tables[configIndex], s_buffer, size) == crc);
+    Fake_CRC_GetWrites(&cpuWrites, &dmaWrites);
+    feedCycles = (cpuWrites - cpuBefore) * FAKE_FIFO_ACCESS_CYCLES;
+
+    /* DMA feed: the CPU loads a TCD and takes the interrupt per chunk */
+    Fake_CRC_GetWrites(&cpuBefore, &dmaBefore);
+    interrupts = Fake_DMA_GetInterruptCount();
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Start(&s_cases[configIndex].config));
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_UpdateDma(s_buffer, size, Dma_Callback));
+    (void)Fake_CRC_RunDma();
+    TEST_CHECK(crc == s_dmaCrc);
+    Fake_CRC_GetWrites(&cpuWrites, &dmaWrites);
+    interrupts   = Fake_DMA_GetInterruptCount() - interrupts;
+    dmaCpuCycles = ((cpuWrites - cpuBefore) * FAKE_FIFO_ACCESS_CYCLES) +
+                   (interrupts * (DMA_TCD_LOAD_CYCLES + FAKE_IRQ_ENTRY_CYCLES + FAKE_IRQ_EXIT_CYCLES));
+    dmaBusCycles = (dmaWrites - dmaBefore) * FAKE_DMA_SERVICE_CYCLES;
+
+    (void)printf("%s %6u  %8.3f %8.3f   %6.3f   %6.3f  %8.1f\n", s_cases[configIndex].name, (unsigned)size,
+                 (double)size / bitwiseNs, (double)size / tablesNs, (double)size / feedCycles,
+                 (double)size / dmaBusCycles, (0U != dmaCpuCycles) ? ((double)size / dmaCpuCycles) : 0.0);
+}
+
+int main(void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    Fake_DMA_Reset();
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Init());
+
+    Test_Results();
+    Test_Dma();
+
+    Random_Fill(s_buffer, sizeof(s_buffer));
+
+    (void)printf("                              host bytes/ns       target bytes/cycle (model, %u MHz)\n",
+                 (unsigned)CORE_MHZ);
+    (void)printf("CRC                  bytes   bitwise slicing8   CPU feed  DMA bus  DMA CPU\n");
+
+    for (i = 0U; i < CRC_CONFIGS; i++)
+    {
+        for (j = 0U; j < (sizeof(s_benchSizes) / sizeof(s_benchSizes[0])); j++)
+        {
+            Bench_Report(i, s_benchSizes[j]);
+        }
+    }
+
+    return Test_Report("Test_Crc");
+}
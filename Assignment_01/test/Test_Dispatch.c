@@ -0,0 +1,277 @@
+/*******************************************************************************
+ * @file    Test_Dispatch.c
+ * @brief   Lookup of the CAN dispatch table against a linear scan C file.
+ *
+ * A 500-entry table of exact and masked standard / extended routes is
+ * compiled once; every standard identifier and a spread of extended ones
+ * must resolve to the same entry as a linear scan with the documented
+ * precedence (exact first, then the first masked entry in table order).
+ * The report gives the time per lookup of both.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "Test_Common.h"
+#include "CAN_Dispatch.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define DISPATCH_ENTRIES        (500U)
+#define DISPATCH_MASKED_STRIDE  (6U)      /**< Every 6th route is masked */
+#define DISPATCH_PROBES         (4096U)
+#define DISPATCH_ROUNDS         (200U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static CAN_DispatchEntry_t s_entries[DISPATCH_ENTRIES];
+static uint16_t s_index[DISPATCH_ENTRIES];
+static uint32_t s_probes[DISPATCH_PROBES];
+static uint32_t s_random = 0x12345678UL;
+
+/* Masks of the masked routes: two standard, two extended */
+static const uint32_t s_masks[4] =
+{
+    0x7F0UL, 0x7F8UL, 0x1FFFFF00UL, 0x1FFF0000UL
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Random(void)
+{
+    /* xorshift32: reproducible across runs */
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 17;
+    s_random ^= s_random << 5;
+
+    return s_random;
+}
+
+static uint32_t Linear_Key(uint32_t id)
+{
+    return (0U != (id & ARM_CAN_ID_IDE_Msk)) ? (ARM_CAN_ID_IDE_Msk | (id & 0x1FFFFFFFUL)) : (id & 0x7FFUL);
+}
+
+static uint32_t Linear_IdMask(uint32_t id)
+{
+    return (0U != (id & ARM_CAN_ID_IDE_Msk)) ? 0x1FFFFFFFUL : 0x7FFUL;
+}
+
+/* Reference: every entry, exact matches first, then masked ones in table order. */
+static const CAN_DispatchEntry_t *Linear_Lookup(const CAN_DispatchEntry_t *entries, uint32_t count, uint32_t id)
+{
+    const CAN_DispatchEntry_t *entry;
+    uint32_t key;
+    uint32_t mask;
+    uint32_t i;
+
+    entry = NULL;
+    key   = Linear_Key(id);
+
+    for (i = 0U; (i < count) && (NULL == entry); i++)
+    {
+        if (((entries[i].mask & Linear_IdMask(entries[i].id)) == Linear_IdMask(entries[i].id)) &&
+            (Linear_Key(entries[i].id) == key))
+        {
+            entry = &entries[i];
+        }
+        else
+        {
+            /* Not an exact match */
+        }
+    }
+
+    for (i = 0U; (i < count) && (NULL == entry); i++)
+    {
+        mask = ARM_CAN_ID_IDE_Msk | (entries[i].mask & Linear_IdMask(entries[i].id));
+
+        if (0U == ((key ^ Linear_Key(entries[i].id)) & mask))
+        {
+            entry = &entries[i];
+        }
+        else
+        {
+            /* Keep scanning */
+        }
+    }
+
+    return entry;
+}
+
+static void Dispatch_Fill(void)
+{
+    uint32_t i;
+    uint32_t id;
+    uint32_t j;
+    uint8_t unique;
+
+    /* Masked routes interleaved with exact ones, so table order matters */
+    for (i = 0U; i < DISPATCH_ENTRIES; i++)
+    {
+        if (0U == (i % DISPATCH_MASKED_STRIDE))
+        {
+            s_entries[i].mask = s_masks[Random() % 4U];
+            id = Random() & s_entries[i].mask;
+            s_entries[i].id = (s_entries[i].mask > 0x7FFUL) ? ARM_CAN_EXTENDED_ID(id) : ARM_CAN_STANDARD_ID(id);
+        }
+        else
+        {
+            do
+            {
+                id     = ((Random() & 1U) != 0U) ? ARM_CAN_EXTENDED_ID((0x18DA0000UL | (Random() & 0xFFFFUL))) :
+                                                   ARM_CAN_STANDARD_ID(Random());
+                unique = 1U;
+
+                for (j = 0U; j < i; j++)
+                {
+                    unique = ((CAN_DISPATCH_MASK_EXACT == s_entries[j].mask) && (s_entries[j].id == id)) ?
+                             0U : unique;
+                }
+            } while (0U == unique);
+
+            s_entries[i].mask = CAN_DISPATCH_MASK_EXACT;
+            s_entries[i].id   = id;
+        }
+
+        s_entries[i].handler = NULL;
+        s_entries[i].layout  = &s_entries[i];
+    }
+}
+
+static void Test_Equivalence(const CAN_Dispatch_t *table)
+{
+    uint32_t id;
+    uint32_t mismatches;
+    uint32_t i;
+
+    mismatches = 0U;
+
+    /* Every standard identifier */
+    for (id = 0U; id <= 0x7FFUL; id++)
+    {
+        mismatches += (CAN_Dispatch_Lookup(table, id) != Linear_Lookup(s_entries, DISPATCH_ENTRIES, id)) ? 1U : 0U;
+    }
+
+    /* Extended: around the routes and at random */
+    for (i = 0U; i < 65536U; i++)
+    {
+        id = ((i & 1U) != 0U) ? ARM_CAN_EXTENDED_ID((0x18DA0000UL | (i >> 1))) : ARM_CAN_EXTENDED_ID(Random());
+        mismatches += (CAN_Dispatch_Lookup(table, id) != Linear_Lookup(s_entries, DISPATCH_ENTRIES, id)) ? 1U : 0U;
+    }
+
+    TEST_CHECK(0U == mismatches);
+
+    /* Bits outside the identifier do not change the route */
+    TEST_CHECK(CAN_Dispatch_Lookup(table, s_entries[1].id) ==
+               CAN_Dispatch_Lookup(table, s_entries[1].id | ((0U != (s_entries[1].id & ARM_CAN_ID_IDE_Msk)) ?
+                                                             0x60000000UL : 0x7FFFF800UL)));
+}
+
+static void Test_Build(void)
+{
+    static const CAN_DispatchEntry_t duplicate[2] =
+    {
+        { ARM_CAN_STANDARD_ID(0x123UL), CAN_DISPATCH_MASK_EXACT, NULL, NULL },
+        { ARM_CAN_STANDARD_ID(0x123UL), CAN_DISPATCH_MASK_EXACT, NULL, NULL },
+    };
+    static const CAN_DispatchEntry_t overlap[3] =
+    {
+        { ARM_CAN_STANDARD_ID(0x120UL), 0x7F0UL,                 NULL, NULL },
+        { ARM_CAN_STANDARD_ID(0x100UL), 0x700UL,                 NULL, NULL },
+        { ARM_CAN_STANDARD_ID(0x123UL), CAN_DISPATCH_MASK_EXACT, NULL, NULL },
+    };
+    CAN_DispatchEntry_t groups[CAN_DISPATCH_GROUPS_MAX + 1U];
+    CAN_Dispatch_t table;
+    uint16_t index[CAN_DISPATCH_GROUPS_MAX + 1U];
+    uint32_t i;
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == CAN_Dispatch_Build(&table, duplicate, 2U, index));
+
+    /* Exact beats masked, the first masked entry in table order beats a later one */
+    TEST_CHECK(ARM_DRIVER_OK == CAN_Dispatch_Build(&table, overlap, 3U, index));
+    TEST_CHECK(&overlap[2] == CAN_Dispatch_Lookup(&table, ARM_CAN_STANDARD_ID(0x123UL)));
+    TEST_CHECK(&overlap[0] == CAN_Dispatch_Lookup(&table, ARM_CAN_STANDARD_ID(0x124UL)));
+    TEST_CHECK(&overlap[1] == CAN_Dispatch_Lookup(&table, ARM_CAN_STANDARD_ID(0x134UL)));
+    TEST_CHECK(NULL == CAN_Dispatch_Lookup(&table, ARM_CAN_EXTENDED_ID(0x124UL)));
+
+    /* One distinct mask too many */
+    for (i = 0U; i < (CAN_DISPATCH_GROUPS_MAX + 1U); i++)
+    {
+        groups[i].id      = ARM_CAN_STANDARD_ID(0UL);
+        groups[i].mask    = 0x7FFUL >> (i + 1U);
+        groups[i].handler = NULL;
+        groups[i].layout  = NULL;
+    }
+    TEST_CHECK(ARM_DRIVER_OK == CAN_Dispatch_Build(&table, groups, CAN_DISPATCH_GROUPS_MAX, index));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER ==
+               CAN_Dispatch_Build(&table, groups, CAN_DISPATCH_GROUPS_MAX + 1U, index));
+}
+
+static void Test_Benchmark(const CAN_Dispatch_t *table)
+{
+    const CAN_DispatchEntry_t *volatile sink;
+    uint64_t start;
+    uint64_t tableNs;
+    uint64_t linearNs;
+    uint32_t round;
+    uint32_t i;
+
+    /* Half routed identifiers, half misses that fall through every group */
+    for (i = 0U; i < DISPATCH_PROBES; i++)
+    {
+        s_probes[i] = ((i & 1U) != 0U) ? s_entries[Random() % DISPATCH_ENTRIES].id :
+                                         (((Random() & 1U) != 0U) ? ARM_CAN_EXTENDED_ID(Random()) :
+                                                                    ARM_CAN_STANDARD_ID(Random()));
+    }
+
+    start = Test_Nanoseconds();
+    for (round = 0U; round < DISPATCH_ROUNDS; round++)
+    {
+        for (i = 0U; i < DISPATCH_PROBES; i++)
+        {
+            sink = CAN_Dispatch_Lookup(table, s_probes[i]);
+        }
+    }
+    tableNs = Test_Nanoseconds() - start;
+
+    start = Test_Nanoseconds();
+    for (round = 0U; round < DISPATCH_ROUNDS; round++)
+    {
+        for (i = 0U; i < DISPATCH_PROBES; i++)
+        {
+            sink = Linear_Lookup(s_entries, DISPATCH_ENTRIES, s_probes[i]);
+        }
+    }
+    linearNs = Test_Nanoseconds() - start;
+    (void)sink;
+
+    (void)printf("%u entries (%u exact, %u masked in %u mask groups)\n", (unsigned)DISPATCH_ENTRIES,
+                 (unsigned)table->exactCount, (unsigned)table->maskedCount, (unsigned)table->groupCount);
+    (void)printf("compiled table  %8.1f ns / lookup\n",
+                 (double)tableNs / ((double)DISPATCH_ROUNDS * DISPATCH_PROBES));
+    (void)printf("linear scan     %8.1f ns / lookup\n",
+                 (double)linearNs / ((double)DISPATCH_ROUNDS * DISPATCH_PROBES));
+}
+
+int main(void)
+{
+    CAN_Dispatch_t table;
+
+    Dispatch_Fill();
+
+    TEST_CHECK(ARM_DRIVER_OK == CAN_Dispatch_Build(&table, s_entries, DISPATCH_ENTRIES, s_index));
+    TEST_CHECK(((DISPATCH_ENTRIES + DISPATCH_MASKED_STRIDE - 1U) / DISPATCH_MASKED_STRIDE) == table.maskedCount);
+    TEST_CHECK(4U == table.groupCount);
+
+    Test_Build();
+    Test_Equivalence(&table);
+    Test_Benchmark(&table);
+
+    return Test_Report("Test_Dispatch");
+}
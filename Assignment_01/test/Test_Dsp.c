@@ -0,0 +1,609 @@
+/*******************************************************************************
+ * @file    Test_Dsp.c
+ * @brief   Bit exactness of the Q15 / Q31 filter kernels C file.
+ *
+ * Every kernel is compared sample by sample with a plain reference written
+ * from the definitions in DSP_Filter.h (exact 128-bit sums, shift towards
+ * minus infinity, one saturation per output). Inputs are random and at
+ * the Q15 / Q31 limits, with odd and even tap counts, decimation factors
+ * and blocks split at random sizes. The DSP_Simd.h C models are checked
+ * against the instruction definitions. The report gives host ns per
+ * sample of the kernels and of the references.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "DSP_Simd.h"
+#include "DSP_Filter.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SIGNAL_LEN              (1200U)         /**< Multiple of every factor */
+#define BLOCK_MAX               (96U)           /**< Multiple of every factor */
+#define TAPS_MAX                (33U)
+#define STAGES_MAX              (4U)
+#define AVG_LEN_MAX             (1024U)
+#define BENCH_SAMPLES           (1UL << 20)     /**< Samples timed per measurement */
+
+typedef __int128 Wide_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const uint16_t s_factors[] = { 1U, 2U, 3U, 4U };
+static const uint32_t s_avgLengths[] = { 1U, 2U, 8U, 64U, AVG_LEN_MAX };
+
+static uint32_t s_random = 0x12345678UL;
+
+static int16_t s_in15[SIGNAL_LEN];
+static int16_t s_out15[SIGNAL_LEN];
+static int16_t s_ref15[SIGNAL_LEN];
+static int32_t s_wide[SIGNAL_LEN];        /**< Q15 samples widened for the references */
+static int32_t s_in31[SIGNAL_LEN];
+static int32_t s_out31[SIGNAL_LEN];
+static int32_t s_ref31[SIGNAL_LEN];
+
+static int16_t s_coeffs15[TAPS_MAX + 1U];
+static int32_t s_coeffs31[TAPS_MAX + 1U];
+static int16_t s_state15[DSP_FIR_STATE_LEN(TAPS_MAX, BLOCK_MAX)];
+static int32_t s_state31[DSP_FIR_STATE_LEN(TAPS_MAX, BLOCK_MAX)];
+static int16_t s_history15[AVG_LEN_MAX];
+static int32_t s_history31[AVG_LEN_MAX];
+
+static volatile int32_t s_sink;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Random_Next(void)
+{
+    /* xorshift32 */
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 17;
+    s_random ^= s_random << 5;
+
+    return s_random;
+}
+
+/* Random value in [-2^bits, 2^bits). */
+static int32_t Random_Signed(uint32_t bits)
+{
+    return (int32_t)(Random_Next() & ((2UL << bits) - 1U)) - (int32_t)(1UL << bits);
+}
+
+/* Random samples, one in eight at a limit. */
+static void Signal_Fill(uint32_t bits)
+{
+    uint32_t i;
+    uint32_t pick;
+
+    for (i = 0U; i < SIGNAL_LEN; i++)
+    {
+        pick = Random_Next() & 7U;
+
+        if (0U == pick)
+        {
+            s_in15[i] = (0U != (Random_Next() & 1U)) ? INT16_MAX : INT16_MIN;
+            s_in31[i] = (0U != (Random_Next() & 1U)) ? INT32_MAX : INT32_MIN;
+        }
+        else
+        {
+            s_in15[i] = (int16_t)Random_Signed((bits < 15U) ? bits : 15U);
+            s_in31[i] = Random_Signed(bits + 16U);
+        }
+    }
+}
+
+static int32_t Ref_Sat(Wide_t value, uint32_t bits)
+{
+    Wide_t limit;
+
+    limit = (Wide_t)1 << (bits - 1U);
+
+    return (int32_t)((value >= limit) ? (limit - 1) : ((value < -limit) ? -limit : value));
+}
+
+/* Floor division by 2^shift; >> of a negative __int128 is arithmetic in GCC. */
+static Wide_t Ref_Shift(Wide_t value, uint32_t shift)
+{
+    return value >> shift;
+}
+
+/* Output m ends on input m * factor + factor - 1, taps h[j] = coeffs[taps - 1 - j]. */
+static void Ref_Fir(const int32_t *coeffs, uint32_t taps, uint32_t factor, const int32_t *in, int32_t *out,
+                    uint32_t count, uint32_t bits)
+{
+    Wide_t acc;
+    uint32_t t;
+    uint32_t m;
+    uint32_t j;
+
+    for (m = 0U; m < (count / factor); m++)
+    {
+        t   = (m * factor) + factor - 1U;
+        acc = 0;
+
+        for (j = 0U; (j < taps) && (j <= t); j++)
+        {
+            acc += (Wide_t)coeffs[taps - 1U - j] * in[t - j];
+        }
+
+        out[m] = Ref_Sat(Ref_Shift(acc, bits - 1U), bits);
+    }
+}
+
+static void Ref_Biquad(const int32_t *coeffs, uint32_t stages, uint32_t postShift, int32_t *data, uint32_t count,
+                       uint32_t bits)
+{
+    Wide_t acc;
+    int32_t x1;
+    int32_t x2;
+    int32_t y1;
+    int32_t y2;
+    int32_t x0;
+    uint32_t s;
+    uint32_t i;
+
+    for (s = 0U; s < stages; s++)
+    {
+        x1 = 0;
+        x2 = 0;
+        y1 = 0;
+        y2 = 0;
+
+        for (i = 0U; i < count; i++)
+        {
+            x0  = data[i];
+            acc = ((Wide_t)coeffs[(5U * s) + 0U] * x0) + ((Wide_t)coeffs[(5U * s) + 1U] * x1) +
+                  ((Wide_t)coeffs[(5U * s) + 2U] * x2) + ((Wide_t)coeffs[(5U * s) + 3U] * y1) +
+                  ((Wide_t)coeffs[(5U * s) + 4U] * y2);
+
+            x2      = x1;
+            x1      = x0;
+            y2      = y1;
+            y1      = Ref_Sat(Ref_Shift(acc, bits - 1U - postShift), bits);
+            data[i] = y1;
+        }
+    }
+}
+
+static void Ref_MovAvg(uint32_t length, const int32_t *in, int32_t *out, uint32_t count)
+{
+    Wide_t sum;
+    uint32_t shift;
+    uint32_t i;
+    uint32_t j;
+
+    shift = 0U;
+
+    while ((1UL << shift) < length)
+    {
+        shift++;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        sum = 0;
+
+        for (j = 0U; (j < length) && (j <= i); j++)
+        {
+            sum += in[i - j];
+        }
+
+        out[i] = (int32_t)Ref_Shift(sum, shift);
+    }
+}
+
+static void Test_Simd(void)
+{
+    uint32_t a;
+    uint32_t b;
+    int32_t acc;
+    int64_t acc64;
+    int32_t lo;
+    int32_t hi;
+    uint32_t i;
+    uint32_t failures;
+
+    failures = 0U;
+
+    for (i = 0U; i < 100000U; i++)
+    {
+        a     = Random_Next();
+        b     = (0U == (i & 15U)) ? 0x80008000UL : Random_Next();
+        acc   = (int32_t)Random_Next();
+        acc64 = ((int64_t)(int32_t)Random_Next() << 31) ^ Random_Next();
+
+        /* SMLAD: products and accumulate modulo 2^32 */
+        failures += ((uint32_t)DSP_Smlad(a, b, acc) !=
+                     (uint32_t)((int64_t)(int16_t)a * (int16_t)b + (int64_t)(int16_t)(a >> 16) * (int16_t)(b >> 16) +
+                                acc)) ? 1U : 0U;
+
+        /* SMLALD: exact in 64 bits */
+        failures += (DSP_Smlald(a, b, acc64) !=
+                     (acc64 + (int64_t)(int16_t)a * (int16_t)b + (int64_t)(int16_t)(a >> 16) * (int16_t)(b >> 16))) ?
+                    1U : 0U;
+
+        /* QADD16: each half saturated on its own */
+        lo = (int32_t)Ref_Sat((Wide_t)(int16_t)a + (int16_t)b, 16U);
+        hi = (int32_t)Ref_Sat((Wide_t)(int16_t)(a >> 16) + (int16_t)(b >> 16), 16U);
+        failures += (DSP_Qadd16(a, b) != (((uint32_t)hi << 16) | ((uint32_t)lo & 0xFFFFU))) ? 1U : 0U;
+
+        failures += (DSP_Sat16(acc) != (int16_t)Ref_Sat(acc, 16U)) ? 1U : 0U;
+        failures += (DSP_Sat32(acc64) != Ref_Sat(acc64, 32U)) ? 1U : 0U;
+    }
+
+    TEST_CHECK(0U == failures);
+    TEST_CHECK(0x7FFF7FFFUL == DSP_Qadd16(0x7FFF7FFFUL, 0x00010001UL));
+    TEST_CHECK(0x80008000UL == DSP_Qadd16(0x80008000UL, 0xFFFFFFFFUL));
+    TEST_CHECK(0x7FFF8000UL == DSP_Qadd16(0x40008000UL, 0x4000FFFFUL));
+    TEST_CHECK(INT16_MAX == DSP_Sat16(0x12345678L));
+    TEST_CHECK(INT16_MIN == DSP_Sat16(-0x12345678L));
+    TEST_CHECK(INT32_MIN == DSP_Smlad(0x80008000UL, 0x80008000UL, 0));
+}
+
+/* FIR of the whole signal in random blocks, compared with the reference. */
+static uint32_t Fir_Run(uint32_t taps, uint16_t factor, uint32_t coeffBits)
+{
+    DSP_FirQ15_t fir15;
+    DSP_FirQ31_t fir31;
+    int32_t wide[TAPS_MAX];
+    uint32_t offset;
+    uint32_t count;
+    uint32_t outputs;
+    uint32_t i;
+    uint32_t failures;
+
+    failures = 0U;
+
+    for (i = 0U; i < taps; i++)
+    {
+        s_coeffs15[i] = (int16_t)Random_Signed(coeffBits);
+        s_coeffs31[i] = Random_Signed(coeffBits + 16U);
+    }
+
+    if (0U != (Random_Next() & 1U))
+    {
+        /* Largest products: -1.0 x -1.0 saturates */
+        s_coeffs15[0] = INT16_MIN;
+    }
+    else
+    {
+        /* Random only */
+    }
+
+    TEST_CHECK(0 == DSP_FirQ15_Init(&fir15, (uint16_t)taps, s_coeffs15, s_state15, BLOCK_MAX, factor));
+    TEST_CHECK(0 == DSP_FirQ31_Init(&fir31, (uint16_t)taps, s_coeffs31, s_state31, BLOCK_MAX, factor));
+
+    for (offset = 0U; offset < SIGNAL_LEN; offset += count)
+    {
+        count = (1U + (Random_Next() % (BLOCK_MAX / factor))) * factor;
+        count = (count > (SIGNAL_LEN - offset)) ? (SIGNAL_LEN - offset) : count;
+
+        outputs  = DSP_FirQ15_Process(&fir15, &s_in15[offset], &s_out15[offset / factor], count);
+        failures += (outputs != (count / factor)) ? 1U : 0U;
+        outputs  = DSP_FirQ31_Process(&fir31, &s_in31[offset], &s_out31[offset / factor], count);
+        failures += (outputs != (count / factor)) ? 1U : 0U;
+    }
+
+    for (i = 0U; i < taps; i++)
+    {
+        wide[i] = s_coeffs15[i];
+    }
+
+    for (i = 0U; i < SIGNAL_LEN; i++)
+    {
+        s_wide[i] = s_in15[i];
+    }
+
+    Ref_Fir(wide, taps, factor, s_wide, s_ref31, SIGNAL_LEN, 16U);
+
+    for (i = 0U; i < (SIGNAL_LEN / factor); i++)
+    {
+        failures += (s_out15[i] != (int16_t)s_ref31[i]) ? 1U : 0U;
+    }
+
+    Ref_Fir(s_coeffs31, taps, factor, s_in31, s_ref31, SIGNAL_LEN, 32U);
+
+    for (i = 0U; i < (SIGNAL_LEN / factor); i++)
+    {
+        failures += (s_out31[i] != s_ref31[i]) ? 1U : 0U;
+    }
+
+    return failures;
+}
+
+static void Test_Fir(void)
+{
+    uint32_t taps;
+    uint32_t f;
+    uint32_t failures;
+    uint32_t q31Bits;
+
+    failures = 0U;
+
+    for (taps = 1U; taps <= TAPS_MAX; taps++)
+    {
+        for (f = 0U; f < (sizeof(s_factors) / sizeof(s_factors[0])); f++)
+        {
+            /* Q15 coefficients at full scale; Q31 ones below 1 / taps (exact sums) */
+            q31Bits = 14U;
+
+            while ((1UL << (15U - q31Bits)) < taps)
+            {
+                q31Bits--;
+            }
+
+            Signal_Fill(15U);
+            failures += Fir_Run(taps, s_factors[f], q31Bits);
+        }
+    }
+
+    TEST_CHECK(0U == failures);
+}
+
+static void Test_FirParams(void)
+{
+    DSP_FirQ15_t fir;
+
+    TEST_CHECK(-1 == DSP_FirQ15_Init(&fir, 0U, s_coeffs15, s_state15, BLOCK_MAX, 1U));
+    TEST_CHECK(-1 == DSP_FirQ15_Init(&fir, 4U, s_coeffs15, s_state15, 10U, 3U));
+    TEST_CHECK(-1 == DSP_FirQ15_Init(&fir, 4U, s_coeffs15, s_state15, BLOCK_MAX, 0U));
+    TEST_CHECK(-1 == DSP_FirQ15_Init(&fir, 4U, NULL, s_state15, BLOCK_MAX, 1U));
+    TEST_CHECK(0 == DSP_FirQ15_Init(&fir, 4U, s_coeffs15, s_state15, 12U, 3U));
+    TEST_CHECK(0U == DSP_FirQ15_Process(&fir, s_in15, s_out15, 13U));
+    TEST_CHECK(0U == DSP_FirQ15_Process(&fir, s_in15, s_out15, 15U));
+    TEST_CHECK(4U == DSP_FirQ15_Process(&fir, s_in15, s_out15, 12U));
+}
+
+static void Test_Biquad(void)
+{
+    DSP_BiquadQ15_t iir15;
+    DSP_BiquadQ31_t iir31;
+    int16_t state15[DSP_BIQUAD_STATE_LEN(STAGES_MAX)];
+    int32_t state31[DSP_BIQUAD_STATE_LEN(STAGES_MAX)];
+    int32_t wide[STAGES_MAX * DSP_BIQUAD_COEFF_COUNT];
+    uint32_t stages;
+    uint32_t shift;
+    uint32_t offset;
+    uint32_t count;
+    uint32_t i;
+    uint32_t failures;
+
+    failures = 0U;
+
+    for (stages = 1U; stages <= STAGES_MAX; stages++)
+    {
+        for (shift = 0U; shift <= DSP_BIQUAD_POST_SHIFT_MAX; shift++)
+        {
+            /* Full scale Q15 coefficients; Q31 ones below 1/8 keep five terms exact */
+            for (i = 0U; i < (stages * DSP_BIQUAD_COEFF_COUNT); i++)
+            {
+                s_coeffs15[i] = (int16_t)Random_Signed(15U);
+                s_coeffs31[i] = Random_Signed(27U);
+            }
+
+            Signal_Fill(15U);
+            TEST_CHECK(0 == DSP_BiquadQ15_Init(&iir15, (uint8_t)stages, s_coeffs15, state15, (uint8_t)shift));
+            TEST_CHECK(0 == DSP_BiquadQ31_Init(&iir31, (uint8_t)stages, s_coeffs31, state31, (uint8_t)shift));
+
+            /* In place, in random blocks: the state carries over */
+            (void)memcpy(s_out15, s_in15, sizeof(s_out15));
+            (void)memcpy(s_out31, s_in31, sizeof(s_out31));
+
+            for (offset = 0U; offset < SIGNAL_LEN; offset += count)
+            {
+                count = 1U + (Random_Next() % BLOCK_MAX);
+                count = (count > (SIGNAL_LEN - offset)) ? (SIGNAL_LEN - offset) : count;
+
+                DSP_BiquadQ15_Process(&iir15, &s_out15[offset], &s_out15[offset], count);
+                DSP_BiquadQ31_Process(&iir31, &s_out31[offset], &s_out31[offset], count);
+            }
+
+            for (i = 0U; i < (stages * DSP_BIQUAD_COEFF_COUNT); i++)
+            {
+                wide[i] = s_coeffs15[i];
+            }
+
+            for (i = 0U; i < SIGNAL_LEN; i++)
+            {
+                s_ref31[i] = s_in15[i];
+            }
+
+            /* The reference also filters in place */
+            Ref_Biquad(wide, stages, shift, s_ref31, SIGNAL_LEN, 16U);
+
+            for (i = 0U; i < SIGNAL_LEN; i++)
+            {
+                failures += (s_out15[i] != (int16_t)s_ref31[i]) ? 1U : 0U;
+            }
+
+            (void)memcpy(s_ref31, s_in31, sizeof(s_ref31));
+            Ref_Biquad(s_coeffs31, stages, shift, s_ref31, SIGNAL_LEN, 32U);
+
+            for (i = 0U; i < SIGNAL_LEN; i++)
+            {
+                failures += (s_out31[i] != s_ref31[i]) ? 1U : 0U;
+            }
+        }
+    }
+
+    TEST_CHECK(0U == failures);
+    TEST_CHECK(-1 == DSP_BiquadQ15_Init(&iir15, 1U, s_coeffs15, state15, DSP_BIQUAD_POST_SHIFT_MAX + 1U));
+    TEST_CHECK(-1 == DSP_BiquadQ31_Init(&iir31, 0U, s_coeffs31, state31, 0U));
+}
+
+static void Test_MovAvg(void)
+{
+    DSP_MovAvgQ15_t avg15;
+    DSP_MovAvgQ31_t avg31;
+    uint32_t offset;
+    uint32_t count;
+    uint32_t l;
+    uint32_t i;
+    uint32_t failures;
+
+    failures = 0U;
+
+    for (l = 0U; l < (sizeof(s_avgLengths) / sizeof(s_avgLengths[0])); l++)
+    {
+        Signal_Fill(15U);
+        TEST_CHECK(0 == DSP_MovAvgQ15_Init(&avg15, s_history15, s_avgLengths[l]));
+        TEST_CHECK(0 == DSP_MovAvgQ31_Init(&avg31, s_history31, s_avgLengths[l]));
+
+        for (offset = 0U; offset < SIGNAL_LEN; offset += count)
+        {
+            count = 1U + (Random_Next() % BLOCK_MAX);
+            count = (count > (SIGNAL_LEN - offset)) ? (SIGNAL_LEN - offset) : count;
+
+            DSP_MovAvgQ15_Process(&avg15, &s_in15[offset], &s_out15[offset], count);
+            DSP_MovAvgQ31_Process(&avg31, &s_in31[offset], &s_out31[offset], count);
+        }
+
+        for (i = 0U; i < SIGNAL_LEN; i++)
+        {
+            s_wide[i] = s_in15[i];
+        }
+
+        Ref_MovAvg(s_avgLengths[l], s_wide, s_ref31, SIGNAL_LEN);
+
+        for (i = 0U; i < SIGNAL_LEN; i++)
+        {
+            failures += (s_out15[i] != (int16_t)s_ref31[i]) ? 1U : 0U;
+        }
+
+        Ref_MovAvg(s_avgLengths[l], s_in31, s_ref31, SIGNAL_LEN);
+
+        for (i = 0U; i < SIGNAL_LEN; i++)
+        {
+            failures += (s_out31[i] != s_ref31[i]) ? 1U : 0U;
+        }
+    }
+
+    TEST_CHECK(0U == failures);
+    TEST_CHECK(-1 == DSP_MovAvgQ15_Init(&avg15, s_history15, 0U));
+    TEST_CHECK(-1 == DSP_MovAvgQ15_Init(&avg15, s_history15, 24U));
+    TEST_CHECK(-1 == DSP_MovAvgQ31_Init(&avg31, s_history31, 65536U));
+}
+
+static void Test_Add(void)
+{
+    uint32_t count;
+    uint32_t i;
+    uint32_t failures;
+
+    failures = 0U;
+
+    for (count = 0U; count <= 9U; count++)
+    {
+        Signal_Fill(15U);
+        (void)memcpy(s_ref15, s_in15, sizeof(s_ref15));
+        s_out15[count] = 0x5A5A;
+
+        /* Odd offsets: halfword aligned pairs */
+        DSP_AddQ15(&s_in15[1], &s_ref15[3], s_out15, count);
+
+        for (i = 0U; i < count; i++)
+        {
+            failures += (s_out15[i] != (int16_t)Ref_Sat((Wide_t)s_in15[1U + i] + s_ref15[3U + i], 16U)) ? 1U : 0U;
+        }
+
+        failures += (0x5A5A != s_out15[count]) ? 1U : 0U;
+    }
+
+    TEST_CHECK(0U == failures);
+}
+
+/* ns per sample of a kernel over BENCH_SAMPLES samples. */
+static double Bench_Fir(uint32_t taps, uint8_t reference)
+{
+    DSP_FirQ15_t fir;
+    int32_t wide[TAPS_MAX];
+    uint64_t start;
+    uint32_t done;
+    uint32_t i;
+
+    for (i = 0U; i < taps; i++)
+    {
+        s_coeffs15[i] = (int16_t)Random_Signed(12U);
+        wide[i]       = s_coeffs15[i];
+    }
+
+    (void)DSP_FirQ15_Init(&fir, (uint16_t)taps, s_coeffs15, s_state15, BLOCK_MAX, 1U);
+    start = Test_Nanoseconds();
+
+    for (done = 0U; done < BENCH_SAMPLES; done += BLOCK_MAX)
+    {
+        if (0U != reference)
+        {
+            Ref_Fir(wide, taps, 1U, s_wide, s_ref31, BLOCK_MAX, 16U);
+            s_sink += s_ref31[done & 63U];
+        }
+        else
+        {
+            (void)DSP_FirQ15_Process(&fir, s_in15, s_out15, BLOCK_MAX);
+            s_sink += s_out15[done & 63U];
+        }
+    }
+
+    return (double)(Test_Nanoseconds() - start) / (double)done;
+}
+
+static double Bench_Biquad(uint32_t stages)
+{
+    DSP_BiquadQ15_t iir;
+    int16_t state[DSP_BIQUAD_STATE_LEN(STAGES_MAX)];
+    uint64_t start;
+    uint32_t done;
+
+    (void)DSP_BiquadQ15_Init(&iir, (uint8_t)stages, s_coeffs15, state, 1U);
+    start = Test_Nanoseconds();
+
+    for (done = 0U; done < BENCH_SAMPLES; done += BLOCK_MAX)
+    {
+        DSP_BiquadQ15_Process(&iir, s_in15, s_out15, BLOCK_MAX);
+        s_sink += s_out15[done & 63U];
+    }
+
+    return (double)(Test_Nanoseconds() - start) / (double)done;
+}
+
+int main(void)
+{
+    static const uint32_t benchTaps[] = { 8U, 16U, 32U };
+    uint32_t i;
+
+    Test_Simd();
+    Test_Fir();
+    Test_FirParams();
+    Test_Biquad();
+    Test_MovAvg();
+    Test_Add();
+
+    Signal_Fill(15U);
+
+    for (i = 0U; i < SIGNAL_LEN; i++)
+    {
+        s_wide[i] = s_in15[i];
+    }
+
+    (void)printf("Q15 kernel          host ns/sample   reference\n");
+
+    for (i = 0U; i < (sizeof(benchTaps) / sizeof(benchTaps[0])); i++)
+    {
+        (void)printf("FIR %2u taps          %8.2f        %8.2f\n", (unsigned)benchTaps[i],
+                     Bench_Fir(benchTaps[i], 0U), Bench_Fir(benchTaps[i], 1U));
+    }
+
+    (void)printf("Biquad 2 stages      %8.2f\n", Bench_Biquad(2U));
+    (void)printf("Biquad 4 stages      %8.2f\n", Bench_Biquad(4U));
+
+    return Test_Report("Test_Dsp");
+}
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * @file    Test_Eeprom.c
+ * @brief   EEPROM slot store on the FTFC model C file.
+ *
+ * Partitioning and FlexRAM setup go through FCCOB only while the engine is
+ * owned; writes complete from the command complete interrupt one record at
+ * a time. The report gives, per update pattern, the latency from Write()
+ * to the callback and the bytes written to flash per byte requested, next
+ * to the same update done as a read-modify-write of a 2 KB D-Flash sector.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "NVM_Eeprom.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SLOT_COUNTER            (0U)
+#define SLOT_CALIBRATION        (1U)
+#define SLOT_STATUS             (2U)
+
+#define CALIBRATION_SIZE        (64U)
+
+/* Direct D-Flash update: erase the sector, program it back phrase by phrase */
+#define DFLASH_REWRITE_US       (FAKE_FTFC_ERASE_SECTOR_US + \
+                                 ((HAL_FTFC_DFLASH_SECTOR / HAL_FTFC_PHRASE_SIZE) * FAKE_FTFC_PROGRAM_PHRASE_US))
+
+typedef struct
+{
+    const char  *name;
+    uint16_t    slot;
+    uint16_t    size;
+    uint32_t    updates;
+    uint32_t    recordsPerUpdate;
+} Eeprom_Pattern_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const uint16_t s_slotSize[3] = { 4U, CALIBRATION_SIZE, 13U };
+
+static uint8_t s_data[CALIBRATION_SIZE];
+static uint32_t s_events;
+static uint32_t s_eventCount;
+static uint32_t s_doneUs;
+
+static const Eeprom_Pattern_t s_patterns[] =
+{
+    { "counter +1         ", SLOT_COUNTER,     4U,               1000U,  1U },
+    { "calibration 1 byte ", SLOT_CALIBRATION, CALIBRATION_SIZE,  200U,  1U },
+    { "calibration all    ", SLOT_CALIBRATION, CALIBRATION_SIZE,   50U, 16U },
+    { "status unchanged   ", SLOT_STATUS,      13U,               200U,  0U },
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Callback(uint16_t slot, uint32_t event)
+{
+    (void)slot;
+
+    s_events |= event;
+    s_eventCount++;
+    s_doneUs = Fake_FTFC_GetTimeUs();
+}
+
+/* Run the model until the write in progress has called back. */
+static uint32_t Eeprom_Complete(void)
+{
+    uint32_t guard;
+
+    for (guard = 0U; (0U != NVM_Eeprom_IsBusy()) && (guard < 1000000U); guard++)
+    {
+        Fake_FTFC_Run(10U);
+    }
+
+    return s_eventCount;
+}
+
+static void Test_Setup(void)
+{
+    static const uint16_t tooLarge[2] = { 4000U, 100U };
+    uint8_t value[4];
+
+    Fake_FTFC_Reset(0U);
+    TEST_CHECK(0U != Fake_FTFC_IsMapped());
+
+    /* Not partitioned yet */
+    TEST_CHECK(ARM_DRIVER_ERROR == NVM_Eeprom_Init(s_slotSize, 3U, Callback));
+
+    /* The engine held by the flash driver: FCCOB must stay untouched */
+    TEST_CHECK(1U == HAL_FTFC_Acquire(NULL, NULL));
+    HAL_FTFC_SetCommand(HAL_FTFC_CMD_ERASE_SECTOR, HAL_FTFC_DFLASH_BASE);
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == NVM_Eeprom_Partition());
+    TEST_CHECK(HAL_FTFC_CMD_ERASE_SECTOR == Fake_FTFC_GetCommand());
+    HAL_FTFC_Release();
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Eeprom_Partition());
+    TEST_CHECK(HAL_FTFC_FLEXRAM_SIZE == HAL_FTFC_GetEeeSize());
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Eeprom_Partition());
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Eeprom_Init(tooLarge, 2U, Callback));
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Eeprom_Init(s_slotSize, 3U, Callback));
+    TEST_CHECK(0U != HAL_FTFC_IsEeeReady());
+    TEST_CHECK(0U == Fake_FTFC_GetUnownedLoads());
+
+    /* Erased EEPROM reads 0xFF */
+    TEST_CHECK(4 == NVM_Eeprom_Read(SLOT_COUNTER, value, 4U));
+    TEST_CHECK((0xFFU == value[0]) && (0xFFU == value[3]));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Eeprom_Read(SLOT_COUNTER, value, 5U));
+}
+
+static void Test_Write(void)
+{
+    uint8_t calibration[CALIBRATION_SIZE];
+    uint8_t readBack[CALIBRATION_SIZE];
+    uint32_t count;
+
+    (void)memset(calibration, 0x5A, sizeof(calibration));
+    s_events = 0U;
+    count    = s_eventCount;
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Eeprom_Write(SLOT_CALIBRATION, calibration, CALIBRATION_SIZE));
+    TEST_CHECK(0U != NVM_Eeprom_IsBusy());
+
+    /* Slot being written, engine busy; other slots stay readable */
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == NVM_Eeprom_Read(SLOT_CALIBRATION, readBack, CALIBRATION_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == NVM_Eeprom_Write(SLOT_COUNTER, calibration, 4U));
+    TEST_CHECK(4 == NVM_Eeprom_Read(SLOT_COUNTER, readBack, 4U));
+
+    TEST_CHECK((count + 1U) == Eeprom_Complete());
+    TEST_CHECK(NVM_EEPROM_EVENT_WRITE_DONE == s_events);
+    TEST_CHECK(CALIBRATION_SIZE == NVM_Eeprom_Read(SLOT_CALIBRATION, readBack, CALIBRATION_SIZE));
+    TEST_CHECK(0 == memcmp(calibration, readBack, CALIBRATION_SIZE));
+
+    /* A failed record ends the write with an error */
+    calibration[5] = 0x00U;
+    s_events = 0U;
+    Fake_FTFC_FailNextRecord();
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Eeprom_Write(SLOT_CALIBRATION, calibration, CALIBRATION_SIZE));
+    (void)Eeprom_Complete();
+    TEST_CHECK(NVM_EEPROM_EVENT_WRITE_ERROR == s_events);
+    TEST_CHECK(CALIBRATION_SIZE == NVM_Eeprom_Read(SLOT_CALIBRATION, readBack, CALIBRATION_SIZE));
+    TEST_CHECK(0x5AU == readBack[5]);
+
+    TEST_CHECK(0U == Fake_FTFC_GetUnownedLoads());
+}
+
+static void Test_Pattern(const Eeprom_Pattern_t *pattern)
+{
+    NVM_EepromStats_t before;
+    NVM_EepromStats_t after;
+    uint8_t readBack[CALIBRATION_SIZE];
+    uint64_t latencyUs;
+    uint32_t records;
+    uint32_t startUs;
+    uint32_t update;
+    uint32_t errors;
+    uint32_t i;
+
+    /* Start from what the slot holds */
+    TEST_CHECK((int32_t)pattern->size == NVM_Eeprom_Read(pattern->slot, s_data, pattern->size));
+
+    NVM_Eeprom_GetStats(&before);
+    records   = Fake_FTFC_GetRecordCount();
+    latencyUs = 0U;
+    errors    = 0U;
+
+    for (update = 0U; update < pattern->updates; update++)
+    {
+        if (1U == pattern->recordsPerUpdate)
+        {
+            /* One byte moves: a counter, or one calibration value */
+            s_data[(SLOT_COUNTER == pattern->slot) ? 0U : ((update * 7U) % pattern->size)] += 1U;
+        }
+        else if (0U != pattern->recordsPerUpdate)
+        {
+            for (i = 0U; i < pattern->size; i++)
+            {
+                s_data[i] = (uint8_t)(s_data[i] ^ 0xA5U);
+            }
+        }
+        else
+        {
+            /* Same contents again */
+        }
+
+        s_events = 0U;
+        startUs  = Fake_FTFC_GetTimeUs();
+
+        errors += (ARM_DRIVER_OK == NVM_Eeprom_Write(pattern->slot, s_data, pattern->size)) ? 0U : 1U;
+        (void)Eeprom_Complete();
+
+        latencyUs += s_doneUs - startUs;
+        errors    += (NVM_EEPROM_EVENT_WRITE_DONE == s_events) ? 0U : 1U;
+        errors    += ((int32_t)pattern->size == NVM_Eeprom_Read(pattern->slot, readBack, pattern->size)) ? 0U : 1U;
+        errors    += (0 == memcmp(s_data, readBack, pattern->size)) ? 0U : 1U;
+    }
+
+    NVM_Eeprom_GetStats(&after);
+    records = Fake_FTFC_GetRecordCount() - records;
+
+    TEST_CHECK(0U == errors);
+    TEST_CHECK((pattern->updates * pattern->recordsPerUpdate) == records);
+    TEST_CHECK((after.wordsWritten - before.wordsWritten) == records);
+    TEST_CHECK(latencyUs == ((uint64_t)records * FAKE_FTFC_EEE_RECORD_US));
+
+    (void)printf("%s %5u  %6u  %5u  %8.1f us  %6.2f    %8u us  %7.1f\n", pattern->name,
+                 (unsigned)pattern->updates, (unsigned)(after.bytesRequested - before.bytesRequested),
+                 (unsigned)records, (double)latencyUs / pattern->updates,
+                 ((double)records * 4.0) / ((double)pattern->updates * pattern->size),
+                 (unsigned)DFLASH_REWRITE_US, (double)HAL_FTFC_DFLASH_SECTOR / pattern->size);
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    Test_Setup();
+    Test_Write();
+
+    (void)printf("                              EEPROM (FlexRAM EEE)                 D-Flash sector rewrite\n");
+    (void)printf("pattern            updates   bytes  recs   latency   bytes/byte     latency    bytes/byte\n");
+
+    for (i = 0U; i < (sizeof(s_patterns) / sizeof(s_patterns[0])); i++)
+    {
+        Test_Pattern(&s_patterns[i]);
+    }
+
+    return Test_Report("Test_Eeprom");
+}
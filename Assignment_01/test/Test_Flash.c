@@ -0,0 +1,373 @@
+/*******************************************************************************
+ * @file    Test_Flash.c
+ * @brief   CMSIS Flash driver state machine on the FTFC model C file.
+ *
+ * Driver_Flash1 (D-Flash) against the FTFC model: ProgramData() and the
+ * erase functions only start the operation, each further phrase is
+ * launched from the command complete interrupt and the last command
+ * signals ARM_FLASH_EVENT_READY. Checks the completion time of a
+ * multi-phrase program, the erase and program error paths, and that a
+ * second operation, a read or a power down is refused while one runs or
+ * while another owner (the EEPROM emulation) holds the engine.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "HAL_FTFC.h"
+#include "Driver_Flash_S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define DFLASH_SECTOR(n)        (FLASH_DFLASH_BASE + ((n) * HAL_FTFC_DFLASH_SECTOR))
+#define DFLASH_SECTORS          (HAL_FTFC_DFLASH_SIZE / HAL_FTFC_DFLASH_SECTOR)
+
+#define PROGRAM_PHRASES         (16U)
+#define PROGRAM_SIZE            (PROGRAM_PHRASES * HAL_FTFC_PHRASE_SIZE)
+
+/* Generous bound on the model time any single operation may take */
+#define COMPLETE_TIMEOUT_US     (1000000U)
+#define COMPLETE_STEP_US        (10U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_FLASH * const s_flash = &Driver_Flash1;
+
+static uint32_t s_events;
+static uint32_t s_eventCount;
+static uint32_t s_doneUs;
+
+static uint8_t s_data[HAL_FTFC_DFLASH_SECTOR];
+static uint8_t s_read[HAL_FTFC_DFLASH_SECTOR];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Flash_Event(uint32_t event)
+{
+    s_events |= event;
+    s_eventCount++;
+    s_doneUs  = Fake_FTFC_GetTimeUs();
+}
+
+/* Start time of the next operation, with the event record cleared */
+static uint32_t Flash_Begin(void)
+{
+    s_events     = 0U;
+    s_eventCount = 0U;
+    s_doneUs     = 0U;
+
+    return Fake_FTFC_GetTimeUs();
+}
+
+/* Run the model until the operation in progress has finished */
+static uint32_t Flash_Complete(void)
+{
+    uint32_t elapsed;
+
+    for (elapsed = 0U; (0U != s_flash->GetStatus().busy) && (elapsed < COMPLETE_TIMEOUT_US);
+         elapsed += COMPLETE_STEP_US)
+    {
+        Fake_FTFC_Run(COMPLETE_STEP_US);
+    }
+
+    return s_events;
+}
+
+static uint8_t Flash_IsErased(uint32_t address, uint32_t size)
+{
+    const volatile uint8_t *flash;
+    uint32_t i;
+    uint8_t erased;
+
+    flash  = (const volatile uint8_t *)FAKE_PTR(address);
+    erased = 1U;
+
+    for (i = 0U; i < size; i++)
+    {
+        erased &= (0xFFU == flash[i]) ? 1U : 0U;
+    }
+
+    return erased;
+}
+
+static void Test_Setup(void)
+{
+    ARM_FLASH_CAPABILITIES capabilities;
+    ARM_FLASH_INFO *info;
+    uint32_t i;
+
+    Fake_FTFC_Reset(0U);
+    TEST_CHECK(0U != Fake_FTFC_IsMapped());
+
+    for (i = 0U; i < sizeof(s_data); i++)
+    {
+        s_data[i] = (uint8_t)((i * 37U) + 11U);
+    }
+
+    capabilities = s_flash->GetCapabilities();
+    TEST_CHECK(1U == capabilities.event_ready);
+    TEST_CHECK(0U == capabilities.data_width);
+    TEST_CHECK(1U == capabilities.erase_chip);
+
+    /* The P-Flash holds the running application, never erased as a whole */
+    TEST_CHECK(0U == Driver_Flash0.GetCapabilities().erase_chip);
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == Driver_Flash0.EraseChip());
+
+    /* Nothing runs before Initialize() and PowerControl() */
+    TEST_CHECK(ARM_DRIVER_ERROR == s_flash->ProgramData(DFLASH_SECTOR(0U), s_data, PROGRAM_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_flash->EraseSector(DFLASH_SECTOR(0U)));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_flash->EraseChip());
+    TEST_CHECK(ARM_DRIVER_ERROR == s_flash->PowerControl(ARM_POWER_FULL));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->Initialize(Flash_Event));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_flash->PowerControl(ARM_POWER_LOW));
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->PowerControl(ARM_POWER_FULL));
+
+    info = s_flash->GetInfo();
+    TEST_CHECK(DFLASH_SECTORS == info->sector_count);
+    TEST_CHECK(HAL_FTFC_DFLASH_SECTOR == info->sector_size);
+    TEST_CHECK(HAL_FTFC_PHRASE_SIZE == info->program_unit);
+    TEST_CHECK(0xFFU == info->erased_value);
+    TEST_CHECK(0U != Flash_IsErased(FLASH_DFLASH_BASE, HAL_FTFC_DFLASH_SIZE));
+}
+
+static void Test_Parameters(void)
+{
+    uint32_t last;
+
+    last = DFLASH_SECTOR(DFLASH_SECTORS) - HAL_FTFC_PHRASE_SIZE;
+
+    (void)Flash_Begin();
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ProgramData(DFLASH_SECTOR(0U) + 4U, s_data, 8U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ProgramData(DFLASH_SECTOR(0U), s_data, 12U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ProgramData(DFLASH_SECTOR(0U), NULL, 8U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ProgramData(last, s_data, 16U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ProgramData(FLASH_DFLASH_BASE - 8U, s_data, 8U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->EraseSector(DFLASH_SECTOR(DFLASH_SECTORS)));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ReadData(last, s_read, 16U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->ReadData(DFLASH_SECTOR(0U), NULL, 8U));
+
+    /* An empty program is done at once, with no event */
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(0U), s_data, 0U));
+
+    TEST_CHECK(0U == s_flash->GetStatus().busy);
+    TEST_CHECK(0U == s_eventCount);
+    TEST_CHECK(0U != Flash_IsErased(FLASH_DFLASH_BASE, HAL_FTFC_DFLASH_SIZE));
+}
+
+static void Test_Program(void)
+{
+    ARM_FLASH_STATUS status;
+    uint32_t startUs;
+
+    startUs = Flash_Begin();
+
+    /* Returns at once: the phrases are programmed from the interrupt */
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(1U), s_data, PROGRAM_SIZE));
+
+    status = s_flash->GetStatus();
+    TEST_CHECK(1U == status.busy);
+    TEST_CHECK(0U == status.error);
+    TEST_CHECK(0U == s_eventCount);
+    TEST_CHECK(0U == HAL_FTFC_IsReady());
+
+    /* One operation at a time; the block under modification cannot be read */
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->ProgramData(DFLASH_SECTOR(2U), s_data, PROGRAM_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->EraseSector(DFLASH_SECTOR(2U)));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->EraseChip());
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->ReadData(DFLASH_SECTOR(1U), s_read, PROGRAM_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->PowerControl(ARM_POWER_OFF));
+
+    /* Not done one microsecond before the last phrase completes */
+    Fake_FTFC_Run((PROGRAM_PHRASES * FAKE_FTFC_PROGRAM_PHRASE_US) - 1U);
+    TEST_CHECK(1U == s_flash->GetStatus().busy);
+    TEST_CHECK(0U == s_eventCount);
+
+    Fake_FTFC_Run(1U);
+
+    status = s_flash->GetStatus();
+    TEST_CHECK(0U == status.busy);
+    TEST_CHECK(0U == status.error);
+    TEST_CHECK(1U == s_eventCount);
+    TEST_CHECK(ARM_FLASH_EVENT_READY == s_events);
+    TEST_CHECK((s_doneUs - startUs) == (PROGRAM_PHRASES * FAKE_FTFC_PROGRAM_PHRASE_US));
+
+    TEST_CHECK((int32_t)PROGRAM_SIZE == s_flash->ReadData(DFLASH_SECTOR(1U), s_read, PROGRAM_SIZE));
+    TEST_CHECK(0 == memcmp(s_data, s_read, PROGRAM_SIZE));
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(1U) + PROGRAM_SIZE, HAL_FTFC_DFLASH_SECTOR - PROGRAM_SIZE));
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(0U), HAL_FTFC_DFLASH_SECTOR));
+
+    /* The engine is free again */
+    TEST_CHECK(1U == HAL_FTFC_Acquire(NULL, NULL));
+    HAL_FTFC_Release();
+}
+
+static void Test_Erase(void)
+{
+    uint32_t startUs;
+
+    (void)Flash_Begin();
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(2U), s_data, HAL_FTFC_PHRASE_SIZE));
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+
+    /* Any address inside the sector erases the whole sector, and only it */
+    startUs = Flash_Begin();
+    TEST_CHECK(0 == s_flash->EraseSector(DFLASH_SECTOR(1U) + 100U));
+    TEST_CHECK(1U == s_flash->GetStatus().busy);
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+    TEST_CHECK(1U == s_eventCount);
+    TEST_CHECK((s_doneUs - startUs) == FAKE_FTFC_ERASE_SECTOR_US);
+    TEST_CHECK(0U == s_flash->GetStatus().error);
+
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(1U), HAL_FTFC_DFLASH_SECTOR));
+    TEST_CHECK(0 == memcmp(FAKE_PTR(DFLASH_SECTOR(2U)), s_data, HAL_FTFC_PHRASE_SIZE));
+}
+
+static void Test_Errors(void)
+{
+    ARM_FLASH_STATUS status;
+    uint32_t startUs;
+
+    /* Phrase 1 of sector 3 already programmed */
+    (void)Flash_Begin();
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(3U) + HAL_FTFC_PHRASE_SIZE, s_data, HAL_FTFC_PHRASE_SIZE));
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+
+    /* Program before erase: stops at the failing phrase */
+    startUs = Flash_Begin();
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(3U), s_read, 3U * HAL_FTFC_PHRASE_SIZE));
+    TEST_CHECK((ARM_FLASH_EVENT_READY | ARM_FLASH_EVENT_ERROR) == Flash_Complete());
+    TEST_CHECK(1U == s_eventCount);
+    TEST_CHECK((s_doneUs - startUs) == (2U * FAKE_FTFC_PROGRAM_PHRASE_US));
+
+    status = s_flash->GetStatus();
+    TEST_CHECK(0U == status.busy);
+    TEST_CHECK(1U == status.error);
+    TEST_CHECK(0 == memcmp(FAKE_PTR(DFLASH_SECTOR(3U)), s_read, HAL_FTFC_PHRASE_SIZE));
+    TEST_CHECK(0 == memcmp(FAKE_PTR(DFLASH_SECTOR(3U) + HAL_FTFC_PHRASE_SIZE), s_data, HAL_FTFC_PHRASE_SIZE));
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(3U) + (2U * HAL_FTFC_PHRASE_SIZE), HAL_FTFC_PHRASE_SIZE));
+
+    /* The engine was released on the error path as well */
+    TEST_CHECK(1U == HAL_FTFC_Acquire(NULL, NULL));
+    HAL_FTFC_Release();
+
+    /* The next successful operation clears the error */
+    (void)Flash_Begin();
+    TEST_CHECK(0 == s_flash->EraseSector(DFLASH_SECTOR(3U)));
+    TEST_CHECK(0U == s_flash->GetStatus().error);
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+    TEST_CHECK(0U == s_flash->GetStatus().error);
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(3U), HAL_FTFC_DFLASH_SECTOR));
+
+    /* Erase refused by the hardware: the sector keeps its contents */
+    Fake_FTFC_FailNextCommand(HAL_FTFC_ERROR_PROTECTION);
+    (void)Flash_Begin();
+    TEST_CHECK(0 == s_flash->EraseSector(DFLASH_SECTOR(2U)));
+    TEST_CHECK((ARM_FLASH_EVENT_READY | ARM_FLASH_EVENT_ERROR) == Flash_Complete());
+    TEST_CHECK(1U == s_flash->GetStatus().error);
+    TEST_CHECK(0 == memcmp(FAKE_PTR(DFLASH_SECTOR(2U)), s_data, HAL_FTFC_PHRASE_SIZE));
+
+    /* Verify failure on the first phrase: nothing further is programmed */
+    Fake_FTFC_FailNextCommand(HAL_FTFC_ERROR_VERIFY);
+    startUs = Flash_Begin();
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(4U), s_data, PROGRAM_SIZE));
+    TEST_CHECK((ARM_FLASH_EVENT_READY | ARM_FLASH_EVENT_ERROR) == Flash_Complete());
+    TEST_CHECK((s_doneUs - startUs) == FAKE_FTFC_PROGRAM_PHRASE_US);
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(4U), HAL_FTFC_DFLASH_SECTOR));
+}
+
+static void Test_Owner(void)
+{
+    /* Engine held by the EEPROM emulation: refused without side effects */
+    TEST_CHECK(1U == HAL_FTFC_Acquire(NULL, NULL));
+
+    (void)Flash_Begin();
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->ProgramData(DFLASH_SECTOR(5U), s_data, PROGRAM_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_flash->EraseSector(DFLASH_SECTOR(5U)));
+    TEST_CHECK(0U == s_flash->GetStatus().busy);
+    TEST_CHECK(0U != Flash_IsErased(DFLASH_SECTOR(5U), HAL_FTFC_DFLASH_SECTOR));
+
+    HAL_FTFC_Release();
+
+    /* Engine held by the other block */
+    TEST_CHECK(ARM_DRIVER_OK == Driver_Flash0.Initialize(NULL));
+    TEST_CHECK(ARM_DRIVER_OK == Driver_Flash0.PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(5U), s_data, PROGRAM_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == Driver_Flash0.EraseSector(FLASH_PFLASH_BASE + 0x00040000UL));
+    TEST_CHECK(0U == Driver_Flash0.GetStatus().busy);
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+    TEST_CHECK(ARM_DRIVER_OK == Driver_Flash0.Uninitialize());
+
+    TEST_CHECK(0 == memcmp(FAKE_PTR(DFLASH_SECTOR(5U)), s_data, PROGRAM_SIZE));
+}
+
+static void Test_EraseChip(void)
+{
+    uint32_t startUs;
+
+    startUs = Flash_Begin();
+    TEST_CHECK(0 == s_flash->EraseChip());
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+    TEST_CHECK((s_doneUs - startUs) == (DFLASH_SECTORS * FAKE_FTFC_ERASE_SECTOR_US));
+    TEST_CHECK(0U != Flash_IsErased(FLASH_DFLASH_BASE, HAL_FTFC_DFLASH_SIZE));
+
+    /* Partitioned: half of the FlexNVM backs the EEPROM */
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->Uninitialize());
+    Fake_FTFC_Reset(1U);
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->Initialize(Flash_Event));
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->PowerControl(ARM_POWER_FULL));
+
+    TEST_CHECK((DFLASH_SECTORS / 2U) == s_flash->GetInfo()->sector_count);
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_flash->EraseSector(DFLASH_SECTOR(DFLASH_SECTORS / 2U)));
+    TEST_CHECK(0 == s_flash->EraseSector(DFLASH_SECTOR((DFLASH_SECTORS / 2U) - 1U)));
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->Uninitialize());
+}
+
+static void Test_Timing(void)
+{
+    uint32_t startUs;
+    uint32_t programUs;
+
+    Fake_FTFC_Reset(0U);
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->Initialize(Flash_Event));
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->PowerControl(ARM_POWER_FULL));
+
+    startUs = Flash_Begin();
+    TEST_CHECK(0 == s_flash->ProgramData(DFLASH_SECTOR(0U), s_data, HAL_FTFC_DFLASH_SECTOR));
+    TEST_CHECK(ARM_FLASH_EVENT_READY == Flash_Complete());
+    programUs = s_doneUs - startUs;
+
+    TEST_CHECK(0 == memcmp(FAKE_PTR(DFLASH_SECTOR(0U)), s_data, HAL_FTFC_DFLASH_SECTOR));
+
+    (void)printf("D-Flash 2 KB sector: program %u us (%u commands), erase %u us, block erase %u us\n",
+                 (unsigned)programUs, (unsigned)(HAL_FTFC_DFLASH_SECTOR / HAL_FTFC_PHRASE_SIZE),
+                 (unsigned)FAKE_FTFC_ERASE_SECTOR_US, (unsigned)(DFLASH_SECTORS * FAKE_FTFC_ERASE_SECTOR_US));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_flash->Uninitialize());
+}
+
+int main(void)
+{
+    Test_Setup();
+    Test_Parameters();
+    Test_Program();
+    Test_Erase();
+    Test_Errors();
+    Test_Owner();
+    Test_EraseChip();
+    Test_Timing();
+
+    return Test_Report("Test_Flash");
+}
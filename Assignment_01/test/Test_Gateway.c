@@ -0,0 +1,437 @@
+/*******************************************************************************
+ * @file    Test_Gateway.c
+ * @brief   CAN gateway over three simulated buses C file.
+ *
+ * Every port is a stand-in ARM_DRIVER_CAN: object 0 is the receive FIFO,
+ * objects 1 ... 3 are TX objects that hold their frame for its bit time on
+ * the port's own bus (500 kbit/s, unstuffed). Other nodes load a source bus
+ * back-to-back; the gateway forwards from the receive event, as the CAN
+ * interrupt would. The report gives the bus latency from the end of the
+ * received frame to the end of the forwarded one, the sustained route rate
+ * and the host CPU time per forwarded frame.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "CAN_Gateway.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BUS_BIT_NS              (2000U)     /**< 500 kbit/s */
+#define BUS_RX_DEPTH            (6U)        /**< FlexCAN RX FIFO */
+#define BUS_TX_OBJECTS          (3U)
+
+#define GATEWAY_ROUTES          (64U)
+#define GATEWAY_FRAMES          (20000U)
+
+#define OBJ_RX                  (0U)
+#define OBJ_TX                  (1U)
+
+typedef struct
+{
+    uint32_t    id;
+    uint8_t     edl;
+    uint8_t     size;
+    uint8_t     data[8];
+} Bus_Frame_t;
+
+typedef struct
+{
+    uint8_t     fd;                             /**< Port accepts FD frames */
+    uint64_t    busFreeNs;
+    uint64_t    txDoneNs[BUS_TX_OBJECTS];
+    Bus_Frame_t rx[BUS_RX_DEPTH];
+    uint8_t     rxHead;
+    uint8_t     rxCount;
+    uint32_t    rxLost;
+    uint32_t    lastId;
+    uint8_t     lastData[8];
+    uint64_t    latencySumNs;
+    uint64_t    latencyMaxNs;
+    uint32_t    sent;
+} Bus_Port_t;
+
+typedef struct
+{
+    const char  *name;
+    uint8_t     sources;                        /**< Ports loaded by other nodes */
+    uint32_t    routeId;                        /**< Route of the loaded identifiers */
+    uint8_t     txCount;
+} Gateway_Scenario_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static Bus_Port_t s_bus[CAN_GATEWAY_PORT_MAX];
+static uint64_t s_nowNs;
+
+static CAN_Gateway_t s_gateway;
+static CAN_GatewayPortConfig_t s_ports[CAN_GATEWAY_PORT_MAX];
+static CAN_DispatchEntry_t s_entries[CAN_GATEWAY_PORT_MAX][GATEWAY_ROUTES];
+static uint16_t s_index[CAN_GATEWAY_PORT_MAX][GATEWAY_ROUTES];
+
+/* Routes by identifier 0x100 ... 0x103 */
+static const CAN_GatewayRoute_t s_routes[4] =
+{
+    { CAN_GATEWAY_PORT(1U),                        0x00000000UL, 0x00000000UL },
+    { CAN_GATEWAY_PORT(1U) | CAN_GATEWAY_PORT(2U), 0x00000000UL, 0x00000000UL },
+    { CAN_GATEWAY_PORT(1U),                        0x9FFFFF00UL, 0x98DAF100UL },   /* To extended */
+    { CAN_GATEWAY_PORT(0U) | CAN_GATEWAY_PORT(1U), 0x0000000FUL, 0x00000005UL },   /* Low nibble := 5 */
+};
+
+static const Gateway_Scenario_t s_scenarios[] =
+{
+    { "0 -> 1            ", CAN_GATEWAY_PORT(0U),                        0x100UL, 1U },
+    { "0 -> 1 + 2        ", CAN_GATEWAY_PORT(0U),                        0x101UL, 1U },
+    { "0 -> 1 std to ext ", CAN_GATEWAY_PORT(0U),                        0x102UL, 3U },
+    { "0 + 2 -> 1 merge  ", CAN_GATEWAY_PORT(0U) | CAN_GATEWAY_PORT(2U), 0x100UL, 3U },
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Frame time without stuff bits: standard 47 + 8n, extended 67 + 8n */
+static uint64_t Bus_FrameNs(uint32_t id, uint8_t size)
+{
+    return (((0U != (id & ARM_CAN_ID_IDE_Msk)) ? 67ULL : 47ULL) + (8ULL * size)) * BUS_BIT_NS;
+}
+
+static int32_t Bus_Send(Bus_Port_t *bus, uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data,
+                        uint8_t size)
+{
+    uint64_t start;
+    uint32_t tx;
+    int32_t result;
+
+    tx     = obj_idx - OBJ_TX;
+    result = size;
+
+    if ((obj_idx < OBJ_TX) || (tx >= BUS_TX_OBJECTS) || (size > 8U))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if ((0U != msg_info->edl) && (0U == bus->fd))
+    {
+        result = ARM_DRIVER_ERROR_UNSUPPORTED;
+    }
+    else if (bus->txDoneNs[tx] > s_nowNs)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        /* Pending objects leave in the order they were written. */
+        start             = (bus->busFreeNs > s_nowNs) ? bus->busFreeNs : s_nowNs;
+        bus->txDoneNs[tx] = start + Bus_FrameNs(msg_info->id, size);
+        bus->busFreeNs    = bus->txDoneNs[tx];
+
+        bus->latencySumNs += bus->txDoneNs[tx] - s_nowNs;
+        bus->latencyMaxNs  = ((bus->txDoneNs[tx] - s_nowNs) > bus->latencyMaxNs) ? (bus->txDoneNs[tx] - s_nowNs) :
+                                                                                    bus->latencyMaxNs;
+        bus->sent++;
+        bus->lastId = msg_info->id;
+        (void)memcpy(bus->lastData, data, size);
+    }
+
+    return result;
+}
+
+static int32_t Bus_Read(Bus_Port_t *bus, uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data,
+                        uint8_t size)
+{
+    Bus_Frame_t *frame;
+    int32_t result;
+
+    if (OBJ_RX != obj_idx)
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == bus->rxCount)
+    {
+        result = ARM_CAN_NO_MESSAGE_AVAILABLE;
+    }
+    else
+    {
+        frame  = &bus->rx[bus->rxHead];
+        result = (frame->size < size) ? frame->size : size;
+
+        (void)memset(msg_info, 0, sizeof(*msg_info));
+        msg_info->id  = frame->id;
+        msg_info->edl = frame->edl;
+        msg_info->dlc = frame->size;
+        (void)memcpy(data, frame->data, (size_t)result);
+
+        bus->rxHead = (uint8_t)((bus->rxHead + 1U) % BUS_RX_DEPTH);
+        bus->rxCount--;
+    }
+
+    return result;
+}
+
+static int32_t Bus0_Send(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size)
+{
+    return Bus_Send(&s_bus[0], obj_idx, msg_info, data, size);
+}
+
+static int32_t Bus1_Send(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size)
+{
+    return Bus_Send(&s_bus[1], obj_idx, msg_info, data, size);
+}
+
+static int32_t Bus2_Send(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size)
+{
+    return Bus_Send(&s_bus[2], obj_idx, msg_info, data, size);
+}
+
+static int32_t Bus0_Read(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size)
+{
+    return Bus_Read(&s_bus[0], obj_idx, msg_info, data, size);
+}
+
+static int32_t Bus1_Read(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size)
+{
+    return Bus_Read(&s_bus[1], obj_idx, msg_info, data, size);
+}
+
+static int32_t Bus2_Read(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size)
+{
+    return Bus_Read(&s_bus[2], obj_idx, msg_info, data, size);
+}
+
+static ARM_DRIVER_CAN s_drivers[CAN_GATEWAY_PORT_MAX] =
+{
+    { .MessageSend = Bus0_Send, .MessageRead = Bus0_Read },
+    { .MessageSend = Bus1_Send, .MessageRead = Bus1_Read },
+    { .MessageSend = Bus2_Send, .MessageRead = Bus2_Read },
+};
+
+/* Another node's frame, complete on the bus of a port */
+static void Bus_Receive(uint8_t port, uint32_t id, uint8_t edl, const uint8_t *data, uint8_t size)
+{
+    Bus_Port_t *bus;
+    Bus_Frame_t *frame;
+
+    bus = &s_bus[port];
+
+    if (bus->rxCount >= BUS_RX_DEPTH)
+    {
+        bus->rxLost++;
+    }
+    else
+    {
+        frame       = &bus->rx[(bus->rxHead + bus->rxCount) % BUS_RX_DEPTH];
+        frame->id   = id;
+        frame->edl  = edl;
+        frame->size = size;
+        (void)memcpy(frame->data, data, size);
+        bus->rxCount++;
+    }
+}
+
+/* 64 routes per port: the four test routes plus exact and masked filler */
+static void Gateway_Open(uint8_t txCount)
+{
+    uint32_t port;
+    uint32_t i;
+
+    (void)memset(s_bus, 0, sizeof(s_bus));
+    s_nowNs = 0U;
+
+    for (port = 0U; port < CAN_GATEWAY_PORT_MAX; port++)
+    {
+        for (i = 0U; i < GATEWAY_ROUTES; i++)
+        {
+            if (i < 4U)
+            {
+                s_entries[port][i].id     = ARM_CAN_STANDARD_ID((0x100UL + i));
+                s_entries[port][i].layout = &s_routes[i];
+                s_entries[port][i].mask   = CAN_DISPATCH_MASK_EXACT;
+            }
+            else if (0U == (i % 8U))
+            {
+                s_entries[port][i].id     = ARM_CAN_EXTENDED_ID((0x18DA0000UL | (i << 8)));
+                s_entries[port][i].layout = &s_routes[3];
+                s_entries[port][i].mask   = 0x1FFFFF00UL;
+            }
+            else
+            {
+                s_entries[port][i].id     = ARM_CAN_STANDARD_ID((0x400UL + (i * 3U)));
+                s_entries[port][i].layout = &s_routes[i % 4U];
+                s_entries[port][i].mask   = CAN_DISPATCH_MASK_EXACT;
+            }
+
+            s_entries[port][i].handler = NULL;
+        }
+
+        s_ports[port].driver     = &s_drivers[port];
+        s_ports[port].rxObj      = OBJ_RX;
+        s_ports[port].txObj      = OBJ_TX;
+        s_ports[port].txCount    = txCount;
+        s_ports[port].routes     = s_entries[port];
+        s_ports[port].routeCount = GATEWAY_ROUTES;
+        s_ports[port].index      = s_index[port];
+    }
+
+    s_bus[2].fd = 1U;
+
+    TEST_CHECK(ARM_DRIVER_OK == CAN_Gateway_Init(&s_gateway, s_ports, CAN_GATEWAY_PORT_MAX));
+}
+
+static void Test_Routing(void)
+{
+    static const uint8_t payload[8] = { 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U };
+
+    Gateway_Open(1U);
+
+    /* Fan-out to two ports from the one read */
+    Bus_Receive(0U, ARM_CAN_STANDARD_ID(0x101UL), 0U, payload, 8U);
+    TEST_CHECK(1 == CAN_Gateway_Forward(&s_gateway, 0U));
+    TEST_CHECK((1U == s_bus[1].sent) && (1U == s_bus[2].sent) && (0U == s_bus[0].sent));
+    TEST_CHECK((0x101UL == s_bus[1].lastId) && (0x101UL == s_bus[2].lastId));
+    TEST_CHECK(0 == memcmp(payload, s_bus[2].lastData, 8U));
+
+    /* Rewrite to an extended identifier, and of the low nibble only */
+    s_nowNs += 1000000ULL;
+    Bus_Receive(0U, ARM_CAN_STANDARD_ID(0x102UL), 0U, payload, 8U);
+    TEST_CHECK(1 == CAN_Gateway_Forward(&s_gateway, 0U));
+    TEST_CHECK(ARM_CAN_EXTENDED_ID(0x18DAF102UL) == s_bus[1].lastId);
+
+    s_nowNs += 1000000ULL;
+    Bus_Receive(2U, ARM_CAN_STANDARD_ID(0x103UL), 0U, payload, 8U);
+    TEST_CHECK(1 == CAN_Gateway_Forward(&s_gateway, 2U));
+    TEST_CHECK((0x105UL == s_bus[0].lastId) && (0x105UL == s_bus[1].lastId));
+
+    /* The source port is never a destination */
+    s_nowNs += 1000000ULL;
+    Bus_Receive(0U, ARM_CAN_STANDARD_ID(0x103UL), 0U, payload, 8U);
+    TEST_CHECK(1 == CAN_Gateway_Forward(&s_gateway, 0U));
+    TEST_CHECK((1U == s_bus[0].sent) && (4U == s_bus[1].sent));
+
+    /* Masked route, and no route */
+    s_nowNs += 1000000ULL;
+    Bus_Receive(1U, ARM_CAN_EXTENDED_ID(0x18DA0855UL), 0U, payload, 8U);
+    Bus_Receive(1U, ARM_CAN_STANDARD_ID(0x7FFUL), 0U, payload, 8U);
+    TEST_CHECK(2 == CAN_Gateway_Forward(&s_gateway, 1U));
+    TEST_CHECK(ARM_CAN_EXTENDED_ID(0x18DA0855UL) == s_bus[0].lastId);
+    TEST_CHECK(1U == s_gateway.port[1].noRoute);
+
+    /* An FD frame only reaches the FD port */
+    s_nowNs += 1000000ULL;
+    Bus_Receive(2U, ARM_CAN_STANDARD_ID(0x101UL), 1U, payload, 8U);
+    TEST_CHECK(1 == CAN_Gateway_Forward(&s_gateway, 2U));
+    TEST_CHECK(1U == s_gateway.port[1].dropped);
+
+    /* Empty receive object */
+    TEST_CHECK(0 == CAN_Gateway_Forward(&s_gateway, 2U));
+}
+
+static void Test_Scenario(const Gateway_Scenario_t *scenario)
+{
+    uint8_t data[8];
+    uint64_t nextNs[CAN_GATEWAY_PORT_MAX];
+    uint64_t frameNs;
+    uint64_t cpuNs;
+    uint64_t start;
+    uint32_t generated;
+    uint32_t forwarded;
+    uint32_t dropped;
+    uint32_t sent;
+    uint32_t port;
+    uint32_t next;
+    uint32_t i;
+
+    Gateway_Open(scenario->txCount);
+
+    frameNs   = Bus_FrameNs(scenario->routeId, 8U);
+    generated = 0U;
+    cpuNs     = 0U;
+
+    for (port = 0U; port < CAN_GATEWAY_PORT_MAX; port++)
+    {
+        /* Offset the sources so their frames do not end at the same instant */
+        nextNs[port] = frameNs + (port * (frameNs / 3U));
+    }
+
+    /* Back-to-back frames on every source bus: 100 % load */
+    for (i = 0U; i < GATEWAY_FRAMES; i++)
+    {
+        next = CAN_GATEWAY_PORT_MAX;
+
+        for (port = 0U; port < CAN_GATEWAY_PORT_MAX; port++)
+        {
+            if ((0U != (scenario->sources & CAN_GATEWAY_PORT(port))) &&
+                ((CAN_GATEWAY_PORT_MAX == next) || (nextNs[port] < nextNs[next])))
+            {
+                next = port;
+            }
+            else
+            {
+                /* Not a source, or later */
+            }
+        }
+
+        s_nowNs       = nextNs[next];
+        nextNs[next] += frameNs;
+
+        (void)memset(data, (int)i, sizeof(data));
+        Bus_Receive((uint8_t)next, ARM_CAN_STANDARD_ID(scenario->routeId), 0U, data, 8U);
+        generated++;
+
+        start  = Test_Nanoseconds();
+        (void)CAN_Gateway_Forward(&s_gateway, (uint8_t)next);
+        cpuNs += Test_Nanoseconds() - start;
+    }
+
+    forwarded = 0U;
+    dropped   = 0U;
+    sent      = 0U;
+
+    for (port = 0U; port < CAN_GATEWAY_PORT_MAX; port++)
+    {
+        forwarded += s_gateway.port[port].forwarded;
+        dropped   += s_gateway.port[port].dropped;
+        sent      += s_bus[port].sent;
+        TEST_CHECK(0U == s_bus[port].rxLost);
+    }
+
+    TEST_CHECK(sent == forwarded);
+
+    (void)printf("%s %2u TX  %6u fwd %6u drop  latency %6.1f / %6.1f us  %7.0f frames/s  cpu %5.0f ns/frame\n",
+                 scenario->name, (unsigned)scenario->txCount, (unsigned)forwarded, (unsigned)dropped,
+                 (double)s_bus[1].latencySumNs / ((double)s_bus[1].sent * 1e3), (double)s_bus[1].latencyMaxNs / 1e3,
+                 ((double)s_bus[1].sent * 1e9) / (double)s_bus[1].busFreeNs, (double)cpuNs / (double)generated);
+
+    /* Port 1 runs the route at its bus capacity: lossless while that is at least the source rate */
+    if (0U == (scenario->sources & CAN_GATEWAY_PORT(2U)) && (0x102UL != scenario->routeId))
+    {
+        TEST_CHECK(0U == dropped);
+        TEST_CHECK(frameNs == s_bus[1].latencyMaxNs);
+    }
+    else
+    {
+        TEST_CHECK(0U != dropped);
+        TEST_CHECK((forwarded + dropped) == generated);
+        TEST_CHECK(s_bus[1].busFreeNs <= (s_nowNs + (scenario->txCount * Bus_FrameNs(s_bus[1].lastId, 8U))));
+    }
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    Test_Routing();
+
+    for (i = 0U; i < (sizeof(s_scenarios) / sizeof(s_scenarios[0])); i++)
+    {
+        Test_Scenario(&s_scenarios[i]);
+    }
+
+    return Test_Report("Test_Gateway");
+}
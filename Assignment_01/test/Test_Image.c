@@ -0,0 +1,316 @@
+/*******************************************************************************
+ * @file    Test_Image.c
+ * @brief   Flash image check on the CRC model C file.
+ *
+ * A static buffer stands in for the flash and the test defines the
+ * descriptor the linker script would, sealed with the CRC-32 tables as
+ * tools/Image_Seal does. The DWT registers are backed by pages mapped at
+ * their addresses. Built twice (Makefile): the default build, where an
+ * unsealed range or an empty descriptor fails the image, and a build with
+ * IMAGE_VERIFY_ALLOW_UNSEALED set, where they run as unsealed.
+ *
+ * The report (default build) gives the verification time per KB of the
+ * boot and idle paths, and of one call, in target cycles of the CRC model
+ * (one register access per word fed) as Test_Crc does for the engine.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "HAL_SCG.h"
+#include "HAL_DWT.h"
+#include "CRC_Engine.h"
+#include "Image_Verify.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE     (0x100000)
+#endif
+
+#define DWT_PAGE                (0xE0001000UL)      /**< DWT_CTRL, DWT_CYCCNT */
+#define DEMCR_PAGE              (0xE000E000UL)      /**< DEMCR                */
+#define PAGE_SIZE               (4096UL)
+
+#define FLASH_SIZE              (8192U)
+#define HOT_SIZE                (256U)
+#define DEFERRED_START          (2U * HOT_SIZE)
+#define DEFERRED_SIZE           (FLASH_SIZE - DEFERRED_START)
+#define DEFERRED_STEPS          ((DEFERRED_SIZE + IMAGE_VERIFY_STEP - 1U) / IMAGE_VERIFY_STEP)
+
+#define TIMING_RUNS             (10U)
+#define CORE_MHZ                (HAL_SCG_SYS_CLK_HZ / 1000000UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Read by Image_Verify as the linker script symbol */
+Image_Descriptor_t __image_info__;
+
+static uint8_t s_flash[FLASH_SIZE] __attribute__((aligned(4)));
+static uint8_t s_other[4096] __attribute__((aligned(4)));
+static CRC_Table_t s_crc32;
+
+static volatile uint32_t s_callbacks;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint8_t Map_Page(uint32_t address)
+{
+    void *page;
+
+    page = mmap(FAKE_PTR(address), PAGE_SIZE, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+
+    return (FAKE_PTR(address) == page) ? 1U : 0U;
+}
+
+static void Dma_Callback(int32_t status, uint32_t crc)
+{
+    (void)status;
+    (void)crc;
+
+    s_callbacks++;
+}
+
+/* Two hot ranges and a deferred one, sealed. */
+static void Image_Build(void)
+{
+    static const uint32_t start[3] = { 0U, HOT_SIZE, DEFERRED_START };
+    static const uint32_t size[3]  = { HOT_SIZE, HOT_SIZE, DEFERRED_SIZE };
+    static const uint32_t flags[3] = { IMAGE_VERIFY_FLAG_HOT, IMAGE_VERIFY_FLAG_HOT, 0U };
+    uint32_t i;
+
+    for (i = 0U; i < FLASH_SIZE; i++)
+    {
+        s_flash[i] = (uint8_t)((i * 131U) + (i >> 8));
+    }
+
+    __image_info__.magic = IMAGE_VERIFY_MAGIC;
+    __image_info__.count = 3U;
+
+    for (i = 0U; i < 3U; i++)
+    {
+        __image_info__.range[i].start = (uint32_t)(uintptr_t)&s_flash[start[i]];
+        __image_info__.range[i].size  = size[i];
+        __image_info__.range[i].crc   = CRC_Soft_Compute(&s_crc32, &s_flash[start[i]], size[i]);
+        __image_info__.range[i].flags = flags[i];
+    }
+}
+
+/* Idle calls until the deferred ranges are done, the last one included. */
+static uint32_t Image_RunIdle(void)
+{
+    uint32_t calls;
+
+    calls = 1U;
+
+    while ((0U != Image_Verify_Idle()) && (calls < 1000U))
+    {
+        calls++;
+    }
+
+    return calls;
+}
+
+static void Test_Sealed(void)
+{
+    Image_VerifyStats_t stats;
+
+    Image_Build();
+    HAL_DWT_DEMCR = 0U;
+    HAL_DWT_CTRL  = 0U;
+    Image_Verify_Boot();
+
+    /* The counter only runs with the DWT unit powered */
+    TEST_CHECK(0U != (HAL_DWT_DEMCR & HAL_DWT_DEMCR_TRCENA));
+    TEST_CHECK(0U != (HAL_DWT_CTRL & HAL_DWT_CTRL_CYCCNTENA));
+    TEST_CHECK(IMAGE_VERIFY_STATUS_PENDING == Image_Verify_GetStatus());
+    TEST_CHECK(DEFERRED_SIZE == Image_Verify_GetRemaining());
+
+    /* A DMA feed holds the CRC module: the idle check waits */
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Start(&s_crc32.config));
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_UpdateDma(s_other, sizeof(s_other), Dma_Callback));
+    TEST_CHECK(1U == Image_Verify_Idle());
+    TEST_CHECK(DEFERRED_SIZE == Image_Verify_GetRemaining());
+    (void)Fake_CRC_RunDma();
+    TEST_CHECK(1U == s_callbacks);
+
+    /* Other CRC users between steps leave the checkpoint intact */
+    TEST_CHECK(1U == Image_Verify_Idle());
+    TEST_CHECK(ARM_DRIVER_OK == CRC_Engine_Check(&s_crc32, s_other, 100U));
+
+    TEST_CHECK((DEFERRED_STEPS - 1U) == Image_RunIdle());
+    TEST_CHECK(IMAGE_VERIFY_STATUS_OK == Image_Verify_GetStatus());
+    TEST_CHECK(0U == Image_Verify_GetRemaining());
+    TEST_CHECK(0U == Image_Verify_Idle());
+
+    Image_Verify_GetStats(&stats);
+    TEST_CHECK((2U * HOT_SIZE) == stats.bootBytes);
+    TEST_CHECK(DEFERRED_SIZE == stats.idleBytes);
+    TEST_CHECK(IMAGE_VERIFY_RANGE_MAX == stats.failedRange);
+}
+
+static void Test_Corrupt(void)
+{
+    Image_VerifyStats_t stats;
+
+    /* A hot range fails at boot */
+    Image_Build();
+    s_flash[HOT_SIZE + 17U] ^= 0x04U;
+    Image_Verify_Boot();
+    Image_Verify_GetStats(&stats);
+    TEST_CHECK(IMAGE_VERIFY_STATUS_CORRUPT == Image_Verify_GetStatus());
+    TEST_CHECK(1U == stats.failedRange);
+
+    /* A deferred range fails in the idle loop */
+    Image_Build();
+    s_flash[FLASH_SIZE - 1U] ^= 0x80U;
+    Image_Verify_Boot();
+    TEST_CHECK(IMAGE_VERIFY_STATUS_PENDING == Image_Verify_GetStatus());
+    (void)Image_RunIdle();
+    Image_Verify_GetStats(&stats);
+    TEST_CHECK(IMAGE_VERIFY_STATUS_CORRUPT == Image_Verify_GetStatus());
+    TEST_CHECK(2U == stats.failedRange);
+
+    /* Bad descriptor */
+    Image_Build();
+    __image_info__.magic = 0U;
+    Image_Verify_Boot();
+    TEST_CHECK(IMAGE_VERIFY_STATUS_INVALID == Image_Verify_GetStatus());
+    TEST_CHECK(0U == Image_Verify_Idle());
+
+    Image_Build();
+    __image_info__.count = IMAGE_VERIFY_RANGE_MAX + 1U;
+    Image_Verify_Boot();
+    TEST_CHECK(IMAGE_VERIFY_STATUS_INVALID == Image_Verify_GetStatus());
+}
+
+static void Test_Unsealed(void)
+{
+    Image_VerifyStats_t stats;
+
+    /* Link output not run through the sealing tool */
+    Image_Build();
+    __image_info__.range[2].crc = IMAGE_VERIFY_CRC_UNSET;
+    Image_Verify_Boot();
+    (void)Image_RunIdle();
+    Image_Verify_GetStats(&stats);
+
+#if (0U != IMAGE_VERIFY_ALLOW_UNSEALED)
+    TEST_CHECK(IMAGE_VERIFY_STATUS_UNSEALED == Image_Verify_GetStatus());
+    TEST_CHECK(IMAGE_VERIFY_RANGE_MAX == stats.failedRange);
+#else
+    TEST_CHECK(IMAGE_VERIFY_STATUS_CORRUPT == Image_Verify_GetStatus());
+    TEST_CHECK(2U == stats.failedRange);
+#endif
+
+    /* A sealed range that does not match still fails */
+    Image_Build();
+    __image_info__.range[2].crc = IMAGE_VERIFY_CRC_UNSET;
+    s_flash[0] ^= 0x01U;
+    Image_Verify_Boot();
+    TEST_CHECK(IMAGE_VERIFY_STATUS_CORRUPT == Image_Verify_GetStatus());
+
+    /* Empty descriptor of a RAM build */
+    Image_Build();
+    __image_info__.count = 0U;
+    Image_Verify_Boot();
+
+#if (0U != IMAGE_VERIFY_ALLOW_UNSEALED)
+    TEST_CHECK(IMAGE_VERIFY_STATUS_UNSEALED == Image_Verify_GetStatus());
+#else
+    TEST_CHECK(IMAGE_VERIFY_STATUS_INVALID == Image_Verify_GetStatus());
+#endif
+}
+
+#if (0U == IMAGE_VERIFY_ALLOW_UNSEALED)
+
+static void Timing_Report(const char *name, uint32_t bytes, uint32_t calls, uint32_t writes)
+{
+    double cycles;
+
+    /* One run: a register access per word fed */
+    cycles = ((double)writes * FAKE_FIFO_ACCESS_CYCLES) / TIMING_RUNS;
+
+    (void)printf("%s %5u  %5u   %6.3f  %9.0f  %7.1f  %8.1f\n", name, (unsigned)bytes, (unsigned)calls,
+                 (double)bytes / cycles, (cycles * 1024.0) / bytes, ((cycles * 1024.0) / bytes) / CORE_MHZ,
+                 (cycles / calls) / CORE_MHZ);
+}
+
+/* Boot stage over the hot ranges, idle calls over the deferred one */
+static void Test_Timing(void)
+{
+    Image_VerifyStats_t stats;
+    uint32_t cpuBoot;
+    uint32_t cpuIdle;
+    uint32_t cpuEnd;
+    uint32_t dmaWrites;
+    uint32_t bootWrites;
+    uint32_t idleWrites;
+    uint32_t calls;
+    uint32_t i;
+
+    Image_Build();
+
+    bootWrites = 0U;
+    idleWrites = 0U;
+    calls      = 0U;
+
+    for (i = 0U; i < TIMING_RUNS; i++)
+    {
+        Fake_CRC_GetWrites(&cpuBoot, &dmaWrites);
+        Image_Verify_Boot();
+        Fake_CRC_GetWrites(&cpuIdle, &dmaWrites);
+        calls = Image_RunIdle();
+        Fake_CRC_GetWrites(&cpuEnd, &dmaWrites);
+
+        bootWrites += cpuIdle - cpuBoot;
+        idleWrites += cpuEnd - cpuIdle;
+    }
+
+    Image_Verify_GetStats(&stats);
+    TEST_CHECK(IMAGE_VERIFY_STATUS_OK == Image_Verify_GetStatus());
+    TEST_CHECK(DEFERRED_STEPS == calls);
+    TEST_CHECK((0U != bootWrites) && (0U != idleWrites));
+
+    (void)printf("                                        target (model, %u MHz)\n", (unsigned)CORE_MHZ);
+    (void)printf("path                 bytes  calls  bytes/cycle  cycles/KB  us/KB   us/call\n");
+    Timing_Report("boot (hot ranges)  ", stats.bootBytes, 1U, bootWrites);
+    Timing_Report("idle (deferred)    ", stats.idleBytes, calls, idleWrites);
+}
+
+#endif
+
+int main(void)
+{
+    static const CRC_Config_t crc32 = CRC_CONFIG_CRC32;
+
+    TEST_CHECK(0U != Map_Page(DWT_PAGE));
+    TEST_CHECK(0U != Map_Page(DEMCR_PAGE));
+    TEST_CHECK(0 == CRC_Soft_Init(&s_crc32, &crc32));
+    Fake_DMA_Reset();
+
+    /* Nothing to check before the boot stage ran */
+    TEST_CHECK(0U == Image_Verify_Idle());
+    TEST_CHECK(IMAGE_VERIFY_STATUS_PENDING == Image_Verify_GetStatus());
+
+    Test_Sealed();
+    Test_Corrupt();
+    Test_Unsealed();
+
+#if (0U == IMAGE_VERIFY_ALLOW_UNSEALED)
+    Test_Timing();
+#endif
+
+    return Test_Report((0U != IMAGE_VERIFY_ALLOW_UNSEALED) ? "Test_Image (unsealed allowed)" : "Test_Image");
+}
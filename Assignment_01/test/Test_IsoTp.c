@@ -0,0 +1,364 @@
+/*******************************************************************************
+ * @file    Test_IsoTp.c
+ * @brief   ISO-TP channels over a simulated CAN bus C file.
+ *
+ * Two channels talk through a stand-in ARM_DRIVER_CAN: each TX object holds
+ * one frame, which occupies the bus for its bit time (unstuffed, 500 kbit/s
+ * nominal, 2 Mbit/s data phase) and then lands in the RX object of the
+ * other node. Time is simulated, so the report gives the throughput the
+ * protocol reaches on a real bus for each configuration. A malformed frame
+ * injector checks the single frame length rules.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "CAN_IsoTp.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define BUS_OBJECTS             (4U)        /**< 0 = A tx, 1 = A rx, 2 = B tx, 3 = B rx */
+#define BUS_NOMINAL_NS          (2000U)     /**< 500 kbit/s */
+#define BUS_DATA_NS             (500U)      /**< 2 Mbit/s */
+#define BUS_IDLE_STEP_NS        (10000U)    /**< Poll period while the bus is idle */
+#define BUS_LIMIT_NS            (60000000000ULL)
+
+#define ID_A                    (0x7E0UL)
+#define ID_B                    (0x7E8UL)
+
+#define MESSAGE_MAX             (66000UL)
+
+typedef struct
+{
+    uint8_t     pending;
+    uint8_t     edl;
+    uint8_t     brs;
+    uint8_t     size;
+    uint64_t    doneNs;
+    uint8_t     data[CAN_ISOTP_FRAME_MAX];
+} Bus_Object_t;
+
+typedef struct
+{
+    const char  *name;
+    uint8_t     frameSize;
+    uint8_t     brs;
+    uint8_t     blockSize;
+    uint8_t     stMin;
+} Link_Config_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static Bus_Object_t s_objects[BUS_OBJECTS];
+static uint64_t s_nowNs;
+static uint64_t s_busFreeNs;
+static uint64_t s_busyNs;
+static uint32_t s_frames;
+
+static CAN_IsoTp_Channel_t s_channelA;
+static CAN_IsoTp_Channel_t s_channelB;
+static CAN_IsoTp_Config_t s_configA;
+static CAN_IsoTp_Config_t s_configB;
+
+static uint32_t s_eventsA;
+static uint32_t s_eventsB;
+static uint32_t s_lengthB;
+
+static uint8_t s_txMessage[MESSAGE_MAX];
+static uint8_t s_rxMessage[MESSAGE_MAX];
+
+static const Link_Config_t s_links[] =
+{
+    { "classic BS0      ",  8U, 0U, 0U, 0x00U },
+    { "classic BS8      ",  8U, 0U, 8U, 0x00U },
+    { "classic STmin300 ",  8U, 0U, 0U, 0xF3U },
+    { "FD12 BRS         ", 12U, 1U, 0U, 0x00U },
+    { "FD64 BRS         ", 64U, 1U, 0U, 0x00U },
+    { "FD64 BRS BS8     ", 64U, 1U, 8U, 0x00U },
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Frame time without stuff bits: classic 47 + 8n, FD arbitration and data phase */
+static uint64_t Bus_FrameNs(uint8_t edl, uint8_t brs, uint8_t size)
+{
+    uint32_t dataBits;
+    uint64_t ns;
+
+    if (0U == edl)
+    {
+        ns = (47ULL + (8ULL * size)) * BUS_NOMINAL_NS;
+    }
+    else
+    {
+        /* ESI, DLC, data, stuff count, CRC, CRC delimiter */
+        dataBits = 1U + 4U + (8U * size) + 4U + ((size > 16U) ? 21U : 17U) + 1U;
+        ns       = (29ULL * BUS_NOMINAL_NS) + ((uint64_t)dataBits * ((0U != brs) ? BUS_DATA_NS : BUS_NOMINAL_NS));
+    }
+
+    return ns;
+}
+
+static int32_t Bus_MessageSend(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size)
+{
+    Bus_Object_t *object;
+    uint64_t start;
+    int32_t result;
+
+    result = size;
+
+    if ((obj_idx >= BUS_OBJECTS) || (0U != (obj_idx & 1U)) || (size > CAN_ISOTP_FRAME_MAX))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U != s_objects[obj_idx].pending)
+    {
+        result = ARM_DRIVER_ERROR_BUSY;
+    }
+    else
+    {
+        object = &s_objects[obj_idx];
+        start  = (s_busFreeNs > s_nowNs) ? s_busFreeNs : s_nowNs;
+
+        object->pending = 1U;
+        object->edl     = (uint8_t)msg_info->edl;
+        object->brs     = (uint8_t)msg_info->brs;
+        object->size    = size;
+        object->doneNs  = start + Bus_FrameNs(object->edl, object->brs, size);
+        (void)memcpy(object->data, data, size);
+
+        s_busyNs   += object->doneNs - start;
+        s_busFreeNs = object->doneNs;
+    }
+
+    return result;
+}
+
+static int32_t Bus_MessageRead(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, uint8_t *data, uint8_t size)
+{
+    Bus_Object_t *object;
+    int32_t result;
+
+    object = &s_objects[obj_idx & (BUS_OBJECTS - 1U)];
+
+    if ((obj_idx >= BUS_OBJECTS) || (0U == (obj_idx & 1U)))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else if (0U == object->pending)
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        result = (object->size < size) ? object->size : size;
+
+        msg_info->id  = (1U == obj_idx) ? ID_B : ID_A;
+        msg_info->edl = object->edl;
+        msg_info->brs = object->brs;
+        msg_info->dlc = (uint32_t)result;
+        (void)memcpy(data, object->data, (size_t)result);
+
+        object->pending = 0U;
+    }
+
+    return result;
+}
+
+static ARM_DRIVER_CAN s_bus =
+{
+    .MessageSend = Bus_MessageSend,
+    .MessageRead = Bus_MessageRead,
+};
+
+static uint32_t Bus_TimeUs(void)
+{
+    return (uint32_t)(s_nowNs / 1000ULL);
+}
+
+static void Bus_Event(uint32_t obj_idx, uint32_t event)
+{
+    CAN_IsoTp_OnObjectEvent(&s_channelA, obj_idx, event);
+    CAN_IsoTp_OnObjectEvent(&s_channelB, obj_idx, event);
+}
+
+/* Put a frame into the RX object of a node, as if the other node had sent it. */
+static void Bus_Inject(uint32_t obj_idx, const uint8_t *data, uint8_t size)
+{
+    s_objects[obj_idx].pending = 1U;
+    s_objects[obj_idx].edl     = (size > 8U) ? 1U : 0U;
+    s_objects[obj_idx].brs     = 0U;
+    s_objects[obj_idx].size    = size;
+    (void)memcpy(s_objects[obj_idx].data, data, size);
+
+    Bus_Event(obj_idx, ARM_CAN_EVENT_RECEIVE);
+}
+
+/* Advance to the next end of frame, or one poll period when the bus is idle. */
+static void Bus_Step(void)
+{
+    Bus_Object_t *object;
+    uint32_t next;
+    uint32_t i;
+
+    next = BUS_OBJECTS;
+
+    for (i = 0U; i < BUS_OBJECTS; i += 2U)
+    {
+        if ((0U != s_objects[i].pending) &&
+            ((BUS_OBJECTS == next) || (s_objects[i].doneNs < s_objects[next].doneNs)))
+        {
+            next = i;
+        }
+        else
+        {
+            /* Idle or later */
+        }
+    }
+
+    if (BUS_OBJECTS != next)
+    {
+        object  = &s_objects[next];
+        s_nowNs = object->doneNs;
+        s_frames++;
+
+        /* A tx (0) lands in B rx (3), B tx (2) in A rx (1) */
+        object->pending = 0U;
+        Bus_Inject((0U == next) ? 3U : 1U, object->data, object->size);
+        Bus_Event(next, ARM_CAN_EVENT_SEND_COMPLETE);
+    }
+    else
+    {
+        s_nowNs += BUS_IDLE_STEP_NS;
+    }
+
+    CAN_IsoTp_Poll(&s_channelA);
+    CAN_IsoTp_Poll(&s_channelB);
+}
+
+static void Callback(CAN_IsoTp_Channel_t *channel, uint32_t event, uint32_t length)
+{
+    if (&s_channelA == channel)
+    {
+        s_eventsA |= event;
+    }
+    else
+    {
+        s_eventsB |= event;
+        s_lengthB  = length;
+    }
+}
+
+static void Link_Open(const Link_Config_t *link)
+{
+    (void)memset(s_objects, 0, sizeof(s_objects));
+    s_nowNs     = 0U;
+    s_busFreeNs = 0U;
+    s_busyNs    = 0U;
+    s_frames    = 0U;
+    s_eventsA   = 0U;
+    s_eventsB   = 0U;
+    s_lengthB   = 0U;
+
+    s_configA.driver    = &s_bus;
+    s_configA.txObj     = 0U;
+    s_configA.rxObj     = 1U;
+    s_configA.txId      = ARM_CAN_STANDARD_ID(ID_A);
+    s_configA.frameSize = link->frameSize;
+    s_configA.brs       = link->brs;
+    s_configA.blockSize = link->blockSize;
+    s_configA.stMin     = link->stMin;
+    s_configA.padding   = 0xCCU;
+    s_configA.timeoutUs = 1000000UL;
+    s_configA.timeUs    = Bus_TimeUs;
+    s_configA.callback  = Callback;
+
+    s_configB       = s_configA;
+    s_configB.txObj = 2U;
+    s_configB.rxObj = 3U;
+    s_configB.txId  = ARM_CAN_STANDARD_ID(ID_B);
+
+    TEST_CHECK(ARM_DRIVER_OK == CAN_IsoTp_Init(&s_channelA, &s_configA));
+    TEST_CHECK(ARM_DRIVER_OK == CAN_IsoTp_Init(&s_channelB, &s_configB));
+    CAN_IsoTp_SetRxBuffer(&s_channelB, s_rxMessage, MESSAGE_MAX);
+}
+
+static void Test_Transfer(const Link_Config_t *link, uint32_t length)
+{
+    uint32_t i;
+
+    Link_Open(link);
+
+    for (i = 0U; i < length; i++)
+    {
+        s_txMessage[i] = (uint8_t)((i * 131U) + (i >> 8));
+    }
+    (void)memset(s_rxMessage, 0, length);
+
+    TEST_CHECK(ARM_DRIVER_OK == CAN_IsoTp_Send(&s_channelA, s_txMessage, length));
+
+    while ((0U == (s_eventsA & (CAN_ISOTP_EVENT_TX_DONE | CAN_ISOTP_EVENT_TX_ERROR))) && (s_nowNs < BUS_LIMIT_NS))
+    {
+        Bus_Step();
+    }
+
+    TEST_CHECK(CAN_ISOTP_EVENT_TX_DONE == s_eventsA);
+    TEST_CHECK(CAN_ISOTP_EVENT_RX_DONE == s_eventsB);
+    TEST_CHECK(length == s_lengthB);
+    TEST_CHECK(0 == memcmp(s_txMessage, s_rxMessage, length));
+
+    (void)printf("%s %6u B  %5u frames  %9.2f ms  %7.1f kB/s  bus load %5.1f %%\n", link->name,
+                 (unsigned)length, (unsigned)s_frames, (double)s_nowNs / 1e6,
+                 ((double)length * 1e6) / (double)s_nowNs, (100.0 * (double)s_busyNs) / (double)s_nowNs);
+}
+
+static void Test_SingleFrame(void)
+{
+    static const uint8_t classicLong[8]  = { 0x08U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
+    static const uint8_t classicSeven[8] = { 0x07U, 1U, 2U, 3U, 4U, 5U, 6U, 7U };
+    static const uint8_t fdNibble[12]    = { 0x05U, 1U, 2U, 3U, 4U, 5U, 0xCCU, 0xCCU, 0xCCU, 0xCCU, 0xCCU, 0xCCU };
+    static const uint8_t fdEscape[12]    = { 0x00U, 10U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U };
+
+    /* Classic channel: SF_DL 8 does not exist */
+    Link_Open(&s_links[0]);
+    Bus_Inject(3U, classicLong, sizeof(classicLong));
+    TEST_CHECK(0U == s_eventsB);
+
+    Bus_Inject(3U, classicSeven, sizeof(classicSeven));
+    TEST_CHECK(CAN_ISOTP_EVENT_RX_DONE == s_eventsB);
+    TEST_CHECK(7U == s_lengthB);
+    TEST_CHECK(0 == memcmp(&classicSeven[1], s_rxMessage, 7U));
+
+    /* FD channel: a frame over 8 bytes must use the escaped length */
+    Link_Open(&s_links[3]);
+    Bus_Inject(3U, fdNibble, sizeof(fdNibble));
+    TEST_CHECK(0U == s_eventsB);
+
+    Bus_Inject(3U, fdEscape, sizeof(fdEscape));
+    TEST_CHECK(CAN_ISOTP_EVENT_RX_DONE == s_eventsB);
+    TEST_CHECK(10U == s_lengthB);
+    TEST_CHECK(0 == memcmp(&fdEscape[2], s_rxMessage, 10U));
+}
+
+int main(void)
+{
+    uint32_t i;
+
+    Test_SingleFrame();
+
+    for (i = 0U; i < (sizeof(s_links) / sizeof(s_links[0])); i++)
+    {
+        Test_Transfer(&s_links[i], 4095UL);
+        Test_Transfer(&s_links[i], MESSAGE_MAX);
+    }
+
+    return Test_Report("Test_IsoTp");
+}
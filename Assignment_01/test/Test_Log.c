@@ -0,0 +1,670 @@
+/*******************************************************************************
+ * @file    Test_Log.c
+ * @brief   Log-structured key/value store on a flash model C file.
+ *
+ * The flash stand-in refuses a second program of a phrase between erases,
+ * as the FTFC does, and can cut the power at any step: the phrase being
+ * programmed is left half written (or the sector being erased half
+ * erased) and every later access fails until the next mount. Covers
+ * append, lookup, delete and compaction against a RAM model, records torn
+ * by a reset, and a reset at each step of a compaction. The report gives
+ * the time NVM_Log_Init() takes to rebuild the index for 1k, 10k and 50k
+ * records.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "NVM_Log.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FLASH_BASE              (HAL_FTFC_DFLASH_BASE)
+#define FLASH_PHRASE            (8U)
+#define FLASH_SIZE              (0x00200000UL)      /**< 32 sectors of 64 KB for the rebuild timing */
+#define FLASH_PHRASES           (FLASH_SIZE / FLASH_PHRASE)
+
+#define SMALL_SECTOR            (HAL_FTFC_DFLASH_SECTOR)
+#define LARGE_SECTOR            (0x00010000UL)
+
+/* How a phrase cut short is left */
+#define TEAR_FIRST_WORD         (0U)                /**< First word programmed, second still erased */
+#define TEAR_PARTIAL            (1U)                /**< Every byte partly programmed */
+
+#define INDEX_SIZE              (2048U)
+#define MODEL_KEYS              (128U)
+
+/* Power cut scenarios: 2 sectors of 16 byte records, 127 per sector */
+#define CUT_SECTOR_RECORDS      ((SMALL_SECTOR - 16U) / 16U)
+#define SNAPSHOT_SIZE           (2U * SMALL_SECTOR)
+
+#define REBUILD_KEYS            (1024U)
+#define REBUILD_RUNS            (5U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint8_t s_flash[FLASH_SIZE];
+static uint32_t s_programmed[FLASH_PHRASES / 32U];  /**< Phrases programmed since their erase */
+static uint32_t s_steps;                            /**< Phrases programmed and sectors erased */
+static uint32_t s_cutStep;                          /**< Step the power fails on, 0 = never */
+static uint8_t s_tear;
+static uint8_t s_powerLost;
+static uint32_t s_reprograms;                       /**< Refused second programs */
+static uint32_t s_seed;
+
+static uint8_t s_snapshot[SNAPSHOT_SIZE];
+static uint32_t s_snapshotProgrammed[SNAPSHOT_SIZE / FLASH_PHRASE / 32U];
+
+static NVM_LogEntry_t s_index[INDEX_SIZE];
+
+/* Expected contents: version 0 = not stored */
+static uint16_t s_version[MODEL_KEYS];
+static uint16_t s_size[MODEL_KEYS];
+
+/*******************************************************************************
+ * Flash stand-in
+ ******************************************************************************/
+
+static struct _ARM_FLASH_INFO s_flashInfo =
+{
+    NULL, FLASH_SIZE / SMALL_SECTOR, SMALL_SECTOR, FLASH_PHRASE, FLASH_PHRASE, 0xFFU, { 0U, 0U, 0U }
+};
+
+static int32_t Flash_ReadData(uint32_t addr, void *data, uint32_t cnt)
+{
+    int32_t result;
+
+    if (0U != s_powerLost)
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        (void)memcpy(data, &s_flash[addr - FLASH_BASE], cnt);
+        result = (int32_t)cnt;
+    }
+
+    return result;
+}
+
+static int32_t Flash_ProgramData(uint32_t addr, const void *data, uint32_t cnt)
+{
+    int32_t result;
+    const uint8_t *src;
+    uint8_t *dst;
+    uint32_t phrase;
+    uint32_t p;
+    uint32_t i;
+
+    result = (int32_t)cnt;
+
+    if (0U != s_powerLost)
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else if ((0U != (addr % FLASH_PHRASE)) || (0U != (cnt % FLASH_PHRASE)) || (0U == cnt))
+    {
+        result = ARM_DRIVER_ERROR_PARAMETER;
+    }
+    else
+    {
+        /* Phrase by phrase, in order, as the driver launches them */
+        for (p = 0U; (0U == s_powerLost) && (p < (cnt / FLASH_PHRASE)); p++)
+        {
+            src    = (const uint8_t *)data + (p * FLASH_PHRASE);
+            dst    = &s_flash[(addr - FLASH_BASE) + (p * FLASH_PHRASE)];
+            phrase = ((addr - FLASH_BASE) / FLASH_PHRASE) + p;
+
+            s_steps++;
+
+            if (0U != (s_programmed[phrase / 32U] & (1UL << (phrase % 32U))))
+            {
+                s_reprograms++;
+                result = ARM_DRIVER_ERROR;
+            }
+            else if (s_steps == s_cutStep)
+            {
+                for (i = 0U; i < FLASH_PHRASE; i++)
+                {
+                    dst[i] = (TEAR_FIRST_WORD == s_tear) ? ((i < 4U) ? src[i] : 0xFFU) : (uint8_t)(src[i] | 0x0FU);
+                }
+
+                s_programmed[phrase / 32U] |= 1UL << (phrase % 32U);
+                s_powerLost = 1U;
+                result      = ARM_DRIVER_ERROR;
+            }
+            else
+            {
+                s_programmed[phrase / 32U] |= 1UL << (phrase % 32U);
+                (void)memcpy(dst, src, FLASH_PHRASE);
+            }
+        }
+    }
+
+    return result;
+}
+
+static int32_t Flash_EraseSector(uint32_t addr)
+{
+    int32_t result;
+    uint32_t size;
+    uint32_t p;
+
+    result = ARM_DRIVER_OK;
+    size   = s_flashInfo.sector_size;
+
+    if (0U != s_powerLost)
+    {
+        result = ARM_DRIVER_ERROR;
+    }
+    else
+    {
+        s_steps++;
+
+        if (s_steps == s_cutStep)
+        {
+            /* Cut short: the start of the sector is erased, the rest is not */
+            size        = size / 2U;
+            s_powerLost = 1U;
+            result      = ARM_DRIVER_ERROR;
+        }
+        else
+        {
+            /* Full erase */
+        }
+
+        (void)memset(&s_flash[addr - FLASH_BASE], 0xFF, size);
+
+        for (p = (addr - FLASH_BASE) / FLASH_PHRASE; p < (((addr - FLASH_BASE) + size) / FLASH_PHRASE); p++)
+        {
+            s_programmed[p / 32U] &= ~(1UL << (p % 32U));
+        }
+    }
+
+    return result;
+}
+
+static ARM_FLASH_STATUS Flash_GetStatus(void)
+{
+    ARM_FLASH_STATUS status;
+
+    (void)memset(&status, 0, sizeof(status));
+
+    return status;
+}
+
+static ARM_FLASH_INFO *Flash_GetInfo(void)
+{
+    return &s_flashInfo;
+}
+
+static ARM_DRIVER_FLASH s_driver =
+{
+    .ReadData    = Flash_ReadData,
+    .ProgramData = Flash_ProgramData,
+    .EraseSector = Flash_EraseSector,
+    .GetStatus   = Flash_GetStatus,
+    .GetInfo     = Flash_GetInfo,
+};
+
+/* Erased flash of sectorSize sectors, power on */
+static void Flash_Setup(uint32_t sectorSize)
+{
+    (void)memset(s_flash, 0xFF, sizeof(s_flash));
+    (void)memset(s_programmed, 0, sizeof(s_programmed));
+    (void)memset(s_version, 0, sizeof(s_version));
+
+    s_flashInfo.sector_size  = sectorSize;
+    s_flashInfo.sector_count = FLASH_SIZE / sectorSize;
+
+    s_steps      = 0U;
+    s_cutStep    = 0U;
+    s_powerLost  = 0U;
+    s_reprograms = 0U;
+}
+
+/* Power back after a cut */
+static void Flash_Reboot(void)
+{
+    s_cutStep   = 0U;
+    s_powerLost = 0U;
+}
+
+static void Flash_Save(void)
+{
+    (void)memcpy(s_snapshot, s_flash, sizeof(s_snapshot));
+    (void)memcpy(s_snapshotProgrammed, s_programmed, sizeof(s_snapshotProgrammed));
+}
+
+static void Flash_Restore(void)
+{
+    (void)memcpy(s_flash, s_snapshot, sizeof(s_snapshot));
+    (void)memcpy(s_programmed, s_snapshotProgrammed, sizeof(s_snapshotProgrammed));
+}
+
+static uint32_t Random(void)
+{
+    s_seed = (s_seed * 1103515245UL) + 12345UL;
+
+    return s_seed >> 16;
+}
+
+/*******************************************************************************
+ * Model
+ ******************************************************************************/
+
+static void Value_Fill(uint8_t *value, uint16_t key, uint16_t version, uint16_t size)
+{
+    uint16_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        value[i] = (uint8_t)((key * 7U) + (version * 13U) + i);
+    }
+}
+
+static int32_t Model_Put(NVM_Log_t *log, uint16_t key, uint16_t version, uint16_t size)
+{
+    uint8_t value[NVM_LOG_VALUE_MAX];
+    int32_t result;
+
+    Value_Fill(value, key, version, size);
+    result = NVM_Log_Put(log, key, value, size);
+
+    if (ARM_DRIVER_OK == result)
+    {
+        s_version[key] = version;
+        s_size[key]    = size;
+    }
+    else
+    {
+        /* Previous value stays */
+    }
+
+    return result;
+}
+
+static int32_t Model_Delete(NVM_Log_t *log, uint16_t key)
+{
+    int32_t result;
+
+    result = NVM_Log_Delete(log, key);
+    s_version[key] = (ARM_DRIVER_OK == result) ? 0U : s_version[key];
+
+    return result;
+}
+
+/* Keys below count that differ from the model */
+static uint32_t Model_Mismatches(const NVM_Log_t *log, uint16_t count)
+{
+    uint8_t expected[NVM_LOG_VALUE_MAX];
+    uint8_t value[NVM_LOG_VALUE_MAX];
+    uint32_t mismatches;
+    int32_t result;
+    uint16_t key;
+
+    mismatches = 0U;
+
+    for (key = 0U; key < count; key++)
+    {
+        result = NVM_Log_Get(log, key, value, sizeof(value));
+
+        if (0U == s_version[key])
+        {
+            mismatches += (NVM_LOG_ERROR_NOT_FOUND == result) ? 0U : 1U;
+        }
+        else
+        {
+            Value_Fill(expected, key, s_version[key], s_size[key]);
+            mismatches += (((int32_t)s_size[key] == result) && (0 == memcmp(expected, value, s_size[key]))) ? 0U : 1U;
+        }
+    }
+
+    return mismatches;
+}
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Test_Basic(void)
+{
+    NVM_LogConfig_t config = { &s_driver, FLASH_BASE, 4U, s_index, 64U };
+    NVM_LogConfig_t bad;
+    NVM_Log_t log;
+    NVM_Log_t mounted;
+    uint8_t value[NVM_LOG_VALUE_MAX + 1U];
+    uint32_t steps;
+
+    Flash_Setup(SMALL_SECTOR);
+    (void)memset(value, 0x5A, sizeof(value));
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Init(&log, NULL));
+    bad = config;
+    bad.sectorCount = 1U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Init(&log, &bad));
+    bad = config;
+    bad.indexSize = 48U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Init(&log, &bad));
+    bad = config;
+    bad.base = FLASH_BASE + FLASH_PHRASE;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Init(&log, &bad));
+
+    /* Erased flash is formatted */
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+    TEST_CHECK(0U == log.keyCount);
+    TEST_CHECK(0U == log.scanned);
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Put(&log, NVM_LOG_KEY_NONE, value, 4U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Put(&log, 1U, value, 0U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Put(&log, 1U, value, NVM_LOG_VALUE_MAX + 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Put(&log, 1U, NULL, 4U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Get(&log, 1U, NULL, 4U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == NVM_Log_Delete(&log, NVM_LOG_KEY_NONE));
+
+    /* Append and lookup, a short destination truncates */
+    TEST_CHECK(NVM_LOG_ERROR_NOT_FOUND == NVM_Log_Get(&log, 1U, value, sizeof(value)));
+    TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 1U, 1U, 5U));
+    TEST_CHECK(5 == NVM_Log_GetSize(&log, 1U));
+    TEST_CHECK(3 == NVM_Log_Get(&log, 1U, value, 3U));
+    TEST_CHECK(NVM_LOG_ERROR_NOT_FOUND == NVM_Log_GetSize(&log, 2U));
+    TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+
+    /* A newer record supersedes */
+    TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 1U, 2U, 12U));
+    TEST_CHECK(12 == NVM_Log_GetSize(&log, 1U));
+    TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+
+    /* Delete, nothing written for a key not stored */
+    TEST_CHECK(ARM_DRIVER_OK == Model_Delete(&log, 1U));
+    TEST_CHECK(NVM_LOG_ERROR_NOT_FOUND == NVM_Log_Get(&log, 1U, value, sizeof(value)));
+    steps = s_steps;
+    TEST_CHECK(ARM_DRIVER_OK == Model_Delete(&log, 1U));
+    TEST_CHECK(steps == s_steps);
+
+    TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 2U, 1U, NVM_LOG_VALUE_MAX));
+    TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 3U, 1U, 1U));
+    TEST_CHECK(2U == log.keyCount);
+
+    /* Mounted again: the index rebuilt from the five records */
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&mounted, &config));
+    TEST_CHECK(5U == mounted.scanned);
+    TEST_CHECK(2U == mounted.keyCount);
+    TEST_CHECK(0U == Model_Mismatches(&mounted, MODEL_KEYS));
+    TEST_CHECK(0U == s_reprograms);
+}
+
+static void Test_Compaction(void)
+{
+    NVM_LogConfig_t config = { &s_driver, FLASH_BASE, 4U, s_index, 64U };
+    NVM_Log_t log;
+    NVM_Log_t mounted;
+    uint32_t errors;
+    uint32_t update;
+    uint16_t keys;
+    uint16_t key;
+
+    Flash_Setup(SMALL_SECTOR);
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+
+    /* Random updates and deletes of 40 keys: many times the log size */
+    s_seed = 7U;
+    errors = 0U;
+
+    for (update = 1U; update <= 2000U; update++)
+    {
+        key = (uint16_t)(Random() % 40U);
+
+        if (0U == (update % 16U))
+        {
+            errors += (ARM_DRIVER_OK == Model_Delete(&log, key)) ? 0U : 1U;
+        }
+        else
+        {
+            errors += (ARM_DRIVER_OK == Model_Put(&log, key, (uint16_t)update, (uint16_t)(1U + (Random() % 40U)))) ? 0U : 1U;
+        }
+    }
+
+    for (key = 0U, keys = 0U; key < MODEL_KEYS; key++)
+    {
+        keys += (0U != s_version[key]) ? 1U : 0U;
+    }
+
+    TEST_CHECK(0U == errors);
+    TEST_CHECK(log.compactions > 10U);
+    TEST_CHECK(keys == log.keyCount);
+    TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+    TEST_CHECK(0U == s_reprograms);
+
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&mounted, &config));
+    TEST_CHECK(keys == mounted.keyCount);
+    TEST_CHECK(0U == Model_Mismatches(&mounted, MODEL_KEYS));
+
+    /* Index of 8 entries: 7 keys, one entry kept free */
+    Flash_Setup(SMALL_SECTOR);
+    config.indexSize = 8U;
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+
+    for (key = 0U; key < 7U; key++)
+    {
+        TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, key, 1U, 4U));
+    }
+
+    TEST_CHECK(NVM_LOG_ERROR_FULL == Model_Put(&log, 7U, 1U, 4U));
+    TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 6U, 2U, 4U));
+    TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+
+    config.indexSize = 4U;
+    TEST_CHECK(NVM_LOG_ERROR_FULL == NVM_Log_Init(&mounted, &config));
+
+    /* Two sectors, one spare: a sector of live records is full */
+    Flash_Setup(SMALL_SECTOR);
+    config.sectorCount = 2U;
+    config.indexSize   = 256U;
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+
+    for (key = 0U; key < CUT_SECTOR_RECORDS; key++)
+    {
+        TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, key, 1U, 8U));
+    }
+
+    TEST_CHECK(NVM_LOG_ERROR_FULL == Model_Put(&log, CUT_SECTOR_RECORDS, 1U, 8U));
+    TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+    TEST_CHECK(0U == s_reprograms);
+}
+
+static void Test_TornRecord(void)
+{
+    NVM_LogConfig_t config = { &s_driver, FLASH_BASE, 4U, s_index, 64U };
+    NVM_Log_t log;
+    uint8_t active;
+    uint8_t phrase;
+    uint8_t tear;
+
+    /* A 16 byte value takes three phrases: header, two of value */
+    for (tear = TEAR_FIRST_WORD; tear <= TEAR_PARTIAL; tear++)
+    {
+        for (phrase = 1U; phrase <= 3U; phrase++)
+        {
+            Flash_Setup(SMALL_SECTOR);
+            TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+            TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 1U, 1U, 16U));
+            TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 2U, 1U, 16U));
+            active = log.active;
+
+            s_tear    = tear;
+            s_cutStep = s_steps + phrase;
+            TEST_CHECK(ARM_DRIVER_OK != Model_Put(&log, 1U, 2U, 16U));
+            Flash_Reboot();
+
+            /* The torn record is skipped, the previous value stays */
+            TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+            TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+
+            /* Appends continue in the same sector, and are found behind the torn record */
+            TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 1U, 3U, 16U));
+            TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, 3U, 1U, 16U));
+            TEST_CHECK(active == log.active);
+
+            TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+            TEST_CHECK(3U == log.keyCount);
+            TEST_CHECK(0U == Model_Mismatches(&log, MODEL_KEYS));
+            TEST_CHECK(0U == s_reprograms);
+        }
+    }
+}
+
+/*
+ * A full sector of live and superseded records, one spare: the Put of
+ * newKey compacts. The power is cut at each program or erase step of it
+ * in turn; every time the log must mount again with all the values.
+ */
+static void Test_PowerCut(const char *name, uint16_t liveKeys, int32_t expected)
+{
+    NVM_LogConfig_t config = { &s_driver, FLASH_BASE, 2U, s_index, 256U };
+    NVM_Log_t log;
+    uint16_t saved[MODEL_KEYS];
+    uint16_t newKey;
+    uint16_t key;
+    uint32_t steps;
+    uint32_t cut;
+    uint32_t failures;
+    uint8_t value[NVM_LOG_VALUE_MAX];
+    int32_t result;
+
+    Flash_Setup(SMALL_SECTOR);
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+
+    for (key = 0U; key < CUT_SECTOR_RECORDS; key++)
+    {
+        TEST_CHECK(ARM_DRIVER_OK == Model_Put(&log, key % liveKeys, (uint16_t)(1U + (key / liveKeys)), 8U));
+    }
+
+    newKey = (uint16_t)liveKeys;
+    Flash_Save();
+    (void)memcpy(saved, s_version, sizeof(saved));
+
+    /* Uninterrupted, for the step count */
+    steps  = s_steps;
+    result = NVM_Log_Put(&log, newKey, value, 8U);
+    steps  = s_steps - steps;
+
+    TEST_CHECK(expected == result);
+    TEST_CHECK(0U != log.compactions);
+
+    failures = 0U;
+
+    for (cut = 1U; cut <= steps; cut++)
+    {
+        Flash_Restore();
+        (void)memcpy(s_version, saved, sizeof(saved));
+        failures += (ARM_DRIVER_OK == NVM_Log_Init(&log, &config)) ? 0U : 1U;
+
+        s_tear    = (uint8_t)(cut % 2U);
+        s_steps   = 0U;
+        s_cutStep = cut;
+        (void)Model_Put(&log, newKey, 1U, 8U);
+        s_version[newKey] = 0U;
+        Flash_Reboot();
+
+        /* Mounts, twice: the recovery itself is complete */
+        failures += (ARM_DRIVER_OK == NVM_Log_Init(&log, &config)) ? 0U : 1U;
+        failures += (ARM_DRIVER_OK == NVM_Log_Init(&log, &config)) ? 0U : 1U;
+
+        /* The old values all there; the new one either stored or not */
+        s_version[newKey] = (NVM_LOG_ERROR_NOT_FOUND == NVM_Log_GetSize(&log, newKey)) ? 0U : 1U;
+        s_size[newKey]    = 8U;
+        failures         += Model_Mismatches(&log, MODEL_KEYS);
+        failures         += (ARM_DRIVER_OK == expected) ? 0U : s_version[newKey];
+
+        /* Still writable where it was before */
+        if (ARM_DRIVER_OK == expected)
+        {
+            failures += (ARM_DRIVER_OK == Model_Put(&log, newKey, 2U, 8U)) ? 0U : 1U;
+            failures += (ARM_DRIVER_OK == NVM_Log_Init(&log, &config)) ? 0U : 1U;
+            failures += Model_Mismatches(&log, MODEL_KEYS);
+        }
+        else
+        {
+            /* Full of live records */
+        }
+
+        failures += (0U == s_reprograms) ? 0U : 1U;
+    }
+
+    TEST_CHECK(0U == failures);
+
+    (void)printf("power cut at each of %3u compaction steps, %s: %u failures\n",
+                 (unsigned)steps, name, (unsigned)failures);
+}
+
+static void Test_Rebuild(uint32_t records)
+{
+    NVM_LogConfig_t config = { &s_driver, FLASH_BASE, NVM_LOG_SECTOR_MAX, s_index, INDEX_SIZE };
+    NVM_Log_t log;
+    uint64_t start;
+    uint64_t best;
+    uint64_t elapsed;
+    uint32_t errors;
+    uint32_t last;
+    uint32_t value[2];
+    uint32_t i;
+
+    Flash_Setup(LARGE_SECTOR);
+    TEST_CHECK(ARM_DRIVER_OK == NVM_Log_Init(&log, &config));
+
+    errors = 0U;
+
+    for (i = 0U; i < records; i++)
+    {
+        value[0] = i;
+        value[1] = ~i;
+        errors  += (ARM_DRIVER_OK == NVM_Log_Put(&log, (uint16_t)(i % REBUILD_KEYS), value, sizeof(value))) ? 0U : 1U;
+    }
+
+    TEST_CHECK(0U == errors);
+
+    best = ~0ULL;
+
+    for (i = 0U; i < REBUILD_RUNS; i++)
+    {
+        start   = Test_Nanoseconds();
+        errors += (ARM_DRIVER_OK == NVM_Log_Init(&log, &config)) ? 0U : 1U;
+        elapsed = Test_Nanoseconds() - start;
+        best    = (elapsed < best) ? elapsed : best;
+    }
+
+    last = records - 1U;
+
+    TEST_CHECK(0U == errors);
+    TEST_CHECK(records == log.scanned);
+    TEST_CHECK(((records < REBUILD_KEYS) ? records : REBUILD_KEYS) == log.keyCount);
+    TEST_CHECK((int32_t)sizeof(value) == NVM_Log_Get(&log, (uint16_t)(last % REBUILD_KEYS), value, sizeof(value)));
+    TEST_CHECK((last == value[0]) && (~last == value[1]));
+
+    (void)printf("%6u records, %4u keys: index rebuilt in %8.3f ms, %5.1f ns/record\n",
+                 (unsigned)records, (unsigned)log.keyCount, (double)best / 1e6, (double)best / records);
+}
+
+int main(void)
+{
+    Test_Basic();
+    Test_Compaction();
+    Test_TornRecord();
+
+    Test_PowerCut("some records superseded", 100U, ARM_DRIVER_OK);
+    Test_PowerCut("all records live       ", CUT_SECTOR_RECORDS, NVM_LOG_ERROR_FULL);
+
+    Test_Rebuild(1000U);
+    Test_Rebuild(10000U);
+    Test_Rebuild(50000U);
+
+    return Test_Report("Test_Log");
+}
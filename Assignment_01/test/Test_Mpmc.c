@@ -0,0 +1,384 @@
+/*******************************************************************************
+ * @file    Test_Mpmc.c
+ * @brief   Atomic primitives and MPMC queue: contention stress and
+ *          throughput C file.
+ *
+ * Single threaded: parameter checks, full / empty, FIFO order and the
+ * positions across 2^32. Contention: threads hammer shared words with
+ * fetch-add, compare-and-swap loops, exchange and bit set / clear, and
+ * the totals must come out exact. Stress: 4 producers and 4 consumers
+ * move tagged items through a small queue; every item must arrive
+ * exactly once, and each consumer must see the items of one producer in
+ * order. The report
+ * gives throughput and full / empty returns per item for 1, 2 and 4
+ * producer / consumer pairs (the host CPU count is printed).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "Test_Common.h"
+#include "QUEUE_Mpmc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define THREADS_MAX             (4U)
+#define ATOMIC_LOOPS            (500000U)
+#define STRESS_ITEMS            (1000000U)      /**< Per producer */
+#define BENCH_ITEMS             (STRESS_ITEMS)  /**< In total, shared by the pairs */
+#define QUEUE_CAPACITY          (64U)
+
+/* Item: producer, its sequence number and a check word */
+typedef struct
+{
+    uint32_t    producer;
+    uint32_t    sequence;
+    uint32_t    check;
+} Item_t;
+
+typedef struct
+{
+    uint32_t    id;
+    uint32_t    items;          /**< To push (producer) / pop (consumer) */
+    uint32_t    misses;         /**< Full / empty returns */
+    uint32_t    errors;
+} Worker_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static QUEUE_Mpmc_t s_queue;
+static Item_t s_slots[QUEUE_CAPACITY];
+static ATOMIC_U32 s_sequence[QUEUE_CAPACITY];
+
+static ATOMIC_U32 s_counter;                    /**< Fetch-add and CAS increments */
+static ATOMIC_U32 s_bits;                       /**< One bit per thread */
+static ATOMIC_U32 s_owner;                      /**< Last thread id exchanged in */
+static ATOMIC_U32 s_popped;                     /**< Items popped by all consumers */
+static uint32_t s_totalItems;
+static uint8_t s_received[THREADS_MAX][STRESS_ITEMS];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Item_Check(uint32_t producer, uint32_t sequence)
+{
+    return ((producer << 24) ^ sequence) * 0x9E3779B1UL;
+}
+
+static void Item_Make(Item_t *item, uint32_t producer, uint32_t sequence)
+{
+    item->producer = producer;
+    item->sequence = sequence;
+    item->check    = Item_Check(producer, sequence);
+}
+
+static void Test_Queue(void)
+{
+    Item_t item;
+    uint32_t i;
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == QUEUE_Mpmc_Init(&s_queue, s_slots, s_sequence, sizeof(Item_t), 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == QUEUE_Mpmc_Init(&s_queue, s_slots, s_sequence, sizeof(Item_t), 12U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == QUEUE_Mpmc_Init(&s_queue, s_slots, NULL, sizeof(Item_t), 8U));
+    TEST_CHECK(ARM_DRIVER_OK == QUEUE_Mpmc_Init(&s_queue, s_slots, s_sequence, sizeof(Item_t), 8U));
+
+    TEST_CHECK(0U == QUEUE_Mpmc_Pop(&s_queue, &item));
+
+    for (i = 0U; i < 8U; i++)
+    {
+        Item_Make(&item, 0U, i);
+        TEST_CHECK(1U == QUEUE_Mpmc_Push(&s_queue, &item));
+    }
+
+    TEST_CHECK(0U == QUEUE_Mpmc_Push(&s_queue, &item));
+    TEST_CHECK(8U == QUEUE_Mpmc_Count(&s_queue));
+
+    for (i = 0U; i < 8U; i++)
+    {
+        TEST_CHECK((1U == QUEUE_Mpmc_Pop(&s_queue, &item)) && (i == item.sequence));
+    }
+
+    TEST_CHECK(0U == QUEUE_Mpmc_Pop(&s_queue, &item));
+
+    /* Positions and sequences across 2^32: lap of position 0xFFFFFFFC */
+    for (i = 0U; i < 8U; i++)
+    {
+        ATOMIC_Init32(&s_sequence[(0xFFFFFFFCUL + i) & 7U], 0xFFFFFFFCUL + i);
+    }
+
+    ATOMIC_Init32(&s_queue.enqueuePos, 0xFFFFFFFCUL);
+    ATOMIC_Init32(&s_queue.dequeuePos, 0xFFFFFFFCUL);
+
+    for (i = 0U; i < 20U; i++)
+    {
+        Item_Make(&item, 1U, i);
+        TEST_CHECK(1U == QUEUE_Mpmc_Push(&s_queue, &item));
+        Item_Make(&item, 1U, 100U + i);
+        TEST_CHECK(1U == QUEUE_Mpmc_Push(&s_queue, &item));
+        TEST_CHECK((1U == QUEUE_Mpmc_Pop(&s_queue, &item)) && (i == item.sequence));
+        TEST_CHECK((1U == QUEUE_Mpmc_Pop(&s_queue, &item)) && ((100U + i) == item.sequence));
+    }
+
+    TEST_CHECK(0U == QUEUE_Mpmc_Count(&s_queue));
+    TEST_CHECK(36U == ATOMIC_Load32(&s_queue.enqueuePos));
+}
+
+static void *Atomic_Worker(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    uint32_t expected;
+    uint32_t bit;
+    uint32_t old;
+    uint32_t i;
+
+    bit = 1UL << worker->id;
+
+    for (i = 0U; i < ATOMIC_LOOPS; i++)
+    {
+        (void)ATOMIC_FetchAdd32(&s_counter, 1U);
+
+        expected = ATOMIC_Load32(&s_counter);
+
+        while (0U == ATOMIC_Cas32(&s_counter, &expected, expected + 1U))
+        {
+            /* expected now holds the newer value */
+            worker->misses++;
+        }
+
+        /* Each thread owns one bit of the shared word */
+        old = ATOMIC_BitSet32(&s_bits, bit);
+        worker->errors += (0U != (old & bit)) ? 1U : 0U;
+        old = ATOMIC_BitClear32(&s_bits, bit);
+        worker->errors += (0U == (old & bit)) ? 1U : 0U;
+
+        (void)ATOMIC_Exchange32(&s_owner, worker->id);
+    }
+
+    return NULL;
+}
+
+static void Test_Atomics(void)
+{
+    Worker_t workers[THREADS_MAX];
+    pthread_t threads[THREADS_MAX];
+    uint32_t errors;
+    uint32_t i;
+
+    ATOMIC_Init32(&s_counter, 0U);
+    ATOMIC_Init32(&s_bits, 0U);
+    ATOMIC_Init32(&s_owner, THREADS_MAX);
+    (void)memset(workers, 0, sizeof(workers));
+
+    for (i = 0U; i < THREADS_MAX; i++)
+    {
+        workers[i].id = i;
+        TEST_CHECK(0 == pthread_create(&threads[i], NULL, Atomic_Worker, &workers[i]));
+    }
+
+    errors = 0U;
+
+    for (i = 0U; i < THREADS_MAX; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+        errors += workers[i].errors;
+    }
+
+    /* Two increments per loop, every bit cleared by its owner */
+    TEST_CHECK(0U == errors);
+    TEST_CHECK((2U * ATOMIC_LOOPS * THREADS_MAX) == ATOMIC_Load32(&s_counter));
+    TEST_CHECK(0U == ATOMIC_Load32(&s_bits));
+    TEST_CHECK(THREADS_MAX > ATOMIC_Load32(&s_owner));
+}
+
+static void *Stress_Producer(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    Item_t item;
+    uint32_t sequence;
+
+    sequence = 0U;
+
+    while (sequence < worker->items)
+    {
+        Item_Make(&item, worker->id, sequence);
+
+        if (0U != QUEUE_Mpmc_Push(&s_queue, &item))
+        {
+            sequence++;
+        }
+        else
+        {
+            worker->misses++;
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+static void *Stress_Consumer(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    uint32_t last[THREADS_MAX];
+    Item_t item;
+    uint32_t i;
+
+    for (i = 0U; i < THREADS_MAX; i++)
+    {
+        last[i] = UINT32_MAX;
+    }
+
+    while (ATOMIC_Load32(&s_popped) < s_totalItems)
+    {
+        if (0U != QUEUE_Mpmc_Pop(&s_queue, &item))
+        {
+            (void)ATOMIC_FetchAdd32(&s_popped, 1U);
+            worker->items++;
+
+            if ((item.producer >= THREADS_MAX) || (item.sequence >= STRESS_ITEMS) ||
+                (Item_Check(item.producer, item.sequence) != item.check))
+            {
+                worker->errors++;
+            }
+            else
+            {
+                /* In order per producer, as seen by one consumer */
+                worker->errors += ((UINT32_MAX != last[item.producer]) && (item.sequence <= last[item.producer])) ?
+                                  1U : 0U;
+                last[item.producer] = item.sequence;
+                (void)__atomic_fetch_add(&s_received[item.producer][item.sequence], 1U, __ATOMIC_RELAXED);
+            }
+        }
+        else
+        {
+            worker->misses++;
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/* pairs producers and pairs consumers; returns seconds, fills the totals. */
+static double Queue_Run(uint32_t pairs, uint32_t items, Worker_t *producers, Worker_t *consumers)
+{
+    pthread_t threads[2U * THREADS_MAX];
+    uint64_t start;
+    uint32_t i;
+
+    (void)QUEUE_Mpmc_Init(&s_queue, s_slots, s_sequence, sizeof(Item_t), QUEUE_CAPACITY);
+    ATOMIC_Init32(&s_popped, 0U);
+    s_totalItems = pairs * items;
+    (void)memset(producers, 0, pairs * sizeof(Worker_t));
+    (void)memset(consumers, 0, pairs * sizeof(Worker_t));
+
+    start = Test_Nanoseconds();
+
+    for (i = 0U; i < pairs; i++)
+    {
+        producers[i].id    = i;
+        producers[i].items = items;
+        consumers[i].id    = i;
+        (void)pthread_create(&threads[i], NULL, Stress_Producer, &producers[i]);
+        (void)pthread_create(&threads[pairs + i], NULL, Stress_Consumer, &consumers[i]);
+    }
+
+    for (i = 0U; i < (2U * pairs); i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+    }
+
+    return (double)(Test_Nanoseconds() - start) * 1e-9;
+}
+
+static void Test_Stress(void)
+{
+    Worker_t producers[THREADS_MAX];
+    Worker_t consumers[THREADS_MAX];
+    uint32_t errors;
+    uint32_t popped;
+    uint32_t wrong;
+    uint32_t p;
+    uint32_t i;
+
+    (void)memset(s_received, 0, sizeof(s_received));
+    (void)Queue_Run(THREADS_MAX, STRESS_ITEMS, producers, consumers);
+
+    errors = 0U;
+    popped = 0U;
+    wrong  = 0U;
+
+    for (i = 0U; i < THREADS_MAX; i++)
+    {
+        errors += consumers[i].errors;
+        popped += consumers[i].items;
+    }
+
+    for (p = 0U; p < THREADS_MAX; p++)
+    {
+        for (i = 0U; i < STRESS_ITEMS; i++)
+        {
+            wrong += (1U != s_received[p][i]) ? 1U : 0U;
+        }
+    }
+
+    TEST_CHECK(0U == errors);
+    TEST_CHECK((THREADS_MAX * STRESS_ITEMS) == popped);
+    TEST_CHECK(0U == wrong);
+    TEST_CHECK(0U == QUEUE_Mpmc_Count(&s_queue));
+}
+
+static void Bench_Report(uint32_t pairs)
+{
+    Worker_t producers[THREADS_MAX];
+    Worker_t consumers[THREADS_MAX];
+    double seconds;
+    uint32_t full;
+    uint32_t empty;
+    uint32_t i;
+
+    (void)memset(s_received, 0, sizeof(s_received));
+    seconds = Queue_Run(pairs, BENCH_ITEMS / pairs, producers, consumers);
+
+    full  = 0U;
+    empty = 0U;
+
+    for (i = 0U; i < pairs; i++)
+    {
+        full  += producers[i].misses;
+        empty += consumers[i].misses;
+        TEST_CHECK(0U == consumers[i].errors);
+    }
+
+    (void)printf("MPMC %uP/%uC   %8.2f Mitems/s   full %6.3f  empty %6.3f per item\n", (unsigned)pairs,
+                 (unsigned)pairs, (double)s_totalItems / seconds * 1e-6, (double)full / s_totalItems,
+                 (double)empty / s_totalItems);
+}
+
+int main(void)
+{
+    uint32_t pairs;
+
+    Test_Queue();
+    Test_Atomics();
+    Test_Stress();
+
+    (void)printf("MPMC queue of %u slots, %ld host CPUs online\n", (unsigned)QUEUE_CAPACITY,
+                 sysconf(_SC_NPROCESSORS_ONLN));
+
+    for (pairs = 1U; pairs <= THREADS_MAX; pairs *= 2U)
+    {
+        Bench_Report(pairs);
+    }
+
+    return Test_Report("Test_Mpmc");
+}
@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * @file    Test_Quad.c
+ * @brief   Quadrature decoder position extension, index and velocity on the
+ *          FTM model C file.
+ *
+ * The 16-bit decoder counter of the model wraps at 0xFFFF / 0 both ways.
+ * The extended position is checked against the true encoder position
+ * (64-bit) over random walks with steps up to the 32767 count limit
+ * between updates, a run past 2^32 counts, several reads between two
+ * updates and the first step beyond the limit. Index captures are checked
+ * across a counter wrap in latch and reset modes, and the velocity
+ * estimator at edge counting, period timing, the hysteresis between them
+ * and the decay when the encoder stops. The phase A period capture is a
+ * stub returning the measurement set by the test.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "FTM_Quad.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define QUAD_INSTANCE           (HAL_FTM_2)
+#define INDEX_CHANNEL           (4U)
+#define SAMPLE_HZ               (1000U)
+#define SWITCH_COUNTS           (20U)
+#define MAX_WINDOWS             (8U)
+#define STEP_MAX                (32767)         /**< Counts between updates for an exact extension */
+
+#define VELOCITY(countsPerSample)   ((int32_t)(countsPerSample) * (int32_t)SAMPLE_HZ * (1 << FTM_QUAD_VELOCITY_SHIFT))
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static FTM_QuadConfig_t s_config;
+static FTM_Quad_t s_quad;
+
+static FTM_Capture_t s_capture;
+static FTM_CaptureResult_t s_measure;
+static int32_t s_measureResult;
+
+static uint32_t s_random = 0x2545F491UL;
+static int64_t s_truth;                         /**< Encoder position, counts */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Phase A period capture stand-in. */
+int32_t FTM_Capture_Measure(FTM_Capture_t *capture, FTM_CaptureResult_t *result)
+{
+    (void)capture;
+
+    *result = s_measure;
+
+    return s_measureResult;
+}
+
+static uint32_t Random_Next(void)
+{
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 17;
+    s_random ^= s_random << 5;
+
+    return s_random;
+}
+
+static void Encoder_Move(int32_t counts)
+{
+    Fake_FTM_Move(QUAD_INSTANCE, counts);
+    s_truth += counts;
+}
+
+static uint8_t Position_Matches(void)
+{
+    return (FTM_Quad_GetPosition(&s_quad) == (int32_t)(uint32_t)(uint64_t)s_truth) ? 1U : 0U;
+}
+
+static void Quad_Setup(uint8_t indexChannel, uint8_t indexMode, FTM_Capture_t *period)
+{
+    (void)memset(&s_config, 0, sizeof(s_config));
+    s_config.instance     = QUAD_INSTANCE;
+    s_config.mode         = FTM_QUAD_MODE_PHASE;
+    s_config.filter       = 3U;
+    s_config.indexChannel = indexChannel;
+    s_config.indexMode    = indexMode;
+    s_config.switchCounts = SWITCH_COUNTS;
+    s_config.maxWindows   = MAX_WINDOWS;
+    s_config.sampleHz     = SAMPLE_HZ;
+    s_config.period       = period;
+
+    TEST_CHECK(ARM_DRIVER_OK == FTM_Quad_Init(&s_quad, &s_config));
+    TEST_CHECK(ARM_DRIVER_OK == FTM_Quad_Start(&s_quad));
+    s_truth = 0;
+}
+
+static void Test_Params(void)
+{
+    Quad_Setup(FTM_QUAD_NO_INDEX, FTM_QUAD_INDEX_LATCH, NULL);
+    TEST_CHECK((HAL_FTM_QUAD_ENABLE | HAL_FTM_QUAD_FILTER) == Fake_FTM_GetQuadrature(QUAD_INSTANCE));
+
+    s_config.mode   = FTM_QUAD_MODE_COUNT_DIR;
+    s_config.filter = 0U;
+    TEST_CHECK(ARM_DRIVER_OK == FTM_Quad_Init(&s_quad, &s_config));
+    TEST_CHECK((HAL_FTM_QUAD_ENABLE | HAL_FTM_QUAD_COUNT_DIR) == Fake_FTM_GetQuadrature(QUAD_INSTANCE));
+
+    s_config.instance = HAL_FTM_0;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == FTM_Quad_Init(&s_quad, &s_config));
+    s_config.instance     = QUAD_INSTANCE;
+    s_config.indexChannel = 1U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == FTM_Quad_Init(&s_quad, &s_config));
+    s_config.indexChannel = FTM_QUAD_NO_INDEX;
+    s_config.switchCounts = 1U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == FTM_Quad_Init(&s_quad, &s_config));
+    s_config.switchCounts = SWITCH_COUNTS;
+    s_config.sampleHz     = 0U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == FTM_Quad_Init(&s_quad, &s_config));
+}
+
+static void Test_Extension(void)
+{
+    uint32_t failures;
+    uint32_t i;
+    int32_t step;
+
+    /* Counter away from 0 at start: position 0 is where it was started */
+    Quad_Setup(FTM_QUAD_NO_INDEX, FTM_QUAD_INDEX_LATCH, NULL);
+    Fake_FTM_Move(QUAD_INSTANCE, 60000);
+    TEST_CHECK(ARM_DRIVER_OK == FTM_Quad_Stop(&s_quad));
+    Fake_FTM_Move(QUAD_INSTANCE, 1000);
+    TEST_CHECK(ARM_DRIVER_OK == FTM_Quad_Start(&s_quad));
+    TEST_CHECK(0 == FTM_Quad_GetPosition(&s_quad));
+
+    /* Down through 0 and back up through 0xFFFF */
+    Encoder_Move(-STEP_MAX);
+    TEST_CHECK(0U != Position_Matches());
+    FTM_Quad_Update(&s_quad);
+    Encoder_Move(-STEP_MAX);
+    TEST_CHECK(0U != Position_Matches());
+    FTM_Quad_Update(&s_quad);
+    Encoder_Move(STEP_MAX);
+    FTM_Quad_Update(&s_quad);
+    Encoder_Move(STEP_MAX);
+    TEST_CHECK(0U != Position_Matches());
+    TEST_CHECK(0 == FTM_Quad_GetPosition(&s_quad));
+
+    /* Random walk, steps up to the limit, one update per step */
+    failures = 0U;
+
+    for (i = 0U; i < 200000U; i++)
+    {
+        step = (int32_t)(Random_Next() % (2U * STEP_MAX + 1U)) - STEP_MAX;
+        step = (0U == (i & 63U)) ? (((i & 64U) != 0U) ? STEP_MAX : -STEP_MAX) : step;
+        Encoder_Move(step);
+        failures += (0U == Position_Matches()) ? 1U : 0U;
+        FTM_Quad_Update(&s_quad);
+        failures += (0U == Position_Matches()) ? 1U : 0U;
+    }
+
+    TEST_CHECK(0U == failures);
+
+    /* Several reads between two updates, within the limit together */
+    FTM_Quad_Update(&s_quad);
+
+    for (i = 0U; i < 3U; i++)
+    {
+        Encoder_Move(10000);
+        TEST_CHECK(0U != Position_Matches());
+    }
+
+    Encoder_Move(STEP_MAX - 30000);
+    TEST_CHECK(0U != Position_Matches());
+    FTM_Quad_Update(&s_quad);
+
+    /* Past 2^32 counts one way: the position wraps as a 32-bit value */
+    failures = 0U;
+    s_truth  = (int64_t)(int32_t)FTM_Quad_GetPosition(&s_quad);
+
+    for (i = 0U; i < 140000U; i++)
+    {
+        Encoder_Move(STEP_MAX);
+        FTM_Quad_Update(&s_quad);
+        failures += (0U == Position_Matches()) ? 1U : 0U;
+    }
+
+    TEST_CHECK(0U == failures);
+    TEST_CHECK(s_truth > (int64_t)UINT32_MAX);
+
+    /* One count beyond the limit reads as the other way round */
+    Quad_Setup(FTM_QUAD_NO_INDEX, FTM_QUAD_INDEX_LATCH, NULL);
+    Encoder_Move(STEP_MAX + 1);
+    TEST_CHECK(-(STEP_MAX + 1) == FTM_Quad_GetPosition(&s_quad));
+
+    /* Zero */
+    Quad_Setup(FTM_QUAD_NO_INDEX, FTM_QUAD_INDEX_LATCH, NULL);
+    Encoder_Move(20000);
+    FTM_Quad_Update(&s_quad);
+    FTM_Quad_Zero(&s_quad);
+    TEST_CHECK(0 == FTM_Quad_GetPosition(&s_quad));
+    Encoder_Move(-25000);
+    TEST_CHECK(-25000 == FTM_Quad_GetPosition(&s_quad));
+}
+
+static void Test_Index(void)
+{
+    int32_t position;
+    uint32_t failures;
+    uint32_t i;
+
+    TEST_CHECK(0U == FTM_Quad_GetIndex(&s_quad, &position));
+
+    /* Latch: the capture is extended across the counter wrap */
+    Quad_Setup(INDEX_CHANNEL, FTM_QUAD_INDEX_LATCH, NULL);
+    Encoder_Move(30000);
+    FTM_Quad_Update(&s_quad);
+    Encoder_Move(20000);
+    FTM_Quad_Update(&s_quad);
+    Encoder_Move(30000);
+    Fake_FTM_Capture(QUAD_INSTANCE, INDEX_CHANNEL);
+    Encoder_Move(-500);
+    TEST_CHECK(1U == FTM_Quad_GetIndex(&s_quad, &position));
+    TEST_CHECK(80000 == position);
+    TEST_CHECK(0U != Position_Matches());
+
+    /* Reset: position 0 at every index, one per 4000-count revolution */
+    Quad_Setup(INDEX_CHANNEL, FTM_QUAD_INDEX_RESET, NULL);
+    Encoder_Move(1234);
+    Fake_FTM_Capture(QUAD_INSTANCE, INDEX_CHANNEL);
+    TEST_CHECK(0 == FTM_Quad_GetPosition(&s_quad));
+    Encoder_Move(10);
+    TEST_CHECK(10 == FTM_Quad_GetPosition(&s_quad));
+
+    failures = 0U;
+
+    for (i = 0U; i < 100U; i++)
+    {
+        Encoder_Move(1990);
+        FTM_Quad_Update(&s_quad);
+        Encoder_Move(2000);
+        Fake_FTM_Capture(QUAD_INSTANCE, INDEX_CHANNEL);
+        failures += (0 != FTM_Quad_GetPosition(&s_quad)) ? 1U : 0U;
+        Encoder_Move(-7);
+        failures += (-7 != FTM_Quad_GetPosition(&s_quad)) ? 1U : 0U;
+        Encoder_Move(7);
+    }
+
+    TEST_CHECK(0U == failures);
+    TEST_CHECK(101U == FTM_Quad_GetIndex(&s_quad, &position));
+    TEST_CHECK(0 == position);
+}
+
+static void Test_Velocity(void)
+{
+    uint8_t method;
+    uint32_t i;
+    int32_t velocity;
+
+    Quad_Setup(FTM_QUAD_NO_INDEX, FTM_QUAD_INDEX_LATCH, NULL);
+
+    /* Edge counting at speed, both ways */
+    Encoder_Move(100);
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(VELOCITY(100) == FTM_Quad_GetVelocity(&s_quad, &method));
+    TEST_CHECK(FTM_QUAD_METHOD_EDGES == method);
+
+    Encoder_Move(-100);
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(VELOCITY(-100) == FTM_Quad_GetVelocity(&s_quad, &method));
+
+    /* Hysteresis: edge counting down to half the switch count */
+    Encoder_Move(SWITCH_COUNTS / 2U);
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(VELOCITY(SWITCH_COUNTS / 2U) == FTM_Quad_GetVelocity(&s_quad, &method));
+    TEST_CHECK(FTM_QUAD_METHOD_EDGES == method);
+
+    Encoder_Move((SWITCH_COUNTS / 2U) - 1U);
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(VELOCITY((SWITCH_COUNTS / 2U) - 1U) == FTM_Quad_GetVelocity(&s_quad, &method));
+    TEST_CHECK(FTM_QUAD_METHOD_PERIOD == method);
+
+    Encoder_Move(SWITCH_COUNTS - 1U);
+    FTM_Quad_Update(&s_quad);
+    (void)FTM_Quad_GetVelocity(&s_quad, &method);
+    TEST_CHECK(FTM_QUAD_METHOD_PERIOD == method);
+
+    /* Slow: one count every 4 samples */
+    for (i = 0U; i < 16U; i++)
+    {
+        Encoder_Move((3U == (i & 3U)) ? 1 : 0);
+        FTM_Quad_Update(&s_quad);
+    }
+
+    TEST_CHECK(VELOCITY(1) / 4 == FTM_Quad_GetVelocity(&s_quad, &method));
+    TEST_CHECK(FTM_QUAD_METHOD_PERIOD == method);
+
+    /* Stopped: bounded by one count over the silent samples, then 0 */
+    for (i = 1U; i <= 4U; i++)
+    {
+        FTM_Quad_Update(&s_quad);
+        TEST_CHECK((VELOCITY(1) / 4) == FTM_Quad_GetVelocity(&s_quad, NULL));
+    }
+
+    for (i = 5U; i < MAX_WINDOWS; i++)
+    {
+        FTM_Quad_Update(&s_quad);
+        TEST_CHECK((VELOCITY(1) / (int32_t)i) == FTM_Quad_GetVelocity(&s_quad, NULL));
+    }
+
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(0 == FTM_Quad_GetVelocity(&s_quad, NULL));
+
+    /* Period timing from the phase A capture: 250 Hz, 4 counts per cycle */
+    Quad_Setup(FTM_QUAD_NO_INDEX, FTM_QUAD_INDEX_LATCH, &s_capture);
+    s_measureResult            = ARM_DRIVER_OK;
+    s_measure.periods          = 3U;
+    s_measure.frequencyMilliHz = 250000U;
+    s_measure.lost             = 0U;
+
+    Encoder_Move(-1);
+    FTM_Quad_Update(&s_quad);
+    velocity = FTM_Quad_GetVelocity(&s_quad, &method);
+    TEST_CHECK((-1000 * (1 << FTM_QUAD_VELOCITY_SHIFT)) == velocity);
+    TEST_CHECK(FTM_QUAD_METHOD_PERIOD == method);
+
+    /* No period in the batch: counts over the samples */
+    s_measure.periods = 0U;
+    Encoder_Move(-2);
+    FTM_Quad_Update(&s_quad);
+    Encoder_Move(-2);
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(VELOCITY(-2) == FTM_Quad_GetVelocity(&s_quad, NULL));
+
+    /* Capture timed out */
+    s_measure.periods = 5U;
+    s_measure.lost    = 1U;
+    FTM_Quad_Update(&s_quad);
+    FTM_Quad_Update(&s_quad);
+    TEST_CHECK(-(VELOCITY(4) / 2) == FTM_Quad_GetVelocity(&s_quad, NULL));
+}
+
+int main(void)
+{
+    Test_Params();
+    Test_Extension();
+    Test_Index();
+    Test_Velocity();
+
+    return Test_Report("Test_Quad");
+}
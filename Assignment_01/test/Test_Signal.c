@@ -0,0 +1,416 @@
+/*******************************************************************************
+ * @file    Test_Signal.c
+ * @brief   Generated CAN signal codecs against a generic bit-walker C file.
+ *
+ * Two messages, a classic powertrain frame and a 64-byte CAN FD frame, mix
+ * Intel and Motorola signals of 1 ... 32 bits at every bit alignment. On
+ * random payloads each generated unpack / pack must agree with a walker
+ * that moves one bit at a time along the DBC bit numbering. The report
+ * gives the time per message of both.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Test_Common.h"
+#include "CAN_Signal.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SIGNAL_PAYLOADS         (1024U)
+#define SIGNAL_ROUNDS           (200U)
+
+/* SIGNAL(msg, name, byte order, start bit, length, sign, factor, offset) */
+#define ENGINE_SIGNALS(SIGNAL, msg)                                                                 \
+    SIGNAL(msg, Rpm,      CAN_SIGNAL_INTEL,     0U, 16U, CAN_SIGNAL_UNSIGNED, 0.25f,    0.0f)        \
+    SIGNAL(msg, Coolant,  CAN_SIGNAL_MOTOROLA, 23U,  8U, CAN_SIGNAL_SIGNED,   1.0f,   -40.0f)        \
+    SIGNAL(msg, Torque,   CAN_SIGNAL_MOTOROLA, 27U, 12U, CAN_SIGNAL_SIGNED,   0.5f,     0.0f)        \
+    SIGNAL(msg, Throttle, CAN_SIGNAL_INTEL,    40U, 10U, CAN_SIGNAL_UNSIGNED, 0.1f,     0.0f)        \
+    SIGNAL(msg, Gear,     CAN_SIGNAL_INTEL,    50U,  3U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Running,  CAN_SIGNAL_INTEL,    53U,  1U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Counter,  CAN_SIGNAL_MOTOROLA, 31U,  4U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Checksum, CAN_SIGNAL_MOTOROLA, 63U,  8U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)
+
+#define BATTERY_SIGNALS(SIGNAL, msg)                                                                \
+    SIGNAL(msg, Voltage,  CAN_SIGNAL_INTEL,     0U, 16U, CAN_SIGNAL_UNSIGNED, 0.01f,    0.0f)        \
+    SIGNAL(msg, Current,  CAN_SIGNAL_INTEL,    16U, 20U, CAN_SIGNAL_SIGNED,   0.001f,   0.0f)        \
+    SIGNAL(msg, Soc,      CAN_SIGNAL_MOTOROLA, 47U, 10U, CAN_SIGNAL_UNSIGNED, 0.1f,     0.0f)        \
+    SIGNAL(msg, Energy,   CAN_SIGNAL_INTEL,    56U, 32U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, CellMin,  CAN_SIGNAL_MOTOROLA, 95U, 13U, CAN_SIGNAL_UNSIGNED, 0.001f,   0.0f)        \
+    SIGNAL(msg, CellMax,  CAN_SIGNAL_MOTOROLA, 98U, 13U, CAN_SIGNAL_UNSIGNED, 0.001f,   0.0f)        \
+    SIGNAL(msg, TempMin,  CAN_SIGNAL_INTEL,   120U,  7U, CAN_SIGNAL_SIGNED,   1.0f,   -20.0f)        \
+    SIGNAL(msg, TempMax,  CAN_SIGNAL_INTEL,   127U,  7U, CAN_SIGNAL_SIGNED,   1.0f,   -20.0f)        \
+    SIGNAL(msg, Odometer, CAN_SIGNAL_MOTOROLA, 143U, 31U, CAN_SIGNAL_UNSIGNED, 0.1f,    0.0f)        \
+    SIGNAL(msg, Isolation, CAN_SIGNAL_INTEL,  200U, 24U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Balance,  CAN_SIGNAL_INTEL,   227U, 29U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Fault,    CAN_SIGNAL_MOTOROLA, 263U, 17U, CAN_SIGNAL_UNSIGNED, 1.0f,    0.0f)        \
+    SIGNAL(msg, Power,    CAN_SIGNAL_MOTOROLA, 330U, 25U, CAN_SIGNAL_SIGNED,   0.01f,   0.0f)        \
+    SIGNAL(msg, Cycles,   CAN_SIGNAL_INTEL,   400U, 18U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Mode,     CAN_SIGNAL_INTEL,   499U,  5U, CAN_SIGNAL_UNSIGNED, 1.0f,     0.0f)        \
+    SIGNAL(msg, Crc,      CAN_SIGNAL_MOTOROLA, 487U, 16U, CAN_SIGNAL_UNSIGNED, 1.0f,    0.0f)
+
+CAN_SIGNAL_MESSAGE(Engine, ARM_CAN_STANDARD_ID(0x100UL), 8U, ENGINE_SIGNALS)
+CAN_SIGNAL_MESSAGE(Battery, ARM_CAN_EXTENDED_ID(0x18FF1000UL), 64U, BATTERY_SIGNALS)
+
+typedef struct
+{
+    uint8_t     order;
+    uint16_t    start;
+    uint8_t     length;
+    uint8_t     sign;
+    float       factor;
+    float       offset;
+} Walker_Signal_t;
+
+#define WALKER_SIGNAL(msg, name, order, start, length, sign, factor, offset) \
+    { order, start, length, sign, factor, offset },
+
+#define GENERATED_RAW(msg, name, ...)   sum += msg##_##name##_UnpackRaw(data);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const Walker_Signal_t s_engine[] = { ENGINE_SIGNALS(WALKER_SIGNAL, Engine) };
+static const Walker_Signal_t s_battery[] = { BATTERY_SIGNALS(WALKER_SIGNAL, Battery) };
+
+static uint8_t s_payloads[SIGNAL_PAYLOADS][64];
+static uint32_t s_random = 0x2468ACE1UL;
+
+static ARM_CAN_MSG_INFO s_sentInfo;
+static uint8_t s_sentData[64];
+static uint8_t s_sentSize;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Random(void)
+{
+    s_random ^= s_random << 13;
+    s_random ^= s_random >> 17;
+    s_random ^= s_random << 5;
+
+    return s_random;
+}
+
+/* Next bit towards the LSB: Intel counts up, Motorola walks the sawtooth. */
+static uint32_t Walker_Next(uint8_t order, uint32_t bit)
+{
+    return (CAN_SIGNAL_INTEL == order) ? (bit + 1U) : ((0U == (bit & 7U)) ? (bit + 15U) : (bit - 1U));
+}
+
+/* Bit number of the LSB: the start bit for Intel, the end of the walk for Motorola. */
+static uint32_t Walker_Lsb(const Walker_Signal_t *signal)
+{
+    uint32_t bit;
+    uint32_t i;
+
+    bit = signal->start;
+
+    for (i = 1U; (CAN_SIGNAL_MOTOROLA == signal->order) && (i < signal->length); i++)
+    {
+        bit = Walker_Next(signal->order, bit);
+    }
+
+    return bit;
+}
+
+static uint32_t Walker_Extract(const uint8_t *data, const Walker_Signal_t *signal)
+{
+    uint32_t raw;
+    uint32_t bit;
+    uint32_t i;
+
+    raw = 0U;
+    bit = signal->start;
+
+    for (i = 0U; i < signal->length; i++)
+    {
+        /* Intel from the LSB up, Motorola from the MSB down */
+        if (CAN_SIGNAL_INTEL == signal->order)
+        {
+            raw |= (uint32_t)((data[bit / 8U] >> (bit & 7U)) & 1U) << i;
+        }
+        else
+        {
+            raw |= (uint32_t)((data[bit / 8U] >> (bit & 7U)) & 1U) << (signal->length - 1U - i);
+        }
+
+        bit = Walker_Next(signal->order, bit);
+    }
+
+    return raw;
+}
+
+static void Walker_Insert(uint8_t *data, const Walker_Signal_t *signal, uint32_t raw)
+{
+    uint32_t bit;
+    uint32_t i;
+    uint32_t value;
+
+    bit = signal->start;
+
+    for (i = 0U; i < signal->length; i++)
+    {
+        value = (CAN_SIGNAL_INTEL == signal->order) ? (raw >> i) : (raw >> (signal->length - 1U - i));
+
+        data[bit / 8U] = (uint8_t)((data[bit / 8U] & ~(1U << (bit & 7U))) | ((value & 1U) << (bit & 7U)));
+
+        bit = Walker_Next(signal->order, bit);
+    }
+}
+
+static float Walker_Unpack(const uint8_t *data, const Walker_Signal_t *signal)
+{
+    uint32_t raw;
+    float value;
+
+    raw = Walker_Extract(data, signal);
+
+    if ((CAN_SIGNAL_SIGNED == signal->sign) && (0U != (raw >> (signal->length - 1U))))
+    {
+        value = (float)((int64_t)raw - ((int64_t)1 << signal->length));
+    }
+    else
+    {
+        value = (float)raw;
+    }
+
+    return (value * signal->factor) + signal->offset;
+}
+
+static uint32_t Generated_Engine(const uint8_t *data)
+{
+    uint32_t sum;
+
+    sum = 0U;
+    ENGINE_SIGNALS(GENERATED_RAW, Engine)
+
+    return sum;
+}
+
+static uint32_t Generated_Battery(const uint8_t *data)
+{
+    uint32_t sum;
+
+    sum = 0U;
+    BATTERY_SIGNALS(GENERATED_RAW, Battery)
+
+    return sum;
+}
+
+static uint32_t Walker_Message(const uint8_t *data, const Walker_Signal_t *signals, uint32_t count)
+{
+    uint32_t sum;
+    uint32_t i;
+
+    sum = 0U;
+
+    for (i = 0U; i < count; i++)
+    {
+        sum += Walker_Extract(data, &signals[i]);
+    }
+
+    return sum;
+}
+
+static int32_t Bus_MessageSend(uint32_t obj_idx, ARM_CAN_MSG_INFO *msg_info, const uint8_t *data, uint8_t size)
+{
+    (void)obj_idx;
+
+    s_sentInfo = *msg_info;
+    s_sentSize = size;
+    (void)memcpy(s_sentData, data, size);
+
+    return size;
+}
+
+static ARM_DRIVER_CAN s_bus =
+{
+    .MessageSend = Bus_MessageSend,
+};
+
+/* The generated raw accessors of one message against the walker */
+#define CHECK_RAW(msg, name, order, start, length, sign, factor, offset)                           \
+    do                                                                                              \
+    {                                                                                               \
+        const Walker_Signal_t walker = { order, start, length, sign, factor, offset };              \
+        uint8_t generated[64];                                                                      \
+        uint8_t walked[64];                                                                         \
+        uint32_t raw;                                                                               \
+                                                                                                    \
+        raw = Random() & CAN_SIGNAL_MASK(length);                                                   \
+        (void)memcpy(generated, data, sizeof(generated));                                          \
+        (void)memcpy(walked, data, sizeof(walked));                                                \
+        msg##_##name##_PackRaw(generated, raw);                                                     \
+        Walker_Insert(walked, &walker, raw);                                                        \
+                                                                                                    \
+        mismatches += (msg##_##name##_UnpackRaw(data) != Walker_Extract(data, &walker)) ? 1U : 0U;  \
+        mismatches += (0 != memcmp(generated, walked, sizeof(walked))) ? 1U : 0U;                   \
+        mismatches += (msg##_##name##_UnpackRaw(generated) != raw) ? 1U : 0U;                       \
+        mismatches += (msg##_##name##_Unpack(data) != Walker_Unpack(data, &walker)) ? 1U : 0U;      \
+    } while (0);
+
+static void Test_Equivalence(void)
+{
+    const uint8_t *data;
+    uint32_t mismatches;
+    uint32_t i;
+
+    mismatches = 0U;
+
+    for (i = 0U; i < SIGNAL_PAYLOADS; i++)
+    {
+        data = s_payloads[i];
+
+        ENGINE_SIGNALS(CHECK_RAW, Engine)
+        BATTERY_SIGNALS(CHECK_RAW, Battery)
+    }
+
+    TEST_CHECK(0U == mismatches);
+
+    /* Walker bit numbering: the LSB of a Motorola signal */
+    TEST_CHECK(16U == Walker_Lsb(&s_engine[1]));
+    TEST_CHECK(32U == Walker_Lsb(&s_engine[2]));
+}
+
+static void Test_Message(void)
+{
+    Engine_t engine;
+    Engine_t decoded;
+    Battery_t battery;
+    Battery_t batteryDecoded;
+    ARM_CAN_MSG_INFO info;
+
+    /* Physical values on the raw grid survive a pack / unpack */
+    engine.Rpm      = 3250.75f;
+    engine.Coolant  = -12.0f;
+    engine.Torque   = -310.5f;
+    engine.Throttle = 62.5f;
+    engine.Gear     = 5.0f;
+    engine.Running  = 1.0f;
+    engine.Counter  = 9.0f;
+    engine.Checksum = 165.0f;
+
+    TEST_CHECK(8 == Engine_Send(&s_bus, 0U, &engine));
+    TEST_CHECK((ARM_CAN_STANDARD_ID(0x100UL) == s_sentInfo.id) && (0U == s_sentInfo.edl) && (8U == s_sentSize));
+    TEST_CHECK(ARM_DRIVER_OK == Engine_Decode(&s_sentInfo, s_sentData, s_sentSize, &decoded));
+    TEST_CHECK((decoded.Rpm == engine.Rpm) && (decoded.Coolant == engine.Coolant) && (decoded.Torque == engine.Torque) &&
+               (decoded.Gear == engine.Gear) && (decoded.Running == engine.Running) &&
+               (decoded.Counter == engine.Counter) && (decoded.Checksum == engine.Checksum));
+    TEST_CHECK((decoded.Throttle > 62.45f) && (decoded.Throttle < 62.55f));
+
+    /* Out of range values saturate */
+    engine.Coolant = 500.0f;
+    engine.Torque  = -5000.0f;
+    Engine_Pack(&engine, s_sentData);
+    Engine_Unpack(&decoded, s_sentData);
+    TEST_CHECK((87.0f == decoded.Coolant) && (-1024.0f == decoded.Torque));
+
+    /* Other identifier, short payload */
+    info    = s_sentInfo;
+    info.id = ARM_CAN_STANDARD_ID(0x101UL);
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == Engine_Decode(&info, s_sentData, 8U, &decoded));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == Engine_Decode(&s_sentInfo, s_sentData, 7U, &decoded));
+
+    (void)memset(&battery, 0, sizeof(battery));
+    (void)memset(&batteryDecoded, 0, sizeof(batteryDecoded));
+    battery.Current  = -123.456f;
+    battery.Odometer = 123456.7f;
+    battery.Energy   = 4000000000.0f;
+    battery.Mode     = 17.0f;
+
+    TEST_CHECK(64 == Battery_Send(&s_bus, 0U, &battery));
+    TEST_CHECK((0U != s_sentInfo.edl) && (0U != s_sentInfo.brs) && (64U == s_sentSize));
+    TEST_CHECK(ARM_DRIVER_OK == Battery_Decode(&s_sentInfo, s_sentData, s_sentSize, &batteryDecoded));
+    TEST_CHECK((batteryDecoded.Current > -123.4575f) && (batteryDecoded.Current < -123.4545f));
+    TEST_CHECK((batteryDecoded.Odometer > 123456.6f) && (batteryDecoded.Odometer < 123456.8f));
+    TEST_CHECK((4000000000.0f == batteryDecoded.Energy) && (17.0f == batteryDecoded.Mode));
+}
+
+static void Test_Benchmark(void)
+{
+    volatile uint32_t sink;
+    uint64_t start;
+    uint64_t generatedNs[2];
+    uint64_t walkerNs[2];
+    uint32_t round;
+    uint32_t i;
+    double messages;
+
+    sink = 0U;
+
+    start = Test_Nanoseconds();
+    for (round = 0U; round < SIGNAL_ROUNDS; round++)
+    {
+        for (i = 0U; i < SIGNAL_PAYLOADS; i++)
+        {
+            sink += Generated_Engine(s_payloads[i]);
+        }
+    }
+    generatedNs[0] = Test_Nanoseconds() - start;
+
+    start = Test_Nanoseconds();
+    for (round = 0U; round < SIGNAL_ROUNDS; round++)
+    {
+        for (i = 0U; i < SIGNAL_PAYLOADS; i++)
+        {
+            sink += Walker_Message(s_payloads[i], s_engine, sizeof(s_engine) / sizeof(s_engine[0]));
+        }
+    }
+    walkerNs[0] = Test_Nanoseconds() - start;
+
+    start = Test_Nanoseconds();
+    for (round = 0U; round < SIGNAL_ROUNDS; round++)
+    {
+        for (i = 0U; i < SIGNAL_PAYLOADS; i++)
+        {
+            sink += Generated_Battery(s_payloads[i]);
+        }
+    }
+    generatedNs[1] = Test_Nanoseconds() - start;
+
+    start = Test_Nanoseconds();
+    for (round = 0U; round < SIGNAL_ROUNDS; round++)
+    {
+        for (i = 0U; i < SIGNAL_PAYLOADS; i++)
+        {
+            sink += Walker_Message(s_payloads[i], s_battery, sizeof(s_battery) / sizeof(s_battery[0]));
+        }
+    }
+    walkerNs[1] = Test_Nanoseconds() - start;
+    (void)sink;
+
+    messages = (double)SIGNAL_ROUNDS * SIGNAL_PAYLOADS;
+
+    (void)printf("unpack raw, ns / message     generated   bit-walker\n");
+    (void)printf("Engine   8 B %2u signals      %8.1f     %8.1f\n", (unsigned)(sizeof(s_engine) / sizeof(s_engine[0])),
+                 (double)generatedNs[0] / messages, (double)walkerNs[0] / messages);
+    (void)printf("Battery 64 B %2u signals      %8.1f     %8.1f\n",
+                 (unsigned)(sizeof(s_battery) / sizeof(s_battery[0])),
+                 (double)generatedNs[1] / messages, (double)walkerNs[1] / messages);
+}
+
+int main(void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0U; i < SIGNAL_PAYLOADS; i++)
+    {
+        for (j = 0U; j < 64U; j++)
+        {
+            s_payloads[i][j] = (uint8_t)Random();
+        }
+    }
+
+    Test_Equivalence();
+    Test_Message();
+    Test_Benchmark();
+
+    return Test_Report("Test_Signal");
+}
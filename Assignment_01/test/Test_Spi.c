@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * @file    Test_Spi.c
+ * @brief   Transfer modes and bus utilization of the LPSPI CMSIS driver C file.
+ *
+ * Driver_SPI0 runs against the cycle model of the LPSPI / eDMA (SOUT looped
+ * back to SIN) at 12 and 24 MHz SCK. Every transfer is checked for data and
+ * completion; the report gives the bus utilization (shifter busy cycles /
+ * cycles from Transfer() to the completion event) per mode, with the cost
+ * model of Fake_HAL.h standing in for the core and the eDMA.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "Driver_SPI_S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SPI_MAX_FRAMES      (40000U)    /**< Longer than one DMA major loop */
+#define SPI_TIMEOUT_CYCLES  (100000000UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_SPI * const s_spi = &Driver_SPI0;
+
+static uint16_t s_tx[SPI_MAX_FRAMES];
+static uint16_t s_rx[SPI_MAX_FRAMES];
+static volatile uint32_t s_complete;
+static volatile uint32_t s_lost;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Spi_Event(uint32_t event)
+{
+    if (0U != (event & ARM_SPI_EVENT_TRANSFER_COMPLETE))
+    {
+        s_complete++;
+    }
+    else
+    {
+        /* Not a completion */
+    }
+
+    if (0U != (event & ARM_SPI_EVENT_DATA_LOST))
+    {
+        s_lost++;
+    }
+    else
+    {
+        /* No overflow */
+    }
+}
+
+static void Spi_Configure(uint32_t bits, uint32_t speed)
+{
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(ARM_SPI_MODE_MASTER | ARM_SPI_CPOL0_CPHA0 | ARM_SPI_MSB_LSB |
+                                               ARM_SPI_SS_MASTER_HW_OUTPUT | ARM_SPI_DATA_BITS(bits), speed));
+}
+
+/* One transfer to completion; returns the elapsed cycles */
+static uint32_t Spi_Transfer(uint32_t frames, uint32_t bits, uint32_t *utilization)
+{
+    uint32_t index;
+    uint32_t mask;
+    uint32_t elapsed;
+    uint32_t shiftBefore;
+    uint32_t mismatches;
+
+    mask = (1UL << bits) - 1UL;
+
+    for (index = 0U; index < frames; index++)
+    {
+        s_tx[index] = (uint16_t)(((index * 40503U) + bits) & mask);
+        s_rx[index] = 0U;
+    }
+
+    s_complete  = 0U;
+    elapsed     = 0U;
+    shiftBefore = Fake_LPSPI_GetShiftCycles(HAL_LPSPI_0);
+
+    if (bits <= 8U)
+    {
+        /* 8-bit frames are one byte each in memory */
+        for (index = 0U; index < frames; index++)
+        {
+            ((uint8_t *)s_tx)[index] = (uint8_t)s_tx[index];
+        }
+    }
+    else
+    {
+        /* 16-bit frames as stored */
+    }
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, frames));
+
+    while ((0U == s_complete) && (elapsed < SPI_TIMEOUT_CYCLES))
+    {
+        Fake_LPSPI_Run(HAL_LPSPI_0, 1U);
+        elapsed++;
+    }
+
+    TEST_CHECK(1U == s_complete);
+    TEST_CHECK(frames == s_spi->GetDataCount());
+
+    mismatches = 0U;
+
+    for (index = 0U; index < frames; index++)
+    {
+        if (((bits <= 8U) && (((uint8_t *)s_rx)[index] != ((uint8_t *)s_tx)[index])) ||
+            ((bits > 8U) && (s_rx[index] != s_tx[index])))
+        {
+            mismatches++;
+        }
+        else
+        {
+            /* Frame came back */
+        }
+    }
+
+    TEST_CHECK(0U == mismatches);
+
+    *utilization = (uint32_t)((100ULL * (Fake_LPSPI_GetShiftCycles(HAL_LPSPI_0) - shiftBefore)) / elapsed);
+
+    return elapsed;
+}
+
+static void Test_Utilization(void)
+{
+    static const uint32_t speeds[] = { 12000000UL, 24000000UL };
+    static const uint32_t bits[]   = { 8U, 16U };
+    static const uint32_t frames[] = { 4U, 16U, 17U, 1024U, SPI_MAX_FRAMES };
+    uint32_t speed;
+    uint32_t width;
+    uint32_t length;
+    uint32_t utilization;
+    uint32_t irqBefore;
+    uint32_t irqs;
+    uint32_t elapsed;
+
+    (void)printf("   SCK  bits  frames  mode  cycles  utilization  interrupts\n");
+
+    for (speed = 0U; speed < (sizeof(speeds) / sizeof(speeds[0])); speed++)
+    {
+        for (width = 0U; width < (sizeof(bits) / sizeof(bits[0])); width++)
+        {
+            Spi_Configure(bits[width], speeds[speed]);
+            TEST_CHECK(speeds[speed] == (uint32_t)s_spi->Control(ARM_SPI_GET_BUS_SPEED, 0U));
+
+            for (length = 0U; length < (sizeof(frames) / sizeof(frames[0])); length++)
+            {
+                irqBefore = Fake_LPSPI_GetInterruptCount(HAL_LPSPI_0) + Fake_DMA_GetInterruptCount();
+                elapsed   = Spi_Transfer(frames[length], bits[width], &utilization);
+                irqs      = Fake_LPSPI_GetInterruptCount(HAL_LPSPI_0) + Fake_DMA_GetInterruptCount() - irqBefore;
+
+                (void)printf("%3u MHz  %4u  %6u  %4s  %6u  %9u %%  %10u\n", (unsigned)(speeds[speed] / 1000000UL),
+                             (unsigned)bits[width], (unsigned)frames[length],
+                             (frames[length] > 16U) ? "DMA" : "IRQ", (unsigned)elapsed, (unsigned)utilization,
+                             (unsigned)irqs);
+
+                if (frames[length] > 16U)
+                {
+                    /*
+                     * One interrupt per DMA major loop. 8-bit frames at 24 MHz
+                     * take 16 cycles, the RX and TX minor loops share the engine
+                     * and become the limit there.
+                     */
+                    TEST_CHECK(irqs == ((frames[length] + 32766U) / 32767U));
+                    TEST_CHECK((frames[length] < 1024U) || (utilization >= 85U));
+                }
+                else
+                {
+                    /* Watermark interrupts, never one per frame */
+                    TEST_CHECK(irqs <= ((frames[length] / 2U) + 1U));
+                }
+            }
+        }
+    }
+
+    TEST_CHECK(0U == s_lost);
+}
+
+/* Chained transfers under CS_HOLD keep PCS asserted */
+static void Test_CsHold(void)
+{
+    uint32_t releases;
+    uint32_t utilization;
+
+    Spi_Configure(8U, 12000000UL);
+
+    /* Let the release command of the last transfer drain */
+    Fake_LPSPI_Run(HAL_LPSPI_0, 16U);
+    releases = Fake_LPSPI_GetCsReleases(HAL_LPSPI_0);
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(SPI_CONTROL_CS_HOLD, 1U));
+
+    (void)Spi_Transfer(3U, 8U, &utilization);
+    (void)Spi_Transfer(64U, 8U, &utilization);
+    (void)Spi_Transfer(5U, 8U, &utilization);
+
+    TEST_CHECK(releases == Fake_LPSPI_GetCsReleases(HAL_LPSPI_0));
+    TEST_CHECK(1U == Fake_LPSPI_IsCsAsserted(HAL_LPSPI_0));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(SPI_CONTROL_CS_HOLD, 0U));
+    Fake_LPSPI_Run(HAL_LPSPI_0, 16U);
+
+    TEST_CHECK((releases + 1U) == Fake_LPSPI_GetCsReleases(HAL_LPSPI_0));
+    TEST_CHECK(0U == Fake_LPSPI_IsCsAsserted(HAL_LPSPI_0));
+
+    /* Without hold every transfer releases PCS at its end */
+    (void)Spi_Transfer(3U, 8U, &utilization);
+    Fake_LPSPI_Run(HAL_LPSPI_0, 16U);
+    TEST_CHECK((releases + 2U) == Fake_LPSPI_GetCsReleases(HAL_LPSPI_0));
+}
+
+int main(void)
+{
+    Fake_DMA_Reset();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Initialize(Spi_Event));
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_spi->Transfer(s_tx, s_rx, 1U));
+
+    Test_Utilization();
+    Test_CsHold();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Uninitialize());
+
+    return Test_Report("Test_Spi");
+}
@@ -0,0 +1,400 @@
+/*******************************************************************************
+ * @file    Test_Spi_Flexio.c
+ * @brief   CMSIS SPI driver on FlexIO against the FlexIO / eDMA models C file.
+ *
+ * Driver_SPI3 runs through its CMSIS table with FXIO_D5 (SOUT) wired to
+ * FXIO_D6 (SIN): every frame format, 8 / 16 / 32 bit frames in both bit
+ * orders with the first bit on the wire checked, send / receive only,
+ * a transfer longer than one DMA major loop with GetDataCount on the way,
+ * abort, chip select hold and lost data. The report gives, per SCK rate
+ * and frame size, the transfer time and the interrupts it took.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "HAL_GPIO.h"
+#include "Driver_SPI_S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FXSPI_SOUT_PIN      (5U)            /**< FXIO_D5, PTD3 */
+#define FXSPI_SIN_PIN       (6U)            /**< FXIO_D6, PTA8 */
+#define FXSPI_CS_PORT       (HAL_GPIO_PORT_A)
+#define FXSPI_CS_PIN        (9U)
+
+#define FXSPI_SPEED         (12000000UL)    /**< 2 FlexIO clocks per half SCK */
+#define FXSPI_MAX_BYTES     (40000U * 4U)
+#define FXSPI_LONG_FRAMES   (40000U)        /**< Two DMA major loops */
+#define FXSPI_TIMEOUT       (100000000UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_SPI * const s_spi = &Driver_SPI3;
+
+static uint8_t s_tx[FXSPI_MAX_BYTES] __attribute__((aligned(4)));
+static uint8_t s_rx[FXSPI_MAX_BYTES] __attribute__((aligned(4)));
+static volatile uint32_t s_complete;
+static volatile uint32_t s_lost;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Spi_Event(uint32_t event)
+{
+    if (0U != (event & ARM_SPI_EVENT_TRANSFER_COMPLETE))
+    {
+        s_complete++;
+    }
+    else
+    {
+        /* Not a completion */
+    }
+
+    if (0U != (event & ARM_SPI_EVENT_DATA_LOST))
+    {
+        s_lost++;
+    }
+    else
+    {
+        /* No lost data */
+    }
+}
+
+static int32_t Spi_Configure(uint32_t format, uint32_t bits, uint32_t order, uint32_t speed)
+{
+    return s_spi->Control(ARM_SPI_MODE_MASTER | format | order | ARM_SPI_SS_MASTER_HW_OUTPUT |
+                          ARM_SPI_DATA_BITS(bits), speed);
+}
+
+static void Spi_Fill(uint32_t bytes, uint32_t seed)
+{
+    uint32_t index;
+
+    for (index = 0U; index < bytes; index++)
+    {
+        s_tx[index] = (uint8_t)((index * 151U) + seed);
+        s_rx[index] = 0U;
+    }
+}
+
+/* Run the model until the completion event; returns the clocks spent */
+static uint32_t Spi_Complete(void)
+{
+    uint32_t clocks;
+
+    for (clocks = 0U; (0U == s_complete) && (clocks < FXSPI_TIMEOUT); clocks++)
+    {
+        Fake_FLEXIO_Run(1U);
+    }
+
+    return clocks;
+}
+
+/* First bit on the wire in bit 0 */
+static uint32_t Spi_WireOrder(uint32_t frame, uint32_t bits, uint32_t lsbFirst)
+{
+    uint32_t wire;
+    uint32_t bit;
+
+    wire = frame;
+
+    if (0U == lsbFirst)
+    {
+        wire = 0U;
+
+        for (bit = 0U; bit < bits; bit++)
+        {
+            wire |= ((frame >> bit) & 1UL) << (bits - 1U - bit);
+        }
+    }
+    else
+    {
+        /* Sent as stored */
+    }
+
+    return wire;
+}
+
+static void Test_Control(void)
+{
+    TEST_CHECK(ARM_DRIVER_ERROR == s_spi->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Initialize(Spi_Event));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_spi->Control(ARM_SPI_MODE_MASTER, FXSPI_SPEED));
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_spi->Transfer(s_tx, s_rx, 1U));
+
+    TEST_CHECK(ARM_SPI_ERROR_MODE == s_spi->Control(ARM_SPI_MODE_SLAVE, 0U));
+    TEST_CHECK(ARM_SPI_ERROR_FRAME_FORMAT == Spi_Configure(ARM_SPI_TI_SSI, 8U, ARM_SPI_MSB_LSB, FXSPI_SPEED));
+    TEST_CHECK(ARM_SPI_ERROR_DATA_BITS == Spi_Configure(ARM_SPI_CPOL0_CPHA0, 12U, ARM_SPI_MSB_LSB, FXSPI_SPEED));
+    TEST_CHECK(ARM_SPI_ERROR_SS_MODE == s_spi->Control(ARM_SPI_MODE_MASTER | ARM_SPI_SS_MASTER_SW, FXSPI_SPEED));
+
+    /* SCK of 93.75 kHz ... 12 MHz, rounded down */
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == Spi_Configure(ARM_SPI_CPOL0_CPHA0, 8U, ARM_SPI_MSB_LSB, 50000UL));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_spi->Transfer(s_tx, s_rx, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == Spi_Configure(ARM_SPI_CPOL0_CPHA0, 8U, ARM_SPI_MSB_LSB, 25000000UL));
+    TEST_CHECK(12000000 == s_spi->Control(ARM_SPI_GET_BUS_SPEED, 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(ARM_SPI_SET_BUS_SPEED, 5000000UL));
+    TEST_CHECK(4800000 == s_spi->Control(ARM_SPI_GET_BUS_SPEED, 0U));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_spi->Control(SPI_CONTROL_PCS, 1U));
+
+    /* Chip select idles high */
+    TEST_CHECK(1U == Fake_GPIO_GetPin(FXSPI_CS_PORT, FXSPI_CS_PIN));
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_spi->Transfer(s_tx, NULL, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_spi->Send(NULL, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_spi->Receive(s_rx, 0U));
+}
+
+/* Every format, size and order loops back; the wire carries the right bit first */
+static void Test_Formats(void)
+{
+    static const uint32_t formats[] =
+    {
+        ARM_SPI_CPOL0_CPHA0, ARM_SPI_CPOL0_CPHA1, ARM_SPI_CPOL1_CPHA0, ARM_SPI_CPOL1_CPHA1
+    };
+    static const uint32_t bits[] = { 8U, 16U, 32U };
+    uint32_t format;
+    uint32_t width;
+    uint32_t order;
+    uint32_t frames;
+    uint32_t bytes;
+    uint32_t last;
+    uint8_t  csLow;
+
+    frames = 9U;
+
+    for (format = 0U; format < (sizeof(formats) / sizeof(formats[0])); format++)
+    {
+        for (width = 0U; width < (sizeof(bits) / sizeof(bits[0])); width++)
+        {
+            for (order = 0U; order < 2U; order++)
+            {
+                TEST_CHECK(ARM_DRIVER_OK == Spi_Configure(formats[format], bits[width],
+                                                          (0U != order) ? ARM_SPI_LSB_MSB : ARM_SPI_MSB_LSB,
+                                                          FXSPI_SPEED));
+
+                bytes = frames * (bits[width] / 8U);
+                Spi_Fill(bytes, format + width + order);
+                s_complete = 0U;
+
+                TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, frames));
+                TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_spi->Transfer(s_tx, s_rx, frames));
+                TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_spi->Control(ARM_SPI_SET_BUS_SPEED, FXSPI_SPEED));
+                csLow = (0U == Fake_GPIO_GetPin(FXSPI_CS_PORT, FXSPI_CS_PIN)) ? 1U : 0U;
+
+                (void)Spi_Complete();
+
+                TEST_CHECK(1U == s_complete);
+                TEST_CHECK(1U == csLow);
+                TEST_CHECK(1U == Fake_GPIO_GetPin(FXSPI_CS_PORT, FXSPI_CS_PIN));
+                TEST_CHECK(frames == s_spi->GetDataCount());
+                TEST_CHECK(0 == memcmp(s_tx, s_rx, bytes));
+
+                last = 0U;
+                (void)memcpy(&last, &s_tx[bytes - (bits[width] / 8U)], bits[width] / 8U);
+                TEST_CHECK(Spi_WireOrder(last, bits[width], order) == Fake_FLEXIO_GetLastFrame(FXSPI_SOUT_PIN));
+            }
+        }
+    }
+
+    TEST_CHECK(0U == s_lost);
+}
+
+/* Send only discards what comes back, receive only clocks out the default value */
+static void Test_Directions(void)
+{
+    uint32_t index;
+    uint32_t mismatches;
+
+    TEST_CHECK(ARM_DRIVER_OK == Spi_Configure(ARM_SPI_CPOL0_CPHA0, 8U, ARM_SPI_MSB_LSB, FXSPI_SPEED));
+
+    Spi_Fill(32U, 11U);
+    s_complete = 0U;
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Send(s_tx, 32U));
+    (void)Spi_Complete();
+    TEST_CHECK(1U == s_complete);
+    TEST_CHECK(32U == s_spi->GetDataCount());
+    TEST_CHECK(0U == s_rx[0]);
+    TEST_CHECK(Spi_WireOrder(s_tx[31], 8U, 0U) == Fake_FLEXIO_GetLastFrame(FXSPI_SOUT_PIN));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(ARM_SPI_SET_DEFAULT_TX_VALUE, 0x5AU));
+    s_complete = 0U;
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Receive(s_rx, 32U));
+    (void)Spi_Complete();
+    TEST_CHECK(1U == s_complete);
+
+    mismatches = 0U;
+
+    for (index = 0U; index < 32U; index++)
+    {
+        mismatches += (0x5AU == s_rx[index]) ? 0U : 1U;
+    }
+
+    TEST_CHECK(0U == mismatches);
+}
+
+/* Longer than a major loop, then aborted part way through */
+static void Test_LongAndAbort(void)
+{
+    uint32_t count;
+
+    TEST_CHECK(ARM_DRIVER_OK == Spi_Configure(ARM_SPI_CPOL0_CPHA0, 16U, ARM_SPI_MSB_LSB, FXSPI_SPEED));
+
+    Spi_Fill(FXSPI_LONG_FRAMES * 2U, 13U);
+    s_complete = 0U;
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, FXSPI_LONG_FRAMES));
+
+    /* 16 bits of 4 clocks each per frame */
+    Fake_FLEXIO_Run(35000U * 64U);
+    TEST_CHECK(35000U == s_spi->GetDataCount());
+    TEST_CHECK(1U == s_spi->GetStatus().busy);
+
+    (void)Spi_Complete();
+    TEST_CHECK(1U == s_complete);
+    TEST_CHECK(FXSPI_LONG_FRAMES == s_spi->GetDataCount());
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, FXSPI_LONG_FRAMES * 2U));
+
+    /* Abort: count frozen, chip select released, nothing moves afterwards */
+    Spi_Fill(2000U, 17U);
+    s_complete = 0U;
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, 1000U));
+    Fake_FLEXIO_Run(300U * 64U);
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(ARM_SPI_ABORT_TRANSFER, 0U));
+
+    count = s_spi->GetDataCount();
+    TEST_CHECK(300U == count);
+    TEST_CHECK(0U == s_spi->GetStatus().busy);
+    TEST_CHECK(1U == Fake_GPIO_GetPin(FXSPI_CS_PORT, FXSPI_CS_PIN));
+
+    Fake_FLEXIO_Run(100U * 64U);
+    TEST_CHECK(count == s_spi->GetDataCount());
+    TEST_CHECK(0U == s_complete);
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, count * 2U));
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(ARM_SPI_ABORT_TRANSFER, 0U));
+
+    /* The dropped frames do not leak into the next transfer */
+    Spi_Fill(64U, 19U);
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, 32U));
+    (void)Spi_Complete();
+    TEST_CHECK(1U == s_complete);
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, 64U));
+}
+
+/* Chained transfers under CS_HOLD keep chip select asserted */
+static void Test_CsHold(void)
+{
+    uint32_t index;
+
+    TEST_CHECK(ARM_DRIVER_OK == Spi_Configure(ARM_SPI_CPOL0_CPHA0, 8U, ARM_SPI_MSB_LSB, FXSPI_SPEED));
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(SPI_CONTROL_CS_HOLD, 1U));
+
+    for (index = 0U; index < 3U; index++)
+    {
+        Spi_Fill(8U, index);
+        s_complete = 0U;
+        TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, 8U));
+        (void)Spi_Complete();
+        TEST_CHECK(1U == s_complete);
+        TEST_CHECK(0U == Fake_GPIO_GetPin(FXSPI_CS_PORT, FXSPI_CS_PIN));
+    }
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Control(SPI_CONTROL_CS_HOLD, 0U));
+    TEST_CHECK(1U == Fake_GPIO_GetPin(FXSPI_CS_PORT, FXSPI_CS_PIN));
+}
+
+/* A receive error during a transfer is reported as lost data */
+static void Test_DataLost(void)
+{
+    Spi_Fill(8U, 23U);
+    s_complete = 0U;
+    s_lost     = 0U;
+
+    Fake_FLEXIO_CorruptNext(FXSPI_SOUT_PIN);
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, 8U));
+    (void)Spi_Complete();
+
+    TEST_CHECK(1U == s_complete);
+    TEST_CHECK(1U == s_lost);
+    TEST_CHECK(1U == s_spi->GetStatus().data_lost);
+
+    /* Cleared by the next transfer */
+    s_complete = 0U;
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, 8U));
+    TEST_CHECK(0U == s_spi->GetStatus().data_lost);
+    (void)Spi_Complete();
+    TEST_CHECK(1U == s_lost);
+}
+
+static void Test_Report_Rates(void)
+{
+    static const uint32_t speeds[] = { 1000000UL, 6000000UL, FXSPI_SPEED };
+    static const uint32_t bits[]   = { 8U, 16U, 32U };
+    static const uint32_t frames[] = { 4U, 1024U };
+    uint32_t speed;
+    uint32_t width;
+    uint32_t length;
+    uint32_t clocks;
+    uint32_t irqs;
+
+    (void)printf("   SCK  bits  frames  transfer  kbyte/s  interrupts\n");
+
+    for (speed = 0U; speed < (sizeof(speeds) / sizeof(speeds[0])); speed++)
+    {
+        for (width = 0U; width < (sizeof(bits) / sizeof(bits[0])); width++)
+        {
+            TEST_CHECK(ARM_DRIVER_OK == Spi_Configure(ARM_SPI_CPOL0_CPHA0, bits[width], ARM_SPI_MSB_LSB,
+                                                      speeds[speed]));
+
+            for (length = 0U; length < (sizeof(frames) / sizeof(frames[0])); length++)
+            {
+                Spi_Fill(frames[length] * (bits[width] / 8U), speed + width);
+                s_complete = 0U;
+                irqs = Fake_FLEXIO_GetInterruptCount() + Fake_DMA_GetInterruptCount();
+
+                TEST_CHECK(ARM_DRIVER_OK == s_spi->Transfer(s_tx, s_rx, frames[length]));
+                clocks = Spi_Complete();
+                irqs   = Fake_FLEXIO_GetInterruptCount() + Fake_DMA_GetInterruptCount() - irqs;
+
+                TEST_CHECK(1U == s_complete);
+                TEST_CHECK(0 == memcmp(s_tx, s_rx, frames[length] * (bits[width] / 8U)));
+
+                /* The RX major loop only, whatever the length */
+                TEST_CHECK(1U == irqs);
+
+                (void)printf("%3.0f MHz  %4u  %6u  %5.0f us  %7.1f  %10u\n", (double)speeds[speed] / 1e6,
+                             (unsigned)bits[width], (unsigned)frames[length],
+                             ((double)clocks * 1e6) / HAL_FLEXIO_CLOCK_HZ,
+                             ((double)frames[length] * (bits[width] / 8U) * HAL_FLEXIO_CLOCK_HZ) /
+                             ((double)clocks * 1000.0), (unsigned)irqs);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    Fake_DMA_Reset();
+    Fake_FLEXIO_Reset();
+    Fake_FLEXIO_Connect(FXSPI_SOUT_PIN, FXSPI_SIN_PIN);
+
+    Test_Control();
+    Test_Formats();
+    Test_Directions();
+    Test_LongAndAbort();
+    Test_CsHold();
+    Test_DataLost();
+    Test_Report_Rates();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_spi->Uninitialize());
+    TEST_CHECK(ARM_DRIVER_ERROR == s_spi->Transfer(s_tx, s_rx, 1U));
+
+    return Test_Report("Test_Spi_Flexio");
+}
@@ -0,0 +1,438 @@
+/*******************************************************************************
+ * @file    Test_Spsc.c
+ * @brief   Lock-free SPSC ring: layout, wrap, two-thread stress and
+ *          throughput C file.
+ *
+ * Single threaded: parameter checks, the line layout of the instance and
+ * of the slots, spans at the buffer end and the free running indexes
+ * across 2^32. Stress: a producer thread pushes sequence-numbered slots
+ * through Push, PushBatch and WriteSpan / Commit at random sizes, the
+ * consumer checks every slot received through Pop, PopBatch and ReadSpan /
+ * Release. The report gives the two-thread throughput per slot size and
+ * batch size (meaningful with two host CPUs, the number is printed).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "Test_Common.h"
+#include "RING_Spsc.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define STRESS_ITEMS            (4000000UL)
+#define STRESS_CAPACITY         (64U)
+#define BENCH_ITEMS             (4000000UL)
+#define BENCH_CAPACITY          (256U)
+#define BATCH_MAX               (32U)
+#define SLOT_MAX                (64U)
+
+/* Stress slot: sequence number and two words derived from it */
+typedef struct
+{
+    uint32_t    sequence;
+    uint32_t    inverse;
+    uint32_t    mixed;
+} Item_t;
+
+typedef struct
+{
+    RING_Spsc_t    *ring;
+    uint32_t        slotSize;
+    uint32_t        batch;
+    uint32_t        items;
+    uint32_t        errors;
+} Worker_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static RING_Spsc_t s_ring;
+static uint8_t s_buffer[RING_SPSC_BUFFER_SIZE(SLOT_MAX, BENCH_CAPACITY)] RING_SPSC_ALIGNED;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Item_Mix(uint32_t sequence)
+{
+    return sequence * 0x9E3779B1UL;
+}
+
+static void Item_Make(Item_t *item, uint32_t sequence)
+{
+    item->sequence = sequence;
+    item->inverse  = ~sequence;
+    item->mixed    = Item_Mix(sequence);
+}
+
+static uint8_t Item_Check(const Item_t *item, uint32_t sequence)
+{
+    return ((sequence == item->sequence) && (~sequence == item->inverse) && (Item_Mix(sequence) == item->mixed)) ?
+           1U : 0U;
+}
+
+/* xorshift32 per thread */
+static uint32_t Random_Next(uint32_t *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+
+    return *state;
+}
+
+static void Test_Layout(void)
+{
+    uint8_t unaligned[2U * RING_SPSC_LINE_BYTES] RING_SPSC_ALIGNED;
+    Item_t item;
+    Item_t items[8];
+    uint32_t span;
+    uint32_t i;
+    const uint8_t *slot;
+    static RING_Spsc_t pair[2];
+
+    TEST_CHECK(0U == ((uintptr_t)&pair[1] % RING_SPSC_LINE_BYTES));
+    TEST_CHECK(0U == ((uintptr_t)&pair[1].head % RING_SPSC_LINE_BYTES));
+    TEST_CHECK(RING_SPSC_LINE_BYTES == ((uintptr_t)&pair[1].tail - (uintptr_t)&pair[1].head));
+    TEST_CHECK(RING_SPSC_LINE_BYTES == RING_SPSC_SLOT_LINES(sizeof(Item_t)));
+    TEST_CHECK((2U * RING_SPSC_LINE_BYTES) == RING_SPSC_SLOT_LINES(RING_SPSC_LINE_BYTES + 1U));
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == RING_Spsc_Init(&s_ring, s_buffer, sizeof(Item_t), 6U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == RING_Spsc_Init(&s_ring, s_buffer, 0U, 8U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == RING_Spsc_Init(&s_ring, &unaligned[4], 4U, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == RING_Spsc_Init(&s_ring, s_buffer, sizeof(Item_t), 8U));
+    TEST_CHECK(RING_SPSC_LINE_BYTES == s_ring.stride);
+
+    /* Fill, full, then empty in order */
+    for (i = 0U; i < 8U; i++)
+    {
+        Item_Make(&item, i);
+        TEST_CHECK(1U == RING_Spsc_Push(&s_ring, &item));
+    }
+
+    TEST_CHECK(0U == RING_Spsc_Push(&s_ring, &item));
+    TEST_CHECK(8U == RING_Spsc_Count(&s_ring));
+
+    /* One slot per line */
+    slot = (const uint8_t *)RING_Spsc_ReadSpan(&s_ring, &span);
+    TEST_CHECK(8U == span);
+    TEST_CHECK(0U != Item_Check((const Item_t *)&slot[5U * RING_SPSC_LINE_BYTES], 5U));
+
+    TEST_CHECK(3U == RING_Spsc_PopBatch(&s_ring, items, 3U));
+    TEST_CHECK((0U != Item_Check(&items[0], 0U)) && (0U != Item_Check(&items[2], 2U)));
+
+    /* Spans stop at the buffer end, batches go round it */
+    for (i = 8U; i < 11U; i++)
+    {
+        Item_Make(&item, i);
+        TEST_CHECK(1U == RING_Spsc_Push(&s_ring, &item));
+    }
+
+    (void)RING_Spsc_ReadSpan(&s_ring, &span);
+    TEST_CHECK(5U == span);
+    TEST_CHECK(8U == RING_Spsc_PopBatch(&s_ring, items, 8U));
+
+    for (i = 0U; i < 8U; i++)
+    {
+        TEST_CHECK(0U != Item_Check(&items[i], 3U + i));
+    }
+
+    TEST_CHECK(0U == RING_Spsc_Pop(&s_ring, &item));
+
+    /* Free running indexes across 2^32 */
+    s_ring.head      = 0xFFFFFFFCUL;
+    s_ring.tailCache = 0xFFFFFFFCUL;
+    s_ring.tail      = 0xFFFFFFFCUL;
+    s_ring.headCache = 0xFFFFFFFCUL;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        Item_Make(&items[i], 100U + i);
+    }
+
+    TEST_CHECK(8U == RING_Spsc_PushBatch(&s_ring, items, 8U));
+    TEST_CHECK(4U == s_ring.head);
+    TEST_CHECK(8U == RING_Spsc_Count(&s_ring));
+    (void)memset(items, 0, sizeof(items));
+    TEST_CHECK(8U == RING_Spsc_PopBatch(&s_ring, items, 8U));
+    TEST_CHECK((0U != Item_Check(&items[0], 100U)) && (0U != Item_Check(&items[7], 107U)));
+}
+
+static void *Stress_Producer(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    Item_t items[BATCH_MAX];
+    uint32_t random;
+    uint32_t sequence;
+    uint32_t count;
+    uint32_t span;
+    uint32_t done;
+    uint32_t i;
+    uint8_t *slot;
+
+    random   = 0x1234567UL;
+    sequence = 0U;
+
+    while (sequence < worker->items)
+    {
+        count = 1U + (Random_Next(&random) % BATCH_MAX);
+        count = (count > (worker->items - sequence)) ? (worker->items - sequence) : count;
+
+        switch (Random_Next(&random) % 3U)
+        {
+            case 0U:
+            {
+                Item_Make(&items[0], sequence);
+                done = RING_Spsc_Push(worker->ring, &items[0]);
+                break;
+            }
+
+            case 1U:
+            {
+                for (i = 0U; i < count; i++)
+                {
+                    Item_Make(&items[i], sequence + i);
+                }
+
+                done = RING_Spsc_PushBatch(worker->ring, items, count);
+                break;
+            }
+
+            default:
+            {
+                /* In place */
+                slot = (uint8_t *)RING_Spsc_WriteSpan(worker->ring, &span);
+                done = (count < span) ? count : span;
+
+                for (i = 0U; i < done; i++)
+                {
+                    Item_Make((Item_t *)&slot[i * worker->ring->stride], sequence + i);
+                }
+
+                RING_Spsc_Commit(worker->ring, done);
+                break;
+            }
+        }
+
+        sequence += done;
+
+        if (0U == done)
+        {
+            (void)sched_yield();
+        }
+        else
+        {
+            /* Progress */
+        }
+    }
+
+    return NULL;
+}
+
+static void *Stress_Consumer(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    Item_t items[BATCH_MAX];
+    uint32_t random;
+    uint32_t sequence;
+    uint32_t count;
+    uint32_t span;
+    uint32_t done;
+    uint32_t i;
+    const uint8_t *slot;
+
+    random   = 0x7654321UL;
+    sequence = 0U;
+
+    while (sequence < worker->items)
+    {
+        count = 1U + (Random_Next(&random) % BATCH_MAX);
+
+        switch (Random_Next(&random) % 3U)
+        {
+            case 0U:
+            {
+                done = RING_Spsc_Pop(worker->ring, &items[0]);
+                worker->errors += ((0U != done) && (0U == Item_Check(&items[0], sequence))) ? 1U : 0U;
+                break;
+            }
+
+            case 1U:
+            {
+                done = RING_Spsc_PopBatch(worker->ring, items, count);
+
+                for (i = 0U; i < done; i++)
+                {
+                    worker->errors += (0U == Item_Check(&items[i], sequence + i)) ? 1U : 0U;
+                }
+
+                break;
+            }
+
+            default:
+            {
+                slot = (const uint8_t *)RING_Spsc_ReadSpan(worker->ring, &span);
+                done = (count < span) ? count : span;
+
+                for (i = 0U; i < done; i++)
+                {
+                    worker->errors += (0U == Item_Check((const Item_t *)&slot[i * worker->ring->stride],
+                                                        sequence + i)) ? 1U : 0U;
+                }
+
+                RING_Spsc_Release(worker->ring, done);
+                break;
+            }
+        }
+
+        sequence += done;
+
+        if (0U == done)
+        {
+            (void)sched_yield();
+        }
+        else
+        {
+            /* Progress */
+        }
+    }
+
+    return NULL;
+}
+
+static void Test_Stress(void)
+{
+    Worker_t worker;
+    pthread_t producer;
+    pthread_t consumer;
+
+    (void)memset(&worker, 0, sizeof(worker));
+    worker.ring  = &s_ring;
+    worker.items = STRESS_ITEMS;
+
+    TEST_CHECK(ARM_DRIVER_OK == RING_Spsc_Init(&s_ring, s_buffer, sizeof(Item_t), STRESS_CAPACITY));
+    TEST_CHECK(0 == pthread_create(&producer, NULL, Stress_Producer, &worker));
+    TEST_CHECK(0 == pthread_create(&consumer, NULL, Stress_Consumer, &worker));
+    (void)pthread_join(producer, NULL);
+    (void)pthread_join(consumer, NULL);
+
+    TEST_CHECK(0U == worker.errors);
+    TEST_CHECK(0U == RING_Spsc_Count(&s_ring));
+    TEST_CHECK(STRESS_ITEMS == s_ring.tail);
+}
+
+static void *Bench_Producer(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    uint8_t data[BATCH_MAX * SLOT_MAX];
+    uint32_t sent;
+    uint32_t done;
+
+    (void)memset(data, 0x5A, sizeof(data));
+    sent = 0U;
+
+    while (sent < worker->items)
+    {
+        done  = RING_Spsc_PushBatch(worker->ring, data, worker->batch);
+        sent += done;
+
+        if (0U == done)
+        {
+            (void)sched_yield();
+        }
+        else
+        {
+            /* Progress */
+        }
+    }
+
+    return NULL;
+}
+
+static void *Bench_Consumer(void *param)
+{
+    Worker_t *worker = (Worker_t *)param;
+    uint8_t data[BATCH_MAX * SLOT_MAX];
+    uint32_t received;
+    uint32_t done;
+
+    received = 0U;
+
+    while (received < worker->items)
+    {
+        done      = RING_Spsc_PopBatch(worker->ring, data, worker->batch);
+        received += done;
+
+        if (0U == done)
+        {
+            (void)sched_yield();
+        }
+        else
+        {
+            /* Progress */
+        }
+    }
+
+    worker->errors += (0x5AU != data[0]) ? 1U : 0U;
+
+    return NULL;
+}
+
+static void Bench_Report(uint32_t slotSize, uint32_t batch)
+{
+    Worker_t worker;
+    pthread_t producer;
+    pthread_t consumer;
+    uint64_t start;
+    double seconds;
+
+    (void)memset(&worker, 0, sizeof(worker));
+    worker.ring     = &s_ring;
+    worker.slotSize = slotSize;
+    worker.batch    = batch;
+    worker.items    = BENCH_ITEMS - (BENCH_ITEMS % batch);
+
+    (void)RING_Spsc_Init(&s_ring, s_buffer, slotSize, BENCH_CAPACITY);
+    start = Test_Nanoseconds();
+    (void)pthread_create(&producer, NULL, Bench_Producer, &worker);
+    (void)pthread_create(&consumer, NULL, Bench_Consumer, &worker);
+    (void)pthread_join(producer, NULL);
+    (void)pthread_join(consumer, NULL);
+    seconds = (double)(Test_Nanoseconds() - start) * 1e-9;
+
+    TEST_CHECK(0U == worker.errors);
+    (void)printf("SPSC slot %2u B  batch %2u   %8.2f Mslots/s  %8.1f MB/s\n", (unsigned)slotSize, (unsigned)batch,
+                 (double)worker.items / seconds * 1e-6, (double)worker.items * slotSize / seconds * 1e-6);
+}
+
+int main(void)
+{
+    static const uint32_t slotSizes[] = { 4U, 16U, SLOT_MAX };
+    static const uint32_t batches[] = { 1U, BATCH_MAX };
+    uint32_t i;
+    uint32_t j;
+
+    Test_Layout();
+    Test_Stress();
+
+    (void)printf("SPSC throughput, 2 threads, %ld host CPUs online, line %u B\n",
+                 sysconf(_SC_NPROCESSORS_ONLN), (unsigned)RING_SPSC_LINE_BYTES);
+
+    for (i = 0U; i < (sizeof(slotSizes) / sizeof(slotSizes[0])); i++)
+    {
+        for (j = 0U; j < (sizeof(batches) / sizeof(batches[0])); j++)
+        {
+            Bench_Report(slotSizes[i], batches[j]);
+        }
+    }
+
+    return Test_Report("Test_Spsc");
+}
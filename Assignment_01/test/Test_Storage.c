@@ -0,0 +1,398 @@
+/*******************************************************************************
+ * @file    Test_Storage.c
+ * @brief   Host file backed CMSIS Storage driver C file.
+ *
+ * Synchronous: alignment and program-before-erase are refused, a new or
+ * grown file reads erased, programmed units survive Uninitialize() and
+ * are still refused, the modeled time is counted. With the delays on the
+ * calls take at least the modeled time. Asynchronous: operations return
+ * at once, everything else is refused while one runs, and the result
+ * comes through the callback from the worker thread; of several threads
+ * starting an operation together exactly one is accepted.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "Test_Common.h"
+#include "Driver_Storage_Host.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define STORAGE_SIZE            (16384U)
+#define ERASE_UNIT              (4096U)
+#define PROGRAM_UNIT            (8U)
+#define PROGRAM_US              (90U)
+#define ERASE_US                (12000U)
+
+/* Delays really waited */
+#define LATENCY_PROGRAM_US      (1000U)
+#define LATENCY_ERASE_US        (5000U)
+
+#define CALLBACK_TIMEOUT_NS     (2000000000ULL)
+#define RACE_THREADS            (8U)
+
+typedef struct
+{
+    uint32_t    index;
+    int32_t     result;
+} Race_Caller_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_STORAGE * const s_storage = &Driver_Storage0;
+
+static char s_path[] = "/tmp/Test_Storage_XXXXXX";
+
+static uint8_t s_data[ERASE_UNIT];
+static uint8_t s_read[STORAGE_SIZE];
+
+/* Written by the worker thread */
+static pthread_mutex_t s_callbackLock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t s_callbacks;
+static int32_t s_callbackStatus;
+static ARM_STORAGE_OPERATION s_callbackOperation;
+
+static pthread_barrier_t s_raceStart;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Storage_Callback(int32_t status, ARM_STORAGE_OPERATION operation)
+{
+    (void)pthread_mutex_lock(&s_callbackLock);
+    s_callbackStatus    = status;
+    s_callbackOperation = operation;
+    s_callbacks++;
+    (void)pthread_mutex_unlock(&s_callbackLock);
+}
+
+/* Wait for callback number count, 1 if it came */
+static uint8_t Storage_WaitCallback(uint32_t count)
+{
+    uint64_t deadline;
+    uint8_t done;
+
+    deadline = Test_Nanoseconds() + CALLBACK_TIMEOUT_NS;
+
+    (void)pthread_mutex_lock(&s_callbackLock);
+
+    while ((s_callbacks < count) && (Test_Nanoseconds() < deadline))
+    {
+        (void)pthread_mutex_unlock(&s_callbackLock);
+        (void)usleep(100U);
+        (void)pthread_mutex_lock(&s_callbackLock);
+    }
+
+    done = (s_callbacks >= count) ? 1U : 0U;
+    (void)pthread_mutex_unlock(&s_callbackLock);
+
+    return done;
+}
+
+static uint8_t Storage_IsErased(const uint8_t *data, uint32_t size)
+{
+    uint32_t i;
+    uint8_t erased;
+
+    erased = 1U;
+
+    for (i = 0U; i < size; i++)
+    {
+        erased = (0xFFU == data[i]) ? erased : 0U;
+    }
+
+    return erased;
+}
+
+static void Storage_Open(uint32_t size, uint32_t programUs, uint32_t eraseUs, uint8_t delay, uint8_t asynchronous)
+{
+    STORAGE_HOST_Config_t config;
+
+    config.path          = s_path;
+    config.size          = size;
+    config.eraseUnit     = ERASE_UNIT;
+    config.programUnit   = PROGRAM_UNIT;
+    config.programTimeUs = programUs;
+    config.eraseTimeUs   = eraseUs;
+    config.delay         = delay;
+    config.asynchronous  = asynchronous;
+
+    TEST_CHECK(ARM_DRIVER_OK == STORAGE_HOST_Configure(&config));
+    TEST_CHECK(1 == s_storage->Initialize((0U != asynchronous) ? Storage_Callback : NULL));
+    TEST_CHECK(1 == s_storage->PowerControl(ARM_POWER_FULL));
+}
+
+static void Test_Configure(void)
+{
+    STORAGE_HOST_Config_t config = { s_path, STORAGE_SIZE, ERASE_UNIT, PROGRAM_UNIT, 0U, 0U, 0U, 0U };
+    STORAGE_HOST_Config_t bad;
+
+    /* Nothing to open yet */
+    TEST_CHECK(ARM_DRIVER_ERROR == s_storage->Initialize(NULL));
+
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == STORAGE_HOST_Configure(NULL));
+    bad = config;
+    bad.path = NULL;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == STORAGE_HOST_Configure(&bad));
+    bad = config;
+    bad.size = STORAGE_SIZE + PROGRAM_UNIT;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == STORAGE_HOST_Configure(&bad));
+    bad = config;
+    bad.programUnit = 24U;
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == STORAGE_HOST_Configure(&bad));
+
+    TEST_CHECK(ARM_DRIVER_OK == STORAGE_HOST_Configure(&config));
+    TEST_CHECK(1 == s_storage->Initialize(NULL));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == STORAGE_HOST_Configure(&config));
+
+    /* Not powered */
+    TEST_CHECK(ARM_DRIVER_ERROR == s_storage->ReadData(0U, s_read, PROGRAM_UNIT));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_storage->PowerControl(ARM_POWER_LOW));
+
+    TEST_CHECK(1 == s_storage->Uninitialize());
+}
+
+static void Test_Sync(void)
+{
+    ARM_STORAGE_CAPABILITIES capabilities;
+    ARM_STORAGE_INFO info;
+    ARM_STORAGE_BLOCK block;
+    STORAGE_HOST_Stats_t stats;
+    uint32_t i;
+
+    Storage_Open(STORAGE_SIZE, PROGRAM_US, ERASE_US, 0U, 0U);
+
+    capabilities = s_storage->GetCapabilities();
+    TEST_CHECK(0U == capabilities.asynchronous_ops);
+    TEST_CHECK(1U == capabilities.erase_all);
+
+    TEST_CHECK(ARM_DRIVER_OK == s_storage->GetInfo(&info));
+    TEST_CHECK(STORAGE_SIZE == info.total_storage);
+    TEST_CHECK(PROGRAM_UNIT == info.program_unit);
+    TEST_CHECK(1U == info.erased_value);
+    TEST_CHECK(ARM_DRIVER_OK == s_storage->GetNextBlock(NULL, &block));
+    TEST_CHECK((0U == block.addr) && (STORAGE_SIZE == block.size) && (ERASE_UNIT == block.attributes.erase_unit));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_storage->GetNextBlock(&block, &block));
+
+    /* A new file reads erased */
+    TEST_CHECK((int32_t)STORAGE_SIZE == s_storage->ReadData(0U, s_read, STORAGE_SIZE));
+    TEST_CHECK(0U != Storage_IsErased(s_read, STORAGE_SIZE));
+
+    /* Alignment and range */
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->ProgramData(4U, s_data, PROGRAM_UNIT));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->ProgramData(0U, s_data, 12U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->ProgramData(0U, s_data, 0U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->ProgramData(STORAGE_SIZE - PROGRAM_UNIT, s_data, 16U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->Erase(PROGRAM_UNIT, ERASE_UNIT));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->Erase(0U, ERASE_UNIT / 2U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_storage->ReadData(STORAGE_SIZE - 4U, s_read, PROGRAM_UNIT));
+
+    /* Program, then no second program of a unit before its erase, even with 0xFF data */
+    TEST_CHECK(64 == s_storage->ProgramData(0U, s_data, 64U));
+    TEST_CHECK(64 == s_storage->ReadData(0U, s_read, 64U));
+    TEST_CHECK(0 == memcmp(s_data, s_read, 64U));
+    TEST_CHECK(ARM_STORAGE_ERROR_NOT_PROGRAMMABLE == s_storage->ProgramData(56U, s_data, 16U));
+
+    (void)memset(s_read, 0xFF, PROGRAM_UNIT);
+    TEST_CHECK((int32_t)PROGRAM_UNIT == s_storage->ProgramData(ERASE_UNIT, s_read, PROGRAM_UNIT));
+    TEST_CHECK(ARM_STORAGE_ERROR_NOT_PROGRAMMABLE == s_storage->ProgramData(ERASE_UNIT, s_data, PROGRAM_UNIT));
+
+    /* Erase makes the unit programmable again */
+    TEST_CHECK((int32_t)ERASE_UNIT == s_storage->Erase(0U, ERASE_UNIT));
+    TEST_CHECK((int32_t)ERASE_UNIT == s_storage->ReadData(0U, s_read, ERASE_UNIT));
+    TEST_CHECK(0U != Storage_IsErased(s_read, ERASE_UNIT));
+    TEST_CHECK(64 == s_storage->ProgramData(0U, s_data, 64U));
+
+    STORAGE_HOST_GetStats(&stats);
+    TEST_CHECK(8U == stats.rejected);
+    TEST_CHECK((8U + 1U + 8U) == stats.programUnits);
+    TEST_CHECK(1U == stats.eraseUnits);
+    TEST_CHECK((((8U + 1U + 8U) * PROGRAM_US) + ERASE_US) == stats.busyTimeUs);
+
+    /* A file grown on the next run: old units kept and still taken, new ones erased */
+    TEST_CHECK(1 == s_storage->Uninitialize());
+    Storage_Open(2U * STORAGE_SIZE, PROGRAM_US, ERASE_US, 0U, 0U);
+
+    TEST_CHECK((int32_t)STORAGE_SIZE == s_storage->ReadData(STORAGE_SIZE, s_read, STORAGE_SIZE));
+    TEST_CHECK(0U != Storage_IsErased(s_read, STORAGE_SIZE));
+    TEST_CHECK(64 == s_storage->ReadData(0U, s_read, 64U));
+    TEST_CHECK(0 == memcmp(s_data, s_read, 64U));
+    TEST_CHECK(ARM_STORAGE_ERROR_NOT_PROGRAMMABLE == s_storage->ProgramData(0U, s_data, PROGRAM_UNIT));
+    TEST_CHECK(64 == s_storage->ProgramData(64U, s_data, 64U));
+    TEST_CHECK(64 == s_storage->ProgramData(STORAGE_SIZE, s_data, 64U));
+
+    /* The unit programmed with 0xFF reads erased, so it is taken as erased */
+    TEST_CHECK((int32_t)PROGRAM_UNIT == s_storage->ProgramData(ERASE_UNIT, s_data, PROGRAM_UNIT));
+
+    /* Everything erased */
+    TEST_CHECK(1 == s_storage->EraseAll());
+
+    for (i = 0U; i < 2U; i++)
+    {
+        TEST_CHECK((int32_t)STORAGE_SIZE == s_storage->ReadData(i * STORAGE_SIZE, s_read, STORAGE_SIZE));
+        TEST_CHECK(0U != Storage_IsErased(s_read, STORAGE_SIZE));
+    }
+
+    TEST_CHECK(1 == s_storage->Uninitialize());
+}
+
+static void Test_Latency(void)
+{
+    STORAGE_HOST_Stats_t stats;
+    uint64_t start;
+    uint64_t programNs;
+    uint64_t eraseNs;
+
+    Storage_Open(STORAGE_SIZE, LATENCY_PROGRAM_US, LATENCY_ERASE_US, 1U, 0U);
+
+    start = Test_Nanoseconds();
+    TEST_CHECK(64 == s_storage->ProgramData(0U, s_data, 64U));
+    programNs = Test_Nanoseconds() - start;
+
+    start = Test_Nanoseconds();
+    TEST_CHECK((int32_t)(2U * ERASE_UNIT) == s_storage->Erase(0U, 2U * ERASE_UNIT));
+    eraseNs = Test_Nanoseconds() - start;
+
+    /* The call waits the modeled time: at least, and not grossly more */
+    TEST_CHECK(programNs >= (8U * LATENCY_PROGRAM_US * 1000ULL));
+    TEST_CHECK(eraseNs >= (2U * LATENCY_ERASE_US * 1000ULL));
+    TEST_CHECK(eraseNs < (20U * LATENCY_ERASE_US * 1000ULL));
+
+    STORAGE_HOST_GetStats(&stats);
+    TEST_CHECK(((8U * LATENCY_PROGRAM_US) + (2U * LATENCY_ERASE_US)) == stats.busyTimeUs);
+
+    (void)printf("injected latency: program 8 units %.2f ms (modeled %.2f), erase 2 units %.2f ms (modeled %.2f)\n",
+                 (double)programNs / 1e6, (8.0 * LATENCY_PROGRAM_US) / 1e3,
+                 (double)eraseNs / 1e6, (2.0 * LATENCY_ERASE_US) / 1e3);
+
+    TEST_CHECK(1 == s_storage->Uninitialize());
+}
+
+static void *Race_Caller(void *param)
+{
+    Race_Caller_t *caller;
+
+    caller = (Race_Caller_t *)param;
+
+    (void)pthread_barrier_wait(&s_raceStart);
+    caller->result = s_storage->ProgramData((uint64_t)caller->index * 64U, s_data, 64U);
+
+    return NULL;
+}
+
+static void Test_Async(void)
+{
+    ARM_STORAGE_STATUS status;
+    Race_Caller_t callers[RACE_THREADS];
+    pthread_t threads[RACE_THREADS];
+    uint32_t accepted;
+    uint32_t winner;
+    uint32_t i;
+
+    Storage_Open(STORAGE_SIZE, LATENCY_PROGRAM_US, LATENCY_ERASE_US, 1U, 1U);
+    s_callbacks = 0U;
+
+    TEST_CHECK(1U == s_storage->GetCapabilities().asynchronous_ops);
+
+    /* Returns at once, the worker waits 8 ms */
+    TEST_CHECK(ARM_DRIVER_OK == s_storage->ProgramData(0U, s_data, 64U));
+
+    status = s_storage->GetStatus();
+    TEST_CHECK(1U == status.busy);
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_storage->ReadData(0U, s_read, 64U));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_storage->ProgramData(ERASE_UNIT, s_data, 64U));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_storage->Erase(ERASE_UNIT, ERASE_UNIT));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_storage->EraseAll());
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_storage->PowerControl(ARM_POWER_OFF));
+
+    TEST_CHECK(1U == Storage_WaitCallback(1U));
+    TEST_CHECK(64 == s_callbackStatus);
+    TEST_CHECK(ARM_STORAGE_OPERATION_PROGRAM_DATA == s_callbackOperation);
+
+    status = s_storage->GetStatus();
+    TEST_CHECK((0U == status.busy) && (0U == status.error));
+    TEST_CHECK(64 == s_storage->ReadData(0U, s_read, 64U));
+    TEST_CHECK(0 == memcmp(s_data, s_read, 64U));
+
+    /* Refused at once, no callback */
+    TEST_CHECK(ARM_STORAGE_ERROR_NOT_PROGRAMMABLE == s_storage->ProgramData(0U, s_data, 64U));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_storage->Erase(0U, ERASE_UNIT));
+    TEST_CHECK(1U == Storage_WaitCallback(2U));
+    TEST_CHECK((int32_t)ERASE_UNIT == s_callbackStatus);
+    TEST_CHECK(ARM_STORAGE_OPERATION_ERASE == s_callbackOperation);
+    TEST_CHECK((int32_t)ERASE_UNIT == s_storage->ReadData(0U, s_read, ERASE_UNIT));
+    TEST_CHECK(0U != Storage_IsErased(s_read, ERASE_UNIT));
+
+    /* Callers racing for an idle driver: one program is started, the others see it busy */
+    TEST_CHECK(0 == pthread_barrier_init(&s_raceStart, NULL, RACE_THREADS));
+
+    for (i = 0U; i < RACE_THREADS; i++)
+    {
+        callers[i].index  = i;
+        callers[i].result = ARM_DRIVER_ERROR;
+        TEST_CHECK(0 == pthread_create(&threads[i], NULL, Race_Caller, &callers[i]));
+    }
+
+    accepted = 0U;
+    winner   = 0U;
+
+    for (i = 0U; i < RACE_THREADS; i++)
+    {
+        (void)pthread_join(threads[i], NULL);
+        accepted += (ARM_DRIVER_OK == callers[i].result) ? 1U : 0U;
+        winner    = (ARM_DRIVER_OK == callers[i].result) ? i : winner;
+        TEST_CHECK((ARM_DRIVER_OK == callers[i].result) || (ARM_DRIVER_ERROR_BUSY == callers[i].result));
+    }
+
+    (void)pthread_barrier_destroy(&s_raceStart);
+
+    TEST_CHECK(1U == accepted);
+    TEST_CHECK(1U == Storage_WaitCallback(3U));
+    TEST_CHECK(64 == s_callbackStatus);
+    TEST_CHECK((int32_t)ERASE_UNIT == s_storage->ReadData(0U, s_read, ERASE_UNIT));
+    TEST_CHECK(0 == memcmp(&s_read[winner * 64U], s_data, 64U));
+    TEST_CHECK(0U != Storage_IsErased(s_read, winner * 64U));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_storage->EraseAll());
+    TEST_CHECK(1U == Storage_WaitCallback(4U));
+    TEST_CHECK(ARM_DRIVER_OK == s_callbackStatus);
+    TEST_CHECK(ARM_STORAGE_OPERATION_ERASE_ALL == s_callbackOperation);
+
+    TEST_CHECK(1 == s_storage->Uninitialize());
+    TEST_CHECK(4U == s_callbacks);
+}
+
+int main(void)
+{
+    int fd;
+    uint32_t i;
+
+    fd = mkstemp(s_path);
+    TEST_CHECK(fd >= 0);
+    (void)close(fd);
+
+    for (i = 0U; i < sizeof(s_data); i++)
+    {
+        s_data[i] = (uint8_t)((i * 29U) + 3U);
+    }
+
+    Test_Configure();
+    Test_Sync();
+    Test_Latency();
+    Test_Async();
+
+    (void)unlink(s_path);
+
+    return Test_Report("Test_Storage");
+}
@@ -0,0 +1,239 @@
+/*******************************************************************************
+ * @file    Test_Usart.c
+ * @brief   Loopback test of the LPUART CMSIS USART driver C file.
+ *
+ * Driver_USART1 runs against the LPUART / eDMA host models with the
+ * internal loopback enabled:
+ * - variable-length frames into the circular idle-line RX buffer, checked
+ *   byte for byte through the free-running GetRxCount();
+ * - interrupt count per frame independent of the frame length;
+ * - a single-shot transfer longer than one DMA major loop (chunking).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include <stdlib.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "Driver_USART_S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define USART_RING_SIZE     (256U)
+#define USART_FRAMES        (2000U)
+#define USART_FRAME_MAX     (200U)
+#define USART_LONG_SIZE     (70000U)    /**< Three DMA major loops */
+#define USART_BAUD          (4000000UL)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_USART * const s_usart = &Driver_USART1;
+
+static uint8_t  s_ring[USART_RING_SIZE];
+static uint8_t  s_frame[USART_FRAME_MAX];
+static uint8_t  s_longTx[USART_LONG_SIZE];
+static uint8_t  s_longRx[USART_LONG_SIZE];
+static uint32_t s_events;
+static uint32_t s_timeouts;
+static uint32_t s_sendComplete;
+static uint32_t s_txComplete;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Usart_Event(uint32_t event)
+{
+    s_events |= event;
+
+    if (0U != (event & ARM_USART_EVENT_RX_TIMEOUT))
+    {
+        s_timeouts++;
+    }
+    else
+    {
+        /* Not an idle line */
+    }
+
+    if (0U != (event & ARM_USART_EVENT_SEND_COMPLETE))
+    {
+        s_sendComplete++;
+    }
+    else
+    {
+        /* Not the end of a send */
+    }
+
+    if (0U != (event & ARM_USART_EVENT_TX_COMPLETE))
+    {
+        s_txComplete++;
+    }
+    else
+    {
+        /* Transmitter still busy */
+    }
+}
+
+/* Frames of random length, read back out of the ring after each idle line */
+static void Test_CircularFrames(void)
+{
+    uint32_t frame;
+    uint32_t length;
+    uint32_t index;
+    uint32_t readCount;
+    uint32_t rxCount;
+    uint32_t mismatches;
+    uint32_t irqBefore;
+    uint32_t irqShort;
+    uint32_t irqLong;
+    uint32_t bytes;
+
+    readCount  = 0U;
+    mismatches = 0U;
+    bytes      = 0U;
+    irqShort   = 0U;
+    irqLong    = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(USART_CONTROL_RX_CIRCULAR, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_ring, USART_RING_SIZE));
+
+    for (frame = 0U; frame < USART_FRAMES; frame++)
+    {
+        /* Alternate short and long frames to compare their interrupt cost */
+        length = (0U == (frame & 1U)) ? (1U + ((uint32_t)rand() % 8U)) :
+                                        (120U + ((uint32_t)rand() % (USART_FRAME_MAX - 120U)));
+
+        for (index = 0U; index < length; index++)
+        {
+            s_frame[index] = (uint8_t)rand();
+        }
+
+        s_timeouts = 0U;
+        irqBefore  = Fake_LPUART_GetInterruptCount(HAL_LPUART_1) + Fake_DMA_GetInterruptCount();
+
+        TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_frame, length));
+        Fake_LPUART_Run(HAL_LPUART_1, length + 4U);
+
+        if ((0U == (frame & 1U)) && (length >= 3U))
+        {
+            irqShort += Fake_LPUART_GetInterruptCount(HAL_LPUART_1) + Fake_DMA_GetInterruptCount() - irqBefore;
+        }
+        else if (0U != (frame & 1U))
+        {
+            irqLong += Fake_LPUART_GetInterruptCount(HAL_LPUART_1) + Fake_DMA_GetInterruptCount() - irqBefore;
+        }
+        else
+        {
+            /* Frames of 1 - 2 bytes may merge their idle with TC */
+        }
+
+        TEST_CHECK(1U == s_timeouts);
+        TEST_CHECK(0U == s_usart->GetStatus().tx_busy);
+
+        rxCount = s_usart->GetRxCount();
+        TEST_CHECK((rxCount - readCount) == length);
+
+        for (index = 0U; index < length; index++)
+        {
+            if (s_ring[(readCount + index) % USART_RING_SIZE] != s_frame[index])
+            {
+                mismatches++;
+            }
+            else
+            {
+                /* Byte matches */
+            }
+        }
+
+        readCount = rxCount;
+        bytes    += length;
+    }
+
+    TEST_CHECK(0U == mismatches);
+    TEST_CHECK(0U == (s_events & ARM_USART_EVENT_RX_OVERFLOW));
+    TEST_CHECK(USART_FRAMES == s_txComplete);
+
+    /*
+     * Per frame: TX DMA done, TC, idle line, plus one RX DMA interrupt per
+     * half buffer crossed; none of it scales with the bytes in the frame.
+     */
+    (void)printf("circular: %u frames, %u bytes, %u interrupts on long frames, %u on short ones\n",
+                 (unsigned)USART_FRAMES, (unsigned)bytes, (unsigned)irqLong, (unsigned)irqShort);
+    TEST_CHECK(irqLong <= ((USART_FRAMES / 2U) * 3U) + ((bytes * 2U) / USART_RING_SIZE) + 1U);
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_ABORT_RECEIVE, 0U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(USART_CONTROL_RX_CIRCULAR, 0U));
+}
+
+/* One transfer longer than a major loop, in both directions */
+static void Test_LongTransfer(void)
+{
+    uint32_t index;
+
+    for (index = 0U; index < USART_LONG_SIZE; index++)
+    {
+        s_longTx[index] = (uint8_t)(index * 7U);
+    }
+
+    s_events       = 0U;
+    s_sendComplete = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_longRx, USART_LONG_SIZE));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_longTx, USART_LONG_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_usart->Send(s_longTx, 1U));
+
+    Fake_LPUART_Run(HAL_LPUART_1, USART_LONG_SIZE / 2U);
+    TEST_CHECK(s_usart->GetTxCount() == (USART_LONG_SIZE / 2U));
+    TEST_CHECK(s_usart->GetRxCount() == (USART_LONG_SIZE / 2U));
+
+    Fake_LPUART_Run(HAL_LPUART_1, (USART_LONG_SIZE / 2U) + 4U);
+
+    TEST_CHECK(1U == s_sendComplete);
+    TEST_CHECK(0U != (s_events & ARM_USART_EVENT_RECEIVE_COMPLETE));
+    TEST_CHECK(USART_LONG_SIZE == s_usart->GetTxCount());
+    TEST_CHECK(USART_LONG_SIZE == s_usart->GetRxCount());
+    TEST_CHECK(0 == memcmp(s_longTx, s_longRx, USART_LONG_SIZE));
+    TEST_CHECK(0U == s_usart->GetStatus().rx_busy);
+}
+
+/* Nobody receiving: the looped-back bytes overrun */
+static void Test_Overrun(void)
+{
+    s_events = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_frame, 4U));
+    Fake_LPUART_Run(HAL_LPUART_1, 8U);
+
+    TEST_CHECK(0U != (s_events & ARM_USART_EVENT_RX_OVERFLOW));
+}
+
+int main(void)
+{
+    srand(26U);
+    Fake_DMA_Reset();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Initialize(Usart_Event));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Send(s_frame, 1U));
+    TEST_CHECK(ARM_USART_ERROR_BAUDRATE == s_usart->Control(ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_8 |
+                                                            ARM_USART_PARITY_NONE | ARM_USART_STOP_BITS_1,
+                                                            20000000UL));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_8 |
+                                                 ARM_USART_PARITY_NONE | ARM_USART_STOP_BITS_1, USART_BAUD));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_CONTROL_TX, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_CONTROL_RX, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(USART_CONTROL_LOOPBACK, 1U));
+
+    Test_CircularFrames();
+    Test_LongTransfer();
+    Test_Overrun();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Uninitialize());
+
+    return Test_Report("Test_Usart");
+}
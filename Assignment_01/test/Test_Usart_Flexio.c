@@ -0,0 +1,392 @@
+/*******************************************************************************
+ * @file    Test_Usart_Flexio.c
+ * @brief   CMSIS USART driver on FlexIO against the FlexIO / eDMA models C file.
+ *
+ * Driver_USART3 runs through its CMSIS table with FXIO_D2 (TX) wired to
+ * FXIO_D3 (RX): 8N1 control checks, transfers in both directions with
+ * GetTxCount / GetRxCount on the way, a transfer longer than one DMA major
+ * loop, aborts, the circular receive buffer and a framing error. The report
+ * gives, per bit rate, the line time of a transfer and the interrupts it
+ * took, with no CPU work per byte.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Test_Common.h"
+#include "Fake_HAL.h"
+#include "Driver_USART_S32K144.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FXUART_TX_PIN       (2U)            /**< FXIO_D2, PTA0 */
+#define FXUART_RX_PIN       (3U)            /**< FXIO_D3, PTA1 */
+
+#define FXUART_MODE_8N1     (ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_8 | \
+                             ARM_USART_PARITY_NONE | ARM_USART_STOP_BITS_1)
+#define FXUART_BAUD         (3000000UL)     /**< 8 FlexIO clocks per half bit */
+#define FXUART_FRAME_CLOCKS (10U * 16U)     /**< Start + 8 data + stop bits   */
+#define FXUART_SIZE         (256U)
+#define FXUART_LONG_SIZE    (40000U)        /**< Two DMA major loops */
+#define FXUART_RING_SIZE    (64U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ARM_DRIVER_USART * const s_usart = &Driver_USART3;
+
+static uint8_t  s_tx[FXUART_LONG_SIZE];
+static uint8_t  s_rx[FXUART_LONG_SIZE];
+static uint8_t  s_ring[FXUART_RING_SIZE];
+static uint32_t s_events;
+static uint32_t s_sendComplete;
+static uint32_t s_receiveComplete;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void Usart_Event(uint32_t event)
+{
+    s_events |= event;
+
+    if (0U != (event & ARM_USART_EVENT_SEND_COMPLETE))
+    {
+        s_sendComplete++;
+    }
+    else
+    {
+        /* Not the end of a send */
+    }
+
+    if (0U != (event & ARM_USART_EVENT_RECEIVE_COMPLETE))
+    {
+        s_receiveComplete++;
+    }
+    else
+    {
+        /* Not the end of a receive */
+    }
+}
+
+static void Usart_Fill(uint32_t size, uint32_t seed)
+{
+    uint32_t index;
+
+    for (index = 0U; index < size; index++)
+    {
+        s_tx[index] = (uint8_t)((index * 29U) + seed);
+        s_rx[index] = 0U;
+    }
+}
+
+/* Run the model until the transmitter went idle; returns the clocks spent */
+static uint32_t Usart_Drain(uint32_t limit)
+{
+    uint32_t clocks;
+
+    for (clocks = 0U; (0U != s_usart->GetStatus().tx_busy) && (clocks < limit); clocks++)
+    {
+        Fake_FLEXIO_Run(1U);
+    }
+
+    /* The last frame still leaves the shifter */
+    Fake_FLEXIO_Run(FXUART_FRAME_CLOCKS);
+
+    return clocks + FXUART_FRAME_CLOCKS;
+}
+
+static void Test_Control(void)
+{
+    ARM_USART_CAPABILITIES capabilities;
+
+    capabilities = s_usart->GetCapabilities();
+    TEST_CHECK(1U == capabilities.asynchronous);
+    TEST_CHECK(0U == capabilities.synchronous_master);
+
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Initialize(Usart_Event));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Control(FXUART_MODE_8N1, FXUART_BAUD));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->PowerControl(ARM_POWER_FULL));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_usart->PowerControl(ARM_POWER_LOW));
+
+    /* Not configured yet */
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Send(s_tx, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Control(ARM_USART_CONTROL_TX, 1U));
+
+    /* The shifters move 8N1 only */
+    TEST_CHECK(ARM_USART_ERROR_DATA_BITS == s_usart->Control(ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_7 |
+                                                             ARM_USART_PARITY_NONE | ARM_USART_STOP_BITS_1,
+                                                             FXUART_BAUD));
+    TEST_CHECK(ARM_USART_ERROR_PARITY == s_usart->Control(ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_8 |
+                                                          ARM_USART_PARITY_EVEN | ARM_USART_STOP_BITS_1,
+                                                          FXUART_BAUD));
+    TEST_CHECK(ARM_USART_ERROR_STOP_BITS == s_usart->Control(ARM_USART_MODE_ASYNCHRONOUS | ARM_USART_DATA_BITS_8 |
+                                                             ARM_USART_PARITY_NONE | ARM_USART_STOP_BITS_2,
+                                                             FXUART_BAUD));
+    TEST_CHECK(ARM_USART_ERROR_MODE == s_usart->Control(ARM_USART_MODE_SYNCHRONOUS_MASTER, FXUART_BAUD));
+
+    /* Half bit period of 1 ... 256 FlexIO clocks, within 3 % */
+    TEST_CHECK(ARM_USART_ERROR_BAUDRATE == s_usart->Control(FXUART_MODE_8N1, 0U));
+    TEST_CHECK(ARM_USART_ERROR_BAUDRATE == s_usart->Control(FXUART_MODE_8N1, 30000000UL));
+    TEST_CHECK(ARM_USART_ERROR_BAUDRATE == s_usart->Control(FXUART_MODE_8N1, 50000UL));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(FXUART_MODE_8N1, 115200UL));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(FXUART_MODE_8N1, FXUART_BAUD));
+
+    /* No FlexIO equivalent */
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_usart->Control(USART_CONTROL_LOOPBACK, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_usart->Control(ARM_USART_CONTROL_BREAK, 1U));
+
+    /* Enabled directions only */
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Send(s_tx, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Receive(s_rx, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_CONTROL_TX, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_CONTROL_RX, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_usart->Send(NULL, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_usart->Receive(s_rx, 0U));
+    TEST_CHECK(ARM_DRIVER_ERROR_UNSUPPORTED == s_usart->Transfer(s_tx, s_rx, 1U));
+}
+
+static void Test_Transfer(void)
+{
+    uint32_t frames;
+    uint32_t busy;
+
+    Usart_Fill(FXUART_SIZE, 1U);
+    s_events          = 0U;
+    s_sendComplete    = 0U;
+    s_receiveComplete = 0U;
+    frames = Fake_FLEXIO_GetFrameCount(FXUART_TX_PIN);
+    busy   = Fake_FLEXIO_GetBusyClocks(FXUART_TX_PIN);
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, FXUART_SIZE));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, FXUART_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_usart->Send(s_tx, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_usart->Receive(s_rx, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_usart->Control(FXUART_MODE_8N1, FXUART_BAUD));
+
+    /* 100 frames on the line, the next one waiting in the buffer */
+    Fake_FLEXIO_Run(100U * FXUART_FRAME_CLOCKS);
+    TEST_CHECK(100U == s_usart->GetRxCount());
+    TEST_CHECK(101U == s_usart->GetTxCount());
+    TEST_CHECK(1U == s_usart->GetStatus().tx_busy);
+    TEST_CHECK(1U == s_usart->GetStatus().rx_busy);
+
+    (void)Usart_Drain(FXUART_SIZE * FXUART_FRAME_CLOCKS);
+
+    TEST_CHECK(1U == s_sendComplete);
+    TEST_CHECK(1U == s_receiveComplete);
+    TEST_CHECK(FXUART_SIZE == s_usart->GetTxCount());
+    TEST_CHECK(FXUART_SIZE == s_usart->GetRxCount());
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, FXUART_SIZE));
+    TEST_CHECK(0U == s_usart->GetStatus().rx_busy);
+    TEST_CHECK(0U == s_usart->GetStatus().rx_framing_error);
+
+    /* 8N1 at the configured rate, start and stop bits included */
+    TEST_CHECK((frames + FXUART_SIZE) == Fake_FLEXIO_GetFrameCount(FXUART_TX_PIN));
+    TEST_CHECK((busy + (FXUART_SIZE * FXUART_FRAME_CLOCKS)) == Fake_FLEXIO_GetBusyClocks(FXUART_TX_PIN));
+    TEST_CHECK(s_tx[FXUART_SIZE - 1U] == Fake_FLEXIO_GetLastFrame(FXUART_TX_PIN));
+}
+
+/* Longer than a major loop: the second chunk continues where the first ended */
+static void Test_LongTransfer(void)
+{
+    Usart_Fill(FXUART_LONG_SIZE, 7U);
+    s_sendComplete    = 0U;
+    s_receiveComplete = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, FXUART_LONG_SIZE));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, FXUART_LONG_SIZE));
+
+    Fake_FLEXIO_Run(35000U * FXUART_FRAME_CLOCKS);
+    TEST_CHECK(35000U == s_usart->GetRxCount());
+    TEST_CHECK(0U == s_sendComplete);
+
+    (void)Usart_Drain(FXUART_LONG_SIZE * FXUART_FRAME_CLOCKS);
+
+    TEST_CHECK(1U == s_sendComplete);
+    TEST_CHECK(1U == s_receiveComplete);
+    TEST_CHECK(FXUART_LONG_SIZE == s_usart->GetRxCount());
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, FXUART_LONG_SIZE));
+}
+
+static void Test_Abort(void)
+{
+    uint32_t txCount;
+    uint32_t rxCount;
+
+    Usart_Fill(FXUART_SIZE, 3U);
+    s_sendComplete    = 0U;
+    s_receiveComplete = 0U;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, FXUART_SIZE));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, FXUART_SIZE));
+    Fake_FLEXIO_Run(40U * FXUART_FRAME_CLOCKS);
+
+    /* The bytes already handed to FlexIO still go out */
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_ABORT_SEND, 0U));
+    TEST_CHECK(0U == s_usart->GetStatus().tx_busy);
+    txCount = s_usart->GetTxCount();
+    TEST_CHECK((txCount > 40U) && (txCount < FXUART_SIZE));
+
+    Fake_FLEXIO_Run(10U * FXUART_FRAME_CLOCKS);
+    TEST_CHECK(txCount == s_usart->GetTxCount());
+    TEST_CHECK(txCount == s_usart->GetRxCount());
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_ABORT_RECEIVE, 0U));
+    TEST_CHECK(0U == s_usart->GetStatus().rx_busy);
+    rxCount = s_usart->GetRxCount();
+    TEST_CHECK(txCount == rxCount);
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, rxCount));
+    TEST_CHECK((0U == s_sendComplete) && (0U == s_receiveComplete));
+
+    /* Both directions start over */
+    Usart_Fill(16U, 5U);
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, 16U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, 16U));
+    (void)Usart_Drain(16U * FXUART_FRAME_CLOCKS);
+
+    TEST_CHECK(16U == s_usart->GetRxCount());
+    TEST_CHECK(0 == memcmp(s_tx, s_rx, 16U));
+}
+
+/* Free-running count over the ring, read back frame by frame */
+static void Test_Circular(void)
+{
+    uint32_t frame;
+    uint32_t length;
+    uint32_t index;
+    uint32_t readCount;
+    uint32_t mismatches;
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(USART_CONTROL_RX_CIRCULAR, 1U));
+    TEST_CHECK(ARM_DRIVER_ERROR_PARAMETER == s_usart->Receive(s_ring, 1U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_ring, FXUART_RING_SIZE));
+    TEST_CHECK(ARM_DRIVER_ERROR_BUSY == s_usart->Control(USART_CONTROL_RX_CIRCULAR, 0U));
+
+    readCount  = 0U;
+    mismatches = 0U;
+
+    for (frame = 0U; frame < 50U; frame++)
+    {
+        length = 1U + ((frame * 13U) % 40U);
+        Usart_Fill(length, frame);
+
+        TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, length));
+        (void)Usart_Drain(length * FXUART_FRAME_CLOCKS);
+
+        TEST_CHECK((s_usart->GetRxCount() - readCount) == length);
+
+        for (index = 0U; index < length; index++)
+        {
+            mismatches += (s_ring[(readCount + index) % FXUART_RING_SIZE] == s_tx[index]) ? 0U : 1U;
+        }
+
+        readCount += length;
+    }
+
+    TEST_CHECK(0U == mismatches);
+    TEST_CHECK(1U == s_usart->GetStatus().rx_busy);
+
+    /* Aborting keeps the free-running count */
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(ARM_USART_ABORT_RECEIVE, 0U));
+    TEST_CHECK(readCount == s_usart->GetRxCount());
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(USART_CONTROL_RX_CIRCULAR, 0U));
+}
+
+/* A bad stop bit during a receive is reported, outside one it is dropped */
+static void Test_FramingError(void)
+{
+    s_events = 0U;
+    Usart_Fill(4U, 9U);
+
+    Fake_FLEXIO_CorruptNext(FXUART_TX_PIN);
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, 4U));
+    (void)Usart_Drain(4U * FXUART_FRAME_CLOCKS);
+    TEST_CHECK(0U == (s_events & ARM_USART_EVENT_RX_FRAMING_ERROR));
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, 4U));
+    TEST_CHECK(0U == s_usart->GetStatus().rx_framing_error);
+    Fake_FLEXIO_CorruptNext(FXUART_TX_PIN);
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, 4U));
+    (void)Usart_Drain(4U * FXUART_FRAME_CLOCKS);
+
+    TEST_CHECK(0U != (s_events & ARM_USART_EVENT_RX_FRAMING_ERROR));
+    TEST_CHECK(1U == s_usart->GetStatus().rx_framing_error);
+    TEST_CHECK(4U == s_usart->GetRxCount());
+
+    /* Frames that came in with no receive active are not delivered later */
+    Usart_Fill(4U, 11U);
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, 4U));
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, 4U));
+    (void)Usart_Drain(4U * FXUART_FRAME_CLOCKS);
+    TEST_CHECK(0U == memcmp(s_tx, s_rx, 4U));
+    TEST_CHECK(0U == s_usart->GetStatus().rx_framing_error);
+}
+
+static void Test_Report_Rates(void)
+{
+    static const uint32_t rates[] = { 115200UL, 1000000UL, FXUART_BAUD, 6000000UL };
+    static const uint32_t sizes[] = { 16U, 1024U };
+    uint32_t rate;
+    uint32_t size;
+    uint32_t clocks;
+    uint32_t irqs;
+
+    (void)printf("    baud   bytes  line time  kbyte/s  interrupts\n");
+
+    for (rate = 0U; rate < (sizeof(rates) / sizeof(rates[0])); rate++)
+    {
+        TEST_CHECK(ARM_DRIVER_OK == s_usart->Control(FXUART_MODE_8N1, rates[rate]));
+
+        for (size = 0U; size < (sizeof(sizes) / sizeof(sizes[0])); size++)
+        {
+            Usart_Fill(sizes[size], rate);
+            s_receiveComplete = 0U;
+            irqs = Fake_FLEXIO_GetInterruptCount() + Fake_DMA_GetInterruptCount();
+
+            TEST_CHECK(ARM_DRIVER_OK == s_usart->Receive(s_rx, sizes[size]));
+            TEST_CHECK(ARM_DRIVER_OK == s_usart->Send(s_tx, sizes[size]));
+
+            for (clocks = 0U; (0U == s_receiveComplete) && (clocks < 100000000UL); clocks++)
+            {
+                Fake_FLEXIO_Run(1U);
+            }
+
+            irqs = Fake_FLEXIO_GetInterruptCount() + Fake_DMA_GetInterruptCount() - irqs;
+
+            TEST_CHECK(0 == memcmp(s_tx, s_rx, sizes[size]));
+            TEST_CHECK(0U == s_usart->GetStatus().tx_busy);
+
+            /* TX major loop, shifter taking the last byte, RX major loop */
+            TEST_CHECK(3U == irqs);
+
+            (void)printf("%8u  %6u  %6.0f us  %7.1f  %10u\n", (unsigned)rates[rate], (unsigned)sizes[size],
+                         ((double)clocks * 1e6) / HAL_FLEXIO_CLOCK_HZ,
+                         ((double)sizes[size] * HAL_FLEXIO_CLOCK_HZ) / ((double)clocks * 1000.0), (unsigned)irqs);
+        }
+    }
+}
+
+int main(void)
+{
+    Fake_DMA_Reset();
+    Fake_FLEXIO_Reset();
+    Fake_FLEXIO_Connect(FXUART_TX_PIN, FXUART_RX_PIN);
+
+    Test_Control();
+    Test_Transfer();
+    Test_LongTransfer();
+    Test_Abort();
+    Test_Circular();
+    Test_FramingError();
+    Test_Report_Rates();
+
+    TEST_CHECK(ARM_DRIVER_OK == s_usart->Uninitialize());
+    TEST_CHECK(ARM_DRIVER_ERROR == s_usart->Send(s_tx, 1U));
+
+    return Test_Report("Test_Usart_Flexio");
+}
@@ -0,0 +1,314 @@
+/*******************************************************************************
+ * @file    Fake_HAL.h
+ * @brief   Host models behind the HAL APIs header file.
+ *
+ * The drivers are linked against these instead of the register-level HAL
+ * sources. Each model keeps the state the real peripheral would, and the
+ * test advances it explicitly (a DMA request, a character time on the
+ * wire, ...), calling the driver callbacks / IRQ handlers synchronously
+ * the way the NVIC would preempt the main loop.
+ *
+ * Memory addresses travel through the HAL as uint32_t, so the tests are
+ * linked as non-PIE executables: static buffers then sit below 4 GiB.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef FAKE_HAL_H_
+#define FAKE_HAL_H_
+
+#include <stdint.h>
+#include "HAL_DMA.h"
+#include "HAL_LPUART.h"
+#include "HAL_LPSPI.h"
+#include "HAL_FLEXCAN.h"
+#include "HAL_FTFC.h"
+#include "HAL_CRC.h"
+#include "HAL_FTM.h"
+#include "HAL_FLEXIO.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FAKE_PTR(address)       ((void *)(uintptr_t)(address))
+
+/*
+ * Cost model of the cycle-based peripheral models, in 48 MHz core clocks.
+ * Estimates from the Cortex-M4 / eDMA documentation, not measurements:
+ * exception entry 12 cycles and return 10, a peripheral register access
+ * through the bridge with the surrounding loop about 6, and an eDMA
+ * minor loop of one read and one write on the bridge about 8.
+ */
+#define FAKE_IRQ_ENTRY_CYCLES       (12U)
+#define FAKE_IRQ_EXIT_CYCLES        (10U)
+#define FAKE_FIFO_ACCESS_CYCLES     (6U)
+#define FAKE_DMA_SERVICE_CYCLES     (8U)
+
+/*
+ * Flash timing in microseconds, typical figures in the order of the
+ * S32K1xx data sheet, not measurements: a 32-bit EEPROM record, a 2 KB
+ * D-Flash sector erase and an 8-byte phrase program.
+ */
+#define FAKE_FTFC_EEE_RECORD_US     (385U)
+#define FAKE_FTFC_ERASE_SECTOR_US   (12000U)
+#define FAKE_FTFC_PROGRAM_PHRASE_US (90U)
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*******************************************************************************
+ * @brief   eDMA: forget every channel.
+ ******************************************************************************/
+void Fake_DMA_Reset(void);
+
+/*******************************************************************************
+ * @brief   eDMA: a peripheral raises its DMA request once.
+ *
+ * Runs one minor loop on the channel routed to source, if its request is
+ * enabled, and calls the channel callback for half / major completion.
+ *
+ * @return  1 serviced, 0 no enabled channel for the source.
+ ******************************************************************************/
+uint8_t Fake_DMA_Request(dma_request_source_t source);
+
+/*******************************************************************************
+ * @brief   eDMA: channel callbacks called so far (= DMA interrupts).
+ ******************************************************************************/
+uint32_t Fake_DMA_GetInterruptCount(void);
+
+/*******************************************************************************
+ * @brief   eDMA: call hook after each engine write to address, for a model
+ *          whose data register takes the written value at once.
+ ******************************************************************************/
+void Fake_DMA_SetWriteHook(uint32_t address, void (*hook)(void));
+
+/*******************************************************************************
+ * @brief   eDMA: call hook after each engine read or write inside a window
+ *          of registers, for a model whose flags follow the accesses.
+ ******************************************************************************/
+void Fake_DMA_SetWindowHook(uint32_t base, uint32_t size, void (*hook)(uint32_t address, uint8_t write));
+
+/*******************************************************************************
+ * @brief   LPUART: advance one instance by a number of character times.
+ *
+ * Per character time the transmitter takes one byte by DMA (if enabled),
+ * the byte reaches the receiver when looped back, the receiver hands it
+ * to its DMA channel (overrun if nobody takes it). IDLE is raised after
+ * idleChars silent character times following a received byte, TC once
+ * the transmitter runs dry; enabled flags enter the IRQ handler.
+ ******************************************************************************/
+void Fake_LPUART_Run(HAL_LPUART_Instance_t instance, uint32_t charTimes);
+
+/*******************************************************************************
+ * @brief   LPUART: bytes put on the wire by the transmitter so far.
+ ******************************************************************************/
+uint32_t Fake_LPUART_GetTxCount(HAL_LPUART_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   LPUART: IRQ handler entries so far.
+ ******************************************************************************/
+uint32_t Fake_LPUART_GetInterruptCount(HAL_LPUART_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   LPSPI: advance one instance by a number of 48 MHz cycles.
+ ******************************************************************************/
+void Fake_LPSPI_Run(HAL_LPSPI_Instance_t instance, uint32_t cycles);
+
+/*******************************************************************************
+ * @brief   LPSPI: cycles the shifter spent moving bits so far.
+ ******************************************************************************/
+uint32_t Fake_LPSPI_GetShiftCycles(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   LPSPI: PCS negations so far / PCS level now.
+ ******************************************************************************/
+uint32_t Fake_LPSPI_GetCsReleases(HAL_LPSPI_Instance_t instance);
+uint8_t Fake_LPSPI_IsCsAsserted(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   LPSPI: IRQ handler entries so far.
+ ******************************************************************************/
+uint32_t Fake_LPSPI_GetInterruptCount(HAL_LPSPI_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FlexCAN: advance one instance by a number of bit times.
+ *
+ * The bus arbitrates between the pending TX mailboxes and the frames queued
+ * by the other node whenever it is idle; at the end of a frame the TX flag
+ * is raised, the frame is received (own frames in self reception / loopback
+ * only) and enabled flags enter the IRQ handler. Frozen: nothing moves.
+ ******************************************************************************/
+void Fake_FLEXCAN_Run(HAL_FLEXCAN_Instance_t instance, uint32_t bitTimes);
+
+/*******************************************************************************
+ * @brief   FlexCAN: queue a data frame from the other node on the bus.
+ *
+ * @param   id      CMSIS identifier (ARM_CAN_EXTENDED_ID() for 29 bits).
+ * @return  1 queued, 0 queue full.
+ ******************************************************************************/
+uint8_t Fake_FLEXCAN_Inject(HAL_FLEXCAN_Instance_t instance, uint32_t id, const uint8_t *data, uint8_t dlc);
+
+/*******************************************************************************
+ * @brief   FlexCAN: frames of the other node not yet on the bus.
+ ******************************************************************************/
+uint32_t Fake_FLEXCAN_GetRemotePending(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FlexCAN: frames put on the bus so far / identifier of the n-th one
+ *          (the last 256 are kept).
+ ******************************************************************************/
+uint32_t Fake_FLEXCAN_GetLogCount(HAL_FLEXCAN_Instance_t instance);
+uint32_t Fake_FLEXCAN_GetLogId(HAL_FLEXCAN_Instance_t instance, uint32_t index);
+
+/*******************************************************************************
+ * @brief   FlexCAN: bit times run so far and bit times with a frame on the bus.
+ ******************************************************************************/
+void Fake_FLEXCAN_GetBusLoad(HAL_FLEXCAN_Instance_t instance, uint32_t *busBits, uint32_t *busyBits);
+
+/*******************************************************************************
+ * @brief   FlexCAN: frames lost to RX FIFO overflow or mailbox overrun.
+ ******************************************************************************/
+uint32_t Fake_FLEXCAN_GetLostCount(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FlexCAN: message buffer IRQ handler entries so far.
+ ******************************************************************************/
+uint32_t Fake_FLEXCAN_GetInterruptCount(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FlexCAN: last programmed nominal (CBT) and data phase (FDCBT) bit
+ *          timing, bit rate switching enabled, TDC offset (0 = off).
+ ******************************************************************************/
+void Fake_FLEXCAN_GetTiming(HAL_FLEXCAN_Instance_t instance, HAL_FLEXCAN_Timing_t *nominal,
+                            HAL_FLEXCAN_Timing_t *data);
+uint8_t Fake_FLEXCAN_GetBrs(HAL_FLEXCAN_Instance_t instance);
+uint8_t Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FTFC: power-on state, FlexNVM erased.
+ *
+ * Maps the FlexRAM page and the D-Flash at their system addresses on the
+ * first call.
+ *
+ * @param   partitioned     1 = 4 KB emulated EEPROM, FlexRAM loaded at
+ *                          reset; 0 = FlexNVM all D-Flash.
+ ******************************************************************************/
+void Fake_FTFC_Reset(uint8_t partitioned);
+
+/*******************************************************************************
+ * @brief   FTFC: whether FlexRAM and D-Flash could be mapped at their
+ *          addresses.
+ ******************************************************************************/
+uint8_t Fake_FTFC_IsMapped(void);
+
+/*******************************************************************************
+ * @brief   FTFC: advance by a number of microseconds.
+ *
+ * Completes the D-Flash command or EEPROM record in progress when its time
+ * is up and enters the command complete callback if CCIE is set.
+ ******************************************************************************/
+void Fake_FTFC_Run(uint32_t us);
+
+/*******************************************************************************
+ * @brief   FTFC: microseconds run so far / EEPROM records written so far.
+ ******************************************************************************/
+uint32_t Fake_FTFC_GetTimeUs(void);
+uint32_t Fake_FTFC_GetRecordCount(void);
+
+/*******************************************************************************
+ * @brief   FTFC: the next EEPROM record fails with a verify error.
+ ******************************************************************************/
+void Fake_FTFC_FailNextRecord(void);
+
+/*******************************************************************************
+ * @brief   FTFC: the next D-Flash command fails with these HAL_FTFC_ERROR_xxx
+ *          bits and leaves the flash contents unchanged.
+ ******************************************************************************/
+void Fake_FTFC_FailNextCommand(uint8_t errors);
+
+/*******************************************************************************
+ * @brief   FTFC: FCCOB loads and launches made without owning the engine /
+ *          command code in FCCOB0.
+ ******************************************************************************/
+uint32_t Fake_FTFC_GetUnownedLoads(void);
+uint8_t Fake_FTFC_GetCommand(void);
+
+/*******************************************************************************
+ * @brief   CRC: register writes so far, by the CPU (bytes and words) and by
+ *          the eDMA (words).
+ ******************************************************************************/
+void Fake_CRC_GetWrites(uint32_t *cpuWrites, uint32_t *dmaWrites);
+
+/*******************************************************************************
+ * @brief   CRC: run the eDMA on the always-enabled request source until
+ *          no channel takes it.
+ *
+ * @return  Minor loops run.
+ ******************************************************************************/
+uint32_t Fake_CRC_RunDma(void);
+
+/*******************************************************************************
+ * @brief   FTM: encoder movement, counts signed, on the quadrature counter.
+ ******************************************************************************/
+void Fake_FTM_Move(HAL_FTM_Instance_t instance, int32_t counts);
+
+/*******************************************************************************
+ * @brief   FTM: edge on a capture channel input (index pulse).
+ ******************************************************************************/
+void Fake_FTM_Capture(HAL_FTM_Instance_t instance, uint8_t channel);
+
+/*******************************************************************************
+ * @brief   FTM: HAL_FTM_QUAD_xxx flags set by the driver.
+ ******************************************************************************/
+uint32_t Fake_FTM_GetQuadrature(HAL_FTM_Instance_t instance);
+
+/*******************************************************************************
+ * @brief   FlexIO: forget every shifter, timer and pin connection.
+ ******************************************************************************/
+void Fake_FLEXIO_Reset(void);
+
+/*******************************************************************************
+ * @brief   FlexIO: wire an output pin to an input pin (FXIO_Dn numbers).
+ ******************************************************************************/
+void Fake_FLEXIO_Connect(uint8_t outPin, uint8_t inPin);
+
+/*******************************************************************************
+ * @brief   FlexIO: advance by a number of FlexIO clocks.
+ *
+ * A transmit shifter whose timer runs in baud mode loads its buffer once
+ * it is full and drives the frame, start + data + stop bits of 2 *
+ * divider clocks each. At the end of the frame every receive shifter
+ * wired to that pin, and timed, stores the data bits; the error flag is
+ * set on an overrun or a corrupted frame. Status flags raise the DMA
+ * requests of their shifters, enabled flags enter the callbacks.
+ ******************************************************************************/
+void Fake_FLEXIO_Run(uint32_t clocks);
+
+/*******************************************************************************
+ * @brief   FlexIO: the next frame driven on pin arrives with a bad stop bit
+ *          (receive error flag: framing error, lost data).
+ ******************************************************************************/
+void Fake_FLEXIO_CorruptNext(uint8_t pin);
+
+/*******************************************************************************
+ * @brief   FlexIO: frames driven on a pin so far, clocks spent on them, data
+ *          bits of the last one (first bit on the wire in bit 0).
+ ******************************************************************************/
+uint32_t Fake_FLEXIO_GetFrameCount(uint8_t pin);
+uint32_t Fake_FLEXIO_GetBusyClocks(uint8_t pin);
+uint32_t Fake_FLEXIO_GetLastFrame(uint8_t pin);
+
+/*******************************************************************************
+ * @brief   FlexIO: interrupt handler entries so far.
+ ******************************************************************************/
+uint32_t Fake_FLEXIO_GetInterruptCount(void);
+
+/*******************************************************************************
+ * @brief   GPIO: output level last written to a pin.
+ ******************************************************************************/
+uint8_t Fake_GPIO_GetPin(uint8_t port, uint8_t pin);
+
+#endif /* FAKE_HAL_H_ */
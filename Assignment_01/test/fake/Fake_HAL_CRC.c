@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * @file    Fake_HAL_CRC.c
+ * @brief   Host model of the CRC module behind the HAL_CRC API C file.
+ *
+ * The CRC register shifts data MSB first through the generator
+ * polynomial, with the written data transposed by TOT and the read
+ * result transposed by TOTR, then complemented by FXOR. The seed is
+ * loaded untransposed. Words written by the eDMA reach the model through
+ * the DMA write hook on the data register.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef struct
+{
+    HAL_CRC_Config_t    config;
+    uint32_t            crc;            /**< Left aligned for CRC-16 */
+    uint32_t            cpuWrites;
+    uint32_t            dmaWrites;
+} CRC_Model_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static CRC_Model_t s_crc;
+static volatile uint32_t s_dataRegister;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t CRC_Transpose(uint32_t value, uint8_t transpose)
+{
+    uint32_t result;
+    uint32_t i;
+
+    result = value;
+
+    if ((HAL_CRC_TRANSPOSE_BITS == transpose) || (HAL_CRC_TRANSPOSE_BITS_BYTES == transpose))
+    {
+        result = 0U;
+
+        for (i = 0U; i < 32U; i++)
+        {
+            result |= ((value >> i) & 1UL) << (31U - i);
+        }
+
+        /* Bits only: put the reversed bytes back in their places */
+        result = (HAL_CRC_TRANSPOSE_BITS == transpose) ? __builtin_bswap32(result) : result;
+    }
+    else if (HAL_CRC_TRANSPOSE_BYTES == transpose)
+    {
+        result = __builtin_bswap32(value);
+    }
+    else
+    {
+        /* As written */
+    }
+
+    return result;
+}
+
+/* Shift bits of data, MSB first, through the CRC register. */
+static void CRC_Shift(uint32_t data, uint32_t bits)
+{
+    uint32_t polynomial;
+    uint32_t i;
+
+    polynomial = (0U != s_crc.config.width32) ? s_crc.config.polynomial : (s_crc.config.polynomial << 16);
+
+    for (i = 0U; i < bits; i++)
+    {
+        s_crc.crc ^= ((data >> (bits - 1U - i)) & 1UL) << 31;
+        s_crc.crc  = (0U != (s_crc.crc & 0x80000000UL)) ? ((s_crc.crc << 1) ^ polynomial) : (s_crc.crc << 1);
+    }
+}
+
+static void CRC_DmaWrite(void)
+{
+    s_crc.dmaWrites++;
+    CRC_Shift(CRC_Transpose(s_dataRegister, s_crc.config.transposeIn), 32U);
+}
+
+void Fake_CRC_GetWrites(uint32_t *cpuWrites, uint32_t *dmaWrites)
+{
+    *cpuWrites = s_crc.cpuWrites;
+    *dmaWrites = s_crc.dmaWrites;
+}
+
+uint32_t Fake_CRC_RunDma(void)
+{
+    uint32_t loops;
+
+    loops = 0U;
+
+    while (0U != Fake_DMA_Request(EDMA_REQ_DMAMUX_ALWAYS_ENABLED0))
+    {
+        loops++;
+    }
+
+    return loops;
+}
+
+/*******************************************************************************
+ * HAL_CRC API
+ ******************************************************************************/
+
+void HAL_CRC_Init(void)
+{
+    Fake_DMA_SetWriteHook((uint32_t)(uintptr_t)&s_dataRegister, CRC_DmaWrite);
+}
+
+void HAL_CRC_Configure(const HAL_CRC_Config_t *config)
+{
+    s_crc.config = *config;
+    s_crc.crc    = (0U != config->width32) ? config->seed : (config->seed << 16);
+}
+
+void HAL_CRC_WriteByte(uint8_t data)
+{
+    uint8_t transpose;
+
+    /* A byte has no bytes to swap */
+    transpose = s_crc.config.transposeIn;
+    transpose = ((HAL_CRC_TRANSPOSE_BITS == transpose) || (HAL_CRC_TRANSPOSE_BITS_BYTES == transpose)) ?
+                HAL_CRC_TRANSPOSE_BITS : HAL_CRC_TRANSPOSE_NONE;
+
+    s_crc.cpuWrites++;
+    CRC_Shift(CRC_Transpose(data, transpose) & 0xFFU, 8U);
+}
+
+void HAL_CRC_WriteWord(uint32_t data)
+{
+    s_crc.cpuWrites++;
+    CRC_Shift(CRC_Transpose(data, s_crc.config.transposeIn), 32U);
+}
+
+uint32_t HAL_CRC_GetResult(void)
+{
+    uint32_t data;
+
+    /* DATA holds a CRC-16 in its lower half */
+    data = (0U != s_crc.config.width32) ? s_crc.crc : (s_crc.crc >> 16);
+    data = CRC_Transpose(data, s_crc.config.transposeOut);
+    data = (0U != s_crc.config.complement) ? ~data : data;
+
+    if (0U != s_crc.config.width32)
+    {
+        /* Whole register */
+    }
+    else if ((HAL_CRC_TRANSPOSE_BITS_BYTES == s_crc.config.transposeOut) ||
+             (HAL_CRC_TRANSPOSE_BYTES == s_crc.config.transposeOut))
+    {
+        data >>= 16;
+    }
+    else
+    {
+        data &= 0xFFFFU;
+    }
+
+    return data;
+}
+
+uint32_t HAL_CRC_GetDataAddress(void)
+{
+    return (uint32_t)(uintptr_t)&s_dataRegister;
+}
@@ -0,0 +1,333 @@
+/*******************************************************************************
+ * @file    Fake_HAL_DMA.c
+ * @brief   Host model of the eDMA / DMAMUX behind the HAL_DMA API C file.
+ *
+ * Executes the transfer control descriptors the drivers load: minor loops
+ * with source / destination offsets and widths, minor loop offsets,
+ * last adjustments, DREQ, and the half / major interrupts. A peripheral
+ * model may watch one data register to see the words the engine writes,
+ * or a window of registers to see every read and write into it.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define DMA_SOURCE_NONE         (0xFFFFFFFFUL)
+
+typedef struct
+{
+    uint8_t             used;
+    uint8_t             enabled;        /**< ERQ                                */
+    uint32_t            source;
+    HAL_DMA_Callback_t  callback;
+    void               *param;
+    HAL_DMA_Transfer_t  tcd;
+    uint16_t            citer;
+    int32_t             minorOffset;
+    uint8_t             minorTarget;
+} DMA_Channel_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static DMA_Channel_t s_channel[HAL_DMA_CHANNEL_COUNT];
+static uint32_t s_interrupts;
+
+static uint32_t s_hookAddress;
+static void (*s_hook)(void);
+
+static uint32_t s_windowBase;
+static uint32_t s_windowSize;
+static void (*s_windowHook)(uint32_t address, uint8_t write);
+
+/* Engine-internal holding buffer of one minor loop; static so that its
+ * address fits the uint32_t the TCD fields carry */
+static uint8_t s_minorBuffer[1024];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void DMA_MinorLoop(uint8_t channel);
+static void DMA_Copy(uint32_t dst, uint32_t src, uint32_t bytes);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void DMA_Copy(uint32_t dst, uint32_t src, uint32_t bytes)
+{
+    (void)memcpy(FAKE_PTR(dst), FAKE_PTR(src), bytes);
+
+    if ((NULL != s_hook) && (dst == s_hookAddress))
+    {
+        s_hook();
+    }
+    else
+    {
+        /* Memory, or a register read back later */
+    }
+
+    if ((NULL != s_windowHook) && ((dst - s_windowBase) < s_windowSize))
+    {
+        s_windowHook(dst, 1U);
+    }
+    else if ((NULL != s_windowHook) && ((src - s_windowBase) < s_windowSize))
+    {
+        s_windowHook(src, 0U);
+    }
+    else
+    {
+        /* Outside the watched registers */
+    }
+}
+
+static void DMA_MinorLoop(uint8_t channel)
+{
+    DMA_Channel_t *ch;
+    uint32_t srcBytes;
+    uint32_t dstBytes;
+    uint32_t done;
+    uint32_t event;
+
+    ch       = &s_channel[channel];
+    srcBytes = 1UL << (uint32_t)ch->tcd.srcSize;
+    dstBytes = 1UL << (uint32_t)ch->tcd.dstSize;
+
+    /* Reads in source width, writes in destination width, as the engine does */
+    for (done = 0U; done < ch->tcd.minorBytes; done += srcBytes)
+    {
+        DMA_Copy((uint32_t)(uintptr_t)&s_minorBuffer[done], ch->tcd.srcAddr, srcBytes);
+        ch->tcd.srcAddr += (uint32_t)(int32_t)ch->tcd.srcOffset;
+    }
+
+    for (done = 0U; done < ch->tcd.minorBytes; done += dstBytes)
+    {
+        DMA_Copy(ch->tcd.dstAddr, (uint32_t)(uintptr_t)&s_minorBuffer[done], dstBytes);
+        ch->tcd.dstAddr += (uint32_t)(int32_t)ch->tcd.dstOffset;
+    }
+
+    if (0U != (ch->minorTarget & HAL_DMA_MLOFF_SRC))
+    {
+        ch->tcd.srcAddr += (uint32_t)ch->minorOffset;
+    }
+    else
+    {
+        /* No source minor loop offset */
+    }
+
+    if (0U != (ch->minorTarget & HAL_DMA_MLOFF_DST))
+    {
+        ch->tcd.dstAddr += (uint32_t)ch->minorOffset;
+    }
+    else
+    {
+        /* No destination minor loop offset */
+    }
+
+    ch->citer--;
+    event = 0U;
+
+    if (0U == ch->citer)
+    {
+        ch->tcd.srcAddr += (uint32_t)ch->tcd.srcLastAdj;
+        ch->tcd.dstAddr += (uint32_t)ch->tcd.dstLastAdj;
+        ch->citer = ch->tcd.majorCount;
+
+        if (0U != (ch->tcd.flags & HAL_DMA_FLAG_DISABLE_REQ))
+        {
+            ch->enabled = 0U;
+        }
+        else
+        {
+            /* Runs on with the reloaded major loop */
+        }
+
+        event = (0U != (ch->tcd.flags & HAL_DMA_FLAG_INT_MAJOR)) ? HAL_DMA_EVENT_MAJOR_DONE : 0U;
+    }
+    else if ((0U != (ch->tcd.flags & HAL_DMA_FLAG_INT_HALF)) && (ch->citer == (ch->tcd.majorCount / 2U)))
+    {
+        event = HAL_DMA_EVENT_HALF_DONE;
+    }
+    else
+    {
+        /* Mid loop */
+    }
+
+    if ((0U != event) && (NULL != ch->callback))
+    {
+        /* The channel IRQ clears INT before the callback runs */
+        s_interrupts++;
+        ch->callback(channel, event, ch->param);
+    }
+    else
+    {
+        /* Interrupt not enabled */
+    }
+}
+
+void Fake_DMA_Reset(void)
+{
+    (void)memset(s_channel, 0, sizeof(s_channel));
+    s_interrupts = 0U;
+}
+
+void Fake_DMA_SetWindowHook(uint32_t base, uint32_t size, void (*hook)(uint32_t address, uint8_t write))
+{
+    s_windowBase = base;
+    s_windowSize = size;
+    s_windowHook = hook;
+}
+
+uint8_t Fake_DMA_Request(dma_request_source_t source)
+{
+    uint8_t channel;
+    uint8_t serviced;
+
+    serviced = 0U;
+
+    for (channel = 0U; channel < HAL_DMA_CHANNEL_COUNT; channel++)
+    {
+        if ((0U != s_channel[channel].used) && (0U != s_channel[channel].enabled) &&
+            ((uint32_t)source == s_channel[channel].source))
+        {
+            DMA_MinorLoop(channel);
+            serviced = 1U;
+            break;
+        }
+        else
+        {
+            /* Not routed to this channel */
+        }
+    }
+
+    return serviced;
+}
+
+uint32_t Fake_DMA_GetInterruptCount(void)
+{
+    return s_interrupts;
+}
+
+void Fake_DMA_SetWriteHook(uint32_t address, void (*hook)(void))
+{
+    s_hookAddress = address;
+    s_hook        = hook;
+}
+
+void HAL_DMA_Init(void)
+{
+}
+
+uint8_t HAL_DMA_AllocChannel(void)
+{
+    uint8_t channel;
+    uint8_t index;
+
+    channel = HAL_DMA_CHANNEL_INVALID;
+
+    for (index = 0U; index < HAL_DMA_CHANNEL_COUNT; index++)
+    {
+        if (0U == s_channel[index].used)
+        {
+            (void)memset(&s_channel[index], 0, sizeof(s_channel[index]));
+            s_channel[index].used   = 1U;
+            s_channel[index].source = DMA_SOURCE_NONE;
+            channel = index;
+            break;
+        }
+        else
+        {
+            /* Reserved */
+        }
+    }
+
+    return channel;
+}
+
+void HAL_DMA_FreeChannel(uint8_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        s_channel[channel].used    = 0U;
+        s_channel[channel].enabled = 0U;
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_SetRequestSource(uint8_t channel, dma_request_source_t source)
+{
+    s_channel[channel].source = (uint32_t)source;
+}
+
+void HAL_DMA_RegisterCallback(uint8_t channel, HAL_DMA_Callback_t callback, void *param)
+{
+    s_channel[channel].callback = callback;
+    s_channel[channel].param    = param;
+}
+
+void HAL_DMA_ConfigTransfer(uint8_t channel, const HAL_DMA_Transfer_t *transfer)
+{
+    s_channel[channel].tcd         = *transfer;
+    s_channel[channel].citer       = transfer->majorCount;
+    s_channel[channel].minorTarget = 0U;
+}
+
+void HAL_DMA_SetMinorLoopOffset(uint8_t channel, int32_t offset, uint8_t target)
+{
+    s_channel[channel].minorOffset = offset;
+    s_channel[channel].minorTarget = target;
+}
+
+void HAL_DMA_Reload(uint8_t channel, uint32_t srcAddr, uint32_t dstAddr, uint16_t majorCount)
+{
+    s_channel[channel].tcd.srcAddr    = srcAddr;
+    s_channel[channel].tcd.dstAddr    = dstAddr;
+    s_channel[channel].tcd.majorCount = majorCount;
+    s_channel[channel].citer          = majorCount;
+}
+
+void HAL_DMA_EnableRequest(uint8_t channel)
+{
+    s_channel[channel].enabled = 1U;
+}
+
+void HAL_DMA_DisableRequest(uint8_t channel)
+{
+    if (channel < HAL_DMA_CHANNEL_COUNT)
+    {
+        s_channel[channel].enabled = 0U;
+    }
+    else
+    {
+        /* Invalid channel, do nothing */
+    }
+}
+
+void HAL_DMA_SoftwareStart(uint8_t channel)
+{
+    DMA_MinorLoop(channel);
+}
+
+uint16_t HAL_DMA_GetRemaining(uint8_t channel)
+{
+    return s_channel[channel].citer;
+}
+
+uint8_t HAL_DMA_IsIntPending(uint8_t channel)
+{
+    /* Interrupts are taken the moment they are raised */
+    (void)channel;
+
+    return 0U;
+}
@@ -0,0 +1,935 @@
+/*******************************************************************************
+ * @file    Fake_HAL_FLEXCAN.c
+ * @brief   Host model of the FlexCAN behind the HAL_FLEXCAN API C file.
+ *
+ * Bit-time model of one node on a classic CAN bus: MB RAM, the legacy RX
+ * FIFO with its format A filter table, individual / global masks and the
+ * mailbox matching of the device (FIFO first, then the lowest free
+ * mailbox). Frames take their unstuffed length on the bus, the shortest a
+ * frame can be, so back-to-back traffic is the heaviest possible load.
+ *
+ * Arbitration is bitwise over the identifier, RTR / SRR and IDE bits
+ * between the pending TX mailboxes of the node and the frames queued by
+ * another node (Fake_FLEXCAN_Inject). Frames on the bus are logged in
+ * order for the test.
+ *
+ * FD frames (EDL) carry up to 64 bytes in message buffers of the
+ * configured payload size; a frame larger than the buffer is truncated.
+ * With BRS set and a data phase timing programmed, the data phase takes
+ * its length in data bit times, converted to nominal bit times (rounded
+ * up) through the two programmed bit times.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Fake_HAL.h"
+#include "Driver_CAN.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FLEXCAN_RAM_WORDS           (128U)
+#define FLEXCAN_MASK_COUNT          (32U)
+#define FLEXCAN_FIFO_DEPTH          (6U)
+#define FLEXCAN_FIFO_WARNING        (5U)
+#define FLEXCAN_FIFO_FILTER_WORD    (24U)       /**< Filter table from MB6 */
+#define FLEXCAN_REMOTE_QUEUE        (64U)
+#define FLEXCAN_LOG_SIZE            (256U)
+
+/* Unstuffed frame lengths including the 3 bit intermission */
+#define FLEXCAN_STD_FRAME_BITS      (47U)
+#define FLEXCAN_EXT_FRAME_BITS      (67U)
+
+/* CAN FD: arbitration phase up to BRS, data phase from ESI to the CRC
+ * delimiter (ESI, DLC, stuff count, delimiter + CRC + data), trailer from
+ * the ACK slot to the end of intermission. */
+#define FLEXCAN_FD_STD_ARB_BITS     (17U)
+#define FLEXCAN_FD_EXT_ARB_BITS     (36U)
+#define FLEXCAN_FD_DATA_BITS        (10U)
+#define FLEXCAN_FD_CRC17_BITS       (17U)       /**< Up to 16 data bytes */
+#define FLEXCAN_FD_CRC21_BITS       (21U)
+#define FLEXCAN_FD_TRAILER_BITS     (12U)
+#define FLEXCAN_FD_PAYLOAD_MAX      (64U)
+
+#define FLEXCAN_MB_FLAGS_LOW        (0x0000FFFFUL)
+
+typedef struct
+{
+    uint32_t    id;             /**< CMSIS identifier (bit 31 = IDE) */
+    uint8_t     rtr;
+    uint8_t     edl;
+    uint8_t     brs;
+    uint8_t     dlc;
+    uint8_t     data[FLEXCAN_FD_PAYLOAD_MAX];
+} FLEXCAN_Frame_t;
+
+typedef struct
+{
+    uint32_t        ram[FLEXCAN_RAM_WORDS];
+    uint32_t        rximr[FLEXCAN_MASK_COUNT];
+    uint32_t        rxfgmask;
+    uint32_t        iflag;
+    uint32_t        imask;
+    uint8_t         mbNum;          /**< Message buffers with 8 byte payload */
+    uint8_t         frozen;
+    uint8_t         payload;        /**< Bytes per message buffer */
+    uint8_t         fifoEnabled;
+    uint8_t         rffn;
+    HAL_FLEXCAN_Mode_t mode;
+    uint8_t         inIrq;
+
+    HAL_FLEXCAN_Timing_t timing;        /**< CBT                        */
+    HAL_FLEXCAN_Timing_t dataTiming;    /**< FDCBT                      */
+    uint8_t         brsEnabled;         /**< FDCTRL.FDRATE              */
+    uint8_t         tdcOffset;          /**< FDCTRL.TDCOFF, 0 = TDC off */
+
+    FLEXCAN_Frame_t fifo[FLEXCAN_FIFO_DEPTH];
+    uint8_t         fifoHead;
+    uint8_t         fifoCount;
+
+    FLEXCAN_Frame_t remote[FLEXCAN_REMOTE_QUEUE];
+    uint32_t        remoteHead;
+    uint32_t        remoteCount;
+
+    uint8_t         busy;           /**< A frame is on the bus            */
+    uint8_t         busyLocal;      /**< ... sent by this node from txMb  */
+    uint8_t         txMb;
+    uint32_t        bitsLeft;
+    FLEXCAN_Frame_t onBus;
+
+    uint32_t        busBits;
+    uint32_t        busyBits;
+    uint32_t        logCount;
+    uint32_t        log[FLEXCAN_LOG_SIZE];
+    uint32_t        lost;
+    uint32_t        irqCount;
+} FLEXCAN_Model_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern void CAN0_ORed_0_15_MB_IRQHandler(void) __attribute__((weak));
+extern void CAN0_ORed_16_31_MB_IRQHandler(void) __attribute__((weak));
+extern void CAN1_ORed_0_15_MB_IRQHandler(void) __attribute__((weak));
+extern void CAN2_ORed_0_15_MB_IRQHandler(void) __attribute__((weak));
+
+static void (* const s_lowHandler[HAL_FLEXCAN_MAX])(void) =
+{
+    CAN0_ORed_0_15_MB_IRQHandler,
+    CAN1_ORed_0_15_MB_IRQHandler,
+    CAN2_ORed_0_15_MB_IRQHandler
+};
+
+static const uint8_t s_mbCount[HAL_FLEXCAN_MAX] = FEATURE_CAN_MAX_MB_NUM_ARRAY;
+
+/* CAN FD data length code to payload bytes */
+static const uint8_t s_dlcLength[16] =
+{
+    0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U
+};
+
+static FLEXCAN_Model_t s_flexcan[HAL_FLEXCAN_MAX];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t FLEXCAN_MbWords(const FLEXCAN_Model_t *can);
+static uint64_t FLEXCAN_ArbitrationKey(const FLEXCAN_Frame_t *frame);
+static uint32_t FLEXCAN_FrameLength(const FLEXCAN_Frame_t *frame);
+static uint32_t FLEXCAN_BitClocks(const HAL_FLEXCAN_Timing_t *timing);
+static uint32_t FLEXCAN_FrameBits(const FLEXCAN_Model_t *can, const FLEXCAN_Frame_t *frame);
+static void FLEXCAN_StoreFrame(volatile uint32_t *mb, uint32_t code, const FLEXCAN_Frame_t *frame, uint8_t payload);
+static void FLEXCAN_LoadFrame(const uint32_t *mb, FLEXCAN_Frame_t *frame, uint8_t payload);
+static uint8_t FLEXCAN_MatchFifo(const FLEXCAN_Model_t *can, const FLEXCAN_Frame_t *frame);
+static void FLEXCAN_Receive(FLEXCAN_Model_t *can, const FLEXCAN_Frame_t *frame, uint8_t ownMb);
+static void FLEXCAN_Arbitrate(FLEXCAN_Model_t *can);
+static void FLEXCAN_EndOfFrame(FLEXCAN_Model_t *can);
+static void FLEXCAN_Service(HAL_FLEXCAN_Instance_t instance);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t FLEXCAN_MbWords(const FLEXCAN_Model_t *can)
+{
+    return 2U + ((uint32_t)can->payload / 4U);
+}
+
+static uint64_t FLEXCAN_ArbitrationKey(const FLEXCAN_Frame_t *frame)
+{
+    uint64_t key;
+    uint32_t id;
+
+    /* Bus order of the arbitration field: base ID, RTR / SRR, IDE, extension, RTR. Dominant = 0. */
+    if (0U != (frame->id & ARM_CAN_ID_IDE_Msk))
+    {
+        id  = frame->id & 0x1FFFFFFFUL;
+        key = ((uint64_t)(id >> 18) << 21) | (1ULL << 20) | (1ULL << 19) |
+              ((uint64_t)(id & 0x3FFFFUL) << 1) | frame->rtr;
+    }
+    else
+    {
+        key = ((uint64_t)(frame->id & 0x7FFUL) << 21) | ((uint64_t)frame->rtr << 20);
+    }
+
+    return key;
+}
+
+static uint32_t FLEXCAN_FrameLength(const FLEXCAN_Frame_t *frame)
+{
+    uint32_t length;
+
+    if (0U != frame->rtr)
+    {
+        length = 0U;
+    }
+    else if (0U != frame->edl)
+    {
+        length = s_dlcLength[frame->dlc & 0x0FU];
+    }
+    else
+    {
+        length = (frame->dlc > 8U) ? 8U : frame->dlc;
+    }
+
+    return length;
+}
+
+static uint32_t FLEXCAN_BitClocks(const HAL_FLEXCAN_Timing_t *timing)
+{
+    return (uint32_t)timing->preDivider *
+           (1U + (uint32_t)timing->propSeg + (uint32_t)timing->phaseSeg1 + (uint32_t)timing->phaseSeg2);
+}
+
+static uint32_t FLEXCAN_FrameBits(const FLEXCAN_Model_t *can, const FLEXCAN_Frame_t *frame)
+{
+    uint32_t bits;
+    uint32_t dataBits;
+    uint32_t nominal;
+    uint32_t fast;
+
+    if (0U == frame->edl)
+    {
+        bits = (0U != (frame->id & ARM_CAN_ID_IDE_Msk)) ? FLEXCAN_EXT_FRAME_BITS : FLEXCAN_STD_FRAME_BITS;
+        bits += 8U * FLEXCAN_FrameLength(frame);
+    }
+    else
+    {
+        dataBits = FLEXCAN_FD_DATA_BITS + (8U * FLEXCAN_FrameLength(frame)) +
+                   ((FLEXCAN_FrameLength(frame) <= 16U) ? FLEXCAN_FD_CRC17_BITS : FLEXCAN_FD_CRC21_BITS);
+        nominal  = FLEXCAN_BitClocks(&can->timing);
+        fast     = FLEXCAN_BitClocks(&can->dataTiming);
+
+        if ((0U != frame->brs) && (0U != can->brsEnabled) && (0U != nominal) && (0U != fast))
+        {
+            /* Data phase at the data bit rate, in nominal bit times */
+            dataBits = ((dataBits * fast) + nominal - 1U) / nominal;
+        }
+        else
+        {
+            /* One bit rate for the whole frame */
+        }
+
+        bits = ((0U != (frame->id & ARM_CAN_ID_IDE_Msk)) ? FLEXCAN_FD_EXT_ARB_BITS : FLEXCAN_FD_STD_ARB_BITS) +
+               dataBits + FLEXCAN_FD_TRAILER_BITS;
+    }
+
+    return bits;
+}
+
+static void FLEXCAN_StoreFrame(volatile uint32_t *mb, uint32_t code, const FLEXCAN_Frame_t *frame, uint8_t payload)
+{
+    uint32_t length;
+    uint32_t i;
+
+    mb[0] = HAL_FLEXCAN_CS_CODE(code) | HAL_FLEXCAN_CS_DLC(frame->dlc) |
+            ((0U != frame->rtr) ? HAL_FLEXCAN_CS_RTR : 0U) |
+            ((0U != frame->edl) ? HAL_FLEXCAN_CS_EDL : 0U) |
+            ((0U != frame->brs) ? HAL_FLEXCAN_CS_BRS : 0U) |
+            ((0U != (frame->id & ARM_CAN_ID_IDE_Msk)) ? (HAL_FLEXCAN_CS_IDE | HAL_FLEXCAN_CS_SRR) : 0U);
+    mb[1] = (0U != (frame->id & ARM_CAN_ID_IDE_Msk)) ? HAL_FLEXCAN_ID_EXT(frame->id) : HAL_FLEXCAN_ID_STD(frame->id);
+
+    for (i = 0U; i < ((uint32_t)payload / 4U); i++)
+    {
+        mb[2U + i] = 0U;
+    }
+
+    /* The message buffer keeps what fits in its payload size */
+    length = FLEXCAN_FrameLength(frame);
+    length = (length > payload) ? payload : length;
+
+    for (i = 0U; i < length; i++)
+    {
+        mb[2U + (i / 4U)] |= (uint32_t)frame->data[i] << (24U - (8U * (i & 3U)));
+    }
+}
+
+static void FLEXCAN_LoadFrame(const uint32_t *mb, FLEXCAN_Frame_t *frame, uint8_t payload)
+{
+    uint32_t length;
+    uint32_t i;
+
+    if (0U != (mb[0] & HAL_FLEXCAN_CS_IDE))
+    {
+        frame->id = HAL_FLEXCAN_ID_EXT(mb[1]) | ARM_CAN_ID_IDE_Msk;
+    }
+    else
+    {
+        frame->id = (mb[1] >> HAL_FLEXCAN_ID_STD_SHIFT) & 0x7FFUL;
+    }
+
+    frame->rtr = (0U != (mb[0] & HAL_FLEXCAN_CS_RTR)) ? 1U : 0U;
+    frame->edl = (0U != (mb[0] & HAL_FLEXCAN_CS_EDL)) ? 1U : 0U;
+    frame->brs = (0U != (mb[0] & HAL_FLEXCAN_CS_BRS)) ? 1U : 0U;
+    frame->dlc = (uint8_t)((mb[0] & HAL_FLEXCAN_CS_DLC_MASK) >> HAL_FLEXCAN_CS_DLC_SHIFT);
+
+    (void)memset(frame->data, 0, sizeof(frame->data));
+
+    length = FLEXCAN_FrameLength(frame);
+    length = (length > payload) ? payload : length;
+
+    for (i = 0U; i < length; i++)
+    {
+        frame->data[i] = (uint8_t)(mb[2U + (i / 4U)] >> (24U - (8U * (i & 3U))));
+    }
+}
+
+static uint8_t FLEXCAN_MatchFifo(const FLEXCAN_Model_t *can, const FLEXCAN_Frame_t *frame)
+{
+    uint32_t element;
+    uint32_t mask;
+    uint32_t count;
+    uint32_t i;
+    uint8_t match;
+
+    /* Format A element of the received frame */
+    if (0U != (frame->id & ARM_CAN_ID_IDE_Msk))
+    {
+        element = HAL_FLEXCAN_FILTER_IDE | HAL_FLEXCAN_FILTER_EXT(frame->id);
+    }
+    else
+    {
+        element = HAL_FLEXCAN_FILTER_STD(frame->id);
+    }
+    element |= (0U != frame->rtr) ? HAL_FLEXCAN_FILTER_RTR : 0U;
+
+    count = 8U * ((uint32_t)can->rffn + 1U);
+    match = 0U;
+
+    for (i = 0U; (i < count) && (0U == match); i++)
+    {
+        /* The first 8 + 2 * RFFN elements have an individual mask */
+        mask  = (i < (8U + (2U * (uint32_t)can->rffn))) ? can->rximr[i] : can->rxfgmask;
+        match = (0U == ((element ^ can->ram[FLEXCAN_FIFO_FILTER_WORD + i]) & mask)) ? 1U : 0U;
+    }
+
+    return match;
+}
+
+static void FLEXCAN_Receive(FLEXCAN_Model_t *can, const FLEXCAN_Frame_t *frame, uint8_t ownMb)
+{
+    volatile uint32_t *mb;
+    uint32_t words;
+    uint32_t first;
+    uint32_t count;
+    uint32_t idWord;
+    uint32_t code;
+    uint32_t full;
+    uint32_t i;
+    uint8_t stored;
+
+    stored = 0U;
+
+    /* RX FIFO first (MRP = 0) */
+    if ((0U != can->fifoEnabled) && (0U != FLEXCAN_MatchFifo(can, frame)))
+    {
+        stored = 1U;
+
+        if (can->fifoCount < FLEXCAN_FIFO_DEPTH)
+        {
+            can->fifo[(can->fifoHead + can->fifoCount) % FLEXCAN_FIFO_DEPTH] = *frame;
+            can->fifoCount++;
+
+            if (1U == can->fifoCount)
+            {
+                FLEXCAN_StoreFrame(&can->ram[0], HAL_FLEXCAN_CODE_RX_FULL, frame, 8U);
+                can->iflag |= HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE;
+            }
+            else if (FLEXCAN_FIFO_WARNING == can->fifoCount)
+            {
+                can->iflag |= HAL_FLEXCAN_RXFIFO_FLAG_WARNING;
+            }
+            else
+            {
+                /* Queued behind the output */
+            }
+        }
+        else
+        {
+            can->iflag |= HAL_FLEXCAN_RXFIFO_FLAG_OVERFLOW;
+            can->lost++;
+        }
+    }
+    else
+    {
+        /* Not for the FIFO, try the mailboxes */
+    }
+
+    if (0U == stored)
+    {
+        words  = FLEXCAN_MbWords(can);
+        count  = ((uint32_t)can->mbNum * 4U) / words;
+        count  = (count > FLEXCAN_MASK_COUNT) ? FLEXCAN_MASK_COUNT : count;
+        first  = (0U != can->fifoEnabled) ? (6U + (2U * ((uint32_t)can->rffn + 1U))) : 0U;
+        idWord = (0U != (frame->id & ARM_CAN_ID_IDE_Msk)) ? HAL_FLEXCAN_ID_EXT(frame->id) :
+                                                            HAL_FLEXCAN_ID_STD(frame->id);
+        full   = FLEXCAN_MASK_COUNT;
+
+        /* Lowest matching empty mailbox; a full one is overwritten only if none is empty. */
+        for (i = first; (i < count) && (0U == stored); i++)
+        {
+            mb   = &can->ram[i * words];
+            code = (mb[0] & HAL_FLEXCAN_CS_CODE_MASK) >> HAL_FLEXCAN_CS_CODE_SHIFT;
+
+            if ((i == ownMb) || (((mb[0] & HAL_FLEXCAN_CS_IDE) != 0U) != ((frame->id & ARM_CAN_ID_IDE_Msk) != 0U)) ||
+                (0U != ((mb[1] ^ idWord) & can->rximr[i] & 0x1FFFFFFFUL)))
+            {
+                /* Own TX mailbox, IDE or identifier mismatch */
+            }
+            else if (HAL_FLEXCAN_CODE_RX_EMPTY == code)
+            {
+                FLEXCAN_StoreFrame(mb, HAL_FLEXCAN_CODE_RX_FULL, frame, can->payload);
+                can->iflag |= 1UL << i;
+                stored = 1U;
+            }
+            else if ((HAL_FLEXCAN_CODE_RX_FULL == code) || (HAL_FLEXCAN_CODE_RX_OVERRUN == code))
+            {
+                full = i;
+            }
+            else
+            {
+                /* Inactive or TX mailbox */
+            }
+        }
+
+        if ((0U == stored) && (FLEXCAN_MASK_COUNT != full))
+        {
+            FLEXCAN_StoreFrame(&can->ram[full * words], HAL_FLEXCAN_CODE_RX_OVERRUN, frame, can->payload);
+            can->iflag |= 1UL << full;
+            can->lost++;
+        }
+        else
+        {
+            /* Stored, or matched by nobody */
+        }
+    }
+    else
+    {
+        /* Taken by the FIFO */
+    }
+}
+
+static void FLEXCAN_Arbitrate(FLEXCAN_Model_t *can)
+{
+    const uint32_t *mb;
+    FLEXCAN_Frame_t frame;
+    uint64_t key;
+    uint64_t best;
+    uint32_t words;
+    uint32_t count;
+    uint32_t i;
+
+    best  = UINT64_MAX;
+    words = FLEXCAN_MbWords(can);
+    count = ((uint32_t)can->mbNum * 4U) / words;
+
+    /* Local mailboxes, lowest ID first (LBUF = 0). A listen-only node does not transmit. */
+    for (i = 0U; (i < count) && (HAL_FLEXCAN_MODE_LISTEN_ONLY != can->mode); i++)
+    {
+        mb = &can->ram[i * words];
+
+        if (HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_TX_DATA) == (mb[0] & HAL_FLEXCAN_CS_CODE_MASK))
+        {
+            FLEXCAN_LoadFrame(mb, &frame, can->payload);
+            key = FLEXCAN_ArbitrationKey(&frame);
+
+            if (key < best)
+            {
+                best          = key;
+                can->onBus    = frame;
+                can->txMb     = (uint8_t)i;
+                can->busyLocal = 1U;
+            }
+            else
+            {
+                /* Loses arbitration */
+            }
+        }
+        else
+        {
+            /* Not pending */
+        }
+    }
+
+    /* The other node; disconnected from the bus in internal loopback */
+    if ((0U != can->remoteCount) && (HAL_FLEXCAN_MODE_LOOPBACK != can->mode))
+    {
+        key = FLEXCAN_ArbitrationKey(&can->remote[can->remoteHead]);
+
+        if (key < best)
+        {
+            best           = key;
+            can->onBus     = can->remote[can->remoteHead];
+            can->busyLocal = 0U;
+        }
+        else
+        {
+            /* This node wins */
+        }
+    }
+    else
+    {
+        /* Nothing queued remotely */
+    }
+
+    if (UINT64_MAX != best)
+    {
+        can->busy     = 1U;
+        can->bitsLeft = FLEXCAN_FrameBits(can, &can->onBus);
+
+        if (0U == can->busyLocal)
+        {
+            can->remoteHead = (can->remoteHead + 1U) % FLEXCAN_REMOTE_QUEUE;
+            can->remoteCount--;
+        }
+        else
+        {
+            /* Mailbox stays TX_DATA until the end of frame */
+        }
+    }
+    else
+    {
+        /* Bus idle */
+    }
+}
+
+static void FLEXCAN_EndOfFrame(FLEXCAN_Model_t *can)
+{
+    volatile uint32_t *mb;
+    uint8_t receive;
+
+    can->busy = 0U;
+    can->log[can->logCount % FLEXCAN_LOG_SIZE] = can->onBus.id;
+    can->logCount++;
+
+    if (0U != can->busyLocal)
+    {
+        mb = &can->ram[(uint32_t)can->txMb * FLEXCAN_MbWords(can)];
+
+        /* An abort requested while on the bus lets the frame complete. */
+        mb[0] = (mb[0] & ~HAL_FLEXCAN_CS_CODE_MASK) | HAL_FLEXCAN_CS_CODE(HAL_FLEXCAN_CODE_TX_INACTIVE);
+        can->iflag |= 1UL << can->txMb;
+
+        receive = ((HAL_FLEXCAN_MODE_SELF_RECEPTION == can->mode) || (HAL_FLEXCAN_MODE_LOOPBACK == can->mode)) ?
+                  1U : 0U;
+    }
+    else
+    {
+        receive = 1U;
+    }
+
+    if (0U != receive)
+    {
+        FLEXCAN_Receive(can, &can->onBus, (0U != can->busyLocal) ? can->txMb : 0xFFU);
+    }
+    else
+    {
+        /* Own frame, self reception disabled */
+    }
+}
+
+static void FLEXCAN_Service(HAL_FLEXCAN_Instance_t instance)
+{
+    FLEXCAN_Model_t *can;
+    uint32_t pending;
+    uint32_t previous;
+
+    can      = &s_flexcan[instance];
+    previous = 0U;
+
+    /* Tail-chained while flags stay pending; a handler that leaves them alone ends it. */
+    while ((0U == can->inIrq) && (0U != (pending = can->iflag & can->imask)) && (pending != previous))
+    {
+        previous   = pending;
+        can->inIrq = 1U;
+        can->irqCount++;
+
+        if ((HAL_FLEXCAN_0 == instance) && (0U == (pending & FLEXCAN_MB_FLAGS_LOW)))
+        {
+            CAN0_ORed_16_31_MB_IRQHandler();
+        }
+        else
+        {
+            s_lowHandler[instance]();
+        }
+
+        can->inIrq = 0U;
+    }
+}
+
+void Fake_FLEXCAN_Run(HAL_FLEXCAN_Instance_t instance, uint32_t bitTimes)
+{
+    FLEXCAN_Model_t *can;
+    uint32_t bit;
+
+    can = &s_flexcan[instance];
+
+    for (bit = 0U; (bit < bitTimes) && (0U == can->frozen); bit++)
+    {
+        if (0U == can->busy)
+        {
+            FLEXCAN_Arbitrate(can);
+        }
+        else
+        {
+            /* Frame in progress */
+        }
+
+        can->busBits++;
+
+        if (0U != can->busy)
+        {
+            can->busyBits++;
+            can->bitsLeft--;
+
+            if (0U == can->bitsLeft)
+            {
+                FLEXCAN_EndOfFrame(can);
+                FLEXCAN_Service(instance);
+            }
+            else
+            {
+                /* Still on the bus */
+            }
+        }
+        else
+        {
+            /* Idle bit */
+        }
+    }
+}
+
+uint8_t Fake_FLEXCAN_Inject(HAL_FLEXCAN_Instance_t instance, uint32_t id, const uint8_t *data, uint8_t dlc)
+{
+    FLEXCAN_Model_t *can;
+    FLEXCAN_Frame_t *frame;
+    uint8_t queued;
+
+    can    = &s_flexcan[instance];
+    queued = 0U;
+
+    if (can->remoteCount < FLEXCAN_REMOTE_QUEUE)
+    {
+        frame = &can->remote[(can->remoteHead + can->remoteCount) % FLEXCAN_REMOTE_QUEUE];
+        (void)memset(frame, 0, sizeof(*frame));
+        frame->id  = id;
+        frame->dlc = (dlc > 8U) ? 8U : dlc;
+
+        if (NULL != data)
+        {
+            (void)memcpy(frame->data, data, frame->dlc);
+        }
+        else
+        {
+            /* Zero payload */
+        }
+
+        can->remoteCount++;
+        queued = 1U;
+    }
+    else
+    {
+        /* Remote node queue full */
+    }
+
+    return queued;
+}
+
+uint32_t Fake_FLEXCAN_GetRemotePending(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].remoteCount;
+}
+
+uint32_t Fake_FLEXCAN_GetLogCount(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].logCount;
+}
+
+uint32_t Fake_FLEXCAN_GetLogId(HAL_FLEXCAN_Instance_t instance, uint32_t index)
+{
+    return s_flexcan[instance].log[index % FLEXCAN_LOG_SIZE];
+}
+
+void Fake_FLEXCAN_GetBusLoad(HAL_FLEXCAN_Instance_t instance, uint32_t *busBits, uint32_t *busyBits)
+{
+    *busBits  = s_flexcan[instance].busBits;
+    *busyBits = s_flexcan[instance].busyBits;
+}
+
+uint32_t Fake_FLEXCAN_GetLostCount(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].lost;
+}
+
+uint32_t Fake_FLEXCAN_GetInterruptCount(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].irqCount;
+}
+
+void Fake_FLEXCAN_GetTiming(HAL_FLEXCAN_Instance_t instance, HAL_FLEXCAN_Timing_t *nominal,
+                            HAL_FLEXCAN_Timing_t *data)
+{
+    *nominal = s_flexcan[instance].timing;
+    *data    = s_flexcan[instance].dataTiming;
+}
+
+uint8_t Fake_FLEXCAN_GetBrs(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].brsEnabled;
+}
+
+uint8_t Fake_FLEXCAN_GetTdc(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].tdcOffset;
+}
+
+/*******************************************************************************
+ * HAL_FLEXCAN API
+ ******************************************************************************/
+
+void HAL_FLEXCAN_Init(HAL_FLEXCAN_Instance_t instance)
+{
+    FLEXCAN_Model_t *can;
+    uint32_t i;
+
+    can = &s_flexcan[instance];
+
+    (void)memset(can, 0, sizeof(*can));
+
+    for (i = 0U; i < FLEXCAN_MASK_COUNT; i++)
+    {
+        can->rximr[i] = 0xFFFFFFFFUL;
+    }
+
+    can->rxfgmask = 0xFFFFFFFFUL;
+    can->mbNum    = s_mbCount[instance];
+    can->payload  = 8U;
+    can->frozen   = 1U;
+    can->mode     = HAL_FLEXCAN_MODE_NORMAL;
+}
+
+void HAL_FLEXCAN_Deinit(HAL_FLEXCAN_Instance_t instance)
+{
+    s_flexcan[instance].frozen = 1U;
+    s_flexcan[instance].imask  = 0U;
+}
+
+uint8_t HAL_FLEXCAN_GetMbCount(HAL_FLEXCAN_Instance_t instance)
+{
+    return (uint8_t)(((uint32_t)s_mbCount[instance] * 4U) / FLEXCAN_MbWords(&s_flexcan[instance]));
+}
+
+uint8_t HAL_FLEXCAN_HasFd(HAL_FLEXCAN_Instance_t instance)
+{
+    return (HAL_FLEXCAN_0 == instance) ? 1U : 0U;
+}
+
+void HAL_FLEXCAN_ConfigureFd(HAL_FLEXCAN_Instance_t instance, uint8_t payload)
+{
+    FLEXCAN_Model_t *can;
+
+    can = &s_flexcan[instance];
+
+    can->payload     = (0U != payload) ? payload : 8U;
+    can->brsEnabled  = 0U;
+    can->fifoEnabled = 0U;
+    can->imask       = 0U;
+    can->iflag       = 0U;
+    can->fifoCount   = 0U;
+    (void)memset(can->ram, 0, sizeof(can->ram));
+}
+
+uint8_t HAL_FLEXCAN_GetPayloadSize(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].payload;
+}
+
+void HAL_FLEXCAN_EnterFreeze(HAL_FLEXCAN_Instance_t instance)
+{
+    FLEXCAN_Model_t *can;
+
+    can = &s_flexcan[instance];
+
+    /* Freeze waits for the end of the current frame */
+    if (0U != can->busy)
+    {
+        can->busyBits += can->bitsLeft;
+        can->busBits  += can->bitsLeft;
+        FLEXCAN_EndOfFrame(can);
+    }
+    else
+    {
+        /* Bus idle */
+    }
+
+    can->frozen = 1U;
+}
+
+void HAL_FLEXCAN_ExitFreeze(HAL_FLEXCAN_Instance_t instance)
+{
+    s_flexcan[instance].frozen = 0U;
+}
+
+void HAL_FLEXCAN_SetTiming(HAL_FLEXCAN_Instance_t instance, const HAL_FLEXCAN_Timing_t *timing)
+{
+    s_flexcan[instance].timing = *timing;
+}
+
+void HAL_FLEXCAN_SetDataTiming(HAL_FLEXCAN_Instance_t instance, const HAL_FLEXCAN_Timing_t *timing)
+{
+    s_flexcan[instance].dataTiming = *timing;
+    s_flexcan[instance].brsEnabled = 1U;
+}
+
+void HAL_FLEXCAN_SetTdc(HAL_FLEXCAN_Instance_t instance, uint8_t offset)
+{
+    s_flexcan[instance].tdcOffset = offset;
+}
+
+void HAL_FLEXCAN_SetMode(HAL_FLEXCAN_Instance_t instance, HAL_FLEXCAN_Mode_t mode)
+{
+    s_flexcan[instance].mode = mode;
+}
+
+void HAL_FLEXCAN_EnableRxFifo(HAL_FLEXCAN_Instance_t instance, uint8_t rffn)
+{
+    s_flexcan[instance].fifoEnabled = 1U;
+    s_flexcan[instance].rffn        = rffn;
+}
+
+void HAL_FLEXCAN_SetRxFifoFilter(HAL_FLEXCAN_Instance_t instance, uint8_t index, uint32_t element)
+{
+    s_flexcan[instance].ram[FLEXCAN_FIFO_FILTER_WORD + index] = element;
+}
+
+void HAL_FLEXCAN_SetIndividualMask(HAL_FLEXCAN_Instance_t instance, uint8_t index, uint32_t mask)
+{
+    if (index < FLEXCAN_MASK_COUNT)
+    {
+        s_flexcan[instance].rximr[index] = mask;
+    }
+    else
+    {
+        /* No such mask */
+    }
+}
+
+void HAL_FLEXCAN_SetRxFifoGlobalMask(HAL_FLEXCAN_Instance_t instance, uint32_t mask)
+{
+    s_flexcan[instance].rxfgmask = mask;
+}
+
+volatile uint32_t *HAL_FLEXCAN_GetMb(HAL_FLEXCAN_Instance_t instance, uint8_t mb)
+{
+    return &s_flexcan[instance].ram[(uint32_t)mb * FLEXCAN_MbWords(&s_flexcan[instance])];
+}
+
+void HAL_FLEXCAN_UnlockMb(HAL_FLEXCAN_Instance_t instance)
+{
+    (void)instance;
+}
+
+void HAL_FLEXCAN_EnableMbInterrupt(HAL_FLEXCAN_Instance_t instance, uint8_t mb, uint8_t enable)
+{
+    if (0U != enable)
+    {
+        s_flexcan[instance].imask |= 1UL << mb;
+        FLEXCAN_Service(instance);
+    }
+    else
+    {
+        s_flexcan[instance].imask &= ~(1UL << mb);
+    }
+}
+
+uint32_t HAL_FLEXCAN_GetMbFlags(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].iflag & s_flexcan[instance].imask;
+}
+
+uint32_t HAL_FLEXCAN_GetRawMbFlags(HAL_FLEXCAN_Instance_t instance)
+{
+    return s_flexcan[instance].iflag;
+}
+
+void HAL_FLEXCAN_ClearMbFlags(HAL_FLEXCAN_Instance_t instance, uint32_t mask)
+{
+    FLEXCAN_Model_t *can;
+
+    can = &s_flexcan[instance];
+
+    if ((0U != can->fifoEnabled) && (0U != (mask & can->iflag & HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE)))
+    {
+        /* Clearing the flag pops the output; the next frame raises it again. */
+        can->iflag &= ~mask;
+        can->fifoHead = (uint8_t)((can->fifoHead + 1U) % FLEXCAN_FIFO_DEPTH);
+        can->fifoCount--;
+
+        if (0U != can->fifoCount)
+        {
+            FLEXCAN_StoreFrame(&can->ram[0], HAL_FLEXCAN_CODE_RX_FULL, &can->fifo[can->fifoHead], 8U);
+            can->iflag |= HAL_FLEXCAN_RXFIFO_FLAG_AVAILABLE;
+        }
+        else
+        {
+            /* FIFO empty */
+        }
+    }
+    else
+    {
+        can->iflag &= ~mask;
+    }
+
+    FLEXCAN_Service(instance);
+}
+
+void HAL_FLEXCAN_EnableStateInterrupts(HAL_FLEXCAN_Instance_t instance, uint8_t enable)
+{
+    (void)instance;
+    (void)enable;
+}
+
+uint32_t HAL_FLEXCAN_GetErrorStatus(HAL_FLEXCAN_Instance_t instance)
+{
+    (void)instance;
+
+    /* Error-free bus */
+    return 0U;
+}
+
+void HAL_FLEXCAN_ClearErrorStatus(HAL_FLEXCAN_Instance_t instance, uint32_t mask)
+{
+    (void)instance;
+    (void)mask;
+}
+
+void HAL_FLEXCAN_GetErrorCounters(HAL_FLEXCAN_Instance_t instance, uint8_t *txErrors, uint8_t *rxErrors)
+{
+    (void)instance;
+    *txErrors = 0U;
+    *rxErrors = 0U;
+}
@@ -0,0 +1,568 @@
+/*******************************************************************************
+ * @file    Fake_HAL_FLEXIO.c
+ * @brief   Host model of FlexIO behind the HAL_FLEXIO API C file.
+ *
+ * Frame-time model at the FlexIO clock: no pin level is simulated, but a
+ * transmit shifter clocked by a baud mode timer takes its buffer, holds
+ * the pin for the frame length the timer compare and the start / stop
+ * bits give, and hands the data bits to the receive shifters wired to that
+ * pin. The shifter buffer and its three swapped views are static words,
+ * read and written by the drivers' eDMA channels; the status flags follow
+ * those accesses as on the device (transmit: empty, receive: full).
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define FLEXIO_VIEW_COUNT       (4U)
+
+typedef struct
+{
+    HAL_FLEXIO_Shifter_t    config;
+    uint8_t                 dma;            /**< SHIFTSDEN                      */
+    uint8_t                 irqMask;        /**< HAL_FLEXIO_STATUS_xxx enabled  */
+    uint8_t                 status;         /**< SSF                            */
+    uint8_t                 error;          /**< SEF                            */
+    uint32_t                buffer;         /**< SHIFTBUF                       */
+    uint32_t                shift;          /**< Frame on the wire              */
+    uint32_t                remaining;      /**< Clocks left in it, 0 idle      */
+    HAL_FLEXIO_Callback_t   callback;
+    void                   *param;
+} FLEXIO_Shifter_t;
+
+typedef struct
+{
+    uint32_t                frames;
+    uint32_t                busyClocks;
+    uint32_t                lastFrame;
+    uint8_t                 corrupt;        /**< Next frame has a bad stop bit  */
+    uint8_t                 source;         /**< Output pin driving this input  */
+} FLEXIO_Pin_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const dma_request_source_t s_request[HAL_FLEXIO_SHIFTER_COUNT] =
+{
+    EDMA_REQ_FLEXIO_SHIFTER0, EDMA_REQ_FLEXIO_SHIFTER1, EDMA_REQ_FLEXIO_SHIFTER2, EDMA_REQ_FLEXIO_SHIFTER3
+};
+
+/* SHIFTBUF, SHIFTBUFBIS, SHIFTBUFBYS, SHIFTBUFBBS of each shifter, one
+ * window for the eDMA hook */
+static uint32_t s_view[HAL_FLEXIO_SHIFTER_COUNT][FLEXIO_VIEW_COUNT];
+
+static FLEXIO_Shifter_t s_shifter[HAL_FLEXIO_SHIFTER_COUNT];
+static HAL_FLEXIO_Timer_t s_timer[HAL_FLEXIO_TIMER_COUNT];
+static FLEXIO_Pin_t s_pin[HAL_FLEXIO_PIN_COUNT];
+static uint8_t s_shifterUsed;
+static uint8_t s_timerUsed;
+static uint32_t s_irqCount;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t FLEXIO_Reverse(uint32_t value);
+static uint32_t FLEXIO_Swap(uint8_t view, uint32_t value);
+static void FLEXIO_Publish(uint8_t shifter);
+static void FLEXIO_Access(uint32_t address, uint8_t write);
+static uint32_t FLEXIO_DataBits(const HAL_FLEXIO_Timer_t *timer);
+static uint32_t FLEXIO_FrameClocks(const FLEXIO_Shifter_t *tx);
+static void FLEXIO_Deliver(const FLEXIO_Shifter_t *tx);
+static void FLEXIO_Requests(void);
+static void FLEXIO_Irq(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t FLEXIO_Reverse(uint32_t value)
+{
+    uint32_t result;
+    uint32_t bit;
+
+    result = 0U;
+
+    for (bit = 0U; bit < 32U; bit++)
+    {
+        result = (result << 1) | ((value >> bit) & 1UL);
+    }
+
+    return result;
+}
+
+/* Buffer to view and back: every view is its own inverse */
+static uint32_t FLEXIO_Swap(uint8_t view, uint32_t value)
+{
+    uint32_t result;
+
+    switch (view)
+    {
+        case HAL_FLEXIO_BUFFER_BIT_SWAP:
+            result = FLEXIO_Reverse(value);
+            break;
+
+        case HAL_FLEXIO_BUFFER_BYTE_SWAP:
+            result = __builtin_bswap32(value);
+            break;
+
+        case HAL_FLEXIO_BUFFER_BIT_BYTE_SWAP:
+            result = FLEXIO_Reverse(__builtin_bswap32(value));
+            break;
+
+        default:
+            result = value;
+            break;
+    }
+
+    return result;
+}
+
+static void FLEXIO_Publish(uint8_t shifter)
+{
+    uint8_t view;
+
+    for (view = 0U; view < FLEXIO_VIEW_COUNT; view++)
+    {
+        s_view[shifter][view] = FLEXIO_Swap(view, s_shifter[shifter].buffer);
+    }
+}
+
+/* A buffer view was written (transmit: now full) or read (receive: now empty) */
+static void FLEXIO_Access(uint32_t address, uint8_t write)
+{
+    uint32_t index;
+    uint8_t shifter;
+    uint8_t view;
+
+    index   = (address - (uint32_t)(uintptr_t)&s_view[0][0]) / sizeof(uint32_t);
+    shifter = (uint8_t)(index / FLEXIO_VIEW_COUNT);
+    view    = (uint8_t)(index % FLEXIO_VIEW_COUNT);
+
+    if (0U != write)
+    {
+        s_shifter[shifter].buffer = FLEXIO_Swap(view, s_view[shifter][view]);
+        FLEXIO_Publish(shifter);
+        s_shifter[shifter].status = (HAL_FLEXIO_SHIFTER_TRANSMIT == s_shifter[shifter].config.mode) ?
+                                    0U : s_shifter[shifter].status;
+    }
+    else
+    {
+        s_shifter[shifter].status = (HAL_FLEXIO_SHIFTER_RECEIVE == s_shifter[shifter].config.mode) ?
+                                    0U : s_shifter[shifter].status;
+    }
+}
+
+/* High byte of a baud mode compare: 2 * bits - 1 */
+static uint32_t FLEXIO_DataBits(const HAL_FLEXIO_Timer_t *timer)
+{
+    return (((uint32_t)timer->compare >> 8) + 1UL) / 2UL;
+}
+
+static uint32_t FLEXIO_FrameClocks(const FLEXIO_Shifter_t *tx)
+{
+    const HAL_FLEXIO_Timer_t *timer;
+    uint32_t bits;
+
+    timer = &s_timer[tx->config.timer];
+    bits  = FLEXIO_DataBits(timer);
+    bits += (tx->config.startBit >= HAL_FLEXIO_START_LOW) ? 1U : 0U;
+    bits += (tx->config.stopBit >= HAL_FLEXIO_STOP_LOW) ? 1U : 0U;
+
+    return bits * 2UL * (((uint32_t)timer->compare & 0xFFUL) + 1UL);
+}
+
+/* End of a frame: the receivers wired to the pin store its data bits */
+static void FLEXIO_Deliver(const FLEXIO_Shifter_t *tx)
+{
+    FLEXIO_Shifter_t *rx;
+    FLEXIO_Pin_t *pin;
+    uint32_t bits;
+    uint32_t data;
+    uint8_t corrupt;
+    uint8_t shifter;
+
+    pin     = &s_pin[tx->config.pin];
+    bits    = FLEXIO_DataBits(&s_timer[tx->config.timer]);
+    data    = (bits < 32U) ? (tx->shift & ((1UL << bits) - 1UL)) : tx->shift;
+    corrupt = pin->corrupt;
+
+    pin->frames++;
+    pin->lastFrame = data;
+    pin->corrupt   = 0U;
+
+    for (shifter = 0U; shifter < HAL_FLEXIO_SHIFTER_COUNT; shifter++)
+    {
+        rx = &s_shifter[shifter];
+
+        if ((HAL_FLEXIO_SHIFTER_RECEIVE == rx->config.mode) &&
+            (HAL_FLEXIO_TIMER_BAUD == s_timer[rx->config.timer].mode) &&
+            (tx->config.pin == s_pin[rx->config.pin].source))
+        {
+            /* Shifted in from bit 31 down; a full buffer or a bad frame is an error */
+            rx->error |= ((0U != rx->status) || (0U != corrupt) ||
+                          (bits != FLEXIO_DataBits(&s_timer[rx->config.timer]))) ? 1U : 0U;
+            rx->buffer = (bits < 32U) ? ((rx->buffer >> bits) | (data << (32U - bits))) : data;
+            rx->status = 1U;
+            FLEXIO_Publish(shifter);
+        }
+        else
+        {
+            /* Not listening to this pin */
+        }
+    }
+}
+
+/* Status flags with SHIFTSDEN set raise their DMA requests */
+static void FLEXIO_Requests(void)
+{
+    uint8_t shifter;
+
+    for (shifter = 0U; shifter < HAL_FLEXIO_SHIFTER_COUNT; shifter++)
+    {
+        if ((0U != s_shifter[shifter].dma) && (0U != s_shifter[shifter].status) &&
+            (HAL_FLEXIO_SHIFTER_DISABLED != s_shifter[shifter].config.mode))
+        {
+            (void)Fake_DMA_Request(s_request[shifter]);
+        }
+        else
+        {
+            /* No request raised */
+        }
+    }
+}
+
+/* FLEXIO_IRQHandler of the real HAL: error flags cleared, then the callbacks */
+static void FLEXIO_Irq(void)
+{
+    uint32_t status[HAL_FLEXIO_SHIFTER_COUNT];
+    uint8_t pending;
+    uint8_t shifter;
+
+    pending = 0U;
+
+    for (shifter = 0U; shifter < HAL_FLEXIO_SHIFTER_COUNT; shifter++)
+    {
+        status[shifter]  = ((0U != s_shifter[shifter].status) &&
+                            (0U != (s_shifter[shifter].irqMask & HAL_FLEXIO_STATUS_SHIFTER))) ?
+                           HAL_FLEXIO_STATUS_SHIFTER : 0U;
+        status[shifter] |= ((0U != s_shifter[shifter].error) &&
+                            (0U != (s_shifter[shifter].irqMask & HAL_FLEXIO_STATUS_ERROR))) ?
+                           HAL_FLEXIO_STATUS_ERROR : 0U;
+
+        if (0U != (status[shifter] & HAL_FLEXIO_STATUS_ERROR))
+        {
+            s_shifter[shifter].error = 0U;
+        }
+        else
+        {
+            /* Error flag not pending or not enabled */
+        }
+
+        pending |= (0U != status[shifter]) ? 1U : 0U;
+    }
+
+    if (0U != pending)
+    {
+        s_irqCount++;
+
+        for (shifter = 0U; shifter < HAL_FLEXIO_SHIFTER_COUNT; shifter++)
+        {
+            if ((0U != status[shifter]) && (NULL != s_shifter[shifter].callback))
+            {
+                s_shifter[shifter].callback(shifter, status[shifter], s_shifter[shifter].param);
+            }
+            else
+            {
+                /* Nothing pending for this shifter */
+            }
+        }
+    }
+    else
+    {
+        /* No enabled flag */
+    }
+}
+
+void Fake_FLEXIO_Reset(void)
+{
+    uint8_t pin;
+
+    (void)memset(s_shifter, 0, sizeof(s_shifter));
+    (void)memset(s_timer, 0, sizeof(s_timer));
+    (void)memset(s_view, 0, sizeof(s_view));
+    (void)memset(s_pin, 0, sizeof(s_pin));
+
+    for (pin = 0U; pin < HAL_FLEXIO_PIN_COUNT; pin++)
+    {
+        s_pin[pin].source = HAL_FLEXIO_INVALID;
+    }
+
+    s_shifterUsed = 0U;
+    s_timerUsed   = 0U;
+    s_irqCount    = 0U;
+
+    Fake_DMA_SetWindowHook((uint32_t)(uintptr_t)&s_view[0][0], sizeof(s_view), FLEXIO_Access);
+}
+
+void Fake_FLEXIO_Connect(uint8_t outPin, uint8_t inPin)
+{
+    s_pin[inPin].source = outPin;
+}
+
+void Fake_FLEXIO_Run(uint32_t clocks)
+{
+    FLEXIO_Shifter_t *tx;
+    uint8_t shifter;
+
+    while (0U != clocks)
+    {
+        clocks--;
+
+        /* A buffer refilled this clock is taken this clock */
+        FLEXIO_Requests();
+
+        for (shifter = 0U; shifter < HAL_FLEXIO_SHIFTER_COUNT; shifter++)
+        {
+            tx = &s_shifter[shifter];
+
+            if ((HAL_FLEXIO_SHIFTER_TRANSMIT != tx->config.mode) ||
+                (HAL_FLEXIO_TIMER_BAUD != s_timer[tx->config.timer].mode))
+            {
+                /* Stopped: a frame on the wire is cut off */
+                tx->remaining = 0U;
+            }
+            else
+            {
+                if ((0U == tx->remaining) && (0U == tx->status))
+                {
+                    /* The timer starts on a full buffer, the shifter takes it */
+                    tx->shift     = tx->buffer;
+                    tx->status    = 1U;
+                    tx->remaining = FLEXIO_FrameClocks(tx);
+                }
+                else
+                {
+                    /* Shifting, or nothing to send */
+                }
+
+                if (0U != tx->remaining)
+                {
+                    tx->remaining--;
+                    s_pin[tx->config.pin].busyClocks++;
+
+                    if (0U == tx->remaining)
+                    {
+                        FLEXIO_Deliver(tx);
+                    }
+                    else
+                    {
+                        /* Mid frame */
+                    }
+                }
+                else
+                {
+                    /* Idle line */
+                }
+            }
+        }
+
+        FLEXIO_Requests();
+        FLEXIO_Irq();
+    }
+}
+
+void Fake_FLEXIO_CorruptNext(uint8_t pin)
+{
+    s_pin[pin].corrupt = 1U;
+}
+
+uint32_t Fake_FLEXIO_GetFrameCount(uint8_t pin)
+{
+    return s_pin[pin].frames;
+}
+
+uint32_t Fake_FLEXIO_GetBusyClocks(uint8_t pin)
+{
+    return s_pin[pin].busyClocks;
+}
+
+uint32_t Fake_FLEXIO_GetLastFrame(uint8_t pin)
+{
+    return s_pin[pin].lastFrame;
+}
+
+uint32_t Fake_FLEXIO_GetInterruptCount(void)
+{
+    return s_irqCount;
+}
+
+void HAL_FLEXIO_Init(void)
+{
+}
+
+uint8_t HAL_FLEXIO_AllocShifter(void)
+{
+    uint8_t shifter;
+    uint8_t index;
+
+    shifter = HAL_FLEXIO_INVALID;
+
+    for (index = 0U; index < HAL_FLEXIO_SHIFTER_COUNT; index++)
+    {
+        if (0U == (s_shifterUsed & (1U << index)))
+        {
+            s_shifterUsed |= (uint8_t)(1U << index);
+            shifter = index;
+            break;
+        }
+        else
+        {
+            /* Reserved */
+        }
+    }
+
+    return shifter;
+}
+
+void HAL_FLEXIO_FreeShifter(uint8_t shifter)
+{
+    if (shifter < HAL_FLEXIO_SHIFTER_COUNT)
+    {
+        (void)memset(&s_shifter[shifter], 0, sizeof(s_shifter[shifter]));
+        s_shifterUsed &= (uint8_t)~(1U << shifter);
+    }
+    else
+    {
+        /* Invalid shifter, do nothing */
+    }
+}
+
+uint8_t HAL_FLEXIO_AllocTimer(void)
+{
+    uint8_t timer;
+    uint8_t index;
+
+    timer = HAL_FLEXIO_INVALID;
+
+    for (index = 0U; index < HAL_FLEXIO_TIMER_COUNT; index++)
+    {
+        if (0U == (s_timerUsed & (1U << index)))
+        {
+            s_timerUsed |= (uint8_t)(1U << index);
+            timer = index;
+            break;
+        }
+        else
+        {
+            /* Reserved */
+        }
+    }
+
+    return timer;
+}
+
+void HAL_FLEXIO_FreeTimer(uint8_t timer)
+{
+    if (timer < HAL_FLEXIO_TIMER_COUNT)
+    {
+        (void)memset(&s_timer[timer], 0, sizeof(s_timer[timer]));
+        s_timerUsed &= (uint8_t)~(1U << timer);
+    }
+    else
+    {
+        /* Invalid timer, do nothing */
+    }
+}
+
+void HAL_FLEXIO_SetShifter(uint8_t shifter, const HAL_FLEXIO_Shifter_t *config)
+{
+    FLEXIO_Shifter_t *model;
+
+    model = &s_shifter[shifter];
+
+    /* SMOD rewritten: buffer and frame in progress dropped, transmit starts empty */
+    model->config    = *config;
+    model->remaining = 0U;
+    model->error     = 0U;
+    model->status    = (HAL_FLEXIO_SHIFTER_TRANSMIT == config->mode) ? 1U : 0U;
+}
+
+void HAL_FLEXIO_SetTimer(uint8_t timer, const HAL_FLEXIO_Timer_t *config)
+{
+    s_timer[timer] = *config;
+}
+
+void HAL_FLEXIO_WriteBuffer(uint8_t shifter, uint8_t view, uint32_t data)
+{
+    s_view[shifter][view] = data;
+    FLEXIO_Access((uint32_t)(uintptr_t)&s_view[shifter][view], 1U);
+}
+
+uint32_t HAL_FLEXIO_ReadBuffer(uint8_t shifter, uint8_t view)
+{
+    uint32_t data;
+
+    data = s_view[shifter][view];
+    FLEXIO_Access((uint32_t)(uintptr_t)&s_view[shifter][view], 0U);
+
+    return data;
+}
+
+uint32_t HAL_FLEXIO_GetBufferAddress(uint8_t shifter, uint8_t view)
+{
+    return ((shifter < HAL_FLEXIO_SHIFTER_COUNT) && (view < FLEXIO_VIEW_COUNT)) ?
+           (uint32_t)(uintptr_t)&s_view[shifter][view] : 0U;
+}
+
+uint8_t HAL_FLEXIO_IsShifterReady(uint8_t shifter)
+{
+    return s_shifter[shifter].status;
+}
+
+uint8_t HAL_FLEXIO_TakeShifterError(uint8_t shifter)
+{
+    uint8_t error;
+
+    error = s_shifter[shifter].error;
+    s_shifter[shifter].error = 0U;
+
+    return error;
+}
+
+uint8_t HAL_FLEXIO_TakeTimerStatus(uint8_t timer)
+{
+    /* Timer compare flags are not modelled */
+    (void)timer;
+
+    return 0U;
+}
+
+void HAL_FLEXIO_EnableDma(uint8_t shifter, uint8_t enable)
+{
+    s_shifter[shifter].dma = enable;
+}
+
+dma_request_source_t HAL_FLEXIO_GetDmaRequest(uint8_t shifter)
+{
+    return (shifter < HAL_FLEXIO_SHIFTER_COUNT) ? s_request[shifter] : EDMA_REQ_DISABLED;
+}
+
+void HAL_FLEXIO_EnableIrq(uint8_t shifter, uint32_t status)
+{
+    s_shifter[shifter].irqMask = (uint8_t)status;
+}
+
+void HAL_FLEXIO_RegisterCallback(uint8_t shifter, HAL_FLEXIO_Callback_t callback, void *param)
+{
+    s_shifter[shifter].callback = callback;
+    s_shifter[shifter].param    = param;
+}
@@ -0,0 +1,512 @@
+/*******************************************************************************
+ * @file    Fake_HAL_FTFC.c
+ * @brief   Host model of the FTFC FlexNVM / emulated EEPROM behind the
+ *          HAL_FTFC API C file.
+ *
+ * FlexRAM is a page mapped at its system address, so the driver stores to
+ * it exactly as on the part. A store that changes a word of an EEPROM
+ * FlexRAM starts a record write: CCIF is low for FAKE_FTFC_EEE_RECORD_US,
+ * then the word is in the EEPROM backup and, with CCIE set, the owner's
+ * callback runs as the command complete interrupt would. Program Partition
+ * and Set FlexRAM are executed from FCCOB when launched; FCCOB loads and
+ * launches while the engine is not acquired are counted.
+ *
+ * The D-Flash part of the FlexNVM is mapped at its system address as
+ * well. Program Phrase, Erase Flash Sector and Erase Flash Block on it
+ * keep CCIF low for the FAKE_FTFC_xxx_US time and take effect when they
+ * complete. A phrase programmed twice without an erase fails verify
+ * (MGSTAT0), a misaligned or out of range address is an access error.
+ * P-Flash commands are refused with an access error.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE     (0x100000)
+#endif
+
+#define FTFC_WORDS              (HAL_FTFC_FLEXRAM_SIZE / 4U)
+#define FTFC_FCCOB_SIZE         (12U)
+#define FTFC_DFLASH_ADDRESS     (0x00800000UL)  /**< FlexNVM in the FTFC address space */
+#define FTFC_ERASED             (0xFFU)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* EEPROM size codes, as the part decodes FCCOB4 of Program Partition */
+static const uint16_t s_eeeBytes[16] =
+{
+    0U, 0U, 4096U, 2048U, 1024U, 512U, 256U, 128U, 64U, 32U, 0U, 0U, 0U, 0U, 0U, 0U
+};
+
+static volatile uint32_t *s_flexRam = NULL;
+static volatile uint8_t *s_dflash = NULL;
+static uint32_t s_backup[FTFC_WORDS];       /**< EEPROM contents in the backup */
+
+static uint32_t s_eeeSize;
+static uint8_t s_partitioned;
+static uint8_t s_eeeReady;
+static uint8_t s_ccie;
+static uint8_t s_errors;
+static uint8_t s_fccob[FTFC_FCCOB_SIZE];
+
+static uint8_t s_owned;
+static HAL_FTFC_Callback_t s_callback;
+static void *s_callbackParam;
+
+static uint8_t s_recordBusy;
+static uint32_t s_recordIndex;
+static uint64_t s_recordDoneUs;
+static uint8_t s_failNext;
+
+static uint8_t s_commandBusy;
+static uint8_t s_commandErrors;             /**< Raised when the command completes */
+static uint64_t s_commandDoneUs;
+static uint8_t s_commandWaited;             /**< Completed in Launch, CCIF set for CCIE */
+static uint8_t s_failCommand;
+
+static uint64_t s_nowUs;
+static uint32_t s_records;
+static uint32_t s_unownedLoads;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* A changed FlexRAM word starts its record write. */
+static void FTFC_Scan(void)
+{
+    uint32_t i;
+
+    for (i = 0U; (0U == s_recordBusy) && (0U != s_eeeReady) && (i < (s_eeeSize / 4U)); i++)
+    {
+        if (s_flexRam[i] != s_backup[i])
+        {
+            s_recordBusy   = 1U;
+            s_recordIndex  = i;
+            s_recordDoneUs = s_nowUs + FAKE_FTFC_EEE_RECORD_US;
+        }
+        else
+        {
+            /* Unchanged */
+        }
+    }
+}
+
+static void FTFC_CheckOwner(void)
+{
+    s_unownedLoads += (0U == s_owned) ? 1U : 0U;
+}
+
+static void *FTFC_Map(uint32_t address, uint32_t size)
+{
+    void *page;
+
+    page = mmap(FAKE_PTR(address), size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                -1, 0);
+
+    return (FAKE_PTR(address) == page) ? page : NULL;
+}
+
+/* Check a D-Flash command when launched; it takes effect on completion. */
+static uint8_t FTFC_StartFlashCommand(uint32_t *durationUs)
+{
+    uint32_t address;
+    uint32_t offset;
+    uint32_t i;
+    uint8_t errors;
+
+    address = ((uint32_t)s_fccob[1] << 16) | ((uint32_t)s_fccob[2] << 8) | s_fccob[3];
+    offset  = address - FTFC_DFLASH_ADDRESS;
+    errors  = 0U;
+
+    if ((address < FTFC_DFLASH_ADDRESS) || (offset >= HAL_FTFC_GetDFlashSize()) || (NULL == s_dflash))
+    {
+        /* P-Flash is not modelled, or beyond the D-Flash partition */
+        errors = HAL_FTFC_ERROR_ACCESS;
+    }
+    else if (HAL_FTFC_CMD_PROGRAM_PHRASE == s_fccob[0])
+    {
+        errors      = (0U != (offset % HAL_FTFC_PHRASE_SIZE)) ? HAL_FTFC_ERROR_ACCESS : 0U;
+        *durationUs = FAKE_FTFC_PROGRAM_PHRASE_US;
+
+        for (i = 0U; (0U == errors) && (i < HAL_FTFC_PHRASE_SIZE); i++)
+        {
+            errors = (FTFC_ERASED != s_dflash[offset + i]) ? HAL_FTFC_ERROR_VERIFY : 0U;
+        }
+    }
+    else if (HAL_FTFC_CMD_ERASE_SECTOR == s_fccob[0])
+    {
+        errors      = (0U != (offset % HAL_FTFC_DFLASH_SECTOR)) ? HAL_FTFC_ERROR_ACCESS : 0U;
+        *durationUs = FAKE_FTFC_ERASE_SECTOR_US;
+    }
+    else if (HAL_FTFC_CMD_ERASE_BLOCK == s_fccob[0])
+    {
+        errors      = (0U != offset) ? HAL_FTFC_ERROR_ACCESS : 0U;
+        *durationUs = FAKE_FTFC_ERASE_SECTOR_US * (HAL_FTFC_GetDFlashSize() / HAL_FTFC_DFLASH_SECTOR);
+    }
+    else
+    {
+        errors = HAL_FTFC_ERROR_ACCESS;
+    }
+
+    return errors;
+}
+
+static void FTFC_CompleteFlashCommand(void)
+{
+    uint32_t offset;
+    uint32_t size;
+    uint32_t i;
+
+    offset = (((uint32_t)s_fccob[1] << 16) | ((uint32_t)s_fccob[2] << 8) | s_fccob[3]) - FTFC_DFLASH_ADDRESS;
+
+    s_commandBusy   = 0U;
+    s_errors       |= s_commandErrors | s_failCommand;
+    s_failCommand   = 0U;
+
+    if (0U != s_errors)
+    {
+        /* Failed: contents unchanged */
+    }
+    else if (HAL_FTFC_CMD_PROGRAM_PHRASE == s_fccob[0])
+    {
+        for (i = 0U; i < HAL_FTFC_PHRASE_SIZE; i++)
+        {
+            s_dflash[offset + i] = s_fccob[4U + i];
+        }
+    }
+    else
+    {
+        size = (HAL_FTFC_CMD_ERASE_SECTOR == s_fccob[0]) ? HAL_FTFC_DFLASH_SECTOR : HAL_FTFC_GetDFlashSize();
+        (void)memset((void *)&s_dflash[offset], FTFC_ERASED, size);
+    }
+}
+
+void Fake_FTFC_Reset(uint8_t partitioned)
+{
+    if (NULL == s_flexRam)
+    {
+        s_flexRam = (volatile uint32_t *)FTFC_Map(HAL_FTFC_FLEXRAM_BASE, HAL_FTFC_FLEXRAM_SIZE);
+        s_dflash  = (volatile uint8_t *)FTFC_Map(HAL_FTFC_DFLASH_BASE, HAL_FTFC_DFLASH_SIZE);
+    }
+    else
+    {
+        /* Mapped by an earlier reset */
+    }
+
+    (void)memset(s_backup, 0xFF, sizeof(s_backup));
+    (void)memset(s_fccob, 0, sizeof(s_fccob));
+
+    s_partitioned   = partitioned;
+    s_eeeSize       = (0U != partitioned) ? HAL_FTFC_FLEXRAM_SIZE : 0U;
+    s_eeeReady      = partitioned;              /* Loaded at reset */
+    s_ccie          = 0U;
+    s_errors        = 0U;
+    s_owned         = 0U;
+    s_callback      = NULL;
+    s_callbackParam = NULL;
+    s_recordBusy    = 0U;
+    s_failNext      = 0U;
+    s_commandBusy   = 0U;
+    s_commandWaited = 0U;
+    s_failCommand   = 0U;
+    s_nowUs         = 0U;
+    s_records       = 0U;
+    s_unownedLoads  = 0U;
+
+    if (NULL != s_flexRam)
+    {
+        (void)memcpy((void *)s_flexRam, s_backup, sizeof(s_backup));
+    }
+    else
+    {
+        /* Address taken: the test reports it through TEST_CHECK */
+    }
+
+    if (NULL != s_dflash)
+    {
+        (void)memset((void *)s_dflash, FTFC_ERASED, HAL_FTFC_DFLASH_SIZE);
+    }
+    else
+    {
+        /* Same */
+    }
+}
+
+uint8_t Fake_FTFC_IsMapped(void)
+{
+    return ((NULL != s_flexRam) && (NULL != s_dflash)) ? 1U : 0U;
+}
+
+void Fake_FTFC_Run(uint32_t us)
+{
+    uint64_t end;
+
+    end = s_nowUs + us;
+
+    /* The interrupt may launch the next command of a multi-phrase program */
+    while ((0U != s_commandBusy) && (s_commandDoneUs <= end))
+    {
+        s_nowUs = s_commandDoneUs;
+        FTFC_CompleteFlashCommand();
+
+        if ((0U != s_ccie) && (NULL != s_callback))
+        {
+            s_callback(s_callbackParam);
+        }
+        else
+        {
+            /* Polled */
+        }
+    }
+
+    while ((0U != s_recordBusy) && (s_recordDoneUs <= end))
+    {
+        s_nowUs      = s_recordDoneUs;
+        s_recordBusy = 0U;
+        s_records++;
+
+        if (0U != s_failNext)
+        {
+            /* Record lost: the FlexRAM word falls back to the backup contents */
+            s_failNext                = 0U;
+            s_errors                 |= HAL_FTFC_ERROR_VERIFY;
+            s_flexRam[s_recordIndex]  = s_backup[s_recordIndex];
+        }
+        else
+        {
+            s_backup[s_recordIndex] = s_flexRam[s_recordIndex];
+        }
+
+        if ((0U != s_ccie) && (NULL != s_callback))
+        {
+            s_callback(s_callbackParam);
+        }
+        else
+        {
+            /* Polled */
+        }
+    }
+
+    s_nowUs = end;
+}
+
+uint32_t Fake_FTFC_GetTimeUs(void)
+{
+    return (uint32_t)s_nowUs;
+}
+
+uint32_t Fake_FTFC_GetRecordCount(void)
+{
+    return s_records;
+}
+
+void Fake_FTFC_FailNextRecord(void)
+{
+    s_failNext = 1U;
+}
+
+void Fake_FTFC_FailNextCommand(uint8_t errors)
+{
+    s_failCommand = errors;
+}
+
+uint32_t Fake_FTFC_GetUnownedLoads(void)
+{
+    return s_unownedLoads;
+}
+
+uint8_t Fake_FTFC_GetCommand(void)
+{
+    return s_fccob[0];
+}
+
+/*******************************************************************************
+ * HAL_FTFC API
+ ******************************************************************************/
+
+void HAL_FTFC_Init(void)
+{
+    /* Nothing to enable */
+}
+
+uint8_t HAL_FTFC_Acquire(HAL_FTFC_Callback_t callback, void *param)
+{
+    uint8_t acquired;
+
+    acquired = (0U == s_owned) ? 1U : 0U;
+
+    if (0U != acquired)
+    {
+        s_owned         = 1U;
+        s_callback      = callback;
+        s_callbackParam = param;
+    }
+    else
+    {
+        /* Owned by another user */
+    }
+
+    return acquired;
+}
+
+void HAL_FTFC_Release(void)
+{
+    s_ccie          = 0U;
+    s_owned         = 0U;
+    s_callback      = NULL;
+    s_commandWaited = 0U;
+}
+
+uint8_t HAL_FTFC_IsReady(void)
+{
+    FTFC_Scan();
+
+    return ((0U == s_recordBusy) && (0U == s_commandBusy)) ? 1U : 0U;
+}
+
+uint8_t HAL_FTFC_GetErrors(void)
+{
+    return s_errors;
+}
+
+void HAL_FTFC_ClearErrors(void)
+{
+    s_errors = 0U;
+}
+
+uint8_t HAL_FTFC_IsDFlash(uint32_t address)
+{
+    return ((address >= HAL_FTFC_DFLASH_BASE) && (address < (HAL_FTFC_DFLASH_BASE + HAL_FTFC_DFLASH_SIZE))) ? 1U :
+                                                                                                                0U;
+}
+
+uint32_t HAL_FTFC_GetDFlashSize(void)
+{
+    return (0U != s_partitioned) ? (HAL_FTFC_DFLASH_SIZE / 2U) : HAL_FTFC_DFLASH_SIZE;
+}
+
+uint32_t HAL_FTFC_GetEeeSize(void)
+{
+    return s_eeeSize;
+}
+
+uint8_t HAL_FTFC_IsEeeReady(void)
+{
+    return s_eeeReady;
+}
+
+void HAL_FTFC_SetCommand(uint8_t command, uint32_t address)
+{
+    FTFC_CheckOwner();
+
+    if (0U != HAL_FTFC_IsDFlash(address))
+    {
+        address = FTFC_DFLASH_ADDRESS + (address - HAL_FTFC_DFLASH_BASE);
+    }
+    else
+    {
+        /* P-Flash: system and FTFC addresses are equal */
+    }
+
+    s_fccob[0] = command;
+    s_fccob[1] = (uint8_t)(address >> 16);
+    s_fccob[2] = (uint8_t)(address >> 8);
+    s_fccob[3] = (uint8_t)address;
+}
+
+void HAL_FTFC_SetParam(uint8_t index, uint8_t value)
+{
+    FTFC_CheckOwner();
+
+    s_fccob[index % FTFC_FCCOB_SIZE] = value;
+}
+
+void HAL_FTFC_SetPhrase(const uint8_t *data)
+{
+    FTFC_CheckOwner();
+
+    (void)memcpy(&s_fccob[4], data, HAL_FTFC_PHRASE_SIZE);
+}
+
+void HAL_FTFC_Launch(uint8_t wait)
+{
+    uint32_t durationUs;
+
+    FTFC_CheckOwner();
+
+    if ((HAL_FTFC_CMD_PROGRAM_PHRASE == s_fccob[0]) || (HAL_FTFC_CMD_ERASE_SECTOR == s_fccob[0]) ||
+        (HAL_FTFC_CMD_ERASE_BLOCK == s_fccob[0]))
+    {
+        durationUs      = 0U;
+        s_commandErrors = FTFC_StartFlashCommand(&durationUs);
+        s_commandBusy   = 1U;
+        s_commandWaited = wait;
+        s_commandDoneUs = s_nowUs + durationUs;
+
+        if (0U != wait)
+        {
+            /* Busy wait in RAM: time passes, the interrupt follows CCIE */
+            s_nowUs = s_commandDoneUs;
+            FTFC_CompleteFlashCommand();
+        }
+        else
+        {
+            /* Completes in Fake_FTFC_Run() */
+        }
+    }
+    else if ((HAL_FTFC_CMD_PROGRAM_PARTITION == s_fccob[0]) && (0U == s_partitioned) &&
+        (0U != s_eeeBytes[s_fccob[7] & 0x0FU]))
+    {
+        s_partitioned = 1U;
+        s_eeeSize     = s_eeeBytes[s_fccob[7] & 0x0FU];
+    }
+    else if ((HAL_FTFC_CMD_SET_FLEXRAM == s_fccob[0]) && (HAL_FTFC_FLEXRAM_EEE == s_fccob[1]) && (0U != s_eeeSize))
+    {
+        (void)memcpy((void *)s_flexRam, s_backup, sizeof(s_backup));
+        s_eeeReady = 1U;
+    }
+    else if ((HAL_FTFC_CMD_SET_FLEXRAM == s_fccob[0]) && (HAL_FTFC_FLEXRAM_RAM == s_fccob[1]))
+    {
+        s_eeeReady = 0U;
+    }
+    else
+    {
+        /* Not modelled, or refused by the part */
+        s_errors |= HAL_FTFC_ERROR_ACCESS;
+    }
+}
+
+void HAL_FTFC_EnableCompleteInterrupt(uint8_t enable)
+{
+    s_ccie = enable;
+
+    FTFC_Scan();
+
+    /* CCIE with CCIF already set by a waited command enters the handler at once */
+    if ((0U != enable) && (0U != s_commandWaited) && (NULL != s_callback))
+    {
+        s_commandWaited = 0U;
+        s_callback(s_callbackParam);
+    }
+    else
+    {
+        /* Interrupt follows completion */
+    }
+}
+
+void HAL_FTFC_InvalidateCache(void)
+{
+    /* No cache on the host */
+}
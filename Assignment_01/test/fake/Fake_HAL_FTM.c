@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * @file    Fake_HAL_FTM.c
+ * @brief   Host model of the FTM quadrature decoder behind the HAL_FTM API
+ *          C file.
+ *
+ * CNT is a word the driver reads through HAL_FTM_GetCounterAddress(), as
+ * on the part. With the decoder enabled and the timer started, encoder
+ * movement steps it up or down between CNTIN (0) and MOD, wrapping at
+ * both ends. An index edge on a capture channel copies CNT to CnV and
+ * enters the callback when the channel interrupt is on.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef struct
+{
+    volatile uint32_t   counter;                            /**< CNT */
+    uint16_t            modulo;
+    uint16_t            value[HAL_FTM_CHANNEL_COUNT];       /**< CnV */
+    uint32_t            mode[HAL_FTM_CHANNEL_COUNT];        /**< CnSC */
+    uint32_t            quadrature;                         /**< QDCTRL */
+    uint8_t             running;
+    HAL_FTM_Callback_t  callback;
+    void               *param;
+} FTM_Model_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static FTM_Model_t s_ftm[HAL_FTM_MAX];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void Fake_FTM_Move(HAL_FTM_Instance_t instance, int32_t counts)
+{
+    FTM_Model_t *ftm = &s_ftm[instance];
+    uint32_t range;
+    int64_t counter;
+
+    if ((0U != ftm->running) && (0U != (ftm->quadrature & HAL_FTM_QUAD_ENABLE)))
+    {
+        range   = (uint32_t)ftm->modulo + 1U;
+        counter = ((int64_t)ftm->counter + counts) % (int64_t)range;
+        counter = (counter < 0) ? (counter + (int64_t)range) : counter;
+
+        ftm->counter = (uint32_t)counter;
+    }
+    else
+    {
+        /* Decoder off: the phases do not count */
+    }
+}
+
+void Fake_FTM_Capture(HAL_FTM_Instance_t instance, uint8_t channel)
+{
+    FTM_Model_t *ftm = &s_ftm[instance];
+
+    if (0U != (ftm->mode[channel] & HAL_FTM_CH_CAPTURE_BOTH))
+    {
+        ftm->value[channel] = (uint16_t)ftm->counter;
+
+        if ((0U != (ftm->mode[channel] & HAL_FTM_CH_IRQ)) && (NULL != ftm->callback))
+        {
+            ftm->callback(instance, HAL_FTM_STATUS_CHANNEL(channel), ftm->param);
+        }
+        else
+        {
+            /* Flag only */
+        }
+    }
+    else
+    {
+        /* Not an input capture channel */
+    }
+}
+
+uint32_t Fake_FTM_GetQuadrature(HAL_FTM_Instance_t instance)
+{
+    return s_ftm[instance].quadrature;
+}
+
+/*******************************************************************************
+ * HAL_FTM API
+ ******************************************************************************/
+
+void HAL_FTM_Init(HAL_FTM_Instance_t instance, uint8_t prescaler, uint16_t modulo)
+{
+    FTM_Model_t *ftm = &s_ftm[instance];
+    uint32_t i;
+
+    (void)prescaler;
+
+    ftm->counter    = 0U;
+    ftm->modulo     = modulo;
+    ftm->quadrature = 0U;
+    ftm->running    = 0U;
+    ftm->callback   = NULL;
+    ftm->param      = NULL;
+
+    for (i = 0U; i < HAL_FTM_CHANNEL_COUNT; i++)
+    {
+        ftm->value[i] = 0U;
+        ftm->mode[i]  = HAL_FTM_CH_DISABLED;
+    }
+}
+
+void HAL_FTM_Start(HAL_FTM_Instance_t instance)
+{
+    s_ftm[instance].running = 1U;
+}
+
+void HAL_FTM_Stop(HAL_FTM_Instance_t instance)
+{
+    s_ftm[instance].running = 0U;
+}
+
+void HAL_FTM_SetChannel(HAL_FTM_Instance_t instance, uint8_t channel, uint32_t mode)
+{
+    s_ftm[instance].mode[channel] = mode;
+}
+
+void HAL_FTM_SetQuadrature(HAL_FTM_Instance_t instance, uint32_t flags)
+{
+    s_ftm[instance].quadrature = flags;
+}
+
+void HAL_FTM_SetInputFilter(HAL_FTM_Instance_t instance, uint8_t channel, uint8_t value)
+{
+    (void)instance;
+    (void)channel;
+    (void)value;
+}
+
+uint16_t HAL_FTM_GetValue(HAL_FTM_Instance_t instance, uint8_t channel)
+{
+    return s_ftm[instance].value[channel];
+}
+
+uint32_t HAL_FTM_GetCounterAddress(HAL_FTM_Instance_t instance)
+{
+    return (uint32_t)(uintptr_t)&s_ftm[instance].counter;
+}
+
+void HAL_FTM_RegisterCallback(HAL_FTM_Instance_t instance, HAL_FTM_Callback_t callback, void *param)
+{
+    s_ftm[instance].callback = callback;
+    s_ftm[instance].param    = param;
+}
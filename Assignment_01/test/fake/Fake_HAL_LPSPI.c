@@ -0,0 +1,463 @@
+/*******************************************************************************
+ * @file    Fake_HAL_LPSPI.c
+ * @brief   Host model of the LPSPI master behind the HAL_LPSPI API C file.
+ *
+ * Cycle model at the 48 MHz functional clock, which is also taken as the
+ * core clock: the shifter spends frameBits * divider cycles per frame,
+ * SOUT is looped back to SIN, a frame finishing into a full RX FIFO is an
+ * overflow. Around it the model charges what the real system pays:
+ * - eDMA: FAKE_DMA_SERVICE_CYCLES per minor loop, one channel at a time;
+ * - interrupts: FAKE_IRQ_ENTRY_CYCLES before the handler runs, then
+ *   FAKE_FIFO_ACCESS_CYCLES per FIFO access it made plus
+ *   FAKE_IRQ_EXIT_CYCLES during which no other interrupt is taken.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define LPSPI_FIFO_SIZE     (4U)
+
+typedef struct
+{
+    uint8_t             isCommand;
+    uint32_t            data;
+    HAL_LPSPI_Command_t command;
+} LPSPI_Entry_t;
+
+typedef struct
+{
+    uint8_t             enabled;
+    uint8_t             dma;
+    uint8_t             txWater;
+    uint8_t             rxWater;
+    uint32_t            irqMask;
+    uint32_t            status;
+    uint32_t            divider;        /**< Functional clocks per SCK  */
+
+    LPSPI_Entry_t       tx[LPSPI_FIFO_SIZE];
+    uint8_t             txHead;
+    uint8_t             txCount;
+    uint32_t            rx[LPSPI_FIFO_SIZE];
+    uint8_t             rxHead;
+    uint8_t             rxCount;
+    uint32_t            txRegister;     /**< TDR as seen by the DMA     */
+    uint32_t            rxRegister;     /**< RDR as seen by the DMA     */
+
+    HAL_LPSPI_Command_t command;        /**< Current TCR                */
+    uint8_t             pcsAsserted;
+    uint32_t            shifting;       /**< Cycles left in the frame   */
+    uint32_t            shiftData;
+
+    uint32_t            dmaBusy;
+    uint32_t            irqEntry;       /**< Cycles until handler runs  */
+    uint32_t            cpuBusy;
+    uint32_t            accesses;       /**< FIFO accesses by software  */
+
+    uint32_t            shiftCycles;
+    uint32_t            csReleases;
+    uint32_t            irqCount;
+} LPSPI_Model_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern void LPSPI0_IRQHandler(void) __attribute__((weak));
+extern void LPSPI1_IRQHandler(void) __attribute__((weak));
+extern void LPSPI2_IRQHandler(void) __attribute__((weak));
+
+static void (* const s_handler[HAL_LPSPI_MAX])(void) =
+{
+    LPSPI0_IRQHandler,
+    LPSPI1_IRQHandler,
+    LPSPI2_IRQHandler
+};
+
+static const dma_request_source_t s_txRequest[HAL_LPSPI_MAX] =
+{
+    EDMA_REQ_LPSPI0_TX, EDMA_REQ_LPSPI1_TX, EDMA_REQ_LPSPI2_TX
+};
+
+static const dma_request_source_t s_rxRequest[HAL_LPSPI_MAX] =
+{
+    EDMA_REQ_LPSPI0_RX, EDMA_REQ_LPSPI1_RX, EDMA_REQ_LPSPI2_RX
+};
+
+static LPSPI_Model_t s_lpspi[HAL_LPSPI_MAX];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void LPSPI_PushTx(LPSPI_Model_t *spi, const LPSPI_Entry_t *entry);
+static void LPSPI_Shifter(LPSPI_Model_t *spi);
+static uint32_t LPSPI_Flags(const LPSPI_Model_t *spi);
+static uint8_t LPSPI_DmaRead(HAL_LPSPI_Instance_t instance, LPSPI_Model_t *spi);
+static uint8_t LPSPI_DmaWrite(HAL_LPSPI_Instance_t instance, LPSPI_Model_t *spi);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void LPSPI_PushTx(LPSPI_Model_t *spi, const LPSPI_Entry_t *entry)
+{
+    if (spi->txCount < LPSPI_FIFO_SIZE)
+    {
+        spi->tx[(spi->txHead + spi->txCount) % LPSPI_FIFO_SIZE] = *entry;
+        spi->txCount++;
+    }
+    else
+    {
+        /* Write to a full FIFO is lost */
+        spi->status |= HAL_LPSPI_STATUS_TX_ERR;
+    }
+}
+
+static void LPSPI_Shifter(LPSPI_Model_t *spi)
+{
+    LPSPI_Entry_t *entry;
+
+    if (0U != spi->shifting)
+    {
+        spi->shifting--;
+        spi->shiftCycles++;
+
+        if (0U == spi->shifting)
+        {
+            if (spi->rxCount < LPSPI_FIFO_SIZE)
+            {
+                spi->rx[(spi->rxHead + spi->rxCount) % LPSPI_FIFO_SIZE] = spi->shiftData;
+                spi->rxCount++;
+            }
+            else
+            {
+                spi->status |= HAL_LPSPI_STATUS_RX_ERR;
+            }
+
+            if (0U == spi->command.cont)
+            {
+                spi->pcsAsserted = 0U;
+                spi->csReleases++;
+            }
+            else
+            {
+                /* Continuous: PCS stays asserted */
+            }
+        }
+        else
+        {
+            /* Frame in progress */
+        }
+    }
+    else if ((0U != spi->enabled) && (0U != spi->txCount))
+    {
+        entry = &spi->tx[spi->txHead];
+        spi->txHead = (uint8_t)((spi->txHead + 1U) % LPSPI_FIFO_SIZE);
+        spi->txCount--;
+
+        if (0U != entry->isCommand)
+        {
+            /* A new command without CONTC ends a continuous transfer */
+            if ((0U != spi->pcsAsserted) && ((0U == entry->command.cont) || (0U == entry->command.contc)))
+            {
+                spi->pcsAsserted = 0U;
+                spi->csReleases++;
+            }
+            else
+            {
+                /* PCS unchanged */
+            }
+
+            spi->command = entry->command;
+        }
+        else
+        {
+            spi->pcsAsserted = 1U;
+            spi->shiftData   = (32U == spi->command.frameBits) ? entry->data :
+                               (entry->data & ((1UL << spi->command.frameBits) - 1UL));
+            spi->shifting    = (uint32_t)spi->command.frameBits * spi->divider;
+        }
+    }
+    else
+    {
+        /* Stalled: NOSTALL = 0 waits for the FIFO instead of underrunning */
+    }
+}
+
+static uint32_t LPSPI_Flags(const LPSPI_Model_t *spi)
+{
+    uint32_t flags;
+
+    flags = spi->status;
+    flags |= (spi->txCount <= spi->txWater) ? HAL_LPSPI_STATUS_TX : 0U;
+    flags |= (spi->rxCount > spi->rxWater) ? HAL_LPSPI_STATUS_RX : 0U;
+    flags |= ((0U != spi->shifting) || (0U != spi->txCount)) ? HAL_LPSPI_STATUS_BUSY : 0U;
+
+    return flags;
+}
+
+/* RDR read by the RX channel pops the FIFO */
+static uint8_t LPSPI_DmaRead(HAL_LPSPI_Instance_t instance, LPSPI_Model_t *spi)
+{
+    uint8_t serviced;
+
+    spi->rxRegister = spi->rx[spi->rxHead];
+    serviced = Fake_DMA_Request(s_rxRequest[instance]);
+
+    if (0U != serviced)
+    {
+        spi->rxHead = (uint8_t)((spi->rxHead + 1U) % LPSPI_FIFO_SIZE);
+        spi->rxCount--;
+    }
+    else
+    {
+        /* No channel listening */
+    }
+
+    return serviced;
+}
+
+/* TDR written by the TX channel pushes the FIFO */
+static uint8_t LPSPI_DmaWrite(HAL_LPSPI_Instance_t instance, LPSPI_Model_t *spi)
+{
+    LPSPI_Entry_t entry;
+    uint8_t serviced;
+
+    serviced = Fake_DMA_Request(s_txRequest[instance]);
+
+    if (0U != serviced)
+    {
+        (void)memset(&entry, 0, sizeof(entry));
+        entry.data = spi->txRegister;
+        LPSPI_PushTx(spi, &entry);
+    }
+    else
+    {
+        /* No channel listening */
+    }
+
+    return serviced;
+}
+
+void Fake_LPSPI_Run(HAL_LPSPI_Instance_t instance, uint32_t cycles)
+{
+    LPSPI_Model_t *spi;
+    uint32_t flags;
+
+    spi = &s_lpspi[instance];
+
+    while (0U != cycles)
+    {
+        cycles--;
+
+        LPSPI_Shifter(spi);
+        flags = LPSPI_Flags(spi);
+
+        /* One eDMA channel at a time, RX first (higher channel priority is not modelled) */
+        if (0U != spi->dmaBusy)
+        {
+            spi->dmaBusy--;
+        }
+        else if ((0U != spi->dma) && (0U != (flags & HAL_LPSPI_STATUS_RX)) &&
+                 (0U != LPSPI_DmaRead(instance, spi)))
+        {
+            spi->dmaBusy = FAKE_DMA_SERVICE_CYCLES;
+        }
+        else if ((0U != spi->dma) && (0U != (flags & HAL_LPSPI_STATUS_TX)) &&
+                 (0U != LPSPI_DmaWrite(instance, spi)))
+        {
+            spi->dmaBusy = FAKE_DMA_SERVICE_CYCLES;
+        }
+        else
+        {
+            /* No request */
+        }
+
+        if (0U != spi->cpuBusy)
+        {
+            spi->cpuBusy--;
+        }
+        else if (0U != spi->irqEntry)
+        {
+            spi->irqEntry--;
+
+            if (0U == spi->irqEntry)
+            {
+                spi->accesses = 0U;
+                spi->irqCount++;
+                s_handler[instance]();
+                spi->cpuBusy = (spi->accesses * FAKE_FIFO_ACCESS_CYCLES) + FAKE_IRQ_EXIT_CYCLES;
+            }
+            else
+            {
+                /* Stacking */
+            }
+        }
+        else if ((0U != (flags & spi->irqMask)) && (NULL != s_handler[instance]))
+        {
+            spi->irqEntry = FAKE_IRQ_ENTRY_CYCLES;
+        }
+        else
+        {
+            /* No interrupt */
+        }
+    }
+}
+
+uint32_t Fake_LPSPI_GetShiftCycles(HAL_LPSPI_Instance_t instance)
+{
+    return s_lpspi[instance].shiftCycles;
+}
+
+uint32_t Fake_LPSPI_GetCsReleases(HAL_LPSPI_Instance_t instance)
+{
+    return s_lpspi[instance].csReleases;
+}
+
+uint8_t Fake_LPSPI_IsCsAsserted(HAL_LPSPI_Instance_t instance)
+{
+    return s_lpspi[instance].pcsAsserted;
+}
+
+uint32_t Fake_LPSPI_GetInterruptCount(HAL_LPSPI_Instance_t instance)
+{
+    return s_lpspi[instance].irqCount;
+}
+
+void HAL_LPSPI_Init(HAL_LPSPI_Instance_t instance)
+{
+    (void)memset(&s_lpspi[instance], 0, sizeof(s_lpspi[instance]));
+    s_lpspi[instance].divider = 2U;
+}
+
+void HAL_LPSPI_Deinit(HAL_LPSPI_Instance_t instance)
+{
+    s_lpspi[instance].enabled = 0U;
+    s_lpspi[instance].irqMask = 0U;
+    s_lpspi[instance].dma     = 0U;
+}
+
+void HAL_LPSPI_Enable(HAL_LPSPI_Instance_t instance, uint8_t enable)
+{
+    s_lpspi[instance].enabled = enable;
+}
+
+void HAL_LPSPI_SetMaster(HAL_LPSPI_Instance_t instance)
+{
+    (void)instance;
+}
+
+uint32_t HAL_LPSPI_SetBaudRate(HAL_LPSPI_Instance_t instance, uint32_t busSpeed)
+{
+    uint32_t divider;
+
+    divider = (HAL_LPSPI_CLOCK_HZ + busSpeed - 1UL) / busSpeed;
+    divider = (divider < 2UL) ? 2UL : divider;
+    s_lpspi[instance].divider = divider;
+
+    return HAL_LPSPI_CLOCK_HZ / divider;
+}
+
+void HAL_LPSPI_WriteCommand(HAL_LPSPI_Instance_t instance, const HAL_LPSPI_Command_t *command)
+{
+    LPSPI_Entry_t entry;
+
+    entry.isCommand = 1U;
+    entry.data      = 0U;
+    entry.command   = *command;
+    LPSPI_PushTx(&s_lpspi[instance], &entry);
+    s_lpspi[instance].accesses++;
+}
+
+uint8_t HAL_LPSPI_GetFifoSize(HAL_LPSPI_Instance_t instance)
+{
+    (void)instance;
+
+    return LPSPI_FIFO_SIZE;
+}
+
+void HAL_LPSPI_SetWatermarks(HAL_LPSPI_Instance_t instance, uint8_t txWater, uint8_t rxWater)
+{
+    s_lpspi[instance].txWater = txWater;
+    s_lpspi[instance].rxWater = rxWater;
+}
+
+uint8_t HAL_LPSPI_GetTxFifoCount(HAL_LPSPI_Instance_t instance)
+{
+    s_lpspi[instance].accesses++;
+
+    return s_lpspi[instance].txCount;
+}
+
+uint8_t HAL_LPSPI_IsRxEmpty(HAL_LPSPI_Instance_t instance)
+{
+    s_lpspi[instance].accesses++;
+
+    return (0U == s_lpspi[instance].rxCount) ? 1U : 0U;
+}
+
+void HAL_LPSPI_WriteData(HAL_LPSPI_Instance_t instance, uint32_t data)
+{
+    LPSPI_Entry_t entry;
+
+    (void)memset(&entry, 0, sizeof(entry));
+    entry.data = data;
+    LPSPI_PushTx(&s_lpspi[instance], &entry);
+    s_lpspi[instance].accesses++;
+}
+
+uint32_t HAL_LPSPI_ReadData(HAL_LPSPI_Instance_t instance)
+{
+    LPSPI_Model_t *spi;
+    uint32_t data;
+
+    spi  = &s_lpspi[instance];
+    data = spi->rx[spi->rxHead];
+    spi->rxHead = (uint8_t)((spi->rxHead + 1U) % LPSPI_FIFO_SIZE);
+    spi->rxCount--;
+    spi->accesses++;
+
+    return data;
+}
+
+void HAL_LPSPI_SetInterrupts(HAL_LPSPI_Instance_t instance, uint32_t mask)
+{
+    s_lpspi[instance].irqMask = mask;
+}
+
+uint32_t HAL_LPSPI_GetStatus(HAL_LPSPI_Instance_t instance)
+{
+    return LPSPI_Flags(&s_lpspi[instance]);
+}
+
+void HAL_LPSPI_ClearStatus(HAL_LPSPI_Instance_t instance, uint32_t mask)
+{
+    s_lpspi[instance].status &= ~mask;
+}
+
+void HAL_LPSPI_EnableDma(HAL_LPSPI_Instance_t instance, uint8_t enable)
+{
+    s_lpspi[instance].dma = enable;
+}
+
+uint32_t HAL_LPSPI_GetTxDataAddress(HAL_LPSPI_Instance_t instance)
+{
+    return (uint32_t)(uintptr_t)&s_lpspi[instance].txRegister;
+}
+
+uint32_t HAL_LPSPI_GetRxDataAddress(HAL_LPSPI_Instance_t instance)
+{
+    return (uint32_t)(uintptr_t)&s_lpspi[instance].rxRegister;
+}
+
+void HAL_LPSPI_FlushFifo(HAL_LPSPI_Instance_t instance)
+{
+    s_lpspi[instance].txCount = 0U;
+    s_lpspi[instance].rxCount = 0U;
+}
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * @file    Fake_HAL_LPUART.c
+ * @brief   Host model of the LPUART behind the HAL_LPUART API C file.
+ *
+ * Character-time model: no bit timing, but the transmitter, the loopback
+ * path, the receiver DMA request, overrun, idle-line and transmission
+ * complete behave as on the device.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <string.h>
+#include "Fake_HAL.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define LPUART_W1C_FLAGS    (HAL_LPUART_STATUS_IDLE | HAL_LPUART_STATUS_OVERRUN | HAL_LPUART_STATUS_NOISE | \
+                             HAL_LPUART_STATUS_FRAMING | HAL_LPUART_STATUS_PARITY | HAL_LPUART_STATUS_BREAK)
+
+#define LPUART_ERROR_FLAGS  (HAL_LPUART_STATUS_OVERRUN | HAL_LPUART_STATUS_NOISE | \
+                             HAL_LPUART_STATUS_FRAMING | HAL_LPUART_STATUS_PARITY)
+
+typedef struct
+{
+    uint8_t     txEnabled;
+    uint8_t     rxEnabled;
+    uint8_t     txDma;
+    uint8_t     rxDma;
+    uint8_t     loopback;
+    uint8_t     idleChars;
+    uint8_t     errorIrq;
+    uint8_t     tcIrq;
+    uint8_t     rxSinceIdle;    /**< A byte arrived since IDLE was last raised */
+    uint32_t    silent;         /**< Character times since the last byte       */
+    uint32_t    status;
+    uint32_t    data;           /**< DATA register                             */
+    uint32_t    txCount;
+    uint32_t    irqCount;
+} LPUART_Model_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern void LPUART0_RxTx_IRQHandler(void) __attribute__((weak));
+extern void LPUART1_RxTx_IRQHandler(void) __attribute__((weak));
+extern void LPUART2_RxTx_IRQHandler(void) __attribute__((weak));
+
+static void (* const s_handler[HAL_LPUART_MAX])(void) =
+{
+    LPUART0_RxTx_IRQHandler,
+    LPUART1_RxTx_IRQHandler,
+    LPUART2_RxTx_IRQHandler
+};
+
+static const dma_request_source_t s_txRequest[HAL_LPUART_MAX] =
+{
+    EDMA_REQ_LPUART0_TX, EDMA_REQ_LPUART1_TX, EDMA_REQ_LPUART2_TX
+};
+
+static const dma_request_source_t s_rxRequest[HAL_LPUART_MAX] =
+{
+    EDMA_REQ_LPUART0_RX, EDMA_REQ_LPUART1_RX, EDMA_REQ_LPUART2_RX
+};
+
+static LPUART_Model_t s_lpuart[HAL_LPUART_MAX];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void Fake_LPUART_Run(HAL_LPUART_Instance_t instance, uint32_t charTimes)
+{
+    LPUART_Model_t *uart;
+    uint8_t sent;
+    uint8_t raise;
+
+    uart = &s_lpuart[instance];
+
+    while (0U != charTimes)
+    {
+        charTimes--;
+        sent = 0U;
+
+        if ((0U != uart->txEnabled) && (0U != uart->txDma) && (0U != Fake_DMA_Request(s_txRequest[instance])))
+        {
+            sent = 1U;
+            uart->txCount++;
+            uart->status &= ~HAL_LPUART_STATUS_TC;
+        }
+        else
+        {
+            /* Transmitter runs dry */
+        }
+
+        if ((0U != sent) && (0U != uart->loopback) && (0U != uart->rxEnabled))
+        {
+            /* Same DATA register: the byte just written is the byte received */
+            uart->silent      = 0U;
+            uart->rxSinceIdle = 1U;
+
+            if ((0U == uart->rxDma) || (0U == Fake_DMA_Request(s_rxRequest[instance])))
+            {
+                uart->status |= HAL_LPUART_STATUS_OVERRUN;
+            }
+            else
+            {
+                /* Taken by the RX channel */
+            }
+        }
+        else
+        {
+            uart->silent++;
+
+            if ((0U != uart->rxSinceIdle) && (0U != uart->idleChars) && (uart->silent >= uart->idleChars))
+            {
+                uart->status     |= HAL_LPUART_STATUS_IDLE;
+                uart->rxSinceIdle = 0U;
+            }
+            else
+            {
+                /* Line busy or already reported */
+            }
+        }
+
+        if ((0U == sent) && (0U != uart->txEnabled))
+        {
+            uart->status |= HAL_LPUART_STATUS_TC;
+        }
+        else
+        {
+            /* Still shifting */
+        }
+
+        raise = ((0U != (uart->status & HAL_LPUART_STATUS_IDLE)) && (0U != uart->idleChars)) ||
+                ((0U != (uart->status & HAL_LPUART_STATUS_TC)) && (0U != uart->tcIrq)) ||
+                ((0U != (uart->status & LPUART_ERROR_FLAGS)) && (0U != uart->errorIrq));
+
+        if ((0U != raise) && (NULL != s_handler[instance]))
+        {
+            uart->irqCount++;
+            s_handler[instance]();
+        }
+        else
+        {
+            /* No enabled flag */
+        }
+    }
+}
+
+uint32_t Fake_LPUART_GetTxCount(HAL_LPUART_Instance_t instance)
+{
+    return s_lpuart[instance].txCount;
+}
+
+uint32_t Fake_LPUART_GetInterruptCount(HAL_LPUART_Instance_t instance)
+{
+    return s_lpuart[instance].irqCount;
+}
+
+void HAL_LPUART_Init(HAL_LPUART_Instance_t instance)
+{
+    (void)memset(&s_lpuart[instance], 0, sizeof(s_lpuart[instance]));
+}
+
+void HAL_LPUART_Deinit(HAL_LPUART_Instance_t instance)
+{
+    s_lpuart[instance].txEnabled = 0U;
+    s_lpuart[instance].rxEnabled = 0U;
+}
+
+uint8_t HAL_LPUART_SetBaudRate(HAL_LPUART_Instance_t instance, uint32_t baudRate)
+{
+    (void)instance;
+
+    /* OSR 4 ... 32, SBR 1 ... 8191 */
+    return ((baudRate <= (HAL_LPUART_CLOCK_HZ / 4UL)) && (baudRate >= (HAL_LPUART_CLOCK_HZ / (32UL * 8191UL)))) ?
+           1U : 0U;
+}
+
+void HAL_LPUART_SetFormat(HAL_LPUART_Instance_t instance, uint8_t dataBits,
+                          HAL_LPUART_Parity_t parity, uint8_t stopBits)
+{
+    (void)instance;
+    (void)dataBits;
+    (void)parity;
+    (void)stopBits;
+}
+
+void HAL_LPUART_EnableTx(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].txEnabled = enable;
+}
+
+void HAL_LPUART_EnableRx(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].rxEnabled = enable;
+}
+
+void HAL_LPUART_EnableTxDma(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].txDma = enable;
+}
+
+void HAL_LPUART_EnableRxDma(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].rxDma = enable;
+}
+
+void HAL_LPUART_SetIdleInterrupt(HAL_LPUART_Instance_t instance, uint8_t idleChars)
+{
+    s_lpuart[instance].idleChars = idleChars;
+}
+
+void HAL_LPUART_EnableErrorInterrupts(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].errorIrq = enable;
+}
+
+void HAL_LPUART_EnableTcInterrupt(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].tcIrq = enable;
+}
+
+void HAL_LPUART_SetLoopback(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    s_lpuart[instance].loopback = enable;
+}
+
+void HAL_LPUART_SetBreak(HAL_LPUART_Instance_t instance, uint8_t enable)
+{
+    (void)instance;
+    (void)enable;
+}
+
+uint32_t HAL_LPUART_GetStatus(HAL_LPUART_Instance_t instance)
+{
+    return s_lpuart[instance].status;
+}
+
+void HAL_LPUART_ClearStatus(HAL_LPUART_Instance_t instance, uint32_t mask)
+{
+    s_lpuart[instance].status &= ~(mask & LPUART_W1C_FLAGS);
+}
+
+uint32_t HAL_LPUART_GetDataAddress(HAL_LPUART_Instance_t instance)
+{
+    return (uint32_t)(uintptr_t)&s_lpuart[instance].data;
+}
+
+void HAL_LPUART_FlushFifo(HAL_LPUART_Instance_t instance)
+{
+    (void)instance;
+}
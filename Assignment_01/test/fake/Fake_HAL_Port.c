@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * @file    Fake_HAL_Port.c
+ * @brief   Host stand-ins for the NVIC and GPIO HALs C file.
+ *
+ * Interrupts are entered by the peripheral models directly, pins only
+ * keep their output level for the tests that look at chip selects.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include "Fake_HAL.h"
+#include "HAL_NVIC.h"
+#include "HAL_GPIO.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint32_t s_pinLevel[HAL_GPIO_PORT_MAX];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+uint8_t Fake_GPIO_GetPin(uint8_t port, uint8_t pin)
+{
+    return (uint8_t)((s_pinLevel[port] >> pin) & 1U);
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void HAL_NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+    (void)irq;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type irq, uint8_t priority)
+{
+    (void)irq;
+    (void)priority;
+}
+
+void HAL_GPIO_Init(const uint8_t portNumber, const uint8_t pinNumber)
+{
+    (void)portNumber;
+    (void)pinNumber;
+}
+
+void HAL_GPIO_SetDirection(const uint8_t portNumber, const uint8_t pinNumber, HAL_GPIO_Dir_t direction)
+{
+    (void)portNumber;
+    (void)pinNumber;
+    (void)direction;
+}
+
+void HAL_GPIO_SetPullResistor(const uint8_t portNumber, const uint8_t pinNumber, HAL_GPIO_Pull_t mode)
+{
+    (void)portNumber;
+    (void)pinNumber;
+    (void)mode;
+}
+
+void HAL_GPIO_WritePin(const uint8_t portNumber, const uint8_t pinNumber, const uint32_t mode)
+{
+    if (0U != mode)
+    {
+        s_pinLevel[portNumber] |= (1UL << pinNumber);
+    }
+    else
+    {
+        s_pinLevel[portNumber] &= ~(1UL << pinNumber);
+    }
+}
+
+void HAL_GPIO_SetPinMux(const uint8_t portNumber, const uint8_t pinNumber, const uint8_t mux)
+{
+    (void)portNumber;
+    (void)pinNumber;
+    (void)mux;
+}
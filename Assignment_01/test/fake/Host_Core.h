@@ -0,0 +1,30 @@
+/*******************************************************************************
+ * @file    Host_Core.h
+ * @brief   Host replacements for the core intrinsics header file.
+ *
+ * Force-included by the test Makefile ahead of every source: it pulls in
+ * s32_core_cm4.h first and replaces the instructions that only exist on
+ * the Cortex-M4 by their host meaning, the include guard keeps the
+ * originals out afterwards.
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+
+#ifndef HOST_CORE_H_
+#define HOST_CORE_H_
+
+#include "s32_core_cm4.h"
+
+#undef  ENABLE_INTERRUPTS
+#undef  DISABLE_INTERRUPTS
+#undef  STANDBY
+#undef  NOP
+
+/* One thread plays every context, there is nothing to mask */
+#define ENABLE_INTERRUPTS()     do { } while (0)
+#define DISABLE_INTERRUPTS()    do { } while (0)
+#define STANDBY()               do { } while (0)
+#define NOP()                   do { } while (0)
+
+#endif /* HOST_CORE_H_ */
@@ -0,0 +1,380 @@
+/*******************************************************************************
+ * @file    Image_Seal.c
+ * @brief   Post-build sealing of the Image_Verify descriptor C file.
+ *
+ * Host tool run on the linked ELF (makefile.targets): finds the
+ * descriptor through the __image_info__ symbol, computes the CRC-32 of
+ * every range over the bytes the flash will hold (load addresses of the
+ * program headers, gaps read as erased 0xFF) and writes the CRC words in
+ * place. The ranges exclude the descriptor, so sealing again gives the
+ * same words.
+ *
+ * Usage: Image_Seal <image.elf>
+ *        Image_Seal -c <image.elf>     check only, exit 1 if not sealed
+ *
+ * @date    Oct 19, 2026
+ * @author  Chu Nhat Minh Quan
+ ******************************************************************************/
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "CRC_Soft.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define SEAL_SYMBOL             "__image_info__"
+#define SEAL_MAGIC              (0x31474D49UL)      /**< IMAGE_VERIFY_MAGIC */
+#define SEAL_RANGE_MAX          (4U)                /**< IMAGE_VERIFY_RANGE_MAX */
+#define SEAL_RANGE_SIZE         (16U)               /**< start, size, crc, flags */
+#define SEAL_CRC_OFFSET         (8U)
+#define SEAL_HEADER_SIZE        (8U)                /**< magic, count */
+#define SEAL_ERASED             (0xFFU)
+
+/* ELF32, little endian */
+#define ELF_CLASS32             (1U)
+#define ELF_DATA_LSB            (1U)
+#define ELF_MACHINE_ARM         (40U)
+#define ELF_PT_LOAD             (1U)
+#define ELF_SHT_SYMTAB          (2U)
+#define ELF_SYM_SIZE            (16U)
+
+typedef struct
+{
+    uint8_t     *data;
+    size_t      size;
+} Seal_File_t;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t Seal_Read32(const Seal_File_t *file, size_t offset)
+{
+    const uint8_t *p;
+
+    p = &file->data[offset];
+
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t Seal_Read16(const Seal_File_t *file, size_t offset)
+{
+    return (uint16_t)(file->data[offset] | (file->data[offset + 1U] << 8));
+}
+
+static void Seal_Write32(Seal_File_t *file, size_t offset, uint32_t value)
+{
+    file->data[offset]      = (uint8_t)value;
+    file->data[offset + 1U] = (uint8_t)(value >> 8);
+    file->data[offset + 2U] = (uint8_t)(value >> 16);
+    file->data[offset + 3U] = (uint8_t)(value >> 24);
+}
+
+static int Seal_Load(const char *path, Seal_File_t *file)
+{
+    FILE *stream;
+    long size;
+    int result;
+
+    result = -1;
+    stream = fopen(path, "rb");
+
+    if (NULL != stream)
+    {
+        size = ((0 == fseek(stream, 0, SEEK_END)) ? ftell(stream) : -1L);
+        file->data = (size > 0L) ? (uint8_t *)malloc((size_t)size) : NULL;
+        file->size = (size_t)size;
+
+        if ((NULL != file->data) && (0 == fseek(stream, 0, SEEK_SET)) &&
+            (file->size == fread(file->data, 1U, file->size, stream)))
+        {
+            result = 0;
+        }
+        else
+        {
+            (void)fprintf(stderr, "Image_Seal: cannot read %s\n", path);
+        }
+
+        (void)fclose(stream);
+    }
+    else
+    {
+        (void)fprintf(stderr, "Image_Seal: cannot open %s\n", path);
+    }
+
+    return result;
+}
+
+static int Seal_Save(const char *path, const Seal_File_t *file)
+{
+    FILE *stream;
+    int result;
+
+    result = -1;
+    stream = fopen(path, "r+b");
+
+    if ((NULL != stream) && (file->size == fwrite(file->data, 1U, file->size, stream)))
+    {
+        result = 0;
+    }
+    else
+    {
+        (void)fprintf(stderr, "Image_Seal: cannot write %s\n", path);
+    }
+
+    if (NULL != stream)
+    {
+        result = (0 == fclose(stream)) ? result : -1;
+    }
+    else
+    {
+        /* Not opened */
+    }
+
+    return result;
+}
+
+/* Address of a symbol from the symbol table, 0 if not found. */
+static uint32_t Seal_FindSymbol(const Seal_File_t *file, const char *name)
+{
+    uint32_t shoff;
+    uint32_t symoff;
+    uint32_t symsize;
+    uint32_t stroff;
+    uint32_t strsize;
+    uint32_t nameoff;
+    uint32_t address;
+    uint16_t shentsize;
+    uint16_t shnum;
+    uint16_t i;
+    uint32_t j;
+    size_t sh;
+
+    address   = 0U;
+    shoff     = Seal_Read32(file, 32U);
+    shentsize = Seal_Read16(file, 46U);
+    shnum     = Seal_Read16(file, 48U);
+
+    for (i = 0U; (0U == address) && (i < shnum) && ((shoff + ((size_t)(i + 1U) * shentsize)) <= file->size); i++)
+    {
+        sh = shoff + ((size_t)i * shentsize);
+
+        if (ELF_SHT_SYMTAB == Seal_Read32(file, sh + 4U))
+        {
+            symoff  = Seal_Read32(file, sh + 16U);
+            symsize = Seal_Read32(file, sh + 20U);
+
+            /* sh_link: the string table of the symbols */
+            sh      = shoff + ((size_t)Seal_Read32(file, sh + 24U) * shentsize);
+            stroff  = Seal_Read32(file, sh + 16U);
+            strsize = Seal_Read32(file, sh + 20U);
+
+            for (j = 0U; (0U == address) && ((j + ELF_SYM_SIZE) <= symsize) &&
+                         ((symoff + j + ELF_SYM_SIZE) <= file->size); j += ELF_SYM_SIZE)
+            {
+                nameoff = Seal_Read32(file, symoff + j);
+
+                if ((nameoff < strsize) && ((stroff + nameoff + strlen(name)) < file->size) &&
+                    (0 == strcmp((const char *)&file->data[stroff + nameoff], name)))
+                {
+                    address = Seal_Read32(file, symoff + j + 4U);
+                }
+                else
+                {
+                    /* Other symbol */
+                }
+            }
+        }
+        else
+        {
+            /* Not a symbol table */
+        }
+    }
+
+    return address;
+}
+
+/* Flash contents of [address, address + size): loaded bytes, gaps erased. */
+static void Seal_Flash(const Seal_File_t *file, uint32_t address, uint32_t size, uint8_t *flash)
+{
+    uint32_t phoff;
+    uint32_t offset;
+    uint32_t paddr;
+    uint32_t filesz;
+    uint32_t first;
+    uint32_t last;
+    uint16_t phentsize;
+    uint16_t phnum;
+    uint16_t i;
+    size_t ph;
+
+    (void)memset(flash, SEAL_ERASED, size);
+
+    phoff     = Seal_Read32(file, 28U);
+    phentsize = Seal_Read16(file, 42U);
+    phnum     = Seal_Read16(file, 44U);
+
+    for (i = 0U; (i < phnum) && ((phoff + ((size_t)(i + 1U) * phentsize)) <= file->size); i++)
+    {
+        ph     = phoff + ((size_t)i * phentsize);
+        offset = Seal_Read32(file, ph + 4U);
+        paddr  = Seal_Read32(file, ph + 12U);
+        filesz = Seal_Read32(file, ph + 16U);
+        first  = (paddr > address) ? paddr : address;
+        last   = ((paddr + filesz) < (address + size)) ? (paddr + filesz) : (address + size);
+
+        if ((ELF_PT_LOAD == Seal_Read32(file, ph)) && (first < last) && ((offset + filesz) <= file->size))
+        {
+            (void)memcpy(&flash[first - address], &file->data[offset + (first - paddr)], last - first);
+        }
+        else
+        {
+            /* Not loaded, or outside the range */
+        }
+    }
+}
+
+/* File offset of a loaded address, 0 if it is not in the file. */
+static size_t Seal_FileOffset(const Seal_File_t *file, uint32_t address, uint32_t size)
+{
+    uint32_t phoff;
+    uint32_t paddr;
+    uint32_t filesz;
+    uint16_t phentsize;
+    uint16_t phnum;
+    uint16_t i;
+    size_t offset;
+    size_t ph;
+
+    offset    = 0U;
+    phoff     = Seal_Read32(file, 28U);
+    phentsize = Seal_Read16(file, 42U);
+    phnum     = Seal_Read16(file, 44U);
+
+    for (i = 0U; (0U == offset) && (i < phnum) && ((phoff + ((size_t)(i + 1U) * phentsize)) <= file->size); i++)
+    {
+        ph     = phoff + ((size_t)i * phentsize);
+        paddr  = Seal_Read32(file, ph + 12U);
+        filesz = Seal_Read32(file, ph + 16U);
+
+        if ((ELF_PT_LOAD == Seal_Read32(file, ph)) && (address >= paddr) && ((address + size) <= (paddr + filesz)))
+        {
+            offset = Seal_Read32(file, ph + 4U) + (address - paddr);
+            offset = ((offset + size) <= file->size) ? offset : 0U;
+        }
+        else
+        {
+            /* Other segment */
+        }
+    }
+
+    return offset;
+}
+
+int main(int argc, char **argv)
+{
+    static const CRC_Config_t config = CRC_CONFIG_CRC32;
+    static CRC_Table_t table;
+    Seal_File_t file;
+    const char *path;
+    uint8_t *flash;
+    uint32_t address;
+    uint32_t count;
+    uint32_t start;
+    uint32_t size;
+    uint32_t crc;
+    uint32_t i;
+    uint8_t check;
+    uint8_t changed;
+    size_t desc;
+    int result;
+
+    check  = ((3 == argc) && (0 == strcmp(argv[1], "-c"))) ? 1U : 0U;
+    path   = (2 == argc) ? argv[1] : ((0U != check) ? argv[2] : NULL);
+    result = 1;
+
+    if (NULL == path)
+    {
+        (void)fprintf(stderr, "usage: Image_Seal [-c] <image.elf>\n");
+    }
+    else if (0 != Seal_Load(path, &file))
+    {
+        /* Reported */
+    }
+    else if ((file.size < 52U) || (0 != memcmp(file.data, "\177ELF", 4U)) || (ELF_CLASS32 != file.data[4]) ||
+             (ELF_DATA_LSB != file.data[5]) || (ELF_MACHINE_ARM != Seal_Read16(&file, 18U)))
+    {
+        (void)fprintf(stderr, "Image_Seal: %s is not a 32-bit little endian ARM ELF\n", path);
+    }
+    else
+    {
+        address = Seal_FindSymbol(&file, SEAL_SYMBOL);
+        desc    = (0U != address) ? Seal_FileOffset(&file, address, SEAL_HEADER_SIZE) : 0U;
+        count   = (0U != desc) ? Seal_Read32(&file, desc + 4U) : 0U;
+
+        if ((0U == desc) || (SEAL_MAGIC != Seal_Read32(&file, desc)) || (count > SEAL_RANGE_MAX) ||
+            (0U == Seal_FileOffset(&file, address, SEAL_HEADER_SIZE + (count * SEAL_RANGE_SIZE))))
+        {
+            (void)fprintf(stderr, "Image_Seal: no image descriptor (%s) in %s\n", SEAL_SYMBOL, path);
+        }
+        else
+        {
+            (void)CRC_Soft_Init(&table, &config);
+            (void)printf("%s: descriptor at 0x%08lX, %lu ranges\n", path, (unsigned long)address,
+                         (unsigned long)count);
+
+            result  = 0;
+            changed = 0U;
+
+            for (i = 0U; (0 == result) && (i < count); i++)
+            {
+                start = Seal_Read32(&file, desc + SEAL_HEADER_SIZE + (i * SEAL_RANGE_SIZE));
+                size  = Seal_Read32(&file, desc + SEAL_HEADER_SIZE + (i * SEAL_RANGE_SIZE) + 4U);
+                flash = (uint8_t *)malloc((0U != size) ? size : 1U);
+
+                if (NULL == flash)
+                {
+                    (void)fprintf(stderr, "Image_Seal: out of memory\n");
+                    result = 1;
+                }
+                else
+                {
+                    Seal_Flash(&file, start, size, flash);
+                    crc = CRC_Soft_Compute(&table, flash, size);
+                    free(flash);
+
+                    changed |= (crc != Seal_Read32(&file, desc + SEAL_HEADER_SIZE + (i * SEAL_RANGE_SIZE) +
+                                                   SEAL_CRC_OFFSET)) ? 1U : 0U;
+                    Seal_Write32(&file, desc + SEAL_HEADER_SIZE + (i * SEAL_RANGE_SIZE) + SEAL_CRC_OFFSET, crc);
+
+                    (void)printf("  range %lu: 0x%08lX + %7lu bytes  CRC-32 0x%08lX\n", (unsigned long)i,
+                                 (unsigned long)start, (unsigned long)size, (unsigned long)crc);
+                }
+            }
+
+            if ((0 != result) || (0U == changed))
+            {
+                /* Nothing to write */
+            }
+            else if (0U != check)
+            {
+                (void)fprintf(stderr, "Image_Seal: %s is not sealed\n", path);
+                result = 1;
+            }
+            else
+            {
+                result = (0 == Seal_Save(path, &file)) ? 0 : 1;
+            }
+
+            (void)printf("%s\n", (0 != result) ? "failed" : ((0U != changed) && (0U == check)) ? "sealed" :
+                                                                                                  "already sealed");
+        }
+
+        free(file.data);
+    }
+
+    return result;
+}